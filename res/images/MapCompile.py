@@ -0,0 +1,72 @@
+# File: MapCompile.py
+# Name: Brian Cheung and Sam Wang
+# Date: 5/4/18
+# Desc: Compiles the full screen backgrounds in res/images/C into 8x8 tiles with one shared tile set
+# Usage: python MapCompile.py, run from res/images after changing a map, writes src/Maps.h
+
+import re
+
+MAPS = ["Corner_Map", "Hall_Map", "Cache_Map"]
+OUT = "../../src/Maps.h"
+
+WIDTH, HEIGHT = 128, 160	# screen size in LCDBuffer.h
+TILE = 8					# TILE_SIZE in GameObjects.h
+
+
+def read_map(name):
+	text = open("C/%s.c" % name).read()
+	body = re.search(r"const uint8_t %s\[\] = \{(.*?)\};" % name, text, re.S).group(1)
+	pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+	assert len(pixels) == WIDTH*HEIGHT, name
+	return pixels
+
+
+# blocks and the rows inside a tile keep the order of the map array, which is the screenBuffer order
+def cut_tiles(pixels, tiles, index):
+	grid = []
+	for by in range(HEIGHT//TILE):
+		for bx in range(WIDTH//TILE):
+			tile = tuple(pixels[(by*TILE+r)*WIDTH + bx*TILE + c] for r in range(TILE) for c in range(TILE))
+			if tile not in index:
+				index[tile] = len(tiles)
+				tiles.append(tile)
+			grid.append(index[tile])
+	return grid
+
+
+def rows(values, indent="  ", n=16):
+	return [indent + ", ".join("0x%02X" % v for v in values[i:i+n]) + "," for i in range(0, len(values), n)]
+
+
+def main():
+	tiles, index, grids = [], {}, {}
+	for name in MAPS:
+		grids[name] = cut_tiles(read_map(name), tiles, index)
+	assert len(tiles) <= 256, "tile numbers no longer fit in a byte"
+	out = ["// File: Maps.h",
+		"// Name: Brian Cheung and Sam Wang",
+		"// Date: 5/4/18",
+		"// Desc: Backgrounds of res/images/C cut into %d shared 8x8 tiles, generated by res/images/MapCompile.py" % len(tiles),
+		"// Usage: Included by AstroParty.c, edit the maps in res/images/C and run the script instead of editing this",
+		"",
+		"#ifndef MAPS_H",
+		"#define MAPS_H",
+		'#include "GameObjects.h"',
+		"",
+		"const uint8_t MapTiles[%d][TILE_SIZE*TILE_SIZE] = {" % len(tiles)]
+	for t, tile in enumerate(tiles):
+		out.append("  {//%d" % t)
+		out += rows(tile, "    ", TILE)	# one tile row per line
+		out.append("  },")
+	out.append("};\n")
+	for name in MAPS:
+		tilesName = name.replace("_Map", "_Tiles")
+		out.append("const uint8_t %s[%d] = {" % (tilesName, len(grids[name])))
+		out += rows(grids[name])
+		out.append("};")
+		out.append("const TileMap %s = {MapTiles, %s};\n" % (name, tilesName))
+	out.append("#endif")
+	open(OUT, "w", newline="\r\n").write("\n".join(out) + "\n")
+
+
+main()
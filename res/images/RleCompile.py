@@ -0,0 +1,110 @@
+# File: RleCompile.py
+# Name: Brian Cheung and Sam Wang
+# Date: 5/4/18
+# Desc: Compresses the opaque full color images in res/images/C for ST7735_DrawRLE16()
+# Usage: python RleCompile.py, run from res/images after changing one of the images, writes src/Splash.h
+
+import re
+
+OUT = "../../src/Splash.h"
+
+# images sent straight to the panel, name: (width, height)
+IMAGES = {
+	"Astro_Start_Menu": (128, 160),
+	"Win_P1": (21, 150), "Win_P1_180": (21, 150),
+	"Win_P2": (20, 150), "Win_P2_180": (20, 150),
+}
+
+RUN = 0x80		# token bit that tells a repeated color from literal colors
+MAX_N = 0x80	# pixels per token
+
+
+def read_image(name, w, h):
+	text = open("C/%s.c" % name).read()
+	body = re.search(r"(unsigned short|uint8_t) %s\[\] = \{(.*?)\};" % name, text, re.S)
+	pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body.group(2))]
+	assert len(pixels) == w*h, name
+	if body.group(1) == "uint8_t":
+		pixels = [convert(v) for v in pixels]
+	return pixels
+
+
+# same as ST7735_Convert()
+def convert(color):
+	color = (color << 1) & 0xFF
+	bgr = ((color & 0xC0) << 8) | ((color & 0xC0) << 6) | ((color & 0x80) << 4)
+	bgr |= ((color & 0x38) << 5) | ((color & 0x38) << 2)
+	bgr |= ((color & 0x07) << 2) | ((color & 0x06) >> 1)
+	return bgr
+
+
+# the images are stored bottom row first, the panel wants the top row first
+def top_down(pixels, w, h):
+	return [c for r in reversed(range(h)) for c in pixels[r*w:(r+1)*w]]
+
+
+# a token byte n < RUN is followed by n+1 colors, RUN+n by one color sent n+1 times
+# colors are two bytes, most significant first, and tokens run on across rows
+def compress(pixels):
+	out, literal, i = [], [], 0
+	def flush():
+		while literal:
+			chunk = literal[:MAX_N]
+			del literal[:MAX_N]
+			out.append(len(chunk) - 1)
+			for c in chunk:
+				out.extend([c >> 8, c & 0xFF])
+	while i < len(pixels):
+		n = 1
+		while i+n < len(pixels) and n < MAX_N and pixels[i+n] == pixels[i]:
+			n += 1
+		if n >= 2:			# a run of two already costs no more than the literal
+			flush()
+			out += [RUN + n - 1, pixels[i] >> 8, pixels[i] & 0xFF]
+		else:
+			literal.append(pixels[i])
+		i += n
+	flush()
+	return out
+
+
+# decodes like ST7735_DrawRLE16() to check the tokens
+def expand(data):
+	pixels, i = [], 0
+	while i < len(data):
+		t = data[i]
+		if t & RUN:
+			pixels += [(data[i+1] << 8) | data[i+2]] * ((t & (RUN-1)) + 1)
+			i += 3
+		else:
+			for k in range(t + 1):
+				pixels.append((data[i+1+2*k] << 8) | data[i+2+2*k])
+			i += 1 + 2*(t + 1)
+	return pixels
+
+
+def main():
+	out = ["// File: Splash.h",
+		"// Name: Brian Cheung and Sam Wang",
+		"// Date: 5/4/18",
+		"// Desc: Full color images of res/images/C run length encoded for ST7735_DrawRLE16(), generated by res/images/RleCompile.py",
+		"// Usage: Included by AstroParty.c, edit the images in res/images/C and run the script instead of editing this",
+		"",
+		"#ifndef SPLASH_H",
+		"#define SPLASH_H",
+		"#include <stdint.h>",
+		""]
+	for name, (w, h) in IMAGES.items():
+		pixels = top_down(read_image(name, w, h), w, h)
+		data = compress(pixels)
+		assert expand(data) == pixels, name
+		out.append("//%dx%d, %d bytes instead of %d" % (w, h, len(data), 2*w*h))
+		out.append("const uint8_t %s_RLE[] = {" % name)
+		for i in range(0, len(data), 16):
+			out.append("  " + ", ".join("0x%02X" % v for v in data[i:i+16]) + ",")
+		out.append("};\n")
+	out.append("#endif")
+	open(OUT, "w", newline="\r\n").write("\n".join(out) + "\n")
+
+
+main()
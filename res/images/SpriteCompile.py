@@ -0,0 +1,104 @@
+# File: SpriteCompile.py
+# Name: Brian Cheung and Sam Wang
+# Date: 5/4/18
+# Desc: Compiles the transparent sprites of src/Images.h into opaque runs for drawSprite() and drawPlayer()
+# Usage: python SpriteCompile.py, run from res/images after changing Images.h, writes src/Sprites.h
+
+import re
+
+IMAGES = "../../src/Images.h"
+OUT = "../../src/Sprites.h"
+
+TRANSPARENT = 0x01
+SHIP_COLOR = 0x07		# pixels of the P1_x frames that take the player color
+PLAYER_COLORS = {"P1": 0x07, "P2": 0xE4}	# PLAYER1_COLOR and PLAYER2_COLOR in GameObjects.h
+
+# sprites drawn with drawSprite(), name: (width, height)
+SPRITES = {
+	"Kill_1": (75, 30), "Kill_3": (75, 30), "Kill_5": (75, 30),
+	"Level_Corner": (87, 30), "Level_Hall": (87, 30), "Level_Cache": (87, 30),
+	"Start": (50, 20),
+	"Bullet_Explosion": (9, 9),
+}
+SHIP = (9, 9)
+
+
+def read_images(path):
+	text = open(path).read()
+	images = {}
+	for name, body in re.findall(r"const uint8_t (\w+)\[\] = \{(.*?)\};", text, re.S):
+		images[name] = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+	return images
+
+
+# each row becomes a run count, then a skip and copy count per run
+# the runs of a row cover its full width, a last run with copy 0 means the row ends transparent
+def compile_runs(pixels, w, h):
+	runs, opaque = [], []
+	for r in range(h):
+		row = pixels[r*w:(r+1)*w]
+		rowRuns, c = [], 0
+		while c < w:
+			skip = 0
+			while c < w and row[c] == TRANSPARENT:
+				skip += 1
+				c += 1
+			copy = 0
+			while c < w and row[c] != TRANSPARENT:
+				opaque.append(row[c])
+				copy += 1
+				c += 1
+			rowRuns += [skip, copy]
+		runs += [len(rowRuns)//2] + rowRuns
+	return runs, opaque
+
+
+def table(name, values):
+	lines = ["const uint8_t %s[] = {" % name]
+	for i in range(0, len(values), 16):
+		lines.append("  " + ", ".join("0x%02X" % v for v in values[i:i+16]) + ",")
+	lines.append("};")
+	return "\n".join(lines) + "\n"
+
+
+# an opaque sprite copies its source image, so only the runs are written out
+def sprite(name, image, pixels, w, h, recolored=False):
+	runs, opaque = compile_runs(pixels, w, h)
+	text = table(name + "_Runs", runs)
+	if len(opaque) == w*h and not recolored:
+		return text, "{%s, %s_Runs, %s, %d, %d}" % (image, name, image, w, h)
+	text += table(name + "_Pixels", opaque)
+	return text, "{%s, %s_Runs, %s_Pixels, %d, %d}" % (image, name, name, w, h)
+
+
+def main():
+	images = read_images(IMAGES)
+	out = ["// File: Sprites.h",
+		"// Name: Brian Cheung and Sam Wang",
+		"// Date: 5/4/18",
+		"// Desc: Sprites of Images.h compiled into opaque runs, generated by res/images/SpriteCompile.py",
+		"// Usage: Included by AstroParty.c after Images.h, edit Images.h and run the script instead of editing this",
+		"",
+		"#ifndef SPRITES_H",
+		"#define SPRITES_H",
+		'#include "GameObjects.h"',
+		""]
+	for name, (w, h) in SPRITES.items():
+		text, init = sprite(name, name, images[name], w, h)
+		out.append(text)
+		out.append("const Sprite %s_S = %s;\n" % (name, init))
+	for player, color in PLAYER_COLORS.items():
+		inits = []
+		for d in range(16):
+			src = "P1_%d" % d
+			pixels = [color if v == SHIP_COLOR else v for v in images[src]]
+			text, init = sprite("%s_Ship%d" % (player, d), src, pixels, SHIP[0], SHIP[1], True)
+			out.append(text)
+			inits.append(init)
+		out.append("//P1_x rotation frames already in the %s color\nconst Sprite %s_Ships[16] = {\n  %s\n};\n"
+			% (player, player, ",\n  ".join(inits)))
+	out.append("#endif")
+	open(OUT, "w", newline="\r\n").write("\n".join(out) + "\n")
+
+
+main()
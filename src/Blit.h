@@ -0,0 +1,11 @@
+#ifndef BLIT_H
+#define BLIT_H
+#include <stdint.h>
+
+//copy n words from src to dst, both word aligned, using load/store multiple
+void copyWords(uint32_t *dst, const uint32_t *src, uint32_t n);
+
+//fill n words at dst, word aligned, with value using store multiple
+void fillWords(uint32_t *dst, uint32_t value, uint32_t n);
+
+#endif
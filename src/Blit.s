@@ -0,0 +1,74 @@
+; File: Blit.s
+; Name: Brian Cheung and Sam Wang
+; Date: 5/4/18
+; Desc: Word kernels for the screen buffer blitters in LCDBuffer.c
+; Usage: Called by copySpan() and fillSpan() for the aligned middle of long rows
+
+      EXPORT   copyWords
+      EXPORT   fillWords
+
+      AREA    |.text|, CODE, READONLY, ALIGN=2
+      THUMB
+      ALIGN
+
+; Both kernels move four words per LDM/STM, which takes 1+4
+; cycles on the Cortex-M4 where four single LDR/STR take up
+; to 8.  The 0 to 3 words left over are moved one at a
+; time.  Neither function calls anything, so the stack does
+; not need to stay 8-byte aligned.
+
+; Copies whole words from one buffer to another.
+; Input: R0  destination, word aligned
+;        R1  source, word aligned
+;        R2  number of words
+; Output: none
+copyWords
+	PUSH {R4-R6}
+	SUBS R2, R2, #4
+	BLO copyTail				;fewer than four words
+copyLoop
+	LDMIA R1!, {R3-R6}
+	STMIA R0!, {R3-R6}
+	SUBS R2, R2, #4
+	BHS copyLoop
+copyTail
+	ADDS R2, R2, #4				;0 to 3 words left
+	BEQ copyDone
+copyTailLoop
+	LDR R3, [R1], #4
+	STR R3, [R0], #4
+	SUBS R2, R2, #1
+	BNE copyTailLoop
+copyDone
+	POP {R4-R6}
+	BX LR
+
+; Fills whole words with the same value.
+; Input: R0  destination, word aligned
+;        R1  value for every word
+;        R2  number of words
+; Output: none
+fillWords
+	PUSH {R4-R5}
+	MOV R3, R1
+	MOV R4, R1
+	MOV R5, R1
+	SUBS R2, R2, #4
+	BLO fillTail				;fewer than four words
+fillLoop
+	STMIA R0!, {R1,R3-R5}
+	SUBS R2, R2, #4
+	BHS fillLoop
+fillTail
+	ADDS R2, R2, #4				;0 to 3 words left
+	BEQ fillDone
+fillTailLoop
+	STR R1, [R0], #4
+	SUBS R2, R2, #1
+	BNE fillTailLoop
+fillDone
+	POP {R4-R5}
+	BX LR
+
+	ALIGN
+	END
@@ -0,0 +1,23 @@
+// File: CycleCount.c
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: This software reads the Cortex-M4 cycle counter
+// Usage: Time a piece of code in bus clock cycles, e.g. the LCD benchmark
+
+#include "CycleCount.h"
+
+#define DEMCR_R				(*((volatile uint32_t *)0xE000EDFC))	//Debug Exception and Monitor Control
+#define DWT_CTRL_R		(*((volatile uint32_t *)0xE0001000))	//Data Watchpoint and Trace control
+#define DWT_CYCCNT_R	(*((volatile uint32_t *)0xE0001004))	//cycle count
+#define DEMCR_TRCENA	0x01000000
+#define DWT_CTRL_CYCCNTENA	0x00000001
+
+void CycleCount_Init(void){
+	DEMCR_R |= DEMCR_TRCENA;						//enable the DWT unit
+	DWT_CYCCNT_R = 0;
+	DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;		//start counting
+}
+
+uint32_t CycleCount_Now(void){
+	return DWT_CYCCNT_R;
+}
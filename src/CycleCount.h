@@ -0,0 +1,11 @@
+#ifndef CYCLECOUNT_H
+#define CYCLECOUNT_H
+#include <stdint.h>
+
+//start the Cortex-M4 DWT cycle counter, it counts bus clocks (12.5ns at 80MHz) and wraps every 53s
+void CycleCount_Init(void);
+
+//current cycle count, subtract two readings to time the code between them
+uint32_t CycleCount_Now(void);
+
+#endif
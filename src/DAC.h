@@ -1,9 +1,9 @@
-#ifndef DAC_H
-#define DAC_H
-#include <stdint.h>
-
-void DAC_Init(void);
-
-void DAC_Out(uint8_t data);
-
-#endif
+#ifndef DAC_H
+#define DAC_H
+#include <stdint.h>
+
+void DAC_Init(void);
+
+void DAC_Out(uint8_t data);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef FIXED_H
+#define FIXED_H
+#include <stdint.h>
+
+//Q16.16 fixed point for positions and velocities, whole pixels in the high half and subpixels in the low half
+//only integer operations, so the engine moves the same on the board and compiled for a PC:
+//>> of a negative number brings in sign bits and / rounds toward 0 with both ARMCC and gcc
+typedef int32_t fixed;
+#define FIX_SHIFT 16
+#define FIX_ONE (1<<FIX_SHIFT)
+
+#define FIX(c) ((fixed)((c)*FIX_ONE))				//from a real constant, folded by the compiler, never a variable
+#define FIX_I(n) ((fixed)(n)*FIX_ONE)				//from whole pixels
+#define FIX_INT(f) ((int16_t)((f)>>FIX_SHIFT))	//to whole pixels, rounded down like the pixel the point is in
+#define FIX_ABS(f) ((f)<0 ? -(f) : (f))
+#define FIX_MUL(a,b) ((fixed)(((int64_t)(a)*(b))>>FIX_SHIFT))
+#define FIX_DIV(a,b) ((fixed)(((int64_t)(a)*FIX_ONE)/(b)))
+
+//{dx,dy} of each of the 16 ship directions at speed pixels a frame, dir*22.5 degrees counterclockwise from the right,
+//dy is -sin like the rest of the engine, the compiler works out every entry so a speed constant is all a table needs
+#define FIX_DIRECTIONS(speed) { \
+	{FIX((speed)*1.0), FIX((speed)*0.0)}, \
+	{FIX((speed)*0.92387953), FIX((speed)*-0.38268343)}, \
+	{FIX((speed)*0.70710678), FIX((speed)*-0.70710678)}, \
+	{FIX((speed)*0.38268343), FIX((speed)*-0.92387953)}, \
+	{FIX((speed)*0.0), FIX((speed)*-1.0)}, \
+	{FIX((speed)*-0.38268343), FIX((speed)*-0.92387953)}, \
+	{FIX((speed)*-0.70710678), FIX((speed)*-0.70710678)}, \
+	{FIX((speed)*-0.92387953), FIX((speed)*-0.38268343)}, \
+	{FIX((speed)*-1.0), FIX((speed)*0.0)}, \
+	{FIX((speed)*-0.92387953), FIX((speed)*0.38268343)}, \
+	{FIX((speed)*-0.70710678), FIX((speed)*0.70710678)}, \
+	{FIX((speed)*-0.38268343), FIX((speed)*0.92387953)}, \
+	{FIX((speed)*0.0), FIX((speed)*1.0)}, \
+	{FIX((speed)*0.38268343), FIX((speed)*0.92387953)}, \
+	{FIX((speed)*0.70710678), FIX((speed)*0.70710678)}, \
+	{FIX((speed)*0.92387953), FIX((speed)*0.38268343)} \
+}
+
+//sin of a in 256ths of a turn, cos is a quarter turn on
+extern const fixed SinTable[256];
+#define FIX_SIN(a) (SinTable[(uint8_t)(a)])
+#define FIX_COS(a) (SinTable[(uint8_t)((a)+64)])
+
+#endif
@@ -1,99 +1,128 @@
-#ifndef GAMEOBJECTS_H
-#define GAMEOBJECTS_H
-#include <stdint.h>
-
-#define PARTICLES_N 100
-typedef struct Particle {
-	double x, y, dx, dy;
-	double angle;
-	const uint8_t *sprite;
-	uint8_t active;
-	uint8_t displayed;
-	uint8_t time;
-} Particle;
-
-enum PowerUpEnum {None,Reverse,Laser,Blades};
-
-#define POWERUP_WIDTH 9
-#define POWERUP_HEIGHT 9
-
-typedef __packed struct PowerUp {
-	double x, y;
-	enum PowerUpEnum powerUp;
-	const uint8_t *sprite;
-	uint8_t active;
-	uint8_t displayed;
-	uint16_t powerUpCooldown;
-} PowerUp;
-
-#define BULLET_WIDTH 2
-#define BULLET_HEIGHT 2
-#define BULLET_EXP_W 9
-#define BULLET_EXP_H 9
-typedef struct Bullet {
-	double x, y, dx, dy, expX, expY;
-	const uint8_t *bulletSprite;
-	const uint8_t *bulletExp;
-	uint8_t active;
-	uint8_t destroyed;
-} Bullet;
-
-#define PLAYER_WIDTH 9
-#define PLAYER_HEIGHT 9
-#define PLAYER1_COLOR 0x07
-#define PLAYER2_COLOR 0xE4
-#define PLAYER_AMMO 3
-typedef struct Player {
-	double x, y, dx, dy;
-	uint8_t dir;
-	uint16_t angle;
-	uint8_t color;
-	const uint8_t *sprites[16];
-	Bullet ammo[PLAYER_AMMO];
-	uint8_t shotCooldown;
-	uint8_t alive;
-	uint8_t kills;
-	enum PowerUpEnum powerUp;
-} Player;
-
-typedef struct BladesPU {
-	Player *player;
-	uint8_t displayed;
-	uint8_t bladeTime;
-} BladesPU;
-
-#define LASER_WIDTH 3
-#define LASER_HEIGHT 3
-typedef struct LaserBeamPU {
-	double startX, startY,stopX,stopY,dx,dy;
-	const uint8_t *sprite;
-	uint8_t displayed;
-} LaserBeamPU;
-
-#define WALL_SIZE 10
-#define WALL_COLOR1 0xFF
-#define WALL_COLOR2 0xC7
-#define WALL_COLOR3 0x5c
-
-typedef __packed struct Wall {
-	uint8_t active;
-	uint16_t x,y;
-	uint8_t destructible;
-	uint8_t displayed;
-	uint8_t destroyed;
-	uint8_t colors[2];
-} Wall;
-
-#define WALLS_N 48
-#define POWERUPS_N 3
-
-typedef __packed struct GameState {
-	uint8_t paused;
-	uint8_t clockwise;
-	uint8_t kills;
-	const uint8_t *map;
-	Wall walls[WALLS_N];
-	PowerUp powerUps[POWERUPS_N];
-} GameState;
-
-#endif
+#ifndef GAMEOBJECTS_H
+#define GAMEOBJECTS_H
+#include <stdint.h>
+#include "Fixed.h"
+
+//sprite compiled into opaque runs by res/images/SpriteCompile.py, see Sprites.h
+//each row is a run count, then a skip and copy count per run, rows bottom first like the source image
+typedef struct Sprite {
+	const uint8_t *image;		//source image in Images.h, transparent pixels are 1
+	const uint8_t *runs;
+	const uint8_t *pixels;	//opaque pixels of every run in order
+	uint8_t w, h;
+} Sprite;
+
+//background compiled into 8x8 tiles by res/images/MapCompile.py, see Maps.h
+//grid holds one tile number per block, blocks in the same order as screenBuffer pixels
+#define TILE_SIZE 8
+typedef struct TileMap {
+	const uint8_t (*tiles)[TILE_SIZE*TILE_SIZE];	//tile set shared by every map
+	const uint8_t *grid;
+} TileMap;
+
+#define PARTICLES_N 100
+typedef struct Particle {
+	fixed x, y, dx, dy;
+	uint8_t active;
+	uint8_t time;
+} Particle;
+
+enum PowerUpEnum {None,Reverse,Laser,Blades};
+
+#define POWERUP_WIDTH 9
+#define POWERUP_HEIGHT 9
+
+typedef __packed struct PowerUp {
+	fixed x, y;
+	enum PowerUpEnum powerUp;
+	const uint8_t *sprite;
+	uint8_t active;
+	uint8_t displayed;
+	uint16_t powerUpCooldown;
+} PowerUp;
+
+#define BULLET_WIDTH 2
+#define BULLET_HEIGHT 2
+#define BULLET_EXP_W 9
+#define BULLET_EXP_H 9
+typedef struct Bullet {
+	fixed x, y, dx, dy;
+	int16_t expX, expY;		//bottom left corner of the explosion
+	const uint8_t *bulletSprite;
+	const Sprite *bulletExp;
+	uint8_t active;
+	uint8_t destroyed;
+	struct Player *target;	//ship objectsCD() found on this frame's move, 0 if none
+	fixed targetTime;				//part of the move where it reaches it
+} Bullet;
+
+#define PLAYER_WIDTH 9
+#define PLAYER_HEIGHT 9
+#define PLAYER1_COLOR 0x07
+#define PLAYER2_COLOR 0xE4
+#define PLAYER_AMMO 3
+typedef struct Player {
+	fixed x, y, dx, dy;
+	uint8_t dir;
+	uint16_t angle;
+	uint8_t color;
+	const uint8_t *sprites[16];
+	const Sprite *ships;		//sprites already in the player color
+	Bullet ammo[PLAYER_AMMO];
+	uint8_t shotCooldown;
+	uint8_t alive;
+	uint8_t kills;
+	enum PowerUpEnum powerUp;
+} Player;
+
+typedef struct BladesPU {
+	Player *player;
+	uint8_t displayed;
+	uint8_t bladeTime;
+} BladesPU;
+
+#define LASER_WIDTH 3
+#define LASER_HEIGHT 3
+#define LASER_ROWS 160		//a beam crosses at most every row of the screen
+#define LASER_EDGE 0x80		//set in x0 or x1 of a span when that end pixel has the edge color
+//beam rasterized once by shootLaser(), one span per row from row top down the screen
+//the core color is the center of sprite and the edge color its corner, like the 3x3 stamps it replaces
+typedef struct LaserBeamPU {
+	const uint8_t *sprite;
+	uint8_t displayed;
+	uint8_t top, rows;
+	uint8_t x0[LASER_ROWS], x1[LASER_ROWS];	//first and last column of each span
+} LaserBeamPU;
+
+#define WALL_SIZE 10
+#define WALL_COLOR1 0xFF
+#define WALL_COLOR2 0xC7
+#define WALL_COLOR3 0x5c
+
+//16-bit color the screen is tinted with while the Reverse powerup has the ships turning counterclockwise
+#define REVERSE_TINT 0xF81F		//ST7735_MAGENTA
+#define REVERSE_TINT_LEVEL 48	//of 256
+#define REVERSE_TINT_FRAMES 4
+
+typedef __packed struct Wall {
+	uint8_t active;
+	uint16_t x,y;
+	uint8_t destructible;
+	uint8_t displayed;
+	uint8_t destroyed;
+	uint8_t colors[2];
+} Wall;
+
+#define WALLS_N 48
+#define POWERUPS_N 3
+
+typedef __packed struct GameState {
+	uint8_t paused;
+	uint8_t clockwise;
+	uint8_t kills;
+	const TileMap *map;
+	Wall walls[WALLS_N];
+	PowerUp powerUps[POWERUPS_N];
+} GameState;
+
+#endif
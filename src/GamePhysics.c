@@ -1,665 +1,1034 @@
-// File: GamePhysics.c
-// Name: Brian Cheung and Sam Wang
-// Date: 5/4/18
-// Desc: This software is the physics engine and contains the game actions
-// Usage: Update and move game objects; collision detection
-
-#include "GamePhysics.h"
-#include "AstroParty.h"
-#include "math.h"
-#include "LCDBuffer.h"
-#include "Sound.h"
-#include "ST7735.h"
-#include "RandomGenerate.h"
-
-#define HEIGHT 160
-#define WIDTH 128
-#define ACCEL 2.2
-#define MAX_SPEED 2.5
-#define ANG_VEL 12
-#define BULLET_SPEED 5
-#define PI 3.14159265359
-#define PI8 PI/8 //angle = pi/8
-#define DT 0.033333 //delta time at 30Hz
-#define SHOT_COOLDOWN 10
-#define POWERUP_COOLDOWN 300
-#define BLADE_TIME 150
-
-
-
-BladesPU blades = {0,0,BLADE_TIME};
-
-void rotatePlayer(Player *player){
-	if(game.clockwise){
-		if(player->angle == 0) {
-			player->angle = 360 - ANG_VEL;		//0 wraps around to 360 - ANG_VEL
-		} else{
-			player->angle = (player->angle-ANG_VEL)%360;	
-		}
-	} else {
-		player->angle = (player->angle+ANG_VEL)%360;
-	}
-	player->dir = (player->angle)/22.5;
-}
-
-void acceleratePlayer(Player *player){
-	double theta = PI8*player->dir;		//player angle
-	double dx = cos(theta)*MAX_SPEED;		//desired dx
-	double dy = -sin(theta)*MAX_SPEED;	//desired dy
-	
-	//accelerate player until desired dx is reached
-	if(fabs(player->dx - dx) < DT*ACCEL){
-		player->dx = dx;
-	}	else if(player->dx < dx){
-		player->dx += DT*ACCEL;
-	} else if(player->dx > dx){
-		player->dx -= DT*ACCEL;
-	}
-	
-	//accelerate player until desired dy is reached	
-	if(fabs(player->dy - dy) < DT*ACCEL){
-		player->dy = dy;
-	}	else if(player->dy < dy){
-		player->dy += DT*ACCEL;
-	} else if(player->dy > dy){
-		player->dy -= DT*ACCEL;
-	}	
-}
-
-void movePlayer(Player *player){
-	powerUpCD(player);
-	//erase previous player image
-	eraseRect(player->x,player->y,PLAYER_WIDTH,PLAYER_HEIGHT);
-	//update player x and y position w/ dx and dy
-	double newX = player->x + player->dx;
-	double newY = player->y + player->dy;
-	
-	//player may destroy destructible walls and player on contact
-	if(player->powerUp == Blades && blades.displayed==1){
-		for(uint8_t i=0; i<WALLS_N; i++){
-				//detect collision with destructible wall
-				if(game.walls[i].destructible){
-					if (newX < game.walls[i].x + WALL_SIZE &&
-						newX + PLAYER_WIDTH > game.walls[i].x &&
-						newY > game.walls[i].y - WALL_SIZE &&
-						newY - PLAYER_HEIGHT < game.walls[i].y){
-							game.walls[i].destroyed = 1;
-						}
-				}
-		}
-		//detect collision with other player
-		if(player == &p1){
-			if (newX < p2.x + PLAYER_WIDTH &&
-				newX + PLAYER_WIDTH > p2.x &&
-				newY > p2.y - PLAYER_HEIGHT &&
-				newY - PLAYER_WIDTH < p2.y) {
-					p2.alive = 0;
-					p1.kills += 1;
-					Sound_Explosion2();
-				}		
-		} else {
-			if (newX < p1.x + PLAYER_WIDTH &&
-				newX + PLAYER_WIDTH > p1.x &&
-				newY > p1.y - PLAYER_HEIGHT &&
-				newY - PLAYER_HEIGHT < p1.y) {
-					p1.alive = 0;
-					p2.kills += 1;
-					Sound_Explosion1();
-				}
-		}		
-		
-	}
-	
-	//player collision with wall
-	uint8_t colX=0, colY=0;
-	for(uint8_t i=0; i<WALLS_N; i++){
-		if(!(game.walls[i].destroyed)){
-			//detect collision with new position on specific wall
-			if (newX < game.walls[i].x + WALL_SIZE &&
-				newX + PLAYER_WIDTH > game.walls[i].x &&
-				newY > game.walls[i].y - WALL_SIZE &&
-				newY - PLAYER_HEIGHT < game.walls[i].y) {
-					//collision detected
-					//detect collision with new x position
-					if (newX < game.walls[i].x + WALL_SIZE &&
-						newX + PLAYER_WIDTH > game.walls[i].x &&
-						player->y > game.walls[i].y - WALL_SIZE &&
-						player->y - PLAYER_HEIGHT < game.walls[i].y) {
-							//collision in x direction
-							colX = 1;
-						}
-					//detect collision with new y position
-					if (player->x < game.walls[i].x + WALL_SIZE &&
-						player->x + PLAYER_WIDTH > game.walls[i].x &&
-						newY > game.walls[i].y - WALL_SIZE &&
-						newY - PLAYER_HEIGHT < game.walls[i].y) {
-							//collision in y direction
-							colY = 1;
-						}
-				}
-		}
-	}
-	
-	//player collision with boundary
-	uint8_t right = (newX+PLAYER_WIDTH-1)>=WIDTH-1, //exceeds right of screen
-			left = newX<0+1, 												//exceeds left of screen
-			top = (newY-PLAYER_HEIGHT+1)<0+1,				//exceeds top of screen
-			bottom = newY>=HEIGHT-1;								//exceeds bottom of screen
-	uint8_t sum = right+left+top+bottom+(colX+colY);
-	
-	if(sum==2){	//collision with 2 edges
-		//collision detected in both directions, player doesn't move
-		drawPlayer(player);
-		return;
-	}
-	if(right){             		//exceeds right of screen
-		colX=1;
-	}
-	if(left){                 //exceeds left of screen
-		colX=1;
-	}
-	if(top){                  //exceeds top of screen
-		colY=1;
-	}
-	if(bottom){               //exceeds bottom of screen
-		colY=1;
-	}
-	
-	//move player if collcion in direction is not detected
-	if(!colX){
-		player->x = newX;
-	} else{
-		player->dx = 0;
-	}
-	if(!colY){
-		player->y = newY;
-	} else{
-		player->dy = 0;
-	}
-
-	//draw new player position
-	drawPlayer(player);
-	
-}
-
-void shootBullet(Player *player){
-	//detect if player has powerUp
-	switch (player->powerUp){
-		case Reverse : {
-			break;
-		}
-		case Laser : {
-			shootLaser(player);
-			break;
-		}
-		case Blades : {
-			blades.player = player;
-			blades.displayed = 1;
-			blades.bladeTime = BLADE_TIME;
-		}
-		case None : {
-			//shoot bullet if there exists an inactive bullet and shotCooldown == 0
-			if(player->shotCooldown != 0) {
-				return;
-			}
-			
-			for(uint8_t i=0; i<PLAYER_AMMO+1; i++){
-				if(i>PLAYER_AMMO){
-					//no inactive bullets
-					Sound_NoShoot();
-				}
-				else if(player->ammo[i].active){
-					Sound_Shoot();
-					double theta = PI8*player->dir;		//player angle
-					player->ammo[i].active = 1;				//activate bullet
-					
-					//start bullet at player's origin
-					player->ammo[i].x = player->x + PLAYER_WIDTH/2;
-					player->ammo[i].y = player->y - PLAYER_HEIGHT/2;
-					
-					//calculate bullet velocity
-					double dx = cos(theta)*BULLET_SPEED,
-								dy = -sin(theta)*BULLET_SPEED;
-					player->ammo[i].dx = dx;			
-					player->ammo[i].dy = dy;	
-					
-					//direction offset from player sprite
-					double newX = player->ammo[i].x + dx/4, 
-								newY = player->ammo[i].y + dy/4;
-					while(newX <= player->x + PLAYER_WIDTH &&
-						newX + BULLET_WIDTH >= player->x &&
-						newY >= player->y - PLAYER_HEIGHT &&
-						newY - BULLET_HEIGHT <= player->y &&
-						newX < WIDTH && newX > 0 && newY > 0 && newY < HEIGHT){
-							newX += dx/4;
-							newY += dy/4;
-						}	
-					player->ammo[i].x = newX;
-					player->ammo[i].y = newY;
-					if(newX < WIDTH-1 && newX > 1 && newY > 1 && newY < HEIGHT-1){
-						(bulletCD(&(player->ammo[i]),player));
-						drawBullet(&(player->ammo[i]));
-					} else {
-						return;
-					}
-				}
-			}
-		}
-	}
-	player->shotCooldown = SHOT_COOLDOWN;		//reset shotCooldown
-
-}
-
-//move bullets with dx and dy
-//linear bullet collision detection
-void moveBullets(Player *player){
-	//update bullet x and y position w/ dx and dy
-	for(uint8_t i=0; i<3; i++){
-		if(player->ammo[i].active){
-			//erase previous active bullets
-			eraseRect(player->ammo[i].x,player->ammo[i].y,BULLET_WIDTH,BULLET_HEIGHT);
-			
-			//calculate line between old bullet position and new bullet position
-			double dx, dy, oldX, oldY, newX, newY, 
-						 colDx, colDy, colX,colY, endX, endY;
-			oldX = player->ammo[i].x;
-			oldY = player->ammo[i].y;
-			newX = player->ammo[i].x + player->ammo[i].dx;
-			newY = player->ammo[i].y + player->ammo[i].dy;
-			
-			//start at leftmost point
-			if(oldX>newX){
-				colX = newX;
-				colY = newY;
-				endX = oldX;
-				endY = oldY;
-			} else {
-				colX = oldX;
-				colY = oldY;
-				endX = newX;
-				endY = newY;
-			}
-			//calculate slope from left point, dx>=0
-			dx = endX-colX;
-			dy = endY-colY;
-			double m;
-			//calculate slope 
-			if(fabs(dx)>=0.1 && fabs(dy)>=0.1){		//if dy!=0 and dx!=0 within 0.1 error
-				m = dy/dx;
-				if(dy>0){
-					if(fabs(m)<1 && fabs(m-1)>=0.1){
-						colDx = 1;		//Xn+1 = Xn + 1
-						colDy = m;		//Yn+1 = Yn + m
-					}else if(fabs(m)>1 && fabs(m-1)>=0.1){	//m!=1 within 0.1 error
-						colDx = 1/m;		//Xn+1 = Xn + 1/m
-						colDy = 1;			//Yn+1 = Yn + 1
-					} else {		//m=1
-						colDx = 1;		//Xn+1 = Xn + 1
-						colDy = 1;		//Yn+1 = Yn + 1
-					}
-				} else {					//dy<0
-					if(fabs(m)<1 && fabs(m-1)>=0.1){	//m!=1 within 0.1 error
-						colDx = 1;		//Xn+1 = Xn + 1
-						colDy = m;		//Yn+1 = Yn + m
-					}else if(fabs(m)>1 && fabs(m-1)>=0.1){
-						colDx = -1/m;		//Xn+1 = Xn + 1/m
-						colDy = -1;			//Yn+1 = Yn - 1
-					} else {		//m=-1
-						colDx = 1;		//Xn+1 = Xn + 1
-						colDy = -1;		//Yn+1 = Yn - 1
-					}
-				}
-			} else if(fabs(dx)<=0.1){	//dx = 0
-				endX = colX;
-				if(dy>0){
-					colDx = 0;		//Xn+1 = Xn
-					colDy = 1;		//Yn+1 = Yn + 1
-				} else{
-					colDx = 0;		//Xn+1 = Xn
-					colDy = -1;		//Yn+1 = Yn - 1
-				}
-			} else {	//dy = 0	
-				endY = colY;				
-				colDx = 1;		//Xn+1 = Xn + 1
-				colDy = 0;		//Yn+1 = Yn
-			}			
-			//separate dx and dy because dx might be reached but not dy
-			while(colX<endX || fabs(colY)<fabs(endY)){
-				player->ammo[i].x = colX;
-				player->ammo[i].y = colY;
-				//bullet collision detection
-				if(bulletCD(&(player->ammo[i]),player)) return;
-				if(colX<endX){	
-				colX += colDx;
-				} 
-				if(fabs(colY)<fabs(endY)) {
-				colY += colDy;
-				}
-			}
-			
-			//update new bullet position
-			player->ammo[i].x = newX;
-			player->ammo[i].y = newY;
-			//bullet collision detection
-			if(bulletCD(&(player->ammo[i]),player)) return;
-			drawBullet(&(player->ammo[i]));
-
-		} 
-		if(player->ammo[i].destroyed){
-			player->ammo[i].destroyed = 0;
-			//erase explosion
-			eraseRect(player->ammo[i].expX,player->ammo[i].expY,BULLET_EXP_W,BULLET_EXP_H);
-
-		}
-	}
-}
-
-//player collision with projectile
-uint8_t playerCD(double x, double y, uint8_t w, uint8_t h, Player *player){
-	//player 1 collision		
-	if (player == &p2 && x < p1.x + PLAYER_WIDTH &&
-		x + w > p1.x &&
-		y > p1.y - PLAYER_HEIGHT &&
-		y - h < p1.y) {
-			p1.alive = 0;
-			p2.kills += 1;
-			Sound_Explosion1();
-			return 1;
-		}
-	//player 2 collision		
-	if (player == &p1 && x < p2.x + PLAYER_WIDTH &&
-		x + w > p2.x &&
-		y > p2.y - PLAYER_HEIGHT &&
-		y - h < p2.y) {
-			p2.alive = 0;
-			p1.kills += 1;
-			Sound_Explosion2();
-			return 1;
-		}	
-	return 0;
-}
-
-//bullet collision with wall
-uint8_t wallBulletCD(int16_t x, int16_t y, uint8_t w, uint8_t h){
-	for(uint8_t i=0; i<WALLS_N; i++){
-		if(game.walls[i].destructible && !(game.walls[i].destroyed)){
-			//detect collision with new position on specific destructible wall
-			if (x <= game.walls[i].x + WALL_SIZE &&
-					x + w >= game.walls[i].x &&
-					y >= game.walls[i].y - WALL_SIZE &&
-					y - h < game.walls[i].y) {
-						game.walls[i].destroyed = 1;
-						return 1;
-			}
-		} else if(!game.walls[i].destructible){
-				//detect collision with new position on specific wall
-				if (x <= game.walls[i].x + WALL_SIZE &&
-						x + w >= game.walls[i].x &&
-						y >= game.walls[i].y - WALL_SIZE &&
-						y - h <= game.walls[i].y) {
-							return 1;
-				}
-		}
-	}
-	return 0;	//no collision detected with wall
-}
-
-//bullet collision with walls, boundary, and other player
-uint8_t bulletCD(Bullet *bullet, Player *player){
-	//wall collision
-	if(wallBulletCD(bullet->x,bullet->y,BULLET_WIDTH,BULLET_HEIGHT)){
-		bullet->expX = bullet->x - BULLET_EXP_W/2;
-		bullet->expY = bullet->y + BULLET_EXP_H/2;
-		drawBulletExplosion(bullet);
-		return 1;	//collision detected
-	}
-	
-	//bullet boundary collision
-	uint8_t right = (bullet->x+BULLET_WIDTH-1)>=WIDTH, //exceeds right of screen
-			left = bullet->x<0, 												//exceeds left of screen
-			top = (bullet->y-BULLET_HEIGHT+1)<0,				//exceeds top of screen
-			bottom = bullet->y>=HEIGHT;								//exceeds bottom of screen
-	
-	uint8_t sum = right+left+top+bottom;
-	
-	if(sum>0){	//bullet out of bounds
-		if(right){             		//exceeds right of screen
-			bullet->expX = WIDTH - BULLET_EXP_W/2;
-			bullet->expY = bullet->y + BULLET_EXP_H/2;
-			drawBulletExplosion(bullet);
-		}
-		else if(left){                 //exceeds left of screen
-			bullet->expX = 0 - BULLET_EXP_W/2;
-			bullet->expY = bullet->y + BULLET_EXP_H/2;
-			drawBulletExplosion(bullet);
-		}
-		else if(top){                  //exceeds top of screen
-			bullet->expX = bullet->x - BULLET_EXP_W/2;
-			bullet->expY = 0 + BULLET_EXP_H/2;
-			drawBulletExplosion(bullet);		
-		}
-		else if(bottom){               //exceeds bottom of screen
-			bullet->expX = bullet->x - BULLET_EXP_W/2;
-			bullet->expY = HEIGHT + BULLET_EXP_H/2;
-			drawBulletExplosion(bullet);			
-		}
-		return 1; //collision detected
-	}
-	
-	//player collision
-	if(playerCD(bullet->x,bullet->y,BULLET_WIDTH,BULLET_HEIGHT,player)){
-		bullet->expX = bullet->x - BULLET_EXP_W/2;
-		bullet->expY = bullet->y + BULLET_EXP_H/2;
-		drawBulletExplosion(bullet);
-		return 1;	//collision detected
-	}
-	
-	return 0;	//no collision detected
-	
-}
-
-void spawnPowerUps(void){
-	for(uint8_t i=0; i<POWERUPS_N; i++){
-		if(!game.powerUps[i].active){
-			if(game.powerUps[i].powerUpCooldown == 0){		//if powerUpCooldown == 0
-				game.powerUps[i].active = 1;
-			}  
-		}
-	}
-	drawPowerUps();
-}
-
-//powerUp collision with player
-uint8_t powerUpCD(Player *player){
-	for(uint8_t i=0;i<POWERUPS_N;i++){
-		if(game.powerUps[i].active && game.powerUps[i].displayed){
-			//collision with active and displayed powerup
-			if (game.powerUps[i].x < player->x + PLAYER_WIDTH &&
-				game.powerUps[i].x + POWERUP_WIDTH > player->x &&
-				game.powerUps[i].y > player->y - PLAYER_HEIGHT &&
-				game.powerUps[i].y - POWERUP_HEIGHT < player->y) {
-					if(game.powerUps[i].powerUp == Reverse){
-						game.clockwise ^= 1;
-					} else {
-						//set player powerup
-						player->powerUp = game.powerUps[i].powerUp;
-					}
-					//erase powerUp and deactivate
-					game.powerUps[i].active = 0;
-					game.powerUps[i].displayed = 0;
-					game.powerUps[i].powerUpCooldown = POWERUP_COOLDOWN;
-					eraseRect(game.powerUps[i].x,game.powerUps[i].y,POWERUP_WIDTH,POWERUP_HEIGHT);
-					return 1;
-			}
-		}
-	}
-	return 0;
-}
-
-//draw laser and collsion detection
-void shootLaser(Player *player){
-	player->powerUp = None;
-	double dx, dy, startX, startY, stopX, stopY;
-	double theta = PI8*player->dir;		//player angle
-	//calculate laser velocity
-	dx = cos(theta)*BULLET_SPEED;
-	dy = -sin(theta)*BULLET_SPEED;
-	//start laser at player's origin
-	startX = player->x + PLAYER_WIDTH/2;
-	startY = player->y - PLAYER_HEIGHT/2;
-	
-	//direction offset from player sprite
-	startX = startX + dx/4, 
-	startY = startY + dy/4;
-	while(startX <= player->x + PLAYER_WIDTH &&
-		startX + BULLET_WIDTH >= player->x &&
-		startY >= player->y - PLAYER_HEIGHT &&
-		startY - BULLET_HEIGHT <= player->y &&
-		startX < WIDTH && startX > 0 && startY > 0 && startY < HEIGHT){
-			startX += dx/4;
-			startY += dy/4;
-		}	
-	stopX = startX;
-	stopY = startY;
-	//while in bounds, increment endX and endY
-	do{
-		stopX += dx;
-		stopY += dy;
-	} while(stopX < WIDTH && stopX > 0 && stopY > 0 && stopY < HEIGHT);
-	stopX -= dx;
-	stopY -= dy;
-	double tempX,tempY;
-	//start at leftmost point
-	if(startX>stopX){
-		tempX = startX;
-		tempY = startY;
-		startX = stopX;
-		startY = stopY;
-		stopX = tempX;
-		stopY = tempY;
-	}
-	//calculate slope from left point, dx>=0
-	dx = stopX-startX;
-	dy = stopY-startY;
-	double m;
-	//calculate slope 
-	if(fabs(dx)>=0.1 && fabs(dy)>=0.1){		//if dy!=0 and dx!=0 within 0.1 error
-		m = dy/dx;
-		if(dy>0){
-			if(fabs(m)<1 && fabs(m-1)>=0.1){
-				dx = 1;		//Xn+1 = Xn + 1
-				dy = m;		//Yn+1 = Yn + m
-			}else if(fabs(m)>1 && fabs(m-1)>=0.1){	//m!=1 within 0.1 error
-				dx = 1/m;		//Xn+1 = Xn + 1/m
-				dy = 1;			//Yn+1 = Yn + 1
-			} else {		//m=1
-				dx = 1;		//Xn+1 = Xn + 1
-				dy = 1;		//Yn+1 = Yn + 1
-			}
-		} else {					//dy<0
-			if(fabs(m)<1 && fabs(m-1)>=0.1){	//m!=1 within 0.1 error
-				dx = 1;		//Xn+1 = Xn + 1
-				dy = m;		//Yn+1 = Yn + m
-			}else if(fabs(m)>1 && fabs(m-1)>=0.1){
-				dx = -1/m;		//Xn+1 = Xn + 1/m
-				dy = -1;			//Yn+1 = Yn - 1
-			} else {		//m=-1
-				dx = 1;		//Xn+1 = Xn + 1
-				dy = -1;		//Yn+1 = Yn - 1
-			}
-		}
-	} else if(fabs(dx)<=0.1){	//dx = 0
-		stopX = startX;
-		if(dy>0){
-			dx = 0;		//Xn+1 = Xn
-			dy = 1;		//Yn+1 = Yn + 1
-		} else{
-			dx = 0;		//Xn+1 = Xn
-			dy = -1;		//Yn+1 = Yn - 1
-		}
-	} else {	//dy = 0	
-		stopY = startY;				
-		dx = 1;		//Xn+1 = Xn + 1
-		dy = 0;		//Yn+1 = Yn
-	}	
-	laserBeam.startX = startX;
-	laserBeam.startY = startY;
-	laserBeam.stopX = stopX;
-	laserBeam.stopY = stopY;
-	laserBeam.dx = dx;
-	laserBeam.dy = dy;
-
-	//separate dx and dy because dx might be reached but not dy
-	while((fabs(startX-stopX)>1 || fabs(startY-stopY)>1) && (startX < WIDTH && startX > 0 && startY > 0 && startY < HEIGHT)){
-		drawLaser(startX,startY,LASER_WIDTH,LASER_HEIGHT);
-		laserCD(startX,startY,LASER_WIDTH,LASER_HEIGHT, player);
-		if(fabs(startX-stopX) > 1){	
-			startX += dx;
-		} 
-		if(fabs(startY-stopY) > 1) {
-			startY += dy;
-		}
-	}
-	laserBeam.displayed = 1;
-			
-}
-
-//laser collision with walls and other player
-void laserCD(double x, double y,uint8_t w, uint8_t h, Player *player){
-	//wall collision
-	for(uint8_t i=0; i<WALLS_N; i++){
-		if(game.walls[i].destructible && !(game.walls[i].destroyed)){
-			//detect collision with new position on specific destructible wall
-			if (x <= game.walls[i].x + WALL_SIZE &&
-				x + w >= game.walls[i].x &&
-				y >= game.walls[i].y - WALL_SIZE &&
-				y - h < game.walls[i].y) {
-					game.walls[i].destroyed = 1;
-			}	
-		}
-	}
-	playerCD(x,y,w,h,player);
-}
-
-//generate particles
-#define PARTICLES_G_N	15
-void particleGenerate(double x, double y){
-	uint8_t j =0;
-	for(uint8_t i=0;i<PARTICLES_G_N;i++){
-		while(j<PARTICLES_N && particles[j].active == 1){
-			j++;
-		}
-		particles[j].active = 1;
-		particles[j].x = x;
-		particles[j].y = y;
-		particles[j].angle = randomGenerate(0,359)*PI/180;			//convert to theta please
-		particles[j].time = randomGenerate(20,60);
-		uint8_t speed = randomGenerate(1,4);
-		particles[j].dx = cos(particles[j].angle)*speed;
-		particles[j].dy = -sin(particles[j].angle)*speed;
-	}
-}
-
-//move active particles
-void moveParticles(void){
-	for(uint8_t i=0;i<PARTICLES_N;i++){
-		if(particles[i].active){
-			//erase previous particle
-			eraseParticle(particles[i].x,particles[i].y);
-			if(particles[i].time == 0){
-				particles[i].active = 0;
-			} else {
-				//move particle
-				particles[i].x += particles[i].dx;
-				particles[i].y += particles[i].dy;
-				if(particles[i].x < WIDTH && particles[i].x > 0 && particles[i].y > 0 && particles[i].y < HEIGHT){
-					//draw particle if in bounds
-					drawParticle(particles[i].x,particles[i].y);
-				} else {
-					particles[i].active = 0;
-				}
-			}
-			
-		}
-	}
-}
+// File: GamePhysics.c
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: This software is the physics engine and contains the game actions
+// Usage: Update and move game objects; collision detection
+
+#include "GamePhysics.h"
+#include "AstroParty.h"
+#include "LCDBuffer.h"
+#include "Sound.h"
+#include "ST7735.h"
+#include "RandomGenerate.h"
+
+#define HEIGHT 160
+#define WIDTH 128
+#define ACCEL 2.2
+#define MAX_SPEED 2.5
+#define ANG_VEL 12
+#define BULLET_SPEED 5
+#define DT 0.033333 //delta time at 30Hz
+#define ACCEL_STEP FIX(DT*ACCEL)	//change of dx or dy in a frame
+#define SHOT_COOLDOWN 10
+#define POWERUP_COOLDOWN 300
+#define BLADE_TIME 150
+#define NO_CONTACT (FIX_ONE+1)	//a sweep time after the end of the frame
+#define HIT_NONE 0							//what a bullet ran into
+#define HIT_WALL 1
+#define HIT_EDGE_X 2
+#define HIT_EDGE_Y 3
+#define HIT_SHIP 4
+#define AXIS_INSIDE 1						//how a point meets an open interval
+#define AXIS_ENTERS 2
+#define NORMAL_X 1							//sides of a box a point comes in through
+#define NORMAL_Y 2
+#define LASER_REACH 64					//a beam is cast this many bullet moves out, further than across the screen
+#define LASER_HALF FIX(LASER_WIDTH/2.0)	//center of a laser stamp to its sides
+
+
+
+BladesPU blades = {0,0,BLADE_TIME};
+
+//velocity of each direction, the speed a ship accelerates to and the speed of its bullets and laser
+//the thrust step ACCEL_STEP is the same on both axes in every direction, so it needs no table
+const fixed ShipVelocity[16][2] = FIX_DIRECTIONS(MAX_SPEED);
+const fixed BulletVelocity[16][2] = FIX_DIRECTIONS(BULLET_SPEED);
+
+void rotatePlayer(Player *player){
+	if(game.clockwise){
+		if(player->angle == 0) {
+			player->angle = 360 - ANG_VEL;		//0 wraps around to 360 - ANG_VEL
+		} else{
+			player->angle = (player->angle-ANG_VEL)%360;	
+		}
+	} else {
+		player->angle = (player->angle+ANG_VEL)%360;
+	}
+	player->dir = (player->angle*2)/45;		//angle/22.5
+}
+
+void acceleratePlayer(Player *player){
+	fixed dx = ShipVelocity[player->dir][0];		//desired dx
+	fixed dy = ShipVelocity[player->dir][1];		//desired dy
+	
+	//accelerate player until desired dx is reached
+	if(FIX_ABS(player->dx - dx) < ACCEL_STEP){
+		player->dx = dx;
+	}	else if(player->dx < dx){
+		player->dx += ACCEL_STEP;
+	} else if(player->dx > dx){
+		player->dx -= ACCEL_STEP;
+	}
+	
+	//accelerate player until desired dy is reached	
+	if(FIX_ABS(player->dy - dy) < ACCEL_STEP){
+		player->dy = dy;
+	}	else if(player->dy < dy){
+		player->dy += ACCEL_STEP;
+	} else if(player->dy > dy){
+		player->dy -= ACCEL_STEP;
+	}	
+}
+
+//standing walls sorted into 16x16 pixel cells, a query only tests the walls of the cells it overlaps
+//cell c lists its walls in cellWalls from cellFirst[c], cellN[c] of them, cells numbered row by row from y = 0
+#define CELL_SHIFT 4
+#define CELL_COLS (WIDTH>>CELL_SHIFT)
+#define CELL_ROWS (HEIGHT>>CELL_SHIFT)
+#define CELLS_N (CELL_COLS*CELL_ROWS)
+#define CELL_WALLS_N (WALLS_N*4)		//a wall smaller than a cell is in at most 2x2 of them
+uint16_t cellFirst[CELLS_N];
+uint8_t cellN[CELLS_N];
+uint8_t cellWalls[CELL_WALLS_N];
+
+//cells a rectangle covers, x0<=x1 and y0<=y1 are pixels, parts off the screen go to the edge cells
+void cellRange(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t *c0, uint8_t *r0, uint8_t *c1, uint8_t *r1){
+	*c0 = x0<0 ? 0 : x0>=WIDTH ? CELL_COLS-1 : x0>>CELL_SHIFT;
+	*c1 = x1<0 ? 0 : x1>=WIDTH ? CELL_COLS-1 : x1>>CELL_SHIFT;
+	*r0 = y0<0 ? 0 : y0>=HEIGHT ? CELL_ROWS-1 : y0>>CELL_SHIFT;
+	*r1 = y1<0 ? 0 : y1>=HEIGHT ? CELL_ROWS-1 : y1>>CELL_SHIFT;
+}
+
+//cells of a wall, (x,y) is its bottom left corner like everywhere else
+void wallCells(uint8_t i, uint8_t *c0, uint8_t *r0, uint8_t *c1, uint8_t *r1){
+	cellRange(game.walls[i].x, game.walls[i].y-WALL_SIZE+1, game.walls[i].x+WALL_SIZE-1, game.walls[i].y, c0, r0, c1, r1);
+}
+
+//one bit for every pixel of a standing wall, 2560 bytes, next to the 8bpp screenBuffer they fit because stageBuffer is 1KB
+//pixel (x,y) is bit y*WIDTH+x, through the bit-band alias of SRAM each bit is a word of its own,
+//so setting or clearing one is a single store, tests read the plain words
+//the grid is the owner map, the wall of a set bit is one of the few walls of its cell
+uint32_t wallBits[WIDTH*HEIGHT/32];
+#ifdef __CC_ARM
+#define WALL_BAND ((volatile uint32_t *)(0x22000000+(((uint32_t)wallBits-0x20000000)<<5)))
+#define WALL_SET(n) (WALL_BAND[n] = 1)
+#define WALL_CLEAR(n) (WALL_BAND[n] = 0)
+#else		//built for a PC, which has no bit-band
+#define WALL_SET(n) (wallBits[(n)>>5] |= 1u<<((n)&31))
+#define WALL_CLEAR(n) (wallBits[(n)>>5] &= ~(1u<<((n)&31)))
+#endif
+
+//set or clear the bits of a wall's pixels
+void stampWall(uint8_t i, uint8_t solid){
+	int16_t x0 = game.walls[i].x, y0 = game.walls[i].y-WALL_SIZE+1, x1 = x0+WALL_SIZE-1, y1 = game.walls[i].y;
+	int16_t x, y;
+	if(x0<0) x0 = 0;
+	if(x1>WIDTH-1) x1 = WIDTH-1;
+	if(y0<0) y0 = 0;
+	if(y1>HEIGHT-1) y1 = HEIGHT-1;
+	for(y=y0; y<=y1; y++){
+		for(x=x0; x<=x1; x++){
+			if(solid){
+				WALL_SET(y*WIDTH+x);
+			} else {
+				WALL_CLEAR(y*WIDTH+x);
+			}
+		}
+	}
+}
+
+//returns 1 if any pixel of a rectangle belongs to a standing wall, x0<=x1 and y0<=y1
+//reads whole words of wallBits, a row of the rectangle is one word or two under a sweep's width
+uint8_t wallBitsAny(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	uint32_t first, last, mask;
+	const uint32_t *row;
+	int16_t y;
+	uint8_t k;
+	if(x0<0) x0 = 0;
+	if(x1>WIDTH-1) x1 = WIDTH-1;
+	if(y0<0) y0 = 0;
+	if(y1>HEIGHT-1) y1 = HEIGHT-1;
+	if(x0>x1) return 0;						//totally off the screen
+	first = 0xFFFFFFFFu<<(x0&31);				//columns x0 and up of the first word
+	last = 0xFFFFFFFFu>>(31-(x1&31));		//columns up to x1 of the last word
+	for(y=y0; y<=y1; y++){
+		row = &wallBits[y*(WIDTH/32)];
+		mask = first;
+		for(k=x0>>5; k<=x1>>5; k++){
+			if(k == x1>>5) mask &= last;
+			if(row[k] & mask) return 1;
+			mask = 0xFFFFFFFFu;
+		}
+	}
+	return 0;
+}
+
+//sort the standing walls of game.walls into their cells, the map inits call this once the walls are loaded
+//counts the walls of each cell first, so every cell's list follows the one before it
+void buildWallGrid(void){
+	uint8_t c0, r0, c1, r1, c, r, i;
+	uint16_t first = 0, k;
+	for(k=0; k<WIDTH*HEIGHT/32; k++){
+		wallBits[k] = 0;
+	}
+	for(c=0; c<CELLS_N; c++){
+		cellN[c] = 0;
+	}
+	for(i=0; i<WALLS_N; i++){
+		if(game.walls[i].active && !game.walls[i].destroyed){
+			wallCells(i, &c0, &r0, &c1, &r1);
+			for(r=r0; r<=r1; r++){
+				for(c=c0; c<=c1; c++){
+					cellN[r*CELL_COLS+c]++;
+				}
+			}
+			stampWall(i, 1);
+		}
+	}
+	for(c=0; c<CELLS_N; c++){
+		cellFirst[c] = first;
+		first += cellN[c];
+		cellN[c] = 0;
+	}
+	for(i=0; i<WALLS_N; i++){
+		if(game.walls[i].active && !game.walls[i].destroyed){
+			wallCells(i, &c0, &r0, &c1, &r1);
+			for(r=r0; r<=r1; r++){
+				for(c=c0; c<=c1; c++){
+					cellWalls[cellFirst[r*CELL_COLS+c]+cellN[r*CELL_COLS+c]++] = i;
+				}
+			}
+		}
+	}
+}
+
+//standing walls in the cells of a rectangle, each once, returns how many were put in walls
+//a wall in several of the cells is only taken from the first one it shares with the rectangle
+uint8_t wallsNear(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t *walls){
+	uint8_t c0, r0, c1, r1, wc0, wr0, wc1, wr1, c, r, k, i, n = 0;
+	cellRange(x0, y0, x1, y1, &c0, &r0, &c1, &r1);
+	for(r=r0; r<=r1; r++){
+		for(c=c0; c<=c1; c++){
+			uint8_t cell = r*CELL_COLS+c;
+			for(k=0; k<cellN[cell]; k++){
+				i = cellWalls[cellFirst[cell]+k];
+				wallCells(i, &wc0, &wr0, &wc1, &wr1);
+				if(c == (wc0>c0 ? wc0 : c0) && r == (wr0>r0 ? wr0 : r0)){
+					walls[n++] = i;
+				}
+			}
+		}
+	}
+	return n;
+}
+
+//mark a wall destroyed, take it out of its cells and its bits and queue it for drawWalls(), which erases it
+void destroyWall(uint8_t i){
+	uint8_t c0, r0, c1, r1, c, r, k;
+	game.walls[i].destroyed = 1;
+	stampWall(i, 0);
+	wallCells(i, &c0, &r0, &c1, &r1);
+	for(r=r0; r<=r1; r++){
+		for(c=c0; c<=c1; c++){
+			uint8_t cell = r*CELL_COLS+c;
+			uint8_t *list = &cellWalls[cellFirst[cell]];
+			for(k=0; k<cellN[cell]; k++){
+				if(list[k] == i){
+					list[k] = list[--cellN[cell]];		//order in a cell does not matter
+					break;
+				}
+			}
+			for(k=0; k<cellN[cell]; k++){		//walls overlapping this one get back the bits they share
+				stampWall(list[k], 1);
+			}
+		}
+	}
+	queueWall(i);
+}
+
+void movePlayer(Player *player){
+	//erase previous player image
+	eraseRect(FIX_INT(player->x),FIX_INT(player->y),PLAYER_WIDTH,PLAYER_HEIGHT);
+	//update player x and y position w/ dx and dy
+	fixed newX = player->x + player->dx;
+	fixed newY = player->y + player->dy;
+	uint8_t near[WALLS_N], nearN, i;
+	
+	//player may destroy destructible walls on contact, objectsCD() has the other player
+	if(player->powerUp == Blades && blades.displayed==1){
+		nearN = wallsNear(FIX_INT(newX), FIX_INT(newY)-PLAYER_HEIGHT, FIX_INT(newX)+PLAYER_WIDTH, FIX_INT(newY)+1, near);
+		for(uint8_t k=0; k<nearN; k++){
+				i = near[k];
+				//detect collision with destructible wall
+				if(game.walls[i].destructible){
+					if (newX < FIX_I(game.walls[i].x + WALL_SIZE) &&
+						newX + FIX_I(PLAYER_WIDTH) > FIX_I(game.walls[i].x) &&
+						newY > FIX_I(game.walls[i].y - WALL_SIZE) &&
+						newY - FIX_I(PLAYER_HEIGHT) < FIX_I(game.walls[i].y)){
+							destroyWall(i);
+						}
+				}
+		}
+	}
+	
+	//player collision with walls and boundary
+	//the ship is swept along its move to the first side it comes up against, stops there on that axis
+	//and slides along it for the rest of the frame, the edges of the screen are boxes past them
+	fixed x = player->x, y = player->y, dx = player->dx, dy = player->dy, t, tHit, hx0, hy0, hx1, hy1, stopX = 0, stopY = 0;
+	uint8_t normal, hitNormal;
+	nearN = wallsNear(FIX_INT(dx<0 ? newX : x), FIX_INT(dy<0 ? newY : y)-PLAYER_HEIGHT,
+		FIX_INT(dx<0 ? x : newX)+PLAYER_WIDTH, FIX_INT(dy<0 ? y : newY)+1, near);
+	for(uint8_t pass=0; pass<2 && (dx || dy); pass++){
+		tHit = NO_CONTACT;
+		hitNormal = 0;
+		for(uint8_t k=0; k<nearN+4; k++){
+			if(k < nearN){
+				//walls grown by the ship, the ship's bottom left corner may not get inside
+				i = near[k];
+				hx0 = FIX_I(game.walls[i].x - PLAYER_WIDTH);
+				hx1 = FIX_I(game.walls[i].x + WALL_SIZE);
+				hy0 = FIX_I(game.walls[i].y - WALL_SIZE);
+				hy1 = FIX_I(game.walls[i].y + PLAYER_HEIGHT);
+			} else {
+				//right, left, top and bottom of the screen, the ship stays a pixel in from each edge
+				hx0 = k==nearN ? FIX_I(WIDTH-1-PLAYER_WIDTH) : -FIX_I(WIDTH);
+				hx1 = k==nearN+1 ? FIX_I(1) : FIX_I(2*WIDTH);
+				hy0 = k==nearN+3 ? FIX_I(HEIGHT-2) : -FIX_I(HEIGHT);
+				hy1 = k==nearN+2 ? FIX_I(PLAYER_HEIGHT) : FIX_I(2*HEIGHT);
+			}
+			t = enterBox(x, y, dx, dy, hx0, hy0, hx1, hy1, &normal);
+			if(t == NO_CONTACT || t > tHit) continue;
+			if(t < tHit){
+				tHit = t;
+				hitNormal = 0;
+			}
+			hitNormal |= normal;		//two sides at once, as at a corner, stop on both
+			//the line to stop at, the same for every box met at the same time on the same axis
+			if(normal & NORMAL_X){
+				stopX = dx>0 ? hx0 : hx1;
+			}
+			if(normal & NORMAL_Y){
+				stopY = dy>0 ? hy0 : hy1;
+			}
+		}
+		if(tHit == NO_CONTACT){
+			x += dx;
+			y += dy;
+			break;
+		}
+		//move up to the contact, then the rest of the move on the axis it did not hit
+		if(hitNormal & NORMAL_X){
+			x = stopX;
+			dx = 0;
+			player->dx = 0;
+		} else {
+			x += FIX_MUL(dx, tHit);
+			dx -= FIX_MUL(dx, tHit);
+		}
+		if(hitNormal & NORMAL_Y){
+			y = stopY;
+			dy = 0;
+			player->dy = 0;
+		} else {
+			y += FIX_MUL(dy, tHit);
+			dy -= FIX_MUL(dy, tHit);
+		}
+	}
+	player->x = x;
+	player->y = y;
+
+	//draw new player position
+	drawPlayer(player);
+	
+}
+
+void shootBullet(Player *player){
+	//detect if player has powerUp
+	switch (player->powerUp){
+		case Reverse : {
+			break;
+		}
+		case Laser : {
+			shootLaser(player);
+			break;
+		}
+		case Blades : {
+			blades.player = player;
+			blades.displayed = 1;
+			blades.bladeTime = BLADE_TIME;
+		}
+		case None : {
+			//shoot bullet if there exists an inactive bullet and shotCooldown == 0
+			if(player->shotCooldown != 0) {
+				return;
+			}
+			
+			for(uint8_t i=0; i<PLAYER_AMMO+1; i++){
+				if(i==PLAYER_AMMO){
+					//no inactive bullets
+					Sound_NoShoot();
+				}
+				else if(!player->ammo[i].active){
+					Sound_Shoot();
+					player->ammo[i].active = 1;				//activate bullet
+					player->ammo[i].target = 0;				//objectsCD() has not seen it yet
+					
+					//start bullet at player's origin
+					player->ammo[i].x = player->x + FIX_I(PLAYER_WIDTH/2);
+					player->ammo[i].y = player->y - FIX_I(PLAYER_HEIGHT/2);
+					
+					//calculate bullet velocity
+					fixed dx = BulletVelocity[player->dir][0],
+								dy = BulletVelocity[player->dir][1];
+					player->ammo[i].dx = dx;			
+					player->ammo[i].dy = dy;	
+					
+					//direction offset from player sprite
+					fixed newX = player->ammo[i].x + dx/4, 
+								newY = player->ammo[i].y + dy/4;
+					while(newX <= player->x + FIX_I(PLAYER_WIDTH) &&
+						newX + FIX_I(BULLET_WIDTH) >= player->x &&
+						newY >= player->y - FIX_I(PLAYER_HEIGHT) &&
+						newY - FIX_I(BULLET_HEIGHT) <= player->y &&
+						newX < FIX_I(WIDTH) && newX > 0 && newY > 0 && newY < FIX_I(HEIGHT)){
+							newX += dx/4;
+							newY += dy/4;
+						}	
+					player->ammo[i].x = newX;
+					player->ammo[i].y = newY;
+					if(newX < FIX_I(WIDTH-1) && newX > FIX_I(1) && newY > FIX_I(1) && newY < FIX_I(HEIGHT-1)){
+						//a gun against the other ship fires into it, objectsCD() only sees the bullet from the next move on
+						Player *other = player == &p1 ? &p2 : &p1;
+						if(other->alive && bulletShipTime(&(player->ammo[i]), other, 0, 0) != NO_CONTACT){
+							player->ammo[i].target = other;
+							player->ammo[i].targetTime = 0;
+						}
+						if(!sweepBullet(&(player->ammo[i]),player,0,0)){
+							drawBullet(&(player->ammo[i]));
+						}
+					} else {
+						return;
+					}
+					break;		//one bullet a shot
+				}
+			}
+		}
+	}
+	player->shotCooldown = SHOT_COOLDOWN;		//reset shotCooldown
+
+}
+
+//a point moving from p by d in one frame, narrow [*tIn,*tOut] to the part of the frame it is in [lo,hi], in FIX_ONE parts
+//returns 0 if it never is, the divides only happen for a side the point crosses, so they stay within FIX_ONE
+uint8_t sweepAxis(fixed p, fixed d, fixed lo, fixed hi, fixed *tIn, fixed *tOut){
+	fixed t0 = 0, t1 = FIX_ONE;
+	if(d >= 0){
+		if(p > hi || p+d < lo) return 0;
+		if(p < lo) t0 = FIX_DIV(lo-p, d);
+		if(p+d > hi) t1 = FIX_DIV(hi-p, d);
+	} else {
+		if(p < lo || p+d > hi) return 0;
+		if(p > hi) t0 = FIX_DIV(p-hi, -d);
+		if(p+d < lo) t1 = FIX_DIV(p-lo, -d);
+	}
+	if(t0 > *tIn) *tIn = t0;
+	if(t1 < *tOut) *tOut = t1;
+	return *tIn <= *tOut;
+}
+
+//first part of a frame a point moving from (x,y) by (dx,dy) is in the box [x0,x1] by [y0,y1], NO_CONTACT if it is not this frame
+//a moving rectangle against a still one is its corner against the still one grown by the moving one's size
+fixed sweepBox(fixed x, fixed y, fixed dx, fixed dy, fixed x0, fixed y0, fixed x1, fixed y1){
+	fixed tIn = 0, tOut = FIX_ONE;
+	if(sweepAxis(x, dx, x0, x1, &tIn, &tOut) && sweepAxis(y, dy, y0, y1, &tIn, &tOut)){
+		return tIn;
+	}
+	return NO_CONTACT;
+}
+
+//part of a frame a point moving from p by d stays in [lo,hi] on one axis, 0 if it starts outside, NO_CONTACT if it stays
+fixed leaveAxis(fixed p, fixed d, fixed lo, fixed hi){
+	if(p < lo || p > hi) return 0;
+	if(p+d > hi) return FIX_DIV(hi-p, d);
+	if(p+d < lo) return FIX_DIV(p-lo, -d);
+	return NO_CONTACT;
+}
+
+//a point moving from p by d in one frame, the part of the frame it is strictly inside (lo,hi) goes in [*t0,*t1]
+//returns 0 if it never is, AXIS_INSIDE if it starts inside and AXIS_ENTERS if it comes in from lo or hi,
+//starting on lo or hi and moving away or along them is not inside, so a ship touching a wall can leave it
+uint8_t enterAxis(fixed p, fixed d, fixed lo, fixed hi, fixed *t0, fixed *t1){
+	*t0 = 0;
+	*t1 = FIX_ONE;
+	if(d > 0){
+		if(p >= hi || p+d <= lo) return 0;
+		if(p+d > hi) *t1 = FIX_DIV(hi-p, d);
+		if(p <= lo){
+			*t0 = FIX_DIV(lo-p, d);
+			return AXIS_ENTERS;
+		}
+	} else if(d < 0){
+		if(p <= lo || p+d >= hi) return 0;
+		if(p+d < lo) *t1 = FIX_DIV(p-lo, -d);
+		if(p >= hi){
+			*t0 = FIX_DIV(p-hi, -d);
+			return AXIS_ENTERS;
+		}
+	} else if(p <= lo || p >= hi){
+		return 0;
+	}
+	return AXIS_INSIDE;
+}
+
+//first part of a frame a point moving from (x,y) by (dx,dy) comes into the open box (x0,x1) by (y0,y1), NO_CONTACT if it does not,
+//*normal gets NORMAL_X and/or NORMAL_Y for the sides it comes in through, both at a corner
+//a point already inside is left to get out, the boxes are solid only from outside
+fixed enterBox(fixed x, fixed y, fixed dx, fixed dy, fixed x0, fixed y0, fixed x1, fixed y1, uint8_t *normal){
+	fixed t0x, t1x, t0y, t1y, tIn, tOut;
+	uint8_t ex = enterAxis(x, dx, x0, x1, &t0x, &t1x);
+	uint8_t ey = enterAxis(y, dy, y0, y1, &t0y, &t1y);
+	if(!ex || !ey) return NO_CONTACT;
+	tIn = t0x > t0y ? t0x : t0y;
+	tOut = t1x < t1y ? t1x : t1y;
+	if(tIn >= tOut) return NO_CONTACT;
+	*normal = (ex == AXIS_ENTERS && t0x == tIn ? NORMAL_X : 0) | (ey == AXIS_ENTERS && t0y == tIn ? NORMAL_Y : 0);
+	if(!*normal) return NO_CONTACT;
+	return tIn;
+}
+
+//move a bullet by (dx,dy) and stop it at the first wall, edge or ship it reaches on the way, (0,0) tests where it is
+//walls count when a bullet pixel is next to a wall pixel, the ship when they overlap, and the screen when a pixel leaves it
+//ties go to the wall, then the edge, like the tests they replace
+//returns 1 if the bullet hit something, its explosion is drawn where it was at that moment
+uint8_t sweepBullet(Bullet *bullet, Player *player, fixed dx, fixed dy){
+	fixed x = bullet->x, y = bullet->y, t, tHit = NO_CONTACT;
+	fixed xMax = FIX_I(WIDTH - BULLET_WIDTH + 1) - 1, yMin = FIX_I(BULLET_HEIGHT - 1), yMax = FIX_I(HEIGHT) - 1;
+	uint8_t near[WALLS_N], nearN, i, hit = HIT_NONE, wall = WALLS_N;
+	//pixels the bullet covers on the way, one more on each side for the walls next to them
+	int16_t x0 = FIX_INT(dx<0 ? x+dx : x) - 1, x1 = FIX_INT(dx<0 ? x : x+dx) + BULLET_WIDTH,
+					y0 = FIX_INT(dy<0 ? y+dy : y) - BULLET_HEIGHT, y1 = FIX_INT(dy<0 ? y : y+dy) + 1;
+
+	//wall collision
+	if(wallBitsAny(x0, y0, x1, y1)){		//no wall pixel there is the usual answer
+		nearN = wallsNear(x0, y0, x1, y1, near);
+		for(uint8_t k=0; k<nearN; k++){
+			i = near[k];
+			t = sweepBox(x, y, dx, dy,
+				FIX_I(game.walls[i].x - BULLET_WIDTH), FIX_I(game.walls[i].y - WALL_SIZE),
+				FIX_I(game.walls[i].x + WALL_SIZE + 1) - 1, FIX_I(game.walls[i].y + BULLET_HEIGHT + 1) - 1);
+			if(t < tHit){
+				tHit = t;
+				hit = HIT_WALL;
+				wall = i;
+			}
+		}
+	}
+
+	//boundary collision
+	t = leaveAxis(x, dx, 0, xMax);
+	if(t < tHit){
+		tHit = t;
+		hit = HIT_EDGE_X;
+	}
+	t = leaveAxis(y, dy, yMin, yMax);
+	if(t < tHit){
+		tHit = t;
+		hit = HIT_EDGE_Y;
+	}
+
+	//player collision, the ship objectsCD() found on this move
+	if(bullet->target && bullet->targetTime < tHit){
+		tHit = bullet->targetTime;
+		hit = HIT_SHIP;
+	}
+
+	if(hit == HIT_NONE){
+		bullet->x = x + dx;
+		bullet->y = y + dy;
+		return 0;
+	}
+
+	//explode at the point of contact
+	bullet->x = x + FIX_MUL(dx, tHit);
+	bullet->y = y + FIX_MUL(dy, tHit);
+	bullet->expX = FIX_INT(bullet->x) - BULLET_EXP_W/2;
+	bullet->expY = FIX_INT(bullet->y) + BULLET_EXP_H/2;
+	if(hit == HIT_WALL){
+		if(game.walls[wall].destructible){
+			destroyWall(wall);
+		}
+	} else if(hit == HIT_EDGE_X){
+		//exceeds right or left of screen
+		bullet->expX = (x > xMax || x+dx > xMax ? WIDTH : 0) - BULLET_EXP_W/2;
+	} else if(hit == HIT_EDGE_Y){
+		//exceeds bottom or top of screen
+		bullet->expY = (y > yMax || y+dy > yMax ? HEIGHT : 0) + BULLET_EXP_H/2;
+	} else {
+		shipHit(player, bullet->target);
+	}
+	drawBulletExplosion(bullet);
+	return 1;	//collision detected
+}
+
+//move bullets with dx and dy
+//every active bullet is swept along its whole move, so it stops at the first thing on its path however fast it goes
+void moveBullets(Player *player){
+	//erase last frame's explosions before anything is drawn over them
+	for(uint8_t i=0; i<PLAYER_AMMO; i++){
+		if(player->ammo[i].destroyed){
+			player->ammo[i].destroyed = 0;
+			eraseRect(player->ammo[i].expX,player->ammo[i].expY,BULLET_EXP_W,BULLET_EXP_H);
+		}
+	}
+	//update bullet x and y position w/ dx and dy
+	for(uint8_t i=0; i<PLAYER_AMMO; i++){
+		if(player->ammo[i].active){
+			//erase previous active bullets
+			eraseRect(FIX_INT(player->ammo[i].x),FIX_INT(player->ammo[i].y),BULLET_WIDTH,BULLET_HEIGHT);
+			if(!sweepBullet(&(player->ammo[i]),player,player->ammo[i].dx,player->ammo[i].dy)){
+				drawBullet(&(player->ammo[i]));
+			}
+		}
+	}
+}
+
+//ship's player is hit by shooter, a ship already hit this frame is not counted twice
+void shipHit(Player *shooter, Player *ship){
+	if(!ship->alive) return;
+	ship->alive = 0;
+	shooter->kills += 1;
+	if(ship == &p1){
+		Sound_Explosion1();
+	} else {
+		Sound_Explosion2();
+	}
+}
+
+//everything objectsCD() tests besides walls, a body is what one object may touch this frame
+//a new kind of object is a new type, a slot for each and a case in bodiesCD()
+enum BodyEnum {
+	BodyShip,							//ship over its move
+	BodyBlades,						//Blades ring where its ship is moving to
+	BodyBullet,						//bullet over its move
+	BodyPowerUp,					//powerup where it is
+	BodyNone							//empty slot, sorted past all the others
+};
+#define BODIES_N (2*(1+1+PLAYER_AMMO)+POWERUPS_N)
+
+typedef struct Body {
+	int16_t x0, y0, x1, y1;		//pixels it may touch, x0 is INT16_MAX for an empty slot
+	uint8_t type;
+	uint8_t index;						//bullet in player's ammo or powerup in game.powerUps
+	Player *player;						//owner of a ship, ring or bullet
+} Body;
+
+//one slot for every object, bodyOrder has the slots by x0 and stays mostly sorted from one frame to the next,
+//so the insertion sort only moves the bodies that passed one another
+Body bodies[BODIES_N];
+uint8_t bodyOrder[BODIES_N];
+uint8_t bodyOrderSet = 0;
+
+//fill in a body over the move of a w by h rectangle from (x,y) by (dx,dy), rounded out to whole pixels
+void setBody(Body *body, uint8_t type, Player *player, uint8_t index, fixed x, fixed y, fixed dx, fixed dy, uint8_t w, uint8_t h){
+	body->type = type;
+	body->player = player;
+	body->index = index;
+	body->x0 = FIX_INT(dx<0 ? x+dx : x);
+	body->x1 = FIX_INT(dx<0 ? x : x+dx) + w;
+	body->y0 = FIX_INT(dy<0 ? y+dy : y) - h;
+	body->y1 = FIX_INT(dy<0 ? y : y+dy) + 1;
+}
+
+void emptyBody(Body *body){
+	body->type = BodyNone;
+	body->x0 = INT16_MAX;
+}
+
+//collision detection between ships, Blades rings, bullets and powerups, before anything moves this frame
+//sort and sweep: the bodies in order of x0, each against the ones after it that start before it ends,
+//the pairs that also overlap in y go to bodiesCD()
+void objectsCD(void){
+	Player *players[2] = {&p1, &p2}, *player;
+	Body *a, *b;
+	uint8_t s = 0, i, j, k;
+	
+	if(!bodyOrderSet){
+		for(i=0; i<BODIES_N; i++){
+			bodyOrder[i] = i;
+		}
+		bodyOrderSet = 1;
+	}
+	for(k=0; k<2; k++){
+		player = players[k];
+		if(player->alive){
+			setBody(&bodies[s], BodyShip, player, 0, player->x, player->y, player->dx, player->dy, PLAYER_WIDTH, PLAYER_HEIGHT);
+		} else {
+			emptyBody(&bodies[s]);
+		}
+		s++;
+		if(player->alive && player->powerUp == Blades && blades.displayed==1){
+			setBody(&bodies[s], BodyBlades, player, 0, player->x+player->dx, player->y+player->dy, 0, 0, PLAYER_WIDTH, PLAYER_HEIGHT);
+		} else {
+			emptyBody(&bodies[s]);
+		}
+		s++;
+		for(i=0; i<PLAYER_AMMO; i++){
+			player->ammo[i].target = 0;
+			if(player->ammo[i].active){
+				setBody(&bodies[s], BodyBullet, player, i, player->ammo[i].x, player->ammo[i].y, player->ammo[i].dx, player->ammo[i].dy, BULLET_WIDTH, BULLET_HEIGHT);
+			} else {
+				emptyBody(&bodies[s]);
+			}
+			s++;
+		}
+	}
+	for(i=0; i<POWERUPS_N; i++){
+		if(game.powerUps[i].active && game.powerUps[i].displayed){
+			setBody(&bodies[s], BodyPowerUp, 0, i, game.powerUps[i].x, game.powerUps[i].y, 0, 0, POWERUP_WIDTH, POWERUP_HEIGHT);
+		} else {
+			emptyBody(&bodies[s]);
+		}
+		s++;
+	}
+	
+	//insertion sort on x0
+	for(i=1; i<BODIES_N; i++){
+		k = bodyOrder[i];
+		for(j=i; j>0 && bodies[bodyOrder[j-1]].x0 > bodies[k].x0; j--){
+			bodyOrder[j] = bodyOrder[j-1];
+		}
+		bodyOrder[j] = k;
+	}
+	
+	//sweep, the empty slots are at the end and start after every body ends
+	for(i=0; i<BODIES_N && bodies[bodyOrder[i]].type != BodyNone; i++){
+		a = &bodies[bodyOrder[i]];
+		for(j=i+1; j<BODIES_N && bodies[bodyOrder[j]].x0 <= a->x1; j++){
+			b = &bodies[bodyOrder[j]];
+			if(b->y0 <= a->y1 && a->y0 <= b->y1){
+				bodiesCD(a, b);
+			}
+		}
+	}
+}
+
+//narrow phase of two bodies whose rectangles overlap, by their types
+//every pair that does something has a ship in it, and nothing hits its own ship
+void bodiesCD(Body *a, Body *b){
+	Body *t;
+	if(a->type > b->type){		//ship first
+		t = a;
+		a = b;
+		b = t;
+	}
+	if(a->type != BodyShip || b->player == a->player) return;
+	switch(b->type){
+		case BodyBlades :
+			bladesShipCD(b->player, a->player);
+			break;
+		case BodyBullet :
+			bulletShipCD(&(b->player->ammo[b->index]), a->player);
+			break;
+		case BodyPowerUp :
+			powerUpShipCD(&game.powerUps[b->index], a->player);
+			break;
+		default :
+			break;
+	}
+}
+
+//Blades ring of player against the other ship, the ring destroys it on contact
+//runs in objectsCD() before the bullets move, the ring where it is going against the other ship where it starts the frame,
+//so a ring kill ends the round in the same frame, and a bullet that reaches the ring's ship in that frame kills it too
+void bladesShipCD(Player *player, Player *ship){
+	fixed newX = player->x + player->dx;
+	fixed newY = player->y + player->dy;
+	if (newX < ship->x + FIX_I(PLAYER_WIDTH) &&
+		newX + FIX_I(PLAYER_WIDTH) > ship->x &&
+		newY > ship->y - FIX_I(PLAYER_HEIGHT) &&
+		newY - FIX_I(PLAYER_HEIGHT) < ship->y) {
+			shipHit(player, ship);
+		}
+}
+
+//bullet's move against a ship, the ship it reaches first is kept for sweepBullet() to weigh against the walls and edges
+void bulletShipCD(Bullet *bullet, Player *ship){
+	fixed t = bulletShipTime(bullet, ship, bullet->dx, bullet->dy);
+	if(t != NO_CONTACT && (bullet->target == 0 || t < bullet->targetTime)){
+		bullet->target = ship;
+		bullet->targetTime = t;
+	}
+}
+
+//first part of a frame a bullet moving by (dx,dy) overlaps ship, NO_CONTACT if it does not
+fixed bulletShipTime(Bullet *bullet, Player *ship, fixed dx, fixed dy){
+	//the ships only overlap a bullet strictly
+	return sweepBox(bullet->x, bullet->y, dx, dy,
+		ship->x - FIX_I(BULLET_WIDTH) + 1, ship->y - FIX_I(PLAYER_HEIGHT) + 1,
+		ship->x + FIX_I(PLAYER_WIDTH) - 1, ship->y + FIX_I(BULLET_HEIGHT) - 1);
+}
+
+//powerUp collision with player
+void powerUpShipCD(PowerUp *powerUp, Player *player){
+	if(powerUp->active && powerUp->displayed){		//not taken by the other ship this frame
+		if (powerUp->x < player->x + FIX_I(PLAYER_WIDTH) &&
+			powerUp->x + FIX_I(POWERUP_WIDTH) > player->x &&
+			powerUp->y > player->y - FIX_I(PLAYER_HEIGHT) &&
+			powerUp->y - FIX_I(POWERUP_HEIGHT) < player->y) {
+				if(powerUp->powerUp == Reverse){
+					game.clockwise ^= 1;
+					ST7735_Tint(REVERSE_TINT, game.clockwise ? 0 : REVERSE_TINT_LEVEL, REVERSE_TINT_FRAMES);	//screen stays tinted while reversed
+				} else {
+					//set player powerup
+					player->powerUp = powerUp->powerUp;
+				}
+				//erase powerUp and deactivate
+				powerUp->active = 0;
+				powerUp->displayed = 0;
+				powerUp->powerUpCooldown = POWERUP_COOLDOWN;
+				eraseRect(FIX_INT(powerUp->x),FIX_INT(powerUp->y),POWERUP_WIDTH,POWERUP_HEIGHT);
+		}
+	}
+}
+
+void spawnPowerUps(void){
+	for(uint8_t i=0; i<POWERUPS_N; i++){
+		if(!game.powerUps[i].active){
+			if(game.powerUps[i].powerUpCooldown == 0){		//if powerUpCooldown == 0
+				game.powerUps[i].active = 1;
+			}  
+		}
+	}
+	drawPowerUps();
+}
+
+//draw laser and collsion detection
+//the beam is rasterized once into laserBeam's spans for the screen, and cast once along its center line for what it hits
+void shootLaser(Player *player){
+	player->powerUp = None;
+	fixed dx, dy, startX, startY, t, tY;
+	uint8_t hits[WALLS_N], hitsN;
+	Player *ship;
+	//calculate laser velocity
+	dx = BulletVelocity[player->dir][0];
+	dy = BulletVelocity[player->dir][1];
+	//start laser at player's origin
+	startX = player->x + FIX_I(PLAYER_WIDTH/2);
+	startY = player->y - FIX_I(PLAYER_HEIGHT/2);
+	
+	//direction offset from player sprite
+	startX = startX + dx/4, 
+	startY = startY + dy/4;
+	while(startX <= player->x + FIX_I(PLAYER_WIDTH) &&
+		startX + FIX_I(BULLET_WIDTH) >= player->x &&
+		startY >= player->y - FIX_I(PLAYER_HEIGHT) &&
+		startY - FIX_I(BULLET_HEIGHT) <= player->y &&
+		startX < FIX_I(WIDTH) && startX > 0 && startY > 0 && startY < FIX_I(HEIGHT)){
+			startX += dx/4;
+			startY += dy/4;
+		}	
+	//the beam runs between the centers of its end stamps, in the middle of their pixels
+	startX = FIX_I(FIX_INT(startX)+LASER_WIDTH/2) + FIX_ONE/2;
+	startY = FIX_I(FIX_INT(startY)-LASER_HEIGHT/2) + FIX_ONE/2;
+	//it stops where its center would leave the pixels rasterLaser keeps the stamps in
+	dx *= LASER_REACH;
+	dy *= LASER_REACH;
+	t = leaveAxis(startX, dx, FIX_I(1), FIX_I(WIDTH-1)-1);
+	tY = leaveAxis(startY, dy, FIX_I(1), FIX_I(HEIGHT-1)-1);
+	if(tY < t) t = tY;
+	if(t > FIX_ONE) t = FIX_ONE;
+	dx = FIX_I(FIX_INT(startX + FIX_MUL(dx, t))) + FIX_ONE/2 - startX;		//to the middle of the last pixel, like the start
+	dy = FIX_I(FIX_INT(startY + FIX_MUL(dy, t))) + FIX_ONE/2 - startY;
+	if(laserBeam.displayed){		//a beam shot by the other player this frame, only one is kept
+		eraseLaser();
+	}
+	rasterLaser(FIX_INT(startX), FIX_INT(startY), FIX_INT(startX+dx), FIX_INT(startY+dy));
+	drawLaser();
+	//destroy the walls it crosses, nearest first, and the other player
+	hitsN = laserRaycast(player, startX, startY, dx, dy, hits, &ship);
+	for(uint8_t k=0; k<hitsN; k++){
+		destroyWall(hits[k]);
+	}
+	if(ship){
+		shipHit(player, ship);
+	}
+	laserBeam.displayed = 1;
+}
+
+//rasterize a beam from (x0,y0) to (x1,y1) into laserBeam's spans
+//the center line is found with Bresenham's algorithm and every pixel of it gets the 3x3 laser stamp,
+//so a row spans the stamps of its own pixels and the rows next to it, in the core color where a stamp's cross reaches
+void rasterLaser(int16_t x0, int16_t y0, int16_t x1, int16_t y1){
+	int16_t dx, dy, sx, sy, err, e2;
+	int16_t pMin, pMax, cMin, cMax, nMin, nMax, c0, c1, w0, w1;
+	uint8_t k, n;
+	
+	//keep the stamps on the screen
+	if(x0<1) x0 = 1;
+	if(x0>WIDTH-2) x0 = WIDTH-2;
+	if(x1<1) x1 = 1;
+	if(x1>WIDTH-2) x1 = WIDTH-2;
+	if(y0<1) y0 = 1;
+	if(y0>HEIGHT-2) y0 = HEIGHT-2;
+	if(y1<1) y1 = 1;
+	if(y1>HEIGHT-2) y1 = HEIGHT-2;
+	
+	laserBeam.top = (y0<y1 ? y0 : y1)-1;
+	laserBeam.rows = n = (y0<y1 ? y1-y0 : y0-y1)+3;		//rows of the center line and one more above and below
+	
+	//first pass: columns of the center line in each row
+	for(k=1; k<n-1; k++){
+		laserBeam.x0[k] = WIDTH;
+		laserBeam.x1[k] = 0;
+	}
+	dx = x1>x0 ? x1-x0 : x0-x1;
+	dy = y1>y0 ? y0-y1 : y1-y0;
+	sx = x0<x1 ? 1 : -1;
+	sy = y0<y1 ? 1 : -1;
+	err = dx+dy;
+	while(1){
+		k = y0-laserBeam.top;
+		if(x0<laserBeam.x0[k]) laserBeam.x0[k] = x0;
+		if(x0>laserBeam.x1[k]) laserBeam.x1[k] = x0;
+		if(x0==x1 && y0==y1) break;
+		e2 = 2*err;
+		if(e2>=dy){
+			err += dy;
+			x0 += sx;
+		}
+		if(e2<=dx){
+			err += dx;
+			y0 += sy;
+		}
+	}
+	
+	//second pass: spans from the center line of each row and the rows next to it, WIDTH and -1 mark a row without any
+	pMin = WIDTH; pMax = -1;
+	cMin = WIDTH; cMax = -1;
+	for(k=0; k<n; k++){
+		if(k+1<n-1){
+			nMin = laserBeam.x0[k+1];
+			nMax = laserBeam.x1[k+1];
+		} else {
+			nMin = WIDTH;
+			nMax = -1;
+		}
+		c0 = (pMin<cMin ? pMin : cMin); if(nMin<c0) c0 = nMin;			//stamps reach one column past the center line
+		c1 = (pMax>cMax ? pMax : cMax); if(nMax>c1) c1 = nMax;
+		c0--;
+		c1++;
+		w0 = cMin-1; if(pMin<w0) w0 = pMin; if(nMin<w0) w0 = nMin;		//crosses of this row and the middle of the rows next to it
+		w1 = cMax+1; if(pMax>w1) w1 = pMax; if(nMax>w1) w1 = nMax;
+		laserBeam.x0[k] = c0 | (c0<w0 ? LASER_EDGE : 0);
+		laserBeam.x1[k] = c1 | (c1>w1 ? LASER_EDGE : 0);
+		pMin = cMin; pMax = cMax;
+		cMin = nMin; cMax = nMax;
+	}
+}
+
+//first part of a beam from center (x,y) by (dx,dy) that covers a pixel of a rectangle, NO_CONTACT if none of it does
+//(rx,ry) is the rectangle's bottom left corner, the beam is its 3x3 stamp swept along the center line,
+//so the pixel the center is in is tested against the rectangle grown by a pixel on every side,
+//except on the axis the beam is longer along, where rasterLaser steps the center from middle to middle of the pixels
+//and the rectangle grows by half a pixel less
+fixed beamReach(fixed x, fixed y, fixed dx, fixed dy, int16_t rx, int16_t ry, uint8_t w, uint8_t h){
+	fixed x0 = FIX_I(rx-LASER_WIDTH/2), x1 = FIX_I(rx+w+LASER_WIDTH/2)-1,
+				y0 = FIX_I(ry-h+1-LASER_HEIGHT/2), y1 = FIX_I(ry+1+LASER_HEIGHT/2)-1;
+	if(FIX_ABS(dx) >= FIX_ABS(dy)){
+		x0 += FIX_ONE/2;
+		x1 -= FIX_ONE/2-1;
+	} else {
+		y0 += FIX_ONE/2;
+		y1 -= FIX_ONE/2-1;
+	}
+	return sweepBox(x, y, dx, dy, x0, y0, x1, y1);
+}
+
+//cast a laser's beam from center (x,y) by (dx,dy), puts the destructible walls it crosses in walls, nearest first,
+//and sets *ship to the other player if it crosses it or 0, returns how many walls
+//walls are taken from the grid a row of cells at a time, with the columns the beam reaches in that row
+uint8_t laserRaycast(Player *player, fixed x, fixed y, fixed dx, fixed dy, uint8_t *walls, Player **ship){
+	Player *other = player == &p1 ? &p2 : &p1;
+	uint8_t near[WALLS_N], nearN, i, n = 0, k, j;
+	fixed times[WALLS_N], t, tIn, tOut, bx0, bx1;
+	int16_t row, row0, row1;
+	
+	row0 = FIX_INT((dy<0 ? y+dy : y) - LASER_HALF)>>CELL_SHIFT;
+	row1 = FIX_INT((dy<0 ? y : y+dy) + LASER_HALF)>>CELL_SHIFT;
+	if(row0 < 0) row0 = 0;
+	if(row1 > CELL_ROWS-1) row1 = CELL_ROWS-1;
+	for(row=row0; row<=row1; row++){
+		//part of the beam in the row of cells, and the columns it reaches there
+		tIn = 0; tOut = FIX_ONE;
+		if(!sweepAxis(y, dy, FIX_I(row<<CELL_SHIFT) - LASER_HALF, FIX_I((row+1)<<CELL_SHIFT) + LASER_HALF, &tIn, &tOut)) continue;
+		bx0 = x + FIX_MUL(dx, tIn);
+		bx1 = x + FIX_MUL(dx, tOut);
+		if(bx0 > bx1){
+			t = bx0; bx0 = bx1; bx1 = t;
+		}
+		nearN = wallsNear(FIX_INT(bx0 - LASER_HALF), row<<CELL_SHIFT, FIX_INT(bx1 + LASER_HALF), ((row+1)<<CELL_SHIFT)-1, near);
+		for(k=0; k<nearN; k++){
+			i = near[k];
+			if(!game.walls[i].destructible) continue;
+			t = beamReach(x, y, dx, dy, game.walls[i].x, game.walls[i].y, WALL_SIZE, WALL_SIZE);
+			if(t == NO_CONTACT) continue;
+			//a wall on two rows of cells comes up in both
+			for(j=0; j<n && walls[j]!=i; j++){}
+			if(j < n) continue;
+			//insert in order of the part of the beam that reaches it
+			for(j=n; j>0 && times[j-1]>t; j--){
+				walls[j] = walls[j-1];
+				times[j] = times[j-1];
+			}
+			walls[j] = i;
+			times[j] = t;
+			n++;
+		}
+	}
+	*ship = beamReach(x, y, dx, dy, FIX_INT(other->x), FIX_INT(other->y), PLAYER_WIDTH, PLAYER_HEIGHT) != NO_CONTACT ? other : 0;
+	return n;
+}
+
+//generate particles
+#define PARTICLES_G_N	15
+void particleGenerate(int16_t x, int16_t y){
+	uint8_t j =0;
+	for(uint8_t i=0;i<PARTICLES_G_N;i++){
+		while(j<PARTICLES_N && particles[j].active == 1){
+			j++;
+		}
+		if(j == PARTICLES_N) return;		//every particle in use
+		particles[j].active = 1;
+		particles[j].x = FIX_I(x);
+		particles[j].y = FIX_I(y);
+		uint8_t angle = randomGenerate(0,255);		//256ths of a turn
+		particles[j].time = randomGenerate(20,60);
+		uint8_t speed = randomGenerate(1,4);
+		particles[j].dx = FIX_COS(angle)*speed;
+		particles[j].dy = -FIX_SIN(angle)*speed;
+	}
+}
+
+//move active particles
+void moveParticles(void){
+	for(uint8_t i=0;i<PARTICLES_N;i++){
+		if(particles[i].active){
+			//erase previous particle
+			eraseParticle(FIX_INT(particles[i].x),FIX_INT(particles[i].y));
+			if(particles[i].time == 0){
+				particles[i].active = 0;
+			} else {
+				//move particle
+				particles[i].x += particles[i].dx;
+				particles[i].y += particles[i].dy;
+				if(particles[i].x < FIX_I(WIDTH) && particles[i].x > 0 && particles[i].y > 0 && particles[i].y < FIX_I(HEIGHT)){
+					//draw particle if in bounds
+					drawParticle(FIX_INT(particles[i].x),FIX_INT(particles[i].y));
+				} else {
+					particles[i].active = 0;
+				}
+			}
+			
+		}
+	}
+}
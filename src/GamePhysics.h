@@ -1,24 +1,40 @@
-#ifndef GAMEPHYSICS_H
-#define GAMEPHYSICS_H
-#include <stdint.h>
-#include "GameObjects.h"
-
-void rotatePlayer(Player *player);
-void acceleratePlayer(Player *player);
-void movePlayer(Player *player);
-
-void shootLaser(Player *player);
-void shootBullet(Player *player);
-void moveBullets(Player *player);
-
-uint8_t playerCD(double x, double y, uint8_t w, uint8_t h, Player *player);
-uint8_t wallBulletCD(int16_t x, int16_t y, uint8_t w, uint8_t h);
-uint8_t bulletCD(Bullet *bullet, Player *player);
-uint8_t powerUpCD(Player *player);
-void laserCD(double x, double y,uint8_t w, uint8_t h, Player *player);
-
-void spawnPowerUps(void);
-void particleGenerate(double x, double y);
-void moveParticles(void);
-
-#endif
+#ifndef GAMEPHYSICS_H
+#define GAMEPHYSICS_H
+#include <stdint.h>
+#include "GameObjects.h"
+
+void rotatePlayer(Player *player);
+void acceleratePlayer(Player *player);
+void movePlayer(Player *player);
+void buildWallGrid(void);
+uint8_t wallsNear(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t *walls);
+void destroyWall(uint8_t i);
+
+void shootLaser(Player *player);
+void shootBullet(Player *player);
+void moveBullets(Player *player);
+
+uint8_t sweepAxis(fixed p, fixed d, fixed lo, fixed hi, fixed *tIn, fixed *tOut);
+fixed sweepBox(fixed x, fixed y, fixed dx, fixed dy, fixed x0, fixed y0, fixed x1, fixed y1);
+fixed leaveAxis(fixed p, fixed d, fixed lo, fixed hi);
+uint8_t enterAxis(fixed p, fixed d, fixed lo, fixed hi, fixed *t0, fixed *t1);
+fixed enterBox(fixed x, fixed y, fixed dx, fixed dy, fixed x0, fixed y0, fixed x1, fixed y1, uint8_t *normal);
+uint8_t sweepBullet(Bullet *bullet, Player *player, fixed dx, fixed dy);
+void shipHit(Player *shooter, Player *ship);
+void rasterLaser(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+fixed beamReach(fixed x, fixed y, fixed dx, fixed dy, int16_t rx, int16_t ry, uint8_t w, uint8_t h);
+uint8_t laserRaycast(Player *player, fixed x, fixed y, fixed dx, fixed dy, uint8_t *walls, Player **ship);
+
+struct Body;
+void objectsCD(void);
+void bodiesCD(struct Body *a, struct Body *b);
+void bladesShipCD(Player *player, Player *ship);
+void bulletShipCD(Bullet *bullet, Player *ship);
+fixed bulletShipTime(Bullet *bullet, Player *ship, fixed dx, fixed dy);
+void powerUpShipCD(PowerUp *powerUp, Player *player);
+
+void spawnPowerUps(void);
+void particleGenerate(int16_t x, int16_t y);
+void moveParticles(void);
+
+#endif
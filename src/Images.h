@@ -1,2999 +1,595 @@
-#ifndef IMAGES_H
-#define IMAGES_H
-#include <stdint.h>
-
-const uint8_t Win_P1[] = {
-0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0x00,0x00,0x00,0x00,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-
-
-};
-
-
-const uint8_t Win_P1_180[] = {
-0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0x07,0xff,0xff,0x07,0x07,0x07,0x07,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-
-
-
-};
-
-const uint8_t Win_P2[] = {
-0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe8,0xe8,0xe8,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xe8,0xe8,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xff,0xff
-,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-
-
-
-};
-
-
-const uint8_t Win_P2_180[] = {
-0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xe8,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe8,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff,0xe8,0xe8,0xe8,0xe4,0xff,0xff,0xe4,0xe4,0xe4,0xe4,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
-
-
-
-
-
-};
-
-
-const unsigned short Astro_Start_Menu[] = {
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A40, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x7360, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A40,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x59E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A60, 0x5A40,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A80, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A40, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x6280, 0x5200, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A60, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x59E0, 0x5200, 0x62A0, 0x5200, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5220, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x59E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5240, 0x5A60,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62C0, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x6AE0, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x51E0, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A80, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5A40, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x51E0, 0x5220, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5A20,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x51E0, 0x5200, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5A20,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5240, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x6280, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x51E0,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x62A0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A80, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A80, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62A0, 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6280, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A40, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x51E0, 0x5200, 0x5A00, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x83A9, 0xDEDB, 0xC63A, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63A, 0xF77D, 0xB573, 0x49C2, 0xEF5C, 0xC63B, 0xC63A,
- 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xCE37, 0x41C2, 0xB592, 0xC65A, 0xC63B, 0xC63A, 0xC63A, 0xC63A, 0xC63B,
- 0xC63B, 0xC63B, 0xC63A, 0xE75C, 0x49E1, 0x944F, 0xC65B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63A, 0xCE9B, 0x8C0B,
- 0x6286, 0xEF9D, 0xD6BB, 0xC63A, 0xC63A, 0xC63B, 0xC63B, 0xC63B, 0xC63B, 0xC63A, 0xEF3C, 0x6283, 0x5A00, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x7326, 0xF7BF, 0x6375, 0x00F2, 0x0112, 0x0113, 0x0113, 0x0113, 0x0113, 0x0953, 0xE73D, 0x8457, 0x41EB, 0xE73C, 0x0931, 0x0113,
- 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0xA559, 0x296D, 0xBDD6, 0x1132, 0x0112, 0x0113, 0x0113, 0x0113, 0x0113,
- 0x0113, 0x0113, 0x00B2, 0xBE3B, 0x5269, 0x6BD7, 0x21D3, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0113, 0x0112, 0x52F5, 0xA4EF,
- 0x31F0, 0xCE9C, 0x6397, 0x0113, 0x0112, 0x0113, 0x0113, 0x0113, 0x0113, 0x08F1, 0xBDFB, 0xBD93, 0x6262, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A40, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x59E0, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x8BEA,
- 0xDEDA, 0x5B35, 0x0954, 0x0A9A, 0x12DC, 0x12DC, 0x12DC, 0x0AFC, 0x0ADC, 0x64BC, 0xEF9E, 0x08B0, 0x8478, 0x6B95, 0x0953, 0x0ADC,
- 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFC, 0x12FC, 0x7D3D, 0xBE3B, 0x5B35, 0x9D19, 0x1217, 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0ADC,
- 0x0ADC, 0x0ADC, 0x0A59, 0x5356, 0xBE1B, 0x6BD7, 0x9DFD, 0x1B3C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ABB, 0x21D3, 0xC65B,
- 0x31F3, 0x21B2, 0xBE7E, 0x2B7C, 0x0ADC, 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0A18, 0x08D0, 0xAD9A, 0xCE36, 0x51E0, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5200, 0x5200, 0x5200, 0x62A0, 0x59E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x6B00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x6280, 0x6AC0, 0x5A00, 0x5A00, 0x5200,
- 0x5A60, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6AE4, 0xE71B,
- 0x73D7, 0x00D1, 0x0A9A, 0x855D, 0xB67E, 0xB65E, 0x2B7C, 0x0AFC, 0x0ADC, 0xA5DC, 0x5335, 0x4274, 0xD6DD, 0x08D0, 0x0A59, 0x0ADC,
- 0x857D, 0xB67D, 0xB65E, 0x3BDC, 0x0ADC, 0x0ADC, 0xD73E, 0x5B15, 0x5B35, 0x5336, 0x0ABB, 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0ADC, 0x0ADC, 0x0112, 0xBE1B, 0x2172, 0xDF3D, 0xBE9E, 0xB67E, 0xB67E, 0xB67E, 0xB67E, 0x4C3C, 0x0ADC, 0x09B6, 0x9D19,
- 0xA559, 0x08F1, 0xB5FA, 0x3BFC, 0x0ADC, 0x12FB, 0x9DDD, 0xB67E, 0xB67E, 0x339C, 0x0A39, 0x2192, 0xB5FA, 0xBDB3, 0x5A00, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5200, 0x5200, 0x5AA0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A20, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x62A0, 0x5A20, 0x5A20, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x72E5, 0xDED9, 0x6BD6,
- 0x0932, 0x12BB, 0x855C, 0xDEFD, 0x3212, 0x7C57, 0x3213, 0x0A9A, 0x547C, 0xD6DD, 0x1112, 0x73D6, 0x8478, 0x0113, 0x0ADB, 0x233C,
- 0xAE1C, 0x1972, 0x94B8, 0x4C3D, 0x0ADC, 0x12DC, 0xD73E, 0x21B3, 0x52F5, 0xC67C, 0xBE3C, 0xB63C, 0xCEDD, 0x0AFB, 0x0AFC, 0x0ADC,
- 0xA61D, 0xBE3C, 0xBE3C, 0xB5FB, 0xA59B, 0x0090, 0x3A34, 0x4294, 0x4294, 0x4294, 0x4294, 0x94B8, 0x7D3D, 0x0ADC, 0x0A38, 0x1152,
- 0xADBA, 0x2152, 0x8478, 0xD71E, 0x0AFB, 0x09F7, 0xD6FD, 0x4AD4, 0x6B96, 0xCEFD, 0x1B3C, 0x01D6, 0x1952, 0xD6DC, 0xB572, 0x5A41,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A42, 0xEF7C, 0xB5DB, 0x00B1,
- 0x0A59, 0x4BFC, 0xE75E, 0x3A74, 0x3213, 0xF79E, 0x29B2, 0x129A, 0x751D, 0x5B35, 0x0090, 0xEF5E, 0x6396, 0x12FB, 0x0AFC, 0x9DDD,
- 0xCE7C, 0x00B0, 0x94B7, 0x4C3D, 0x0ADC, 0x131C, 0xDF3E, 0x29B2, 0x0175, 0x0954, 0x0090, 0x0090, 0x8CD9, 0x12DB, 0x0AFC, 0x0AFC,
- 0xA5BB, 0x0090, 0x0090, 0x0090, 0x0A59, 0x00AF, 0xDEDD, 0xF7BE, 0xDEFD, 0xDF1D, 0xDF1D, 0xDF1D, 0xDF1D, 0x12DB, 0x0ADC, 0x0975,
- 0xB5FB, 0xD6BD, 0x0091, 0xBE3B, 0x233C, 0x0A17, 0xBE3B, 0xBE1B, 0x2151, 0xB61B, 0x1B3C, 0x0ADC, 0x01B5, 0x1131, 0xE71D, 0x9C4D,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A80, 0x5A40, 0x5200, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5200, 0x5200, 0x5200, 0x6AC4, 0xCE16, 0x94B8, 0x0911, 0x0A59,
- 0x5C9D, 0xEF7E, 0x4AB4, 0x00B0, 0x7C58, 0xAD7A, 0x0974, 0x335B, 0xCEBC, 0x3A13, 0x008F, 0x9D19, 0x0133, 0x0ADC, 0x0AFC, 0x9DDE,
- 0x4274, 0x2172, 0xC61C, 0x335B, 0x12DC, 0x64BD, 0x9D39, 0x1132, 0x0174, 0x0154, 0x0090, 0x0090, 0x8CD9, 0x0ADB, 0x0AFC, 0x0AFC,
- 0xA5BB, 0x0090, 0x0090, 0x0090, 0x1259, 0x0090, 0x7C57, 0xB5FB, 0x0995, 0x09B5, 0x09B5, 0x0995, 0x0995, 0x0AFC, 0x0ADC, 0x0A17,
- 0x29D3, 0xE73D, 0x29B2, 0x73D6, 0xB67E, 0x0ADC, 0x09D6, 0x8478, 0x8CB9, 0x8CB8, 0x12FB, 0x0ADC, 0x0ADB, 0x0975, 0x3A34, 0xD6BC,
- 0x9C6D, 0x51E0, 0x59E0, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00,
- 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5200, 0x5200, 0x4A00, 0xCE57, 0xA57A, 0x08D1, 0x0A18, 0x0ADC,
- 0xAE1C, 0x4AD5, 0x0090, 0x73F6, 0xD6BC, 0x3A54, 0x0A7A, 0x95DD, 0x9D39, 0x0090, 0x00B0, 0xD6BD, 0x53FB, 0x0ADC, 0x0ADC, 0x9DDD,
- 0xB5DB, 0xAD9A, 0x73F8, 0x0A39, 0x0ADC, 0x64BD, 0x2191, 0x0090, 0x192E, 0x39C7, 0x3966, 0x5AED, 0xD6BD, 0x0ADB, 0x0AFC, 0x0ADC,
- 0xB65C, 0x94B7, 0x3166, 0x3986, 0x29CC, 0x0090, 0x0090, 0xA5DB, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC,
- 0x1173, 0x73D6, 0x5B36, 0x00D0, 0xDF3E, 0x5C9C, 0x0ADC, 0x0A38, 0x0A18, 0x0A18, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0995, 0x3A34,
- 0xD6DB, 0xACF0, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A42, 0xC5F6, 0xAD79, 0x1972, 0x0A58, 0x12DC, 0x7D1D,
- 0xCEBC, 0x0090, 0x6355, 0xDEFD, 0x3A33, 0x0154, 0x1B1B, 0xBE5C, 0x2992, 0x0090, 0x00B0, 0xA4D0, 0x7C79, 0x12DC, 0x0ADC, 0x2A97,
- 0x3A74, 0x3A74, 0x2257, 0x0ABB, 0x12FC, 0x6CFD, 0x2191, 0x0090, 0x212A, 0x5200, 0x5200, 0x942C, 0x8CB8, 0x12FC, 0x0AFC, 0x0AFC,
- 0x4B37, 0xE73B, 0x5200, 0x5200, 0x41A4, 0x0090, 0x0090, 0xADDC, 0x1B1C, 0x0AFC, 0x0AFC, 0x545C, 0xBE7D, 0xB63D, 0xAE3D, 0xAE3D,
- 0xADBB, 0xBDFB, 0xC65B, 0x29B2, 0x6BB6, 0x8D9D, 0x0AFC, 0x0ADC, 0x0AFC, 0x0ADC, 0x1B3C, 0x233C, 0x1B3C, 0x0ADC, 0x12BB, 0x0153,
- 0x4AD5, 0xE73C, 0x8389, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A21, 0xBDB4, 0xDF3E, 0x08F1, 0x09F7, 0x0ADC, 0x4C1D, 0xEF7E,
- 0x3A33, 0x00B0, 0x8478, 0x4A94, 0x0153, 0x02FC, 0xCEFE, 0xC65C, 0x0090, 0x00B0, 0x08AF, 0x944D, 0xEF7E, 0x12DA, 0x12DC, 0x0AFC,
- 0x12FC, 0x0AFC, 0x12FC, 0x0ADC, 0x441C, 0xEF9E, 0x1971, 0x0090, 0x2929, 0x5A00, 0x5A00, 0x942C, 0x74FC, 0x0ADC, 0x0AFC, 0x0AFC,
- 0x2B9C, 0xE71B, 0x5200, 0x5A00, 0x41A3, 0x00AF, 0x0091, 0xCE7C, 0x9DFD, 0x0AFC, 0x0AFC, 0x09D7, 0x9CF9, 0x008F, 0x0090, 0x0090,
- 0x0090, 0x0090, 0x0070, 0x00B0, 0x3A54, 0xEF7E, 0x2B7C, 0x0AFC, 0x0ADC, 0x1B1B, 0xE77E, 0xDF5E, 0xEFBE, 0x1B3B, 0x0AFC, 0x0AFC,
- 0x0112, 0x29D2, 0xF79E, 0x7BA8, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A20, 0xA4EF, 0xC67B, 0x1931, 0x09B6, 0x0ADC, 0x1B3C, 0xD71D, 0x52F4,
- 0x08D1, 0x5B35, 0xCEBC, 0x3213, 0x0ABB, 0x235C, 0xD73E, 0x29D3, 0x00B0, 0x00B0, 0x734A, 0xD6FC, 0x5315, 0x0954, 0x0ADB, 0x0AFC,
- 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC, 0x43FC, 0x9D19, 0x00B0, 0x08CD, 0x5200, 0x5A00, 0x5A00, 0x944C, 0x74FC, 0x0ADC, 0x0AFC, 0x0ADC,
- 0x2B9C, 0xE73B, 0x5200, 0x5A00, 0x5200, 0x2967, 0x0090, 0x4254, 0x9DFE, 0x0AFC, 0x0AFC, 0x09F7, 0x9CF9, 0x4293, 0x4294, 0x4A94,
- 0x4A94, 0x4294, 0x4294, 0x4294, 0x0091, 0x7437, 0x64BC, 0x131C, 0x0ADC, 0x1194, 0xDF1D, 0x32F8, 0x7CDB, 0xE75E, 0x3BDC, 0x0ADC,
- 0x0A9A, 0x0933, 0x7C37, 0xE71C, 0x7326, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0xACF0, 0xCE9C, 0x29D2, 0x09B6, 0x0ADC, 0x0AFC, 0x1B3C, 0xD6FD, 0x8C98,
- 0x94D8, 0xE75E, 0x3A33, 0x0195, 0x0ADC, 0x5C7D, 0x8477, 0x1131, 0x0090, 0x5B35, 0xEF7E, 0x4AB4, 0x0154, 0x12DC, 0x0ADC, 0x5C7D,
- 0x855D, 0x0ADC, 0x0ADC, 0x0ADC, 0x43FC, 0x9D19, 0x0090, 0x08ED, 0x5A00, 0x5200, 0x51E0, 0xCE36, 0x74DD, 0x12FC, 0x0AFC, 0x0AFC,
- 0x2B9C, 0xF79C, 0x8367, 0x5200, 0x51E0, 0x3166, 0x0090, 0x3A34, 0x9DFD, 0x0ADC, 0x0AFC, 0x0A7A, 0x4B16, 0x73D7, 0x73D7, 0x73D7,
- 0x73D7, 0x73D7, 0x6BD6, 0xDEDD, 0x6396, 0x3A13, 0xE75D, 0x235C, 0x0ADC, 0x0953, 0x6BB6, 0xC6BE, 0x3275, 0x7C37, 0xCEFD, 0x3BDC,
- 0x0ADC, 0x0ABB, 0x00F2, 0x5B55, 0xE71B, 0x8388, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0xACEF, 0xD6DC, 0x3233, 0x0195, 0x0ADC, 0x0ADC, 0x0AFC, 0x12DC, 0x5315, 0x5315,
- 0x5315, 0x4AD5, 0x0155, 0x0ABB, 0x2B9C, 0xC69E, 0x29B2, 0x0090, 0x3A54, 0xD69C, 0x6376, 0x0134, 0x0A9A, 0x0AFC, 0x339D, 0xD73E,
- 0xDF5E, 0x0ADC, 0x12FC, 0x0ADC, 0xB67D, 0x9CF8, 0x0090, 0x08ED, 0x5A00, 0x5200, 0x49C0, 0xBDFB, 0x2AF9, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x12FB, 0x6BB6, 0x9C8D, 0x5200, 0x5200, 0x3166, 0x0090, 0x3A34, 0xD73E, 0x33BD, 0x0ADC, 0x0ADC, 0x0A5A, 0x0A18, 0x0A38, 0x0A38,
- 0x0A38, 0x0A38, 0x0133, 0x4294, 0xB5DB, 0x00B0, 0xD6BC, 0x857D, 0x0AFC, 0x0A39, 0x00D1, 0x9D39, 0xC61B, 0x08B1, 0x8C98, 0xC6BE,
- 0x237C, 0x0ADC, 0x0A59, 0x0912, 0x8458, 0xD6B9, 0x6263, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x51E0, 0x5200, 0x7340, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x8BEA, 0xEF5D, 0x29D2, 0x0175, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFC, 0x4C1D, 0xA57A, 0x0090, 0x31F3, 0xEF9E, 0x5B15, 0x00B2, 0x0AFB, 0x12DC, 0x2B9C, 0xEF9E, 0xFFDF,
- 0x42D5, 0x0ADC, 0x0AFC, 0x12FC, 0xBE1C, 0x00B0, 0x0091, 0x49C2, 0x5200, 0x5200, 0x51E0, 0x9DFE, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC,
- 0x0ADC, 0x2B7C, 0x9C8D, 0x5200, 0x5200, 0x5A60, 0x10ED, 0x00B0, 0x6356, 0x4C3D, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0ADB, 0x0933, 0xE75E, 0x8438, 0x00B0, 0xADDC, 0x131C, 0x0ADC, 0x12BB, 0x00B1, 0x9D19, 0x10F1, 0x00B0, 0x9CF9,
- 0xCEFE, 0x1B1C, 0x12DB, 0x0ADB, 0x00B1, 0x73F7, 0xF7BE, 0x6AA4, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x51E0, 0x83A9, 0xE75D, 0x3A53, 0x0113, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC,
- 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFB, 0xDF3E, 0x84D8, 0x1972, 0xC67C, 0x8CB8, 0x00F2, 0x02BA, 0x12DC, 0x1B3C, 0xDF5E, 0xDF3D, 0xE75D,
- 0x3AB6, 0x12FC, 0x0AFC, 0x0ADC, 0xBE1C, 0x00B0, 0x0091, 0x49C2, 0x5200, 0x5200, 0x51E0, 0x9DFE, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC,
- 0x0AFC, 0x2B7C, 0x9C8D, 0x5200, 0x5200, 0x51E0, 0x08CE, 0x00B0, 0x5B56, 0x4C3D, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0154, 0x4AD5, 0x94D8, 0x00B1, 0xC65C, 0x95BD, 0x0AFC, 0x0ADC, 0x01B6, 0x8498, 0xDEFD, 0x1972, 0x08D1,
- 0xBE1B, 0xCEDE, 0x1B1C, 0x0ADC, 0x0A39, 0x0911, 0xBE3B, 0xC636, 0x5A42, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5220, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x83C9, 0xF79D, 0xD69D, 0x73D7, 0x7CFC, 0x753D, 0x753D, 0x753D, 0x753D, 0x753D, 0x751D, 0x7D1D, 0x751D,
- 0x7D1D, 0x751D, 0x751D, 0x7D1C, 0xBE1B, 0x0090, 0xCE9D, 0xE73E, 0x73D6, 0x7C9A, 0x751D, 0x751D, 0xBE9E, 0x7C57, 0x4274, 0xA559,
- 0x74DB, 0x753C, 0x7D1D, 0x7D1C, 0xBE1B, 0x0090, 0x00B0, 0x49C2, 0x5200, 0x5200, 0x51E0, 0xC6DE, 0x751D, 0x7D3C, 0x751D, 0x751D,
- 0x751D, 0x857D, 0xA48D, 0x5200, 0x5200, 0x59E0, 0x10CE, 0x0090, 0x6355, 0x9DDD, 0x751D, 0x753D, 0x753D, 0x751D, 0x751D, 0x751D,
- 0x751D, 0x751D, 0x751D, 0x7D3C, 0x94F9, 0xFFDF, 0x2172, 0x3A74, 0xC6BE, 0x7D1D, 0x751D, 0x749A, 0x73F6, 0xF7DF, 0xCE5C, 0x21D2,
- 0x1131, 0x9D39, 0x9DFD, 0x751D, 0x7D1D, 0x747A, 0x73D6, 0xEF7E, 0xD677, 0x6262, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5A60, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x51E0, 0x6330, 0x6BD7, 0x6BD6, 0x6BD6, 0x6BD6, 0x73D7, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD6, 0x6BD7, 0x6BD7,
- 0x6BD7, 0x6BD6, 0x747A, 0x7438, 0x5BFA, 0x0090, 0x5B56, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BB7, 0x749A, 0x747A, 0x00B0, 0x1952, 0x6BD7,
- 0x6BD6, 0x6BD7, 0x6BD7, 0x6BB7, 0x5C1A, 0x00B0, 0x2129, 0x51E1, 0x51E0, 0x5200, 0x51E0, 0x73D6, 0x6BD6, 0x73D7, 0x749B, 0x749A,
- 0x74DC, 0x73F7, 0x634C, 0x5200, 0x5200, 0x59E0, 0x3166, 0x00AF, 0x2A55, 0x6C38, 0x6BD6, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD7,
- 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD7, 0x6BD6, 0x6BB7, 0x1111, 0x21B3, 0x749A, 0x6BD7, 0x6BD7, 0x6BD6, 0x6BB7, 0x6BD6, 0x6BB7, 0x21B3,
- 0x0090, 0x1172, 0x6C39, 0x6BD7, 0x6BD6, 0x6BD6, 0x6BD7, 0x6BD7, 0x6BD7, 0x5244, 0x59E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5220, 0x5223, 0x1110, 0x0911, 0x0911, 0x08F1, 0x0911, 0x00D1, 0x0090, 0x00D1, 0x08F1, 0x08F1, 0x0911, 0x0911,
- 0x0911, 0x08F1, 0x11F6, 0x0134, 0x1A99, 0x0911, 0x08F1, 0x0911, 0x0911, 0x0911, 0x08F1, 0x1A58, 0x1237, 0x10F2, 0x0911, 0x0911,
- 0x08F1, 0x08F1, 0x08F1, 0x08F1, 0x0A58, 0x00D1, 0x4A04, 0x5A41, 0x5A41, 0x5A41, 0x5A22, 0x1110, 0x08F1, 0x0932, 0x1A79, 0x1A58,
- 0x1AFB, 0x1132, 0x42CD, 0x5A21, 0x5A41, 0x5A41, 0x5A41, 0x10EE, 0x0995, 0x1194, 0x08F1, 0x0911, 0x0911, 0x0911, 0x0911, 0x0911,
- 0x0911, 0x0911, 0x0911, 0x08F1, 0x08F1, 0x0911, 0x08F1, 0x1174, 0x1217, 0x00B0, 0x08F1, 0x0911, 0x0911, 0x08F1, 0x0911, 0x08F1,
- 0x08F1, 0x1173, 0x11B5, 0x08F1, 0x08F1, 0x0911, 0x0911, 0x0911, 0x296B, 0x5A42, 0x5A21, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x51E0, 0x9C8E, 0xE75C, 0xE71E, 0xE73E, 0xE71E, 0xE75D, 0xE75E, 0x52F5, 0x0091, 0x5315, 0xE73D, 0xE71D, 0xE73E, 0xE71E,
- 0xE71D, 0xEF5D, 0x73F7, 0x0A38, 0xDF3E, 0xDF3D, 0xE73E, 0xE73E, 0xE71E, 0xE71E, 0xE71E, 0xE73E, 0xE73E, 0xDF1E, 0xE73E, 0xE73E,
- 0xE73E, 0xE73E, 0xE73D, 0xE73E, 0x00D0, 0x5B36, 0xDF3C, 0xE73D, 0xE73D, 0xE73C, 0xE73D, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E,
- 0xDF3E, 0xE73D, 0xE75D, 0xE73C, 0xE73D, 0xE73C, 0xEF5C, 0x5AEA, 0x5C7C, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E,
- 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xE73E, 0xDF3E, 0x8CB8, 0x08F1, 0xD6DC, 0xE73D, 0xDF3E, 0xE73E, 0xE73E, 0xE73E,
- 0xE73E, 0xE73E, 0xDF3E, 0xE71E, 0xE73E, 0xE73E, 0xE73E, 0xE73D, 0xE73D, 0xE73C, 0xE6FA, 0x51E0, 0x5200, 0x51E0, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A20, 0x944D, 0xCE7B, 0x3213, 0x00B0, 0x00B0, 0x00B0, 0xC65B, 0x6BB6, 0x00B0, 0x52D4, 0xD6BC, 0x4AF5, 0x00B0, 0x00B0, 0x00B0,
- 0x1932, 0xEF7E, 0x52F5, 0x4379, 0xBE1B, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B1, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
- 0x00B0, 0x00B0, 0x00B0, 0xB5DB, 0x00B0, 0x5B56, 0x2191, 0x00B0, 0x00B0, 0x0090, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B1, 0x00B0,
- 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x0091, 0xD6DD, 0x62E9, 0x643B, 0x4AB5, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
- 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x4274, 0xBDFB, 0x2172, 0x9D19, 0x8478, 0x00B0, 0x00B1, 0x00B0, 0x00B0,
- 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x08F1, 0x9D19, 0xC5F4, 0x62A3, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x5200,
- 0x8C0B, 0xEF7E, 0x4AB4, 0x0154, 0x0196, 0x09B5, 0x5357, 0xC65C, 0x0090, 0x4AB4, 0xEF7E, 0x5B35, 0x0133, 0x01B5, 0x01B6, 0x0196,
- 0x6396, 0xDEFD, 0x0091, 0xB5BA, 0x73D7, 0x00F2, 0x09B5, 0x09B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6,
- 0x0196, 0x01B6, 0x42B6, 0xD6BC, 0x2171, 0xA55A, 0x2191, 0x0175, 0x01B5, 0x09B6, 0x09B6, 0x01B6, 0x01B6, 0x01B5, 0x01B6, 0x01B6,
- 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x0133, 0xD6DD, 0x5A87, 0x5B55, 0x94D9, 0x11D5, 0x01B6, 0x09B6, 0x01B6, 0x01B6, 0x09B5,
- 0x01B6, 0x01B6, 0x01B6, 0x01B5, 0x01B6, 0x01B6, 0x01B6, 0x21B3, 0xB5DB, 0x3A33, 0x10F1, 0xBDFA, 0x2A76, 0x01B6, 0x09B6, 0x09B6,
- 0x09B6, 0x09B6, 0x09B6, 0x01B5, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x01B6, 0x0995, 0x08F1, 0xBE1B, 0xBD93, 0x51E0, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x9C4C,
- 0xDEFB, 0x3A53, 0x0975, 0x0ABB, 0x0AFC, 0x441C, 0xE75E, 0x5B15, 0x00B1, 0x94F8, 0x52F5, 0x0954, 0x0A9A, 0x12DC, 0x0ADC, 0x12FC,
- 0xAE1C, 0x3A33, 0x5B55, 0xDF1D, 0x1152, 0x0A7A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x12DC, 0x8D7D, 0x73D7, 0x3A53, 0xB5DA, 0x08D1, 0x0A9A, 0x0ADC, 0x0AFC, 0x0AFC, 0x12FC, 0x0ADC, 0x12FC, 0x1B1C, 0x1B1C,
- 0x12FC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x09F6, 0xD69C, 0xA536, 0x1952, 0xB63B, 0x1B3C, 0x0ADC, 0x0AFC, 0x0ADC, 0x12FC, 0x12FD,
- 0x1B1C, 0x1B1C, 0x131C, 0x131C, 0x0AFB, 0x0AFC, 0x0AFC, 0x09F7, 0x6376, 0xBE1B, 0x0911, 0x94F9, 0x6CBC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x12FC, 0x12FC, 0x1B1C, 0x1B1C, 0x12FC, 0x0AFC, 0x0ADC, 0x0A39, 0x2192, 0xB5BA, 0xBDD4, 0x5A21, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x6AC4, 0xEF9D,
- 0x52F5, 0x00B1, 0x0ABB, 0x12DC, 0x3BBC, 0xEF9E, 0x4AB4, 0x00B0, 0x4AB4, 0xE77E, 0x1951, 0x0A9B, 0x0AFC, 0x0ADC, 0x12DC, 0x857D,
- 0xDF1D, 0x0070, 0x7C16, 0x5B15, 0x0113, 0x02FC, 0x0ADC, 0x0ADC, 0x12DC, 0x0AFC, 0x0AFC, 0x12FC, 0x0ADC, 0x0ADC, 0x12FC, 0x0ADC,
- 0x0ADC, 0x2B7B, 0xEF9E, 0x4274, 0x3A13, 0x9D19, 0x0A7A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADB, 0xDF7F, 0xE77E, 0xE77E,
- 0xCEDE, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x09D7, 0x1131, 0xA559, 0x0090, 0xAD9A, 0x1B3C, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x95BD,
- 0xE77E, 0xDF7E, 0xDF7E, 0xDF5E, 0x12FB, 0x12DC, 0x0ADC, 0x0A59, 0x08D1, 0xB5DB, 0x1111, 0x73F7, 0xE77F, 0x12DB, 0x0ADC, 0x12FC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0xB67E, 0xE75E, 0xE77F, 0xE77E, 0xAE1D, 0x0ADB, 0x0ADC, 0x0ADC, 0x0196, 0x1131, 0xF7BE, 0xB5B1, 0x5A40,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x7B68, 0xE71B, 0x5B55,
- 0x0933, 0x0ADB, 0x12DC, 0x0ADC, 0xCEDD, 0x8C98, 0x00B0, 0x4A94, 0xDEFC, 0x52F4, 0x0933, 0x0ADC, 0x0ADC, 0x0ADC, 0x131C, 0xAE3E,
- 0x4AB4, 0x1952, 0xF79E, 0x73D7, 0x43FB, 0x441D, 0x441C, 0x131C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x441C, 0x4C1C, 0x4C1C,
- 0x4C1C, 0x5C9C, 0x7C38, 0x00B0, 0xDEFD, 0x73F6, 0x0A9A, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADB, 0xE75E, 0x2152, 0x08F1,
- 0xA59A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x00D2, 0x9D39, 0x0090, 0xAD9A, 0x545C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0A38, 0x9D19,
- 0x6376, 0x10F1, 0x10F1, 0xBE3B, 0x33BC, 0x12FB, 0x0AFC, 0x0ADC, 0x09D6, 0x94D9, 0xDEFD, 0x08D1, 0x9D59, 0x43FC, 0x12FB, 0x0ADC,
- 0x0AFC, 0x0ADC, 0x0154, 0xBE1B, 0x3A33, 0x1111, 0x1AFB, 0xBE3C, 0xA61E, 0x1B1C, 0x0ADC, 0x0ADB, 0x09B6, 0x2172, 0xCE9B, 0xA4AE,
- 0x5A20, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x51E0, 0x72E5, 0xE73C, 0x8C98, 0x0112,
- 0x0A7A, 0x0ADC, 0x0AFC, 0x0ADC, 0xC67D, 0x5B36, 0x5B36, 0xD6BC, 0x6396, 0x0133, 0x0ADB, 0x0ADC, 0x0AFC, 0x0AFC, 0x3BDC, 0xC65B,
- 0x29D2, 0x1111, 0x9D19, 0x9D39, 0xA539, 0xBE1B, 0xFFDE, 0x2B19, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x12DB, 0xE77E, 0xA55A, 0x9D39,
- 0x9D39, 0x9D39, 0x4AB5, 0x0090, 0xBE1C, 0x00F2, 0x0ABB, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x3BFC, 0xE73E, 0x08F1, 0x0090,
- 0xA57A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x00D2, 0xB5DA, 0x3A34, 0x73F7, 0xEF9E, 0x0AFC, 0x0AFC, 0x0AFC, 0x0A38, 0x6376,
- 0xD69C, 0x5B35, 0x5B35, 0xD6DC, 0xBE9E, 0x12DC, 0x12DC, 0x0AFC, 0x0A59, 0x0932, 0xDF1D, 0x3213, 0x6396, 0xE75E, 0x131C, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0154, 0x8457, 0xCE9C, 0x3255, 0x09F7, 0x29F3, 0xC65C, 0x7D3C, 0x12FC, 0x12DC, 0x0ADC, 0x0154, 0x3A73, 0xDEFD,
- 0x942C, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x5A00, 0x7326, 0xD698, 0x73D6, 0x0911, 0x0A7A,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x12DC, 0x5B77, 0x6396, 0x6376, 0x5B16, 0x08F3, 0x0A7A, 0x12DC, 0x0AFC, 0x0AFC, 0x131C, 0xA5FD, 0x6B96,
- 0x00B0, 0x0090, 0x0090, 0x00B1, 0x00B0, 0x52F5, 0x7C37, 0x1173, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFB, 0x0AFC, 0xDF1E, 0x08F1, 0x0090,
- 0x0090, 0x0090, 0x0090, 0x6BB6, 0xBE1B, 0x0194, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x95BD, 0x5B35, 0x00D0, 0x0091,
- 0xA57A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x00D2, 0x7417, 0x9D19, 0x08F1, 0xE75E, 0x12FC, 0x0AFC, 0x0AFC, 0x0A9B, 0x0113,
- 0x52F5, 0x6376, 0x6376, 0x6396, 0x4B57, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0953, 0x6375, 0x8C78, 0x00B0, 0xEF9E, 0x64BD, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0A58, 0x0912, 0x94B8, 0x855D, 0x00D2, 0x00B0, 0x29D3, 0xCEBD, 0x233C, 0x0ADC, 0x0AFC, 0x0ADB, 0x0175, 0x4294,
- 0xDEDB, 0xA4AE, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x4A00, 0xE71B, 0x94B8, 0x00D1, 0x129A, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x12DC, 0x0ADC, 0x0A39, 0x0090, 0x0090, 0x00D2, 0x12BB, 0x0ADC, 0x0AFC, 0x0ADC, 0x0AFC, 0x1B3C, 0xC65C, 0x08F1,
- 0x00B0, 0x00B0, 0x0090, 0x0090, 0x29F3, 0xE75D, 0x29D2, 0x1259, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFB, 0x7D3D, 0xE75D, 0x08F1, 0x0090,
- 0x0090, 0x0090, 0x0090, 0xB5DB, 0x1951, 0x0975, 0x12DC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x95BE, 0x008F, 0x0091, 0x0090,
- 0xA57A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x12DC, 0x129B, 0x3A75, 0x9D19, 0x08F1, 0xDF5E, 0x12FC, 0x0AFC, 0x0AFC, 0x0ADC, 0x12BB,
- 0x00F2, 0x0091, 0x00B0, 0x00B0, 0x0133, 0x12DC, 0x12DC, 0x0AFC, 0x0AFC, 0x0A9A, 0x1111, 0xEF5E, 0x52F5, 0x31F2, 0x95DD, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x0A9A, 0x4A95, 0xEF7E, 0x1932, 0x0090, 0x0090, 0xCE7C, 0xCEFE, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADB, 0x0134,
- 0x3A53, 0xF7BE, 0x7B67, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x6283, 0xD6B8, 0x9D19, 0x1132, 0x0A79, 0x0ADC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADB, 0x0A9B, 0x0A9B, 0x0A9B, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0xC6DE, 0xADBA, 0x0090,
- 0x00B1, 0x0090, 0x0090, 0x0090, 0x4AD5, 0xB5BA, 0x0912, 0x0A9A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x8D7D, 0x2191, 0x00B0, 0x0090,
- 0x00B1, 0x0090, 0x0090, 0xB5DB, 0x21F4, 0x0ABB, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x95BE, 0x2191, 0x21B3, 0x2192,
- 0xADBB, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x3A75, 0xAD9A, 0x1132, 0xC65B, 0x7D5D, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0A9B, 0x0A9A, 0x0A9A, 0x0A9A, 0x0ABB, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADB, 0x0112, 0x8458, 0x6BD6, 0x1131, 0xCEBC, 0x547C,
- 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADB, 0x0912, 0x7C17, 0xDEDD, 0x3213, 0x21B2, 0x4A94, 0xD71E, 0x0ADC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0ABB,
- 0x0933, 0x4AB4, 0xDEFB, 0x8388, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x6283, 0xC615, 0xB5DB, 0x0912, 0x0A17, 0x12DC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x339C, 0xD6FD, 0x08F1, 0x0090,
- 0x00B1, 0x00B0, 0x0090, 0x0090, 0xDF1D, 0x7417, 0x0A9A, 0x12DC, 0x0AFC, 0x0AFC, 0x0AFC, 0x237C, 0xAE3D, 0x08D0, 0x0090, 0x0090,
- 0x00B1, 0x00B0, 0x0091, 0x8457, 0xD71E, 0x3BBC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x6C7B, 0xADBA, 0xADBA, 0xADBA,
- 0x9D5A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x2A14, 0xCE7C, 0x4295, 0x0090, 0x95BE, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x12FC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x12FC, 0x0AFC, 0x0AFC, 0x0ADC, 0x12DB, 0x4AF5, 0xD6FD, 0x0090, 0x5B35, 0x8D9D,
- 0x1B1C, 0x12DC, 0x0ADC, 0x0ADC, 0x0A79, 0x00F2, 0x9519, 0xADBA, 0xADBA, 0xADBA, 0x9D7A, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC,
- 0x0A9B, 0x0113, 0x7C37, 0xE71C, 0x7326, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A41, 0xB593, 0xF7DE, 0x7C17, 0x7438, 0x7D1D, 0x74FC, 0x12FC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0AFC, 0x2B7D, 0x7D1D, 0x751D, 0x751D, 0x7D1D, 0x7D1D, 0x751D, 0xBE7D, 0x8C98, 0x08B1, 0x0090,
- 0x00B0, 0x2929, 0x2929, 0x5B12, 0xBE1B, 0x00F1, 0x0ABB, 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC, 0x64BC, 0xBE1B, 0x00B0, 0x0090, 0x0090,
- 0x192B, 0x2929, 0x2929, 0x08AE, 0xA539, 0xC6DD, 0x233B, 0x0AFC, 0x12DC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0975, 0x0090, 0x0090, 0x0090,
- 0x00F2, 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0995, 0x5B55, 0x4295, 0x00B0, 0x95BE, 0x0ADC, 0x0AFB, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x1B1C, 0x7D1C, 0x7D1D, 0x7D1D, 0x7CFD, 0x1B1C, 0x0ADC, 0x0ADC, 0x0ADC, 0x12DB, 0x0113, 0x9D19, 0x6376, 0x3A13, 0xD6BC,
- 0x33BC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0A39, 0x00B1, 0x0090, 0x0090, 0x00B0, 0x00D2, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x129A, 0x00F2, 0x73F7, 0xDEDA, 0x7326, 0x59E0, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x49E2, 0x31F3, 0x31F3, 0x3212, 0x31F3, 0x31F3, 0xCE9C, 0x11B5, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x2B9D, 0xD71E, 0x6CDC, 0x3234, 0x3213, 0x3213, 0x3213, 0x31F3, 0x31F3, 0x00B0, 0x0090, 0x0090,
- 0x08AF, 0x5200, 0x5200, 0xC616, 0x31F3, 0x0154, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0AFC, 0x5CBC, 0x73F7, 0x0090, 0x0090, 0x2948,
- 0x51E1, 0x59E0, 0x5200, 0x10EB, 0x08F0, 0x7C37, 0xCEFE, 0x2B7C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x129B, 0x0A7A, 0x0A7A, 0x0A7A,
- 0x0A9A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0A59, 0x5B56, 0x42B5, 0x00B0, 0xE77E, 0x5C5C, 0x12DC, 0x0AFC, 0x0AFC,
- 0x0A9B, 0x29F4, 0x7C17, 0x31F2, 0x31F3, 0x8CB8, 0x2B5C, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x01D6, 0x2991, 0xE71D, 0x08D1, 0x9D59,
- 0xB67E, 0x12DB, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x127A, 0x0A7A, 0x0A7A, 0x0A7A, 0x0A7A, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x12DC, 0x0A9A, 0x0913, 0x6BB6, 0xE71B, 0x6262, 0x51E0, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x3147, 0x0090, 0x0090, 0x00B0, 0x6B96, 0xD6DD, 0x1153, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x1B1C, 0xC6BE, 0xB5DB, 0x0932, 0x0A17, 0x0090, 0x00B0, 0x00B0, 0x00B0, 0x0090, 0x0090, 0x0090, 0x0090,
- 0x3166, 0x5200, 0x944C, 0xE73D, 0x1153, 0x0A9B, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x12DC, 0xD6FE, 0x6BB7, 0x0090, 0x0090, 0x3166,
- 0x5200, 0x59E0, 0x5A00, 0x18EB, 0x0090, 0x1951, 0xDF1D, 0x2A76, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0A59, 0x5B35, 0xCE7C, 0x1111, 0x8478, 0x6CDC, 0x0ADC, 0x0AFC, 0x0AFC,
- 0x0A9A, 0x2192, 0xD6DD, 0x29D3, 0x0090, 0x73D7, 0xCEFE, 0x233C, 0x0AFC, 0x0ADC, 0x0AFC, 0x0ABB, 0x0974, 0xE75E, 0x7C58, 0x2172,
- 0xB63C, 0x131C, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0AFC, 0x0ADC, 0x0A79, 0x0912, 0x8CD8, 0xDED9, 0x6262, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x41A4, 0x08CF, 0x0090, 0x73F7, 0xDEFD, 0x1971, 0x0954, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x237C, 0xBE9E, 0x9D19, 0x00B0, 0x0090, 0x09F7, 0x00F2, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x08AE,
- 0x41C3, 0x5A01, 0xBD93, 0x4AB4, 0x0995, 0x12DC, 0x0ADC, 0x0AFC, 0x0AFC, 0x12FC, 0x12FB, 0x9519, 0x00B0, 0x00B0, 0x10CD, 0x5200,
- 0x5A00, 0x5200, 0x5200, 0x51E1, 0x1110, 0x8458, 0xC65B, 0x19D4, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0A7A, 0x00F2, 0xAD79, 0x1111, 0x6BB6, 0x64BC, 0x12DC, 0x0AFC, 0x0AFC,
- 0x0A9B, 0x0112, 0x9D19, 0x3213, 0x0090, 0x00B0, 0xD6FC, 0x237C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x09B6, 0x1932, 0xAD9A, 0x1131,
- 0xAD7A, 0xC6DE, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0A59, 0x08F2, 0xAD7A, 0xD657, 0x6AA4, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x212A, 0x4273, 0xD6DC, 0x5B55, 0x0934, 0x0ADB, 0x0ADC,
- 0x0AFC, 0x0ADC, 0x853C, 0xC65B, 0x0911, 0x00B0, 0x0090, 0x00D2, 0x0A38, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x0090, 0x00B0, 0x3167,
- 0x5200, 0x62A4, 0xD6BC, 0x3213, 0x0ADB, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x12FC, 0x4C1C, 0x9D19, 0x00B0, 0x0090, 0x10ED, 0x5200,
- 0x5A00, 0x5200, 0x5200, 0x51E0, 0x73D6, 0xDEFD, 0x1931, 0x0175, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0AFC,
- 0x0AFC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x09F8, 0xA579, 0x1111, 0x6BB6, 0x959C, 0x12DB, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0A7B, 0x9D19, 0x6BD6, 0x0090, 0x0090, 0xDEDD, 0x545C, 0x12DC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADB, 0x1111, 0xC65B, 0x5B15,
- 0x21B3, 0xD73E, 0x235C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x0ADC, 0x12DC, 0x0AFC, 0x0ADC, 0x0A17, 0x0090, 0xBDFB, 0xC5F4, 0x5A21, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x840F, 0xEF9E, 0x4273, 0x0154, 0x0ADB, 0x0AFC, 0x0AFC,
- 0x0AFC, 0x233C, 0xCEFE, 0x4AD4, 0x0091, 0x00B1, 0x0090, 0x00B1, 0x09B5, 0x0933, 0x0090, 0x00B0, 0x00B0, 0x0090, 0x08CE, 0x41C2,
- 0x5A41, 0xCE35, 0x7C36, 0x09B6, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x12FC, 0xE75E, 0x3A33, 0x00B0, 0x00AF, 0x31A5, 0x5200,
- 0x5A00, 0x5200, 0x59E0, 0xA4CF, 0xD6BC, 0x3213, 0x09F7, 0x0ADB, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC,
- 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0A18, 0xAD9A, 0xAD9B, 0x2192, 0xB5FA, 0x12DB, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0A9A, 0x3213, 0xCEBC, 0x0090, 0x0090, 0x4AB4, 0xAE1C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x12DC, 0x09F7, 0x5B55, 0xC63C,
- 0x29B2, 0x73D6, 0xC6BE, 0xAE3E, 0xAE3D, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E, 0xAE3E,
- 0xAE3D, 0x857D, 0x0AFC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0A38, 0x1972, 0x9D39, 0xC5F4, 0x6241, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x7347, 0xE71B, 0x52F4, 0x0153, 0x0A9A, 0x0ADC, 0x0AFC, 0x0AFC,
- 0x1B1C, 0xC6BE, 0x9D39, 0x1111, 0x0090, 0x00B1, 0x00B0, 0x0090, 0x0154, 0x0975, 0x0090, 0x0091, 0x0091, 0x0090, 0x10CE, 0x5A00,
- 0x5A62, 0xDF3E, 0x2172, 0x0238, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x12FC, 0xDF5E, 0x00B0, 0x0090, 0x00AF, 0x51E0, 0x5200,
- 0x5A00, 0x5200, 0x942B, 0xEF7D, 0x3212, 0x0154, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x1B3C, 0xB67E, 0xBE9E,
- 0xAE3D, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0A18, 0x3213, 0xEF5E, 0x0090, 0x9519, 0x12DC, 0x0AFC, 0x0AFC,
- 0x0ADC, 0x0ABC, 0x0134, 0xC63B, 0x8C98, 0x0090, 0x0090, 0xCEDD, 0x751D, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ABB, 0x1151, 0xB5DB,
- 0x21B2, 0x08F1, 0x3A54, 0x3A73, 0x3A54, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74, 0x3A74,
- 0x649C, 0xEF9E, 0x43FC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x09D7, 0x1952, 0xDEFC, 0xC5D5, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x7B26, 0xE73D, 0x5B36, 0x00F2, 0x0ABB, 0x0AFC, 0x0ADC, 0x0AFB, 0x0ADC,
- 0xAE1D, 0xB5FB, 0x08F1, 0x00B0, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x2149, 0x51E1, 0x51E1, 0x51E1, 0x51E1, 0x51E1, 0x51E0, 0x5200,
- 0xBDF5, 0xB5DB, 0x09B6, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x9DDC, 0xCE9C, 0x00B0, 0x0090, 0x10ED, 0x51E0, 0x5A80,
- 0x5A40, 0x7B88, 0xDEFC, 0x4274, 0x0974, 0x0ADB, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x235C, 0xE77E, 0x94F9, 0x08F1,
- 0xA59A, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0994, 0xE73E, 0x0090, 0x9D19, 0x339C, 0x0AFC, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x09D6, 0x1111, 0xBE1B, 0x1132, 0x0090, 0x4AB4, 0xAE3D, 0x1B1C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x09F7, 0x8478,
- 0xC63B, 0x0090, 0x0090, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x00D2,
- 0x0A17, 0x3A34, 0xE73D, 0x33DC, 0x12DC, 0x0AFC, 0x0AFC, 0x0ADC, 0x09F7, 0x1952, 0xC65B, 0xAD31, 0x5A41, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x59E0, 0x62A4, 0xDEDA, 0x8CB8, 0x00D2, 0x0A9B, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x2B5C,
- 0xAE3C, 0x0070, 0x0090, 0x00B0, 0x00B0, 0x00B1, 0x00B0, 0x08CE, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x6283,
- 0xBDF6, 0x0071, 0x01F7, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0ADC, 0x9DDD, 0x1132, 0x0090, 0x00B0, 0x49E1, 0x5200, 0x51E0,
- 0x7326, 0xF7BE, 0x6376, 0x00F2, 0x0AFC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x233C, 0xA61E, 0xC61B, 0x08F1, 0x0091,
- 0xA57A, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0994, 0xE73E, 0x1951, 0x7C38, 0xE75E, 0x131C, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x0AFC, 0x0933, 0xD6DD, 0x8457, 0x0090, 0x3A13, 0xDF1D, 0x43FC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0A58, 0x00B1,
- 0xADBB, 0x2192, 0x0090, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x0A38,
- 0x00D2, 0x0091, 0xB5BA, 0x5C7C, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0153, 0x1952, 0xE73E, 0x946D, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x51E0, 0x6AA4, 0xE71B, 0x8458, 0x00F2, 0x127A, 0x0AFC, 0x0ADC, 0x0AFC, 0x0AFC, 0x233C, 0xC6BE,
- 0x94D8, 0x0071, 0x0090, 0x0091, 0x0090, 0x0090, 0x0090, 0x2948, 0x51E0, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0xB551,
- 0x94B8, 0x00D1, 0x0ADC, 0x12DC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x3BDC, 0xC6BD, 0x1131, 0x0090, 0x0091, 0x49E1, 0x5200, 0x83CA,
- 0xD69A, 0x6375, 0x0953, 0x0A9B, 0x12DC, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFB, 0x0ADC, 0xB65E, 0xAD9A, 0x00B0, 0x0090, 0x0090,
- 0xA57A, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0AFC, 0x0974, 0x6BD6, 0x8CB9, 0x00B0, 0xE75F, 0x1B1C, 0x0ADC,
- 0x0AFC, 0x0AFC, 0x0ADC, 0x0A17, 0x4274, 0x7C57, 0x00B0, 0x0090, 0x6376, 0x43FC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADC, 0x0ADC, 0x0154,
- 0x7417, 0xCE7C, 0x0090, 0x0090, 0x0091, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x0113, 0x09B6,
- 0x00B1, 0x0090, 0x5315, 0xD6DD, 0x64BD, 0x0ADC, 0x0ADC, 0x0AFC, 0x0AFC, 0x0ADB, 0x09B6, 0x3A53, 0xCE7B, 0xA4AF, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x59E0, 0x6AA4, 0xD678, 0x7C17, 0x0912, 0x0A5A, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x131C, 0xB65E, 0x9D19,
- 0x1131, 0x00B0, 0x0090, 0x00B1, 0x0090, 0x00B0, 0x2948, 0x51E1, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6AA4, 0xE71A,
- 0x4294, 0x0A38, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x649C, 0x8C98, 0x08B1, 0x0090, 0x192A, 0x51E0, 0x51E0, 0xBD92,
- 0x73D6, 0x00B1, 0x0A9A, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0AFC, 0x9E1D, 0xB5DB, 0x2192, 0x0091, 0x00B1, 0x0090,
- 0xA57A, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0A59, 0x00B0, 0x8CB9, 0x0090, 0xE75F, 0x12FC, 0x0ADC,
- 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x4274, 0xD6BC, 0x1931, 0x0090, 0x6376, 0xB67D, 0x131B, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0A79,
- 0x29F4, 0xEF7E, 0x3A33, 0x00B0, 0x0091, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B1, 0x00B0, 0x0194, 0x0154,
- 0x00B1, 0x00B1, 0x00B0, 0x4AB4, 0xE75E, 0x5C5D, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADC, 0x0ADB, 0x0954, 0x3A53, 0xF7BE, 0x944C, 0x6AC4,
- 0x5A00, 0x5200, 0x5200, 0x51E0, 0xBDD6, 0xDF1D, 0xBE3B, 0xB5DB, 0xB63C, 0xB65D, 0xB63D, 0xB65D, 0xB67D, 0xB65D, 0xBE5C, 0x1111,
- 0x0090, 0x0090, 0x0090, 0x0090, 0x00B0, 0x192B, 0x51E0, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6AE6, 0xDF1D,
- 0xBE3C, 0xB63C, 0xB63C, 0xB67D, 0xB65C, 0xB65D, 0xB67D, 0xB65D, 0xC6BD, 0x52F4, 0x0090, 0x00B0, 0x2948, 0x5A00, 0x5200, 0xA511,
- 0xBE3B, 0xB5DB, 0xB63C, 0xB63C, 0xB63C, 0xB63C, 0xB63C, 0xB63C, 0xB63C, 0xBE5C, 0xD73E, 0x1951, 0x0090, 0x0090, 0x0090, 0x0090,
- 0xA579, 0xB67D, 0xB67D, 0xB67D, 0xB63C, 0xB65D, 0xB65C, 0xB65C, 0xB63C, 0xB63C, 0xB5DB, 0x7C38, 0x0090, 0xD73E, 0xBE3D, 0xB67D,
- 0xB67D, 0xB63C, 0xB65D, 0xB63C, 0xBE1B, 0xDEFD, 0x1952, 0x0090, 0x1111, 0xADFB, 0xB63D, 0xB63C, 0xB63C, 0xB63C, 0xB63C, 0xB63C,
- 0xBE1B, 0xDEFD, 0x4AB4, 0x00B0, 0x0090, 0x00B0, 0x00B0, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x0091, 0x00D1, 0x09D7, 0x00B1,
- 0x00B1, 0x00B1, 0x0091, 0x00B0, 0x5B55, 0xC6BD, 0xB65C, 0xB67D, 0xB67D, 0xB63C, 0xB67D, 0xB5FC, 0xB5FB, 0xDF1D, 0xCE9B, 0x8C2F,
- 0x5A00, 0x5200, 0x5200, 0x51E0, 0x10CD, 0x0090, 0x0090, 0x0090, 0x0090, 0x01D7, 0x00D1, 0x0134, 0x0ADC, 0x00F2, 0x0A5A, 0x0091,
- 0x00B1, 0x00B0, 0x00B0, 0x0090, 0x10CD, 0x5A40, 0x5A40, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x41A3, 0x0090,
- 0x0090, 0x0090, 0x0090, 0x0A38, 0x0091, 0x0154, 0x0ADC, 0x0134, 0x0A18, 0x0071, 0x0090, 0x08AF, 0x3166, 0x5200, 0x59E0, 0x2129,
- 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00B0, 0x0ABB, 0x00B0, 0x00B1, 0x0090, 0x0090, 0x08AF,
- 0x00D2, 0x0A9A, 0x01F7, 0x0ADC, 0x0090, 0x0995, 0x00B1, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0A9B, 0x0091, 0x09F7,
- 0x0A9A, 0x00D2, 0x0174, 0x0090, 0x0090, 0x0090, 0x0090, 0x00B0, 0x0091, 0x0A38, 0x00B0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
- 0x0090, 0x0090, 0x00CF, 0x08AE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08CE, 0x08EF, 0x09F5, 0x0090,
- 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x00B1, 0x01B6, 0x00F2, 0x0A9B, 0x09B6, 0x00D2, 0x0A39, 0x0090, 0x0090, 0x0090, 0x008F, 0x3986,
- 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x41C3, 0x0090, 0x0090, 0x0090, 0x0090, 0x0174, 0x0995, 0x0113, 0x0A79, 0x01B6, 0x09F7, 0x00F2,
- 0x00B1, 0x0091, 0x0090, 0x0090, 0x2148, 0x5200, 0x5200, 0x5A00, 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x41C3, 0x0090,
- 0x0090, 0x0090, 0x0090, 0x0A39, 0x00B1, 0x0154, 0x0ADC, 0x0153, 0x0A18, 0x0090, 0x0090, 0x210A, 0x51E0, 0x5200, 0x5200, 0x2129,
- 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090, 0x00B1, 0x0ABB, 0x0090, 0x00B1, 0x0090, 0x08CE, 0x41A4,
- 0x112E, 0x0A9B, 0x09F7, 0x12DC, 0x0090, 0x0995, 0x00D2, 0x0090, 0x0090, 0x0090, 0x0090, 0x08CE, 0x08CE, 0x0ABB, 0x00B1, 0x0A18,
- 0x0A9B, 0x00F2, 0x0175, 0x0090, 0x0090, 0x0090, 0x190B, 0x0090, 0x00B0, 0x0A39, 0x00D1, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
- 0x0090, 0x08CE, 0x41C3, 0x51E0, 0x59E0, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x41A4, 0x08CE,
- 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x0154, 0x09B6, 0x0A9A, 0x0A38, 0x00B0, 0x0A59, 0x00F1, 0x0090, 0x0090, 0x0090, 0x2129, 0x51E1,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E1, 0x2149, 0x0090, 0x00B1, 0x00B1, 0x0091, 0x12BB, 0x00B1, 0x09B6, 0x0ABB, 0x0113, 0x01B6,
- 0x0090, 0x0090, 0x0090, 0x2129, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5A40, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x41C3, 0x0090,
- 0x00B1, 0x00B1, 0x0090, 0x0A39, 0x00B1, 0x0154, 0x0AFC, 0x0154, 0x0A18, 0x0090, 0x0090, 0x39A4, 0x5200, 0x51E0, 0x51E0, 0x212A,
- 0x0090, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x00B1, 0x00B1, 0x00B1, 0x00B0, 0x00B1, 0x0ABB, 0x0090, 0x0090, 0x00AF, 0x3985, 0x59E0,
- 0x112F, 0x0ABB, 0x01F7, 0x0ADC, 0x0090, 0x09B5, 0x00F2, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x2149, 0x212A, 0x0ABB, 0x00B1, 0x0A18,
- 0x0A9A, 0x00F2, 0x0175, 0x0090, 0x00B0, 0x0090, 0x49C2, 0x2948, 0x0090, 0x0A58, 0x00D1, 0x0091, 0x00B1, 0x00B1, 0x00B1, 0x00B1,
- 0x00B0, 0x10ED, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x41A4,
- 0x08AF, 0x0090, 0x0090, 0x00B1, 0x09F6, 0x09D6, 0x12DC, 0x0154, 0x0153, 0x0995, 0x00B1, 0x0090, 0x00B0, 0x00AF, 0x41A3, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x41A4, 0x00B0, 0x00B1, 0x0091, 0x0090, 0x0133, 0x09B6, 0x00D2, 0x0ABA, 0x0A18, 0x09D6,
- 0x0113, 0x0090, 0x190A, 0x49E1, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x190B,
- 0x00B1, 0x0091, 0x00B0, 0x0A38, 0x09F7, 0x00D1, 0x0ABA, 0x0A38, 0x0995, 0x0133, 0x00B0, 0x51E0, 0x51E0, 0x51E0, 0x51E0, 0x41C2,
- 0x08CE, 0x0090, 0x0090, 0x00B0, 0x00B0, 0x00B1, 0x00B1, 0x00B1, 0x00B0, 0x00B1, 0x0ABB, 0x0090, 0x00B0, 0x39A4, 0x51E0, 0x5200,
- 0x112F, 0x0ABB, 0x01F7, 0x12FC, 0x0090, 0x09B5, 0x00F2, 0x00B1, 0x00B1, 0x0090, 0x0090, 0x41C2, 0x2A2F, 0x0133, 0x0913, 0x0ABB,
- 0x09B6, 0x0A38, 0x00D1, 0x0090, 0x0090, 0x190B, 0x51E0, 0x41A4, 0x0154, 0x0175, 0x00B0, 0x0090, 0x00B1, 0x00B1, 0x00B1, 0x00B1,
- 0x00B0, 0x10ED, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x08CE, 0x0090, 0x0090, 0x00D2, 0x0A38, 0x09D6, 0x0ADB, 0x00D1, 0x09B6, 0x00F2, 0x00B0, 0x0090, 0x0090, 0x08CE, 0x59E0, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x18EC, 0x0090, 0x0090, 0x00B0, 0x0091, 0x09F7, 0x00B1, 0x0A7A, 0x0A9A, 0x01D6,
- 0x0954, 0x0090, 0x2947, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x2929,
- 0x00B1, 0x00B0, 0x0090, 0x0090, 0x0A59, 0x00B0, 0x129A, 0x0A9A, 0x0974, 0x0974, 0x08AF, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200,
- 0x10ED, 0x00B0, 0x00B0, 0x00B0, 0x00B0, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x00B1, 0x0ABB, 0x0090, 0x3166, 0x5200, 0x5A00, 0x5A00,
- 0x112F, 0x0ABA, 0x01F7, 0x12DC, 0x0090, 0x09B5, 0x00D2, 0x00B1, 0x00B1, 0x00B0, 0x00B0, 0x5200, 0x2A91, 0x0090, 0x0154, 0x0AFC,
- 0x0974, 0x0A9A, 0x0090, 0x00B1, 0x00B0, 0x2929, 0x5200, 0x41A4, 0x0994, 0x0113, 0x00B0, 0x0090, 0x00B0, 0x00B0, 0x00B0, 0x00B0,
- 0x0090, 0x18EC, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x49C3, 0x08AF, 0x0090, 0x0A39, 0x0934, 0x0ADC, 0x00D2, 0x0153, 0x09D7, 0x00B0, 0x00B0, 0x00B0, 0x00AF, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x2948, 0x00AF, 0x0090, 0x00B0, 0x00B0, 0x0154, 0x01B6, 0x00D1, 0x0ABC, 0x0996,
- 0x0A17, 0x190A, 0x5200, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x2929,
- 0x00B1, 0x00B0, 0x0090, 0x0090, 0x0A59, 0x0090, 0x129A, 0x0A9A, 0x0174, 0x0974, 0x49C2, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5A60,
- 0x10ED, 0x00B0, 0x0090, 0x0090, 0x0090, 0x00B1, 0x00B1, 0x00B1, 0x0090, 0x00B0, 0x12BB, 0x2967, 0x51E0, 0x59E0, 0x5A00, 0x5A00,
- 0x112F, 0x0A9B, 0x01F7, 0x12DC, 0x0090, 0x09B5, 0x00D2, 0x00B1, 0x00B1, 0x00B0, 0x00B0, 0x5200, 0x2A91, 0x0090, 0x0154, 0x0ADC,
- 0x0154, 0x0A9A, 0x0090, 0x00B1, 0x00B0, 0x2929, 0x5200, 0x51E0, 0x324C, 0x0113, 0x00B0, 0x0090, 0x0090, 0x0090, 0x0090, 0x0090,
- 0x08CE, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x4184, 0x00F2, 0x09F7, 0x09B6, 0x0A9A, 0x00D1, 0x0975, 0x0995, 0x0090, 0x0090, 0x0090, 0x10ED, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5200, 0x3166, 0x2967, 0x2967, 0x2967, 0x31A9, 0x31EA, 0x3168, 0x324C, 0x31CA,
- 0x3A6A, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62A0, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x41A4,
- 0x2967, 0x2967, 0x2967, 0x2948, 0x322B, 0x3148, 0x3A2C, 0x324C, 0x29A9, 0x31A9, 0x51E1, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200,
- 0x3186, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x2967, 0x3167, 0x3A4C, 0x51E0, 0x5200, 0x5200, 0x5A00, 0x5200,
- 0x31A7, 0x324C, 0x31EB, 0x3A6D, 0x2948, 0x31CA, 0x2968, 0x2967, 0x2967, 0x2967, 0x3167, 0x5200, 0x4248, 0x2948, 0x31E9, 0x328D,
- 0x31A9, 0x322C, 0x2967, 0x2967, 0x2947, 0x41A4, 0x5200, 0x5200, 0x4225, 0x2989, 0x2967, 0x39E8, 0x31C7, 0x2948, 0x2967, 0x2967,
- 0x3166, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x49C2, 0x320B, 0x29A9, 0x326D, 0x31CA, 0x3147, 0x320B, 0x2947, 0x2967, 0x2967, 0x2948, 0x49C2, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x59E0, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
- 0x5A40, 0x59E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x6260, 0x5A00, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x59E0, 0x51E0, 0x59E0, 0x51E0, 0x5200, 0x5220, 0x5A20,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A60, 0x5A40, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x51E0, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200,
- 0x5200, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x59E0, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x59E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x51E0, 0x59E0, 0x5200,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5240, 0x5A40, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5A60, 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x51E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A20, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5240, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A60, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x6280, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A80, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62C0, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5240, 0x5A60, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5240, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A80, 0x5220, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5200, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A80,
- 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62A0, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6280, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A80, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x62A0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5220,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x6B00, 0x5200, 0x5A00, 0x5200, 0x5A40, 0x5A20,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x51E0, 0x5A20, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A80, 0x51E0,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A60, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A40, 0x5A40, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62A0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5240, 0x5A60, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A40, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5220, 0x5A60, 0x5200, 0x5A00, 0x5200, 0x5200, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A40, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x62C0, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5240, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x62A0, 0x5200, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x51E0, 0x5A80, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5A80, 0x5200, 0x5A00, 0xCE36, 0xFFDE, 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5220, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x7305, 0xD677, 0xFFFF, 0xFFFF, 0xDEB8,
- 0x7305, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0xBD93, 0xFFBE, 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0xE71A, 0xBDB3, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x8C0A, 0xEF5C, 0xACEF, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0x5200,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xE6FA, 0x8367, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE6FA, 0x940B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xE6FA, 0x8367, 0xB551, 0xEF3B, 0x8BE9, 0x7B47, 0xE6FA,
- 0xBD93, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x8C0A, 0xEF7C, 0xB551, 0x6241, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0xB572, 0xCE36, 0x6241, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x7B46, 0xE71A, 0xB551, 0x6241, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00, 0x51E0, 0x5220,
- 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xE71A, 0x8388, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xE71A, 0x8388, 0x5A00, 0x5A00, 0x5A00, 0x6241, 0xDEB8,
- 0xBDB3, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xE71A, 0x8388, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x51E0, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x51E0, 0xACEF, 0xFFDE, 0xFFDE, 0xD698, 0xCE36, 0x5A00, 0xCE36, 0xAD10, 0x5A00, 0xD657, 0xFFFF, 0xFFDE, 0xBD93, 0x5A00,
- 0x9C4C, 0xEF7C, 0xFFFF, 0xE6FA, 0x8388, 0x5A00, 0x942B, 0xEF3B, 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0x5A00, 0x5200, 0x7325,
- 0xDED9, 0xFFFF, 0xF79D, 0xAD0F, 0xAD10, 0xFFDF, 0xFFFF, 0xE71A, 0x5A00, 0x5A00, 0x942B, 0xF7BE, 0xFFFF, 0xEF5C, 0xCE15, 0xEF5C,
- 0xE71A, 0x942B, 0x8388, 0xE71B, 0xFFFF, 0xF79D, 0xA4AE, 0xAD10, 0xFFDF, 0xFFFF, 0xE6FA, 0x5200, 0x942B, 0xD677, 0xF79D, 0xF79D,
- 0x9C4C, 0x5A00, 0x5A00, 0x5A00, 0x8C0A, 0xEF5C, 0xFFFF, 0xF7BE, 0xACEF, 0x8C0A, 0xEF5C, 0xFFFF, 0xF7BE, 0xACEF, 0x6241, 0xCE36,
- 0xFFFF, 0xF7BE, 0xB572, 0x8367, 0xE71A, 0xE6FA, 0xCE36, 0x83C9, 0xEF5C, 0xB551, 0x6241, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x6280, 0x5200, 0x5200,
- 0x5200, 0x62A0, 0xBDB3, 0xD698, 0x7B67, 0xDEB9, 0xD677, 0x5A00, 0xCE36, 0xAD10, 0x8367, 0xE71A, 0xA4CE, 0xA4AE, 0xE6FA, 0x8388,
- 0xDE98, 0xB551, 0x6AA3, 0xD677, 0xC5F4, 0x83C9, 0xEF3B, 0xB551, 0x6261, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0xBDB3,
- 0xE6FA, 0x7B47, 0xB572, 0xE71B, 0x7B46, 0x942B, 0xE71A, 0x8388, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0xA4CE,
- 0xEF7C, 0x942B, 0xAD10, 0xE71A, 0x7305, 0xC5D4, 0xDEB8, 0x5A00, 0x942B, 0xE6FA, 0x8388, 0xAD10, 0xF7BE, 0xE6FA, 0xB572, 0x7305,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x7B46, 0xCE56, 0xD677, 0x5A00, 0x5A00, 0x7B46, 0xCE56, 0xD677, 0xA4CE, 0xDEB9,
- 0x7B47, 0xA4AE, 0xE71A, 0x83C9, 0x6AA3, 0xDEB8, 0xD677, 0x5A00, 0xAD0F, 0xF79D, 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200,
- 0x5200, 0x5200, 0xBDB3, 0xD677, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0xCE36, 0xAD10, 0x7B46, 0xE6FA, 0xA4CE, 0xA4AE, 0xE71B, 0xACEF,
- 0xEF5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xD677, 0xAD10, 0xE6FA, 0x6AA3, 0x5200, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0xD677,
- 0xBDB3, 0x5A00, 0x942B, 0xE71A, 0x8388, 0x942B, 0xE71A, 0x8388, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x6241,
- 0xDEB8, 0x942B, 0xAD10, 0xFFDF, 0xFFFF, 0xF79D, 0xBD92, 0x5A00, 0x942B, 0xE71A, 0x8388, 0xD677, 0xCE15, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xEF5C, 0xFFFF, 0xEF5C, 0x9C4C, 0x944B, 0xEF5C, 0xFFFF, 0xEF5C, 0x9C4C, 0xBDB3, 0xFFFF,
- 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A40, 0x5A40, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0xBDB3, 0xD677, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0xCE36, 0xAD10, 0x5A00, 0xBD72, 0xFFDE, 0xFFFF, 0xCE36, 0x6AA3,
- 0xDED9, 0xB572, 0x6AA3, 0xCE15, 0xCE15, 0x9C8D, 0xEF5C, 0xACEF, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0xBDB3,
- 0xE6FA, 0x7B47, 0xB572, 0xE71B, 0x7B46, 0x9C4C, 0xE71A, 0x8388, 0x5A00, 0x5A00, 0x5A00, 0x83A8, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0xDE98, 0x942B, 0xAD10, 0xE71A, 0x8388, 0x9C8D, 0xE6FA, 0x8388, 0x9C4C, 0xE71A, 0x8388, 0xC5F4, 0xE6FA, 0x7B47, 0x7B47, 0xD698,
- 0xD698, 0x5A00, 0x5A00, 0x5A00, 0xBDB3, 0xDEB8, 0x6AC4, 0xC5D4, 0xD657, 0xC5F3, 0xDEB8, 0x6AC4, 0xC5D4, 0xD657, 0xAD10, 0xE6FA,
- 0x7B47, 0x942B, 0xE71A, 0x8C0A, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0xBDB3, 0xD677, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0xCE36, 0xAD10, 0x6241, 0x944B, 0xBDB3, 0xC5F5, 0xE6FA, 0x8BE9,
- 0xAD0F, 0xF79D, 0xFFFF, 0xE71A, 0x83C9, 0x5A60, 0xBD93, 0xFFBE, 0xFFFF, 0xFFFF, 0xF7BE, 0x942B, 0x5A00, 0x5A00, 0x5A00, 0x7305,
- 0xDED9, 0xFFFF, 0xF79D, 0xAD0F, 0xBDB3, 0xFFFF, 0xDED9, 0x72E4, 0x5A00, 0x5A00, 0xAD10, 0xFFDF, 0xEF3B, 0x8388, 0x5A00, 0x5A00,
- 0xDE98, 0x942B, 0xAD10, 0xDEB9, 0xEF7C, 0xFFFF, 0xDEB8, 0xC615, 0xFFFF, 0xDEF9, 0x6AE4, 0x8388, 0xDED9, 0xFFFF, 0xFFFF, 0xE71A,
- 0x83C9, 0x5A00, 0x5A00, 0x5A00, 0x942B, 0xEF5C, 0xFFFF, 0xF77D, 0x9C6D, 0x942B, 0xEF5C, 0xFFFF, 0xF77D, 0x9C6D, 0x72E5, 0xDEB8,
- 0xFFFF, 0xFFBE, 0xBD93, 0x5A00, 0x5A00, 0xAD10, 0xCE36, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x8388, 0xE71A, 0x942B, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0xC5F4, 0xCE36, 0x6AC4, 0x6AC4, 0xD656, 0xA4AE,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A40, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x9C4C, 0xEF5C, 0xFFFF, 0xFFFF, 0xEF5C, 0x942B,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A60, 0x5200, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A20, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x59E0, 0x59E0, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A40, 0x5A60, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x6B00, 0x62A0, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5AA0, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5A80, 0x51E0, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5220, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5220, 0x5A60, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5200, 0x5200, 0x5A20, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5200, 0x5200, 0x5200, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5200, 0x5A00, 0x5200, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
- 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00, 0x5A00,
-
-
-};
-
-#define KILLS_BTN_WIDTH 75
-#define KILLS_BTN_HEIGHT 30
-const uint8_t Kill_1[] = {
-
-0xa8,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
-,0xcc,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xc8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xcd,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xd1,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xf6,0xff,0xff,0xd1,0xff,0xff,0xfb,0xd6,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xff,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xff,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xd1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xd1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xff,0xff,0xff,0xff,0xff,0xf1,0xa9,0xa9,0xa8,0xf1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xff,0xff,0xff,0xd1,0xfb,0xff,0xfa,0xf1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xfb,0xff,0xff,0xd1,0xff,0xff,0xfb,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf1,0xff,0xff,0xff,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xa8,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xcd,0xff,0xff,0xd1,0xfb,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xad,0xad,0xc8,0xad,0xad,0xc8,0xad,0xad,0xad,0xad,0xad,0xad,0xc8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xff,0xff,0xd6,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xec,0xed,0xf1,0xcc,0xf1,0xec,0xcc,0xf1,0xec,0xf1,0xf1,0xe8,0xe8,0xe8,0xed,0xf1,0xf1,0xf1,0xf1,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xc8,0xf1,0xf1,0xec,0xf1,0xcc,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xed,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xd1,0xff,0xf6,0xcd,0xd6,0xfa,0xff,0xff,0xe8,0xe8,0xc8,0xcd,0xb2,0xff,0xff,0xd1,0xcd,0xfa,0xff,0xd2,0xff,0xf6,0xe8,0xe8,0xc8,0xff,0xfa,0xf5,0xff,0xcd,0xff,0xff,0xd6,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xd6,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xed,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfb,0xf1,0xff,0xf6,0xc8,0xad,0xfb,0xff,0xff,0xe8,0xe8,0xe8,0xc8,0xa8,0xff,0xfa,0xc4,0xc8,0xfa,0xff,0xa8,0xff,0xf6,0xe8,0xe8,0xc8,0xff,0xfa,0xf5,0xff,0xcd,0xff,0xfb,0xd6,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xcd,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xec,0xec,0xec,0xfa,0xfa,0xd1,0xff,0xf6,0xcc,0xd6,0xfb,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xc8,0xff,0xfa,0xe8,0xc8,0xfa,0xff,0xcd,0xff,0xf6,0xec,0xec,0xcc,0xff,0xfa,0xf5,0xff,0xed,0xa8,0xa8,0xb1,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xf6,0xd1,0xfa,0xad,0xda,0xfa,0xe8,0xe8,0xe8,0xe8,0xc8,0xfb,0xfa,0xe8,0xc8,0xf6,0xfb,0xfb,0xfb,0xf6,0xf5,0xfb,0xfb,0xff,0xf6,0xf1,0xfb,0xec,0xc8,0xc8,0xd1,0xfb,0xf1,0xe8,0xe8,0xcc,0xfb,0xff,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xc8,0x84,0xa4,0xa4,0xa4,0xc8,0xa4,0xa4,0xe8,0xe8,0xe8,0xe8,0xe8,0x84,0xa4,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa8,0x80,0xc8,0xe8,0xe8,0xc8,0x84,0xc8,0xe8,0xe8,0xc8,0x84,0x84,0x84,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
-,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xa8,0xcc,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xc8
-
-
-};
-
-const uint8_t Kill_3[] = {
-
-0xec,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf6,0xec
-,0xed,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xec,0xfa,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xd6,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xd6,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xcd,0xd2,0xff,0xff,0xfb,0xd2,0xcc,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xc8,0xff,0xff,0xfa,0xf6,0xff,0xff,0xc8,0xff,0xff,0xf6,0xfa,0xff,0xff,0xda,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xd1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xc8,0xa4,0xff,0xff,0xf6,0xa4,0xc8,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xff,0xff,0xfa,0xf6,0xff,0xff,0xed,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xed,0xff,0xff,0xfa,0xa8,0xd6,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xad,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0x84,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xfb,0x84,0x84,0x84,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xcd,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xad,0xad,0xad,0xad,0xcd,0xcc,0xad,0xad,0xa8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xcc,0xad,0xad,0xcc,0xc8,0xa9,0xad,0xad,0xad,0xad,0xcd,0xcc,0xad,0xad,0xcc,0xad,0xad,0xcd,0xcc,0xad,0xad,0xc8,0xad,0xad,0xcc,0xe8,0xe8,0xad,0xad,0xcd,0xe8,0xe8,0xad,0xad,0xad,0xad,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xe8,0xed,0xec,0xec,0xed,0xec,0xec,0xec,0xec,0xed,0xec,0xe8,0xe8,0xec,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xed,0xec,0xec,0xf1,0xec,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd2,0xd2,0xd6,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xd1,0xfb,0xfa,0xff,0xf6,0xe8,0xe8,0xcc,0xd1,0xd6,0xff,0xfb,0xd2,0xd1,0xfa,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xfb,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xfb,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd2,0xd2,0xd6,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xc8,0xcd,0xff,0xff,0xf6,0xe8,0xe8,0xc8,0xc8,0xcd,0xff,0xd6,0xa4,0xcc,0xfa,0xfb,0xcd,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xfb,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xfb,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xfb,0x89,0xa9,0xc8,0xc8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xec,0xf6,0xff,0xff,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xfb,0xf1,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xa8,0xa8,0xad,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xda,0xa9,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xfa,0xff,0xff,0xff,0xf5,0xf6,0xff,0xff,0xff,0xfa,0xf6,0xff,0xf1,0xfa,0xfb,0xd2,0xfb,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xff,0xff,0xff,0xfa,0xf5,0xff,0xff,0xff,0xfb,0xf1,0xff,0xf1,0xc8,0xc8,0xcc,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0x80,0x80,0x80,0x80,0xc8,0x80,0x80,0x80,0x80,0xa4,0xa4,0x80,0x80,0x80,0xa4,0xa4,0x80,0xc8,0xa4,0x84,0xa4,0x84,0xa4,0xe8,0xe8,0xe8,0xe8,0xc8,0x80,0xa4,0xe8,0xc8,0xa4,0x80,0x80,0x80,0xa4,0xa4,0x80,0x80,0x80,0x84,0xc8,0x80,0xc8,0xe8,0xe8,0xc8,0x80,0xa4,0xe8,0xe8,0xe8,0x80,0x80,0x80,0x80,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xed,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8
-
-
-};
-
-const uint8_t Kill_5[] = {
-
-0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xcc
-,0xcd,0xff,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xff,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xdb,0xff,0xff,0xd5,0xd1,0xd2,0xd2,0xda,0xff,0xff,0xd1,0xd1,0xd2,0xd2,0xda,0xff,0xff,0xf5,0xff,0xff,0xfb,0xdb,0xff,0xfb,0xf1,0xff,0xff,0xfb,0xfb,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xfa,0xd2,0xff,0xff,0xd5,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xd1,0xd1,0xd2,0xad,0xd1,0xff,0xff,0xf5,0xff,0xff,0xd6,0xd2,0xff,0xfb,0xf1,0xff,0xff,0xd6,0xd6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf1,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf1,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xed
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xd6,0xff,0xff,0xff,0xff,0xd1,0xa4,0x84,0x84,0xad,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf5,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xfa,0xff,0xfb,0xe8,0xec,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xed,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xdb,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xed,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcd,0xad,0xad,0xa8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xcd,0xcc,0xad,0xad,0xcc,0xad,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xed
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xe8,0xf1,0xed,0xec,0xf1,0xec,0xec,0xf1,0xec,0xf1,0xec,0xe8,0xe8,0xec,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xed,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xec,0xf1,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd1,0xd2,0xd6,0xff,0xf6,0xec,0xe8,0xec,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xf6,0xff,0xf1,0xd1,0xfa,0xfa,0xff,0xf6,0xe8,0xe8,0xcc,0xd1,0xd6,0xff,0xda,0xd1,0xd1,0xfa,0xfb,0xd6,0xff,0xf5,0xe8,0xe8,0xf1,0xff,0xfa,0xf6,0xff,0xf5,0xff,0xff,0xd6,0xff,0xf1,0xe8,0xe8,0xcc,0xd2,0xd2,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd1,0xd6,0xd6,0xfb,0xf1,0xe8,0xe8,0xec,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xf6,0xff,0xf1,0xc8,0xcd,0xfb,0xff,0xf6,0xe8,0xe8,0xc8,0xc8,0xcd,0xff,0xd6,0xc8,0xcc,0xfa,0xfa,0xd1,0xff,0xf5,0xe8,0xe8,0xf1,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd6,0xff,0xf1,0xe8,0xe8,0xcc,0xd6,0xd6,0xdb,0xfb,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfb,0xff,0xad,0xa9,0xc8,0xcc,0xec,0xed,0xff,0xf6,0xec,0xec,0xec,0xfb,0xfa,0xf6,0xff,0xf1,0xec,0xd6,0xff,0xff,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xfa,0xf5,0xff,0xf5,0xec,0xec,0xf1,0xff,0xfa,0xf6,0xff,0xd1,0xa8,0xa8,0xd1,0xff,0xf1,0xe8,0xe8,0xed,0xff,0xd6,0xa9,0xa9,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xfb,0xdb,0xdb,0xd1,0xd6,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xd1,0xd6,0xd6,0xb1,0xda,0xd5,0xe8,0xe8,0xe8,0xe8,0xd1,0xfb,0xd1,0xe8,0xec,0xf6,0xfb,0xfb,0xfb,0xd5,0xf6,0xfb,0xfb,0xfb,0xd6,0xf1,0xfa,0xcd,0xc8,0xc8,0xd1,0xfb,0xf1,0xe8,0xe8,0xcc,0xfb,0xfb,0xfb,0xd6,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0xc8,0xa4,0xa4,0xa4,0xa4,0xa4,0xe8,0xe8,0xe8,0xe8,0xc8,0x84,0xa4,0xe8,0xc8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0xa4,0xc8,0xe8,0xe8,0xc8,0xa4,0xc8,0xe8,0xe8,0xc8,0x84,0x84,0x84,0xa4,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xed
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
-,0xcd,0xfa,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xed
-,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xcc
-,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
-
-
-};
-
-#define LEVEL_BTN_WIDTH 87
-#define LEVEL_BTN_HEIGHT 30
-const uint8_t Level_Corner[] = {
-
-0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
-,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xec,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xfa,0xfa,0xfa,0xf6,0xe8,0xf1,0xfa,0xfa,0xfa,0xfa,0xf5,0xe8,0xf1,0xfa,0xfa,0xfa,0xfa,0xf1,0xe8,0xf1,0xf6,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xf5,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xff,0xff,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xdb,0xff,0xff,0xfb,0xe8,0xf1,0xdb,0xdb,0xdb,0xff,0xfa,0xe8,0xf6,0xff,0xdb,0xfb,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xda,0xff,0xff,0xf1,0xe8,0xff,0xff,0xdb,0xff,0xff,0xec,0xe8,0xfa,0xdb,0xdb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xec,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xd1,0xfb,0xff,0xff,0xe8,0xc8,0xa8,0xa8,0xa8,0xff,0xfa,0xe8,0xf6,0xff,0xa8,0xa9,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xad,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xa8,0xd6,0xff,0xec,0xe8,0xa8,0xa8,0xad,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xfb,0xff,0xff,0xe8,0xf6,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xd1,0xff,0xff,0xf1,0xe8,0xff,0xff,0xd6,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xfa,0xfb,0xff,0xff,0xe8,0xf1,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xf6,0xff,0xff,0xf1,0xe8,0xff,0xff,0xf6,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xd6,0xff,0xff,0xff,0xff,0xff,0xe8,0xcc,0xd1,0xd1,0xd1,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xd1,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xf6,0xfb,0xff,0xec,0xe8,0xf1,0xf1,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xd6,0xff,0xff,0xff,0xff,0xff,0xe8,0xd1,0xd6,0xd6,0xd6,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xd1,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xfb,0xfb,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xfb,0xff,0xff,0xff,0xe8,0xf5,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xfb,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xd6,0xd6,0xad,0xd6,0xd6,0xd6,0xe8,0xd1,0xda,0xda,0xda,0xda,0xd6,0xe8,0xd1,0xda,0xec,0xec,0xda,0xd1,0xe8,0xd1,0xd6,0xd6,0xad,0xd6,0xd6,0xec,0xe8,0xd6,0xd6,0xd6,0xda,0xd6,0xec,0xe8,0xda,0xda,0xda,0xda,0xda,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xe8,0xc8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
-,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
-,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
-
-
-};
-
-const uint8_t Level_Hall[] = {
-
- 0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
-,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xf1,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xf5,0xe8,0xf1,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf5,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xdb,0xff,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf5,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xa8,0xd6,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xd1,0xda,0xff,0xec,0xe8,0xff,0xfb,0xd1,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf5,0xf6,0xf6,0xff,0xff,0xf1,0xe8,0xf6,0xf6,0xfa,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xc8,0xf6,0xff,0xec,0xe8,0xff,0xfa,0xc8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xe8,0xf6,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd6,0xd6,0xd6,0xd6,0xd6,0xd1,0xe8,0xd6,0xd6,0xd6,0xd6,0xd6,0xed,0xe8,0xd6,0xd6,0xe8,0xd1,0xd6,0xec,0xe8,0xda,0xd6,0xe8,0xd1,0xda,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xa8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
-,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
-,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
-
-
-};
-
-const uint8_t Level_Cache[] = {
-
-0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
-,0xcd,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xff,0xe8,0xe8,0xff,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xa8,0xa8,0xa8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xff,0xe8,0xe8,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xa8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
-,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
-,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
-
-
-};
-
-
-const uint8_t Level_Random[] = {
- 
-0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
-,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xd6,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xad,0xd1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf5,0xf6,0xf6,0xf6,0xf6,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xfb,0xd6,0xdb,0xff,0xff,0xf6,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xd1,0xa8,0xa8,0xfb,0xff,0xf6,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xf5,0xec,0xcc,0xd1,0xd2,0xcd,0xcc,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xfa,0xf6,0xec,0xa8,0xa4,0xc8,0xc8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xff,0xff,0xff,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xf6,0xf1,0xf6,0xfa,0xfa,0xfa,0xfa,0xf5,0xec,0xf1,0xfa,0xfa,0xfa,0xfa,0xf1,0xf1,0xfa,0xfa,0xfa,0xfa,0xfa,0xf1,0xf5,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xf6,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xd6,0xfb,0xff,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xf6,0xfb,0xff,0xff,0xff,0xff,0xfa,0xf1,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xa8,0xd6,0xff,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xfb,0xff,0xff,0xfb,0xfb,0xff,0xfb,0xf6,0xff,0xff,0xdb,0xfb,0xff,0xfa,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf5,0xfa,0xff,0xff,0xdb,0xff,0xff,0xf1,0xff,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xcd,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xd6,0xfb,0xff,0xd6,0xd6,0xff,0xfb,0xf6,0xff,0xff,0xd2,0xd6,0xff,0xfa,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf5,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf1,0xff,0xff,0xfa,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xb1,0xb1,0xcc,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xd6,0xfb,0xff,0xf6,0xd6,0xff,0xfb,0xf6,0xff,0xff,0xd1,0xf6,0xff,0xfa,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf5,0xfb,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xf5,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xfa,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xfb,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf5,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf1,0xd1,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xfb,0xff,0xff,0xfa,0xf6,0xff,0xff,0xfb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xfb,0xd1,0xff,0xff,0xf1,0xd6,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xd1,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xfb,0xf1,0xff,0xff,0xf1,0xfb,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xd1,0xd6,0xd6,0xd1,0xd6,0xd6,0xd1,0xd1,0xda,0xd6,0xd1,0xd6,0xda,0xda,0xda,0xda,0xd6,0xcc,0xd1,0xd6,0xda,0xda,0xda,0xd1,0xd1,0xd6,0xd6,0xd1,0xd6,0xd6,0xd1,0xd6,0xda,0xd6,0xd1,0xd6,0xd6,0xcd,0xd6,0xda,0xd6,0xd1,0xd6,0xd6,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf5,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xd1,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd1,0xcd,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
-,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
-,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xed
-,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
-
-};
-
-#define START_BTN_WIDTH 50
-#define START_BTN_HEIGHT 20
-const uint8_t Start[] = {
-0x09,0x0c,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x10,0x08,0x09
-,0x0c,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x08
-,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x79,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0xde,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x38,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x10,0x10,0x96,0xff,0xff,0xba,0x30,0x10,0x34,0xff,0xff,0xff,0x51,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x30,0xff,0xff,0xff,0x14,0x10,0x30,0xff,0xff,0xff,0x55,0x10,0x14,0x10,0x10,0x10,0x10,0x75,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xba,0x14,0x14,0x14,0xff,0xff,0xff,0x34,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xba,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x34,0x14,0x14,0x79,0xba,0xba,0xba,0xdb,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0x9a,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0x96,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xba,0x75,0x75,0x75,0x55,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0x75,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x30,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xba,0x75,0x75,0x75,0x55,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
-,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xdf,0xdf,0x9a,0x14,0x14,0x14,0xdf,0xdf,0xba,0x30,0xba,0xdf,0xdf,0x79,0x79,0xdf,0xdf,0xba,0x34,0xdf,0xdf,0xbe,0x14,0x14,0x14,0xdf,0xdf,0xdf,0x38,0x14,0x14,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x9a,0x14,0x14,0x14,0x14
-,0x10,0x14,0x14,0x14,0x14,0x14,0x10,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x14,0x14,0x14,0x14
-,0x0c,0x10,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x0c
-,0x0c,0x0c,0x10,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x0c,0x0c
-,0x09,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x09
-,0x09,0x09,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x09,0x09
-};
-const uint8_t Corner_Map[] = {
-
-0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x24,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x24,0x24,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x24,0x00,0x20,0x00,0x20,0x20,0x24,0x00,0x7c,0x7c,0x00,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x7c,0x24,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x20,0x7c,0x20,0x24,0x20,0x20,0x00,0x24,0x00,0x20,0x7c,0x7c,0x20,0x24,0x20,0x20,0x24,0x20,0x20,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x7c,0x7c,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x00,0x7c,0x7c,0x20,0x20,0x24,0x24,0x00,0x20,0x20,0x20,0x7c,0x24,0x00,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x20,0x00,0x24,0x24,0x24,0x24,0x7c,0x24,0x24,0x20,0x20,0x20,0x24,0x24,0x00,0x7c,0x7c,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x7c,0x7c,0x00,0x20,0x24,0x20,0x20,0x24,0x00,0x00,0x7c,0x7c,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x7c,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x7c,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x7c,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x24,0x7c,0x7c,0x20,0x24,0x00,0x20,0x24,0x24,0x00,0x00,0x7c,0x7c,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x7c,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x7c,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x24,0x7c,0x7c,0x24,0x00,0x00,0x20,0x24,0x00,0x00,0x00,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x7c,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x7c,0x7c,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x7c,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x24,0x00,0x20,0x20,0x20,0x24,0x00,0x7c,0x7c,0x20,0x00,0x20,0x24,0x24,0x00,0x00,0x00,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x20,0x7c,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x7c,0x7c,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x24,0x00,0x20,0x20,0x20,0x24,0x20,0x00,0x7c,0x7c,0x00,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x7c,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x7c,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x7c,0x7c,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x7c,0x7c,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x7c,0x7c,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x24,0x7c,0x7c,0x20,0x20,0x20,0x24,0x20,0x20,0x20,0x20,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7c,0x7c,0x00,0x24,0x20,0x20,0x00,0x20,0x24,0x20,0x7c,0x7c,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x20,0x24,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x20,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c
-,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c
-
-};
-const uint8_t Hall_Map[] = {
-0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c
-,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c
-};
-
-const uint8_t Cache_Map[] = {
-
-0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x00,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x00,0x20,0x00,0x20,0x20,0x24,0x00,0x20,0x20,0x00,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x24,0x20,0x20,0x24,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x24,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x20,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x24,0x20,0x00,0x20,0x24,0x20,0x20,0x24,0x00,0x00,0x20,0x00,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x24,0x20,0x00,0x20,0x24,0x00,0x20,0x24,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x00,0x00,0x20,0x24,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x20,0x00,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x24,0x00,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x24,0x00,0x00,0x20,0x20,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x00,0x20,0x24,0x20,0x20,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x24,0x24,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x00,0x24,0x24,0x20,0x20,0x00,0x24,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x20,0x24,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x24,0x20,0x00,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xe7,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7
-,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x24,0x00,0x00,0x00,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x00,0x00,0x24,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x20,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7
-,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7,0xe7
-
-};
-const uint8_t Reverse_Sprite[] = {
-
- 0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xe0,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xdb,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
-,0xdb,0xe0,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
-,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-
-
-
-};
-
-const uint8_t Mine_Sprite[] = {
-
-0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-,0xdb,0xdb,0x00,0xff,0xff,0xff,0x00,0xdb,0xdb
-,0xdb,0x00,0xff,0x92,0xdb,0x92,0xff,0x00,0xdb
-,0xdb,0xff,0x92,0x13,0x13,0x13,0x92,0xff,0xdb
-,0xdb,0xff,0xdb,0x13,0x07,0x13,0xdb,0xff,0xdb
-,0xdb,0xff,0x92,0x13,0x13,0x13,0x92,0xff,0xdb
-,0xdb,0x00,0xff,0x92,0xdb,0x92,0xff,0x00,0xdb
-,0xdb,0xdb,0x00,0xff,0xff,0xff,0x00,0xdb,0xdb
-,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-
-
-
-};
-const uint8_t Laser_Beam_Sprite[] = {
-	0xe0,0xFF,0xe0,
-	0xFF,0xFF,0xFF,
-	0xe0,0xFF,0xe0,
-};
-
-const uint8_t Laser_Sprite[] = {
-
-0x00,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0x00,0x00
-,0x00,0xdb,0xdb,0xf8,0xf8,0xf8,0xdb,0xdb,0x00
-,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
-,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
-,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
-,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
-,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
-,0xdb,0xdb,0xdb,0xf8,0xf8,0xf8,0xdb,0xdb,0x00
-,0x00,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0x00,0x00
-
-};
-
-const uint8_t Blades_Sprite[] = {
-
-0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-,0xdb,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0xdb
-,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
-,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
-,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
-,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
-,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
-,0xdb,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0xdb
-,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
-
-
-};
-const uint8_t Bullet_Sprite[] = {
-	0xFF, 0xFF,
-	0xFF, 0xFF,
-};
-const uint8_t Bullet_Explosion[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 
-  0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 
-  0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 
-};
-const uint8_t P1_0[] = {
-  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff, 0xff,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_1[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_2[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0xff, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0xff, 0x01,  
-
-};
-
-const uint8_t P1_3[] = {
- 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0xff, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_4[] = {
-
-  0x01, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0xff, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_5[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0xff, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-
-
-};
-
-const uint8_t P1_6[] = {
-  
-  0x01, 0x01, 0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x07, 0xff, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0xff, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
- 
- 
-
-};
-
-const uint8_t P1_7[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
- 
-};
-
-const uint8_t P1_8[] = {
- 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
-  0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_9[] = {
- 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_10[] = {
- 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0xff, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x07, 0xff, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_11[] = {
-
-  0x01, 0x01, 0xff, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_12[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0xff, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_13[] = {
-
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0xff, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01,  
- 
-};
-
-const uint8_t P1_14[] = {
- 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0xff, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0xff, 0x07, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-const uint8_t P1_15[] = {
-  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff,  
-  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,  
-  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x01, 0x01,  
-  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
-
-};
-
-
-#endif
+#ifndef IMAGES_H
+#define IMAGES_H
+#include <stdint.h>
+
+#define KILLS_BTN_WIDTH 75
+#define KILLS_BTN_HEIGHT 30
+const uint8_t Kill_1[] = {
+
+0xa8,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
+,0xcc,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xc8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xcd,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xd1,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xf6,0xff,0xff,0xd1,0xff,0xff,0xfb,0xd6,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xff,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xff,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xd1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xd1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xff,0xff,0xff,0xff,0xff,0xf1,0xa9,0xa9,0xa8,0xf1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xff,0xff,0xff,0xd1,0xfb,0xff,0xfa,0xf1,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf1,0xff,0xff,0xfb,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xfb,0xff,0xff,0xd1,0xff,0xff,0xfb,0xf6,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf1,0xff,0xff,0xff,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xff,0xff,0xa8,0xff,0xff,0xd1,0xff,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xf6,0xff,0xff,0xcd,0xff,0xff,0xd1,0xfb,0xff,0xff,0xff,0xff,0xff,0xcc,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xad,0xad,0xc8,0xad,0xad,0xc8,0xad,0xad,0xad,0xad,0xad,0xad,0xc8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xff,0xff,0xd6,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xec,0xed,0xf1,0xcc,0xf1,0xec,0xcc,0xf1,0xec,0xf1,0xf1,0xe8,0xe8,0xe8,0xed,0xf1,0xf1,0xf1,0xf1,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xc8,0xf1,0xf1,0xec,0xf1,0xcc,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xed,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xd1,0xff,0xf6,0xcd,0xd6,0xfa,0xff,0xff,0xe8,0xe8,0xc8,0xcd,0xb2,0xff,0xff,0xd1,0xcd,0xfa,0xff,0xd2,0xff,0xf6,0xe8,0xe8,0xc8,0xff,0xfa,0xf5,0xff,0xcd,0xff,0xff,0xd6,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xd6,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xed,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfb,0xf1,0xff,0xf6,0xc8,0xad,0xfb,0xff,0xff,0xe8,0xe8,0xe8,0xc8,0xa8,0xff,0xfa,0xc4,0xc8,0xfa,0xff,0xa8,0xff,0xf6,0xe8,0xe8,0xc8,0xff,0xfa,0xf5,0xff,0xcd,0xff,0xfb,0xd6,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xcd,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xec,0xec,0xec,0xfa,0xfa,0xd1,0xff,0xf6,0xcc,0xd6,0xfb,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xc8,0xff,0xfa,0xe8,0xc8,0xfa,0xff,0xcd,0xff,0xf6,0xec,0xec,0xcc,0xff,0xfa,0xf5,0xff,0xed,0xa8,0xa8,0xb1,0xff,0xf1,0xe8,0xe8,0xe8,0xf1,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xf6,0xd1,0xfa,0xad,0xda,0xfa,0xe8,0xe8,0xe8,0xe8,0xc8,0xfb,0xfa,0xe8,0xc8,0xf6,0xfb,0xfb,0xfb,0xf6,0xf5,0xfb,0xfb,0xff,0xf6,0xf1,0xfb,0xec,0xc8,0xc8,0xd1,0xfb,0xf1,0xe8,0xe8,0xcc,0xfb,0xff,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xc8,0x84,0xa4,0xa4,0xa4,0xc8,0xa4,0xa4,0xe8,0xe8,0xe8,0xe8,0xe8,0x84,0xa4,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa8,0x80,0xc8,0xe8,0xe8,0xc8,0x84,0xc8,0xe8,0xe8,0xc8,0x84,0x84,0x84,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
+,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xa8,0xcc,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xc8
+
+
+};
+
+const uint8_t Kill_3[] = {
+
+0xec,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf5,0xf6,0xec
+,0xed,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xec,0xfa,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xd6,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xd6,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xcd,0xd2,0xff,0xff,0xfb,0xd2,0xcc,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xc8,0xff,0xff,0xfa,0xf6,0xff,0xff,0xc8,0xff,0xff,0xf6,0xfa,0xff,0xff,0xda,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xd1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xc8,0xa4,0xff,0xff,0xf6,0xa4,0xc8,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xff,0xff,0xfa,0xf6,0xff,0xff,0xed,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xed,0xff,0xff,0xfa,0xa8,0xd6,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xad,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0x84,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xfb,0x84,0x84,0x84,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xff,0xff,0xff,0xff,0xfa,0xf6,0xff,0xff,0xd6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xcd,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xff,0xff,0xf6,0xe8,0xe8,0xff,0xff,0xfa,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xad,0xad,0xad,0xad,0xcd,0xcc,0xad,0xad,0xa8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xcc,0xad,0xad,0xcc,0xc8,0xa9,0xad,0xad,0xad,0xad,0xcd,0xcc,0xad,0xad,0xcc,0xad,0xad,0xcd,0xcc,0xad,0xad,0xc8,0xad,0xad,0xcc,0xe8,0xe8,0xad,0xad,0xcd,0xe8,0xe8,0xad,0xad,0xad,0xad,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xe8,0xed,0xec,0xec,0xed,0xec,0xec,0xec,0xec,0xed,0xec,0xe8,0xe8,0xec,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xed,0xec,0xec,0xf1,0xec,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd2,0xd2,0xd6,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xd1,0xfb,0xfa,0xff,0xf6,0xe8,0xe8,0xcc,0xd1,0xd6,0xff,0xfb,0xd2,0xd1,0xfa,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xfb,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xfb,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd2,0xd2,0xd6,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xc8,0xcd,0xff,0xff,0xf6,0xe8,0xe8,0xc8,0xc8,0xcd,0xff,0xd6,0xa4,0xcc,0xfa,0xfb,0xcd,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xfb,0xff,0xd6,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xfb,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xfb,0x89,0xa9,0xc8,0xc8,0xe8,0xec,0xff,0xf5,0xe8,0xe8,0xec,0xff,0xfa,0xf6,0xff,0xf1,0xec,0xf6,0xff,0xff,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xfb,0xf1,0xff,0xf6,0xe8,0xe8,0xec,0xff,0xfb,0xf1,0xff,0xf1,0xa8,0xa8,0xad,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xda,0xa9,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xfa,0xff,0xff,0xff,0xf5,0xf6,0xff,0xff,0xff,0xfa,0xf6,0xff,0xf1,0xfa,0xfb,0xd2,0xfb,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xff,0xff,0xff,0xfa,0xf5,0xff,0xff,0xff,0xfb,0xf1,0xff,0xf1,0xc8,0xc8,0xcc,0xff,0xf6,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0x80,0x80,0x80,0x80,0xc8,0x80,0x80,0x80,0x80,0xa4,0xa4,0x80,0x80,0x80,0xa4,0xa4,0x80,0xc8,0xa4,0x84,0xa4,0x84,0xa4,0xe8,0xe8,0xe8,0xe8,0xc8,0x80,0xa4,0xe8,0xc8,0xa4,0x80,0x80,0x80,0xa4,0xa4,0x80,0x80,0x80,0x84,0xc8,0x80,0xc8,0xe8,0xe8,0xc8,0x80,0xa4,0xe8,0xe8,0xe8,0x80,0x80,0x80,0x80,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xed,0xff,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8
+
+
+};
+
+const uint8_t Kill_5[] = {
+
+0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xcc
+,0xcd,0xff,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xff,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xdb,0xff,0xff,0xd5,0xd1,0xd2,0xd2,0xda,0xff,0xff,0xd1,0xd1,0xd2,0xd2,0xda,0xff,0xff,0xf5,0xff,0xff,0xfb,0xdb,0xff,0xfb,0xf1,0xff,0xff,0xfb,0xfb,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xfa,0xd2,0xff,0xff,0xd5,0xd1,0xd2,0xd2,0xd6,0xff,0xff,0xd1,0xd1,0xd2,0xad,0xd1,0xff,0xff,0xf5,0xff,0xff,0xd6,0xd2,0xff,0xfb,0xf1,0xff,0xff,0xd6,0xd6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf1,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf1,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xf6,0xff,0xfb,0xe8,0xec,0xf5,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xed
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xd6,0xff,0xff,0xff,0xff,0xd1,0xa4,0x84,0x84,0xad,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf5,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xf6,0xfa,0xff,0xfb,0xe8,0xec,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xed,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xff,0xff,0xdb,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf6,0xfa,0xff,0xff,0xff,0xff,0xff,0xf5,0xff,0xff,0xfa,0xf6,0xff,0xfb,0xf1,0xff,0xff,0xff,0xff,0xff,0xfb,0xed,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcd,0xad,0xad,0xa8,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xcd,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xcd,0xcc,0xad,0xad,0xcc,0xad,0xad,0xad,0xad,0xad,0xad,0xcc,0xad,0xad,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xed
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xe8,0xe8,0xe8,0xf1,0xed,0xec,0xf1,0xec,0xec,0xf1,0xec,0xf1,0xec,0xe8,0xe8,0xec,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xed,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xec,0xec,0xf1,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xec,0xf1,0xf1,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd1,0xd2,0xd6,0xff,0xf6,0xec,0xe8,0xec,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xf6,0xff,0xf1,0xd1,0xfa,0xfa,0xff,0xf6,0xe8,0xe8,0xcc,0xd1,0xd6,0xff,0xda,0xd1,0xd1,0xfa,0xfb,0xd6,0xff,0xf5,0xe8,0xe8,0xf1,0xff,0xfa,0xf6,0xff,0xf5,0xff,0xff,0xd6,0xff,0xf1,0xe8,0xe8,0xcc,0xd2,0xd2,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd1,0xd6,0xd6,0xfb,0xf1,0xe8,0xe8,0xec,0xfb,0xf6,0xec,0xe8,0xec,0xfa,0xfa,0xf6,0xff,0xf1,0xc8,0xcd,0xfb,0xff,0xf6,0xe8,0xe8,0xc8,0xc8,0xcd,0xff,0xd6,0xc8,0xcc,0xfa,0xfa,0xd1,0xff,0xf5,0xe8,0xe8,0xf1,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd6,0xff,0xf1,0xe8,0xe8,0xcc,0xd6,0xd6,0xdb,0xfb,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfb,0xff,0xad,0xa9,0xc8,0xcc,0xec,0xed,0xff,0xf6,0xec,0xec,0xec,0xfb,0xfa,0xf6,0xff,0xf1,0xec,0xd6,0xff,0xff,0xf6,0xe8,0xe8,0xe8,0xe8,0xf1,0xff,0xf6,0xe8,0xec,0xfa,0xfa,0xf5,0xff,0xf5,0xec,0xec,0xf1,0xff,0xfa,0xf6,0xff,0xd1,0xa8,0xa8,0xd1,0xff,0xf1,0xe8,0xe8,0xed,0xff,0xd6,0xa9,0xa9,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xfb,0xdb,0xdb,0xd1,0xd6,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xfb,0xfb,0xf6,0xd1,0xfb,0xd1,0xd6,0xd6,0xb1,0xda,0xd5,0xe8,0xe8,0xe8,0xe8,0xd1,0xfb,0xd1,0xe8,0xec,0xf6,0xfb,0xfb,0xfb,0xd5,0xf6,0xfb,0xfb,0xfb,0xd6,0xf1,0xfa,0xcd,0xc8,0xc8,0xd1,0xfb,0xf1,0xe8,0xe8,0xcc,0xfb,0xfb,0xfb,0xd6,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0xc8,0xa4,0xa4,0xa4,0xa4,0xa4,0xe8,0xe8,0xe8,0xe8,0xc8,0x84,0xa4,0xe8,0xc8,0xa4,0x84,0x84,0x84,0xa4,0xa4,0x84,0x84,0x84,0xa4,0xa4,0xa4,0xc8,0xe8,0xe8,0xc8,0xa4,0xc8,0xe8,0xe8,0xc8,0x84,0x84,0x84,0xa4,0xc8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xed
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xf1
+,0xcd,0xfa,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xed
+,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xcc
+,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
+
+
+};
+
+#define LEVEL_BTN_WIDTH 87
+#define LEVEL_BTN_HEIGHT 30
+const uint8_t Level_Corner[] = {
+
+0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
+,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xec,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xfa,0xfa,0xfa,0xf6,0xe8,0xf1,0xfa,0xfa,0xfa,0xfa,0xf5,0xe8,0xf1,0xfa,0xfa,0xfa,0xfa,0xf1,0xe8,0xf1,0xf6,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xff,0xfb,0xe8,0xf5,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xff,0xff,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xdb,0xff,0xff,0xfb,0xe8,0xf1,0xdb,0xdb,0xdb,0xff,0xfa,0xe8,0xf6,0xff,0xdb,0xfb,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xda,0xff,0xff,0xf1,0xe8,0xff,0xff,0xdb,0xff,0xff,0xec,0xe8,0xfa,0xdb,0xdb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xf1,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xec,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xd1,0xfb,0xff,0xff,0xe8,0xc8,0xa8,0xa8,0xa8,0xff,0xfa,0xe8,0xf6,0xff,0xa8,0xa9,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xad,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xa8,0xd6,0xff,0xec,0xe8,0xa8,0xa8,0xad,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xfb,0xff,0xff,0xe8,0xf6,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xd1,0xff,0xff,0xf1,0xe8,0xff,0xff,0xd6,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xfa,0xfb,0xff,0xff,0xe8,0xf1,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xf6,0xff,0xff,0xf1,0xe8,0xff,0xff,0xf6,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf6,0xf1,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xd6,0xff,0xff,0xff,0xff,0xff,0xe8,0xcc,0xd1,0xd1,0xd1,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xd1,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xf6,0xfb,0xff,0xec,0xe8,0xf1,0xf1,0xf1,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xd6,0xff,0xff,0xff,0xff,0xff,0xe8,0xd1,0xd6,0xd6,0xd6,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xd1,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xfb,0xfb,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xfb,0xff,0xff,0xff,0xe8,0xf5,0xff,0xff,0xff,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xec,0xff,0xf6,0xe8,0xf6,0xff,0xff,0xfb,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xd6,0xd6,0xad,0xd6,0xd6,0xd6,0xe8,0xd1,0xda,0xda,0xda,0xda,0xd6,0xe8,0xd1,0xda,0xec,0xec,0xda,0xd1,0xe8,0xd1,0xd6,0xd6,0xad,0xd6,0xd6,0xec,0xe8,0xd6,0xd6,0xd6,0xda,0xd6,0xec,0xe8,0xda,0xda,0xda,0xda,0xda,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xe8,0xc8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
+,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
+,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
+
+
+};
+
+const uint8_t Level_Hall[] = {
+
+ 0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
+,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xf1,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xfa,0xf5,0xe8,0xf1,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf5,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xdb,0xff,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf5,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xa8,0xd6,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xe8,0xe8,0xe8,0xe8,0xe8,0xf1,0xf6,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xff,0xf1,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xf1,0xe8,0xff,0xff,0xd1,0xda,0xff,0xec,0xe8,0xff,0xfb,0xd1,0xfb,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xf5,0xf6,0xf6,0xff,0xff,0xf1,0xe8,0xf6,0xf6,0xfa,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xc8,0xf6,0xff,0xec,0xe8,0xff,0xfa,0xc8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfb,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xff,0xff,0xff,0xff,0xf1,0xe8,0xff,0xfb,0xe8,0xf6,0xff,0xec,0xe8,0xff,0xfa,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xd6,0xd6,0xd6,0xd6,0xd6,0xd1,0xe8,0xd6,0xd6,0xd6,0xd6,0xd6,0xed,0xe8,0xd6,0xd6,0xe8,0xd1,0xd6,0xec,0xe8,0xda,0xd6,0xe8,0xd1,0xda,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xa8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xa8,0xa8,0xe8,0xc8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
+,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
+,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
+
+
+};
+
+const uint8_t Level_Cache[] = {
+
+0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
+,0xcd,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xff,0xe8,0xe8,0xff,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xd2,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xa8,0xa8,0xa8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xe8,0xe8,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xff,0xff,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xff,0xe8,0xe8,0xff,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xfa,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xa8,0xa8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xfb,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
+,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xf1
+,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
+
+
+};
+
+
+const uint8_t Level_Random[] = {
+ 
+0xcc,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xec
+,0xcc,0xfb,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xff,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf6,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xd6,0xa8,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0xad,0xd1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xfb,0xf6,0xd1,0xd6,0xd6,0xff,0xfa,0xf6,0xff,0xf1,0xfb,0xfb,0xd1,0xd6,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xfb,0xf6,0xcd,0xad,0xad,0xfb,0xfa,0xf6,0xff,0xf1,0xfb,0xff,0xcd,0xad,0xad,0xfb,0xff,0xec,0xe8,0xe8,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf5,0xf6,0xf6,0xf6,0xf6,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xf1,0xfb,0xf6,0xd1,0xd2,0xb2,0xff,0xfa,0xcd,0xd6,0xd1,0xfb,0xff,0xcd,0xd1,0xb2,0xfb,0xff,0xec,0xec,0xec,0xf6,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xff,0xff,0xff,0xff,0xff,0xff,0xf5,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xd1,0xd1,0xd6,0xda,0xd1,0xcd,0xb1,0xb2,0xd6,0xf6,0xc8,0xa8,0xd1,0xda,0xf6,0xcd,0xb1,0xb1,0xd6,0xfb,0xcc,0xd1,0xd1,0xd6,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xfb,0xd6,0xdb,0xff,0xff,0xf6,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xd1,0xa8,0xa8,0xfb,0xff,0xf6,0xec,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xf5,0xec,0xcc,0xd1,0xd2,0xcd,0xcc,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xed,0xff,0xff,0xfa,0xf6,0xec,0xa8,0xa4,0xc8,0xc8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xec,0xec,0xec,0xec,0xec,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xec,0xfa,0xff,0xff,0xff,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xf6,0xf1,0xf6,0xfa,0xfa,0xfa,0xfa,0xf5,0xec,0xf1,0xfa,0xfa,0xfa,0xfa,0xf1,0xf1,0xfa,0xfa,0xfa,0xfa,0xfa,0xf1,0xf5,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xf6,0xfa,0xfa,0xfa,0xfa,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xd6,0xfb,0xff,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xf6,0xfb,0xff,0xff,0xff,0xff,0xfa,0xf1,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xa8,0xd6,0xff,0xff,0xf1,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xfb,0xff,0xff,0xfb,0xfb,0xff,0xfb,0xf6,0xff,0xff,0xdb,0xfb,0xff,0xfa,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xdb,0xff,0xff,0xf5,0xfa,0xff,0xff,0xdb,0xff,0xff,0xf1,0xff,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xcd,0xd2,0xd2,0xcc,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xd6,0xfb,0xff,0xd6,0xd6,0xff,0xfb,0xf6,0xff,0xff,0xd2,0xd6,0xff,0xfa,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf5,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf1,0xff,0xff,0xfa,0xd6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xcd,0xb1,0xb1,0xcc,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xd6,0xfb,0xff,0xf6,0xd6,0xff,0xfb,0xf6,0xff,0xff,0xd1,0xf6,0xff,0xfa,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xd1,0xfb,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xff,0xff,0xfa,0xf6,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf5,0xfb,0xfb,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xf5,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf1,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xff,0xff,0xff,0xff,0xf1,0xfb,0xff,0xff,0xfa,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xfb,0xfa,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xf6,0xfa,0xff,0xfa,0xf6,0xff,0xff,0xf5,0xfb,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xff,0xd6,0xff,0xff,0xf1,0xd1,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xad,0xad,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xff,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xfb,0xff,0xff,0xfa,0xf6,0xff,0xff,0xfb,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xfb,0xd1,0xff,0xff,0xf1,0xd6,0xff,0xff,0xff,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf6,0xff,0xfb,0xf6,0xfb,0xff,0xf6,0xf6,0xff,0xfb,0xf6,0xff,0xff,0xff,0xff,0xff,0xfa,0xd1,0xfb,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf1,0xff,0xff,0xf5,0xfa,0xff,0xfb,0xf1,0xff,0xff,0xf1,0xfb,0xff,0xff,0xfb,0xff,0xff,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xf6,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xec,0xf1,0xf1,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xcc,0xd1,0xd6,0xd6,0xd1,0xd6,0xd6,0xd1,0xd1,0xda,0xd6,0xd1,0xd6,0xda,0xda,0xda,0xda,0xd6,0xcc,0xd1,0xd6,0xda,0xda,0xda,0xd1,0xd1,0xd6,0xd6,0xd1,0xd6,0xd6,0xd1,0xd6,0xda,0xd6,0xd1,0xd6,0xd6,0xcd,0xd6,0xda,0xd6,0xd1,0xd6,0xd6,0xec,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xfa,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf1,0xf5,0xf5,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xa8,0xa8,0xc8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xa8,0xa8,0xa8,0xc8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xec,0xd1,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd1,0xcd,0xec,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xc8,0xc8,0xc8,0xc8,0xc8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcd,0xfa,0xec,0xe8,0xe8,0xe8,0xc8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xc8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xe8,0xfa,0xf1
+,0xcc,0xfa,0xec,0xec,0xec,0xec,0xec,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xfa,0xf1
+,0xcc,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfa,0xfb,0xed
+,0xa8,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xa8
+
+};
+
+#define START_BTN_WIDTH 50
+#define START_BTN_HEIGHT 20
+const uint8_t Start[] = {
+0x09,0x0c,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x10,0x08,0x09
+,0x0c,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x08
+,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x79,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0xde,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x38,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0xbe,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x10,0x10,0x96,0xff,0xff,0xba,0x30,0x10,0x34,0xff,0xff,0xff,0x51,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x30,0xff,0xff,0xff,0x14,0x10,0x30,0xff,0xff,0xff,0x55,0x10,0x14,0x10,0x10,0x10,0x10,0x75,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xba,0x14,0x14,0x14,0xff,0xff,0xff,0x34,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xba,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x34,0x14,0x14,0x79,0xba,0xba,0xba,0xdb,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0xdf,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0x9a,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xff,0x96,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xba,0x75,0x75,0x75,0x55,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0x75,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x30,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xba,0x75,0x75,0x75,0x55,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xff,0xff,0xbe,0x14,0x14,0x14,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0x79,0x9a,0xff,0xff,0xdf,0x34,0xff,0xff,0xff,0x14,0x14,0x14,0xff,0xff,0xff,0x38,0x14,0x14,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x14,0x14,0x14,0x14
+,0x14,0x14,0x14,0x14,0x14,0x14,0x79,0xdf,0xdf,0x9a,0x14,0x14,0x14,0xdf,0xdf,0xba,0x30,0xba,0xdf,0xdf,0x79,0x79,0xdf,0xdf,0xba,0x34,0xdf,0xdf,0xbe,0x14,0x14,0x14,0xdf,0xdf,0xdf,0x38,0x14,0x14,0x79,0xdf,0xdf,0xdf,0xdf,0xdf,0xdf,0x9a,0x14,0x14,0x14,0x14
+,0x10,0x14,0x14,0x14,0x14,0x14,0x10,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x14,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x14,0x14,0x14,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x14,0x14,0x14,0x14
+,0x0c,0x10,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x0c
+,0x0c,0x0c,0x10,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x14,0x0c,0x0c
+,0x09,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x09
+,0x09,0x09,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x09,0x09
+};
+const uint8_t Reverse_Sprite[] = {
+
+ 0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xe0,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xdb,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
+,0xdb,0xe0,0xe0,0xe0,0xdb,0xe0,0xe0,0xe0,0xdb
+,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+
+
+
+};
+
+const uint8_t Mine_Sprite[] = {
+
+0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+,0xdb,0xdb,0x00,0xff,0xff,0xff,0x00,0xdb,0xdb
+,0xdb,0x00,0xff,0x92,0xdb,0x92,0xff,0x00,0xdb
+,0xdb,0xff,0x92,0x13,0x13,0x13,0x92,0xff,0xdb
+,0xdb,0xff,0xdb,0x13,0x07,0x13,0xdb,0xff,0xdb
+,0xdb,0xff,0x92,0x13,0x13,0x13,0x92,0xff,0xdb
+,0xdb,0x00,0xff,0x92,0xdb,0x92,0xff,0x00,0xdb
+,0xdb,0xdb,0x00,0xff,0xff,0xff,0x00,0xdb,0xdb
+,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+
+
+
+};
+const uint8_t Laser_Beam_Sprite[] = {
+	0xe0,0xFF,0xe0,
+	0xFF,0xFF,0xFF,
+	0xe0,0xFF,0xe0,
+};
+
+const uint8_t Laser_Sprite[] = {
+
+0x00,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0x00,0x00
+,0x00,0xdb,0xdb,0xf8,0xf8,0xf8,0xdb,0xdb,0x00
+,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
+,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
+,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
+,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
+,0xdb,0x00,0xf8,0xec,0xe0,0xec,0xf8,0x00,0xdb
+,0xdb,0xdb,0xdb,0xf8,0xf8,0xf8,0xdb,0xdb,0x00
+,0x00,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0x00,0x00
+
+};
+
+const uint8_t Blades_Sprite[] = {
+
+0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+,0xdb,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0xdb
+,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
+,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
+,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
+,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
+,0xdb,0x1c,0xbe,0x1c,0x00,0x1c,0xbe,0x1c,0xdb
+,0xdb,0x00,0x1c,0x00,0x00,0x00,0x1c,0x00,0xdb
+,0x00,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x00
+
+
+};
+const uint8_t Bullet_Sprite[] = {
+	0xFF, 0xFF,
+	0xFF, 0xFF,
+};
+const uint8_t Bullet_Explosion[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 
+  0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 
+  0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+  0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+  0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 
+  0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 0x01, 0xff, 0x01, 
+  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01, 
+};
+const uint8_t P1_0[] = {
+  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff, 0xff,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_1[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_2[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0xff, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0xff, 0x01,  
+
+};
+
+const uint8_t P1_3[] = {
+ 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0xff, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_4[] = {
+
+  0x01, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0xff, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_5[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0xff, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+
+
+};
+
+const uint8_t P1_6[] = {
+  
+  0x01, 0x01, 0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x07, 0xff, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0xff, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+ 
+ 
+
+};
+
+const uint8_t P1_7[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+ 
+};
+
+const uint8_t P1_8[] = {
+ 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
+  0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_9[] = {
+ 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_10[] = {
+ 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0xff, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x07, 0xff, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_11[] = {
+
+  0x01, 0x01, 0xff, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x01, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_12[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0xff, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0xff, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x01, 0xF0, 0xF0, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_13[] = {
+
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0xff, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01,  
+ 
+};
+
+const uint8_t P1_14[] = {
+ 
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0xff, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x07, 0xff, 0x07, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+const uint8_t P1_15[] = {
+  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xff,  
+  0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,  
+  0x01, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x01, 0x01,  
+  0x01, 0x01, 0xF0, 0xF0, 0x07, 0x07, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01,  
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  
+
+};
+
+
+#endif
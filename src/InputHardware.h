@@ -1,9 +1,9 @@
-#ifndef INPUTHARDWARE_H
-#define INPUTHARDWARE_H
-#include <stdint.h>
-
-void Port_Init(void);
-void SysTick_Init(void);
-void EdgeCounter_Init(void);
-
-#endif
+#ifndef INPUTHARDWARE_H
+#define INPUTHARDWARE_H
+#include <stdint.h>
+
+void Port_Init(void);
+void SysTick_Init(void);
+void EdgeCounter_Init(void);
+
+#endif
@@ -40,11 +40,12 @@ SSI_SR_TNF              EQU   0x00000002  ; SSI Transmit FIFO Not Full
 ; that is actually being transmitted.
 ; The write command operation waits until all data has been
 ; sent, configures the Data/Command pin for commands, sends
-; the command, and then waits for the transmission to
-; finish.
+; the command, waits for the transmission to finish, and
+; leaves the Data/Command pin set for data.
 ; The write data operation waits until there is room in the
-; transmit FIFO, configures the Data/Command pin for data,
-; and then adds the data to the transmit FIFO.
+; transmit FIFO and then adds the data to the transmit FIFO.
+; Data always follows a command, so the Data/Command pin only
+; changes once per command and data run.
 ; NOTE: These functions will crash or stall indefinitely if
 ; the SSI0 module is not initialized and enabled.
 
@@ -59,6 +60,7 @@ writecommand
 ;4) Write the command to SSI0_DR_R
 ;5) Read SSI0_SR_R and check bit 4, 
 ;6) If bit 4 is high, loop back to step 5 (wait for BUSY bit to be low)
+;7) Set D/C=PA6 to one for the data that follows
 	
 	LDR R1, =SSI0_SR_R	 		;read SSI0_SR_R bit 4
 loop	
@@ -67,9 +69,8 @@ loop
 	CMP R2, #SSI_SR_BSY
 	BEQ loop					;loop if SSI0_SR_R bit 4 is high
 	
-	LDR	R2, =DC					;clear D/C PA6
-	LDR R3, [R2]
-	BIC R3, #0x40
+	LDR	R2, =DC					;clear D/C PA6, the address only reaches PA6
+	MOV R3, #0
 	STR R3, [R2]
 	
 	LDR R2, =SSI0_DR_R			;write command to SSI0_DR_R
@@ -80,6 +81,10 @@ loop2
 	AND	R2, #SSI_SR_BSY
 	CMP R2, #SSI_SR_BSY
 	BEQ loop2					;loop if SSI0_SR_R bit 4 is high
+	
+	LDR	R2, =DC					;set D/C PA6 for the data that follows
+	MOV R3, #0x40
+	STR R3, [R2]
 
     BX  LR                          ;   return
 
@@ -90,8 +95,7 @@ loop2
 writedata
 ;1) Read SSI0_SR_R and check bit 1, 
 ;2) If bit 1 is low loop back to step 1 (wait for TNF bit to be high)
-;3) Set D/C=PA6 to one
-;4) Write the 8-bit data to SSI0_DR_R
+;3) Write the 8-bit data to SSI0_DR_R, D/C=PA6 is already one
 	
 	LDR R1, =SSI0_SR_R			;Read SSI0_SR_R and check bit 1
 loop3	
@@ -100,11 +104,6 @@ loop3
 	CMP	R2, #0x00
 	BEQ loop3					;If bit 1 is low loop back to step 1
 	
-	LDR R1, =DC					;Set D/C=PA6 to one
-	LDR R2, [R1]
-	ORR R2, #0x40
-	STR	R2, [R1]
-	
 	LDR R1, =SSI0_DR_R			;Write the 8-bit data to SSI0_DR_R
 	STR R0, [R1]
     
@@ -1,271 +1,911 @@
-// File: LCDBuffer.c
-// Name: Brian Cheung and Sam Wang
-// Date: 5/4/18
-// Desc: This software writes to the screen buffer array
-// Usage: Draw game objects and animations
-
-#include "LCDBuffer.h"
-#include "AstroParty.h"
-#include "ST7735.h"
-#include "math.h"
-#include "GamePhysics.h"
-
-#define HEIGHT 160
-#define WIDTH 128
-
-//fill screen buffer array with black
-void clear(void){
-	for(uint16_t i=0; i<20; i++){
-		screenBuffer[i] = ST7735_BLACK;
-	}
-}
-
-//draw image
-void draw(int16_t x, int16_t y, const uint8_t *image, uint8_t w, uint8_t h){
-	
-	int16_t ogWidth = w, ogHeight = h;
-	uint16_t startR = 0, skipC = 0;
-	if(x>=WIDTH || (y-h+1)>=HEIGHT || (x+w)<=0 || y<0) return; //image is totally off the screen, do nothing
-	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
-	
-	if((x+w-1)>=WIDTH){             //image exceeds right of screen
-	  w = WIDTH-x;
-	}
-	if((y-h+1)<0){                  //image exceeds top of screen
-	  h = y+1;
-	}
-	if(x<0){                        //image exceeds left of screen
-		w = w+x;
-		skipC = -x;
-		x = 0;
-	}
-	if(y>=HEIGHT){                  //image exceeds bottom of screen
-		startR = ogHeight - (h-(y-HEIGHT+1));
-	    y = HEIGHT-1;
-	}
-
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)y-1))+x;				//calculate corresponding screenBuffer coordinate of bottom left corner of image
-	for(uint8_t r=startR; r<h; r++){											
-		for(uint8_t c=0; c<w; c++){
-			if(image[r*ogWidth+c+skipC]!=1){												//if not special pixel
-				screenBuffer[sbPixel+c] = image[r*ogWidth+c+skipC];		//draw corresponding sprite pixel onto screenBuffer
-			} else {																		//else draw background
-				if(stage == Game){
-					screenBuffer[sbPixel+c] = game.map[sbPixel+c];
-				} else {
-					screenBuffer[sbPixel+c] = 0x00;
-				}
-			}
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-//draw rectangle
-void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
-	int16_t ogWidth = w, ogHeight = h;
-  
-	if(x>=WIDTH || (y-h+1)>=HEIGHT || (x+w)<=0 || y<0) return; //image is totally off the screen, do nothing
-	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
-	
-	if((x+w-1)>=WIDTH){             //image exceeds right of screen
-	  w = WIDTH-x;
-	}
-	if((y-h+1)<0){                  //image exceeds top of screen
-	  h = y+1;
-	}
-	if(x<0){                        //image exceeds left of screen
-	  w = w+x;
-	  x = 0;
-	}
-	if(y>=HEIGHT){                  //image exceeds bottom of screen
-	    h = h-(y-HEIGHT+1);
-	    y = HEIGHT-1;
-  	}
-	
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)y-1))+x;		//calculate corresponding screenBuffer coordinate of bottom left corner of rect
-	for(uint8_t r=0; r<h; r++){											
-		for(uint8_t c=0; c<w; c++){
-			if(r==0 || r==ogHeight-1 || c==0 || c==ogWidth-1){	//if edge 
-				screenBuffer[sbPixel+c] = color;		//draw corresponding sprite pixel onto screenBuffer
-			} else {																		//else draw background
-				screenBuffer[sbPixel+c] = game.map[sbPixel+c];
-			}
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-//draw filled rectangle
-void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {  
-	if(x>=WIDTH || (y-h+1)>=HEIGHT || (x+w)<=0 || y<0) return; //image is totally off the screen, do nothing
-	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
-	
-	if((x+w-1)>=WIDTH){             //image exceeds right of screen
-	  w = WIDTH-x;
-	}
-	if((y-h+1)<0){                  //image exceeds top of screen
-	  h = y+1;
-	}
-	if(x<0){                        //image exceeds left of screen
-	  w = w+x;
-	  x = 0;
-	}
-	if(y>=HEIGHT){                  //image exceeds bottom of screen
-	    h = h-(y-HEIGHT+1);
-	    y = HEIGHT-1;
-	}
-	
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)y-1))+x;	//calculate corresponding screenBuffer coordinate of bottom left corner of rect
-	for(uint8_t r=0; r<h; r++){											
-		for(uint8_t c=0; c<w; c++){
-				screenBuffer[sbPixel+c] = color;		//draw corresponding color onto screenBuffer
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-//fill rectangle with background
-void eraseRect(int16_t x, int16_t y, uint8_t w, uint8_t h) {
-	if(x>=WIDTH || (y-h+1)>=HEIGHT || (x+w)<=0 || y<0) return; //image is totally off the screen, do nothing
-	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
-	
-	if((x+w-1)>=WIDTH){             //image exceeds right of screen
-	  w = WIDTH-x;
-	}
-	if((y-h+1)<0){                  //image exceeds top of screen
-	  h = y+1;
-	}
-	if(x<0){                        //image exceeds left of screen
-	  w = w+x;
-	  x = 0;
-	}
-	if(y>=HEIGHT){                  //image exceeds bottom of screen
-	    h = h-(y-HEIGHT+1);
-	    y = HEIGHT-1;
-	}
-	
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)y-1))+x;				//calculate corresponding screenBuffer coordinate of bottom left corner of region
-	for(uint8_t r=0; r<h; r++){											
-		for(uint8_t c=0; c<w; c++){
-				screenBuffer[sbPixel+c] = game.map[sbPixel+c];
-			}
-			sbPixel += WIDTH;															//next row
-		}
-}
-
-void drawPlayer(Player *player){	
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)player->y-1))+player->x;				//calculate corresponding screenBuffer coordinate of bottom left corner of player
-	for(uint8_t r=0; r<PLAYER_HEIGHT; r++){											
-		for(uint8_t c=0; c<PLAYER_WIDTH; c++){
-			if(player->sprites[player->dir][r*PLAYER_WIDTH+c]!=1){//if not transparent pixel
-				if(player->sprites[player->dir][r*PLAYER_WIDTH+c]==0x07){
-					screenBuffer[sbPixel+c] = player->color;		//draw player color onto screenBuffer
-				} else {
-					screenBuffer[sbPixel+c] = player->sprites[player->dir][r*PLAYER_WIDTH+c];		//draw corresponding sprite pixel onto screenBuffer
-				}
-			} else {																		//else draw background
-				if(player->powerUp == Blades && blades.displayed == 1 && (r==0 || r==PLAYER_HEIGHT-1 || c==0 || c==PLAYER_WIDTH-1)){
-					screenBuffer[sbPixel+c] = 0x1c;
-				} else {
-					screenBuffer[sbPixel+c] = game.map[sbPixel+c];
-				}
-			}
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-void drawBulletExplosion(Bullet *bullet){
-	bullet->active = 0;
-	bullet->destroyed = 1;
-	draw(bullet->expX,bullet->expY, bullet->bulletExp, BULLET_EXP_W, BULLET_EXP_H);
-}
-
-void drawBullet(Bullet *bullet){
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)bullet->y-1))+bullet->x;				//calculate corresponding screenBuffer coordinate of bottom left corner of bullet
-	for(uint8_t r=0; r<BULLET_HEIGHT; r++){											
-		for(uint8_t c=0; c<BULLET_WIDTH; c++){
-			screenBuffer[sbPixel+c] = bullet->bulletSprite[r*BULLET_WIDTH+c];
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-void drawLaser(double x, double y, uint8_t w, uint8_t h){
-	uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)y-1))+x;				//calculate corresponding screenBuffer coordinate of bottom left corner of bullet
-	for(uint8_t r=0; r<h; r++){											
-		for(uint8_t c=0; c<w; c++){
-			screenBuffer[sbPixel+c] = laserBeam.sprite[r*LASER_WIDTH+c];
-		}
-		sbPixel += WIDTH;															//next row
-	}
-}
-
-//fill laser with background
-void eraseLaser(void){		
-	laserBeam.displayed = 0;
-	while((fabs(laserBeam.startX-laserBeam.stopX)>1 || 
-		fabs(laserBeam.startY-laserBeam.stopY)>1) && (laserBeam.startX < WIDTH && laserBeam.startX > 0 && laserBeam.startY > 0 && laserBeam.startY < HEIGHT)){
-		eraseRect(laserBeam.startX,laserBeam.startY,LASER_WIDTH,LASER_HEIGHT);
-		if(fabs(laserBeam.startX-laserBeam.stopX) > 1){	
-				laserBeam.startX += laserBeam.dx;
-				} 
-		if(fabs(laserBeam.startY-laserBeam.stopY) > 1) {
-			laserBeam.startY += laserBeam.dy;
-		}
-	}
-}
-
-//draw active walls
-void drawWalls(void){
-	for(uint8_t i=0; i<WALLS_N; i++){
-		if(game.walls[i].active){
-				if(!game.walls[i].destroyed){		//if wall has not been destroyed
-					game.walls[i].displayed = 1;
-					uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)game.walls[i].y-1))+game.walls[i].x;				//calculate corresponding screenBuffer coordinate of bottom left corner of rect
-					for(uint8_t r=0; r<WALL_SIZE; r++){											
-						for(uint8_t c=0; c<WALL_SIZE; c++){
-							if(r==0 || r==WALL_SIZE-1 || c==0 || c==WALL_SIZE-1){					//if not special pixel
-								screenBuffer[sbPixel+c] = game.walls[i].colors[(r+c)%2];		//draw corresponding sprite pixel onto screenBuffer
-							} else {																		//else draw background
-								screenBuffer[sbPixel+c] = game.map[sbPixel+c];
-							}
-						}
-						sbPixel += WIDTH;															//next row
-					}
-				} 
-				else if(game.walls[i].destroyed && game.walls[i].displayed){		//if wall has been destroyed, but is still displayed, erase it
-					game.walls[i].displayed = 0;
-					eraseRect(game.walls[i].x,game.walls[i].y,WALL_SIZE,WALL_SIZE);
-					particleGenerate(game.walls[i].x +WALL_SIZE/2,game.walls[i].y-WALL_SIZE/2);
-				}
-		}
-	}
-}
-
-//draw active powerups
-void drawPowerUps(void){
-	for(uint8_t i=0; i<POWERUPS_N; i++){
-		if(game.powerUps[i].active){
-				game.powerUps[i].displayed = 1;
-				uint16_t sbPixel=(WIDTH*(HEIGHT-(int16_t)game.powerUps[i].y-1))+game.powerUps[i].x;				//calculate corresponding screenBuffer coordinate of bottom left corner of rect
-				for(uint8_t r=0; r<POWERUP_WIDTH; r++){											
-					for(uint8_t c=0; c<POWERUP_HEIGHT; c++){
-							screenBuffer[sbPixel+c] = game.powerUps[i].sprite[r*POWERUP_WIDTH+c];
-					}
-					sbPixel += WIDTH;															//next row
-				}
-		}
-	}
-}
-
-void drawParticle(uint8_t x, uint8_t y){
-	uint16_t sbPixel=(WIDTH*(HEIGHT-y-1))+x;
-	screenBuffer[sbPixel] = 0xFF;	
-}
-
-void eraseParticle(uint8_t x, uint8_t y){
-	uint16_t sbPixel=(WIDTH*(HEIGHT-y-1))+x;
-	screenBuffer[sbPixel] = game.map[sbPixel];	
-}
+// File: LCDBuffer.c
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: This software writes to the screen buffer array
+// Usage: Draw game objects and animations
+
+#include "LCDBuffer.h"
+#include "AstroParty.h"
+#include "ST7735.h"
+#include "math.h"
+#include "GamePhysics.h"
+#include "Blit.h"
+#include "CycleCount.h"
+#include "Mirror.h"
+
+#define HEIGHT 160
+#define WIDTH 128
+#define DIRTY_N ST7735_FLUSH_N	//max number of changed regions kept per frame
+#define DIRTY_SLACK 16			//extra pixels a merge may send, about the cost of one setAddrWindow
+#if LCDBUFFER_MODE == LCDBUFFER_4BPP
+#define STAGE_N 1024				//pixels in each half of stageBuffer
+#else
+#define STAGE_N 512					//pixels in each half of stageBuffer, four full rows, more halves per flush but far less RAM
+#endif
+
+#if LCDBUFFER_MODE == LCDBUFFER_4BPP
+//screenBuffer keeps palette indexes, two pixels per byte with the even pixel in the low nibble
+//SB_WRITE takes an 8-bit color and stores the nearest palette entry, SB_READ gives back the 8-bit color
+#define SB_WRITE(i,color) (screenBuffer[(i)>>1] = ((i)&1) ? (screenBuffer[(i)>>1]&0x0F)|(Nibble[color]<<4) : (screenBuffer[(i)>>1]&0xF0)|Nibble[color])
+#define SB_READ(i) Palette4[((i)&1) ? screenBuffer[(i)>>1]>>4 : screenBuffer[(i)>>1]&0x0F]
+
+//8-bit colors of the palette, every color the game screens use except 0xF8 (laser powerup), which shares 0x7C
+const uint8_t Palette4[16] = {
+	0x00,0x07,0x1C,0x20,0x24,0x5C,0x7C,0xBE,0xC7,0xDB,0xE0,0xE4,0xE7,0xEC,0xF0,0xFF
+};
+
+//nearest palette entry for each 8-bit color, menus and win banners are drawn through this
+const uint8_t Nibble[256] = {
+	 0, 0, 1, 1, 0, 0, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1,
+	 2, 2, 7, 1, 2, 2, 7, 7, 2, 2, 7, 7, 2, 2, 7, 7,
+	 3, 3, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1,
+	 4, 4, 7, 9, 2, 7, 7, 9, 2, 7, 7, 9, 2, 7, 7, 7,
+	10,10, 8, 8,11,11, 8, 8,11,11, 8, 8,13,13, 8, 8,
+	14,14, 9, 9,14,14, 9, 9, 5, 5, 9, 9, 5, 5, 7, 9,
+	10,10,12,12,11,11,12,12,11,11,12,12,13,13,12,12,
+	14,14, 9, 9,14,14, 9, 9, 6, 6,15,15, 6, 6,15,15,
+	 0, 0, 1, 1, 0, 0, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1,
+	 2, 2, 7, 1, 2, 2, 7, 7, 2, 2, 7, 7, 2, 2, 7, 7,
+	 3, 3, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1, 4, 4, 1, 1,
+	 4, 4, 7, 9, 2, 7, 7, 9, 2, 7, 7, 9, 2, 7, 7, 7,
+	10,10, 8, 8,11,11, 8, 8,11,11, 8, 8,13,13, 8, 8,
+	14,14, 9, 9,14,14, 9, 9, 5, 5, 9, 9, 5, 5, 7, 9,
+	10,10,12,12,11,11,12,12,11,11,12,12,13,13,12,12,
+	14,14, 9, 9,14,14, 9, 9, 6, 6,15,15, 6, 6,15,15
+};
+#else
+#define SB_WRITE(i,color) (screenBuffer[i] = (color))
+#define SB_READ(i) screenBuffer[i]
+#endif
+
+//regions of the screen changed since the last flush, in screen coordinates
+ST7735_Rect dirty[DIRTY_N];
+uint8_t dirtyN = 0;
+
+//changed pixels of the flushed frame, uDMA streams one half while the other is filled
+uint8_t stageBuffer[2][STAGE_N];
+ST7735_Rect stageRects[ST7735_FLUSH_N];	//regions packed into the half being filled
+uint8_t stageRectsN = 0;
+uint16_t stageUsed = 0;						//pixels used in the half being filled
+uint8_t stageHalf = 0;						//half being filled
+
+//record a changed region, (x,y) is the bottom left corner like draw()
+//overlapping or touching regions are merged so each pixel is only sent once
+void markDirty(int16_t x, int16_t y, int16_t w, int16_t h){
+	int16_t x0 = x, y0 = y-h+1, x1 = x+w-1, y1 = y;
+	int32_t area, best = 0x7FFFFFFF;
+	uint8_t i, bestI = 0;
+	
+	//clip to the screen
+	if(x0<0) x0 = 0;
+	if(y0<0) y0 = 0;
+	if(x1>=WIDTH) x1 = WIDTH-1;
+	if(y1>=HEIGHT) y1 = HEIGHT-1;
+	if(x0>x1 || y0>y1) return;		//region is totally off the screen
+	
+	i = 0;
+	while(i<dirtyN){
+		if(x0<=dirty[i].x1+1 && x1+1>=dirty[i].x0 && y0<=dirty[i].y1+1 && y1+1>=dirty[i].y0){	//touches region i
+			int16_t ux0 = x0<dirty[i].x0 ? x0 : dirty[i].x0, uy0 = y0<dirty[i].y0 ? y0 : dirty[i].y0,
+							ux1 = x1>dirty[i].x1 ? x1 : dirty[i].x1, uy1 = y1>dirty[i].y1 ? y1 : dirty[i].y1;
+			area = (x1-x0+1)*(y1-y0+1) + (dirty[i].x1-dirty[i].x0+1)*(dirty[i].y1-dirty[i].y0+1);
+			if((ux1-ux0+1)*(uy1-uy0+1) <= area+DIRTY_SLACK){		//union does not waste many pixels
+				x0 = ux0; y0 = uy0; x1 = ux1; y1 = uy1;
+				dirty[i] = dirty[--dirtyN];					//remove region i, the union is added below
+				i = 0;															//union may touch regions already checked
+				continue;
+			}
+		}
+		i++;
+	}
+	
+	if(dirtyN == DIRTY_N){		//list is full, grow the region that costs the fewest extra pixels
+		for(i=0; i<DIRTY_N; i++){
+			int16_t ux0 = x0<dirty[i].x0 ? x0 : dirty[i].x0, uy0 = y0<dirty[i].y0 ? y0 : dirty[i].y0,
+							ux1 = x1>dirty[i].x1 ? x1 : dirty[i].x1, uy1 = y1>dirty[i].y1 ? y1 : dirty[i].y1;
+			area = (ux1-ux0+1)*(uy1-uy0+1) - (dirty[i].x1-dirty[i].x0+1)*(dirty[i].y1-dirty[i].y0+1);
+			if(area<best){
+				best = area;
+				bestI = i;
+			}
+		}
+		if(x0>dirty[bestI].x0) x0 = dirty[bestI].x0;
+		if(y0>dirty[bestI].y0) y0 = dirty[bestI].y0;
+		if(x1<dirty[bestI].x1) x1 = dirty[bestI].x1;
+		if(y1<dirty[bestI].y1) y1 = dirty[bestI].y1;
+		dirty[bestI] = dirty[--dirtyN];
+	}
+	dirty[dirtyN].x0 = x0;
+	dirty[dirtyN].y0 = y0;
+	dirty[dirtyN].x1 = x1;
+	dirty[dirtyN].y1 = y1;
+	dirtyN++;
+}
+
+//walls standing on the screen are part of the background, so anything erased over a wall gets the wall back
+//blocks of the tile grid with a wall in them are flagged here and composed into wallTiles when read
+#define BLOCKS_N ((WIDTH/TILE_SIZE)*(HEIGHT/TILE_SIZE))
+uint8_t wallBlocks[BLOCKS_N/8];							//one bit per block
+uint8_t wallTiles[2][TILE_SIZE*TILE_SIZE];		//last two blocks composed, a row of an object touches at most two
+uint16_t wallTileBlock[2] = {BLOCKS_N,BLOCKS_N};	//block in each, BLOCKS_N for none
+uint8_t wallTileNext = 0;										//entry to replace next
+
+//walls destroyed since the last drawWalls(), by index in game.walls
+uint8_t wallQueue[WALLS_N];
+uint8_t wallQueueN = 0;
+
+//flag the blocks under every displayed wall and drop the composed blocks
+void wallLayer(void){
+	uint8_t i, bx, by;
+	for(i=0; i<BLOCKS_N/8; i++){
+		wallBlocks[i] = 0;
+	}
+	for(i=0; i<WALLS_N; i++){
+		Wall *wall = &game.walls[i];
+		if(wall->active && wall->displayed){
+			for(by=(HEIGHT-1-wall->y)/TILE_SIZE; by<=(HEIGHT-1-wall->y+WALL_SIZE-1)/TILE_SIZE && by<HEIGHT/TILE_SIZE; by++){
+				for(bx=wall->x/TILE_SIZE; bx<=(wall->x+WALL_SIZE-1)/TILE_SIZE && bx<WIDTH/TILE_SIZE; bx++){
+					wallBlocks[(by*(WIDTH/TILE_SIZE)+bx)/8] |= 1<<((by*(WIDTH/TILE_SIZE)+bx)%8);
+				}
+			}
+		}
+	}
+	wallTileBlock[0] = wallTileBlock[1] = BLOCKS_N;
+}
+
+//put every standing wall of game.walls in the background, drawMap() calls this at the start of a round
+void showWalls(void){
+	for(uint8_t i=0; i<WALLS_N; i++){
+		game.walls[i].displayed = game.walls[i].active && !game.walls[i].destroyed;
+	}
+	wallQueueN = 0;
+	wallLayer();
+}
+
+//remember a wall that was just destroyed, drawWalls() takes it out of the background
+void queueWall(uint8_t i){
+	if(wallQueueN < WALLS_N){
+		wallQueue[wallQueueN++] = i;
+	}
+}
+
+//tile of game.map at a block with the edges of the walls over it drawn in, like drawWall() used to
+const uint8_t *wallTile(uint16_t block){
+	uint8_t *tile;
+	const uint8_t *src = game.map->tiles[game.map->grid[block]];
+	int16_t row0 = (block/(WIDTH/TILE_SIZE))*TILE_SIZE, col0 = (block%(WIDTH/TILE_SIZE))*TILE_SIZE;	//screenBuffer row and column of pixel 0
+	int16_t r, c, row, col;
+	uint8_t e = wallTileBlock[1] == block;
+	
+	if(wallTileBlock[e] == block) return wallTiles[e];
+	e = wallTileNext;
+	wallTileNext ^= 1;
+	wallTileBlock[e] = block;
+	tile = wallTiles[e];
+	for(r=0; r<TILE_SIZE*TILE_SIZE; r++){
+		tile[r] = src[r];
+	}
+	for(uint8_t i=0; i<WALLS_N; i++){
+		Wall *wall = &game.walls[i];
+		if(!wall->active || !wall->displayed) continue;
+		for(row=0; row<TILE_SIZE; row++){
+			r = row0+row-(HEIGHT-1-wall->y);				//row of the wall, 0 at the bottom
+			if(r<0 || r>=WALL_SIZE) continue;
+			for(col=0; col<TILE_SIZE; col++){
+				c = col0+col-wall->x;									//column of the wall
+				if(c>=0 && c<WALL_SIZE && (r==0 || r==WALL_SIZE-1 || c==0 || c==WALL_SIZE-1)){
+					tile[row*TILE_SIZE+col] = wall->colors[(r+c)%2];
+				}
+			}
+		}
+	}
+	return tile;
+}
+
+//background pixels from screenBuffer coordinate i to the end of its tile row
+//n is the pixels wanted and comes back as the pixels the returned run holds, at most TILE_SIZE
+const uint8_t *mapRun(uint16_t i, uint8_t *n){
+	uint8_t col = i%TILE_SIZE;															//WIDTH is a multiple of TILE_SIZE
+	uint16_t block = (i/(WIDTH*TILE_SIZE))*(WIDTH/TILE_SIZE) + (i%WIDTH)/TILE_SIZE;
+	const uint8_t *tile;
+	if(*n > TILE_SIZE-col){
+		*n = TILE_SIZE-col;
+	}
+	if(wallBlocks[block/8] & (1<<(block%8))){
+		tile = wallTile(block);
+	} else {
+		tile = game.map->tiles[game.map->grid[block]];
+	}
+	return &tile[((i/WIDTH)%TILE_SIZE)*TILE_SIZE + col];
+}
+
+//background pixel at screenBuffer coordinate i
+uint8_t mapPixel(uint16_t i){
+	uint8_t n = 1;
+	return *mapRun(i, &n);
+}
+
+//send the half of stageBuffer being filled and switch to the other half
+//ST7735_FlushPackedAsync waits for the other half first, so it is free to fill once this returns
+void sendStage(void){
+	if(stageRectsN == 0) return;
+	ST7735_FlushPackedAsync(stageBuffer[stageHalf], stageRects, stageRectsN);
+	stageHalf ^= 1;
+	stageRectsN = 0;
+	stageUsed = 0;
+}
+
+//hand the finished frame to the LCD, this is the only handoff point between drawing and the transfer
+//the changed regions are composed into stageBuffer in bands of whole rows and uDMA streams them from there,
+//so update() and the draw routines can start on the next frame right away
+//stageBuffer is only touched here, and only the half that is not being sent
+void flushBuffer(void){
+	ST7735_Rect band;
+	uint16_t rows, w;
+	uint8_t i;
+	
+	for(i=0; i<dirtyN; i++){
+		band = dirty[i];
+		w = band.x1-band.x0+1;
+		while(band.y0 <= dirty[i].y1){
+			rows = (STAGE_N-stageUsed)/w;
+			if(rows == 0 || stageRectsN == ST7735_FLUSH_N){		//this half is full
+				sendStage();
+				rows = STAGE_N/w;
+			}
+			if(rows > dirty[i].y1-band.y0+1){
+				rows = dirty[i].y1-band.y0+1;
+			}
+			band.y1 = band.y0+rows-1;
+			composeRect(&band, &stageBuffer[stageHalf][stageUsed]);
+			stageRects[stageRectsN++] = band;
+			stageUsed += rows*w;
+			band.y0 = band.y1+1;
+		}
+	}
+	sendStage();
+#ifdef LCD_MIRROR
+	Mirror_Frame(dirty, dirtyN);
+#endif
+	dirtyN = 0;
+}
+
+#if LCDBUFFER_MODE != LCDBUFFER_DISPLAYLIST
+//part of a rectangle that is on the screen, clipRect() finds it once for the kernels below
+typedef struct Clip {
+	int16_t x, y;						//bottom left corner on the screen
+	uint8_t w, h;						//size on the screen
+	uint8_t skipC, startR;	//columns of the rectangle left of the screen and rows below it
+	uint16_t sbPixel;				//screenBuffer coordinate of (x,y)
+} Clip;
+
+//clip a rectangle to the screen, (x,y) is the bottom left corner like draw()
+//returns 0 if none of it is on the screen
+uint8_t clipRect(int16_t x, int16_t y, uint8_t w, uint8_t h, Clip *clip){
+	if(x>=WIDTH || (y-h+1)>=HEIGHT || (x+w)<=0 || y<0) return 0; //rectangle is totally off the screen, do nothing
+	if(w>WIDTH || h>HEIGHT) return 0; //rectangle is too wide for the screen, do nothing
+
+	clip->skipC = 0;
+	clip->startR = 0;
+	if((x+w-1)>=WIDTH){             //rectangle exceeds right of screen
+	  w = WIDTH-x;
+	}
+	if((y-h+1)<0){                  //rectangle exceeds top of screen
+	  h = y+1;
+	}
+	if(x<0){                        //rectangle exceeds left of screen
+		w = w+x;
+		clip->skipC = -x;
+		x = 0;
+	}
+	if(y>=HEIGHT){                  //rectangle exceeds bottom of screen
+		clip->startR = y-HEIGHT+1;
+		h = h-clip->startR;
+		y = HEIGHT-1;
+	}
+	clip->x = x;
+	clip->y = y;
+	clip->w = w;
+	clip->h = h;
+	clip->sbPixel = (WIDTH*(HEIGHT-y-1))+x;		//calculate corresponding screenBuffer coordinate of bottom left corner
+	return 1;
+}
+
+#if LCDBUFFER_MODE == LCDBUFFER_8BPP
+//copy n pixels into screenBuffer starting at pixel i
+//long spans store whole words, with load/store multiple when src lines up with screenBuffer
+void copySpan(uint16_t i, const uint8_t *src, uint8_t n){
+	uint8_t *dst = &screenBuffer[i];
+	if(n>=8){
+		while((uint32_t)dst&3){										//head, up to the first aligned word
+			*dst++ = *src++;
+			n--;
+		}
+		if(((uint32_t)src&3) == 0){
+			copyWords((uint32_t *)dst, (const uint32_t *)src, n>>2);
+			dst += n&~3;
+			src += n&~3;
+		} else {
+			for(uint8_t k=n>>2; k; k--){						//unaligned loads, the M4 splits them in hardware
+				*(uint32_t *)dst = *(__packed uint32_t *)src;
+				dst += 4;
+				src += 4;
+			}
+		}
+		n &= 3;
+	}
+	while(n--){																	//tail
+		*dst++ = *src++;
+	}
+}
+
+//fill n pixels of screenBuffer starting at pixel i with color
+void fillSpan(uint16_t i, uint8_t color, uint8_t n){
+	uint8_t *dst = &screenBuffer[i];
+	if(n>=8){
+		while((uint32_t)dst&3){										//head, up to the first aligned word
+			*dst++ = color;
+			n--;
+		}
+		fillWords((uint32_t *)dst, color*0x01010101u, n>>2);
+		dst += n&~3;
+		n &= 3;
+	}
+	while(n--){																	//tail
+		*dst++ = color;
+	}
+}
+
+//move 2 or 4 pixels with one halfword or word access, aligned or not
+#define MOVE16(dst,src) (*(__packed uint16_t *)(dst) = *(__packed const uint16_t *)(src))
+#define MOVE32(dst,src) (*(__packed uint32_t *)(dst) = *(__packed const uint32_t *)(src))
+
+//copy a w by h block into screenBuffer at pixel i, src rows are stride apart
+//the sizes drawn every frame are unrolled: 2 bullets, 3 laser, 8 and 10 walls, 9 ships and powerups
+void blit(uint16_t i, const uint8_t *src, uint8_t stride, uint8_t w, uint8_t h){
+	uint8_t *dst = &screenBuffer[i];
+	switch(w){
+		case 2:
+			while(h--){
+				MOVE16(dst, src);
+				dst += WIDTH;
+				src += stride;
+			}
+			break;
+		case 3:
+			while(h--){
+				MOVE16(dst, src);
+				dst[2] = src[2];
+				dst += WIDTH;
+				src += stride;
+			}
+			break;
+		case 8:
+			while(h--){
+				MOVE32(dst, src);
+				MOVE32(dst+4, src+4);
+				dst += WIDTH;
+				src += stride;
+			}
+			break;
+		case 9:
+			while(h--){
+				MOVE32(dst, src);
+				MOVE32(dst+4, src+4);
+				dst[8] = src[8];
+				dst += WIDTH;
+				src += stride;
+			}
+			break;
+		case 10:
+			while(h--){
+				MOVE32(dst, src);
+				MOVE32(dst+4, src+4);
+				MOVE16(dst+8, src+8);
+				dst += WIDTH;
+				src += stride;
+			}
+			break;
+		default:
+			while(h--){
+				copySpan(i, src, w);
+				i += WIDTH;
+				src += stride;
+			}
+	}
+}
+
+//fill a w by h block of screenBuffer at pixel i with color
+//9 wide is unrolled for the menu cursor
+void fill(uint16_t i, uint8_t color, uint8_t w, uint8_t h){
+	uint8_t *dst = &screenBuffer[i];
+	uint32_t word = color*0x01010101u;
+	if(w == 9){
+		while(h--){
+			*(__packed uint32_t *)dst = word;
+			*(__packed uint32_t *)(dst+4) = word;
+			dst[8] = color;
+			dst += WIDTH;
+		}
+		return;
+	}
+	while(h--){
+		fillSpan(i, color, w);
+		i += WIDTH;
+	}
+}
+#else
+//copy n pixels into screenBuffer starting at pixel i
+//pixels are written a byte pair at a time, only an odd pixel at either end needs a read-modify-write
+void copySpan(uint16_t i, const uint8_t *src, uint8_t n){
+	if(n && (i&1)){															//first pixel shares its byte with the pixel to the left
+		SB_WRITE(i, *src);
+		i++;
+		src++;
+		n--;
+	}
+	for(; n>=2; n-=2){
+		screenBuffer[i>>1] = Nibble[src[0]] | (Nibble[src[1]]<<4);	//two pixels at a time
+		i += 2;
+		src += 2;
+	}
+	if(n){																			//last pixel shares its byte with the pixel to the right
+		SB_WRITE(i, *src);
+	}
+}
+
+//fill n pixels of screenBuffer starting at pixel i with color
+void fillSpan(uint16_t i, uint8_t color, uint8_t n){
+	uint8_t pair = Nibble[color]*0x11;						//both pixels of a byte
+	if(n && (i&1)){															//first pixel shares its byte with the pixel to the left
+		SB_WRITE(i, color);
+		i++;
+		n--;
+	}
+	for(; n>=2; n-=2){
+		screenBuffer[i>>1] = pair;								//two pixels at a time
+		i += 2;
+	}
+	if(n){																			//last pixel shares its byte with the pixel to the right
+		SB_WRITE(i, color);
+	}
+}
+
+//copy a w by h block into screenBuffer at pixel i, src rows are stride apart
+void blit(uint16_t i, const uint8_t *src, uint8_t stride, uint8_t w, uint8_t h){
+	while(h--){
+		copySpan(i, src, w);
+		i += WIDTH;
+		src += stride;
+	}
+}
+
+//fill a w by h block of screenBuffer at pixel i with color
+void fill(uint16_t i, uint8_t color, uint8_t w, uint8_t h){
+	while(h--){
+		fillSpan(i, color, w);
+		i += WIDTH;
+	}
+}
+#endif
+
+//copy n background pixels into screenBuffer starting at pixel i, one run per tile
+void mapSpan(uint16_t i, uint8_t n){
+	while(n){
+		uint8_t k = n;
+		const uint8_t *src = mapRun(i, &k);
+		copySpan(i, src, k);
+		i += k;
+		n -= k;
+	}
+}
+
+//fill a w by h block of screenBuffer at pixel i with the background, one blit per tile it covers
+void eraseMap(uint16_t i, uint8_t w, uint8_t h){
+	while(h){
+		uint8_t rows = TILE_SIZE - (i/WIDTH)%TILE_SIZE;		//rows left in this row of tiles
+		if(rows > h){
+			rows = h;
+		}
+		uint16_t j = i;
+		uint8_t n = w;
+		while(n){
+			uint8_t k = n;
+			const uint8_t *src = mapRun(j, &k);
+			blit(j, src, TILE_SIZE, k, rows);
+			j += k;
+			n -= k;
+		}
+		i += rows*WIDTH;
+		h -= rows;
+	}
+}
+
+//fill screen buffer array with game.map and its walls
+void drawMap(void){
+	showWalls();
+	eraseMap(0, WIDTH, HEIGHT);
+	markDirty(0,HEIGHT-1,WIDTH,HEIGHT);
+}
+
+//fill screen buffer array with black
+void clear(void){
+	fill(0, ST7735_BLACK, WIDTH, HEIGHT);
+	markDirty(0,HEIGHT-1,WIDTH,HEIGHT);
+}
+
+//draw image
+void draw(int16_t x, int16_t y, const uint8_t *image, uint8_t w, uint8_t h){
+	Clip clip;
+	if(!clipRect(x, y, w, h, &clip)) return;
+	markDirty(clip.x,clip.y,clip.w,clip.h);
+
+	uint16_t sbPixel = clip.sbPixel;
+	image += clip.startR*w + clip.skipC;										//first pixel of the image on the screen
+	for(uint8_t r=0; r<clip.h; r++){
+		for(uint8_t c=0; c<clip.w; c++){
+			if(image[c]!=1){																	//if not special pixel
+				SB_WRITE(sbPixel+c, image[c]);								//draw corresponding sprite pixel onto screenBuffer
+			} else {																		//else draw background
+				if(stage == Game){
+					SB_WRITE(sbPixel+c, mapPixel(sbPixel+c));
+				} else {
+					SB_WRITE(sbPixel+c, 0x00);
+				}
+			}
+		}
+		image += w;
+		sbPixel += WIDTH;															//next row
+	}
+}
+
+//draw columns c to c+n-1 of a sprite row whose column 0 is screenBuffer pixel row, keeping columns left to right-1
+//src 0 draws the background like a transparent pixel in draw()
+void drawRun(int32_t row, int16_t c, int16_t n, const uint8_t *src, int16_t left, int16_t right){
+	if(c<left){												//run starts left of the screen
+		if(src) src += left-c;
+		n -= left-c;
+		c = left;
+	}
+	if(c+n>right){										//run ends right of the screen
+		n = right-c;
+	}
+	if(n<=0) return;
+	if(src){
+		copySpan(row+c, src, n);
+	} else if(stage == Game){
+		mapSpan(row+c, n);
+	} else {
+		fillSpan(row+c, 0x00, n);
+	}
+}
+
+//draw compiled sprite, (x,y) is the bottom left corner like draw()
+//transparent runs get the background and opaque runs are copied, so there is no test per pixel
+void drawSprite(int16_t x, int16_t y, const Sprite *sprite){
+	const uint8_t *runs = sprite->runs, *pixels = sprite->pixels;
+	Clip clip;
+	if(!clipRect(x, y, sprite->w, sprite->h, &clip)) return;
+	markDirty(clip.x,clip.y,clip.w,clip.h);
+
+	int32_t sbPixel = (int32_t)clip.sbPixel - clip.skipC;		//screenBuffer coordinate of column 0 of the first row on the screen
+	for(uint8_t r=0; r<clip.startR+clip.h; r++){
+		uint8_t n = *runs++;
+		int16_t c = 0;
+		while(n--){
+			uint8_t skip = *runs++, copy = *runs++;
+			if(r>=clip.startR){
+				drawRun(sbPixel, c, skip, 0, clip.skipC, clip.skipC+clip.w);
+				drawRun(sbPixel, c+skip, copy, pixels, clip.skipC, clip.skipC+clip.w);
+			}
+			c += skip+copy;
+			pixels += copy;
+		}
+		if(r>=clip.startR){
+			sbPixel += WIDTH;														//next row
+		}
+	}
+}
+
+//draw rectangle
+void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
+	Clip clip;
+	if(!clipRect(x, y, w, h, &clip)) return;
+	markDirty(clip.x,clip.y,clip.w,clip.h);
+
+	uint16_t sbPixel = clip.sbPixel;
+	for(uint8_t r=0; r<clip.h; r++){
+		if(r==0 || r==h-1){														//bottom or top edge
+			fillSpan(sbPixel, color, clip.w);
+		} else {																			//background with the side edges over it
+			mapSpan(sbPixel, clip.w);
+			SB_WRITE(sbPixel, color);
+			if(w-1 < clip.w){
+				SB_WRITE(sbPixel+w-1, color);
+			}
+		}
+		sbPixel += WIDTH;															//next row
+	}
+}
+
+//draw filled rectangle
+void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
+	Clip clip;
+	if(!clipRect(x, y, w, h, &clip)) return;
+	markDirty(clip.x,clip.y,clip.w,clip.h);
+	fill(clip.sbPixel, color, clip.w, clip.h);
+}
+
+//fill rectangle with background, straight from the tiles of game.map
+void eraseRect(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+	Clip clip;
+	if(!clipRect(x, y, w, h, &clip)) return;
+	markDirty(clip.x,clip.y,clip.w,clip.h);
+	eraseMap(clip.sbPixel, clip.w, clip.h);
+}
+
+//draw a ship from the compiled frames already in the player color
+//transparent runs get the background or the blades ring, opaque runs are copied, so there is no test per pixel
+void drawPlayer(Player *player){
+	const uint8_t *runs = player->ships[player->dir].runs, *pixels = player->ships[player->dir].pixels;
+	uint8_t ring = player->powerUp == Blades && blades.displayed == 1;
+	markDirty(FIX_INT(player->x),FIX_INT(player->y),PLAYER_WIDTH,PLAYER_HEIGHT);
+	uint16_t sbPixel=(WIDTH*(HEIGHT-FIX_INT(player->y)-1))+FIX_INT(player->x);				//calculate corresponding screenBuffer coordinate of bottom left corner of player
+	for(uint8_t r=0; r<PLAYER_HEIGHT; r++){
+		uint8_t n = *runs++, c = 0, first = runs[0];
+		uint8_t edge = ring && (r==0 || r==PLAYER_HEIGHT-1);
+		while(n--){
+			uint8_t skip = *runs++, copy = *runs++;
+			if(edge){
+				fillSpan(sbPixel+c, 0x1c, skip);												//blades ring along the top and bottom
+			} else {
+				mapSpan(sbPixel+c, skip);															//background
+			}
+			c += skip;
+			copySpan(sbPixel+c, pixels, copy);
+			c += copy;
+			pixels += copy;
+		}
+		if(ring && !edge){																	//blades ring along the sides
+			if(first){																				//row starts transparent
+				SB_WRITE(sbPixel, 0x1c);
+			}
+			if(runs[-1] == 0){																//row ends transparent
+				SB_WRITE(sbPixel+PLAYER_WIDTH-1, 0x1c);
+			}
+		}
+		sbPixel += WIDTH;															//next row
+	}
+}
+#endif
+
+void drawBulletExplosion(Bullet *bullet){
+	bullet->active = 0;
+	bullet->destroyed = 1;
+	drawSprite(bullet->expX,bullet->expY, bullet->bulletExp);
+}
+
+#if LCDBUFFER_MODE != LCDBUFFER_DISPLAYLIST
+
+void drawBullet(Bullet *bullet){
+	markDirty(FIX_INT(bullet->x),FIX_INT(bullet->y),BULLET_WIDTH,BULLET_HEIGHT);
+	uint16_t sbPixel=(WIDTH*(HEIGHT-FIX_INT(bullet->y)-1))+FIX_INT(bullet->x);				//calculate corresponding screenBuffer coordinate of bottom left corner of bullet
+	blit(sbPixel, bullet->bulletSprite, BULLET_WIDTH, BULLET_WIDTH, BULLET_HEIGHT);
+}
+
+//draw the spans of laserBeam
+void drawLaser(void){
+	uint8_t core = laserBeam.sprite[LASER_WIDTH+1], edge = laserBeam.sprite[0];
+	for(uint8_t k=0; k<laserBeam.rows; k++){
+		uint8_t x0 = laserBeam.x0[k]&~LASER_EDGE, x1 = laserBeam.x1[k]&~LASER_EDGE;
+		uint16_t sbPixel = WIDTH*(HEIGHT-1-(laserBeam.top+k));
+		markDirty(x0,laserBeam.top+k,x1-x0+1,1);
+		fillSpan(sbPixel+x0, core, x1-x0+1);
+		if(laserBeam.x0[k]&LASER_EDGE){
+			SB_WRITE(sbPixel+x0, edge);
+		}
+		if(laserBeam.x1[k]&LASER_EDGE){
+			SB_WRITE(sbPixel+x1, edge);
+		}
+	}
+}
+
+//fill the spans of laserBeam with background
+void eraseLaser(void){
+	laserBeam.displayed = 0;
+	for(uint8_t k=0; k<laserBeam.rows; k++){
+		uint8_t x0 = laserBeam.x0[k]&~LASER_EDGE, x1 = laserBeam.x1[k]&~LASER_EDGE;
+		markDirty(x0,laserBeam.top+k,x1-x0+1,1);
+		mapSpan(WIDTH*(HEIGHT-1-(laserBeam.top+k))+x0, x1-x0+1);
+	}
+}
+#endif
+
+//erase the walls destroyed since the last frame, standing walls are part of the background and are not redrawn
+void drawWalls(void){
+	while(wallQueueN){
+		Wall *wall = &game.walls[wallQueue[--wallQueueN]];
+		if(wall->active && wall->displayed){
+			wall->displayed = 0;
+			wallLayer();
+			eraseRect(wall->x,wall->y,WALL_SIZE,WALL_SIZE);
+			particleGenerate(wall->x +WALL_SIZE/2,wall->y-WALL_SIZE/2);
+		}
+	}
+}
+
+//draw active powerups
+void drawPowerUps(void){
+	for(uint8_t i=0; i<POWERUPS_N; i++){
+		if(game.powerUps[i].active){
+				if(!game.powerUps[i].displayed){	//powerups already displayed are unchanged on the LCD
+					markDirty(FIX_INT(game.powerUps[i].x),FIX_INT(game.powerUps[i].y),POWERUP_WIDTH,POWERUP_HEIGHT);
+				}
+				game.powerUps[i].displayed = 1;
+				drawPowerUp(&game.powerUps[i]);
+		}
+	}
+}
+
+//draw a string with drawChar(), one character every TEXT_WIDTH pixels
+void drawString(int16_t x, int16_t y, const char *str, uint8_t color, uint8_t bg){
+	while(*str){
+		drawChar(x, y, *str++, color, bg);
+		x += TEXT_WIDTH;
+	}
+}
+
+//draw n right aligned in width characters, spaces in front, so a shorter number covers a longer one
+//the digits are made in a buffer on the stack, nothing is allocated
+void drawUDec(int16_t x, int16_t y, uint32_t n, uint8_t width, uint8_t color, uint8_t bg){
+	char digits[10];
+	uint8_t i = 0;
+	do{
+		digits[i++] = '0'+n%10;
+		n /= 10;
+	} while(n && i<10);
+	for(; width>i; width--){
+		drawChar(x, y, ' ', color, bg);
+		x += TEXT_WIDTH;
+	}
+	while(i){
+		drawChar(x, y, digits[--i], color, bg);
+		x += TEXT_WIDTH;
+	}
+}
+
+#if LCDBUFFER_MODE != LCDBUFFER_DISPLAYLIST
+void drawParticle(uint8_t x, uint8_t y){
+	uint16_t sbPixel=(WIDTH*(HEIGHT-y-1))+x;
+	markDirty(x,y,1,1);
+	SB_WRITE(sbPixel, 0xFF);	
+}
+
+void eraseParticle(uint8_t x, uint8_t y){
+	uint16_t sbPixel=(WIDTH*(HEIGHT-y-1))+x;
+	markDirty(x,y,1,1);
+	SB_WRITE(sbPixel, mapPixel(sbPixel));	
+}
+
+void drawPowerUp(PowerUp *powerUp){
+	uint16_t sbPixel=(WIDTH*(HEIGHT-FIX_INT(powerUp->y)-1))+FIX_INT(powerUp->x);				//calculate corresponding screenBuffer coordinate of bottom left corner of rect
+	blit(sbPixel, powerUp->sprite, POWERUP_WIDTH, POWERUP_WIDTH, POWERUP_HEIGHT);
+}
+
+//glyphs of the 5x7 font turned into rows, so a row of text is one lookup instead of a test per pixel
+#define GLYPHS_N 16
+char glyphChar[GLYPHS_N];									//character in each entry, the digits never share one
+uint8_t glyphRows[GLYPHS_N][TEXT_HEIGHT];	//top row first, bit c is column c
+
+#if LCDBUFFER_MODE == LCDBUFFER_8BPP
+//4 pixels of text for every 4 bits of a glyph row, in the colors of the last drawChar()
+uint32_t textPixels[16];
+uint8_t textColor = 0, textBg = 0;
+#endif
+
+//rows of a character, from the cache or turned from the columns of the font
+const uint8_t *glyph(char c){
+	uint8_t e = (uint8_t)c%GLYPHS_N;
+	if(glyphChar[e] != c){
+		const uint8_t *font = ST7735_Glyph(c);
+		for(uint8_t r=0; r<TEXT_HEIGHT; r++){
+			uint8_t row = 0;
+			for(uint8_t col=0; col<5; col++){
+				if(font[col]&(1<<r)){
+					row |= 1<<col;
+				}
+			}
+			glyphRows[e][r] = row;
+		}
+		glyphChar[e] = c;
+	}
+	return glyphRows[e];
+}
+
+//draw a character and its background as one opaque 6x8 block, (x,y) is the bottom left corner like draw()
+//characters not totally on the screen are skipped
+void drawChar(int16_t x, int16_t y, char c, uint8_t color, uint8_t bg){
+	if(x<0 || x+TEXT_WIDTH>WIDTH || y-TEXT_HEIGHT+1<0 || y>=HEIGHT) return;
+#if LCDBUFFER_MODE == LCDBUFFER_8BPP
+	if(color != textColor || bg != textBg){			//colors changed, expand them again
+		for(uint8_t m=0; m<16; m++){
+			uint32_t word = 0;
+			for(uint8_t k=0; k<4; k++){
+				word |= (uint32_t)((m&(1<<k)) ? color : bg)<<(8*k);		//pixel k is the lowest address
+			}
+			textPixels[m] = word;
+		}
+		textColor = color;
+		textBg = bg;
+	}
+#endif
+	markDirty(x,y,TEXT_WIDTH,TEXT_HEIGHT);
+	
+	const uint8_t *rows = glyph(c);
+	uint16_t sbPixel = (WIDTH*(HEIGHT-y-1))+x;
+	for(int8_t r=TEXT_HEIGHT-1; r>=0; r--){				//bottom row first
+#if LCDBUFFER_MODE == LCDBUFFER_8BPP
+		*(__packed uint32_t *)&screenBuffer[sbPixel] = textPixels[rows[r]&0x0F];
+		*(__packed uint16_t *)&screenBuffer[sbPixel+4] = textPixels[rows[r]>>4];	//column 5 is always background
+#else
+		for(uint8_t col=0; col<TEXT_WIDTH; col++){
+			SB_WRITE(sbPixel+col, (rows[r]&(1<<col)) ? color : bg);
+		}
+#endif
+		sbPixel += WIDTH;															//next row
+	}
+}
+
+//copy a region of screenBuffer into out, top row first
+void composeRect(const ST7735_Rect *rect, uint8_t *out){
+	for(uint8_t y=rect->y0; y<=rect->y1; y++){
+		for(uint8_t x=rect->x0; x<=rect->x1; x++){
+			*out++ = SB_READ(WIDTH*(HEIGHT-1-y)+x);
+		}
+	}
+}
+
+#ifdef LCD_BENCHMARK
+//time eraseRect's tile blits against a byte loop over the same pixels, for the sizes the game draws and one large block,
+//then a 3 digit drawUDec()
+//prints size, loop cycles and kernel cycles below the ST7735_Benchmark table, game.map must be set
+#define BENCH_SIZES 5
+void blitBenchmark(void){
+	const uint8_t size[BENCH_SIZES] = {2,3,9,10,64};
+	uint32_t start, loop, kernel;
+	
+	CycleCount_Init();
+	ST7735_SetCursor(0, 8);
+	ST7735_OutString("size loop   kernel");
+	for(uint8_t i=0; i<BENCH_SIZES; i++){
+		uint8_t w = size[i], h = size[i];
+		uint16_t sbPixel=(WIDTH*(HEIGHT-100-1))+33;		//bottom left corner at (33,100), an odd address
+		start = CycleCount_Now();
+		for(uint8_t r=0; r<h; r++){
+			for(uint8_t c=0; c<w; c++){
+				SB_WRITE(sbPixel+c, mapPixel(sbPixel+c));
+			}
+			sbPixel += WIDTH;
+		}
+		loop = CycleCount_Now()-start;
+		sbPixel=(WIDTH*(HEIGHT-100-1))+33;
+		start = CycleCount_Now();
+		eraseMap(sbPixel, w, h);
+		kernel = CycleCount_Now()-start;
+		ST7735_SetCursor(0, 9+i);
+		ST7735_OutUDec(w);
+		ST7735_SetCursor(5, 9+i);
+		ST7735_OutUDec(loop);
+		ST7735_SetCursor(12, 9+i);
+		ST7735_OutUDec(kernel);
+	}
+	start = CycleCount_Now();
+	drawUDec(33, 100, 123, 3, 0xFF, 0x00);				//a HUD counter
+	kernel = CycleCount_Now()-start;
+	ST7735_SetCursor(0, 9+BENCH_SIZES);
+	ST7735_OutString("text");
+	ST7735_SetCursor(12, 9+BENCH_SIZES);
+	ST7735_OutUDec(kernel);
+}
+#endif
+#endif
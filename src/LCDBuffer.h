@@ -1,25 +1,57 @@
-#ifndef LCDBUFFER_H
-#define LCDBUFFER_H
-#include <stdint.h>
-#include "GameObjects.h"
-
-
-
-void clear(void);
-
-void draw(int16_t x, int16_t y, const uint8_t *image, uint8_t w, uint8_t h);
-void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color);
-void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color);
-
-void eraseRect(int16_t x, int16_t y, uint8_t w, uint8_t h);
-void drawPlayer(Player *player);
-void drawBulletExplosion(Bullet *bullet);
-void drawBullet(Bullet *bullet);
-void drawLaser(double x, double y, uint8_t w, uint8_t h);
-void eraseLaser(void);
-void drawWalls(void);
-void drawPowerUps(void);
-void drawParticle(uint8_t x, uint8_t y);
-void eraseParticle(uint8_t x, uint8_t y);
-
-#endif
+#ifndef LCDBUFFER_H
+#define LCDBUFFER_H
+#include <stdint.h>
+#include "GameObjects.h"
+#include "ST7735.h"
+
+//render modes, define LCDBUFFER_MODE in the project to pick one
+#define LCDBUFFER_8BPP 0				//screenBuffer keeps every pixel, one byte each (20KB)
+#define LCDBUFFER_DISPLAYLIST 1	//no screenBuffer, the changed regions are composed from a display list when flushed
+#define LCDBUFFER_4BPP 2				//screenBuffer keeps a 16 color palette index per pixel, two pixels per byte (10KB)
+#ifndef LCDBUFFER_MODE
+#define LCDBUFFER_MODE LCDBUFFER_8BPP
+#endif
+
+#define TEXT_WIDTH 6			//cell of drawChar(), a 5x7 font character with background around it
+#define TEXT_HEIGHT 8
+
+void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+void flushBuffer(void);
+void clear(void);
+void drawMap(void);
+
+void draw(int16_t x, int16_t y, const uint8_t *image, uint8_t w, uint8_t h);
+void drawSprite(int16_t x, int16_t y, const Sprite *sprite);
+void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color);
+void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color);
+void drawChar(int16_t x, int16_t y, char c, uint8_t color, uint8_t bg);
+void drawString(int16_t x, int16_t y, const char *str, uint8_t color, uint8_t bg);
+void drawUDec(int16_t x, int16_t y, uint32_t n, uint8_t width, uint8_t color, uint8_t bg);
+
+void eraseRect(int16_t x, int16_t y, uint8_t w, uint8_t h);
+void drawPlayer(Player *player);
+void drawBulletExplosion(Bullet *bullet);
+void drawBullet(Bullet *bullet);
+void drawLaser(void);
+void eraseLaser(void);
+void queueWall(uint8_t i);
+void drawWalls(void);
+void drawPowerUps(void);
+void drawParticle(uint8_t x, uint8_t y);
+void eraseParticle(uint8_t x, uint8_t y);
+
+//render mode internals, LCDBuffer.c has the 8bpp and 4bpp ones and LCDDisplayList.c the display list ones
+void drawPowerUp(PowerUp *powerUp);
+void composeRect(const ST7735_Rect *rect, uint8_t *out);
+
+//background tiles of game.map with the standing walls over them, shared by every render mode
+const uint8_t *mapRun(uint16_t i, uint8_t *n);
+uint8_t mapPixel(uint16_t i);
+void showWalls(void);
+
+#if LCDBUFFER_MODE != LCDBUFFER_DISPLAYLIST
+//print cycles of the eraseRect tile blits against plain byte loops and of a HUD counter, built when LCD_BENCHMARK is defined
+void blitBenchmark(void);
+#endif
+
+#endif
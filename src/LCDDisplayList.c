@@ -0,0 +1,470 @@
+// File: LCDDisplayList.c
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: This software keeps a display list of what is on the screen instead of a 20KB screen buffer
+// Usage: Built when LCDBUFFER_MODE is LCDBUFFER_DISPLAYLIST, same drawing functions as LCDBuffer.c;
+//        flushBuffer() composes each changed region row by row from the tiles of game.map and the items over it
+
+#include "LCDBuffer.h"
+#include "AstroParty.h"
+#include "ST7735.h"
+
+#if LCDBUFFER_MODE == LCDBUFFER_DISPLAYLIST
+
+#define HEIGHT 160
+#define WIDTH 128
+//most items that can be drawn at once over the map: 2 ships, a bullet and the explosion it left in each ammo slot,
+//the power-ups, the laser, the particles as one item, and the 8 characters of the round score as a fill and a glyph each,
+//the menu draws fewer over its black base
+#define ITEMS_DRAWN (2 + 2*2*PLAYER_AMMO + POWERUPS_N + 1 + 1 + 2*8)
+//erases are only kept while an older drawn item is under them, in practice the ones over a power-up a bullet crossed
+#define ITEMS_N (ITEMS_DRAWN + 16)		//max items over the base
+
+//what an item draws over its rectangle
+//every type except ItemGlyph, ItemBeam and ItemParticles covers its whole rectangle, transparent pixels show the background, not older items
+enum ItemEnum {
+	ItemFill,							//color
+	ItemErase,						//game.map with the standing walls, see mapRun()
+	ItemImage,						//image, pixel 1 shows game.map
+	ItemImageBlack,				//image, pixel 1 shows black (draw() outside the Game stage)
+	ItemRaw,							//image, every pixel as is
+	ItemOutline,					//edge in color, inside shows game.map
+	ItemShip,							//image, 0x07 becomes color, pixel 1 shows game.map
+	ItemShipBlades,				//ItemShip with the Blades ring on the transparent edge pixels
+	ItemGlyph,						//columns of a font character, only its set pixels in color
+	ItemBeam,							//spans of laserBeam, only their own pixels
+	ItemParticles					//pixels of particlesX/Y, only their own pixels
+};
+
+typedef struct {
+	ST7735_Rect r;				//part on the screen, rows from the top
+	int16_t x, y;					//bottom left corner like draw()
+	uint8_t w, h;					//full size, images are w wide
+	uint8_t type;
+	uint8_t color;
+	const uint8_t *data;	//image or font character
+} Item;
+
+//bottom layer, the last item that covered the whole screen
+Item base = {{0,0,WIDTH-1,HEIGHT-1},0,HEIGHT-1,WIDTH,HEIGHT,ItemFill,0x00,0};
+
+//items over the base, oldest first, later items are drawn on top
+Item items[ITEMS_N];
+uint8_t itemsN = 0;
+uint16_t itemsDropped = 0;			//items that did not fit even after collect(), should stay 0, watch it in the debugger
+
+//items touching the region being composed
+uint8_t overlap[ITEMS_N];
+
+//particles on the screen, drawn and not erased yet, painted by the one ItemParticles item
+uint8_t particlesX[PARTICLES_N], particlesY[PARTICLES_N];
+uint8_t particlesN = 0;
+
+//fill in an item, returns 0 if it is totally off the screen
+uint8_t makeItem(Item *item, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t type, uint8_t color, const uint8_t *data){
+	int16_t x0 = x, y0 = y-h+1, x1 = x+w-1, y1 = y;
+
+	//clip to the screen
+	if(x0<0) x0 = 0;
+	if(y0<0) y0 = 0;
+	if(x1>=WIDTH) x1 = WIDTH-1;
+	if(y1>=HEIGHT) y1 = HEIGHT-1;
+	if(x0>x1 || y0>y1) return 0;
+
+	item->r.x0 = x0; item->r.y0 = y0; item->r.x1 = x1; item->r.y1 = y1;
+	item->x = x; item->y = y;
+	item->w = w; item->h = h;
+	item->type = type;
+	item->color = color;
+	item->data = data;
+	return 1;
+}
+
+uint8_t inside(const ST7735_Rect *a, const ST7735_Rect *b){
+	return a->x0>=b->x0 && a->x1<=b->x1 && a->y0>=b->y0 && a->y1<=b->y1;
+}
+
+uint8_t overlaps(const ST7735_Rect *a, const ST7735_Rect *b){
+	return a->x0<=b->x1 && a->x1>=b->x0 && a->y0<=b->y1 && a->y1>=b->y0;
+}
+
+//erase items show the same pixels as the base when the base is the map
+uint8_t baseIsMap(void){
+	return base.type == ItemErase;
+}
+
+//drop erase items with only the base and other erase items under them, they no longer hide anything
+void collect(void){
+	uint8_t i, j, n = 0, keep;
+	if(!baseIsMap()) return;
+	for(i=0; i<itemsN; i++){
+		keep = 1;
+		if(items[i].type == ItemErase){
+			keep = 0;
+			for(j=0; j<n; j++){						//items[0..n-1] are the older items kept so far
+				if(items[j].type != ItemErase && overlaps(&items[j].r, &items[i].r)){
+					keep = 1;
+					break;
+				}
+			}
+		}
+		if(keep){
+			items[n++] = items[i];
+		}
+	}
+	itemsN = n;
+}
+
+//put an item on top of the others
+//older items it hides completely are dropped, an item covering the whole screen becomes the base,
+//and an erase with nothing but the map under it is not kept at all
+void submit(Item *item){
+	uint8_t i, n = 0;
+	if(item->type != ItemGlyph && item->type != ItemBeam && item->type != ItemParticles){		//items that cover their whole rectangle
+		for(i=0; i<itemsN; i++){
+			if(!inside(&items[i].r, &item->r)){
+				items[n++] = items[i];
+			}
+		}
+		itemsN = n;
+		if(item->r.x0==0 && item->r.y0==0 && item->r.x1==WIDTH-1 && item->r.y1==HEIGHT-1){
+			base = *item;										//everything else was inside it
+			return;
+		}
+		if(item->type == ItemErase && baseIsMap()){
+			for(i=0; i<itemsN && (items[i].type == ItemErase || !overlaps(&items[i].r, &item->r)); i++){}
+			if(i == itemsN) return;						//only the map and other erases are under it
+		}
+	}
+	if(itemsN == ITEMS_N){
+		collect();
+	}
+	if(itemsN < ITEMS_N){
+		items[itemsN++] = *item;
+	} else {
+		itemsDropped++;										//it will be missing from the screen until drawn again
+	}
+}
+
+//draw the span of the laser in row y from column x0 to x1, dst[0] is column x0
+void paintBeam(uint8_t y, uint8_t x0, uint8_t x1, uint8_t *dst){
+	uint8_t k = y-laserBeam.top;
+	if(y<laserBeam.top || k>=laserBeam.rows) return;
+	uint8_t s0 = laserBeam.x0[k]&~LASER_EDGE, s1 = laserBeam.x1[k]&~LASER_EDGE;
+	for(uint8_t x=(s0>x0 ? s0 : x0); x<=s1 && x<=x1; x++){
+		if((x==s0 && laserBeam.x0[k]&LASER_EDGE) || (x==s1 && laserBeam.x1[k]&LASER_EDGE)){
+			dst[x-x0] = laserBeam.sprite[0];								//edge
+		} else {
+			dst[x-x0] = laserBeam.sprite[LASER_WIDTH+1];		//core
+		}
+	}
+}
+
+//draw the particles in row y from column x0 to x1, dst[0] is column x0
+void paintParticles(uint8_t y, uint8_t x0, uint8_t x1, uint8_t *dst){
+	for(uint8_t k=0; k<particlesN; k++){
+		if(particlesY[k]==y && particlesX[k]>=x0 && particlesX[k]<=x1){
+			dst[particlesX[k]-x0] = 0xFF;
+		}
+	}
+}
+
+//copy the background of row y from column x0 to x1 into dst, one tile run at a time
+void paintMap(uint8_t y, uint8_t x0, uint8_t x1, uint8_t *dst){
+	uint16_t i = WIDTH*(HEIGHT-1-y)+x0;
+	uint8_t n = x1-x0+1, k;
+	const uint8_t *src;
+	while(n){
+		k = n;
+		src = mapRun(i, &k);
+		i += k;
+		n -= k;
+		while(k--){
+			*dst++ = *src++;
+		}
+	}
+}
+
+//draw the part of an item in row y from column x0 to x1, dst[0] is column x0
+//items that show the background get it from paintMap() first and only draw their own pixels over it
+void paintRow(const Item *item, uint8_t y, uint8_t x0, uint8_t x1, uint8_t *dst){
+	const uint8_t *src;
+	uint8_t r = item->y-y;					//row of the item, 0 at the bottom
+	uint8_t c = x0-item->x;					//column of the item at x0
+	uint8_t x, p;
+
+	switch(item->type){
+		case ItemFill :
+			for(x=x0; x<=x1; x++){
+				*dst++ = item->color;
+			}
+			break;
+		case ItemErase :
+			paintMap(y, x0, x1, dst);
+			break;
+		case ItemImage :
+		case ItemImageBlack :
+			if(item->type == ItemImage){
+				paintMap(y, x0, x1, dst);
+			}
+			src = item->data+r*item->w+c;
+			for(x=x0; x<=x1; x++){
+				p = *src++;
+				if(p != 1){
+					*dst = p;
+				} else if(item->type == ItemImageBlack){
+					*dst = 0x00;
+				}
+				dst++;
+			}
+			break;
+		case ItemRaw :
+			src = item->data+r*item->w+c;
+			for(x=x0; x<=x1; x++){
+				*dst++ = *src++;
+			}
+			break;
+		case ItemOutline :
+			paintMap(y, x0, x1, dst);
+			for(x=x0; x<=x1; x++, c++){
+				if(r==0 || r==item->h-1 || c==0 || c==item->w-1){		//edge
+					*dst = item->color;
+				}
+				dst++;
+			}
+			break;
+		case ItemShip :
+		case ItemShipBlades :
+			paintMap(y, x0, x1, dst);
+			src = item->data+r*item->w+c;
+			for(x=x0; x<=x1; x++, c++){
+				p = *src++;
+				if(p != 1){
+					*dst = p == 0x07 ? item->color : p;
+				} else if(item->type == ItemShipBlades && (r==0 || r==item->h-1 || c==0 || c==item->w-1)){
+					*dst = 0x1c;
+				}
+				dst++;
+			}
+			break;
+		case ItemGlyph :
+			for(x=x0; x<=x1; x++, c++){
+				if(c<5 && (item->data[c]&(1<<(TEXT_HEIGHT-1-r)))){		//bit 0 is the top row
+					*dst = item->color;
+				}
+				dst++;
+			}
+			break;
+		case ItemBeam :
+			paintBeam(y, x0, x1, dst);
+			break;
+		case ItemParticles :
+			paintParticles(y, x0, x1, dst);
+			break;
+	}
+}
+
+//compose a region from the base and the items over it into out, top row first
+void composeRect(const ST7735_Rect *rect, uint8_t *out){
+	uint8_t i, n = 0, x0, x1;
+	Item *item;
+
+	for(i=0; i<itemsN; i++){				//only items touching the region are looked at for each row
+		if(overlaps(&items[i].r, rect)){
+			overlap[n++] = i;
+		}
+	}
+	for(uint8_t y=rect->y0; y<=rect->y1; y++){
+		paintRow(&base, y, rect->x0, rect->x1, out);
+		for(i=0; i<n; i++){
+			item = &items[overlap[i]];
+			if(y>=item->r.y0 && y<=item->r.y1){
+				x0 = item->r.x0>rect->x0 ? item->r.x0 : rect->x0;
+				x1 = item->r.x1<rect->x1 ? item->r.x1 : rect->x1;
+				paintRow(item, y, x0, x1, out+x0-rect->x0);
+			}
+		}
+		out += rect->x1-rect->x0+1;		//next row
+	}
+}
+
+//start over from a black screen
+void clear(void){
+	makeItem(&base, 0, HEIGHT-1, WIDTH, HEIGHT, ItemFill, 0x00, 0);
+	itemsN = 0;
+	particlesN = 0;
+	markDirty(0,HEIGHT-1,WIDTH,HEIGHT);
+}
+
+//start over from the background of game.map and its walls
+void drawMap(void){
+	showWalls();
+	makeItem(&base, 0, HEIGHT-1, WIDTH, HEIGHT, ItemErase, 0, 0);
+	itemsN = 0;
+	particlesN = 0;
+	markDirty(0,HEIGHT-1,WIDTH,HEIGHT);
+}
+
+//draw image
+void draw(int16_t x, int16_t y, const uint8_t *image, uint8_t w, uint8_t h){
+	Item item;
+	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
+	if(makeItem(&item, x, y, w, h, stage == Game ? ItemImage : ItemImageBlack, 0, image)){
+		markDirty(x,y,w,h);
+		submit(&item);
+	}
+}
+
+//draw compiled sprite, the display list paints its source image
+void drawSprite(int16_t x, int16_t y, const Sprite *sprite){
+	draw(x, y, sprite->image, sprite->w, sprite->h);
+}
+
+//draw rectangle
+void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
+	Item item;
+	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
+	if(makeItem(&item, x, y, w, h, ItemOutline, color, 0)){
+		markDirty(x,y,w,h);
+		submit(&item);
+	}
+}
+
+//draw filled rectangle
+void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color) {
+	Item item;
+	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
+	if(makeItem(&item, x, y, w, h, ItemFill, color, 0)){
+		markDirty(x,y,w,h);
+		submit(&item);
+	}
+}
+
+//fill rectangle with background
+void eraseRect(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+	Item item;
+	if(w>WIDTH || h>HEIGHT) return; //image is too wide for the screen, do nothing
+	if(makeItem(&item, x, y, w, h, ItemErase, 0, 0)){
+		markDirty(x,y,w,h);
+		submit(&item);
+	}
+}
+
+//draw a character as its background block and its font columns over it, (x,y) is the bottom left corner like draw()
+//characters not totally on the screen are skipped, like in LCDBuffer.c
+void drawChar(int16_t x, int16_t y, char c, uint8_t color, uint8_t bg){
+	Item item;
+	if(x<0 || x+TEXT_WIDTH>WIDTH || y-TEXT_HEIGHT+1<0 || y>=HEIGHT) return;
+	markDirty(x,y,TEXT_WIDTH,TEXT_HEIGHT);
+	makeItem(&item, x, y, TEXT_WIDTH, TEXT_HEIGHT, ItemFill, bg, 0);
+	submit(&item);								//drops the character drawn here before
+	makeItem(&item, x, y, TEXT_WIDTH, TEXT_HEIGHT, ItemGlyph, color, ST7735_Glyph(c));
+	submit(&item);
+}
+
+void drawPlayer(Player *player){
+	Item item;
+	uint8_t type = ItemShip;
+	if(player->powerUp == Blades && blades.displayed == 1){
+		type = ItemShipBlades;
+	}
+	if(makeItem(&item, FIX_INT(player->x), FIX_INT(player->y), PLAYER_WIDTH, PLAYER_HEIGHT, type, player->color, player->sprites[player->dir])){
+		markDirty(FIX_INT(player->x),FIX_INT(player->y),PLAYER_WIDTH,PLAYER_HEIGHT);
+		submit(&item);
+	}
+}
+
+void drawBullet(Bullet *bullet){
+	Item item;
+	if(makeItem(&item, FIX_INT(bullet->x), FIX_INT(bullet->y), BULLET_WIDTH, BULLET_HEIGHT, ItemRaw, 0, bullet->bulletSprite)){
+		markDirty(FIX_INT(bullet->x),FIX_INT(bullet->y),BULLET_WIDTH,BULLET_HEIGHT);
+		submit(&item);
+	}
+}
+
+//the spans of laserBeam are one item
+void drawLaser(void){
+	Item item;
+	uint8_t k, x0 = WIDTH-1, x1 = 0;
+	for(k=0; k<laserBeam.rows; k++){
+		uint8_t s0 = laserBeam.x0[k]&~LASER_EDGE, s1 = laserBeam.x1[k]&~LASER_EDGE;
+		markDirty(s0,laserBeam.top+k,s1-s0+1,1);
+		if(s0<x0) x0 = s0;
+		if(s1>x1) x1 = s1;
+	}
+	if(laserBeam.rows && makeItem(&item, x0, laserBeam.top+laserBeam.rows-1, x1-x0+1, laserBeam.rows, ItemBeam, 0, 0)){
+		submit(&item);
+	}
+}
+
+//take the laser off the screen, whatever it was drawn over shows again
+void eraseLaser(void){
+	uint8_t i, n = 0;
+	laserBeam.displayed = 0;
+	for(i=0; i<laserBeam.rows; i++){
+		uint8_t s0 = laserBeam.x0[i]&~LASER_EDGE, s1 = laserBeam.x1[i]&~LASER_EDGE;
+		markDirty(s0,laserBeam.top+i,s1-s0+1,1);
+	}
+	for(i=0; i<itemsN; i++){
+		if(items[i].type != ItemBeam){
+			items[n++] = items[i];
+		}
+	}
+	itemsN = n;
+}
+
+//the particles are one item over all of their pixels, moveParticles() draws them one after the other,
+//so only the first one of a frame puts the item back on top of the others
+void drawParticle(uint8_t x, uint8_t y){
+	Item item;
+	uint8_t i, n = 0;
+	if(x>=WIDTH || y>=HEIGHT || particlesN == PARTICLES_N) return;
+	markDirty(x,y,1,1);
+	particlesX[particlesN] = x;
+	particlesY[particlesN] = y;
+	particlesN++;
+	if(itemsN && items[itemsN-1].type == ItemParticles){		//already on top, grow it
+		ST7735_Rect *r = &items[itemsN-1].r;
+		if(x<r->x0) r->x0 = x;
+		if(x>r->x1) r->x1 = x;
+		if(y<r->y0) r->y0 = y;
+		if(y>r->y1) r->y1 = y;
+		return;
+	}
+	for(i=0; i<itemsN; i++){
+		if(items[i].type != ItemParticles){
+			items[n++] = items[i];
+		}
+	}
+	itemsN = n;
+	makeItem(&item, x, y, 1, 1, ItemParticles, 0xFF, 0);
+	for(i=0; i<particlesN; i++){		//the ones not erased yet still show
+		if(particlesX[i]<item.r.x0) item.r.x0 = particlesX[i];
+		if(particlesX[i]>item.r.x1) item.r.x1 = particlesX[i];
+		if(particlesY[i]<item.r.y0) item.r.y0 = particlesY[i];
+		if(particlesY[i]>item.r.y1) item.r.y1 = particlesY[i];
+	}
+	submit(&item);
+}
+
+//take one particle pixel off the screen, whatever it was drawn over shows again
+void eraseParticle(uint8_t x, uint8_t y){
+	for(uint8_t i=0; i<particlesN; i++){
+		if(particlesX[i]==x && particlesY[i]==y){
+			particlesN--;
+			particlesX[i] = particlesX[particlesN];
+			particlesY[i] = particlesY[particlesN];
+			markDirty(x,y,1,1);
+			return;
+		}
+	}
+}
+
+void drawPowerUp(PowerUp *powerUp){
+	Item item;
+	if(makeItem(&item, FIX_INT(powerUp->x), FIX_INT(powerUp->y), POWERUP_WIDTH, POWERUP_HEIGHT, ItemRaw, 0, powerUp->sprite)){
+		submit(&item);
+	}
+}
+
+#endif
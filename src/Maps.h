@@ -0,0 +1,2026 @@
+// File: Maps.h
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: Backgrounds of res/images/C cut into 194 shared 8x8 tiles, generated by res/images/MapCompile.py
+// Usage: Included by AstroParty.c, edit the maps in res/images/C and run the script instead of editing this
+
+#ifndef MAPS_H
+#define MAPS_H
+#include "GameObjects.h"
+
+const uint8_t MapTiles[194][TILE_SIZE*TILE_SIZE] = {
+  {//0
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//1
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//2
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//3
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//5
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//6
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//7
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  },
+  {//8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//9
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//10
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//11
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  },
+  {//12
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//13
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//14
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//15
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//16
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//17
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x24, 0x24,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x24, 0x20,
+  },
+  {//18
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//19
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x24, 0x24,
+  },
+  {//20
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x24, 0x24, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//21
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x20, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x20, 0x20, 0x20, 0x20,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//22
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//23
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20,
+    0x7C, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x7C, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x24,
+    0x7C, 0x24, 0x00, 0x20, 0x20, 0x20, 0x24, 0x20,
+    0x7C, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20,
+  },
+  {//24
+    0x00, 0x7C, 0x7C, 0x24, 0x00, 0x20, 0x00, 0x20,
+    0x20, 0x7C, 0x7C, 0x00, 0x00, 0x24, 0x00, 0x20,
+    0x20, 0x7C, 0x7C, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x24, 0x7C, 0x7C, 0x20, 0x24, 0x00, 0x20, 0x24,
+    0x24, 0x7C, 0x7C, 0x24, 0x00, 0x00, 0x20, 0x24,
+    0x00, 0x7C, 0x7C, 0x20, 0x00, 0x20, 0x24, 0x24,
+    0x00, 0x7C, 0x7C, 0x00, 0x20, 0x20, 0x24, 0x00,
+    0x20, 0x7C, 0x7C, 0x20, 0x20, 0x20, 0x20, 0x00,
+  },
+  {//25
+    0x20, 0x24, 0x00, 0x7C, 0x7C, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x24,
+    0x24, 0x00, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x24,
+    0x24, 0x00, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x24,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x24, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+  },
+  {//26
+    0x24, 0x00, 0x20, 0x20, 0x20, 0x7C, 0x24, 0x00,
+    0x24, 0x00, 0x20, 0x20, 0x20, 0x7C, 0x24, 0x00,
+    0x00, 0x00, 0x24, 0x20, 0x20, 0x7C, 0x24, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x00,
+  },
+  {//27
+    0x20, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//28
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x24,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//29
+    0x00, 0x20, 0x7C, 0x20, 0x24, 0x20, 0x20, 0x00,
+    0x24, 0x24, 0x7C, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x7C, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x20, 0x7C, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x7C, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x24, 0x20, 0x7C, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//30
+    0x24, 0x00, 0x20, 0x7C, 0x7C, 0x20, 0x24, 0x20,
+    0x24, 0x24, 0x00, 0x7C, 0x7C, 0x20, 0x24, 0x24,
+    0x00, 0x24, 0x00, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x20, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x7C, 0x7C, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7C, 0x7C, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x7C, 0x7C, 0x00, 0x24, 0x20,
+  },
+  {//31
+    0x20, 0x24, 0x20, 0x20, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x7C, 0x7C, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x7C, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x7C, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7C, 0x7C, 0x00,
+    0x20, 0x20, 0x24, 0x24, 0x24, 0x7C, 0x7C, 0x20,
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x7C, 0x7C, 0x20,
+    0x20, 0x00, 0x20, 0x24, 0x20, 0x7C, 0x7C, 0x20,
+  },
+  {//32
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//33
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x24,
+  },
+  {//34
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x20, 0x00, 0x20, 0x24, 0x20, 0x00, 0x00, 0x00,
+  },
+  {//35
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x24, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+  },
+  {//36
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x24, 0x24,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//37
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x00, 0x00,
+  },
+  {//38
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//39
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00,
+  },
+  {//40
+    0x24, 0x20, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//41
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x24, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//42
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//43
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x00, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//44
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//45
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+  },
+  {//46
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//47
+    0x00, 0x00, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00,
+  },
+  {//48
+    0x20, 0x24, 0x00, 0x24, 0x20, 0x00, 0x20, 0x20,
+    0x24, 0x00, 0x20, 0x24, 0x00, 0x20, 0x20, 0x20,
+    0x24, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x20,
+  },
+  {//49
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+  },
+  {//50
+    0x20, 0x20, 0x20, 0x24, 0x00, 0x24, 0x00, 0x20,
+    0x20, 0x20, 0x24, 0x20, 0x00, 0x24, 0x00, 0x20,
+    0x20, 0x20, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x20, 0x00, 0x24, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20,
+  },
+  {//51
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+  },
+  {//52
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//53
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x00, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//54
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//55
+    0x24, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x24, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x20, 0x00, 0x20, 0x20, 0x00, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x24, 0x20,
+  },
+  {//56
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x24, 0x00,
+  },
+  {//57
+    0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//58
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//59
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x24, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//60
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00, 0x20,
+    0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x00, 0x20,
+    0x20, 0x20, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//61
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//62
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//63
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//64
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20, 0x20,
+  },
+  {//65
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24,
+  },
+  {//66
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//67
+    0x24, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x24, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//68
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x00, 0x00, 0x20, 0x24, 0x20,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+    0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x00, 0x24,
+  },
+  {//69
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+  },
+  {//70
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//71
+    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//72
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//73
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//74
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//75
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00,
+    0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x20,
+  },
+  {//76
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//77
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//78
+    0x20, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//79
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+  },
+  {//80
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x24, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//81
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+  },
+  {//82
+    0x20, 0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x24, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x20, 0x00, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//83
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//84
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//85
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//86
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//87
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//88
+    0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0x7C,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x24, 0x00, 0x7C,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x7C,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//89
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//90
+    0x00, 0x7C, 0x7C, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x7C, 0x7C, 0x00, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//91
+    0x20, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//92
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  },
+  {//93
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//94
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//95
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//96
+    0x20, 0x20, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//97
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+  },
+  {//98
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//99
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+  },
+  {//100
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//101
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  },
+  {//102
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//103
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//104
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+  },
+  {//105
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  },
+  {//106
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//107
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//108
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//109
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//110
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//111
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//112
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//113
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+  },
+  {//114
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//115
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//116
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+  },
+  {//117
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//118
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+  },
+  {//119
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//120
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+  },
+  {//121
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//122
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+  },
+  {//123
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//124
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+  },
+  {//125
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//126
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+  },
+  {//127
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+  },
+  {//128
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x00, 0x00, 0x00,
+  },
+  {//129
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+  },
+  {//130
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+  },
+  {//131
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+    0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C,
+  },
+  {//132
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//133
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//134
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+  },
+  {//135
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+  },
+  {//136
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+  },
+  {//137
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//138
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//139
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//140
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+  },
+  {//141
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20,
+  },
+  {//142
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x20, 0x24, 0x20, 0x00, 0x24, 0x00, 0x20, 0x20,
+  },
+  {//143
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x24, 0x20,
+  },
+  {//144
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//145
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x00, 0x24, 0x20, 0x20, 0x20, 0x24, 0x24,
+  },
+  {//146
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
+  },
+  {//147
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x24, 0x20,
+    0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20,
+  },
+  {//148
+    0x00, 0x20, 0x24, 0x24, 0x00, 0x20, 0x00, 0x20,
+    0x20, 0x20, 0x24, 0x00, 0x00, 0x24, 0x00, 0x20,
+    0x20, 0x24, 0x20, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x24, 0x20, 0x00, 0x20, 0x24, 0x00, 0x20, 0x24,
+    0x24, 0x00, 0x20, 0x24, 0x00, 0x00, 0x20, 0x24,
+    0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x24, 0x24,
+    0x00, 0x20, 0x24, 0x00, 0x20, 0x20, 0x24, 0x00,
+    0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,
+  },
+  {//149
+    0x20, 0x24, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20, 0x24,
+    0x24, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x24,
+    0x24, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x24, 0x00, 0x00, 0x20, 0x20, 0x20,
+  },
+  {//150
+    0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00,
+    0x24, 0x00, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00,
+    0x00, 0x00, 0x24, 0x20, 0x20, 0x20, 0x24, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+  },
+  {//151
+    0x00, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//152
+    0x24, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x20,
+    0x24, 0x24, 0x00, 0x24, 0x20, 0x20, 0x24, 0x24,
+    0x00, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20, 0x20,
+    0x00, 0x20, 0x20, 0x00, 0x24, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x24, 0x20,
+  },
+  {//153
+    0x20, 0x24, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00,
+    0x00, 0x24, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x20, 0x20, 0x24, 0x20, 0x20,
+    0x20, 0x00, 0x20, 0x24, 0x20, 0x20, 0x24, 0x20,
+  },
+  {//154
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//155
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x00, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x20, 0x00, 0x20, 0x24, 0x20, 0x00, 0x00, 0x00,
+  },
+  {//156
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x24, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+  },
+  {//157
+    0x00, 0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x24,
+    0x24, 0x20, 0x00, 0x20, 0x20, 0x20, 0x24, 0x24,
+    0x20, 0x00, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//158
+    0x24, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x20, 0x20, 0x24, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x20, 0x00, 0x00,
+  },
+  {//159
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//160
+    0x20, 0x20, 0x00, 0x00, 0x24, 0x00, 0x24, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x24, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//161
+    0x20, 0x20, 0x00, 0x24, 0x24, 0x00, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x24, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//162
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x00, 0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//163
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//164
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0xE7, 0x20, 0x00, 0x20, 0x20, 0x20,
+  },
+  {//165
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+  },
+  {//166
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+  },
+  {//167
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//168
+    0x00, 0x00, 0xE7, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0xE7, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0xE7, 0x00, 0x00, 0x24, 0x20, 0x20,
+    0x00, 0x00, 0xE7, 0x00, 0x20, 0x24, 0x00, 0x20,
+    0xE7, 0xE7, 0xE7, 0x20, 0x24, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//169
+    0x20, 0x20, 0x20, 0x20, 0x24, 0x00, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x24,
+  },
+  {//170
+    0x20, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0xE7, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0xE7, 0xE7, 0xE7,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,
+    0x24, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  },
+  {//171
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+  },
+  {//172
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//173
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+  },
+  {//174
+    0x20, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//175
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//176
+    0x20, 0x20, 0x24, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x24, 0x00, 0x20, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x24, 0x20, 0x20,
+    0x24, 0x24, 0x24, 0x20, 0x00, 0x24, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  },
+  {//177
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0x20,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//178
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x24, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//179
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//180
+    0x20, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x20, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xE7,
+    0x20, 0x20, 0x20, 0x00, 0x24, 0x00, 0x00, 0xE7,
+    0x20, 0x20, 0x20, 0x00, 0x00, 0x24, 0x00, 0xE7,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0xE7,
+    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+  },
+  {//181
+    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//182
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//183
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//184
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//185
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  {//186
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+  },
+  {//187
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+  },
+  {//188
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+  },
+  {//189
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  },
+  {//190
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  },
+  {//191
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  },
+  {//192
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x00, 0x00,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  },
+  {//193
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+  },
+};
+
+const uint8_t Corner_Tiles[320] = {
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x04, 0x04, 0x08, 0x09, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0B, 0x04, 0x04, 0x0C, 0x0D, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x0E, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x04, 0x05,
+  0x03, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x05,
+  0x03, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4A, 0x4B, 0x4C, 0x0E, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+  0x03, 0x59, 0x04, 0x03, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x05, 0x04, 0x62, 0x63,
+  0x03, 0x04, 0x04, 0x01, 0x01, 0x64, 0x65, 0x04, 0x04, 0x66, 0x67, 0x01, 0x01, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x68, 0x69, 0x04, 0x04, 0x6A, 0x6B, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x6C, 0x6D, 0x04, 0x04, 0x6E, 0x6F, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+  0x70, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x71,
+};
+const TileMap Corner_Map = {MapTiles, Corner_Tiles};
+
+const uint8_t Hall_Tiles[320] = {
+  0x72, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x77, 0x78, 0x04, 0x04, 0x04, 0x04, 0x77, 0x78, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x79, 0x7A, 0x04, 0x04, 0x04, 0x04, 0x79, 0x7A, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7B, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x7B, 0x7C, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7D, 0x7E, 0x04, 0x04, 0x04, 0x04, 0x7D, 0x7E, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7F, 0x80, 0x04, 0x04, 0x04, 0x04, 0x7F, 0x80, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x77, 0x78, 0x04, 0x04, 0x04, 0x04, 0x77, 0x78, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x79, 0x7A, 0x04, 0x04, 0x04, 0x04, 0x79, 0x7A, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7B, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x7B, 0x7C, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7D, 0x7E, 0x04, 0x04, 0x04, 0x04, 0x7D, 0x7E, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x7F, 0x80, 0x04, 0x04, 0x04, 0x04, 0x7F, 0x80, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x75, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x76,
+  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
+};
+const TileMap Hall_Map = {MapTiles, Hall_Tiles};
+
+const uint8_t Cache_Tiles[320] = {
+  0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x87, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x88,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8A, 0x8B, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x8D, 0x8E, 0x8F, 0x12, 0x13, 0x90, 0x91, 0x92, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x93, 0x94, 0x95, 0x96, 0x1B, 0x1C, 0x97, 0x98, 0x99, 0x9A, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x21, 0x9B, 0x9C, 0x9D, 0x9E, 0x26, 0x27, 0x9F, 0xA0, 0xA1, 0xA2, 0x2C, 0x04, 0x8C,
+  0xA3, 0xA4, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xA5, 0xA6,
+  0xA7, 0xA8, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0xA9, 0x46, 0x47, 0xAA, 0xAB,
+  0xAC, 0x4B, 0x4C, 0x04, 0xAD, 0xAE, 0xAF, 0x50, 0x51, 0xB0, 0xB1, 0xB2, 0xB3, 0x56, 0x57, 0xB4,
+  0x89, 0x59, 0x04, 0x04, 0xB5, 0xB6, 0x04, 0x5D, 0x5E, 0xB7, 0xB8, 0xB9, 0x04, 0x04, 0x62, 0xBA,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0x89, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xBB, 0xBC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x8C,
+  0xBD, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBF, 0xC0, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xC1,
+};
+const TileMap Cache_Map = {MapTiles, Cache_Tiles};
+
+#endif
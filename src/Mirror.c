@@ -0,0 +1,150 @@
+// File: Mirror.c
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: This software streams what the screen buffer holds to a host over UART0
+// Usage: Define LCD_MIRROR in the project, flushBuffer() hands each frame's changed regions to Mirror_Frame();
+//        each frame is a packet of the 8x8 blocks that changed, run length encoded:
+//          0xA5 0x5A frame   then for each block   block/256 block%256 tokens   then 0xFF 0xFF
+//        blocks are numbered row by row from the top left, 16 to a row, and hold 64 pixels top row first
+//        token 0x00-0x7F: n+1 colors follow, 0x80-0xFF: one color follows, repeated (n&0x7F)+1 times
+
+#include "Mirror.h"
+#include "tm4c123gh6pm.h"
+
+#ifdef LCD_MIRROR
+
+#define BLOCK_COLS (ST7735_TFTWIDTH/TILE_SIZE)
+#define BLOCKS_N (BLOCK_COLS*(ST7735_TFTHEIGHT/TILE_SIZE))
+#define BLOCK_PIXELS (TILE_SIZE*TILE_SIZE)
+#define RECORD_N (2+BLOCK_PIXELS+1)	//longest block, runs of 3 or more cost no more than literals
+#define RUN 0x80										//token bit of a repeated color
+#define RUN_MIN 3
+
+//blocks changed on the screen but not sent yet, one bit per block
+uint8_t mirrorPending[BLOCKS_N/8];
+uint16_t mirrorNext = 0;		//block to look at first, so a block cut off by the budget goes first next frame
+uint8_t mirrorFrameN = 0;		//numbers the packets so the host can tell when one was lost
+
+//bytes waiting for the UART, Mirror_Frame() moves the head and UART0_Handler() the tail
+uint8_t mirrorRing[MIRROR_BUDGET];
+volatile uint16_t mirrorHead = 0, mirrorTail = 0;
+
+void Mirror_Init(void){
+	SYSCTL_RCGCUART_R |= 0x01;							//activate UART0
+	SYSCTL_RCGCGPIO_R |= 0x01;							//activate port A
+	while((SYSCTL_PRUART_R&0x01)==0){};
+	UART0_CTL_R &= ~UART_CTL_UARTEN;				//disable UART during setup
+	UART0_IBRD_R = MIRROR_BAUD_IBRD;
+	UART0_FBRD_R = MIRROR_BAUD_FBRD;
+	UART0_LCRH_R = UART_LCRH_WLEN_8|UART_LCRH_FEN;	//8 bit, no parity, one stop, FIFOs
+	UART0_CC_R = UART_CC_CS_SYSCLK;
+	UART0_IFLS_R = (UART0_IFLS_R&~UART_IFLS_TX_M)|UART_IFLS_TX1_8;	//interrupt when 2 bytes are left
+	UART0_IM_R = UART_IM_TXIM;
+	UART0_CTL_R = UART_CTL_UARTEN|UART_CTL_TXE;
+	GPIO_PORTA_AFSEL_R |= 0x03;							//UART on PA0,1, the rest of port A is the LCD
+	GPIO_PORTA_DEN_R |= 0x03;
+	GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
+	GPIO_PORTA_AMSEL_R &= ~0x03;
+	NVIC_PRI1_R = (NVIC_PRI1_R&0xFFFF00FF)|0x0000E000;	//priority 7, below the sound, SysTick and LCD
+	NVIC_EN0_R = 1<<5;											//enable IRQ 5 in NVIC
+	for(uint8_t i=0; i<BLOCKS_N/8; i++){		//the host starts out with nothing
+		mirrorPending[i] = 0xFF;
+	}
+}
+
+//move bytes from the ring into the UART FIFO until either runs out
+void mirrorSend(void){
+	uint16_t tail = mirrorTail;
+	while(tail != mirrorHead && (UART0_FR_R&UART_FR_TXFF) == 0){
+		UART0_DR_R = mirrorRing[tail];
+		tail = (tail+1)&(MIRROR_BUDGET-1);
+	}
+	mirrorTail = tail;
+}
+
+void UART0_Handler(void){
+	UART0_ICR_R = UART_ICR_TXIC;
+	mirrorSend();
+}
+
+void mirrorPut(uint8_t data){
+	mirrorRing[mirrorHead] = data;
+	mirrorHead = (mirrorHead+1)&(MIRROR_BUDGET-1);
+}
+
+//run length encode a block's pixels into out, returns the bytes used
+uint8_t encodeBlock(const uint8_t *pixels, uint8_t *out){
+	uint8_t i = 0, n, len = 0;
+	uint8_t *literal = 0;				//token of the colors being collected, 0 if none
+	while(i<BLOCK_PIXELS){
+		n = 1;
+		while(i+n<BLOCK_PIXELS && pixels[i+n]==pixels[i]){
+			n++;
+		}
+		if(n>=RUN_MIN){
+			out[len++] = RUN+n-1;
+			out[len++] = pixels[i];
+			literal = 0;
+			i += n;
+		} else {
+			if(literal == 0){
+				literal = &out[len++];
+				*literal = 0xFF;				//becomes 0 with the first color
+			}
+			(*literal)++;
+			out[len++] = pixels[i++];
+		}
+	}
+	return len;
+}
+
+void Mirror_Frame(const ST7735_Rect *rects, uint8_t n){
+	uint8_t pixels[BLOCK_PIXELS], record[RECORD_N];
+	ST7735_Rect block;
+	uint16_t room, b, i;
+	uint8_t bx, by, len;
+
+	for(i=0; i<n; i++){
+		for(by=rects[i].y0/TILE_SIZE; by<=rects[i].y1/TILE_SIZE; by++){
+			for(bx=rects[i].x0/TILE_SIZE; bx<=rects[i].x1/TILE_SIZE; bx++){
+				b = by*BLOCK_COLS+bx;
+				mirrorPending[b/8] |= 1<<(b%8);
+			}
+		}
+	}
+
+	room = (mirrorTail-mirrorHead-1)&(MIRROR_BUDGET-1);		//the tail only moves on, so this only grows
+	if(room < 5+RECORD_N) return;				//last frame is still going out, its blocks stay pending
+	room -= 5;													//header and end
+	mirrorPut(0xA5);
+	mirrorPut(0x5A);
+	mirrorPut(mirrorFrameN++);
+	b = mirrorNext;
+	for(i=0; i<BLOCKS_N; i++){
+		if(mirrorPending[b/8] & (1<<(b%8))){
+			block.x0 = (b%BLOCK_COLS)*TILE_SIZE;
+			block.y0 = (b/BLOCK_COLS)*TILE_SIZE;
+			block.x1 = block.x0+TILE_SIZE-1;
+			block.y1 = block.y0+TILE_SIZE-1;
+			composeRect(&block, pixels);
+			record[0] = b>>8;
+			record[1] = b&0xFF;
+			len = 2+encodeBlock(pixels, &record[2]);
+			if(len > room) break;							//over the budget, send it first next frame
+			for(uint8_t k=0; k<len; k++){
+				mirrorPut(record[k]);
+			}
+			room -= len;
+			mirrorPending[b/8] &= ~(1<<(b%8));
+		}
+		b = (b+1)%BLOCKS_N;
+	}
+	mirrorNext = b;
+	mirrorPut(0xFF);
+	mirrorPut(0xFF);
+	NVIC_DIS0_R = 1<<5;									//UART0_Handler() also moves the tail, one already pending waits in NVIC
+	mirrorSend();
+	NVIC_EN0_R = 1<<5;
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef MIRROR_H
+#define MIRROR_H
+#include <stdint.h>
+#include "LCDBuffer.h"
+
+//sends the screen to a host over UART0 as each frame is flushed, built when LCD_MIRROR is defined
+//tools/MirrorDecode.py turns the stream back into images
+#define MIRROR_BAUD_IBRD 5		//921600 baud at 80MHz, 80000000/(16*921600) = 5+27/64
+#define MIRROR_BAUD_FBRD 27
+
+//bytes a frame may queue, also the size of the transmit ring, a power of 2
+//921600 baud sends about 3000 bytes in one 30Hz frame, so the ring is empty again by the next flush
+#if LCDBUFFER_MODE == LCDBUFFER_8BPP
+#define MIRROR_BUDGET 512			//screenBuffer leaves little RAM
+#else
+#define MIRROR_BUDGET 2048
+#endif
+
+//start UART0 on PA0/PA1 and mark the whole screen to be sent
+void Mirror_Init(void);
+
+//queue the parts of the screen changed by the frame being flushed, never waits for the UART
+//rects are the changed regions, blocks that do not fit in the budget go out with later frames
+void Mirror_Frame(const ST7735_Rect *rects, uint8_t n);
+
+#endif
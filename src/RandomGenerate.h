@@ -1,9 +1,9 @@
-#ifndef RANDONGENERATE_H
-#define RANDOMGENERATE_H
-#include <stdint.h>
-
-void Seed(void);
-
-uint32_t randomGenerate(uint32_t min, uint32_t max);
-
-#endif
+#ifndef RANDONGENERATE_H
+#define RANDOMGENERATE_H
+#include <stdint.h>
+
+void Seed(void);
+
+uint32_t randomGenerate(uint32_t min, uint32_t max);
+
+#endif
@@ -1,1635 +1,2238 @@
-/***************************************************
-  This is a library for the Adafruit 1.8" SPI display.
-  This library works with the Adafruit 1.8" TFT Breakout w/SD card
-  ----> http://www.adafruit.com/products/358
-  as well as Adafruit raw 1.8" TFT displayun
-  ----> http://www.adafruit.com/products/618
-
-  Check out the links above for our tutorials and wiring diagrams
-  These displays use SPI to communicate, 4 or 5 pins are required to
-  interface (RST is optional)
-  Adafruit invests time and resources providing this open source code,
-  please support Adafruit and open-source hardware by purchasing
-  products from Adafruit!
-
-  Written by Limor Fried/Ladyada for Adafruit Industries.
-  MIT license, all text above must be included in any redistribution
- ****************************************************/
-
-// ST7735.c
-// Runs on LM4F120/TM4C123
-// Low level drivers for the ST7735 160x128 LCD based off of
-// the file described above.
-//    16-bit color, 128 wide by 160 high LCD
-// Daniel Valvano
-// September 12, 2013
-// Augmented 7/17/2014 to have a simple graphics facility
-// Tested with LaunchPadDLL.dll simulator 9/2/2014
-// Last Modified: 3/6/2015 
-/* This example accompanies the book
-   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
-   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2014
-
- Copyright 2014 by Jonathan W. Valvano, valvano@mail.utexas.edu
-    You may use, edit, run or distribute this file
-    as long as the above copyright notice remains
- THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
- OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
- MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
- VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
- OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
- For more information about my classes, my research, and my books, see
- http://users.ece.utexas.edu/~valvano/
- */
-
-// Backlight (pin 10) connected to +3.3 V
-// MISO (pin 9) unconnected
-// SCK (pin 8) connected to PA2 (SSI0Clk)
-// MOSI (pin 7) connected to PA5 (SSI0Tx)
-// TFT_CS (pin 6) connected to PA3 (SSI0Fss)
-// CARD_CS (pin 5) unconnected
-// Data/Command (pin 4) connected to PA6 (GPIO), high for data, low for command
-// RESET (pin 3) connected to PA7 (GPIO)
-// VCC (pin 2) connected to +3.3 V
-// Gnd (pin 1) connected to ground
-#include <stdio.h>
-#include <stdint.h>
-#include "ST7735.h"
-#include "tm4c123gh6pm.h"
-
-// 16 rows (0 to 15) and 21 characters (0 to 20)
-// Requires (11 + size*size*6*8) bytes of transmission for each character
-uint32_t StX=0; // position along the horizonal axis 0 to 20 
-uint32_t StY=0; // position along the vertical axis 0 to 15
-uint16_t StTextColor = ST7735_WHITE;
-
-#define ST7735_NOP     0x00
-#define ST7735_SWRESET 0x01
-#define ST7735_RDDID   0x04
-#define ST7735_RDDST   0x09
-
-#define ST7735_SLPIN   0x10
-#define ST7735_SLPOUT  0x11
-#define ST7735_PTLON   0x12
-#define ST7735_NORON   0x13
-
-#define ST7735_INVOFF  0x20
-#define ST7735_INVON   0x21
-#define ST7735_DISPOFF 0x28
-#define ST7735_DISPON  0x29
-#define ST7735_CASET   0x2A
-#define ST7735_RASET   0x2B
-#define ST7735_RAMWR   0x2C
-#define ST7735_RAMRD   0x2E
-
-#define ST7735_PTLAR   0x30
-#define ST7735_COLMOD  0x3A
-#define ST7735_MADCTL  0x36
-
-#define ST7735_FRMCTR1 0xB1
-#define ST7735_FRMCTR2 0xB2
-#define ST7735_FRMCTR3 0xB3
-#define ST7735_INVCTR  0xB4
-#define ST7735_DISSET5 0xB6
-
-#define ST7735_PWCTR1  0xC0
-#define ST7735_PWCTR2  0xC1
-#define ST7735_PWCTR3  0xC2
-#define ST7735_PWCTR4  0xC3
-#define ST7735_PWCTR5  0xC4
-#define ST7735_VMCTR1  0xC5
-
-#define ST7735_RDID1   0xDA
-#define ST7735_RDID2   0xDB
-#define ST7735_RDID3   0xDC
-#define ST7735_RDID4   0xDD
-
-#define ST7735_PWCTR6  0xFC
-
-#define ST7735_GMCTRP1 0xE0
-#define ST7735_GMCTRN1 0xE1
-
-#define TFT_CS                  (*((volatile uint32_t *)0x40004020))
-#define TFT_CS_LOW              0           // CS normally controlled by hardware
-#define TFT_CS_HIGH             0x08
-#define DC                      (*((volatile uint32_t *)0x40004100))
-#define DC_COMMAND              0
-#define DC_DATA                 0x40
-#define RESET                   (*((volatile uint32_t *)0x40004200))
-#define RESET_LOW               0
-#define RESET_HIGH              0x80
-
-#define SSI_CR0_SCR_M           0x0000FF00  // SSI Serial Clock Rate
-#define SSI_CR0_SPH             0x00000080  // SSI Serial Clock Phase
-#define SSI_CR0_SPO             0x00000040  // SSI Serial Clock Polarity
-#define SSI_CR0_FRF_M           0x00000030  // SSI Frame Format Select
-#define SSI_CR0_FRF_MOTO        0x00000000  // Freescale SPI Frame Format
-#define SSI_CR0_DSS_M           0x0000000F  // SSI Data Size Select
-#define SSI_CR0_DSS_8           0x00000007  // 8-bit data
-#define SSI_CR1_MS              0x00000004  // SSI Master/Slave Select
-#define SSI_CR1_SSE             0x00000002  // SSI Synchronous Serial Port
-                                            // Enable
-#define SSI_SR_BSY              0x00000010  // SSI Busy Bit
-#define SSI_SR_TNF              0x00000002  // SSI Transmit FIFO Not Full
-#define SSI_CPSR_CPSDVSR_M      0x000000FF  // SSI Clock Prescale Divisor
-#define SSI_CC_CS_M             0x0000000F  // SSI Baud Clock Source
-#define SSI_CC_CS_SYSPLL        0x00000000  // Either the system clock (if the
-                                            // PLL bypass is in effect) or the
-                                            // PLL output (default)
-#define SYSCTL_RCGC1_SSI0       0x00000010  // SSI0 Clock Gating Control
-#define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
-#define ST7735_TFTWIDTH  128
-#define ST7735_TFTHEIGHT 160
-
-#define ST7735_NOP     0x00
-#define ST7735_SWRESET 0x01
-#define ST7735_RDDID   0x04
-#define ST7735_RDDST   0x09
-
-#define ST7735_SLPIN   0x10
-#define ST7735_SLPOUT  0x11
-#define ST7735_PTLON   0x12
-#define ST7735_NORON   0x13
-
-#define ST7735_INVOFF  0x20
-#define ST7735_INVON   0x21
-#define ST7735_DISPOFF 0x28
-#define ST7735_DISPON  0x29
-#define ST7735_CASET   0x2A
-#define ST7735_RASET   0x2B
-#define ST7735_RAMWR   0x2C
-#define ST7735_RAMRD   0x2E
-
-#define ST7735_PTLAR   0x30
-#define ST7735_COLMOD  0x3A
-#define ST7735_MADCTL  0x36
-
-#define ST7735_FRMCTR1 0xB1
-#define ST7735_FRMCTR2 0xB2
-#define ST7735_FRMCTR3 0xB3
-#define ST7735_INVCTR  0xB4
-#define ST7735_DISSET5 0xB6
-
-#define ST7735_PWCTR1  0xC0
-#define ST7735_PWCTR2  0xC1
-#define ST7735_PWCTR3  0xC2
-#define ST7735_PWCTR4  0xC3
-#define ST7735_PWCTR5  0xC4
-#define ST7735_VMCTR1  0xC5
-
-#define ST7735_RDID1   0xDA
-#define ST7735_RDID2   0xDB
-#define ST7735_RDID3   0xDC
-#define ST7735_RDID4   0xDD
-
-#define ST7735_PWCTR6  0xFC
-
-#define ST7735_GMCTRP1 0xE0
-#define ST7735_GMCTRN1 0xE1
-
-// standard ascii 5x7 font
-// originally from glcdfont.c from Adafruit project
-static const uint8_t Font[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3E, 0x5B, 0x4F, 0x5B, 0x3E,
-  0x3E, 0x6B, 0x4F, 0x6B, 0x3E,
-  0x1C, 0x3E, 0x7C, 0x3E, 0x1C,
-  0x18, 0x3C, 0x7E, 0x3C, 0x18,
-  0x1C, 0x57, 0x7D, 0x57, 0x1C,
-  0x1C, 0x5E, 0x7F, 0x5E, 0x1C,
-  0x00, 0x18, 0x3C, 0x18, 0x00,
-  0xFF, 0xE7, 0xC3, 0xE7, 0xFF,
-  0x00, 0x18, 0x24, 0x18, 0x00,
-  0xFF, 0xE7, 0xDB, 0xE7, 0xFF,
-  0x30, 0x48, 0x3A, 0x06, 0x0E,
-  0x26, 0x29, 0x79, 0x29, 0x26,
-  0x40, 0x7F, 0x05, 0x05, 0x07,
-  0x40, 0x7F, 0x05, 0x25, 0x3F,
-  0x5A, 0x3C, 0xE7, 0x3C, 0x5A,
-  0x7F, 0x3E, 0x1C, 0x1C, 0x08,
-  0x08, 0x1C, 0x1C, 0x3E, 0x7F,
-  0x14, 0x22, 0x7F, 0x22, 0x14,
-  0x5F, 0x5F, 0x00, 0x5F, 0x5F,
-  0x06, 0x09, 0x7F, 0x01, 0x7F,
-  0x00, 0x66, 0x89, 0x95, 0x6A,
-  0x60, 0x60, 0x60, 0x60, 0x60,
-  0x94, 0xA2, 0xFF, 0xA2, 0x94,
-  0x08, 0x04, 0x7E, 0x04, 0x08,
-  0x10, 0x20, 0x7E, 0x20, 0x10,
-  0x08, 0x08, 0x2A, 0x1C, 0x08,
-  0x08, 0x1C, 0x2A, 0x08, 0x08,
-  0x1E, 0x10, 0x10, 0x10, 0x10,
-  0x0C, 0x1E, 0x0C, 0x1E, 0x0C,
-  0x30, 0x38, 0x3E, 0x38, 0x30,
-  0x06, 0x0E, 0x3E, 0x0E, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5F, 0x00, 0x00,
-  0x00, 0x07, 0x00, 0x07, 0x00,
-  0x14, 0x7F, 0x14, 0x7F, 0x14,
-  0x24, 0x2A, 0x7F, 0x2A, 0x12,
-  0x23, 0x13, 0x08, 0x64, 0x62,
-  0x36, 0x49, 0x56, 0x20, 0x50,
-  0x00, 0x08, 0x07, 0x03, 0x00,
-  0x00, 0x1C, 0x22, 0x41, 0x00,
-  0x00, 0x41, 0x22, 0x1C, 0x00,
-  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,
-  0x08, 0x08, 0x3E, 0x08, 0x08,
-  0x00, 0x80, 0x70, 0x30, 0x00,
-  0x08, 0x08, 0x08, 0x08, 0x08,
-  0x00, 0x00, 0x60, 0x60, 0x00,
-  0x20, 0x10, 0x08, 0x04, 0x02,
-  0x3E, 0x51, 0x49, 0x45, 0x3E, // 0
-  0x00, 0x42, 0x7F, 0x40, 0x00, // 1
-  0x72, 0x49, 0x49, 0x49, 0x46, // 2
-  0x21, 0x41, 0x49, 0x4D, 0x33, // 3
-  0x18, 0x14, 0x12, 0x7F, 0x10, // 4
-  0x27, 0x45, 0x45, 0x45, 0x39, // 5
-  0x3C, 0x4A, 0x49, 0x49, 0x31, // 6
-  0x41, 0x21, 0x11, 0x09, 0x07, // 7
-  0x36, 0x49, 0x49, 0x49, 0x36, // 8
-  0x46, 0x49, 0x49, 0x29, 0x1E, // 9
-  0x00, 0x00, 0x14, 0x00, 0x00,
-  0x00, 0x40, 0x34, 0x00, 0x00,
-  0x00, 0x08, 0x14, 0x22, 0x41,
-  0x14, 0x14, 0x14, 0x14, 0x14,
-  0x00, 0x41, 0x22, 0x14, 0x08,
-  0x02, 0x01, 0x59, 0x09, 0x06,
-  0x3E, 0x41, 0x5D, 0x59, 0x4E,
-  0x7C, 0x12, 0x11, 0x12, 0x7C, // A
-  0x7F, 0x49, 0x49, 0x49, 0x36, // B
-  0x3E, 0x41, 0x41, 0x41, 0x22, // C
-  0x7F, 0x41, 0x41, 0x41, 0x3E, // D
-  0x7F, 0x49, 0x49, 0x49, 0x41, // E
-  0x7F, 0x09, 0x09, 0x09, 0x01, // F
-  0x3E, 0x41, 0x41, 0x51, 0x73, // G
-  0x7F, 0x08, 0x08, 0x08, 0x7F, // H
-  0x00, 0x41, 0x7F, 0x41, 0x00, // I
-  0x20, 0x40, 0x41, 0x3F, 0x01, // J
-  0x7F, 0x08, 0x14, 0x22, 0x41, // K
-  0x7F, 0x40, 0x40, 0x40, 0x40, // L
-  0x7F, 0x02, 0x1C, 0x02, 0x7F, // M
-  0x7F, 0x04, 0x08, 0x10, 0x7F, // N
-  0x3E, 0x41, 0x41, 0x41, 0x3E, // O
-  0x7F, 0x09, 0x09, 0x09, 0x06, // P
-  0x3E, 0x41, 0x51, 0x21, 0x5E, // Q
-  0x7F, 0x09, 0x19, 0x29, 0x46, // R
-  0x26, 0x49, 0x49, 0x49, 0x32, // S
-  0x03, 0x01, 0x7F, 0x01, 0x03, // T
-  0x3F, 0x40, 0x40, 0x40, 0x3F, // U
-  0x1F, 0x20, 0x40, 0x20, 0x1F, // V
-  0x3F, 0x40, 0x38, 0x40, 0x3F, // W
-  0x63, 0x14, 0x08, 0x14, 0x63, // X
-  0x03, 0x04, 0x78, 0x04, 0x03, // Y
-  0x61, 0x59, 0x49, 0x4D, 0x43, // Z
-  0x00, 0x7F, 0x41, 0x41, 0x41,
-  0x02, 0x04, 0x08, 0x10, 0x20,
-  0x00, 0x41, 0x41, 0x41, 0x7F,
-  0x04, 0x02, 0x01, 0x02, 0x04,
-  0x40, 0x40, 0x40, 0x40, 0x40,
-  0x00, 0x03, 0x07, 0x08, 0x00,
-  0x20, 0x54, 0x54, 0x78, 0x40, // a
-  0x7F, 0x28, 0x44, 0x44, 0x38, // b
-  0x38, 0x44, 0x44, 0x44, 0x28, // c
-  0x38, 0x44, 0x44, 0x28, 0x7F, // d
-  0x38, 0x54, 0x54, 0x54, 0x18, // e
-  0x00, 0x08, 0x7E, 0x09, 0x02, // f
-  0x18, 0xA4, 0xA4, 0x9C, 0x78, // g
-  0x7F, 0x08, 0x04, 0x04, 0x78, // h
-  0x00, 0x44, 0x7D, 0x40, 0x00, // i
-  0x20, 0x40, 0x40, 0x3D, 0x00, // j
-  0x7F, 0x10, 0x28, 0x44, 0x00, // k
-  0x00, 0x41, 0x7F, 0x40, 0x00, // l
-  0x7C, 0x04, 0x78, 0x04, 0x78, // m
-  0x7C, 0x08, 0x04, 0x04, 0x78, // n
-  0x38, 0x44, 0x44, 0x44, 0x38, // o
-  0xFC, 0x18, 0x24, 0x24, 0x18, // p
-  0x18, 0x24, 0x24, 0x18, 0xFC, // q
-  0x7C, 0x08, 0x04, 0x04, 0x08, // r
-  0x48, 0x54, 0x54, 0x54, 0x24, // s
-  0x04, 0x04, 0x3F, 0x44, 0x24, // t
-  0x3C, 0x40, 0x40, 0x20, 0x7C, // u
-  0x1C, 0x20, 0x40, 0x20, 0x1C, // v
-  0x3C, 0x40, 0x30, 0x40, 0x3C, // w
-  0x44, 0x28, 0x10, 0x28, 0x44, // x
-  0x4C, 0x90, 0x90, 0x90, 0x7C, // y
-  0x44, 0x64, 0x54, 0x4C, 0x44, // z
-  0x00, 0x08, 0x36, 0x41, 0x00,
-  0x00, 0x00, 0x77, 0x00, 0x00,
-  0x00, 0x41, 0x36, 0x08, 0x00,
-  0x02, 0x01, 0x02, 0x04, 0x02,
-  0x3C, 0x26, 0x23, 0x26, 0x3C,
-  0x1E, 0xA1, 0xA1, 0x61, 0x12,
-  0x3A, 0x40, 0x40, 0x20, 0x7A,
-  0x38, 0x54, 0x54, 0x55, 0x59,
-  0x21, 0x55, 0x55, 0x79, 0x41,
-  0x21, 0x54, 0x54, 0x78, 0x41,
-  0x21, 0x55, 0x54, 0x78, 0x40,
-  0x20, 0x54, 0x55, 0x79, 0x40,
-  0x0C, 0x1E, 0x52, 0x72, 0x12,
-  0x39, 0x55, 0x55, 0x55, 0x59,
-  0x39, 0x54, 0x54, 0x54, 0x59,
-  0x39, 0x55, 0x54, 0x54, 0x58,
-  0x00, 0x00, 0x45, 0x7C, 0x41,
-  0x00, 0x02, 0x45, 0x7D, 0x42,
-  0x00, 0x01, 0x45, 0x7C, 0x40,
-  0xF0, 0x29, 0x24, 0x29, 0xF0,
-  0xF0, 0x28, 0x25, 0x28, 0xF0,
-  0x7C, 0x54, 0x55, 0x45, 0x00,
-  0x20, 0x54, 0x54, 0x7C, 0x54,
-  0x7C, 0x0A, 0x09, 0x7F, 0x49,
-  0x32, 0x49, 0x49, 0x49, 0x32,
-  0x32, 0x48, 0x48, 0x48, 0x32,
-  0x32, 0x4A, 0x48, 0x48, 0x30,
-  0x3A, 0x41, 0x41, 0x21, 0x7A,
-  0x3A, 0x42, 0x40, 0x20, 0x78,
-  0x00, 0x9D, 0xA0, 0xA0, 0x7D,
-  0x39, 0x44, 0x44, 0x44, 0x39,
-  0x3D, 0x40, 0x40, 0x40, 0x3D,
-  0x3C, 0x24, 0xFF, 0x24, 0x24,
-  0x48, 0x7E, 0x49, 0x43, 0x66,
-  0x2B, 0x2F, 0xFC, 0x2F, 0x2B,
-  0xFF, 0x09, 0x29, 0xF6, 0x20,
-  0xC0, 0x88, 0x7E, 0x09, 0x03,
-  0x20, 0x54, 0x54, 0x79, 0x41,
-  0x00, 0x00, 0x44, 0x7D, 0x41,
-  0x30, 0x48, 0x48, 0x4A, 0x32,
-  0x38, 0x40, 0x40, 0x22, 0x7A,
-  0x00, 0x7A, 0x0A, 0x0A, 0x72,
-  0x7D, 0x0D, 0x19, 0x31, 0x7D,
-  0x26, 0x29, 0x29, 0x2F, 0x28,
-  0x26, 0x29, 0x29, 0x29, 0x26,
-  0x30, 0x48, 0x4D, 0x40, 0x20,
-  0x38, 0x08, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x08, 0x38,
-  0x2F, 0x10, 0xC8, 0xAC, 0xBA,
-  0x2F, 0x10, 0x28, 0x34, 0xFA,
-  0x00, 0x00, 0x7B, 0x00, 0x00,
-  0x08, 0x14, 0x2A, 0x14, 0x22,
-  0x22, 0x14, 0x2A, 0x14, 0x08,
-  0xAA, 0x00, 0x55, 0x00, 0xAA,
-  0xAA, 0x55, 0xAA, 0x55, 0xAA,
-  0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x10, 0x10, 0x10, 0xFF, 0x00,
-  0x14, 0x14, 0x14, 0xFF, 0x00,
-  0x10, 0x10, 0xFF, 0x00, 0xFF,
-  0x10, 0x10, 0xF0, 0x10, 0xF0,
-  0x14, 0x14, 0x14, 0xFC, 0x00,
-  0x14, 0x14, 0xF7, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x14, 0x14, 0xF4, 0x04, 0xFC,
-  0x14, 0x14, 0x17, 0x10, 0x1F,
-  0x10, 0x10, 0x1F, 0x10, 0x1F,
-  0x14, 0x14, 0x14, 0x1F, 0x00,
-  0x10, 0x10, 0x10, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0x10,
-  0x10, 0x10, 0x10, 0x1F, 0x10,
-  0x10, 0x10, 0x10, 0xF0, 0x10,
-  0x00, 0x00, 0x00, 0xFF, 0x10,
-  0x10, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0xFF, 0x10,
-  0x00, 0x00, 0x00, 0xFF, 0x14,
-  0x00, 0x00, 0xFF, 0x00, 0xFF,
-  0x00, 0x00, 0x1F, 0x10, 0x17,
-  0x00, 0x00, 0xFC, 0x04, 0xF4,
-  0x14, 0x14, 0x17, 0x10, 0x17,
-  0x14, 0x14, 0xF4, 0x04, 0xF4,
-  0x00, 0x00, 0xFF, 0x00, 0xF7,
-  0x14, 0x14, 0x14, 0x14, 0x14,
-  0x14, 0x14, 0xF7, 0x00, 0xF7,
-  0x14, 0x14, 0x14, 0x17, 0x14,
-  0x10, 0x10, 0x1F, 0x10, 0x1F,
-  0x14, 0x14, 0x14, 0xF4, 0x14,
-  0x10, 0x10, 0xF0, 0x10, 0xF0,
-  0x00, 0x00, 0x1F, 0x10, 0x1F,
-  0x00, 0x00, 0x00, 0x1F, 0x14,
-  0x00, 0x00, 0x00, 0xFC, 0x14,
-  0x00, 0x00, 0xF0, 0x10, 0xF0,
-  0x10, 0x10, 0xFF, 0x10, 0xFF,
-  0x14, 0x14, 0x14, 0xFF, 0x14,
-  0x10, 0x10, 0x10, 0x1F, 0x00,
-  0x00, 0x00, 0x00, 0xF0, 0x10,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x38, 0x44, 0x44, 0x38, 0x44,
-  0x7C, 0x2A, 0x2A, 0x3E, 0x14,
-  0x7E, 0x02, 0x02, 0x06, 0x06,
-  0x02, 0x7E, 0x02, 0x7E, 0x02,
-  0x63, 0x55, 0x49, 0x41, 0x63,
-  0x38, 0x44, 0x44, 0x3C, 0x04,
-  0x40, 0x7E, 0x20, 0x1E, 0x20,
-  0x06, 0x02, 0x7E, 0x02, 0x02,
-  0x99, 0xA5, 0xE7, 0xA5, 0x99,
-  0x1C, 0x2A, 0x49, 0x2A, 0x1C,
-  0x4C, 0x72, 0x01, 0x72, 0x4C,
-  0x30, 0x4A, 0x4D, 0x4D, 0x30,
-  0x30, 0x48, 0x78, 0x48, 0x30,
-  0xBC, 0x62, 0x5A, 0x46, 0x3D,
-  0x3E, 0x49, 0x49, 0x49, 0x00,
-  0x7E, 0x01, 0x01, 0x01, 0x7E,
-  0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
-  0x44, 0x44, 0x5F, 0x44, 0x44,
-  0x40, 0x51, 0x4A, 0x44, 0x40,
-  0x40, 0x44, 0x4A, 0x51, 0x40,
-  0x00, 0x00, 0xFF, 0x01, 0x03,
-  0xE0, 0x80, 0xFF, 0x00, 0x00,
-  0x08, 0x08, 0x6B, 0x6B, 0x08,
-  0x36, 0x12, 0x36, 0x24, 0x36,
-  0x06, 0x0F, 0x09, 0x0F, 0x06,
-  0x00, 0x00, 0x18, 0x18, 0x00,
-  0x00, 0x00, 0x10, 0x10, 0x00,
-  0x30, 0x40, 0xFF, 0x01, 0x01,
-  0x00, 0x1F, 0x01, 0x01, 0x1E,
-  0x00, 0x19, 0x1D, 0x17, 0x12,
-  0x00, 0x3C, 0x3C, 0x3C, 0x3C,
-  0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-
-static uint8_t ColStart, RowStart; // some displays need this changed
-static uint8_t Rotation;           // 0 to 3
-static enum initRFlags TabColor;
-static int16_t _width = ST7735_TFTWIDTH;   // this could probably be a constant, except it is used in Adafruit_GFX and depends on image rotation
-static int16_t _height = ST7735_TFTHEIGHT;
-
-
-// The Data/Command pin must be valid when the eighth bit is
-// sent.  The SSI module has hardware input and output FIFOs
-// that are 8 locations deep.  Based on the observation that
-// the LCD interface tends to send a few commands and then a
-// lot of data, the FIFOs are not used when writing
-// commands, and they are used when writing data.  This
-// ensures that the Data/Command pin status matches the byte
-// that is actually being transmitted.
-// The write command operation waits until all data has been
-// sent, configures the Data/Command pin for commands, sends
-// the command, and then waits for the transmission to
-// finish.
-// The write data operation waits until there is room in the
-// transmit FIFO, configures the Data/Command pin for data,
-// and then adds the data to the transmit FIFO.
-// NOTE: These functions will crash or stall indefinitely if
-// the SSI0 module is not initialized and enabled.
-void writecommand(uint8_t c);
-
-
-void writedata(uint8_t c);
-
-// Subroutine to wait 1 msec
-// Inputs: None
-// Outputs: None
-// Notes: ...
-void Delay1ms(uint32_t n){uint32_t volatile time;
-  while(n){
-    time = 72724*2/91;  // 1msec, tuned at 80 MHz
-    while(time){
-	  	time--;
-    }
-    n--;
-  }
-}
-
-// Rather than a bazillion writecommand() and writedata() calls, screen
-// initialization commands and arguments are organized in these tables
-// stored in ROM.  The table may look bulky, but that's mostly the
-// formatting -- storage-wise this is hundreds of bytes more compact
-// than the equivalent code.  Companion function follows.
-#define DELAY 0x80
-static const uint8_t
-  Bcmd[] = {                  // Initialization commands for 7735B screens
-    18,                       // 18 commands in list:
-    ST7735_SWRESET,   DELAY,  //  1: Software reset, no args, w/delay
-      50,                     //     50 ms delay
-    ST7735_SLPOUT ,   DELAY,  //  2: Out of sleep mode, no args, w/delay
-      255,                    //     255 = 500 ms delay
-    ST7735_COLMOD , 1+DELAY,  //  3: Set color mode, 1 arg + delay:
-      0x05,                   //     16-bit color
-      10,                     //     10 ms delay
-    ST7735_FRMCTR1, 3+DELAY,  //  4: Frame rate control, 3 args + delay:
-      0x00,                   //     fastest refresh
-      0x06,                   //     6 lines front porch
-      0x03,                   //     3 lines back porch
-      10,                     //     10 ms delay
-    ST7735_MADCTL , 1      ,  //  5: Memory access ctrl (directions), 1 arg:
-      0x08,                   //     Row addr/col addr, bottom to top refresh
-    ST7735_DISSET5, 2      ,  //  6: Display settings #5, 2 args, no delay:
-      0x15,                   //     1 clk cycle nonoverlap, 2 cycle gate
-                              //     rise, 3 cycle osc equalize
-      0x02,                   //     Fix on VTL
-    ST7735_INVCTR , 1      ,  //  7: Display inversion control, 1 arg:
-      0x0,                    //     Line inversion
-    ST7735_PWCTR1 , 2+DELAY,  //  8: Power control, 2 args + delay:
-      0x02,                   //     GVDD = 4.7V
-      0x70,                   //     1.0uA
-      10,                     //     10 ms delay
-    ST7735_PWCTR2 , 1      ,  //  9: Power control, 1 arg, no delay:
-      0x05,                   //     VGH = 14.7V, VGL = -7.35V
-    ST7735_PWCTR3 , 2      ,  // 10: Power control, 2 args, no delay:
-      0x01,                   //     Opamp current small
-      0x02,                   //     Boost frequency
-    ST7735_VMCTR1 , 2+DELAY,  // 11: Power control, 2 args + delay:
-      0x3C,                   //     VCOMH = 4V
-      0x38,                   //     VCOML = -1.1V
-      10,                     //     10 ms delay
-    ST7735_PWCTR6 , 2      ,  // 12: Power control, 2 args, no delay:
-      0x11, 0x15,
-    ST7735_GMCTRP1,16      ,  // 13: Magical unicorn dust, 16 args, no delay:
-      0x09, 0x16, 0x09, 0x20, //     (seriously though, not sure what
-      0x21, 0x1B, 0x13, 0x19, //      these config values represent)
-      0x17, 0x15, 0x1E, 0x2B,
-      0x04, 0x05, 0x02, 0x0E,
-    ST7735_GMCTRN1,16+DELAY,  // 14: Sparkles and rainbows, 16 args + delay:
-      0x0B, 0x14, 0x08, 0x1E, //     (ditto)
-      0x22, 0x1D, 0x18, 0x1E,
-      0x1B, 0x1A, 0x24, 0x2B,
-      0x06, 0x06, 0x02, 0x0F,
-      10,                     //     10 ms delay
-    ST7735_CASET  , 4      ,  // 15: Column addr set, 4 args, no delay:
-      0x00, 0x02,             //     XSTART = 2
-      0x00, 0x81,             //     XEND = 129
-    ST7735_RASET  , 4      ,  // 16: Row addr set, 4 args, no delay:
-      0x00, 0x02,             //     XSTART = 1
-      0x00, 0x81,             //     XEND = 160
-    ST7735_NORON  ,   DELAY,  // 17: Normal display on, no args, w/delay
-      10,                     //     10 ms delay
-    ST7735_DISPON ,   DELAY,  // 18: Main screen turn on, no args, w/delay
-      255 };                  //     255 = 500 ms delay
-static const uint8_t
-  Rcmd1[] = {                 // Init for 7735R, part 1 (red or green tab)
-    15,                       // 15 commands in list:
-    ST7735_SWRESET,   DELAY,  //  1: Software reset, 0 args, w/delay
-      150,                    //     150 ms delay
-    ST7735_SLPOUT ,   DELAY,  //  2: Out of sleep mode, 0 args, w/delay
-      255,                    //     500 ms delay
-    ST7735_FRMCTR1, 3      ,  //  3: Frame rate ctrl - normal mode, 3 args:
-      0x01, 0x2C, 0x2D,       //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
-    ST7735_FRMCTR2, 3      ,  //  4: Frame rate control - idle mode, 3 args:
-      0x01, 0x2C, 0x2D,       //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
-    ST7735_FRMCTR3, 6      ,  //  5: Frame rate ctrl - partial mode, 6 args:
-      0x01, 0x2C, 0x2D,       //     Dot inversion mode
-      0x01, 0x2C, 0x2D,       //     Line inversion mode
-    ST7735_INVCTR , 1      ,  //  6: Display inversion ctrl, 1 arg, no delay:
-      0x07,                   //     No inversion
-    ST7735_PWCTR1 , 3      ,  //  7: Power control, 3 args, no delay:
-      0xA2,
-      0x02,                   //     -4.6V
-      0x84,                   //     AUTO mode
-    ST7735_PWCTR2 , 1      ,  //  8: Power control, 1 arg, no delay:
-      0xC5,                   //     VGH25 = 2.4C VGSEL = -10 VGH = 3 * AVDD
-    ST7735_PWCTR3 , 2      ,  //  9: Power control, 2 args, no delay:
-      0x0A,                   //     Opamp current small
-      0x00,                   //     Boost frequency
-    ST7735_PWCTR4 , 2      ,  // 10: Power control, 2 args, no delay:
-      0x8A,                   //     BCLK/2, Opamp current small & Medium low
-      0x2A,
-    ST7735_PWCTR5 , 2      ,  // 11: Power control, 2 args, no delay:
-      0x8A, 0xEE,
-    ST7735_VMCTR1 , 1      ,  // 12: Power control, 1 arg, no delay:
-      0x0E,
-    ST7735_INVOFF , 0      ,  // 13: Don't invert display, no args, no delay
-    ST7735_MADCTL , 1      ,  // 14: Memory access control (directions), 1 arg:
-      0xC8,                   //     row addr/col addr, bottom to top refresh
-    ST7735_COLMOD , 1      ,  // 15: set color mode, 1 arg, no delay:
-      0x05 };                 //     16-bit color
-static const uint8_t
-  Rcmd2green[] = {            // Init for 7735R, part 2 (green tab only)
-    2,                        //  2 commands in list:
-    ST7735_CASET  , 4      ,  //  1: Column addr set, 4 args, no delay:
-      0x00, 0x02,             //     XSTART = 0
-      0x00, 0x7F+0x02,        //     XEND = 127
-    ST7735_RASET  , 4      ,  //  2: Row addr set, 4 args, no delay:
-      0x00, 0x01,             //     XSTART = 0
-      0x00, 0x9F+0x01 };      //     XEND = 159
-static const uint8_t
-  Rcmd2red[] = {              // Init for 7735R, part 2 (red tab only)
-    2,                        //  2 commands in list:
-    ST7735_CASET  , 4      ,  //  1: Column addr set, 4 args, no delay:
-      0x00, 0x00,             //     XSTART = 0
-      0x00, 0x7F,             //     XEND = 127
-    ST7735_RASET  , 4      ,  //  2: Row addr set, 4 args, no delay:
-      0x00, 0x00,             //     XSTART = 0
-      0x00, 0x9F };           //     XEND = 159
-static const uint8_t
-  Rcmd3[] = {                 // Init for 7735R, part 3 (red or green tab)
-    4,                        //  4 commands in list:
-    ST7735_GMCTRP1, 16      , //  1: Magical unicorn dust, 16 args, no delay:
-      0x02, 0x1c, 0x07, 0x12,
-      0x37, 0x32, 0x29, 0x2d,
-      0x29, 0x25, 0x2B, 0x39,
-      0x00, 0x01, 0x03, 0x10,
-    ST7735_GMCTRN1, 16      , //  2: Sparkles and rainbows, 16 args, no delay:
-      0x03, 0x1d, 0x07, 0x06,
-      0x2E, 0x2C, 0x29, 0x2D,
-      0x2E, 0x2E, 0x37, 0x3F,
-      0x00, 0x00, 0x02, 0x10,
-    ST7735_NORON  ,    DELAY, //  3: Normal display on, no args, w/delay
-      10,                     //     10 ms delay
-    ST7735_DISPON ,    DELAY, //  4: Main screen turn on, no args w/delay
-      100 };                  //     100 ms delay
-
-
-// Companion code to the above tables.  Reads and issues
-// a series of LCD commands stored in ROM byte array.
-void static commandList(const uint8_t *addr) {
-
-  uint8_t numCommands, numArgs;
-  uint16_t ms;
-
-  numCommands = *(addr++);               // Number of commands to follow
-  while(numCommands--) {                 // For each command...
-    writecommand(*(addr++));             //   Read, issue command
-    numArgs  = *(addr++);                //   Number of args to follow
-    ms       = numArgs & DELAY;          //   If hibit set, delay follows args
-    numArgs &= ~DELAY;                   //   Mask out delay bit
-    while(numArgs--) {                   //   For each argument...
-      writedata(*(addr++));              //     Read, issue argument
-    }
-
-    if(ms) {
-      ms = *(addr++);             // Read post-command delay time (ms)
-      if(ms == 255) ms = 500;     // If 255, delay for 500 ms
-      Delay1ms(ms);
-    }
-  }
-}
-
-
-// Initialization code common to both 'B' and 'R' type displays
-void static commonInit(const uint8_t *cmdList) {
-  volatile uint32_t delay;
-  ColStart  = RowStart = 0; // May be overridden in init func
-
-  SYSCTL_RCGCSSI_R |= 0x01;  // activate SSI0
-  SYSCTL_RCGCGPIO_R |= 0x01; // activate port A
-  while((SYSCTL_PRGPIO_R&0x01)==0){}; // allow time for clock to start
-
-  // toggle RST low to reset; CS low so it'll listen to us
-  // SSI0Fss is temporarily used as GPIO
-  GPIO_PORTA_DIR_R |= 0xC8;             // make PA3,6,7 out
-  GPIO_PORTA_AFSEL_R &= ~0xC8;          // disable alt funct on PA3,6,7
-  GPIO_PORTA_DEN_R |= 0xC8;             // enable digital I/O on PA3,6,7
-                                        // configure PA3,6,7 as GPIO
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0x00FF0FFF)+0x00000000;
-  GPIO_PORTA_AMSEL_R &= ~0xC8;          // disable analog functionality on PA3,6,7
-  TFT_CS = TFT_CS_LOW;
-  RESET = RESET_HIGH;
-  Delay1ms(500);
-  RESET = RESET_LOW;
-  Delay1ms(500);
-  RESET = RESET_HIGH;
-  Delay1ms(500);
-
-  // initialize SSI0
-  GPIO_PORTA_AFSEL_R |= 0x2C;           // enable alt funct on PA2,3,5
-  GPIO_PORTA_DEN_R |= 0x2C;             // enable digital I/O on PA2,3,5
-                                        // configure PA2,3,5 as SSI
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFF0F00FF)+0x00202200;
-  GPIO_PORTA_AMSEL_R &= ~0x2C;          // disable analog functionality on PA2,3,5
-  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
-  SSI0_CR1_R &= ~SSI_CR1_MS;            // master mode
-                                        // configure for system clock/PLL baud clock source
-  SSI0_CC_R = (SSI0_CC_R&~SSI_CC_CS_M)+SSI_CC_CS_SYSPLL;
-//                                        // clock divider for 3.125 MHz SSIClk (50 MHz PIOSC/16)
-//  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+16;
-                                        // clock divider for 8 MHz SSIClk (80 MHz PLL/24)
-                                        // SysClk/(CPSDVSR*(1+SCR))
-                                        // 80/(10*(1+0)) = 8 MHz (slower than 4 MHz)
-  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+10; // must be even number
-  SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (8 Mbps data rate)
-                  SSI_CR0_SPH |         // SPH = 0
-                  SSI_CR0_SPO);         // SPO = 0
-                                        // FRF = Freescale format
-  SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_FRF_M)+SSI_CR0_FRF_MOTO;
-                                        // DSS = 8-bit data
-  SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
-  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
-
-  if(cmdList) commandList(cmdList);
-}
-
-
-//------------ST7735_InitB------------
-// Initialization for ST7735B screens.
-// Input: none
-// Output: none
-void ST7735_InitB(void) {
-  commonInit(Bcmd);
-  ST7735_SetCursor(0,0);
-  StTextColor = ST7735_WHITE;
-  ST7735_FillScreen(0);                 // set screen to black
-}
-
-
-//------------ST7735_InitR------------
-// Initialization for ST7735R screens (green or red tabs).
-// Input: option one of the enumerated options depending on tabs
-// Output: none
-void ST7735_InitR(enum initRFlags option) {
-  commonInit(Rcmd1);
-  if(option == INITR_GREENTAB) {
-    commandList(Rcmd2green);
-    ColStart = 2;
-    RowStart = 1;
-  } else {
-    // colstart, rowstart left at default '0' values
-    commandList(Rcmd2red);
-  }
-  commandList(Rcmd3);
-
-  // if black, change MADCTL color filter
-  if (option == INITR_BLACKTAB) {
-    writecommand(ST7735_MADCTL);
-    writedata(0xC0);
-  }
-  TabColor = option;
-  ST7735_SetCursor(0,0);
-  StTextColor = ST7735_WHITE;
-  ST7735_FillScreen(0);                 // set screen to black
-}
-
-
-// Set the region of the screen RAM to be modified
-// Pixel colors are sent left to right, top to bottom
-// (same as Font table is encoded; different from regular bitmap)
-// Requires 11 bytes of transmission
-void static setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
-
-  writecommand(ST7735_CASET); // Column addr set
-  writedata(0x00);
-  writedata(x0+ColStart);     // XSTART
-  writedata(0x00);
-  writedata(x1+ColStart);     // XEND
-
-  writecommand(ST7735_RASET); // Row addr set
-  writedata(0x00);
-  writedata(y0+RowStart);     // YSTART
-  writedata(0x00);
-  writedata(y1+RowStart);     // YEND
-
-  writecommand(ST7735_RAMWR); // write to RAM
-}
-
-
-
-// Send two bytes of data, most significant byte first
-// Requires 2 bytes of transmission
-void static pushColor(uint16_t color) {
-  writedata((uint8_t)(color >> 8));
-  writedata((uint8_t)color);
-}
-
-
-//------------ST7735_DrawPixel------------
-// Color the pixel at the given coordinates with the given color.
-// Requires 13 bytes of transmission
-// Input: x     horizontal position of the pixel, columns from the left edge
-//               must be less than 128
-//               0 is on the left, 126 is near the right
-//        y     vertical position of the pixel, rows from the top edge
-//               must be less than 160
-//               159 is near the wires, 0 is the side opposite the wires
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color) {
-
-  if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
-
-//  setAddrWindow(x,y,x+1,y+1); // original code, bug???
-  setAddrWindow(x,y,x,y);
-
-  pushColor(color);
-}
-
-
-//------------ST7735_DrawFastVLine------------
-// Draw a vertical line at the given coordinates with the given height and color.
-// A vertical line is parallel to the longer side of the rectangular display
-// Requires (11 + 2*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the start of the line, columns from the left edge
-//        y     vertical position of the start of the line, rows from the top edge
-//        h     vertical height of the line
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
-
-  // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
-  if((y+h-1) >= _height) h = _height-y;
-  setAddrWindow(x, y, x, y+h-1);
-
-  while (h--) {
-    writedata(hi);
-    writedata(lo);
-  }
-}
-
-
-//------------ST7735_DrawFastHLine------------
-// Draw a horizontal line at the given coordinates with the given width and color.
-// A horizontal line is parallel to the shorter side of the rectangular display
-// Requires (11 + 2*w) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the start of the line, columns from the left edge
-//        y     vertical position of the start of the line, rows from the top edge
-//        w     horizontal width of the line
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
-
-  // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
-  if((x+w-1) >= _width)  w = _width-x;
-  setAddrWindow(x, y, x+w-1, y);
-
-  while (w--) {
-    writedata(hi);
-    writedata(lo);
-  }
-}
-
-
-//------------ST7735_FillScreen------------
-// Fill the screen with the given color.
-// Requires 40,971 bytes of transmission
-// Input: color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_FillScreen(uint16_t color) {
-  ST7735_FillRect(0, 0, _width, _height, color);  // original
-//  screen is actually 129 by 161 pixels, x 0 to 128, y goes from 0 to 160
-}
-
-
-//------------ST7735_FillRect------------
-// Draw a filled rectangle at the given coordinates with the given width, height, and color.
-// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the top left corner of the rectangle, columns from the left edge
-//        y     vertical position of the top left corner of the rectangle, rows from the top edge
-//        w     horizontal width of the rectangle
-//        h     vertical height of the rectangle
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  uint8_t hi = color >> 8, lo = color;
-
-  // rudimentary clipping (drawChar w/big text requires this)
-  if((x >= _width) || (y >= _height)) return;
-  if((x + w - 1) >= _width)  w = _width  - x;
-  if((y + h - 1) >= _height) h = _height - y;
-
-  setAddrWindow(x, y, x+w-1, y+h-1);
-
-  for(y=h; y>0; y--) {
-    for(x=w; x>0; x--) {
-      writedata(hi);
-      writedata(lo);
-    }
-  }
-}
-
-
-//------------ST7735_Color565------------
-// Pass 8-bit (each) R,G,B and get back 16-bit packed color.
-// Input: r red value
-//        g green value
-//        b blue value
-// Output: 16-bit color
-uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b) {
-  return ((b & 0xF8) << 8) | ((g & 0xFC) << 3) | (r >> 3);
-}
-
-
-//------------ST7735_SwapColor------------
-// Swaps the red and blue values of the given 16-bit packed color;
-// green is unchanged.
-// Input: x 16-bit color in format B, G, R
-// Output: 16-bit color in format R, G, B
-uint16_t ST7735_SwapColor(uint16_t x) {
-  return (x << 11) | (x & 0x07E0) | (x >> 11);
-}
-
-
-
-//------------ST7735_DrawBitmap------------
-// Displays a 16-bit color BMP image.  A bitmap file that is created
-// by a PC image processing program has a header and may be padded
-// with dummy columns so the data have four byte alignment.  This
-// function assumes that all of that has been stripped out, and the
-// array image[] has one 16-bit halfword for each pixel to be
-// displayed on the screen (encoded in reverse order, which is
-// standard for bitmap files).  An array can be created in this
-// format from a 24-bit-per-pixel .bmp file using the associated
-// converter program.
-// (x,y) is the screen location of the lower left corner of BMP image
-// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
-//        y     vertical position of the bottom left corner of the image, rows from the top edge
-//        image pointer to a 16-bit color BMP image
-//        w     number of pixels wide
-//        h     number of pixels tall
-// Output: none
-// Must be less than or equal to 128 pixels wide by 160 pixels high
-void ST7735_DrawBitmap16(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h){
-	int16_t skipC = 0;                      // non-zero if columns need to be skipped due to clipping
-  int16_t originalWidth = w;              // save this value; even if not all columns fit on the screen, the image is still this width in ROM
-  int i = w*(h - 1);
-
-  if((x >= _width) || ((y - h + 1) >= _height) || ((x + w) <= 0) || (y < 0)){
-    return;                             // image is totally off the screen, do nothing
-  }
-  if((w > _width) || (h > _height)){    // image is too wide for the screen, do nothing
-    //***This isn't necessarily a fatal error, but it makes the
-    //following logic much more complicated, since you can have
-    //an image that exceeds multiple boundaries and needs to be
-    //clipped on more than one side.
-    return;
-  }
-  if((x + w - 1) >= _width){            // image exceeds right of screen
-    skipC = (x + w) - _width;           // skip cut off columns
-    w = _width - x;
-  }
-  if((y - h + 1) < 0){                  // image exceeds top of screen
-    i = i - (h - y - 1)*originalWidth;  // skip the last cut off rows
-    h = y + 1;
-  }
-  if(x < 0){                            // image exceeds left of screen
-    w = w + x;
-    skipC = -1*x;                       // skip cut off columns
-    i = i - x;                          // skip the first cut off columns
-    x = 0;
-  }
-  if(y >= _height){                     // image exceeds bottom of screen
-    h = h - (y - _height + 1);
-    y = _height - 1;
-  }
-
-  setAddrWindow(x, y-h+1, x+w-1, y);
-  for(y=0; y<h; y=y+1){
-    for(x=0; x<w; x=x+1){
-                                        // send the top 8 bits
-      writedata((uint8_t)(image[i] >> 8));
-                                        // send the bottom 8 bits
-			writedata((uint8_t)(image[i]));
-
-      i = i + 1;                        // go to the next pixel
-    }
-    i = i + skipC;
-    i = i - 2*originalWidth;
-  }
-}
-
-// ST_Convert
-// turn 8bit bgr into 16 bit bgr
-uint16_t ST7735_Convert(uint8_t color){
-  color = color<<1;
-  uint16_t bgrCol = 0;
-  bgrCol |= ((color&0xC0)<<8);    // B
-  bgrCol |= ((color&0xC0)<<6);
-  bgrCol |= ((color&0x80)<<4);
-  bgrCol |= ((color&0x38)<<5);    // G
-  bgrCol |= ((color&0x38)<<2);
-  bgrCol |= ((color&0x07)<<2);    // R
-  bgrCol |= ((color&0x06)>>1);
-  return bgrCol;
-}
-
-void ST7735_DrawBitmap8(int16_t x, int16_t y, const uint8_t *image, int16_t w, int16_t h){
-	uint16_t bgr16;
-	int16_t skipC = 0;                      // non-zero if columns need to be skipped due to clipping
-  int16_t originalWidth = w;              // save this value; even if not all columns fit on the screen, the image is still this width in ROM
-  int i = w*(h - 1);
-
-  if((x >= _width) || ((y - h + 1) >= _height) || ((x + w) <= 0) || (y < 0)){
-    return;                             // image is totally off the screen, do nothing
-  }
-  if((w > _width) || (h > _height)){    // image is too wide for the screen, do nothing
-    //***This isn't necessarily a fatal error, but it makes the
-    //following logic much more complicated, since you can have
-    //an image that exceeds multiple boundaries and needs to be
-    //clipped on more than one side.
-    return;
-  }
-  if((x + w - 1) >= _width){            // image exceeds right of screen
-    skipC = (x + w) - _width;           // skip cut off columns
-    w = _width - x;
-  }
-  if((y - h + 1) < 0){                  // image exceeds top of screen
-    i = i - (h - y - 1)*originalWidth;  // skip the last cut off rows
-    h = y + 1;
-  }
-  if(x < 0){                            // image exceeds left of screen
-    w = w + x;
-    skipC = -1*x;                       // skip cut off columns
-    i = i - x;                          // skip the first cut off columns
-    x = 0;
-  }
-  if(y >= _height){                     // image exceeds bottom of screen
-    h = h - (y - _height + 1);
-    y = _height - 1;
-  }
-
-  setAddrWindow(x, y-h+1, x+w-1, y);
-  for(y=0; y<h; y=y+1){
-    for(x=0; x<w; x=x+1){
-			bgr16 = ST7735_Convert(image[i]);
-                                        // send the top 8 bits
-      writedata((uint8_t)(bgr16 >> 8));
-                                        // send the bottom 8 bits
-			writedata((uint8_t)(bgr16));
-
-      i = i + 1;                        // go to the next pixel
-    }
-    i = i + skipC;
-    i = i - 2*originalWidth;
-  }
-}
-
-
-
-//------------ST7735_DrawCharS------------
-// Simple character draw function.  This is the same function from
-// Adafruit_GFX.c but adapted for this processor.  However, each call
-// to ST7735_DrawPixel() calls setAddrWindow(), which needs to send
-// many extra data and commands.  If the background color is the same
-// as the text color, no background will be printed, and text can be
-// drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
-// Input: x         horizontal position of the top left corner of the character, columns from the left edge
-//        y         vertical position of the top left corner of the character, rows from the top edge
-//        c         character to be printed
-//        textColor 16-bit color of the character
-//        bgColor   16-bit color of the background
-//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
-// Output: none
-void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
-  uint8_t line; // vertical column of pixels of character in font
-  int32_t i, j;
-  if((x >= _width)            || // Clip right
-     (y >= _height)           || // Clip bottom
-     ((x + 5 * size - 1) < 0) || // Clip left
-     ((y + 8 * size - 1) < 0))   // Clip top
-    return;
-
-  for (i=0; i<6; i++ ) {
-    if (i == 5)
-      line = 0x0;
-    else
-      line = Font[(c*5)+i];
-    for (j = 0; j<8; j++) {
-      if (line & 0x1) {
-        if (size == 1) // default size
-          ST7735_DrawPixel(x+i, y+j, textColor);
-        else {  // big size
-          ST7735_FillRect(x+(i*size), y+(j*size), size, size, textColor);
-        }
-      } else if (bgColor != textColor) {
-        if (size == 1) // default size
-          ST7735_DrawPixel(x+i, y+j, bgColor);
-        else {  // big size
-          ST7735_FillRect(x+i*size, y+j*size, size, size, bgColor);
-        }
-      }
-      line >>= 1;
-    }
-  }
-}
-
-
-//------------ST7735_DrawChar------------
-// Advanced character draw function.  This is similar to the function
-// from Adafruit_GFX.c but adapted for this processor.  However, this
-// function only uses one call to setAddrWindow(), which allows it to
-// run at least twice as fast.
-// Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
-// Input: x         horizontal position of the top left corner of the character, columns from the left edge
-//        y         vertical position of the top left corner of the character, rows from the top edge
-//        c         character to be printed
-//        textColor 16-bit color of the character
-//        bgColor   16-bit color of the background
-//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
-// Output: none
-void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
-  uint8_t line; // horizontal row of pixels of character
-  int32_t col, row, i, j;// loop indices
-  if(((x + 5*size - 1) >= _width)  || // Clip right
-     ((y + 8*size - 1) >= _height) || // Clip bottom
-     ((x + 5*size - 1) < 0)        || // Clip left
-     ((y + 8*size - 1) < 0)){         // Clip top
-    return;
-  }
-
-  setAddrWindow(x, y, x+6*size-1, y+8*size-1);
-
-  line = 0x01;        // print the top row first
-  // print the rows, starting at the top
-  for(row=0; row<8; row=row+1){
-    for(i=0; i<size; i=i+1){
-      // print the columns, starting on the left
-      for(col=0; col<5; col=col+1){
-        if(Font[(c*5)+col]&line){
-          // bit is set in Font, print pixel(s) in text color
-          for(j=0; j<size; j=j+1){
-            pushColor(textColor);
-          }
-        } else{
-          // bit is cleared in Font, print pixel(s) in background color
-          for(j=0; j<size; j=j+1){
-            pushColor(bgColor);
-          }
-        }
-      }
-      // print blank column(s) to the right of character
-      for(j=0; j<size; j=j+1){
-        pushColor(bgColor);
-      }
-    }
-    line = line<<1;   // move up to the next row
-  }
-}
-//------------ST7735_DrawString------------
-// String draw function.  
-// 16 rows (0 to 15) and 21 characters (0 to 20)
-// Requires (11 + size*size*6*8) bytes of transmission for each character
-// Input: x         columns from the left edge (0 to 20)
-//        y         rows from the top edge (0 to 15)
-//        pt        pointer to a null terminated string to be printed
-//        textColor 16-bit color of the characters
-// bgColor is Black and size is 1
-// Output: number of characters printed
-uint32_t ST7735_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor){
-  uint32_t count = 0;
-  if(y>15) return 0;
-  while(*pt){
-    ST7735_DrawCharS(x*6, y*10, *pt, textColor, ST7735_BLACK, 1);
-    pt++;
-    x = x+1;
-    if(x>20) return count;  // number of characters printed
-    count++;
-  }
-  return count;  // number of characters printed
-}
-
-//-----------------------fillmessage-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-char Message[12];
-uint32_t Messageindex;
-
-void fillmessage(uint32_t n){
-// This function uses recursion to convert decimal number
-//   of unspecified length as an ASCII string
-  if(n >= 10){
-    fillmessage(n/10);
-    n = n%10;
-  }
-  Message[Messageindex] = (n+'0'); /* n is between 0 and 9 */
-  if(Messageindex<11)Messageindex++;
-}
-//********ST7735_SetCursor*****************
-// Move the cursor to the desired X- and Y-position.  The
-// next character will be printed here.  X=0 is the leftmost
-// column.  Y=0 is the top row.
-// inputs: newX  new X-position of the cursor (0<=newX<=20)
-//         newY  new Y-position of the cursor (0<=newY<=15)
-// outputs: none
-void ST7735_SetCursor(uint32_t newX, uint32_t newY){
-  if((newX > 20) || (newY > 15)){       // bad input
-    return;                             // do nothing
-  }
-  StX = newX;
-  StY = newY;
-}
-//-----------------------ST7735_OutUDec-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void ST7735_OutUDec(uint32_t n){
-  Messageindex = 0;
-  fillmessage(n);
-  Message[Messageindex] = 0; // terminate
-  ST7735_DrawString(StX,StY,Message,StTextColor);
-  StX = StX+Messageindex;
-  if(StX>20){
-    StX = 20;
-    ST7735_DrawCharS(StX*6,StY*10,'*',ST7735_RED,ST7735_BLACK, 1);
-  }
-}
-
-
-
-
-
-#define MADCTL_MY  0x80
-#define MADCTL_MX  0x40
-#define MADCTL_MV  0x20
-#define MADCTL_ML  0x10
-#define MADCTL_RGB 0x00
-#define MADCTL_BGR 0x08
-#define MADCTL_MH  0x04
-
-//------------ST7735_SetRotation------------
-// Change the image rotation.
-// Requires 2 bytes of transmission
-// Input: m new rotation value (0 to 3)
-// Output: none
-void ST7735_SetRotation(uint8_t m) {
-
-  writecommand(ST7735_MADCTL);
-  Rotation = m % 4; // can't be higher than 3
-  switch (Rotation) {
-   case 0:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MX | MADCTL_MY | MADCTL_BGR);
-     }
-     _width  = ST7735_TFTWIDTH;
-     _height = ST7735_TFTHEIGHT;
-     break;
-   case 1:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MY | MADCTL_MV | MADCTL_BGR);
-     }
-     _width  = ST7735_TFTHEIGHT;
-     _height = ST7735_TFTWIDTH;
-     break;
-  case 2:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_RGB);
-     } else {
-       writedata(MADCTL_BGR);
-     }
-     _width  = ST7735_TFTWIDTH;
-     _height = ST7735_TFTHEIGHT;
-    break;
-   case 3:
-     if (TabColor == INITR_BLACKTAB) {
-       writedata(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
-     } else {
-       writedata(MADCTL_MX | MADCTL_MV | MADCTL_BGR);
-     }
-     _width  = ST7735_TFTHEIGHT;
-     _height = ST7735_TFTWIDTH;
-     break;
-  }
-}
-
-
-//------------ST7735_InvertDisplay------------
-// Send the command to invert all of the colors.
-// Requires 1 byte of transmission
-// Input: i 0 to disable inversion; non-zero to enable inversion
-// Output: none
-void ST7735_InvertDisplay(int i) {
-  if(i){
-    writecommand(ST7735_INVON);
-  } else{
-    writecommand(ST7735_INVOFF);
-  }
-}
-// graphics routines
-// y coordinates 0 to 31 used for labels and messages
-// y coordinates 32 to 159  128 pixels high
-// x coordinates 0 to 127   128 pixels wide
-
-int32_t Ymax,Ymin,X;        // X goes from 0 to 127
-int32_t Yrange; //YrangeDiv2;
-
-// *************** ST7735_PlotClear ********************
-// Clear the graphics buffer, set X coordinate to 0
-// This routine clears the display 
-// Inputs: ymin and ymax are range of the plot
-// Outputs: none
-void ST7735_PlotClear(int32_t ymin, int32_t ymax){
-  ST7735_FillRect(0, 32, 128, 128, ST7735_Color565(228,228,228)); // light grey
-  if(ymax>ymin){
-    Ymax = ymax;
-    Ymin = ymin;
-    Yrange = ymax-ymin;
-  } else{
-    Ymax = ymin;
-    Ymin = ymax;
-    Yrange = ymax-ymin;
-  }
-  //YrangeDiv2 = Yrange/2;
-  X = 0;
-}
-
-// *************** ST7735_PlotPoint ********************
-// Used in the voltage versus time plot, plot one point at y
-// It does output to display 
-// Inputs: y is the y coordinate of the point plotted
-// Outputs: none
-void ST7735_PlotPoint(int32_t y){int32_t j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
-  // X goes from 0 to 127
-  // j goes from 159 to 32
-  // y=Ymax maps to j=32
-  // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ST7735_DrawPixel(X,   j,   ST7735_BLUE);
-  ST7735_DrawPixel(X+1, j,   ST7735_BLUE);
-  ST7735_DrawPixel(X,   j+1, ST7735_BLUE);
-  ST7735_DrawPixel(X+1, j+1, ST7735_BLUE);
-}
-// *************** ST7735_PlotLine ********************
-// Used in the voltage versus time plot, plot line to new point
-// It does output to display 
-// Inputs: y is the y coordinate of the point plotted
-// Outputs: none
-int32_t lastj=0;
-void ST7735_PlotLine(int32_t y){int32_t i,j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
-  // X goes from 0 to 127
-  // j goes from 159 to 32
-  // y=Ymax maps to j=32
-  // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  if(j < 32) j = 32;
-  if(j > 159) j = 159;
-  if(lastj < 32) lastj = j;
-  if(lastj > 159) lastj = j;
-  if(lastj < j){
-    for(i = lastj+1; i<=j ; i++){
-      ST7735_DrawPixel(X,   i,   ST7735_BLUE) ;
-      ST7735_DrawPixel(X+1, i,   ST7735_BLUE) ;
-    }
-  }else if(lastj > j){
-    for(i = j; i<lastj ; i++){
-      ST7735_DrawPixel(X,   i,   ST7735_BLUE) ;
-      ST7735_DrawPixel(X+1, i,   ST7735_BLUE) ;
-    }
-  }else{
-    ST7735_DrawPixel(X,   j,   ST7735_BLUE) ;
-    ST7735_DrawPixel(X+1, j,   ST7735_BLUE) ;
-  }
-  lastj = j;
-}
-
-// *************** ST7735_PlotPoints ********************
-// Used in the voltage versus time plot, plot two points at y1, y2
-// It does output to display 
-// Inputs: y1 is the y coordinate of the first point plotted
-//         y2 is the y coordinate of the second point plotted
-// Outputs: none
-void ST7735_PlotPoints(int32_t y1,int32_t y2){int32_t j;
-  if(y1<Ymin) y1=Ymin;
-  if(y1>Ymax) y1=Ymax;
-  // X goes from 0 to 127
-  // j goes from 159 to 32
-  // y=Ymax maps to j=32
-  // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y1))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ST7735_DrawPixel(X, j, ST7735_BLUE);
-  if(y2<Ymin) y2=Ymin;
-  if(y2>Ymax) y2=Ymax;
-  j = 32+(127*(Ymax-y2))/Yrange;
-  if(j<32) j = 32;
-  if(j>159) j = 159;
-  ST7735_DrawPixel(X, j, ST7735_BLACK);
-}
-// *************** ST7735_PlotBar ********************
-// Used in the voltage versus time bar, plot one bar at y
-// It does not output to display until RIT128x96x4ShowPlot called
-// Inputs: y is the y coordinate of the bar plotted
-// Outputs: none
-void ST7735_PlotBar(int32_t y){
-int32_t j;
-  if(y<Ymin) y=Ymin;
-  if(y>Ymax) y=Ymax;
-  // X goes from 0 to 127
-  // j goes from 159 to 32
-  // y=Ymax maps to j=32
-  // y=Ymin maps to j=159
-  j = 32+(127*(Ymax-y))/Yrange;
-  ST7735_DrawFastVLine(X, j, 159-j, ST7735_BLACK);
-
-}
-
-// full scaled defined as 3V
-// Input is 0 to 511, 0 => 159 and 511 => 32
-uint8_t const dBfs[512]={
-159, 159, 145, 137, 131, 126, 123, 119, 117, 114, 112, 110, 108, 107, 105, 104, 103, 101, 
-  100, 99, 98, 97, 96, 95, 94, 93, 93, 92, 91, 90, 90, 89, 88, 88, 87, 87, 86, 85, 85, 84, 
-  84, 83, 83, 82, 82, 81, 81, 81, 80, 80, 79, 79, 79, 78, 78, 77, 77, 77, 76, 76, 76, 75, 
-  75, 75, 74, 74, 74, 73, 73, 73, 72, 72, 72, 72, 71, 71, 71, 71, 70, 70, 70, 70, 69, 69, 
-  69, 69, 68, 68, 68, 68, 67, 67, 67, 67, 66, 66, 66, 66, 66, 65, 65, 65, 65, 65, 64, 64, 
-  64, 64, 64, 63, 63, 63, 63, 63, 63, 62, 62, 62, 62, 62, 62, 61, 61, 61, 61, 61, 61, 60, 
-  60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 58, 58, 58, 58, 58, 58, 58, 57, 57, 57, 
-  57, 57, 57, 57, 56, 56, 56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55, 55, 54, 54, 
-  54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 52, 52, 52, 52, 52, 
-  52, 52, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 50, 50, 50, 50, 50, 
-  50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 
-  48, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
-  46, 46, 46, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 44, 44, 44, 44, 44, 
-  44, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 
-  43, 43, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 
-  41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
-  40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 
-  39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 
-  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 
-  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 
-  35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 34, 
-  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 
-  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 
-  32, 32, 32, 32, 32, 32, 32, 32, 32, 32
-};
-
-// *************** ST7735_PlotdBfs ********************
-// Used in the amplitude versus frequency plot, plot bar point at y
-// 0 to 0.625V scaled on a log plot from min to max
-// It does output to display 
-// Inputs: y is the y ADC value of the bar plotted
-// Outputs: none
-void ST7735_PlotdBfs(int32_t y){
-int32_t j;
-  y = y/2; // 0 to 2047
-  if(y<0) y=0;
-  if(y>511) y=511;
-  // X goes from 0 to 127
-  // j goes from 159 to 32
-  // y=511 maps to j=32
-  // y=0 maps to j=159
-  j = dBfs[y];
-  ST7735_DrawFastVLine(X, j, 159-j, ST7735_BLACK);
-
-}
-
-// *************** ST7735_PlotNext ********************
-// Used in all the plots to step the X coordinate one pixel
-// X steps from 0 to 127, then back to 0 again
-// It does not output to display 
-// Inputs: none
-// Outputs: none
-void ST7735_PlotNext(void){
-  if(X==127){
-    X = 0;
-  } else{
-    X++;
-  }
-}
-
-// *************** ST7735_PlotNextErase ********************
-// Used in all the plots to step the X coordinate one pixel
-// X steps from 0 to 127, then back to 0 again
-// It clears the vertical space into which the next pixel will be drawn 
-// Inputs: none
-// Outputs: none
-void ST7735_PlotNextErase(void){
-  if(X==127){
-    X = 0;
-  } else{
-    X++;
-  }
-  ST7735_DrawFastVLine(X,32,128,ST7735_Color565(228,228,228));
-}
-
-// Used in all the plots to write buffer to LCD
-// Example 1 Voltage versus time
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    ST7735_PlotPoint(data); ST7735_PlotNext(); // called 128 times
-
-// Example 2a Voltage versus time (N data points/pixel, time scale)
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    {   for(j=0;j<N;j++){
-//          ST7735_PlotPoint(data[i++]); // called N times
-//        }
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 2b Voltage versus time (N data points/pixel, time scale)
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    {   for(j=0;j<N;j++){
-//          ST7735_PlotLine(data[i++]); // called N times
-//        }
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 3 Voltage versus frequency (512 points)
-//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
-//    ST7735_PlotClear(0,1023);  // clip large magnitudes
-//    {
-//        ST7735_PlotBar(mag[i++]); // called 4 times
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 4 Voltage versus frequency (512 points), dB scale
-//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
-//    ST7735_PlotClear(0,511);  // parameters ignored
-//    {
-//        ST7735_PlotdBfs(mag[i++]); // called 4 times
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// *************** ST7735_OutChar ********************
-// Output one character to the LCD
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// Inputs: 8-bit ASCII character
-// Outputs: none
-void ST7735_OutChar(char ch){
-  if((ch == 10) || (ch == 13) || (ch == 27)){
-    StY++; StX=0;
-    if(StY>15){
-      StY = 0;
-    }
-    ST7735_DrawString(0,StY,"                     ",StTextColor);
-    return;
-  }
-  ST7735_DrawCharS(StX*6,StY*10,ch,ST7735_WHITE,ST7735_BLACK, 1);
-  StX++;
-  if(StX>20){
-    StX = 20;
-    ST7735_DrawCharS(StX*6,StY*10,'*',ST7735_RED,ST7735_BLACK, 1);
-  }
-  return;
-}
-//********ST7735_OutString*****************
-// Print a string of characters to the ST7735 LCD.
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// The string will not automatically wrap.
-// inputs: ptr  pointer to NULL-terminated ASCII string
-// outputs: none
-void ST7735_OutString(char *ptr){
-  while(*ptr){
-    ST7735_OutChar(*ptr);
-    ptr = ptr + 1;
-  }
-}
-// ************** ST7735_SetTextColor ************************
-// Sets the color in which the characters will be printed 
-// Background color is fixed at black
-// Input:  16-bit packed color
-// Output: none
-// ********************************************************
-void ST7735_SetTextColor(uint16_t color){
-  StTextColor = color;
-}
-// Print a character to ST7735 LCD.
-int fputc(int ch, FILE *f){
-  ST7735_OutChar(ch);
-  return 1;
-}
-// No input from Nokia, always return data.
-int fgetc (FILE *f){
-  return 0;
-}
-// Function called when file error occurs.
-int ferror(FILE *f){
-  /* Your implementation of ferror */
-  return EOF;
-}
-// Abstraction of general output device
-// Volume 2 section 3.4.5
-
-// *************** Output_Init ********************
-// Standard device driver initialization function for printf
-// Initialize ST7735 LCD
-// Inputs: none
-// Outputs: none
-void Output_Init(void){
-  ST7735_InitR(INITR_REDTAB);
-  ST7735_FillScreen(0);                 // set screen to black
-}
-
-// Clear display
-void Output_Clear(void){ // Clears the display
-  ST7735_FillScreen(0);    // set screen to black
-}
-// Turn off display (low power)
-void Output_Off(void){   // Turns off the display
-  Output_Clear();  // not implemented
-}
-// Turn on display
-void Output_On(void){ // Turns on the display
-  Output_Init();      // reinitialize
-}
-// set the color for future output
-// Background color is fixed at black
-// Input:  16-bit packed color
-// Output: none
-void Output_Color(uint32_t newColor){ // Set color of future output 
-  ST7735_SetTextColor(newColor);
-}
+/***************************************************
+  This is a library for the Adafruit 1.8" SPI display.
+  This library works with the Adafruit 1.8" TFT Breakout w/SD card
+  ----> http://www.adafruit.com/products/358
+  as well as Adafruit raw 1.8" TFT displayun
+  ----> http://www.adafruit.com/products/618
+
+  Check out the links above for our tutorials and wiring diagrams
+  These displays use SPI to communicate, 4 or 5 pins are required to
+  interface (RST is optional)
+  Adafruit invests time and resources providing this open source code,
+  please support Adafruit and open-source hardware by purchasing
+  products from Adafruit!
+
+  Written by Limor Fried/Ladyada for Adafruit Industries.
+  MIT license, all text above must be included in any redistribution
+ ****************************************************/
+
+// ST7735.c
+// Runs on LM4F120/TM4C123
+// Low level drivers for the ST7735 160x128 LCD based off of
+// the file described above.
+//    16-bit color, 128 wide by 160 high LCD
+// Daniel Valvano
+// September 12, 2013
+// Augmented 7/17/2014 to have a simple graphics facility
+// Tested with LaunchPadDLL.dll simulator 9/2/2014
+// Last Modified: 3/6/2015 
+/* This example accompanies the book
+   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
+   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2014
+
+ Copyright 2014 by Jonathan W. Valvano, valvano@mail.utexas.edu
+    You may use, edit, run or distribute this file
+    as long as the above copyright notice remains
+ THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+ */
+
+// Backlight (pin 10) connected to +3.3 V
+// MISO (pin 9) unconnected
+// SCK (pin 8) connected to PA2 (SSI0Clk)
+// MOSI (pin 7) connected to PA5 (SSI0Tx)
+// TFT_CS (pin 6) connected to PA3 (SSI0Fss)
+// CARD_CS (pin 5) unconnected
+// Data/Command (pin 4) connected to PA6 (GPIO), high for data, low for command
+// RESET (pin 3) connected to PA7 (GPIO)
+// VCC (pin 2) connected to +3.3 V
+// Gnd (pin 1) connected to ground
+#include <stdio.h>
+#include <stdint.h>
+#include "ST7735.h"
+#include "CycleCount.h"
+#include "tm4c123gh6pm.h"
+
+// 16 rows (0 to 15) and 21 characters (0 to 20)
+// Requires (11 + size*size*6*8) bytes of transmission for each character
+uint32_t StX=0; // position along the horizonal axis 0 to 20 
+uint32_t StY=0; // position along the vertical axis 0 to 15
+uint16_t StTextColor = ST7735_WHITE;
+
+#define ST7735_NOP     0x00
+#define ST7735_SWRESET 0x01
+#define ST7735_RDDID   0x04
+#define ST7735_RDDST   0x09
+
+#define ST7735_SLPIN   0x10
+#define ST7735_SLPOUT  0x11
+#define ST7735_PTLON   0x12
+#define ST7735_NORON   0x13
+
+#define ST7735_INVOFF  0x20
+#define ST7735_INVON   0x21
+#define ST7735_DISPOFF 0x28
+#define ST7735_DISPON  0x29
+#define ST7735_CASET   0x2A
+#define ST7735_RASET   0x2B
+#define ST7735_RAMWR   0x2C
+#define ST7735_RAMRD   0x2E
+
+#define ST7735_PTLAR   0x30
+#define ST7735_SCRLAR  0x33
+#define ST7735_COLMOD  0x3A
+#define ST7735_MADCTL  0x36
+#define ST7735_VSCSAD  0x37
+
+#define ST7735_FRMCTR1 0xB1
+#define ST7735_FRMCTR2 0xB2
+#define ST7735_FRMCTR3 0xB3
+#define ST7735_INVCTR  0xB4
+#define ST7735_DISSET5 0xB6
+
+#define ST7735_PWCTR1  0xC0
+#define ST7735_PWCTR2  0xC1
+#define ST7735_PWCTR3  0xC2
+#define ST7735_PWCTR4  0xC3
+#define ST7735_PWCTR5  0xC4
+#define ST7735_VMCTR1  0xC5
+
+#define ST7735_RDID1   0xDA
+#define ST7735_RDID2   0xDB
+#define ST7735_RDID3   0xDC
+#define ST7735_RDID4   0xDD
+
+#define ST7735_PWCTR6  0xFC
+
+#define ST7735_GMCTRP1 0xE0
+#define ST7735_GMCTRN1 0xE1
+
+#define TFT_CS                  (*((volatile uint32_t *)0x40004020))
+#define TFT_CS_LOW              0           // CS normally controlled by hardware
+#define TFT_CS_HIGH             0x08
+#define DC                      (*((volatile uint32_t *)0x40004100))
+#define DC_COMMAND              0
+#define DC_DATA                 0x40
+#define RESET                   (*((volatile uint32_t *)0x40004200))
+#define RESET_LOW               0
+#define RESET_HIGH              0x80
+
+#define SSI_CR0_SCR_M           0x0000FF00  // SSI Serial Clock Rate
+#define SSI_CR0_SPH             0x00000080  // SSI Serial Clock Phase
+#define SSI_CR0_SPO             0x00000040  // SSI Serial Clock Polarity
+#define SSI_CR0_FRF_M           0x00000030  // SSI Frame Format Select
+#define SSI_CR0_FRF_MOTO        0x00000000  // Freescale SPI Frame Format
+#define SSI_CR0_DSS_M           0x0000000F  // SSI Data Size Select
+#define SSI_CR0_DSS_8           0x00000007  // 8-bit data
+#define SSI_CR1_MS              0x00000004  // SSI Master/Slave Select
+#define SSI_CR1_SSE             0x00000002  // SSI Synchronous Serial Port
+                                            // Enable
+#define SSI_SR_BSY              0x00000010  // SSI Busy Bit
+#define SSI_SR_TNF              0x00000002  // SSI Transmit FIFO Not Full
+#define SSI_CPSR_CPSDVSR_M      0x000000FF  // SSI Clock Prescale Divisor
+#define SSI_CC_CS_M             0x0000000F  // SSI Baud Clock Source
+#define SSI_CC_CS_SYSPLL        0x00000000  // Either the system clock (if the
+                                            // PLL bypass is in effect) or the
+                                            // PLL output (default)
+#define SYSCTL_RCGC1_SSI0       0x00000010  // SSI0 Clock Gating Control
+#define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
+#define ST7735_TFTWIDTH  128
+#define ST7735_TFTHEIGHT 160
+
+#define ST7735_NOP     0x00
+#define ST7735_SWRESET 0x01
+#define ST7735_RDDID   0x04
+#define ST7735_RDDST   0x09
+
+#define ST7735_SLPIN   0x10
+#define ST7735_SLPOUT  0x11
+#define ST7735_PTLON   0x12
+#define ST7735_NORON   0x13
+
+#define ST7735_INVOFF  0x20
+#define ST7735_INVON   0x21
+#define ST7735_DISPOFF 0x28
+#define ST7735_DISPON  0x29
+#define ST7735_CASET   0x2A
+#define ST7735_RASET   0x2B
+#define ST7735_RAMWR   0x2C
+#define ST7735_RAMRD   0x2E
+
+#define ST7735_PTLAR   0x30
+#define ST7735_SCRLAR  0x33
+#define ST7735_COLMOD  0x3A
+#define ST7735_MADCTL  0x36
+#define ST7735_VSCSAD  0x37
+
+#define ST7735_FRMCTR1 0xB1
+#define ST7735_FRMCTR2 0xB2
+#define ST7735_FRMCTR3 0xB3
+#define ST7735_INVCTR  0xB4
+#define ST7735_DISSET5 0xB6
+
+#define ST7735_PWCTR1  0xC0
+#define ST7735_PWCTR2  0xC1
+#define ST7735_PWCTR3  0xC2
+#define ST7735_PWCTR4  0xC3
+#define ST7735_PWCTR5  0xC4
+#define ST7735_VMCTR1  0xC5
+
+#define ST7735_RDID1   0xDA
+#define ST7735_RDID2   0xDB
+#define ST7735_RDID3   0xDC
+#define ST7735_RDID4   0xDD
+
+#define ST7735_PWCTR6  0xFC
+
+#define ST7735_GMCTRP1 0xE0
+#define ST7735_GMCTRN1 0xE1
+
+// standard ascii 5x7 font
+// originally from glcdfont.c from Adafruit project
+static const uint8_t Font[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3E, 0x5B, 0x4F, 0x5B, 0x3E,
+  0x3E, 0x6B, 0x4F, 0x6B, 0x3E,
+  0x1C, 0x3E, 0x7C, 0x3E, 0x1C,
+  0x18, 0x3C, 0x7E, 0x3C, 0x18,
+  0x1C, 0x57, 0x7D, 0x57, 0x1C,
+  0x1C, 0x5E, 0x7F, 0x5E, 0x1C,
+  0x00, 0x18, 0x3C, 0x18, 0x00,
+  0xFF, 0xE7, 0xC3, 0xE7, 0xFF,
+  0x00, 0x18, 0x24, 0x18, 0x00,
+  0xFF, 0xE7, 0xDB, 0xE7, 0xFF,
+  0x30, 0x48, 0x3A, 0x06, 0x0E,
+  0x26, 0x29, 0x79, 0x29, 0x26,
+  0x40, 0x7F, 0x05, 0x05, 0x07,
+  0x40, 0x7F, 0x05, 0x25, 0x3F,
+  0x5A, 0x3C, 0xE7, 0x3C, 0x5A,
+  0x7F, 0x3E, 0x1C, 0x1C, 0x08,
+  0x08, 0x1C, 0x1C, 0x3E, 0x7F,
+  0x14, 0x22, 0x7F, 0x22, 0x14,
+  0x5F, 0x5F, 0x00, 0x5F, 0x5F,
+  0x06, 0x09, 0x7F, 0x01, 0x7F,
+  0x00, 0x66, 0x89, 0x95, 0x6A,
+  0x60, 0x60, 0x60, 0x60, 0x60,
+  0x94, 0xA2, 0xFF, 0xA2, 0x94,
+  0x08, 0x04, 0x7E, 0x04, 0x08,
+  0x10, 0x20, 0x7E, 0x20, 0x10,
+  0x08, 0x08, 0x2A, 0x1C, 0x08,
+  0x08, 0x1C, 0x2A, 0x08, 0x08,
+  0x1E, 0x10, 0x10, 0x10, 0x10,
+  0x0C, 0x1E, 0x0C, 0x1E, 0x0C,
+  0x30, 0x38, 0x3E, 0x38, 0x30,
+  0x06, 0x0E, 0x3E, 0x0E, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x07, 0x00,
+  0x14, 0x7F, 0x14, 0x7F, 0x14,
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,
+  0x23, 0x13, 0x08, 0x64, 0x62,
+  0x36, 0x49, 0x56, 0x20, 0x50,
+  0x00, 0x08, 0x07, 0x03, 0x00,
+  0x00, 0x1C, 0x22, 0x41, 0x00,
+  0x00, 0x41, 0x22, 0x1C, 0x00,
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,
+  0x08, 0x08, 0x3E, 0x08, 0x08,
+  0x00, 0x80, 0x70, 0x30, 0x00,
+  0x08, 0x08, 0x08, 0x08, 0x08,
+  0x00, 0x00, 0x60, 0x60, 0x00,
+  0x20, 0x10, 0x08, 0x04, 0x02,
+  0x3E, 0x51, 0x49, 0x45, 0x3E, // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00, // 1
+  0x72, 0x49, 0x49, 0x49, 0x46, // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33, // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10, // 4
+  0x27, 0x45, 0x45, 0x45, 0x39, // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31, // 6
+  0x41, 0x21, 0x11, 0x09, 0x07, // 7
+  0x36, 0x49, 0x49, 0x49, 0x36, // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E, // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x40, 0x34, 0x00, 0x00,
+  0x00, 0x08, 0x14, 0x22, 0x41,
+  0x14, 0x14, 0x14, 0x14, 0x14,
+  0x00, 0x41, 0x22, 0x14, 0x08,
+  0x02, 0x01, 0x59, 0x09, 0x06,
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,
+  0x7C, 0x12, 0x11, 0x12, 0x7C, // A
+  0x7F, 0x49, 0x49, 0x49, 0x36, // B
+  0x3E, 0x41, 0x41, 0x41, 0x22, // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E, // D
+  0x7F, 0x49, 0x49, 0x49, 0x41, // E
+  0x7F, 0x09, 0x09, 0x09, 0x01, // F
+  0x3E, 0x41, 0x41, 0x51, 0x73, // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F, // H
+  0x00, 0x41, 0x7F, 0x41, 0x00, // I
+  0x20, 0x40, 0x41, 0x3F, 0x01, // J
+  0x7F, 0x08, 0x14, 0x22, 0x41, // K
+  0x7F, 0x40, 0x40, 0x40, 0x40, // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F, // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F, // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E, // O
+  0x7F, 0x09, 0x09, 0x09, 0x06, // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E, // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46, // R
+  0x26, 0x49, 0x49, 0x49, 0x32, // S
+  0x03, 0x01, 0x7F, 0x01, 0x03, // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F, // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F, // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F, // W
+  0x63, 0x14, 0x08, 0x14, 0x63, // X
+  0x03, 0x04, 0x78, 0x04, 0x03, // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43, // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,
+  0x02, 0x04, 0x08, 0x10, 0x20,
+  0x00, 0x41, 0x41, 0x41, 0x7F,
+  0x04, 0x02, 0x01, 0x02, 0x04,
+  0x40, 0x40, 0x40, 0x40, 0x40,
+  0x00, 0x03, 0x07, 0x08, 0x00,
+  0x20, 0x54, 0x54, 0x78, 0x40, // a
+  0x7F, 0x28, 0x44, 0x44, 0x38, // b
+  0x38, 0x44, 0x44, 0x44, 0x28, // c
+  0x38, 0x44, 0x44, 0x28, 0x7F, // d
+  0x38, 0x54, 0x54, 0x54, 0x18, // e
+  0x00, 0x08, 0x7E, 0x09, 0x02, // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78, // g
+  0x7F, 0x08, 0x04, 0x04, 0x78, // h
+  0x00, 0x44, 0x7D, 0x40, 0x00, // i
+  0x20, 0x40, 0x40, 0x3D, 0x00, // j
+  0x7F, 0x10, 0x28, 0x44, 0x00, // k
+  0x00, 0x41, 0x7F, 0x40, 0x00, // l
+  0x7C, 0x04, 0x78, 0x04, 0x78, // m
+  0x7C, 0x08, 0x04, 0x04, 0x78, // n
+  0x38, 0x44, 0x44, 0x44, 0x38, // o
+  0xFC, 0x18, 0x24, 0x24, 0x18, // p
+  0x18, 0x24, 0x24, 0x18, 0xFC, // q
+  0x7C, 0x08, 0x04, 0x04, 0x08, // r
+  0x48, 0x54, 0x54, 0x54, 0x24, // s
+  0x04, 0x04, 0x3F, 0x44, 0x24, // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C, // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C, // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C, // w
+  0x44, 0x28, 0x10, 0x28, 0x44, // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C, // y
+  0x44, 0x64, 0x54, 0x4C, 0x44, // z
+  0x00, 0x08, 0x36, 0x41, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00,
+  0x00, 0x41, 0x36, 0x08, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x02,
+  0x3C, 0x26, 0x23, 0x26, 0x3C,
+  0x1E, 0xA1, 0xA1, 0x61, 0x12,
+  0x3A, 0x40, 0x40, 0x20, 0x7A,
+  0x38, 0x54, 0x54, 0x55, 0x59,
+  0x21, 0x55, 0x55, 0x79, 0x41,
+  0x21, 0x54, 0x54, 0x78, 0x41,
+  0x21, 0x55, 0x54, 0x78, 0x40,
+  0x20, 0x54, 0x55, 0x79, 0x40,
+  0x0C, 0x1E, 0x52, 0x72, 0x12,
+  0x39, 0x55, 0x55, 0x55, 0x59,
+  0x39, 0x54, 0x54, 0x54, 0x59,
+  0x39, 0x55, 0x54, 0x54, 0x58,
+  0x00, 0x00, 0x45, 0x7C, 0x41,
+  0x00, 0x02, 0x45, 0x7D, 0x42,
+  0x00, 0x01, 0x45, 0x7C, 0x40,
+  0xF0, 0x29, 0x24, 0x29, 0xF0,
+  0xF0, 0x28, 0x25, 0x28, 0xF0,
+  0x7C, 0x54, 0x55, 0x45, 0x00,
+  0x20, 0x54, 0x54, 0x7C, 0x54,
+  0x7C, 0x0A, 0x09, 0x7F, 0x49,
+  0x32, 0x49, 0x49, 0x49, 0x32,
+  0x32, 0x48, 0x48, 0x48, 0x32,
+  0x32, 0x4A, 0x48, 0x48, 0x30,
+  0x3A, 0x41, 0x41, 0x21, 0x7A,
+  0x3A, 0x42, 0x40, 0x20, 0x78,
+  0x00, 0x9D, 0xA0, 0xA0, 0x7D,
+  0x39, 0x44, 0x44, 0x44, 0x39,
+  0x3D, 0x40, 0x40, 0x40, 0x3D,
+  0x3C, 0x24, 0xFF, 0x24, 0x24,
+  0x48, 0x7E, 0x49, 0x43, 0x66,
+  0x2B, 0x2F, 0xFC, 0x2F, 0x2B,
+  0xFF, 0x09, 0x29, 0xF6, 0x20,
+  0xC0, 0x88, 0x7E, 0x09, 0x03,
+  0x20, 0x54, 0x54, 0x79, 0x41,
+  0x00, 0x00, 0x44, 0x7D, 0x41,
+  0x30, 0x48, 0x48, 0x4A, 0x32,
+  0x38, 0x40, 0x40, 0x22, 0x7A,
+  0x00, 0x7A, 0x0A, 0x0A, 0x72,
+  0x7D, 0x0D, 0x19, 0x31, 0x7D,
+  0x26, 0x29, 0x29, 0x2F, 0x28,
+  0x26, 0x29, 0x29, 0x29, 0x26,
+  0x30, 0x48, 0x4D, 0x40, 0x20,
+  0x38, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x08, 0x38,
+  0x2F, 0x10, 0xC8, 0xAC, 0xBA,
+  0x2F, 0x10, 0x28, 0x34, 0xFA,
+  0x00, 0x00, 0x7B, 0x00, 0x00,
+  0x08, 0x14, 0x2A, 0x14, 0x22,
+  0x22, 0x14, 0x2A, 0x14, 0x08,
+  0xAA, 0x00, 0x55, 0x00, 0xAA,
+  0xAA, 0x55, 0xAA, 0x55, 0xAA,
+  0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x10, 0x10, 0x10, 0xFF, 0x00,
+  0x14, 0x14, 0x14, 0xFF, 0x00,
+  0x10, 0x10, 0xFF, 0x00, 0xFF,
+  0x10, 0x10, 0xF0, 0x10, 0xF0,
+  0x14, 0x14, 0x14, 0xFC, 0x00,
+  0x14, 0x14, 0xF7, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0xFF,
+  0x14, 0x14, 0xF4, 0x04, 0xFC,
+  0x14, 0x14, 0x17, 0x10, 0x1F,
+  0x10, 0x10, 0x1F, 0x10, 0x1F,
+  0x14, 0x14, 0x14, 0x1F, 0x00,
+  0x10, 0x10, 0x10, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0x10,
+  0x10, 0x10, 0x10, 0x1F, 0x10,
+  0x10, 0x10, 0x10, 0xF0, 0x10,
+  0x00, 0x00, 0x00, 0xFF, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0xFF, 0x10,
+  0x00, 0x00, 0x00, 0xFF, 0x14,
+  0x00, 0x00, 0xFF, 0x00, 0xFF,
+  0x00, 0x00, 0x1F, 0x10, 0x17,
+  0x00, 0x00, 0xFC, 0x04, 0xF4,
+  0x14, 0x14, 0x17, 0x10, 0x17,
+  0x14, 0x14, 0xF4, 0x04, 0xF4,
+  0x00, 0x00, 0xFF, 0x00, 0xF7,
+  0x14, 0x14, 0x14, 0x14, 0x14,
+  0x14, 0x14, 0xF7, 0x00, 0xF7,
+  0x14, 0x14, 0x14, 0x17, 0x14,
+  0x10, 0x10, 0x1F, 0x10, 0x1F,
+  0x14, 0x14, 0x14, 0xF4, 0x14,
+  0x10, 0x10, 0xF0, 0x10, 0xF0,
+  0x00, 0x00, 0x1F, 0x10, 0x1F,
+  0x00, 0x00, 0x00, 0x1F, 0x14,
+  0x00, 0x00, 0x00, 0xFC, 0x14,
+  0x00, 0x00, 0xF0, 0x10, 0xF0,
+  0x10, 0x10, 0xFF, 0x10, 0xFF,
+  0x14, 0x14, 0x14, 0xFF, 0x14,
+  0x10, 0x10, 0x10, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0xF0, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x38, 0x44, 0x44, 0x38, 0x44,
+  0x7C, 0x2A, 0x2A, 0x3E, 0x14,
+  0x7E, 0x02, 0x02, 0x06, 0x06,
+  0x02, 0x7E, 0x02, 0x7E, 0x02,
+  0x63, 0x55, 0x49, 0x41, 0x63,
+  0x38, 0x44, 0x44, 0x3C, 0x04,
+  0x40, 0x7E, 0x20, 0x1E, 0x20,
+  0x06, 0x02, 0x7E, 0x02, 0x02,
+  0x99, 0xA5, 0xE7, 0xA5, 0x99,
+  0x1C, 0x2A, 0x49, 0x2A, 0x1C,
+  0x4C, 0x72, 0x01, 0x72, 0x4C,
+  0x30, 0x4A, 0x4D, 0x4D, 0x30,
+  0x30, 0x48, 0x78, 0x48, 0x30,
+  0xBC, 0x62, 0x5A, 0x46, 0x3D,
+  0x3E, 0x49, 0x49, 0x49, 0x00,
+  0x7E, 0x01, 0x01, 0x01, 0x7E,
+  0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x44, 0x44, 0x5F, 0x44, 0x44,
+  0x40, 0x51, 0x4A, 0x44, 0x40,
+  0x40, 0x44, 0x4A, 0x51, 0x40,
+  0x00, 0x00, 0xFF, 0x01, 0x03,
+  0xE0, 0x80, 0xFF, 0x00, 0x00,
+  0x08, 0x08, 0x6B, 0x6B, 0x08,
+  0x36, 0x12, 0x36, 0x24, 0x36,
+  0x06, 0x0F, 0x09, 0x0F, 0x06,
+  0x00, 0x00, 0x18, 0x18, 0x00,
+  0x00, 0x00, 0x10, 0x10, 0x00,
+  0x30, 0x40, 0xFF, 0x01, 0x01,
+  0x00, 0x1F, 0x01, 0x01, 0x1E,
+  0x00, 0x19, 0x1D, 0x17, 0x12,
+  0x00, 0x3C, 0x3C, 0x3C, 0x3C,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+
+static uint8_t ColStart, RowStart; // some displays need this changed
+static uint8_t Rotation;           // 0 to 3
+static uint8_t ScrollTop = 0, ScrollRows = ST7735_TFTHEIGHT; // area of ST7735_SetScrollArea()
+static enum initRFlags TabColor;
+static int16_t _width = ST7735_TFTWIDTH;   // this could probably be a constant, except it is used in Adafruit_GFX and depends on image rotation
+static int16_t _height = ST7735_TFTHEIGHT;
+
+// ST7735_Convert() of every 8-bit color, sent as one 16-bit frame
+static const uint16_t Palette8[256] = {
+  0x0000, 0x0009, 0x0012, 0x001B, 0x0120, 0x0129, 0x0132, 0x013B,
+  0x0240, 0x0249, 0x0252, 0x025B, 0x0360, 0x0369, 0x0372, 0x037B,
+  0x0480, 0x0489, 0x0492, 0x049B, 0x05A0, 0x05A9, 0x05B2, 0x05BB,
+  0x06C0, 0x06C9, 0x06D2, 0x06DB, 0x07E0, 0x07E9, 0x07F2, 0x07FB,
+  0x5000, 0x5009, 0x5012, 0x501B, 0x5120, 0x5129, 0x5132, 0x513B,
+  0x5240, 0x5249, 0x5252, 0x525B, 0x5360, 0x5369, 0x5372, 0x537B,
+  0x5480, 0x5489, 0x5492, 0x549B, 0x55A0, 0x55A9, 0x55B2, 0x55BB,
+  0x56C0, 0x56C9, 0x56D2, 0x56DB, 0x57E0, 0x57E9, 0x57F2, 0x57FB,
+  0xA800, 0xA809, 0xA812, 0xA81B, 0xA920, 0xA929, 0xA932, 0xA93B,
+  0xAA40, 0xAA49, 0xAA52, 0xAA5B, 0xAB60, 0xAB69, 0xAB72, 0xAB7B,
+  0xAC80, 0xAC89, 0xAC92, 0xAC9B, 0xADA0, 0xADA9, 0xADB2, 0xADBB,
+  0xAEC0, 0xAEC9, 0xAED2, 0xAEDB, 0xAFE0, 0xAFE9, 0xAFF2, 0xAFFB,
+  0xF800, 0xF809, 0xF812, 0xF81B, 0xF920, 0xF929, 0xF932, 0xF93B,
+  0xFA40, 0xFA49, 0xFA52, 0xFA5B, 0xFB60, 0xFB69, 0xFB72, 0xFB7B,
+  0xFC80, 0xFC89, 0xFC92, 0xFC9B, 0xFDA0, 0xFDA9, 0xFDB2, 0xFDBB,
+  0xFEC0, 0xFEC9, 0xFED2, 0xFEDB, 0xFFE0, 0xFFE9, 0xFFF2, 0xFFFB,
+  0x0000, 0x0009, 0x0012, 0x001B, 0x0120, 0x0129, 0x0132, 0x013B,
+  0x0240, 0x0249, 0x0252, 0x025B, 0x0360, 0x0369, 0x0372, 0x037B,
+  0x0480, 0x0489, 0x0492, 0x049B, 0x05A0, 0x05A9, 0x05B2, 0x05BB,
+  0x06C0, 0x06C9, 0x06D2, 0x06DB, 0x07E0, 0x07E9, 0x07F2, 0x07FB,
+  0x5000, 0x5009, 0x5012, 0x501B, 0x5120, 0x5129, 0x5132, 0x513B,
+  0x5240, 0x5249, 0x5252, 0x525B, 0x5360, 0x5369, 0x5372, 0x537B,
+  0x5480, 0x5489, 0x5492, 0x549B, 0x55A0, 0x55A9, 0x55B2, 0x55BB,
+  0x56C0, 0x56C9, 0x56D2, 0x56DB, 0x57E0, 0x57E9, 0x57F2, 0x57FB,
+  0xA800, 0xA809, 0xA812, 0xA81B, 0xA920, 0xA929, 0xA932, 0xA93B,
+  0xAA40, 0xAA49, 0xAA52, 0xAA5B, 0xAB60, 0xAB69, 0xAB72, 0xAB7B,
+  0xAC80, 0xAC89, 0xAC92, 0xAC9B, 0xADA0, 0xADA9, 0xADB2, 0xADBB,
+  0xAEC0, 0xAEC9, 0xAED2, 0xAEDB, 0xAFE0, 0xAFE9, 0xAFF2, 0xAFFB,
+  0xF800, 0xF809, 0xF812, 0xF81B, 0xF920, 0xF929, 0xF932, 0xF93B,
+  0xFA40, 0xFA49, 0xFA52, 0xFA5B, 0xFB60, 0xFB69, 0xFB72, 0xFB7B,
+  0xFC80, 0xFC89, 0xFC92, 0xFC9B, 0xFDA0, 0xFDA9, 0xFDB2, 0xFDBB,
+  0xFEC0, 0xFEC9, 0xFED2, 0xFEDB, 0xFFE0, 0xFFE9, 0xFFF2, 0xFFFB
+};
+static const uint16_t *Palette = Palette8;
+static const uint16_t *BasePalette = Palette8; // from ST7735_SetPalette(), before the tint and fade
+
+// Color a palette layer moves every entry toward
+typedef struct PaletteLayer {
+  uint16_t color;                       // 16-bit color
+  int16_t level;                        // 0 for none to ST7735_PALETTE_FULL
+  int16_t target;                       // level to end at
+  uint8_t frames;                       // steps left to reach it
+} PaletteLayer;
+static PaletteLayer Tint = {0, 0, 0, 0}, Fade = {0, 0, 0, 0};
+static uint16_t MixedPalette[256];      // Palette while either layer shows
+void static paletteMix(void);
+
+// uDMA channel 11 is SSI0 TX, so the control table needs entries 0 to 11
+#define DMA_SSI0TX              11
+#define DMA_SSI0TX_BIT          (1<<DMA_SSI0TX)
+__align(1024) uint32_t DMAControl[4*(DMA_SSI0TX+1)]; // primary control structures
+
+// state of ST7735_FlushRectsAsync(), owned by SSI0_Handler() while FlushActive
+static const uint8_t *FlushBuf;
+static uint8_t FlushPacked;            // 1 if FlushBuf holds only the regions, packed
+static ST7735_Rect FlushRect[ST7735_FLUSH_N];
+static uint8_t FlushRectN;             // number of regions in this flush
+static uint8_t FlushRectI;             // region being converted
+static uint8_t FlushRow;               // next row of that region to convert
+static uint16_t FlushLine[2][ST7735_TFTWIDTH]; // ping-pong chunks of 16-bit color
+static uint16_t FlushLineSize[2];      // pixels in each chunk, 0 if nothing left
+static int8_t FlushLineRect[2];        // region the chunk starts, -1 if it continues one
+static uint8_t FlushNext;              // chunk to send when the current one is done
+static volatile uint8_t FlushActive;   // 1 while a flush is running
+
+
+// The Data/Command pin must be valid when the eighth bit is
+// sent.  The SSI module has hardware input and output FIFOs
+// that are 8 locations deep.  Based on the observation that
+// the LCD interface tends to send a few commands and then a
+// lot of data, the FIFOs are not used when writing
+// commands, and they are used when writing data.  This
+// ensures that the Data/Command pin status matches the byte
+// that is actually being transmitted.
+// The write command operation waits until all data has been
+// sent, configures the Data/Command pin for commands, sends
+// the command, and then waits for the transmission to
+// finish.
+// The write data operation waits until there is room in the
+// transmit FIFO and then adds the data to the transmit FIFO.
+// The write command operation leaves the Data/Command pin set
+// for data, so it only changes once per command and data run.
+// NOTE: These functions will crash or stall indefinitely if
+// the SSI0 module is not initialized and enabled.
+void writecommand(uint8_t c);
+
+
+void writedata(uint8_t c);
+
+// Commands and their arguments are 8-bit frames.  Pixels are sent
+// as 16-bit frames (DSS=16), so one FIFO entry carries a whole
+// RGB565 pixel and the 8-entry FIFO holds 8 pixels instead of 4.
+static uint8_t FrameBits = 8;          // current SSI0 data size
+
+// Changes the SSI0 data size, which is only allowed while the SSI
+// is disabled, so it waits for the frames already queued.
+void static frameSize(uint8_t bits) {
+  if(FrameBits == bits) return;
+  while(SSI0_SR_R&SSI_SR_BSY){};        // wait for the last frame to go out
+  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
+  if(bits == 16){
+    SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_16;
+  } else{
+    SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
+  }
+  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+  FrameBits = bits;
+}
+
+// Sets the SSI0Clk divider, SysClk/cpsdvsr
+// SSI0 must be idle; the divider must be even, 2 to 254
+void static clockDivisor(uint8_t cpsdvsr) {
+  while(SSI0_SR_R&SSI_SR_BSY){};
+  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
+  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+cpsdvsr;
+  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+}
+
+// Subroutine to wait 1 msec
+// Inputs: None
+// Outputs: None
+// Notes: ...
+void Delay1ms(uint32_t n){uint32_t volatile time;
+  while(n){
+    time = 72724*2/91;  // 1msec, tuned at 80 MHz
+    while(time){
+	  	time--;
+    }
+    n--;
+  }
+}
+
+// Rather than a bazillion writecommand() and writedata() calls, screen
+// initialization commands and arguments are organized in these tables
+// stored in ROM.  The table may look bulky, but that's mostly the
+// formatting -- storage-wise this is hundreds of bytes more compact
+// than the equivalent code.  Companion function follows.
+#define DELAY 0x80
+static const uint8_t
+  Bcmd[] = {                  // Initialization commands for 7735B screens
+    18,                       // 18 commands in list:
+    ST7735_SWRESET,   DELAY,  //  1: Software reset, no args, w/delay
+      50,                     //     50 ms delay
+    ST7735_SLPOUT ,   DELAY,  //  2: Out of sleep mode, no args, w/delay
+      255,                    //     255 = 500 ms delay
+    ST7735_COLMOD , 1+DELAY,  //  3: Set color mode, 1 arg + delay:
+      0x05,                   //     16-bit color
+      10,                     //     10 ms delay
+    ST7735_FRMCTR1, 3+DELAY,  //  4: Frame rate control, 3 args + delay:
+      0x00,                   //     fastest refresh
+      0x06,                   //     6 lines front porch
+      0x03,                   //     3 lines back porch
+      10,                     //     10 ms delay
+    ST7735_MADCTL , 1      ,  //  5: Memory access ctrl (directions), 1 arg:
+      0x08,                   //     Row addr/col addr, bottom to top refresh
+    ST7735_DISSET5, 2      ,  //  6: Display settings #5, 2 args, no delay:
+      0x15,                   //     1 clk cycle nonoverlap, 2 cycle gate
+                              //     rise, 3 cycle osc equalize
+      0x02,                   //     Fix on VTL
+    ST7735_INVCTR , 1      ,  //  7: Display inversion control, 1 arg:
+      0x0,                    //     Line inversion
+    ST7735_PWCTR1 , 2+DELAY,  //  8: Power control, 2 args + delay:
+      0x02,                   //     GVDD = 4.7V
+      0x70,                   //     1.0uA
+      10,                     //     10 ms delay
+    ST7735_PWCTR2 , 1      ,  //  9: Power control, 1 arg, no delay:
+      0x05,                   //     VGH = 14.7V, VGL = -7.35V
+    ST7735_PWCTR3 , 2      ,  // 10: Power control, 2 args, no delay:
+      0x01,                   //     Opamp current small
+      0x02,                   //     Boost frequency
+    ST7735_VMCTR1 , 2+DELAY,  // 11: Power control, 2 args + delay:
+      0x3C,                   //     VCOMH = 4V
+      0x38,                   //     VCOML = -1.1V
+      10,                     //     10 ms delay
+    ST7735_PWCTR6 , 2      ,  // 12: Power control, 2 args, no delay:
+      0x11, 0x15,
+    ST7735_GMCTRP1,16      ,  // 13: Magical unicorn dust, 16 args, no delay:
+      0x09, 0x16, 0x09, 0x20, //     (seriously though, not sure what
+      0x21, 0x1B, 0x13, 0x19, //      these config values represent)
+      0x17, 0x15, 0x1E, 0x2B,
+      0x04, 0x05, 0x02, 0x0E,
+    ST7735_GMCTRN1,16+DELAY,  // 14: Sparkles and rainbows, 16 args + delay:
+      0x0B, 0x14, 0x08, 0x1E, //     (ditto)
+      0x22, 0x1D, 0x18, 0x1E,
+      0x1B, 0x1A, 0x24, 0x2B,
+      0x06, 0x06, 0x02, 0x0F,
+      10,                     //     10 ms delay
+    ST7735_CASET  , 4      ,  // 15: Column addr set, 4 args, no delay:
+      0x00, 0x02,             //     XSTART = 2
+      0x00, 0x81,             //     XEND = 129
+    ST7735_RASET  , 4      ,  // 16: Row addr set, 4 args, no delay:
+      0x00, 0x02,             //     XSTART = 1
+      0x00, 0x81,             //     XEND = 160
+    ST7735_NORON  ,   DELAY,  // 17: Normal display on, no args, w/delay
+      10,                     //     10 ms delay
+    ST7735_DISPON ,   DELAY,  // 18: Main screen turn on, no args, w/delay
+      255 };                  //     255 = 500 ms delay
+static const uint8_t
+  Rcmd1[] = {                 // Init for 7735R, part 1 (red or green tab)
+    15,                       // 15 commands in list:
+    ST7735_SWRESET,   DELAY,  //  1: Software reset, 0 args, w/delay
+      150,                    //     150 ms delay
+    ST7735_SLPOUT ,   DELAY,  //  2: Out of sleep mode, 0 args, w/delay
+      255,                    //     500 ms delay
+    ST7735_FRMCTR1, 3      ,  //  3: Frame rate ctrl - normal mode, 3 args:
+      0x01, 0x2C, 0x2D,       //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
+    ST7735_FRMCTR2, 3      ,  //  4: Frame rate control - idle mode, 3 args:
+      0x01, 0x2C, 0x2D,       //     Rate = fosc/(1x2+40) * (LINE+2C+2D)
+    ST7735_FRMCTR3, 6      ,  //  5: Frame rate ctrl - partial mode, 6 args:
+      0x01, 0x2C, 0x2D,       //     Dot inversion mode
+      0x01, 0x2C, 0x2D,       //     Line inversion mode
+    ST7735_INVCTR , 1      ,  //  6: Display inversion ctrl, 1 arg, no delay:
+      0x07,                   //     No inversion
+    ST7735_PWCTR1 , 3      ,  //  7: Power control, 3 args, no delay:
+      0xA2,
+      0x02,                   //     -4.6V
+      0x84,                   //     AUTO mode
+    ST7735_PWCTR2 , 1      ,  //  8: Power control, 1 arg, no delay:
+      0xC5,                   //     VGH25 = 2.4C VGSEL = -10 VGH = 3 * AVDD
+    ST7735_PWCTR3 , 2      ,  //  9: Power control, 2 args, no delay:
+      0x0A,                   //     Opamp current small
+      0x00,                   //     Boost frequency
+    ST7735_PWCTR4 , 2      ,  // 10: Power control, 2 args, no delay:
+      0x8A,                   //     BCLK/2, Opamp current small & Medium low
+      0x2A,
+    ST7735_PWCTR5 , 2      ,  // 11: Power control, 2 args, no delay:
+      0x8A, 0xEE,
+    ST7735_VMCTR1 , 1      ,  // 12: Power control, 1 arg, no delay:
+      0x0E,
+    ST7735_INVOFF , 0      ,  // 13: Don't invert display, no args, no delay
+    ST7735_MADCTL , 1      ,  // 14: Memory access control (directions), 1 arg:
+      0xC8,                   //     row addr/col addr, bottom to top refresh
+    ST7735_COLMOD , 1      ,  // 15: set color mode, 1 arg, no delay:
+      0x05 };                 //     16-bit color
+static const uint8_t
+  Rcmd2green[] = {            // Init for 7735R, part 2 (green tab only)
+    2,                        //  2 commands in list:
+    ST7735_CASET  , 4      ,  //  1: Column addr set, 4 args, no delay:
+      0x00, 0x02,             //     XSTART = 0
+      0x00, 0x7F+0x02,        //     XEND = 127
+    ST7735_RASET  , 4      ,  //  2: Row addr set, 4 args, no delay:
+      0x00, 0x01,             //     XSTART = 0
+      0x00, 0x9F+0x01 };      //     XEND = 159
+static const uint8_t
+  Rcmd2red[] = {              // Init for 7735R, part 2 (red tab only)
+    2,                        //  2 commands in list:
+    ST7735_CASET  , 4      ,  //  1: Column addr set, 4 args, no delay:
+      0x00, 0x00,             //     XSTART = 0
+      0x00, 0x7F,             //     XEND = 127
+    ST7735_RASET  , 4      ,  //  2: Row addr set, 4 args, no delay:
+      0x00, 0x00,             //     XSTART = 0
+      0x00, 0x9F };           //     XEND = 159
+static const uint8_t
+  Rcmd3[] = {                 // Init for 7735R, part 3 (red or green tab)
+    4,                        //  4 commands in list:
+    ST7735_GMCTRP1, 16      , //  1: Magical unicorn dust, 16 args, no delay:
+      0x02, 0x1c, 0x07, 0x12,
+      0x37, 0x32, 0x29, 0x2d,
+      0x29, 0x25, 0x2B, 0x39,
+      0x00, 0x01, 0x03, 0x10,
+    ST7735_GMCTRN1, 16      , //  2: Sparkles and rainbows, 16 args, no delay:
+      0x03, 0x1d, 0x07, 0x06,
+      0x2E, 0x2C, 0x29, 0x2D,
+      0x2E, 0x2E, 0x37, 0x3F,
+      0x00, 0x00, 0x02, 0x10,
+    ST7735_NORON  ,    DELAY, //  3: Normal display on, no args, w/delay
+      10,                     //     10 ms delay
+    ST7735_DISPON ,    DELAY, //  4: Main screen turn on, no args w/delay
+      100 };                  //     100 ms delay
+
+
+// Companion code to the above tables.  Reads and issues
+// a series of LCD commands stored in ROM byte array.
+void static commandList(const uint8_t *addr) {
+
+  uint8_t numCommands, numArgs;
+  uint16_t ms;
+
+  frameSize(8);
+  numCommands = *(addr++);               // Number of commands to follow
+  while(numCommands--) {                 // For each command...
+    writecommand(*(addr++));             //   Read, issue command
+    numArgs  = *(addr++);                //   Number of args to follow
+    ms       = numArgs & DELAY;          //   If hibit set, delay follows args
+    numArgs &= ~DELAY;                   //   Mask out delay bit
+    while(numArgs--) {                   //   For each argument...
+      writedata(*(addr++));              //     Read, issue argument
+    }
+
+    if(ms) {
+      ms = *(addr++);             // Read post-command delay time (ms)
+      if(ms == 255) ms = 500;     // If 255, delay for 500 ms
+      Delay1ms(ms);
+    }
+  }
+}
+
+
+// Initialization code common to both 'B' and 'R' type displays
+void static commonInit(const uint8_t *cmdList) {
+  volatile uint32_t delay;
+  ColStart  = RowStart = 0; // May be overridden in init func
+
+  SYSCTL_RCGCSSI_R |= 0x01;  // activate SSI0
+  SYSCTL_RCGCGPIO_R |= 0x01; // activate port A
+  while((SYSCTL_PRGPIO_R&0x01)==0){}; // allow time for clock to start
+
+  // toggle RST low to reset; CS low so it'll listen to us
+  // SSI0Fss is temporarily used as GPIO
+  GPIO_PORTA_DIR_R |= 0xC8;             // make PA3,6,7 out
+  GPIO_PORTA_AFSEL_R &= ~0xC8;          // disable alt funct on PA3,6,7
+  GPIO_PORTA_DEN_R |= 0xC8;             // enable digital I/O on PA3,6,7
+                                        // configure PA3,6,7 as GPIO
+  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0x00FF0FFF)+0x00000000;
+  GPIO_PORTA_AMSEL_R &= ~0xC8;          // disable analog functionality on PA3,6,7
+  TFT_CS = TFT_CS_LOW;
+  RESET = RESET_HIGH;
+  Delay1ms(500);
+  RESET = RESET_LOW;
+  Delay1ms(500);
+  RESET = RESET_HIGH;
+  Delay1ms(500);
+
+  // initialize SSI0
+  GPIO_PORTA_AFSEL_R |= 0x2C;           // enable alt funct on PA2,3,5
+  GPIO_PORTA_DEN_R |= 0x2C;             // enable digital I/O on PA2,3,5
+                                        // configure PA2,3,5 as SSI
+  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFF0F00FF)+0x00202200;
+  GPIO_PORTA_AMSEL_R &= ~0x2C;          // disable analog functionality on PA2,3,5
+  SSI0_CR1_R &= ~SSI_CR1_SSE;           // disable SSI
+  SSI0_CR1_R &= ~SSI_CR1_MS;            // master mode
+                                        // configure for system clock/PLL baud clock source
+  SSI0_CC_R = (SSI0_CC_R&~SSI_CC_CS_M)+SSI_CC_CS_SYSPLL;
+//                                        // clock divider for 3.125 MHz SSIClk (50 MHz PIOSC/16)
+//  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+16;
+                                        // clock divider for 13.3 MHz SSIClk
+                                        // SysClk/(CPSDVSR*(1+SCR))
+                                        // 80/(6*(1+0)) = 13.3 MHz, see ST7735_SSI_DIVISOR
+  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+ST7735_SSI_DIVISOR; // must be even number
+  SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (8 Mbps data rate)
+                  SSI_CR0_SPH |         // SPH = 0
+                  SSI_CR0_SPO);         // SPO = 0
+                                        // FRF = Freescale format
+  SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_FRF_M)+SSI_CR0_FRF_MOTO;
+                                        // DSS = 8-bit data
+  SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
+  FrameBits = 8;
+  SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+
+  // initialize uDMA channel 11 (SSI0 TX) for ST7735_FlushRectsAsync()
+  SYSCTL_RCGCDMA_R |= 0x01;             // activate uDMA
+  while((SYSCTL_PRDMA_R&0x01)==0){};    // allow time for clock to start
+  UDMA_CFG_R = UDMA_CFG_MASTEN;         // enable uDMA controller
+  UDMA_CTLBASE_R = (uint32_t)DMAControl;
+  UDMA_CHMAP1_R &= ~UDMA_CHMAP1_CH11SEL_M; // encoding 0 is SSI0 TX
+  UDMA_PRIOCLR_R = DMA_SSI0TX_BIT;      // default priority
+  UDMA_ALTCLR_R = DMA_SSI0TX_BIT;       // primary control structure
+  UDMA_USEBURSTCLR_R = DMA_SSI0TX_BIT;  // single and burst requests
+  UDMA_REQMASKCLR_R = DMA_SSI0TX_BIT;   // allow requests from SSI0
+  SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;   // SSI0 TX FIFO requests uDMA
+  FlushActive = 0;
+  NVIC_PRI1_R = (NVIC_PRI1_R&0x00FFFFFF)|0x60000000; // SSI0 priority 3
+  NVIC_EN0_R = 1<<7;                    // enable IRQ 7 in NVIC
+
+  if(cmdList) commandList(cmdList);
+}
+
+
+//------------ST7735_InitB------------
+// Initialization for ST7735B screens.
+// Input: none
+// Output: none
+void ST7735_InitB(void) {
+  commonInit(Bcmd);
+  ST7735_SetCursor(0,0);
+  StTextColor = ST7735_WHITE;
+  ST7735_FillScreen(0);                 // set screen to black
+}
+
+
+//------------ST7735_InitR------------
+// Initialization for ST7735R screens (green or red tabs).
+// Input: option one of the enumerated options depending on tabs
+// Output: none
+void ST7735_InitR(enum initRFlags option) {
+  commonInit(Rcmd1);
+  if(option == INITR_GREENTAB) {
+    commandList(Rcmd2green);
+    ColStart = 2;
+    RowStart = 1;
+  } else {
+    // colstart, rowstart left at default '0' values
+    commandList(Rcmd2red);
+  }
+  commandList(Rcmd3);
+
+  // if black, change MADCTL color filter
+  if (option == INITR_BLACKTAB) {
+    frameSize(8);
+    writecommand(ST7735_MADCTL);
+    writedata(0xC0);
+  }
+  TabColor = option;
+  ST7735_SetCursor(0,0);
+  StTextColor = ST7735_WHITE;
+  ST7735_FillScreen(0);                 // set screen to black
+}
+
+
+void static sendAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void static flushStart(const uint8_t *buffer, uint8_t packed, const ST7735_Rect *rects, uint8_t n);
+
+// Converts as many whole rows of the current region as fit
+// into chunk b, then moves on to the next region if it is done.
+void static flushConvert(uint8_t b) {
+  const ST7735_Rect *r;
+  uint16_t *out = FlushLine[b];
+  uint16_t size = 0;
+  int16_t x, w;
+
+  FlushLineRect[b] = -1;
+  if(FlushRectI < FlushRectN){
+    r = &FlushRect[FlushRectI];
+    w = r->x1 - r->x0 + 1;
+    if(FlushRow == r->y0){
+      FlushLineRect[b] = FlushRectI;    // needs its address window first
+    }
+    do{
+      if(FlushPacked){                  // rows follow each other
+        for(x=0; x<w; x=x+1){
+          out[size] = Palette[FlushBuf[x]];
+          size = size + 1;
+        }
+        FlushBuf = FlushBuf + w;
+      } else{                           // buffer rows are stored bottom up
+        for(x=r->x0; x<=r->x1; x=x+1){
+          out[size] = Palette[FlushBuf[ST7735_TFTWIDTH*(ST7735_TFTHEIGHT - 1 - FlushRow) + x]];
+          size = size + 1;
+        }
+      }
+      FlushRow = FlushRow + 1;
+    }while((FlushRow <= r->y1) && (size + w <= ST7735_TFTWIDTH));
+    if(FlushRow > r->y1){               // region done, go to the next one
+      FlushRectI = FlushRectI + 1;
+      if(FlushRectI < FlushRectN){
+        FlushRow = FlushRect[FlushRectI].y0;
+      }
+    }
+  }
+  FlushLineSize[b] = size;
+}
+
+// Hands chunk b to uDMA, setting the address window first
+// when the chunk starts a new region.
+void static flushSend(uint8_t b) {
+  const ST7735_Rect *r;
+
+  if(FlushLineRect[b] >= 0){
+    r = &FlushRect[FlushLineRect[b]];
+    sendAddrWindow(r->x0, r->y0, r->x1, r->y1);
+  }
+                                        // one 16-bit frame per pixel
+  DMAControl[4*DMA_SSI0TX] = (uint32_t)&FlushLine[b][FlushLineSize[b] - 1];
+  DMAControl[4*DMA_SSI0TX+1] = (uint32_t)&SSI0_DR_R;
+  DMAControl[4*DMA_SSI0TX+2] = UDMA_CHCTL_DSTINC_NONE|UDMA_CHCTL_DSTSIZE_16|
+    UDMA_CHCTL_SRCINC_16|UDMA_CHCTL_SRCSIZE_16|UDMA_CHCTL_ARBSIZE_4|
+    ((uint32_t)(FlushLineSize[b] - 1)<<UDMA_CHCTL_XFERSIZE_S)|UDMA_CHCTL_XFERMODE_BASIC;
+  UDMA_ENASET_R = DMA_SSI0TX_BIT;
+}
+
+// uDMA reports a finished SSI0 TX transfer on the SSI0 vector.
+// The chunk just converted goes out and the one just sent is refilled.
+void SSI0_Handler(void){
+  uint8_t b = FlushNext;
+  UDMA_CHIS_R = DMA_SSI0TX_BIT;         // acknowledge
+  if(FlushLineSize[b] == 0){
+    FlushActive = 0;                    // everything has been sent
+    return;
+  }
+  flushSend(b);
+  FlushNext = b^1;
+  flushConvert(b^1);
+}
+
+// Set the region of the screen RAM to be modified
+// Pixel colors are sent left to right, top to bottom
+// (same as Font table is encoded; different from regular bitmap)
+// Requires 11 bytes of transmission
+// Leaves SSI0 in 16-bit frames, ready for pushColor()
+// Waits for a flush in progress, which also uses the SSI.
+void static setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  while(FlushActive){};
+  sendAddrWindow(x0, y0, x1, y1);
+}
+
+void static sendAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+
+  frameSize(8);
+  writecommand(ST7735_CASET); // Column addr set
+  writedata(0x00);
+  writedata(x0+ColStart);     // XSTART
+  writedata(0x00);
+  writedata(x1+ColStart);     // XEND
+
+  writecommand(ST7735_RASET); // Row addr set
+  writedata(0x00);
+  writedata(y0+RowStart);     // YSTART
+  writedata(0x00);
+  writedata(y1+RowStart);     // YEND
+
+  writecommand(ST7735_RAMWR); // write to RAM
+  frameSize(16);              // pixels follow
+}
+
+
+
+// Send one pixel as a 16-bit frame, most significant byte first
+// Only waits while the transmit FIFO is full, so back to back
+// calls keep the FIFO full; must follow setAddrWindow()
+// Requires 2 bytes of transmission
+void static pushColor(uint16_t color) {
+  while((SSI0_SR_R&SSI_SR_TNF)==0){};   // wait for room in the FIFO
+  SSI0_DR_R = color;
+}
+
+
+//------------ST7735_DrawPixel------------
+// Color the pixel at the given coordinates with the given color.
+// Requires 13 bytes of transmission
+// Input: x     horizontal position of the pixel, columns from the left edge
+//               must be less than 128
+//               0 is on the left, 126 is near the right
+//        y     vertical position of the pixel, rows from the top edge
+//               must be less than 160
+//               159 is near the wires, 0 is the side opposite the wires
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color) {
+
+  if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
+
+//  setAddrWindow(x,y,x+1,y+1); // original code, bug???
+  setAddrWindow(x,y,x,y);
+
+  pushColor(color);
+}
+
+
+//------------ST7735_DrawFastVLine------------
+// Draw a vertical line at the given coordinates with the given height and color.
+// A vertical line is parallel to the longer side of the rectangular display
+// Requires (11 + 2*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the start of the line, columns from the left edge
+//        y     vertical position of the start of the line, rows from the top edge
+//        h     vertical height of the line
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  // Rudimentary clipping
+  if((x >= _width) || (y >= _height)) return;
+  if((y+h-1) >= _height) h = _height-y;
+  setAddrWindow(x, y, x, y+h-1);
+
+  while (h--) {
+    pushColor(color);
+  }
+}
+
+
+//------------ST7735_DrawFastHLine------------
+// Draw a horizontal line at the given coordinates with the given width and color.
+// A horizontal line is parallel to the shorter side of the rectangular display
+// Requires (11 + 2*w) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the start of the line, columns from the left edge
+//        y     vertical position of the start of the line, rows from the top edge
+//        w     horizontal width of the line
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  // Rudimentary clipping
+  if((x >= _width) || (y >= _height)) return;
+  if((x+w-1) >= _width)  w = _width-x;
+  setAddrWindow(x, y, x+w-1, y);
+
+  while (w--) {
+    pushColor(color);
+  }
+}
+
+
+//------------ST7735_FillScreen------------
+// Fill the screen with the given color.
+// Requires 40,971 bytes of transmission
+// Input: color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_FillScreen(uint16_t color) {
+  ST7735_FillRect(0, 0, _width, _height, color);  // original
+//  screen is actually 129 by 161 pixels, x 0 to 128, y goes from 0 to 160
+}
+
+
+//------------ST7735_FillRect------------
+// Draw a filled rectangle at the given coordinates with the given width, height, and color.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the top left corner of the rectangle, columns from the left edge
+//        y     vertical position of the top left corner of the rectangle, rows from the top edge
+//        w     horizontal width of the rectangle
+//        h     vertical height of the rectangle
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  // rudimentary clipping (drawChar w/big text requires this)
+  if((x >= _width) || (y >= _height)) return;
+  if((x + w - 1) >= _width)  w = _width  - x;
+  if((y + h - 1) >= _height) h = _height - y;
+
+  setAddrWindow(x, y, x+w-1, y+h-1);
+
+  for(y=h; y>0; y--) {
+    for(x=w; x>0; x--) {
+      pushColor(color);
+    }
+  }
+}
+
+
+//------------ST7735_Color565------------
+// Pass 8-bit (each) R,G,B and get back 16-bit packed color.
+// Input: r red value
+//        g green value
+//        b blue value
+// Output: 16-bit color
+uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((b & 0xF8) << 8) | ((g & 0xFC) << 3) | (r >> 3);
+}
+
+
+//------------ST7735_SwapColor------------
+// Swaps the red and blue values of the given 16-bit packed color;
+// green is unchanged.
+// Input: x 16-bit color in format B, G, R
+// Output: 16-bit color in format R, G, B
+uint16_t ST7735_SwapColor(uint16_t x) {
+  return (x << 11) | (x & 0x07E0) | (x >> 11);
+}
+
+
+
+//------------ST7735_DrawBitmap------------
+// Displays a 16-bit color BMP image.  A bitmap file that is created
+// by a PC image processing program has a header and may be padded
+// with dummy columns so the data have four byte alignment.  This
+// function assumes that all of that has been stripped out, and the
+// array image[] has one 16-bit halfword for each pixel to be
+// displayed on the screen (encoded in reverse order, which is
+// standard for bitmap files).  An array can be created in this
+// format from a 24-bit-per-pixel .bmp file using the associated
+// converter program.
+// (x,y) is the screen location of the lower left corner of BMP image
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        image pointer to a 16-bit color BMP image
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+// Must be less than or equal to 128 pixels wide by 160 pixels high
+void ST7735_DrawBitmap16(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h){
+	int16_t skipC = 0;                      // non-zero if columns need to be skipped due to clipping
+  int16_t originalWidth = w;              // save this value; even if not all columns fit on the screen, the image is still this width in ROM
+  int i = w*(h - 1);
+
+  if((x >= _width) || ((y - h + 1) >= _height) || ((x + w) <= 0) || (y < 0)){
+    return;                             // image is totally off the screen, do nothing
+  }
+  if((w > _width) || (h > _height)){    // image is too wide for the screen, do nothing
+    //***This isn't necessarily a fatal error, but it makes the
+    //following logic much more complicated, since you can have
+    //an image that exceeds multiple boundaries and needs to be
+    //clipped on more than one side.
+    return;
+  }
+  if((x + w - 1) >= _width){            // image exceeds right of screen
+    skipC = (x + w) - _width;           // skip cut off columns
+    w = _width - x;
+  }
+  if((y - h + 1) < 0){                  // image exceeds top of screen
+    i = i - (h - y - 1)*originalWidth;  // skip the last cut off rows
+    h = y + 1;
+  }
+  if(x < 0){                            // image exceeds left of screen
+    w = w + x;
+    skipC = -1*x;                       // skip cut off columns
+    i = i - x;                          // skip the first cut off columns
+    x = 0;
+  }
+  if(y >= _height){                     // image exceeds bottom of screen
+    h = h - (y - _height + 1);
+    y = _height - 1;
+  }
+
+  setAddrWindow(x, y-h+1, x+w-1, y);
+  for(y=0; y<h; y=y+1){
+    for(x=0; x<w; x=x+1){
+      pushColor(image[i]);
+
+      i = i + 1;                        // go to the next pixel
+    }
+    i = i + skipC;
+    i = i - 2*originalWidth;
+  }
+}
+
+//------------ST7735_DrawRLE16------------
+// Displays a run length encoded 16-bit color image made by
+// res/images/RleCompile.py, decoding it straight into the SSI
+// transmit FIFO so the image is never expanded in RAM.
+// The data is a list of tokens, top row first, that run on
+// across rows:
+//   0x00-0x7F  n+1 colors follow
+//   0x80-0xFF  one color follows, sent (n&0x7F)+1 times
+// with each color two bytes, most significant first.
+// Requires (11 + 2*w*h) bytes of transmission
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        rle   pointer to the tokens
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+// The image must be completely on the screen, otherwise nothing is drawn
+void ST7735_DrawRLE16(int16_t x, int16_t y, const uint8_t *rle, int16_t w, int16_t h){
+  int32_t left = w*h;                   // pixels still to send
+  uint16_t color;
+  uint8_t n;
+
+  if((x < 0) || ((x + w) > _width) || ((y - h + 1) < 0) || (y >= _height)){
+    return;                             // clipping would need the skipped tokens decoded anyway
+  }
+  setAddrWindow(x, y-h+1, x+w-1, y);
+  while(left > 0){
+    n = *rle++;
+    if(n&0x80){                         // repeated color
+      n = (n&0x7F) + 1;
+      color = (rle[0]<<8)|rle[1];
+      rle = rle + 2;
+      left = left - n;
+      while(n){
+        pushColor(color);
+        n--;
+      }
+    } else{                             // literal colors
+      n = n + 1;
+      left = left - n;
+      while(n){
+        pushColor((rle[0]<<8)|rle[1]);
+        rle = rle + 2;
+        n--;
+      }
+    }
+  }
+}
+
+// ST_Convert
+// turn 8bit bgr into 16 bit bgr
+uint16_t ST7735_Convert(uint8_t color){
+  color = color<<1;
+  uint16_t bgrCol = 0;
+  bgrCol |= ((color&0xC0)<<8);    // B
+  bgrCol |= ((color&0xC0)<<6);
+  bgrCol |= ((color&0x80)<<4);
+  bgrCol |= ((color&0x38)<<5);    // G
+  bgrCol |= ((color&0x38)<<2);
+  bgrCol |= ((color&0x07)<<2);    // R
+  bgrCol |= ((color&0x06)>>1);
+  return bgrCol;
+}
+
+//------------ST7735_SetPalette------------
+// Selects the table used to turn 8-bit colors into 16-bit colors.
+// Takes effect on the next pixel sent, so alternate palettes cost
+// nothing per pixel.
+// Input: palette 256 16-bit colors in the order of Palette8
+//                0 selects the default palette
+// Output: none
+void ST7735_SetPalette(const uint16_t *palette){
+  if(palette){
+    BasePalette = palette;
+  } else{
+    BasePalette = Palette8;
+  }
+  paletteMix();
+}
+
+// Moves one palette layer a frame closer to its target level
+// Output: 1 if its level changed
+uint8_t static layerStep(PaletteLayer *layer){
+  if(layer->frames == 0){
+    return 0;
+  }
+  layer->level = layer->level + (layer->target - layer->level)/layer->frames;
+  layer->frames = layer->frames - 1;
+  return 1;
+}
+
+// Mixes color b into color a, level 0 gives a and ST7735_PALETTE_FULL b
+// Each 5-6-5 field is mixed on its own, in place
+uint16_t static blend(uint16_t a, uint16_t b, int32_t level){
+  int32_t r = (a&0x001F) + ((((int32_t)(b&0x001F) - (a&0x001F))*level)>>8);
+  int32_t g = (a&0x07E0) + ((((int32_t)(b&0x07E0) - (a&0x07E0))*level)>>8);
+  int32_t u = (a&0xF800) + ((((int32_t)(b&0xF800) - (a&0xF800))*level)>>8);
+  return (u&0xF800)|(g&0x07E0)|(r&0x001F);
+}
+
+// Rebuilds Palette from BasePalette with the tint and then the fade over it
+// 256 entries, however many pixels the screen has
+void static paletteMix(void){
+  uint16_t c;
+  uint16_t color;
+
+  ST7735_FlushWait();                   // a flush in progress converts with the table
+  if(Tint.level == 0 && Fade.level == 0){
+    Palette = BasePalette;
+    return;
+  }
+  for(c=0; c<256; c=c+1){
+    color = BasePalette[c];
+    if(Tint.level){
+      color = blend(color, Tint.color, Tint.level);
+    }
+    if(Fade.level){
+      color = blend(color, Fade.color, Fade.level);
+    }
+    MixedPalette[c] = color;
+  }
+  Palette = MixedPalette;
+}
+
+// Starts a palette layer toward a color and level
+void static layerStart(PaletteLayer *layer, uint16_t color, int16_t level, uint8_t frames){
+  if(layer->level == 0){
+    layer->color = color;               // nothing of the old color is showing
+  }
+  layer->target = level;
+  layer->frames = frames;
+  if(frames == 0){                      // next ST7735_PaletteStep() jumps there
+    layer->frames = 1;
+  }
+}
+
+//------------ST7735_Fade------------
+// Starts moving the whole palette toward a color, e.g. to fade to
+// black between screens or flash white on a hit.  Each call to
+// ST7735_PaletteStep() takes one step.
+// Input: color  16-bit color to move toward
+//        level  how much of it to show at the end,
+//               0 for none to ST7735_PALETTE_FULL for only it
+//        frames steps to get there, 0 to jump at the next step
+// Output: none
+void ST7735_Fade(uint16_t color, int16_t level, uint8_t frames){
+  layerStart(&Fade, color, level, frames);
+}
+
+//------------ST7735_Tint------------
+// Same as ST7735_Fade(), but for a second layer under the fade,
+// which can stay on while fades and flashes come and go over it.
+// Input: color  16-bit color to move toward
+//        level  0 for none to ST7735_PALETTE_FULL for only it
+//        frames steps to get there, 0 to jump at the next step
+// Output: none
+void ST7735_Tint(uint16_t color, int16_t level, uint8_t frames){
+  layerStart(&Tint, color, level, frames);
+}
+
+//------------ST7735_PaletteStep------------
+// Takes one step of ST7735_Fade() and ST7735_Tint(), call it once
+// a frame.  A new palette only shows in the pixels sent after it,
+// so the caller sends the whole screen again when this returns 1.
+// Costs 256 table entries per step, no matter the screen
+// Input: none
+// Output: 1 if the palette changed, 0 if it is at rest
+uint8_t ST7735_PaletteStep(void){
+  uint8_t changed = layerStep(&Tint);
+
+  changed = changed | layerStep(&Fade);
+  if(changed){
+    paletteMix();
+  }
+  return changed;
+}
+
+void ST7735_DrawBitmap8(int16_t x, int16_t y, const uint8_t *image, int16_t w, int16_t h){
+	int16_t skipC = 0;                      // non-zero if columns need to be skipped due to clipping
+  int16_t originalWidth = w;              // save this value; even if not all columns fit on the screen, the image is still this width in ROM
+  int i = w*(h - 1);
+
+  if((x >= _width) || ((y - h + 1) >= _height) || ((x + w) <= 0) || (y < 0)){
+    return;                             // image is totally off the screen, do nothing
+  }
+  if((w > _width) || (h > _height)){    // image is too wide for the screen, do nothing
+    //***This isn't necessarily a fatal error, but it makes the
+    //following logic much more complicated, since you can have
+    //an image that exceeds multiple boundaries and needs to be
+    //clipped on more than one side.
+    return;
+  }
+  if((x + w - 1) >= _width){            // image exceeds right of screen
+    skipC = (x + w) - _width;           // skip cut off columns
+    w = _width - x;
+  }
+  if((y - h + 1) < 0){                  // image exceeds top of screen
+    i = i - (h - y - 1)*originalWidth;  // skip the last cut off rows
+    h = y + 1;
+  }
+  if(x < 0){                            // image exceeds left of screen
+    w = w + x;
+    skipC = -1*x;                       // skip cut off columns
+    i = i - x;                          // skip the first cut off columns
+    x = 0;
+  }
+  if(y >= _height){                     // image exceeds bottom of screen
+    h = h - (y - _height + 1);
+    y = _height - 1;
+  }
+
+  setAddrWindow(x, y-h+1, x+w-1, y);
+  for(y=0; y<h; y=y+1){
+    for(x=0; x<w; x=x+1){
+      pushColor(Palette[image[i]]);
+
+      i = i + 1;                        // go to the next pixel
+    }
+    i = i + skipC;
+    i = i - 2*originalWidth;
+  }
+}
+
+//------------ST7735_FlushRects------------
+// Sends only the given regions of a full screen 8-bit buffer.
+// The buffer is 128 wide by 160 high and stored bottom row first,
+// the same way ST7735_DrawBitmap8(0, 159, buffer, 128, 160) expects it.
+// Requires (11 + 2*w*h) bytes of transmission for each rectangle
+// Input: buffer pointer to the 128x160 8-bit screen buffer
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions
+// Output: none
+void ST7735_FlushRects(const uint8_t *buffer, const ST7735_Rect *rects, uint8_t n){
+	const uint8_t *row;
+  int16_t x, y;
+
+  while(n){
+    setAddrWindow(rects->x0, rects->y0, rects->x1, rects->y1);
+    for(y=rects->y0; y<=rects->y1; y=y+1){
+                                        // buffer rows are stored bottom up
+      row = buffer + ST7735_TFTWIDTH*(ST7735_TFTHEIGHT - 1 - y);
+      for(x=rects->x0; x<=rects->x1; x=x+1){
+        pushColor(Palette[row[x]]);
+      }
+    }
+    rects++;                            // next region
+    n--;
+  }
+}
+
+//------------ST7735_FlushRectsAsync------------
+// Starts sending the given regions of a full screen 8-bit buffer
+// in the background and returns right away.
+// Input: buffer pointer to the 128x160 8-bit screen buffer
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions, at most ST7735_FLUSH_N
+// Output: none
+void ST7735_FlushRectsAsync(const uint8_t *buffer, const ST7735_Rect *rects, uint8_t n){
+  flushStart(buffer, 0, rects, n);
+}
+
+//------------ST7735_FlushPackedAsync------------
+// Same as ST7735_FlushRectsAsync(), but the pixels are only those of
+// the regions, packed region after region, each region top row first
+// and each row left to right.
+// Input: pixels w*h 8-bit colors for each region
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions, at most ST7735_FLUSH_N
+// Output: none
+void ST7735_FlushPackedAsync(const uint8_t *pixels, const ST7735_Rect *rects, uint8_t n){
+  flushStart(pixels, 1, rects, n);
+}
+
+// Starts either kind of flush
+void static flushStart(const uint8_t *buffer, uint8_t packed, const ST7735_Rect *rects, uint8_t n){
+  uint8_t i;
+
+  while(FlushActive){};                 // one flush at a time
+  if(n == 0) return;
+  if(n > ST7735_FLUSH_N) n = ST7735_FLUSH_N;
+  for(i=0; i<n; i=i+1){
+    FlushRect[i] = rects[i];            // caller may reuse its list now
+  }
+  FlushBuf = buffer;
+  FlushPacked = packed;
+  FlushRectN = n;
+  FlushRectI = 0;
+  FlushRow = FlushRect[0].y0;
+  flushConvert(0);
+  flushConvert(1);
+  FlushNext = 1;
+  FlushActive = 1;
+  flushSend(0);                         // SSI0_Handler() takes it from here
+}
+
+//------------ST7735_FlushBusy------------
+// Completion flag of ST7735_FlushRectsAsync() and
+// ST7735_FlushPackedAsync().
+// Input: none
+// Output: 1 while a transfer is running, 0 when it is done
+uint8_t ST7735_FlushBusy(void){
+  return FlushActive;
+}
+
+//------------ST7735_FlushWait------------
+// Waits for the transfer started by ST7735_FlushRectsAsync() or
+// ST7735_FlushPackedAsync().
+// Input: none
+// Output: none
+void ST7735_FlushWait(void){
+  while(FlushActive){};
+}
+
+//------------ST7735_Benchmark------------
+// Fills the whole screen once at each even SSI0 clock divisor from
+// 2 to 12, then goes back to ST7735_SSI_DIVISOR and prints a table
+// of divisor, bytes/s and full-frame time in us.
+// Assumes an 80 MHz bus clock
+// Input: none
+// Output: none
+#define BENCH_N       6                 // divisors 2, 4, ... 12
+#define BENCH_BUS_HZ  80000000
+#define BENCH_BYTES   (11 + 2*ST7735_TFTWIDTH*ST7735_TFTHEIGHT) // one ST7735_FillScreen()
+void ST7735_Benchmark(void){
+  uint32_t cycles[BENCH_N], start;
+  uint8_t i;
+
+  CycleCount_Init();
+  ST7735_FlushWait();
+  for(i=0; i<BENCH_N; i=i+1){
+    clockDivisor(2*i + 2);
+    start = CycleCount_Now();
+    ST7735_FillScreen((i&1) ? ST7735_BLUE : ST7735_RED);
+    while(SSI0_SR_R&SSI_SR_BSY){};      // until the last pixel is out
+    cycles[i] = CycleCount_Now() - start;
+  }
+  clockDivisor(ST7735_SSI_DIVISOR);
+  ST7735_FillScreen(ST7735_BLACK);
+  ST7735_SetCursor(0, 0);
+  ST7735_OutString("div bytes/s  frame us");
+  for(i=0; i<BENCH_N; i=i+1){
+    ST7735_SetCursor(0, i+1);
+    ST7735_OutUDec(2*i + 2);
+    ST7735_SetCursor(4, i+1);
+    ST7735_OutUDec((uint32_t)(((uint64_t)BENCH_BYTES*BENCH_BUS_HZ)/cycles[i]));
+    ST7735_SetCursor(13, i+1);
+    ST7735_OutUDec(cycles[i]/(BENCH_BUS_HZ/1000000));
+  }
+}
+
+
+
+//------------ST7735_DrawCharS------------
+// Simple character draw function.  This is the same function from
+// Adafruit_GFX.c but adapted for this processor.  However, each call
+// to ST7735_DrawPixel() calls setAddrWindow(), which needs to send
+// many extra data and commands.  If the background color is the same
+// as the text color, no background will be printed, and text can be
+// drawn right over existing images without covering them with a box.
+// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Input: x         horizontal position of the top left corner of the character, columns from the left edge
+//        y         vertical position of the top left corner of the character, rows from the top edge
+//        c         character to be printed
+//        textColor 16-bit color of the character
+//        bgColor   16-bit color of the background
+//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
+// Output: none
+void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
+  uint8_t line; // vertical column of pixels of character in font
+  int32_t i, j;
+  if((x >= _width)            || // Clip right
+     (y >= _height)           || // Clip bottom
+     ((x + 5 * size - 1) < 0) || // Clip left
+     ((y + 8 * size - 1) < 0))   // Clip top
+    return;
+
+  for (i=0; i<6; i++ ) {
+    if (i == 5)
+      line = 0x0;
+    else
+      line = Font[(c*5)+i];
+    for (j = 0; j<8; j++) {
+      if (line & 0x1) {
+        if (size == 1) // default size
+          ST7735_DrawPixel(x+i, y+j, textColor);
+        else {  // big size
+          ST7735_FillRect(x+(i*size), y+(j*size), size, size, textColor);
+        }
+      } else if (bgColor != textColor) {
+        if (size == 1) // default size
+          ST7735_DrawPixel(x+i, y+j, bgColor);
+        else {  // big size
+          ST7735_FillRect(x+i*size, y+j*size, size, size, bgColor);
+        }
+      }
+      line >>= 1;
+    }
+  }
+}
+
+
+//------------ST7735_Glyph------------
+// Columns of a character in the 5x7 font, for drawing text
+// into a buffer instead of straight to the LCD.
+// Input: c  character
+// Output: pointer to 5 bytes, one per column from the left,
+//         bit 0 of each is the top row
+const uint8_t *ST7735_Glyph(char c){
+  return &Font[(uint8_t)c*5];
+}
+
+
+//------------ST7735_DrawChar------------
+// Advanced character draw function.  This is similar to the function
+// from Adafruit_GFX.c but adapted for this processor.  However, this
+// function only uses one call to setAddrWindow(), which allows it to
+// run at least twice as fast.
+// Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
+// Input: x         horizontal position of the top left corner of the character, columns from the left edge
+//        y         vertical position of the top left corner of the character, rows from the top edge
+//        c         character to be printed
+//        textColor 16-bit color of the character
+//        bgColor   16-bit color of the background
+//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
+// Output: none
+void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
+  uint8_t line; // horizontal row of pixels of character
+  int32_t col, row, i, j;// loop indices
+  if(((x + 5*size - 1) >= _width)  || // Clip right
+     ((y + 8*size - 1) >= _height) || // Clip bottom
+     ((x + 5*size - 1) < 0)        || // Clip left
+     ((y + 8*size - 1) < 0)){         // Clip top
+    return;
+  }
+
+  setAddrWindow(x, y, x+6*size-1, y+8*size-1);
+
+  line = 0x01;        // print the top row first
+  // print the rows, starting at the top
+  for(row=0; row<8; row=row+1){
+    for(i=0; i<size; i=i+1){
+      // print the columns, starting on the left
+      for(col=0; col<5; col=col+1){
+        if(Font[(c*5)+col]&line){
+          // bit is set in Font, print pixel(s) in text color
+          for(j=0; j<size; j=j+1){
+            pushColor(textColor);
+          }
+        } else{
+          // bit is cleared in Font, print pixel(s) in background color
+          for(j=0; j<size; j=j+1){
+            pushColor(bgColor);
+          }
+        }
+      }
+      // print blank column(s) to the right of character
+      for(j=0; j<size; j=j+1){
+        pushColor(bgColor);
+      }
+    }
+    line = line<<1;   // move up to the next row
+  }
+}
+//------------ST7735_DrawString------------
+// String draw function.  
+// 16 rows (0 to 15) and 21 characters (0 to 20)
+// Requires (11 + size*size*6*8) bytes of transmission for each character
+// Input: x         columns from the left edge (0 to 20)
+//        y         rows from the top edge (0 to 15)
+//        pt        pointer to a null terminated string to be printed
+//        textColor 16-bit color of the characters
+// bgColor is Black and size is 1
+// Output: number of characters printed
+uint32_t ST7735_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor){
+  uint32_t count = 0;
+  if(y>15) return 0;
+  while(*pt){
+    ST7735_DrawCharS(x*6, y*10, *pt, textColor, ST7735_BLACK, 1);
+    pt++;
+    x = x+1;
+    if(x>20) return count;  // number of characters printed
+    count++;
+  }
+  return count;  // number of characters printed
+}
+
+//-----------------------fillmessage-----------------------
+// Output a 32-bit number in unsigned decimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+char Message[12];
+uint32_t Messageindex;
+
+void fillmessage(uint32_t n){
+// This function uses recursion to convert decimal number
+//   of unspecified length as an ASCII string
+  if(n >= 10){
+    fillmessage(n/10);
+    n = n%10;
+  }
+  Message[Messageindex] = (n+'0'); /* n is between 0 and 9 */
+  if(Messageindex<11)Messageindex++;
+}
+//********ST7735_SetCursor*****************
+// Move the cursor to the desired X- and Y-position.  The
+// next character will be printed here.  X=0 is the leftmost
+// column.  Y=0 is the top row.
+// inputs: newX  new X-position of the cursor (0<=newX<=20)
+//         newY  new Y-position of the cursor (0<=newY<=15)
+// outputs: none
+void ST7735_SetCursor(uint32_t newX, uint32_t newY){
+  if((newX > 20) || (newY > 15)){       // bad input
+    return;                             // do nothing
+  }
+  StX = newX;
+  StY = newY;
+}
+//-----------------------ST7735_OutUDec-----------------------
+// Output a 32-bit number in unsigned decimal format
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+void ST7735_OutUDec(uint32_t n){
+  Messageindex = 0;
+  fillmessage(n);
+  Message[Messageindex] = 0; // terminate
+  ST7735_DrawString(StX,StY,Message,StTextColor);
+  StX = StX+Messageindex;
+  if(StX>20){
+    StX = 20;
+    ST7735_DrawCharS(StX*6,StY*10,'*',ST7735_RED,ST7735_BLACK, 1);
+  }
+}
+
+
+
+
+
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_ML  0x10
+#define MADCTL_RGB 0x00
+#define MADCTL_BGR 0x08
+#define MADCTL_MH  0x04
+
+//------------ST7735_SetRotation------------
+// Change the image rotation.
+// Requires 2 bytes of transmission
+// Input: m new rotation value (0 to 3)
+// Output: none
+void ST7735_SetRotation(uint8_t m) {
+
+  ST7735_FlushWait();
+  frameSize(8);
+  writecommand(ST7735_MADCTL);
+  Rotation = m % 4; // can't be higher than 3
+  switch (Rotation) {
+   case 0:
+     if (TabColor == INITR_BLACKTAB) {
+       writedata(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
+     } else {
+       writedata(MADCTL_MX | MADCTL_MY | MADCTL_BGR);
+     }
+     _width  = ST7735_TFTWIDTH;
+     _height = ST7735_TFTHEIGHT;
+     break;
+   case 1:
+     if (TabColor == INITR_BLACKTAB) {
+       writedata(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
+     } else {
+       writedata(MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+     }
+     _width  = ST7735_TFTHEIGHT;
+     _height = ST7735_TFTWIDTH;
+     break;
+  case 2:
+     if (TabColor == INITR_BLACKTAB) {
+       writedata(MADCTL_RGB);
+     } else {
+       writedata(MADCTL_BGR);
+     }
+     _width  = ST7735_TFTWIDTH;
+     _height = ST7735_TFTHEIGHT;
+    break;
+   case 3:
+     if (TabColor == INITR_BLACKTAB) {
+       writedata(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
+     } else {
+       writedata(MADCTL_MX | MADCTL_MV | MADCTL_BGR);
+     }
+     _width  = ST7735_TFTHEIGHT;
+     _height = ST7735_TFTWIDTH;
+     break;
+  }
+}
+
+
+//------------ST7735_InvertDisplay------------
+// Send the command to invert all of the colors.
+// Requires 1 byte of transmission
+// Input: i 0 to disable inversion; non-zero to enable inversion
+// Output: none
+void ST7735_InvertDisplay(int i) {
+  ST7735_FlushWait();
+  frameSize(8);
+  if(i){
+    writecommand(ST7735_INVON);
+  } else{
+    writecommand(ST7735_INVOFF);
+  }
+}
+
+// Panel memory rows of screen row y, the scroll and partial commands
+// count in memory rows, which MADCTL_MY numbers bottom up.
+// The memory has RowStart spare rows on both ends.
+#define PANEL_ROWS (ST7735_TFTHEIGHT + 2*RowStart)
+uint8_t static panelRow(uint8_t y){
+  if(Rotation < 2){                     // rotations 0 and 1 set MADCTL_MY
+    return PANEL_ROWS - 1 - RowStart - y;
+  }
+  return RowStart + y;
+}
+
+//------------ST7735_SetScrollArea------------
+// Splits the screen into a fixed strip at the top, a scrolling
+// area and a fixed strip at the bottom, and shows the scrolling
+// area unmoved.  ST7735_Scroll() then moves what the panel
+// already has in the scrolling area without sending any pixels.
+// Drawing still uses screen coordinates of the unscrolled area.
+// Only rotations 0 and 2 scroll screen rows, the others scroll
+// screen columns.
+// Requires 8 bytes of transmission
+// Input: top    rows of the top strip
+//        bottom rows of the bottom strip
+// Output: none
+// top + bottom must be less than 160
+void ST7735_SetScrollArea(uint8_t top, uint8_t bottom){
+  uint8_t first, last;                  // fixed rows before and after the area in the panel
+
+  ST7735_FlushWait();
+  ScrollTop = top;
+  ScrollRows = ST7735_TFTHEIGHT - top - bottom;
+  if(Rotation < 2){
+    first = bottom + RowStart;
+    last = top + RowStart;
+  } else{
+    first = top + RowStart;
+    last = bottom + RowStart;
+  }
+  frameSize(8);
+  writecommand(ST7735_SCRLAR);
+  writedata(0x00);
+  writedata(first);                     // TFA
+  writedata(0x00);
+  writedata(ScrollRows);                // VSA
+  writedata(0x00);
+  writedata(last);                      // BFA
+  ST7735_Scroll(0);
+}
+
+//------------ST7735_Scroll------------
+// Shows the scrolling area of ST7735_SetScrollArea() moved up by
+// the given number of rows, the rows that leave the top of the
+// area come back in at its bottom.
+// Requires 3 bytes of transmission
+// Input: offset rows to move, 0 to one less than the area height
+// Output: none
+void ST7735_Scroll(uint8_t offset){
+  uint8_t start;                        // panel row shown first in the area
+
+  ST7735_FlushWait();
+  offset = offset%ScrollRows;
+  if(Rotation < 2){                     // the panel scans the area bottom up
+    start = panelRow(ScrollTop + ScrollRows - 1) + (ScrollRows - offset)%ScrollRows;
+  } else{
+    start = panelRow(ScrollTop) + offset;
+  }
+  frameSize(8);
+  writecommand(ST7735_VSCSAD);
+  writedata(0x00);
+  writedata(start);
+}
+
+//------------ST7735_SetPartialArea------------
+// Turns on partial mode, where the panel only shows rows y0 to y1
+// and leaves the rest of the screen blank.  Drawing outside the
+// rows still updates the panel memory for later.
+// Requires 6 bytes of transmission
+// Input: y0 first row shown, rows from the top edge
+//        y1 last row shown, at least y0
+// Output: none
+void ST7735_SetPartialArea(uint8_t y0, uint8_t y1){
+  uint8_t first = panelRow(y0), last = panelRow(y1), swap;
+
+  ST7735_FlushWait();
+  if(first > last){                     // MADCTL_MY numbers them bottom up
+    swap = first;
+    first = last;
+    last = swap;
+  }
+  frameSize(8);
+  writecommand(ST7735_PTLAR);
+  writedata(0x00);
+  writedata(first);                     // PSL
+  writedata(0x00);
+  writedata(last);                      // PEL
+  writecommand(ST7735_PTLON);
+}
+
+//------------ST7735_NormalMode------------
+// Leaves partial mode and scrolling, the whole screen shows the
+// panel memory as drawn again.
+// Requires 1 byte of transmission
+// Input: none
+// Output: none
+void ST7735_NormalMode(void){
+  ST7735_FlushWait();
+  frameSize(8);
+  writecommand(ST7735_NORON);
+}
+// graphics routines
+// y coordinates 0 to 31 used for labels and messages
+// y coordinates 32 to 159  128 pixels high
+// x coordinates 0 to 127   128 pixels wide
+
+int32_t Ymax,Ymin,X;        // X goes from 0 to 127
+int32_t Yrange; //YrangeDiv2;
+
+// *************** ST7735_PlotClear ********************
+// Clear the graphics buffer, set X coordinate to 0
+// This routine clears the display 
+// Inputs: ymin and ymax are range of the plot
+// Outputs: none
+void ST7735_PlotClear(int32_t ymin, int32_t ymax){
+  ST7735_FillRect(0, 32, 128, 128, ST7735_Color565(228,228,228)); // light grey
+  if(ymax>ymin){
+    Ymax = ymax;
+    Ymin = ymin;
+    Yrange = ymax-ymin;
+  } else{
+    Ymax = ymin;
+    Ymin = ymax;
+    Yrange = ymax-ymin;
+  }
+  //YrangeDiv2 = Yrange/2;
+  X = 0;
+}
+
+// *************** ST7735_PlotPoint ********************
+// Used in the voltage versus time plot, plot one point at y
+// It does output to display 
+// Inputs: y is the y coordinate of the point plotted
+// Outputs: none
+void ST7735_PlotPoint(int32_t y){int32_t j;
+  if(y<Ymin) y=Ymin;
+  if(y>Ymax) y=Ymax;
+  // X goes from 0 to 127
+  // j goes from 159 to 32
+  // y=Ymax maps to j=32
+  // y=Ymin maps to j=159
+  j = 32+(127*(Ymax-y))/Yrange;
+  if(j<32) j = 32;
+  if(j>159) j = 159;
+  ST7735_DrawPixel(X,   j,   ST7735_BLUE);
+  ST7735_DrawPixel(X+1, j,   ST7735_BLUE);
+  ST7735_DrawPixel(X,   j+1, ST7735_BLUE);
+  ST7735_DrawPixel(X+1, j+1, ST7735_BLUE);
+}
+// *************** ST7735_PlotLine ********************
+// Used in the voltage versus time plot, plot line to new point
+// It does output to display 
+// Inputs: y is the y coordinate of the point plotted
+// Outputs: none
+int32_t lastj=0;
+void ST7735_PlotLine(int32_t y){int32_t i,j;
+  if(y<Ymin) y=Ymin;
+  if(y>Ymax) y=Ymax;
+  // X goes from 0 to 127
+  // j goes from 159 to 32
+  // y=Ymax maps to j=32
+  // y=Ymin maps to j=159
+  j = 32+(127*(Ymax-y))/Yrange;
+  if(j < 32) j = 32;
+  if(j > 159) j = 159;
+  if(lastj < 32) lastj = j;
+  if(lastj > 159) lastj = j;
+  if(lastj < j){
+    for(i = lastj+1; i<=j ; i++){
+      ST7735_DrawPixel(X,   i,   ST7735_BLUE) ;
+      ST7735_DrawPixel(X+1, i,   ST7735_BLUE) ;
+    }
+  }else if(lastj > j){
+    for(i = j; i<lastj ; i++){
+      ST7735_DrawPixel(X,   i,   ST7735_BLUE) ;
+      ST7735_DrawPixel(X+1, i,   ST7735_BLUE) ;
+    }
+  }else{
+    ST7735_DrawPixel(X,   j,   ST7735_BLUE) ;
+    ST7735_DrawPixel(X+1, j,   ST7735_BLUE) ;
+  }
+  lastj = j;
+}
+
+// *************** ST7735_PlotPoints ********************
+// Used in the voltage versus time plot, plot two points at y1, y2
+// It does output to display 
+// Inputs: y1 is the y coordinate of the first point plotted
+//         y2 is the y coordinate of the second point plotted
+// Outputs: none
+void ST7735_PlotPoints(int32_t y1,int32_t y2){int32_t j;
+  if(y1<Ymin) y1=Ymin;
+  if(y1>Ymax) y1=Ymax;
+  // X goes from 0 to 127
+  // j goes from 159 to 32
+  // y=Ymax maps to j=32
+  // y=Ymin maps to j=159
+  j = 32+(127*(Ymax-y1))/Yrange;
+  if(j<32) j = 32;
+  if(j>159) j = 159;
+  ST7735_DrawPixel(X, j, ST7735_BLUE);
+  if(y2<Ymin) y2=Ymin;
+  if(y2>Ymax) y2=Ymax;
+  j = 32+(127*(Ymax-y2))/Yrange;
+  if(j<32) j = 32;
+  if(j>159) j = 159;
+  ST7735_DrawPixel(X, j, ST7735_BLACK);
+}
+// *************** ST7735_PlotBar ********************
+// Used in the voltage versus time bar, plot one bar at y
+// It does not output to display until RIT128x96x4ShowPlot called
+// Inputs: y is the y coordinate of the bar plotted
+// Outputs: none
+void ST7735_PlotBar(int32_t y){
+int32_t j;
+  if(y<Ymin) y=Ymin;
+  if(y>Ymax) y=Ymax;
+  // X goes from 0 to 127
+  // j goes from 159 to 32
+  // y=Ymax maps to j=32
+  // y=Ymin maps to j=159
+  j = 32+(127*(Ymax-y))/Yrange;
+  ST7735_DrawFastVLine(X, j, 159-j, ST7735_BLACK);
+
+}
+
+// full scaled defined as 3V
+// Input is 0 to 511, 0 => 159 and 511 => 32
+uint8_t const dBfs[512]={
+159, 159, 145, 137, 131, 126, 123, 119, 117, 114, 112, 110, 108, 107, 105, 104, 103, 101, 
+  100, 99, 98, 97, 96, 95, 94, 93, 93, 92, 91, 90, 90, 89, 88, 88, 87, 87, 86, 85, 85, 84, 
+  84, 83, 83, 82, 82, 81, 81, 81, 80, 80, 79, 79, 79, 78, 78, 77, 77, 77, 76, 76, 76, 75, 
+  75, 75, 74, 74, 74, 73, 73, 73, 72, 72, 72, 72, 71, 71, 71, 71, 70, 70, 70, 70, 69, 69, 
+  69, 69, 68, 68, 68, 68, 67, 67, 67, 67, 66, 66, 66, 66, 66, 65, 65, 65, 65, 65, 64, 64, 
+  64, 64, 64, 63, 63, 63, 63, 63, 63, 62, 62, 62, 62, 62, 62, 61, 61, 61, 61, 61, 61, 60, 
+  60, 60, 60, 60, 60, 59, 59, 59, 59, 59, 59, 59, 58, 58, 58, 58, 58, 58, 58, 57, 57, 57, 
+  57, 57, 57, 57, 56, 56, 56, 56, 56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 55, 55, 54, 54, 
+  54, 54, 54, 54, 54, 54, 53, 53, 53, 53, 53, 53, 53, 53, 53, 52, 52, 52, 52, 52, 52, 52, 
+  52, 52, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 50, 50, 50, 50, 50, 50, 
+  50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 
+  48, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+  46, 46, 46, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 44, 44, 44, 44, 44, 
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 
+  43, 43, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 
+  41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+  40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 
+  39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 
+  35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 34, 
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32, 32, 
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32
+};
+
+// *************** ST7735_PlotdBfs ********************
+// Used in the amplitude versus frequency plot, plot bar point at y
+// 0 to 0.625V scaled on a log plot from min to max
+// It does output to display 
+// Inputs: y is the y ADC value of the bar plotted
+// Outputs: none
+void ST7735_PlotdBfs(int32_t y){
+int32_t j;
+  y = y/2; // 0 to 2047
+  if(y<0) y=0;
+  if(y>511) y=511;
+  // X goes from 0 to 127
+  // j goes from 159 to 32
+  // y=511 maps to j=32
+  // y=0 maps to j=159
+  j = dBfs[y];
+  ST7735_DrawFastVLine(X, j, 159-j, ST7735_BLACK);
+
+}
+
+// *************** ST7735_PlotNext ********************
+// Used in all the plots to step the X coordinate one pixel
+// X steps from 0 to 127, then back to 0 again
+// It does not output to display 
+// Inputs: none
+// Outputs: none
+void ST7735_PlotNext(void){
+  if(X==127){
+    X = 0;
+  } else{
+    X++;
+  }
+}
+
+// *************** ST7735_PlotNextErase ********************
+// Used in all the plots to step the X coordinate one pixel
+// X steps from 0 to 127, then back to 0 again
+// It clears the vertical space into which the next pixel will be drawn 
+// Inputs: none
+// Outputs: none
+void ST7735_PlotNextErase(void){
+  if(X==127){
+    X = 0;
+  } else{
+    X++;
+  }
+  ST7735_DrawFastVLine(X,32,128,ST7735_Color565(228,228,228));
+}
+
+// Used in all the plots to write buffer to LCD
+// Example 1 Voltage versus time
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    ST7735_PlotPoint(data); ST7735_PlotNext(); // called 128 times
+
+// Example 2a Voltage versus time (N data points/pixel, time scale)
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    {   for(j=0;j<N;j++){
+//          ST7735_PlotPoint(data[i++]); // called N times
+//        }
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 2b Voltage versus time (N data points/pixel, time scale)
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    {   for(j=0;j<N;j++){
+//          ST7735_PlotLine(data[i++]); // called N times
+//        }
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 3 Voltage versus frequency (512 points)
+//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
+//    ST7735_PlotClear(0,1023);  // clip large magnitudes
+//    {
+//        ST7735_PlotBar(mag[i++]); // called 4 times
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 4 Voltage versus frequency (512 points), dB scale
+//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
+//    ST7735_PlotClear(0,511);  // parameters ignored
+//    {
+//        ST7735_PlotdBfs(mag[i++]); // called 4 times
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// *************** ST7735_OutChar ********************
+// Output one character to the LCD
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// Inputs: 8-bit ASCII character
+// Outputs: none
+void ST7735_OutChar(char ch){
+  if((ch == 10) || (ch == 13) || (ch == 27)){
+    StY++; StX=0;
+    if(StY>15){
+      StY = 0;
+    }
+    ST7735_DrawString(0,StY,"                     ",StTextColor);
+    return;
+  }
+  ST7735_DrawCharS(StX*6,StY*10,ch,ST7735_WHITE,ST7735_BLACK, 1);
+  StX++;
+  if(StX>20){
+    StX = 20;
+    ST7735_DrawCharS(StX*6,StY*10,'*',ST7735_RED,ST7735_BLACK, 1);
+  }
+  return;
+}
+//********ST7735_OutString*****************
+// Print a string of characters to the ST7735 LCD.
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// The string will not automatically wrap.
+// inputs: ptr  pointer to NULL-terminated ASCII string
+// outputs: none
+void ST7735_OutString(char *ptr){
+  while(*ptr){
+    ST7735_OutChar(*ptr);
+    ptr = ptr + 1;
+  }
+}
+// ************** ST7735_SetTextColor ************************
+// Sets the color in which the characters will be printed 
+// Background color is fixed at black
+// Input:  16-bit packed color
+// Output: none
+// ********************************************************
+void ST7735_SetTextColor(uint16_t color){
+  StTextColor = color;
+}
+// Print a character to ST7735 LCD.
+int fputc(int ch, FILE *f){
+  ST7735_OutChar(ch);
+  return 1;
+}
+// No input from Nokia, always return data.
+int fgetc (FILE *f){
+  return 0;
+}
+// Function called when file error occurs.
+int ferror(FILE *f){
+  /* Your implementation of ferror */
+  return EOF;
+}
+// Abstraction of general output device
+// Volume 2 section 3.4.5
+
+// *************** Output_Init ********************
+// Standard device driver initialization function for printf
+// Initialize ST7735 LCD
+// Inputs: none
+// Outputs: none
+void Output_Init(void){
+  ST7735_InitR(INITR_REDTAB);
+  ST7735_FillScreen(0);                 // set screen to black
+}
+
+// Clear display
+void Output_Clear(void){ // Clears the display
+  ST7735_FillScreen(0);    // set screen to black
+}
+// Turn off display (low power)
+void Output_Off(void){   // Turns off the display
+  Output_Clear();  // not implemented
+}
+// Turn on display
+void Output_On(void){ // Turns on the display
+  Output_Init();      // reinitialize
+}
+// set the color for future output
+// Background color is fixed at black
+// Input:  16-bit packed color
+// Output: none
+void Output_Color(uint32_t newColor){ // Set color of future output 
+  ST7735_SetTextColor(newColor);
+}
@@ -1,429 +1,614 @@
-/***************************************************
-  This is a library for the Adafruit 1.8" SPI display.
-  This library works with the Adafruit 1.8" TFT Breakout w/SD card
-  ----> http://www.adafruit.com/products/358
-  as well as Adafruit raw 1.8" TFT display
-  ----> http://www.adafruit.com/products/618
-
-  Check out the links above for our tutorials and wiring diagrams
-  These displays use SPI to communicate, 4 or 5 pins are required to
-  interface (RST is optional)
-  Adafruit invests time and resources providing this open source code,
-  please support Adafruit and open-source hardware by purchasing
-  products from Adafruit!
-
-  Written by Limor Fried/Ladyada for Adafruit Industries.
-  MIT license, all text above must be included in any redistribution
- ****************************************************/
-
-// ST7735.h
-// Runs on LM4F120/TM4C123
-// Low level drivers for the ST7735 160x128 LCD based off of
-// the file described above.
-//    16-bit color, 128 wide by 160 high LCD
-// Daniel Valvano, September 12, 2013
-// Augmented 7/17/2014 to have a simple graphics facility
-// Tested with LaunchPadDLL.dll simulator 9/2/2014
-
-/* This example accompanies the book
-   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
-   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2014
-
- Copyright 2014 by Jonathan W. Valvano, valvano@mail.utexas.edu
-    You may use, edit, run or distribute this file
-    as long as the above copyright notice remains
- THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
- OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
- MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
- VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
- OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
- For more information about my classes, my research, and my books, see
- http://users.ece.utexas.edu/~valvano/
- */
-
-// Backlight (pin 10) connected to +3.3 V
-// MISO (pin 9) unconnected
-// SCK (pin 8) connected to PA2 (SSI0Clk)
-// MOSI (pin 7) connected to PA5 (SSI0Tx)
-// TFT_CS (pin 6) connected to PA3 (SSI0Fss)
-// CARD_CS (pin 5) unconnected
-// Data/Command (pin 4) connected to PA6 (GPIO), high for data, low for command
-// RESET (pin 3) connected to PA7 (GPIO)
-// VCC (pin 2) connected to +3.3 V
-// Gnd (pin 1) connected to ground
-
-#ifndef _ST7735H_
-#define _ST7735H_
-
-// some flags for ST7735_InitR()
-enum initRFlags{
-  none,
-  INITR_GREENTAB,
-  INITR_REDTAB,
-  INITR_BLACKTAB
-};
-
-#define ST7735_TFTWIDTH  128
-#define ST7735_TFTHEIGHT 160
-
-
-// Color definitions
-#define ST7735_BLACK   0x0000
-#define ST7735_BLUE    0xF800
-#define ST7735_RED     0x001F
-#define ST7735_GREEN   0x07E0
-#define ST7735_CYAN    0xFFE0
-#define ST7735_MAGENTA 0xF81F
-#define ST7735_YELLOW  0x07FF
-#define ST7735_WHITE   0xFFFF
-
-//------------ST7735_InitB------------
-// Initialization for ST7735B screens.
-// Input: none
-// Output: none
-void ST7735_InitB(void);
-
-
-//------------ST7735_InitR------------
-// Initialization for ST7735R screens (green or red tabs).
-// Input: option one of the enumerated options depending on tabs
-// Output: none
-void ST7735_InitR(enum initRFlags option);
-
-//------------ST7735_DrawPixel------------
-// Color the pixel at the given coordinates with the given color.
-// Requires 13 bytes of transmission
-// Input: x     horizontal position of the pixel, columns from the left edge
-//               must be less than 128
-//               0 is on the left, 126 is near the right
-//        y     vertical position of the pixel, rows from the top edge
-//               must be less than 160
-//               159 is near the wires, 0 is the side opposite the wires
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color);
-
-//------------ST7735_DrawFastVLine------------
-// Draw a vertical line at the given coordinates with the given height and color.
-// A vertical line is parallel to the longer side of the rectangular display
-// Requires (11 + 2*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the start of the line, columns from the left edge
-//        y     vertical position of the start of the line, rows from the top edge
-//        h     vertical height of the line
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
-
-
-//------------ST7735_DrawFastHLine------------
-// Draw a horizontal line at the given coordinates with the given width and color.
-// A horizontal line is parallel to the shorter side of the rectangular display
-// Requires (11 + 2*w) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the start of the line, columns from the left edge
-//        y     vertical position of the start of the line, rows from the top edge
-//        w     horizontal width of the line
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
-
-
-//------------ST7735_FillScreen------------
-// Fill the screen with the given color.
-// Requires 40,971 bytes of transmission
-// Input: color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_FillScreen(uint16_t color);
-
-
-//------------ST7735_FillRect------------
-// Draw a filled rectangle at the given coordinates with the given width, height, and color.
-// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the top left corner of the rectangle, columns from the left edge
-//        y     vertical position of the top left corner of the rectangle, rows from the top edge
-//        w     horizontal width of the rectangle
-//        h     vertical height of the rectangle
-//        color 16-bit color, which can be produced by ST7735_Color565()
-// Output: none
-void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
-
-
-//------------ST7735_Color565------------
-// Pass 8-bit (each) R,G,B and get back 16-bit packed color.
-// Input: r red value
-//        g green value
-//        b blue value
-// Output: 16-bit color
-uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b);
-
-//------------ST7735_SwapColor------------
-// Swaps the red and blue values of the given 16-bit packed color;
-// green is unchanged.
-// Input: x 16-bit color in format B, G, R
-// Output: 16-bit color in format R, G, B
-uint16_t ST7735_SwapColor(uint16_t x) ;
-
-
-//------------ST7735_DrawBitmap------------
-// Displays a 16-bit color BMP image.  A bitmap file that is created
-// by a PC image processing program has a header and may be padded
-// with dummy columns so the data have four byte alignment.  This
-// function assumes that all of that has been stripped out, and the
-// array image[] has one 16-bit halfword for each pixel to be
-// displayed on the screen (encoded in reverse order, which is
-// standard for bitmap files).  An array can be created in this
-// format from a 24-bit-per-pixel .bmp file using the associated
-// converter program.
-// (x,y) is the screen location of the lower left corner of BMP image
-// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
-// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
-//        y     vertical position of the bottom left corner of the image, rows from the top edge
-//        image pointer to a 16-bit color BMP image
-//        w     number of pixels wide
-//        h     number of pixels tall
-// Output: none
-// Must be less than or equal to 128 pixels wide by 160 pixels high
-void ST7735_DrawBitmap16(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
-
-uint16_t ST7735_Convert(uint8_t color);
-
-void ST7735_DrawBitmap8(int16_t x, int16_t y, const uint8_t *image, int16_t w, int16_t h);
-
-
-//------------ST7735_DrawCharS------------
-// Simple character draw function.  This is the same function from
-// Adafruit_GFX.c but adapted for this processor.  However, each call
-// to ST7735_DrawPixel() calls setAddrWindow(), which needs to send
-// many extra data and commands.  If the background color is the same
-// as the text color, no background will be printed, and text can be
-// drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
-// Input: x         horizontal position of the top left corner of the character, columns from the left edge
-//        y         vertical position of the top left corner of the character, rows from the top edge
-//        c         character to be printed
-//        textColor 16-bit color of the character
-//        bgColor   16-bit color of the background
-//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
-// Output: none
-void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size);
-
-//------------ST7735_DrawChar------------
-// Advanced character draw function.  This is similar to the function
-// from Adafruit_GFX.c but adapted for this processor.  However, this
-// function only uses one call to setAddrWindow(), which allows it to
-// run at least twice as fast.
-// Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
-// Input: x         horizontal position of the top left corner of the character, columns from the left edge
-//        y         vertical position of the top left corner of the character, rows from the top edge
-//        c         character to be printed
-//        textColor 16-bit color of the character
-//        bgColor   16-bit color of the background
-//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
-// Output: none
-void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size);
-
-//------------ST7735_DrawString------------
-// String draw function.  
-// 16 rows (0 to 15) and 21 characters (0 to 20)
-// Requires (11 + size*size*6*8) bytes of transmission for each character
-// Input: x         columns from the left edge (0 to 20)
-//        y         rows from the top edge (0 to 15)
-//        pt        pointer to a null terminated string to be printed
-//        textColor 16-bit color of the characters
-// bgColor is Black and size is 1
-// Output: number of characters printed
-uint32_t ST7735_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor);;
-
-
-
-//********ST7735_SetCursor*****************
-// Move the cursor to the desired X- and Y-position.  The
-// next character will be printed here.  X=0 is the leftmost
-// column.  Y=0 is the top row.
-// inputs: newX  new X-position of the cursor (0<=newX<=20)
-//         newY  new Y-position of the cursor (0<=newY<=15)
-// outputs: none
-void ST7735_SetCursor(uint32_t newX, uint32_t newY);
-
-//-----------------------ST7735_OutUDec-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void ST7735_OutUDec(uint32_t n);
-
-
-//------------ST7735_SetRotation------------
-// Change the image rotation.
-// Requires 2 bytes of transmission
-// Input: m new rotation value (0 to 3)
-// Output: none
-void ST7735_SetRotation(uint8_t m) ;
-
-
-//------------ST7735_InvertDisplay------------
-// Send the command to invert all of the colors.
-// Requires 1 byte of transmission
-// Input: i 0 to disable inversion; non-zero to enable inversion
-// Output: none
-void ST7735_InvertDisplay(int i) ;
-
-// graphics routines
-// y coordinates 0 to 31 used for labels and messages
-// y coordinates 32 to 159  128 pixels high
-// x coordinates 0 to 127   128 pixels wide
-
-// *************** ST7735_PlotClear ********************
-// Clear the graphics buffer, set X coordinate to 0
-// This routine clears the display 
-// Inputs: ymin and ymax are range of the plot
-// Outputs: none
-void ST7735_PlotClear(int32_t ymin, int32_t ymax);
-
-// *************** ST7735_PlotPoint ********************
-// Used in the voltage versus time plot, plot one point at y
-// It does output to display 
-// Inputs: y is the y coordinate of the point plotted
-// Outputs: none
-void ST7735_PlotPoint(int32_t y);
-
-// *************** ST7735_PlotLine ********************
-// Used in the voltage versus time plot, plot line to new point
-// It does output to display 
-// Inputs: y is the y coordinate of the point plotted
-// Outputs: none
-void ST7735_PlotLine(int32_t y);
-
-// *************** ST7735_PlotPoints ********************
-// Used in the voltage versus time plot, plot two points at y1, y2
-// It does output to display 
-// Inputs: y1 is the y coordinate of the first point plotted
-//         y2 is the y coordinate of the second point plotted
-// Outputs: none
-void ST7735_PlotPoints(int32_t y1,int32_t y2);
-
-// *************** ST7735_PlotBar ********************
-// Used in the voltage versus time bar, plot one bar at y
-// It does not output to display until RIT128x96x4ShowPlot called
-// Inputs: y is the y coordinate of the bar plotted
-// Outputs: none
-void ST7735_PlotBar(int32_t y);
-
-// *************** ST7735_PlotdBfs ********************
-// Used in the amplitude versus frequency plot, plot bar point at y
-// 0 to 0.625V scaled on a log plot from min to max
-// It does output to display 
-// Inputs: y is the y ADC value of the bar plotted
-// Outputs: none
-void ST7735_PlotdBfs(int32_t y);
-
-// *************** ST7735_PlotNext ********************
-// Used in all the plots to step the X coordinate one pixel
-// X steps from 0 to 127, then back to 0 again
-// It does not output to display 
-// Inputs: none
-// Outputs: none
-void ST7735_PlotNext(void);
-
-// *************** ST7735_PlotNextErase ********************
-// Used in all the plots to step the X coordinate one pixel
-// X steps from 0 to 127, then back to 0 again
-// It clears the vertical space into which the next pixel will be drawn 
-// Inputs: none
-// Outputs: none
-void ST7735_PlotNextErase(void);
-
-// Used in all the plots to write buffer to LCD
-// Example 1 Voltage versus time
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    ST7735_PlotPoint(data); ST7735_PlotNext(); // called 128 times
-
-// Example 2a Voltage versus time (N data points/pixel, time scale)
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    {   for(j=0;j<N;j++){
-//          ST7735_PlotPoint(data[i++]); // called N times
-//        }
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 2b Voltage versus time (N data points/pixel, time scale)
-//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
-//    {   for(j=0;j<N;j++){
-//          ST7735_PlotLine(data[i++]); // called N times
-//        }
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 3 Voltage versus frequency (512 points)
-//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
-//    ST7735_PlotClear(0,1023);  // clip large magnitudes
-//    {
-//        ST7735_PlotBar(mag[i++]); // called 4 times
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotBar(mag[i++]); 
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// Example 4 Voltage versus frequency (512 points), dB scale
-//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
-//    ST7735_PlotClear(0,511);  // parameters ignored
-//    {
-//        ST7735_PlotdBfs(mag[i++]); // called 4 times
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotdBfs(mag[i++]); 
-//        ST7735_PlotNext(); 
-//    }   // called 128 times
-
-// *************** ST7735_OutChar ********************
-// Output one character to the LCD
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// Inputs: 8-bit ASCII character
-// Outputs: none
-void ST7735_OutChar(char ch);
-
-//********ST7735_OutString*****************
-// Print a string of characters to the ST7735 LCD.
-// Position determined by ST7735_SetCursor command
-// Color set by ST7735_SetTextColor
-// The string will not automatically wrap.
-// inputs: ptr  pointer to NULL-terminated ASCII string
-// outputs: none
-void ST7735_OutString(char *ptr);
-
-// ************** ST7735_SetTextColor ************************
-// Sets the color in which the characters will be printed 
-// Background color is fixed at black
-// Input:  16-bit packed color
-// Output: none
-// ********************************************************
-void ST7735_SetTextColor(uint16_t color);
-
-// *************** Output_Init ********************
-// Standard device driver initialization function for printf
-// Initialize ST7735 LCD
-// Inputs: none
-// Outputs: none
-void Output_Init(void);
-
-// Clear display
-void Output_Clear(void);
-
-// Turn off display (low power)
-void Output_Off(void);
-
-// Turn on display
-void Output_On(void);
-
-// set the color for future output
-// Background color is fixed at black
-// Input:  16-bit packed color
-// Output: none
-void Output_Color(uint32_t newColor); 
-
-void LCD_OutDec(uint32_t data);  // output to LCD
-
-#endif
+/***************************************************
+  This is a library for the Adafruit 1.8" SPI display.
+  This library works with the Adafruit 1.8" TFT Breakout w/SD card
+  ----> http://www.adafruit.com/products/358
+  as well as Adafruit raw 1.8" TFT display
+  ----> http://www.adafruit.com/products/618
+
+  Check out the links above for our tutorials and wiring diagrams
+  These displays use SPI to communicate, 4 or 5 pins are required to
+  interface (RST is optional)
+  Adafruit invests time and resources providing this open source code,
+  please support Adafruit and open-source hardware by purchasing
+  products from Adafruit!
+
+  Written by Limor Fried/Ladyada for Adafruit Industries.
+  MIT license, all text above must be included in any redistribution
+ ****************************************************/
+
+// ST7735.h
+// Runs on LM4F120/TM4C123
+// Low level drivers for the ST7735 160x128 LCD based off of
+// the file described above.
+//    16-bit color, 128 wide by 160 high LCD
+// Daniel Valvano, September 12, 2013
+// Augmented 7/17/2014 to have a simple graphics facility
+// Tested with LaunchPadDLL.dll simulator 9/2/2014
+
+/* This example accompanies the book
+   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
+   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2014
+
+ Copyright 2014 by Jonathan W. Valvano, valvano@mail.utexas.edu
+    You may use, edit, run or distribute this file
+    as long as the above copyright notice remains
+ THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+ */
+
+// Backlight (pin 10) connected to +3.3 V
+// MISO (pin 9) unconnected
+// SCK (pin 8) connected to PA2 (SSI0Clk)
+// MOSI (pin 7) connected to PA5 (SSI0Tx)
+// TFT_CS (pin 6) connected to PA3 (SSI0Fss)
+// CARD_CS (pin 5) unconnected
+// Data/Command (pin 4) connected to PA6 (GPIO), high for data, low for command
+// RESET (pin 3) connected to PA7 (GPIO)
+// VCC (pin 2) connected to +3.3 V
+// Gnd (pin 1) connected to ground
+
+#ifndef _ST7735H_
+#define _ST7735H_
+
+// some flags for ST7735_InitR()
+enum initRFlags{
+  none,
+  INITR_GREENTAB,
+  INITR_REDTAB,
+  INITR_BLACKTAB
+};
+
+#define ST7735_TFTWIDTH  128
+#define ST7735_TFTHEIGHT 160
+
+// SSI0Clk is 80 MHz/ST7735_SSI_DIVISOR, which must be even
+// 6 gives 13.3 MHz, the fastest even divisor within the 66 ns
+// serial write cycle (15 MHz) of the ST7735 data sheet
+// ST7735_Benchmark() measures the transport at every divisor
+#define ST7735_SSI_DIVISOR 6
+
+
+// Color definitions
+#define ST7735_BLACK   0x0000
+#define ST7735_BLUE    0xF800
+#define ST7735_RED     0x001F
+#define ST7735_GREEN   0x07E0
+#define ST7735_CYAN    0xFFE0
+#define ST7735_MAGENTA 0xF81F
+#define ST7735_YELLOW  0x07FF
+#define ST7735_WHITE   0xFFFF
+
+//------------ST7735_InitB------------
+// Initialization for ST7735B screens.
+// Input: none
+// Output: none
+void ST7735_InitB(void);
+
+
+//------------ST7735_InitR------------
+// Initialization for ST7735R screens (green or red tabs).
+// Input: option one of the enumerated options depending on tabs
+// Output: none
+void ST7735_InitR(enum initRFlags option);
+
+//------------ST7735_DrawPixel------------
+// Color the pixel at the given coordinates with the given color.
+// Requires 13 bytes of transmission
+// Input: x     horizontal position of the pixel, columns from the left edge
+//               must be less than 128
+//               0 is on the left, 126 is near the right
+//        y     vertical position of the pixel, rows from the top edge
+//               must be less than 160
+//               159 is near the wires, 0 is the side opposite the wires
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color);
+
+//------------ST7735_DrawFastVLine------------
+// Draw a vertical line at the given coordinates with the given height and color.
+// A vertical line is parallel to the longer side of the rectangular display
+// Requires (11 + 2*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the start of the line, columns from the left edge
+//        y     vertical position of the start of the line, rows from the top edge
+//        h     vertical height of the line
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+
+
+//------------ST7735_DrawFastHLine------------
+// Draw a horizontal line at the given coordinates with the given width and color.
+// A horizontal line is parallel to the shorter side of the rectangular display
+// Requires (11 + 2*w) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the start of the line, columns from the left edge
+//        y     vertical position of the start of the line, rows from the top edge
+//        w     horizontal width of the line
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_DrawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+
+//------------ST7735_FillScreen------------
+// Fill the screen with the given color.
+// Requires 40,971 bytes of transmission
+// Input: color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_FillScreen(uint16_t color);
+
+
+//------------ST7735_FillRect------------
+// Draw a filled rectangle at the given coordinates with the given width, height, and color.
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the top left corner of the rectangle, columns from the left edge
+//        y     vertical position of the top left corner of the rectangle, rows from the top edge
+//        w     horizontal width of the rectangle
+//        h     vertical height of the rectangle
+//        color 16-bit color, which can be produced by ST7735_Color565()
+// Output: none
+void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+
+//------------ST7735_Color565------------
+// Pass 8-bit (each) R,G,B and get back 16-bit packed color.
+// Input: r red value
+//        g green value
+//        b blue value
+// Output: 16-bit color
+uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b);
+
+//------------ST7735_SwapColor------------
+// Swaps the red and blue values of the given 16-bit packed color;
+// green is unchanged.
+// Input: x 16-bit color in format B, G, R
+// Output: 16-bit color in format R, G, B
+uint16_t ST7735_SwapColor(uint16_t x) ;
+
+
+//------------ST7735_DrawBitmap------------
+// Displays a 16-bit color BMP image.  A bitmap file that is created
+// by a PC image processing program has a header and may be padded
+// with dummy columns so the data have four byte alignment.  This
+// function assumes that all of that has been stripped out, and the
+// array image[] has one 16-bit halfword for each pixel to be
+// displayed on the screen (encoded in reverse order, which is
+// standard for bitmap files).  An array can be created in this
+// format from a 24-bit-per-pixel .bmp file using the associated
+// converter program.
+// (x,y) is the screen location of the lower left corner of BMP image
+// Requires (11 + 2*w*h) bytes of transmission (assuming image fully on screen)
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        image pointer to a 16-bit color BMP image
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+// Must be less than or equal to 128 pixels wide by 160 pixels high
+void ST7735_DrawBitmap16(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
+
+//------------ST7735_DrawRLE16------------
+// Displays a run length encoded 16-bit color image made by
+// res/images/RleCompile.py, decoding it straight into the SSI
+// transmit FIFO so the image is never expanded in RAM.
+// Requires (11 + 2*w*h) bytes of transmission
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        rle   pointer to the tokens from res/images/RleCompile.py
+//        w     number of pixels wide
+//        h     number of pixels tall
+// Output: none
+// The image must be completely on the screen, otherwise nothing is drawn
+void ST7735_DrawRLE16(int16_t x, int16_t y, const uint8_t *rle, int16_t w, int16_t h);
+
+//------------ST7735_Convert------------
+// Turns an 8-bit color (3 bits red, 3 green, 2 blue) into 16-bit BGR.
+// The 8-bit drawing functions look the result up in the palette
+// instead, this is only needed to build alternate palettes.
+// Input: color 8-bit color as used by screenBuffer and Images.h
+// Output: 16-bit color
+uint16_t ST7735_Convert(uint8_t color);
+
+//------------ST7735_SetPalette------------
+// Selects the table ST7735_DrawBitmap8() and the flush functions use
+// to turn 8-bit colors into 16-bit colors, so swapping palettes costs
+// nothing per pixel.
+// Input: palette 256 colors, entry c is the 16-bit color for c
+//                0 selects the default palette of ST7735_Convert()
+// Output: none
+void ST7735_SetPalette(const uint16_t *palette);
+
+#define ST7735_PALETTE_FULL 256         // level of ST7735_Fade() and ST7735_Tint() that shows only their color
+
+//------------ST7735_Fade------------
+// Starts moving the whole palette toward a color, e.g. to fade to
+// black between screens or flash white on a hit.  Each call to
+// ST7735_PaletteStep() takes one step.
+// Input: color  16-bit color to move toward
+//        level  how much of it to show at the end,
+//               0 for none to ST7735_PALETTE_FULL for only it
+//        frames steps to get there, 0 to jump at the next step
+// Output: none
+void ST7735_Fade(uint16_t color, int16_t level, uint8_t frames);
+
+//------------ST7735_Tint------------
+// Same as ST7735_Fade(), but for a second layer under the fade,
+// which can stay on while fades and flashes come and go over it.
+// Input: color  16-bit color to move toward
+//        level  0 for none to ST7735_PALETTE_FULL for only it
+//        frames steps to get there, 0 to jump at the next step
+// Output: none
+void ST7735_Tint(uint16_t color, int16_t level, uint8_t frames);
+
+//------------ST7735_PaletteStep------------
+// Takes one step of ST7735_Fade() and ST7735_Tint(), call it once
+// a frame.  A new palette only shows in the pixels sent after it,
+// so the caller sends the whole screen again when this returns 1.
+// Costs 256 table entries per step, no matter the screen
+// Input: none
+// Output: 1 if the palette changed, 0 if it is at rest
+uint8_t ST7735_PaletteStep(void);
+
+void ST7735_DrawBitmap8(int16_t x, int16_t y, const uint8_t *image, int16_t w, int16_t h);
+
+// Region of the screen, corners are inclusive
+// x0,x1 columns from the left edge, y0,y1 rows from the top edge
+typedef struct ST7735_Rect {
+  uint8_t x0, y0, x1, y1;
+} ST7735_Rect;
+
+//------------ST7735_FlushRects------------
+// Sends only the given regions of a full screen 8-bit buffer.
+// The buffer is 128 wide by 160 high and stored bottom row first,
+// the same way ST7735_DrawBitmap8(0, 159, buffer, 128, 160) expects it.
+// Requires (11 + 2*w*h) bytes of transmission for each rectangle
+// Input: buffer pointer to the 128x160 8-bit screen buffer
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions
+// Output: none
+void ST7735_FlushRects(const uint8_t *buffer, const ST7735_Rect *rects, uint8_t n);
+
+// most regions one asynchronous flush can carry
+#define ST7735_FLUSH_N 24
+
+//------------ST7735_FlushRectsAsync------------
+// Starts sending the given regions of a full screen 8-bit buffer
+// in the background and returns right away.  Rows are converted to
+// 16-bit color in small chunks by the SSI0 interrupt and each chunk
+// is moved to the SSI0 transmit FIFO by uDMA channel 11.
+// The regions are copied, but the buffer is read while the transfer
+// runs, so pixels changed before it ends may go out with their new
+// value.  Any other ST7735 call waits for the transfer to finish.
+// Input: buffer pointer to the 128x160 8-bit screen buffer
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions, at most ST7735_FLUSH_N
+// Output: none
+void ST7735_FlushRectsAsync(const uint8_t *buffer, const ST7735_Rect *rects, uint8_t n);
+
+//------------ST7735_FlushPackedAsync------------
+// Same as ST7735_FlushRectsAsync(), but the pixels are only those of
+// the regions, packed region after region, each region top row first
+// and each row left to right.  Lets the caller copy the regions out
+// of its screen buffer and keep drawing while they are sent.
+// Input: pixels w*h 8-bit colors for each region
+//        rects  regions to send, already clipped to the screen
+//        n      number of regions, at most ST7735_FLUSH_N
+// Output: none
+void ST7735_FlushPackedAsync(const uint8_t *pixels, const ST7735_Rect *rects, uint8_t n);
+
+//------------ST7735_FlushBusy------------
+// Completion flag of ST7735_FlushRectsAsync() and
+// ST7735_FlushPackedAsync().
+// Input: none
+// Output: 1 while a transfer is running, 0 when it is done
+uint8_t ST7735_FlushBusy(void);
+
+//------------ST7735_FlushWait------------
+// Waits for the transfer started by ST7735_FlushRectsAsync() or
+// ST7735_FlushPackedAsync().
+// Input: none
+// Output: none
+void ST7735_FlushWait(void);
+
+//------------ST7735_Benchmark------------
+// Fills the whole screen once at each even SSI0 clock divisor from
+// 2 to 12, then goes back to ST7735_SSI_DIVISOR and prints a table
+// of divisor, bytes/s and full-frame time in us.
+// Divisors below ST7735_SSI_DIVISOR are outside the ST7735 spec,
+// so those fills may look wrong; their timing is still valid.
+// Assumes an 80 MHz bus clock
+// Input: none
+// Output: none
+void ST7735_Benchmark(void);
+
+
+//------------ST7735_DrawCharS------------
+// Simple character draw function.  This is the same function from
+// Adafruit_GFX.c but adapted for this processor.  However, each call
+// to ST7735_DrawPixel() calls setAddrWindow(), which needs to send
+// many extra data and commands.  If the background color is the same
+// as the text color, no background will be printed, and text can be
+// drawn right over existing images without covering them with a box.
+// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Input: x         horizontal position of the top left corner of the character, columns from the left edge
+//        y         vertical position of the top left corner of the character, rows from the top edge
+//        c         character to be printed
+//        textColor 16-bit color of the character
+//        bgColor   16-bit color of the background
+//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
+// Output: none
+void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size);
+
+//------------ST7735_Glyph------------
+// Columns of a character in the 5x7 font, for drawing text
+// into a buffer instead of straight to the LCD.
+// Input: c  character
+// Output: pointer to 5 bytes, one per column from the left,
+//         bit 0 of each is the top row
+const uint8_t *ST7735_Glyph(char c);
+
+//------------ST7735_DrawChar------------
+// Advanced character draw function.  This is similar to the function
+// from Adafruit_GFX.c but adapted for this processor.  However, this
+// function only uses one call to setAddrWindow(), which allows it to
+// run at least twice as fast.
+// Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
+// Input: x         horizontal position of the top left corner of the character, columns from the left edge
+//        y         vertical position of the top left corner of the character, rows from the top edge
+//        c         character to be printed
+//        textColor 16-bit color of the character
+//        bgColor   16-bit color of the background
+//        size      number of pixels per character pixel (e.g. size==2 prints each pixel of font as 2x2 square)
+// Output: none
+void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size);
+
+//------------ST7735_DrawString------------
+// String draw function.  
+// 16 rows (0 to 15) and 21 characters (0 to 20)
+// Requires (11 + size*size*6*8) bytes of transmission for each character
+// Input: x         columns from the left edge (0 to 20)
+//        y         rows from the top edge (0 to 15)
+//        pt        pointer to a null terminated string to be printed
+//        textColor 16-bit color of the characters
+// bgColor is Black and size is 1
+// Output: number of characters printed
+uint32_t ST7735_DrawString(uint16_t x, uint16_t y, char *pt, int16_t textColor);;
+
+
+
+//********ST7735_SetCursor*****************
+// Move the cursor to the desired X- and Y-position.  The
+// next character will be printed here.  X=0 is the leftmost
+// column.  Y=0 is the top row.
+// inputs: newX  new X-position of the cursor (0<=newX<=20)
+//         newY  new Y-position of the cursor (0<=newY<=15)
+// outputs: none
+void ST7735_SetCursor(uint32_t newX, uint32_t newY);
+
+//-----------------------ST7735_OutUDec-----------------------
+// Output a 32-bit number in unsigned decimal format
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+void ST7735_OutUDec(uint32_t n);
+
+
+//------------ST7735_SetRotation------------
+// Change the image rotation.
+// Requires 2 bytes of transmission
+// Input: m new rotation value (0 to 3)
+// Output: none
+void ST7735_SetRotation(uint8_t m) ;
+
+
+//------------ST7735_InvertDisplay------------
+// Send the command to invert all of the colors.
+// Requires 1 byte of transmission
+// Input: i 0 to disable inversion; non-zero to enable inversion
+// Output: none
+void ST7735_InvertDisplay(int i) ;
+
+//------------ST7735_SetScrollArea------------
+// Splits the screen into a fixed strip at the top, a scrolling
+// area and a fixed strip at the bottom, and shows the scrolling
+// area unmoved.  ST7735_Scroll() then moves what the panel
+// already has in the scrolling area without sending any pixels.
+// Only rotations 0 and 2 scroll screen rows, the others scroll
+// screen columns.
+// Requires 8 bytes of transmission
+// Input: top    rows of the top strip
+//        bottom rows of the bottom strip
+// Output: none
+// top + bottom must be less than 160
+void ST7735_SetScrollArea(uint8_t top, uint8_t bottom);
+
+//------------ST7735_Scroll------------
+// Shows the scrolling area of ST7735_SetScrollArea() moved up by
+// the given number of rows, the rows that leave the top of the
+// area come back in at its bottom.
+// Requires 3 bytes of transmission
+// Input: offset rows to move, 0 to one less than the area height
+// Output: none
+void ST7735_Scroll(uint8_t offset);
+
+//------------ST7735_SetPartialArea------------
+// Turns on partial mode, where the panel only shows rows y0 to y1
+// and leaves the rest of the screen blank.  Drawing outside the
+// rows still updates the panel memory for later.
+// Requires 6 bytes of transmission
+// Input: y0 first row shown, rows from the top edge
+//        y1 last row shown, at least y0
+// Output: none
+void ST7735_SetPartialArea(uint8_t y0, uint8_t y1);
+
+//------------ST7735_NormalMode------------
+// Leaves partial mode and scrolling, the whole screen shows the
+// panel memory as drawn again.
+// Requires 1 byte of transmission
+// Input: none
+// Output: none
+void ST7735_NormalMode(void);
+
+// graphics routines
+// y coordinates 0 to 31 used for labels and messages
+// y coordinates 32 to 159  128 pixels high
+// x coordinates 0 to 127   128 pixels wide
+
+// *************** ST7735_PlotClear ********************
+// Clear the graphics buffer, set X coordinate to 0
+// This routine clears the display 
+// Inputs: ymin and ymax are range of the plot
+// Outputs: none
+void ST7735_PlotClear(int32_t ymin, int32_t ymax);
+
+// *************** ST7735_PlotPoint ********************
+// Used in the voltage versus time plot, plot one point at y
+// It does output to display 
+// Inputs: y is the y coordinate of the point plotted
+// Outputs: none
+void ST7735_PlotPoint(int32_t y);
+
+// *************** ST7735_PlotLine ********************
+// Used in the voltage versus time plot, plot line to new point
+// It does output to display 
+// Inputs: y is the y coordinate of the point plotted
+// Outputs: none
+void ST7735_PlotLine(int32_t y);
+
+// *************** ST7735_PlotPoints ********************
+// Used in the voltage versus time plot, plot two points at y1, y2
+// It does output to display 
+// Inputs: y1 is the y coordinate of the first point plotted
+//         y2 is the y coordinate of the second point plotted
+// Outputs: none
+void ST7735_PlotPoints(int32_t y1,int32_t y2);
+
+// *************** ST7735_PlotBar ********************
+// Used in the voltage versus time bar, plot one bar at y
+// It does not output to display until RIT128x96x4ShowPlot called
+// Inputs: y is the y coordinate of the bar plotted
+// Outputs: none
+void ST7735_PlotBar(int32_t y);
+
+// *************** ST7735_PlotdBfs ********************
+// Used in the amplitude versus frequency plot, plot bar point at y
+// 0 to 0.625V scaled on a log plot from min to max
+// It does output to display 
+// Inputs: y is the y ADC value of the bar plotted
+// Outputs: none
+void ST7735_PlotdBfs(int32_t y);
+
+// *************** ST7735_PlotNext ********************
+// Used in all the plots to step the X coordinate one pixel
+// X steps from 0 to 127, then back to 0 again
+// It does not output to display 
+// Inputs: none
+// Outputs: none
+void ST7735_PlotNext(void);
+
+// *************** ST7735_PlotNextErase ********************
+// Used in all the plots to step the X coordinate one pixel
+// X steps from 0 to 127, then back to 0 again
+// It clears the vertical space into which the next pixel will be drawn 
+// Inputs: none
+// Outputs: none
+void ST7735_PlotNextErase(void);
+
+// Used in all the plots to write buffer to LCD
+// Example 1 Voltage versus time
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    ST7735_PlotPoint(data); ST7735_PlotNext(); // called 128 times
+
+// Example 2a Voltage versus time (N data points/pixel, time scale)
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    {   for(j=0;j<N;j++){
+//          ST7735_PlotPoint(data[i++]); // called N times
+//        }
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 2b Voltage versus time (N data points/pixel, time scale)
+//    ST7735_PlotClear(0,4095);  // range from 0 to 4095
+//    {   for(j=0;j<N;j++){
+//          ST7735_PlotLine(data[i++]); // called N times
+//        }
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 3 Voltage versus frequency (512 points)
+//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
+//    ST7735_PlotClear(0,1023);  // clip large magnitudes
+//    {
+//        ST7735_PlotBar(mag[i++]); // called 4 times
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotBar(mag[i++]); 
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// Example 4 Voltage versus frequency (512 points), dB scale
+//    perform FFT to get 512 magnitudes, mag[i] (0 to 4095)
+//    ST7735_PlotClear(0,511);  // parameters ignored
+//    {
+//        ST7735_PlotdBfs(mag[i++]); // called 4 times
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotdBfs(mag[i++]); 
+//        ST7735_PlotNext(); 
+//    }   // called 128 times
+
+// *************** ST7735_OutChar ********************
+// Output one character to the LCD
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// Inputs: 8-bit ASCII character
+// Outputs: none
+void ST7735_OutChar(char ch);
+
+//********ST7735_OutString*****************
+// Print a string of characters to the ST7735 LCD.
+// Position determined by ST7735_SetCursor command
+// Color set by ST7735_SetTextColor
+// The string will not automatically wrap.
+// inputs: ptr  pointer to NULL-terminated ASCII string
+// outputs: none
+void ST7735_OutString(char *ptr);
+
+// ************** ST7735_SetTextColor ************************
+// Sets the color in which the characters will be printed 
+// Background color is fixed at black
+// Input:  16-bit packed color
+// Output: none
+// ********************************************************
+void ST7735_SetTextColor(uint16_t color);
+
+// *************** Output_Init ********************
+// Standard device driver initialization function for printf
+// Initialize ST7735 LCD
+// Inputs: none
+// Outputs: none
+void Output_Init(void);
+
+// Clear display
+void Output_Clear(void);
+
+// Turn off display (low power)
+void Output_Off(void);
+
+// Turn on display
+void Output_On(void);
+
+// set the color for future output
+// Background color is fixed at black
+// Input:  16-bit packed color
+// Output: none
+void Output_Color(uint32_t newColor); 
+
+void LCD_OutDec(uint32_t data);  // output to LCD
+
+#endif
@@ -1,14 +1,14 @@
-#ifndef SOUND_H
-#define SOUND_H
-#include <stdint.h>
-
-void Sound_Init(void);
-void Sound_Shoot(void);
-void Sound_NoShoot(void);
-void Sound_Explosion1(void);
-void Sound_Explosion2(void);
-void Sound_P1Win (void);
-void Sound_P2Win (void);
-void Sound_Win (void);
-
-#endif
+#ifndef SOUND_H
+#define SOUND_H
+#include <stdint.h>
+
+void Sound_Init(void);
+void Sound_Shoot(void);
+void Sound_NoShoot(void);
+void Sound_Explosion1(void);
+void Sound_Explosion2(void);
+void Sound_P1Win (void);
+void Sound_P2Win (void);
+void Sound_Win (void);
+
+#endif
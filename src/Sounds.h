@@ -1,6345 +1,6345 @@
-#ifndef SOUNDS_H
-#define SOUNDS_H
-#include <stdint.h>
-
-#define P1_WIN_N 14894
-
-const uint8_t P1Win[P1_WIN_N] = {
-127, 128, 128, 128, 127, 128, 131, 133, // 0-7
-132, 128, 128, 130, 133, 134, 136, 130, // 8-15
-113, 100, 104, 122, 137, 140, 136, 131, // 16-23
-127, 122, 118, 122, 128, 136, 136, 131, // 24-31
-125, 122, 126, 134, 140, 140, 133, 129, // 32-39
-135, 146, 139, 105,  75,  82, 123, 158, // 40-47
-159, 136, 117, 119, 124, 126, 120, 118, // 48-55
-124, 132, 140, 139, 131, 124, 123, 128, // 56-63
-136, 144, 139, 129, 130, 142, 153, 128, // 64-71
- 82,  61,  94, 146, 167, 150, 122, 114, // 72-79
-126, 130, 122, 106, 111, 138, 156, 150, // 80-87
-125, 116, 120, 134, 141, 144, 145, 134, // 88-95
-128, 135, 149, 128,  79,  58,  93, 147, // 96-103
-167, 147, 120, 117, 129, 126, 110, 105, // 104-111
-124, 150, 154, 136, 121, 124, 134, 137, // 112-119
-133, 136, 148, 146, 137, 138, 138, 105, // 120-127
- 66,  68, 110, 157, 161, 138, 118, 122, // 128-135
-127, 120, 107, 103, 131, 154, 152, 131, // 136-143
-118, 128, 136, 139, 133, 143, 150, 145, // 144-151
-139, 140, 122,  73,  60,  94, 147, 165, // 152-159
-143, 122, 122, 132, 120, 102,  97, 132, // 160-167
-160, 153, 127, 115, 129, 140, 137, 127, // 168-175
-140, 157, 153, 138, 140, 129,  77,  54, // 176-183
- 86, 141, 164, 143, 125, 125, 133, 119, // 184-191
- 99,  98, 131, 160, 153, 126, 114, 131, // 192-199
-142, 136, 126, 137, 162, 159, 137, 138, // 200-207
-122,  72,  53,  92, 146, 163, 138, 122, // 208-215
-131, 133, 113,  91, 106, 146, 162, 142, // 216-223
-118, 124, 140, 141, 128, 128, 152, 167, // 224-231
-147, 128, 141, 115,  59,  54, 105, 162, // 232-239
-159, 124, 119, 133, 134, 100,  85, 125, // 240-247
-163, 159, 123, 116, 139, 149, 131, 120, // 248-255
-140, 170, 161, 131, 134, 131,  74,  49, // 256-263
- 92, 143, 165, 130, 125, 130, 134,  97, // 264-271
- 85, 125, 161, 158, 122, 121, 140, 145, // 272-279
-131, 124, 146, 165, 155, 130, 139, 141, // 280-287
- 70,  38,  95, 157, 165, 117, 123, 147, // 288-295
-137,  84,  69, 137, 171, 150, 109, 127, // 296-303
-157, 135, 117, 127, 166, 170, 138, 124, // 304-311
-145, 133,  46,  53, 115, 164, 150, 112, // 312-319
-142, 148, 116,  62,  98, 159, 157, 133, // 320-327
-114, 155, 139, 116, 124, 157, 175, 142, // 328-335
-135, 144, 150,  74,  26,  95, 149, 156, // 336-343
-111, 140, 164, 126,  68,  82, 145, 149, // 344-351
-130, 131, 157, 145, 109, 127, 157, 168, // 352-359
-139, 137, 157, 158,  79,  28,  91, 137, // 360-367
-135, 112, 149, 179, 125,  68,  91, 142, // 368-375
-134, 119, 141, 162, 138, 112, 137, 161, // 376-383
-160, 137, 142, 158, 134,  67,  43, 117, // 384-391
-134, 119, 124, 150, 165, 108,  91,  97, // 392-399
-145, 116, 129, 157, 143, 132, 106, 160, // 400-407
-148, 159, 142, 152, 149, 114,  78,  53, // 408-415
-118, 119, 130, 130, 153, 147,  97,  94, // 416-423
-124, 130, 121, 138, 153, 138, 116, 133, // 424-431
-149, 154, 158, 153, 148, 138, 107,  50, // 432-439
- 88, 119, 123, 126, 142, 163, 121,  94, // 440-447
-101, 132, 118, 127, 150, 147, 132, 123, // 448-455
-145, 137, 155, 167, 151, 132, 135,  81, // 456-463
- 63, 107, 106, 134, 127, 146, 149, 114, // 464-471
-102, 109, 124, 122, 143, 149, 132, 130, // 472-479
-138, 145, 152, 163, 154, 134, 146,  86, // 480-487
- 48, 110, 117, 109, 134, 155, 147, 104, // 488-495
-104, 121, 115, 118, 141, 153, 133, 135, // 496-503
-145, 137, 138, 162, 169, 135, 135,  95, // 504-511
- 61, 108, 101, 115, 134, 149, 146, 118, // 512-519
-108, 111, 113, 121, 134, 144, 136, 142, // 520-527
-143, 142, 154, 166, 150, 126, 147,  80, // 528-535
- 60, 120, 103, 115, 129, 156, 132, 107, // 536-543
-131, 107, 110, 127, 141, 140, 128, 150, // 544-551
-137, 143, 159, 160, 159, 129, 125,  74, // 552-559
- 72, 119,  93, 123, 151, 144, 127, 124, // 560-567
-109, 114, 111, 130, 134, 134, 149, 134, // 568-575
-146, 153, 161, 157, 129, 163,  91,  50, // 576-583
-132,  92,  92, 139, 150, 130, 123, 134, // 584-591
-111,  93, 144, 123, 126, 143, 140, 134, // 592-599
-148, 161, 151, 172, 136, 136,  74,  83, // 600-607
-114,  82, 112, 145, 139, 130, 137, 105, // 608-615
-123, 107, 134, 129, 130, 148, 128, 147, // 616-623
-152, 154, 175, 130, 163,  97,  56, 134, // 624-631
- 76,  96, 139, 141, 126, 134, 126, 113, // 632-639
-105, 140, 120, 132, 151, 129, 141, 144, // 640-647
-154, 155, 161, 145, 126,  73, 110,  90, // 648-655
- 84, 131, 127, 135, 136, 131, 121, 105, // 656-663
-129, 121, 123, 144, 136, 140, 147, 156, // 664-671
-158, 153, 142, 136,  69, 112, 104,  70, // 672-679
-137, 126, 128, 135, 147,  98, 129, 134, // 680-687
- 93, 153, 128, 133, 144, 146, 143, 157, // 688-695
-172, 131, 146,  84,  95, 115,  73, 123, // 696-703
-128, 127, 132, 134, 123, 113, 133, 125, // 704-711
-119, 147, 128, 138, 146, 147, 160, 162, // 712-719
-141, 136,  78, 112,  99,  76, 131, 119, // 720-727
-134, 135, 128, 126, 116, 123, 126, 125, // 728-735
-141, 134, 142, 141, 152, 157, 158, 139, // 736-743
-134,  82, 111,  98,  81, 134, 118, 128, // 744-751
-141, 127, 123, 124, 126, 118, 131, 130, // 752-759
-130, 148, 144, 154, 164, 152, 141, 126, // 760-767
- 74, 130,  78,  94, 138, 103, 145, 127, // 768-775
-128, 132, 111, 136, 110, 137, 131, 134, // 776-783
-146, 139, 160, 156, 154, 140, 111,  90, // 784-791
-127,  68, 113, 132, 103, 145, 128, 128, // 792-799
-125, 127, 123, 117, 142, 121, 142, 144, // 800-807
-141, 158, 159, 148, 138,  99, 108, 104, // 808-815
- 78, 130, 106, 130, 143, 125, 125, 130, // 816-823
-124, 112, 141, 116, 135, 150, 133, 153, // 824-831
-167, 140, 154, 132,  73, 144,  70,  99, // 832-839
-138,  91, 149, 127, 125, 135, 121, 126, // 840-847
-121, 131, 124, 134, 143, 134, 159, 152, // 848-855
-157, 139, 121, 100, 111,  91,  98, 126, // 856-863
-109, 145, 125, 129, 137, 111, 138, 115, // 864-871
-131, 128, 135, 143, 140, 158, 158, 141, // 872-879
-147, 100, 111, 115,  73, 131, 103, 124, // 880-887
-143, 117, 141, 129, 119, 131, 120, 130, // 888-895
-125, 141, 136, 152, 148, 156, 141, 137, // 896-903
-110, 110, 108,  86, 126,  96, 131, 132, // 904-911
-121, 145, 121, 132, 128, 121, 131, 124, // 912-919
-141, 138, 147, 154, 150, 142, 136,  99, // 920-927
-126,  97,  92, 127,  97, 127, 135, 115, // 928-935
-142, 128, 125, 135, 124, 125, 133, 133, // 936-943
-142, 149, 151, 152, 141, 133, 103, 125, // 944-951
- 94, 105, 118, 104, 126, 128, 121, 138, // 952-959
-128, 131, 129, 127, 128, 132, 135, 142, // 960-967
-145, 159, 141, 147, 128, 101, 132,  84, // 968-975
-115, 117, 102, 129, 124, 120, 138, 127, // 976-983
-127, 135, 125, 129, 135, 130, 144, 144, // 984-991
-155, 142, 144, 129, 101, 134,  85, 113, // 992-999
-120,  98, 139, 113, 132, 129, 127, 133, // 1000-1007
-125, 134, 127, 133, 135, 140, 146, 147, // 1008-1015
-152, 132, 137, 109, 116, 111,  96, 127, // 1016-1023
-103, 125, 125, 121, 132, 127, 129, 132, // 1024-1031
-129, 130, 133, 135, 140, 147, 145, 150, // 1032-1039
-135, 131, 117, 113, 110, 101, 120, 106, // 1040-1047
-123, 126, 118, 138, 120, 131, 133, 123, // 1048-1055
-136, 129, 137, 139, 143, 148, 144, 142, // 1056-1063
-127, 125, 111, 115, 106, 110, 119, 109, // 1064-1071
-133, 119, 121, 143, 114, 138, 131, 121, // 1072-1079
-144, 124, 143, 144, 145, 149, 140, 135, // 1080-1087
-122, 120, 108, 110, 109, 110, 118, 118, // 1088-1095
-129, 123, 132, 127, 129, 131, 129, 132, // 1096-1103
-135, 134, 143, 138, 154, 135, 142, 133, // 1104-1111
-111, 130,  98, 114, 110, 105, 123, 123, // 1112-1119
-120, 138, 121, 133, 133, 120, 141, 125, // 1120-1127
-141, 136, 143, 150, 139, 147, 128, 122, // 1128-1135
-127, 101, 118, 104, 110, 120, 117, 124, // 1136-1143
-127, 129, 127, 135, 123, 137, 130, 133, // 1144-1151
-140, 137, 148, 144, 142, 140, 124, 124, // 1152-1159
-114, 109, 109, 110, 110, 125, 119, 124, // 1160-1167
-134, 120, 134, 128, 127, 137, 129, 137, // 1168-1175
-139, 144, 147, 143, 143, 125, 129, 114, // 1176-1183
-108, 112, 106, 113, 119, 121, 122, 134, // 1184-1191
-123, 132, 130, 127, 136, 128, 137, 135, // 1192-1199
-139, 148, 138, 146, 136, 118, 131, 103, // 1200-1207
-112, 112, 106, 122, 122, 120, 129, 130, // 1208-1215
-123, 137, 124, 134, 133, 128, 140, 136, // 1216-1223
-142, 147, 139, 144, 123, 129, 112, 107, // 1224-1231
-116, 101, 120, 118, 121, 129, 126, 128, // 1232-1239
-134, 128, 134, 131, 131, 137, 132, 142, // 1240-1247
-144, 141, 144, 133, 122, 126, 107, 111, // 1248-1255
-113, 104, 125, 118, 121, 134, 121, 133, // 1256-1263
-130, 126, 136, 127, 135, 134, 138, 143, // 1264-1271
-144, 143, 140, 128, 125, 118, 107, 114, // 1272-1279
-109, 112, 123, 120, 125, 126, 128, 126, // 1280-1287
-132, 130, 127, 137, 127, 138, 137, 145, // 1288-1295
-145, 136, 149, 115, 131, 117, 100, 127, // 1296-1303
-100, 118, 126, 113, 132, 127, 122, 139, // 1304-1311
-120, 132, 131, 125, 139, 132, 141, 147, // 1312-1319
-141, 143, 134, 126, 122, 117, 107, 118, // 1320-1327
-108, 117, 123, 116, 132, 125, 127, 135, // 1328-1335
-122, 136, 124, 133, 133, 136, 141, 146, // 1336-1343
-140, 146, 133, 124, 129, 106, 117, 110, // 1344-1351
-110, 119, 122, 118, 135, 116, 139, 119, // 1352-1359
-128, 135, 118, 143, 126, 138, 144, 142, // 1360-1367
-145, 142, 138, 125, 125, 117, 107, 117, // 1368-1375
-110, 111, 130, 111, 132, 125, 123, 135, // 1376-1383
-121, 130, 130, 127, 138, 131, 144, 141, // 1384-1391
-147, 142, 142, 126, 130, 116, 112, 115, // 1392-1399
-108, 114, 121, 117, 125, 127, 121, 131, // 1400-1407
-124, 127, 131, 126, 136, 132, 139, 145, // 1408-1415
-144, 146, 144, 133, 128, 125, 109, 114, // 1416-1423
-111, 107, 117, 123, 112, 136, 116, 129, // 1424-1431
-130, 121, 135, 126, 130, 138, 128, 149, // 1432-1439
-139, 150, 143, 142, 128, 131, 115, 112, // 1440-1447
-113, 106, 114, 115, 122, 117, 131, 123, // 1448-1455
-124, 135, 117, 138, 124, 133, 139, 132, // 1456-1463
-148, 143, 145, 150, 136, 130, 129, 111, // 1464-1471
-115, 106, 113, 106, 120, 119, 117, 133, // 1472-1479
-122, 123, 138, 114, 139, 125, 130, 143, // 1480-1487
-130, 152, 142, 147, 148, 136, 130, 128, // 1488-1495
-110, 114, 105, 110, 106, 119, 120, 119, // 1496-1503
-134, 117, 140, 117, 134, 128, 123, 142, // 1504-1511
-127, 143, 144, 142, 151, 140, 147, 122, // 1512-1519
-131, 113, 107, 115, 100, 115, 111, 125, // 1520-1527
-120, 129, 130, 123, 135, 124, 130, 132, // 1528-1535
-125, 142, 131, 143, 143, 145, 140, 145, // 1536-1543
-133, 118, 130, 101, 113, 110, 106, 115, // 1544-1551
-121, 124, 122, 137, 123, 132, 133, 124, // 1552-1559
-136, 127, 132, 140, 130, 146, 136, 143, // 1560-1567
-137, 140, 125, 123, 121, 106, 113, 109, // 1568-1575
-112, 114, 128, 120, 131, 133, 125, 136, // 1576-1583
-128, 130, 133, 129, 134, 136, 132, 140, // 1584-1591
-135, 142, 132, 144, 123, 123, 128, 100, // 1592-1599
-121, 105, 113, 116, 123, 127, 125, 137, // 1600-1607
-126, 132, 133, 124, 134, 126, 133, 134, // 1608-1615
-131, 139, 136, 141, 135, 143, 131, 121, // 1616-1623
-135, 102, 119, 110, 107, 120, 120, 126, // 1624-1631
-131, 127, 136, 125, 129, 129, 121, 133, // 1632-1639
-126, 132, 136, 134, 140, 139, 143, 132, // 1640-1647
-151, 120, 129, 130,  97, 128, 102, 113, // 1648-1655
-124, 116, 132, 124, 129, 128, 122, 128, // 1656-1663
-119, 129, 125, 133, 133, 136, 138, 135, // 1664-1671
-145, 137, 137, 149, 118, 138, 120, 110, // 1672-1679
-119, 106, 113, 120, 119, 127, 127, 125, // 1680-1687
-128, 124, 124, 126, 128, 129, 137, 133, // 1688-1695
-139, 138, 137, 140, 141, 133, 144, 131, // 1696-1703
-121, 133, 104, 116, 112, 106, 120, 118, // 1704-1711
-122, 131, 126, 126, 130, 121, 131, 128, // 1712-1719
-128, 141, 132, 139, 140, 134, 139, 137, // 1720-1727
-136, 130, 146, 116, 128, 125,  96, 123, // 1728-1735
-105, 108, 126, 116, 129, 129, 128, 124, // 1736-1743
-134, 118, 130, 134, 123, 149, 129, 138, // 1744-1751
-142, 126, 139, 133, 130, 139, 136, 130, // 1752-1759
-124, 129, 106, 115, 114, 104, 126, 118, // 1760-1767
-126, 132, 125, 126, 130, 123, 126, 133, // 1768-1775
-124, 140, 133, 133, 140, 129, 133, 139, // 1776-1783
-131, 138, 139, 141, 121, 133, 118, 101, // 1784-1791
-126,  99, 117, 126, 117, 130, 130, 121, // 1792-1799
-127, 130, 116, 132, 131, 125, 147, 126, // 1800-1807
-140, 139, 127, 140, 134, 132, 143, 134, // 1808-1815
-144, 116, 129, 115,  99, 124, 100, 119, // 1816-1823
-126, 117, 134, 126, 128, 123, 126, 131, // 1824-1831
-117, 146, 122, 143, 140, 129, 142, 129, // 1832-1839
-131, 143, 124, 144, 132, 137, 127, 112, // 1840-1847
-130,  92, 123, 109, 110, 132, 119, 129, // 1848-1855
-132, 124, 123, 131, 119, 129, 135, 124, // 1856-1863
-143, 135, 133, 139, 129, 133, 135, 135, // 1864-1871
-131, 138, 134, 136, 115, 124, 117, 100, // 1872-1879
-126, 106, 119, 131, 120, 129, 133, 117, // 1880-1887
-130, 127, 117, 140, 125, 135, 141, 129, // 1888-1895
-140, 134, 131, 133, 134, 135, 132, 140, // 1896-1903
-134, 138, 111, 126, 115,  98, 125, 109, // 1904-1911
-118, 130, 121, 126, 131, 120, 121, 135, // 1912-1919
-116, 135, 138, 125, 146, 133, 131, 140, // 1920-1927
-127, 133, 135, 134, 130, 141, 133, 138, // 1928-1935
-123, 108, 132,  93, 118, 117, 111, 128, // 1936-1943
-128, 120, 135, 127, 122, 128, 132, 123, // 1944-1951
-135, 139, 129, 140, 134, 126, 136, 127, // 1952-1959
-128, 137, 132, 129, 143, 130, 139, 110, // 1960-1967
-123, 121,  94, 131, 109, 119, 138, 120, // 1968-1975
-128, 134, 121, 121, 135, 121, 125, 144, // 1976-1983
-122, 142, 134, 125, 136, 128, 126, 134, // 1984-1991
-131, 137, 133, 141, 138, 137, 106, 131, // 1992-1999
-108, 101, 126, 108, 122, 134, 121, 129, // 2000-2007
-130, 124, 119, 133, 125, 123, 146, 124, // 2008-2015
-139, 139, 124, 135, 130, 126, 135, 135, // 2016-2023
-136, 131, 144, 132, 139, 111, 113, 123, // 2024-2031
- 94, 120, 119, 117, 132, 131, 122, 133, // 2032-2039
-126, 125, 126, 125, 137, 124, 139, 139, // 2040-2047
-126, 139, 126, 122, 133, 126, 131, 140, // 2048-2055
-126, 138, 141, 132, 134, 101, 128, 109, // 2056-2063
-100, 130, 116, 123, 139, 126, 125, 134, // 2064-2071
-125, 123, 125, 131, 129, 129, 141, 130, // 2072-2079
-129, 135, 122, 126, 132, 125, 135, 139, // 2080-2087
-130, 142, 139, 137, 132,  95, 132, 108, // 2088-2095
- 94, 137, 115, 121, 141, 125, 124, 133, // 2096-2103
-123, 120, 125, 137, 119, 139, 141, 125, // 2104-2111
-137, 132, 122, 133, 127, 129, 138, 136, // 2112-2119
-131, 138, 138, 134, 126,  98, 126, 107, // 2120-2127
-100, 128, 123, 121, 138, 130, 124, 130, // 2128-2135
-127, 122, 126, 135, 127, 133, 141, 127, // 2136-2143
-131, 133, 123, 128, 129, 128, 133, 138, // 2144-2151
-134, 134, 138, 137, 136, 105, 111, 128, // 2152-2159
- 93, 118, 132, 118, 127, 139, 121, 127, // 2160-2167
-128, 127, 122, 130, 121, 136, 135, 123, // 2168-2175
-141, 130, 123, 136, 126, 127, 137, 133, // 2176-2183
-138, 134, 137, 138, 132, 136,  96, 115, // 2184-2191
-125,  90, 122, 134, 118, 130, 138, 121, // 2192-2199
-126, 129, 125, 120, 129, 134, 129, 132, // 2200-2207
-140, 127, 130, 132, 125, 127, 134, 129, // 2208-2215
-137, 138, 132, 135, 138, 133, 133,  96, // 2216-2223
-114, 125,  98, 115, 140, 124, 124, 139, // 2224-2231
-125, 122, 129, 123, 120, 136, 127, 133, // 2232-2239
-136, 132, 129, 130, 127, 126, 128, 130, // 2240-2247
-131, 134, 140, 133, 137, 139, 133, 137, // 2248-2255
-103, 104, 130, 101, 110, 138, 128, 121, // 2256-2263
-138, 125, 121, 125, 125, 117, 128, 137, // 2264-2271
-126, 135, 139, 128, 127, 132, 126, 127, // 2272-2279
-131, 131, 135, 138, 136, 134, 136, 134, // 2280-2287
-133, 124,  94, 117, 126,  99, 122, 140, // 2288-2295
-121, 123, 134, 124, 121, 127, 128, 125, // 2296-2303
-124, 144, 133, 126, 140, 132, 119, 132, // 2304-2311
-130, 124, 131, 134, 136, 137, 134, 135, // 2312-2319
-133, 128, 136, 123,  95, 118, 126, 101, // 2320-2327
-119, 139, 124, 121, 133, 127, 123, 125, // 2328-2335
-129, 124, 129, 138, 130, 131, 136, 129, // 2336-2343
-127, 130, 128, 129, 131, 132, 138, 138, // 2344-2351
-135, 134, 131, 132, 132, 124, 100, 112, // 2352-2359
-128, 105, 113, 140, 126, 118, 134, 128, // 2360-2367
-122, 127, 127, 128, 130, 132, 135, 132, // 2368-2375
-130, 131, 129, 126, 129, 131, 129, 131, // 2376-2383
-137, 137, 134, 133, 130, 129, 132, 130, // 2384-2391
-107, 104, 128, 113, 106, 134, 134, 119, // 2392-2399
-129, 132, 126, 124, 128, 127, 126, 131, // 2400-2407
-135, 132, 128, 131, 132, 126, 127, 131, // 2408-2415
-128, 129, 134, 136, 137, 134, 129, 133, // 2416-2423
-132, 130, 122, 106, 112, 122, 113, 115, // 2424-2431
-133, 131, 122, 129, 130, 125, 125, 128, // 2432-2439
-131, 130, 128, 136, 135, 126, 132, 134, // 2440-2447
-124, 126, 130, 127, 128, 134, 137, 137, // 2448-2455
-130, 130, 131, 127, 130, 122, 101, 115, // 2456-2463
-128, 109, 115, 138, 130, 120, 130, 132, // 2464-2471
-124, 125, 128, 133, 128, 129, 139, 131, // 2472-2479
-124, 133, 131, 122, 128, 131, 128, 130, // 2480-2487
-135, 137, 135, 130, 129, 132, 128, 129, // 2488-2495
-127, 106, 112, 127, 114, 112, 131, 133, // 2496-2503
-122, 126, 131, 128, 122, 127, 135, 127, // 2504-2511
-126, 138, 132, 124, 132, 132, 125, 127, // 2512-2519
-130, 129, 129, 133, 137, 138, 131, 129, // 2520-2527
-131, 130, 128, 129, 114, 101, 123, 124, // 2528-2535
-109, 123, 140, 126, 121, 131, 131, 124, // 2536-2543
-123, 130, 132, 130, 128, 135, 134, 127, // 2544-2551
-128, 133, 127, 124, 130, 131, 130, 133, // 2552-2559
-136, 135, 129, 127, 129, 131, 130, 123, // 2560-2567
-110, 114, 125, 116, 115, 131, 135, 123, // 2568-2575
-125, 132, 129, 125, 128, 131, 132, 126, // 2576-2583
-129, 136, 129, 125, 131, 132, 122, 126, // 2584-2591
-130, 129, 130, 135, 137, 132, 127, 129, // 2592-2599
-132, 128, 129, 127, 108, 112, 128, 118, // 2600-2607
-112, 130, 137, 124, 124, 131, 132, 124, // 2608-2615
-127, 131, 129, 129, 130, 131, 130, 130, // 2616-2623
-128, 128, 128, 128, 127, 129, 133, 136, // 2624-2631
-135, 132, 129, 128, 129, 128, 130, 128, // 2632-2639
-109, 108, 127, 122, 111, 128, 140, 126, // 2640-2647
-123, 132, 132, 125, 126, 131, 128, 126, // 2648-2655
-131, 132, 129, 129, 130, 128, 128, 127, // 2656-2663
-126, 130, 133, 134, 133, 134, 130, 128, // 2664-2671
-127, 130, 130, 127, 119, 108, 118, 126, // 2672-2679
-117, 119, 134, 133, 124, 126, 131, 130, // 2680-2687
-126, 127, 131, 131, 125, 127, 136, 132, // 2688-2695
-124, 129, 134, 127, 121, 127, 133, 134, // 2696-2703
-133, 134, 134, 129, 127, 129, 130, 129, // 2704-2711
-125, 111, 111, 124, 123, 116, 124, 136, // 2712-2719
-130, 123, 125, 132, 129, 126, 127, 132, // 2720-2727
-129, 123, 131, 134, 128, 126, 132, 129, // 2728-2735
-125, 125, 128, 133, 136, 135, 133, 132, // 2736-2743
-127, 127, 128, 129, 130, 127, 109, 110, // 2744-2751
-126, 124, 116, 127, 137, 131, 124, 124, // 2752-2759
-131, 130, 125, 125, 131, 129, 123, 128, // 2760-2767
-134, 131, 126, 129, 128, 126, 125, 127, // 2768-2775
-132, 137, 136, 131, 131, 129, 128, 128, // 2776-2783
-129, 130, 127, 110, 109, 125, 127, 119, // 2784-2791
-125, 137, 134, 125, 122, 128, 131, 127, // 2792-2799
-124, 126, 128, 130, 130, 126, 128, 131, // 2800-2807
-128, 123, 125, 126, 130, 132, 135, 137, // 2808-2815
-136, 130, 126, 129, 131, 130, 129, 127, // 2816-2823
-114, 111, 121, 126, 122, 125, 133, 131, // 2824-2831
-127, 124, 126, 130, 130, 126, 127, 127, // 2832-2839
-128, 131, 129, 128, 129, 130, 127, 125, // 2840-2847
-124, 128, 132, 136, 136, 134, 130, 129, // 2848-2855
-129, 127, 130, 133, 128, 112, 107, 120, // 2856-2863
-128, 124, 122, 129, 133, 130, 124, 123, // 2864-2871
-129, 132, 128, 124, 124, 131, 135, 129, // 2872-2879
-125, 128, 131, 126, 124, 125, 129, 134, // 2880-2887
-136, 135, 134, 131, 128, 127, 128, 129, // 2888-2895
-132, 129, 114, 107, 117, 127, 127, 125, // 2896-2903
-126, 130, 133, 127, 122, 127, 133, 132, // 2904-2911
-127, 123, 126, 135, 134, 127, 125, 128, // 2912-2919
-130, 128, 124, 125, 132, 138, 139, 134, // 2920-2927
-127, 126, 129, 129, 128, 129, 130, 121, // 2928-2935
-110, 112, 121, 127, 128, 127, 127, 130, // 2936-2943
-129, 127, 126, 127, 130, 131, 125, 124, // 2944-2951
-131, 132, 131, 129, 126, 126, 129, 127, // 2952-2959
-126, 129, 134, 138, 136, 131, 127, 128, // 2960-2967
-129, 130, 131, 130, 121, 112, 113, 120, // 2968-2975
-126, 128, 128, 127, 129, 129, 127, 127, // 2976-2983
-127, 129, 131, 127, 125, 129, 131, 131, // 2984-2991
-129, 126, 125, 127, 128, 127, 129, 132, // 2992-2999
-136, 137, 132, 126, 127, 129, 130, 131, // 3000-3007
-131, 125, 113, 110, 118, 126, 130, 130, // 3008-3015
-127, 126, 128, 129, 129, 127, 127, 127, // 3016-3023
-126, 127, 130, 130, 130, 129, 127, 127, // 3024-3031
-128, 126, 126, 129, 132, 136, 136, 132, // 3032-3039
-127, 127, 128, 129, 130, 130, 125, 114, // 3040-3047
-111, 116, 124, 131, 132, 129, 126, 126, // 3048-3055
-128, 130, 129, 128, 127, 126, 127, 131, // 3056-3063
-131, 130, 129, 126, 126, 127, 128, 127, // 3064-3071
-129, 131, 135, 136, 133, 128, 125, 126, // 3072-3079
-129, 131, 131, 126, 115, 110, 112, 121, // 3080-3087
-130, 134, 131, 127, 124, 125, 130, 132, // 3088-3095
-131, 127, 124, 124, 130, 132, 133, 129, // 3096-3103
-125, 124, 126, 129, 130, 130, 130, 134, // 3104-3111
-136, 134, 132, 127, 124, 125, 129, 132, // 3112-3119
-128, 117, 110, 111, 120, 130, 136, 134, // 3120-3127
-127, 122, 123, 128, 132, 134, 130, 124, // 3128-3135
-123, 127, 131, 134, 132, 127, 123, 123, // 3136-3143
-127, 131, 133, 132, 133, 133, 133, 130, // 3144-3151
-128, 126, 127, 129, 129, 123, 115, 111, // 3152-3159
-113, 121, 130, 135, 134, 128, 123, 122, // 3160-3167
-125, 131, 134, 132, 128, 124, 125, 129, // 3168-3175
-133, 133, 129, 125, 124, 125, 129, 134, // 3176-3183
-136, 136, 134, 130, 127, 126, 128, 130, // 3184-3191
-131, 127, 118, 111, 110, 115, 125, 133, // 3192-3199
-137, 134, 128, 122, 121, 125, 131, 133, // 3200-3207
-132, 128, 125, 125, 127, 130, 132, 130, // 3208-3215
-127, 125, 125, 128, 133, 137, 137, 134, // 3216-3223
-130, 126, 126, 128, 131, 131, 125, 116, // 3224-3231
-110, 111, 117, 127, 135, 137, 134, 128, // 3232-3239
-122, 120, 124, 129, 132, 133, 130, 128, // 3240-3247
-126, 127, 128, 130, 130, 128, 126, 126, // 3248-3255
-129, 133, 136, 136, 133, 128, 126, 126, // 3256-3263
-129, 131, 128, 120, 113, 111, 113, 121, // 3264-3271
-130, 136, 137, 133, 128, 123, 121, 124, // 3272-3279
-129, 132, 133, 132, 129, 127, 127, 128, // 3280-3287
-128, 129, 128, 128, 129, 132, 135, 135, // 3288-3295
-133, 130, 127, 126, 128, 129, 127, 121, // 3296-3303
-115, 111, 113, 119, 127, 134, 137, 135, // 3304-3311
-131, 126, 124, 124, 126, 128, 130, 132, // 3312-3319
-131, 130, 128, 127, 127, 127, 126, 128, // 3320-3327
-130, 132, 135, 136, 134, 131, 128, 127, // 3328-3335
-127, 128, 127, 122, 116, 112, 112, 117, // 3336-3343
-125, 132, 136, 136, 132, 128, 126, 124, // 3344-3351
-125, 127, 128, 130, 130, 130, 130, 129, // 3352-3359
-128, 127, 127, 128, 129, 132, 134, 136, // 3360-3367
-134, 132, 130, 129, 128, 127, 124, 120, // 3368-3375
-116, 113, 114, 119, 125, 130, 134, 135, // 3376-3383
-132, 129, 127, 126, 126, 127, 127, 128, // 3384-3391
-129, 129, 129, 129, 128, 127, 127, 128, // 3392-3399
-129, 132, 135, 136, 135, 132, 130, 129, // 3400-3407
-129, 127, 122, 118, 115, 115, 116, 121, // 3408-3415
-126, 131, 134, 134, 132, 130, 128, 126, // 3416-3423
-126, 126, 127, 128, 129, 129, 128, 128, // 3424-3431
-128, 127, 127, 128, 130, 133, 135, 135, // 3432-3439
-133, 132, 130, 129, 129, 124, 118, 115, // 3440-3447
-114, 115, 120, 124, 128, 132, 134, 133, // 3448-3455
-131, 130, 129, 128, 127, 127, 127, 128, // 3456-3463
-128, 128, 128, 128, 128, 128, 129, 129, // 3464-3471
-131, 133, 134, 133, 133, 132, 131, 130, // 3472-3479
-126, 119, 114, 113, 114, 118, 123, 128, // 3480-3487
-132, 133, 132, 130, 129, 129, 128, 128, // 3488-3495
-128, 127, 127, 128, 128, 128, 128, 128, // 3496-3503
-128, 129, 130, 131, 134, 135, 133, 132, // 3504-3511
-132, 132, 130, 125, 119, 115, 114, 114, // 3512-3519
-117, 122, 127, 131, 133, 131, 129, 128, // 3520-3527
-128, 128, 128, 128, 128, 128, 128, 128, // 3528-3535
-127, 128, 128, 129, 130, 131, 134, 135, // 3536-3543
-136, 134, 133, 133, 132, 129, 123, 116, // 3544-3551
-112, 111, 114, 119, 124, 130, 132, 132, // 3552-3559
-131, 129, 128, 128, 128, 128, 128, 128, // 3560-3567
-129, 129, 128, 127, 127, 128, 128, 130, // 3568-3575
-133, 135, 137, 136, 135, 133, 131, 127, // 3576-3583
-120, 114, 112, 112, 114, 119, 124, 129, // 3584-3591
-133, 134, 132, 130, 128, 127, 128, 128, // 3592-3599
-128, 128, 129, 128, 128, 129, 128, 129, // 3600-3607
-130, 131, 133, 136, 137, 136, 134, 133, // 3608-3615
-132, 127, 120, 113, 110, 111, 114, 119, // 3616-3623
-125, 129, 133, 134, 132, 130, 129, 127, // 3624-3631
-126, 127, 128, 129, 130, 130, 129, 128, // 3632-3639
-129, 129, 130, 132, 134, 136, 136, 136, // 3640-3647
-135, 134, 129, 121, 114, 109, 109, 112, // 3648-3655
-118, 123, 128, 133, 134, 132, 130, 128, // 3656-3663
-127, 127, 128, 129, 131, 132, 131, 130, // 3664-3671
-129, 127, 126, 128, 131, 134, 137, 137, // 3672-3679
-136, 136, 134, 128, 120, 112, 108, 108, // 3680-3687
-113, 119, 124, 129, 133, 133, 132, 130, // 3688-3695
-128, 127, 128, 128, 130, 132, 132, 132, // 3696-3703
-130, 128, 127, 127, 130, 132, 135, 136, // 3704-3711
-136, 136, 136, 131, 122, 114, 108, 107, // 3712-3719
-111, 118, 124, 130, 133, 133, 131, 129, // 3720-3727
-127, 126, 126, 127, 129, 132, 133, 133, // 3728-3735
-131, 129, 127, 127, 129, 132, 135, 137, // 3736-3743
-138, 138, 136, 130, 120, 112, 108, 108, // 3744-3751
-113, 120, 126, 131, 134, 133, 130, 128, // 3752-3759
-124, 123, 125, 128, 130, 134, 135, 132, // 3760-3767
-129, 127, 125, 128, 131, 134, 137, 140, // 3768-3775
-140, 139, 134, 124, 113, 107, 104, 108, // 3776-3783
-116, 124, 131, 135, 135, 132, 128, 125, // 3784-3791
-123, 124, 126, 128, 132, 134, 134, 132, // 3792-3799
-128, 126, 127, 130, 133, 138, 141, 142, // 3800-3807
-141, 135, 124, 112, 105, 103, 109, 118, // 3808-3815
-127, 134, 136, 135, 130, 126, 122, 122, // 3816-3823
-124, 127, 131, 135, 136, 134, 130, 126, // 3824-3831
-124, 125, 129, 133, 139, 142, 142, 139, // 3832-3839
-130, 117, 107, 102, 104, 113, 125, 134, // 3840-3847
-139, 138, 133, 126, 122, 119, 120, 125, // 3848-3855
-132, 137, 138, 136, 132, 127, 123, 124, // 3856-3863
-127, 133, 140, 144, 144, 141, 130, 114, // 3864-3871
-102,  98, 103, 115, 130, 139, 144, 139, // 3872-3879
-130, 120, 115, 114, 119, 127, 137, 142, // 3880-3887
-142, 138, 129, 122, 119, 121, 127, 137, // 3888-3895
-146, 151, 149, 139, 121, 103,  93,  95, // 3896-3903
-107, 125, 140, 147, 145, 135, 121, 110, // 3904-3911
-109, 114, 125, 138, 146, 146, 142, 131, // 3912-3919
-120, 115, 118, 124, 136, 148, 153, 151, // 3920-3927
-141, 122, 101,  90,  92, 104, 125, 143, // 3928-3935
-149, 145, 133, 117, 106, 108, 115, 129, // 3936-3943
-144, 152, 147, 139, 127, 116, 115, 121, // 3944-3951
-131, 142, 154, 154, 146, 133, 113,  94, // 3952-3959
- 90,  99, 113, 135, 148, 147, 136, 122, // 3960-3967
-107, 103, 113, 127, 141, 151, 150, 137, // 3968-3975
-127, 117, 115, 122, 135, 143, 150, 152, // 3976-3983
-143, 133, 120, 106,  96, 100, 110, 125, // 3984-3991
-139, 144, 136, 125, 115, 107, 112, 123, // 3992-3999
-135, 142, 145, 137, 127, 123, 121, 125, // 4000-4007
-135, 143, 145, 146, 143, 136, 129, 117, // 4008-4015
-103,  96, 103, 114, 131, 144, 142, 131, // 4016-4023
-118, 108, 108, 120, 133, 142, 144, 139, // 4024-4031
-127, 123, 122, 129, 136, 144, 143, 142, // 4032-4039
-141, 139, 133, 122, 107,  96,  99, 111, // 4040-4047
-129, 141, 143, 129, 118, 107, 112, 121, // 4048-4055
-137, 142, 140, 132, 124, 126, 129, 138, // 4056-4063
-140, 142, 138, 139, 140, 141, 135, 116, // 4064-4071
-100,  90,  99, 118, 139, 145, 136, 119, // 4072-4079
-106, 107, 121, 135, 143, 137, 130, 123, // 4080-4087
-127, 137, 143, 143, 135, 131, 131, 145, // 4088-4095
-151, 148, 124,  98,  81,  93, 118, 141, // 4096-4103
-146, 132, 112, 106, 114, 132, 136, 136, // 4104-4111
-122, 119, 125, 138, 149, 143, 136, 121, // 4112-4119
-128, 136, 157, 157, 148, 116,  94,  87, // 4120-4127
-106, 127, 136, 132, 116, 113, 119, 129, // 4128-4135
-135, 126, 119, 113, 123, 139, 145, 147, // 4136-4143
-131, 129, 125, 139, 146, 153, 148, 136, // 4144-4151
-114, 102, 100, 113, 124, 126, 125, 117, // 4152-4159
-121, 124, 128, 128, 121, 124, 120, 133, // 4160-4167
-134, 140, 137, 133, 135, 133, 142, 144, // 4168-4175
-150, 143, 132, 108, 101, 100, 121, 124, // 4176-4183
-129, 120, 115, 120, 123, 131, 123, 123, // 4184-4191
-122, 125, 136, 134, 140, 131, 137, 134, // 4192-4199
-140, 142, 146, 146, 139, 118, 102,  98, // 4200-4207
-112, 127, 127, 126, 113, 121, 121, 129, // 4208-4215
-123, 121, 124, 125, 136, 136, 139, 136, // 4216-4223
-137, 140, 135, 141, 139, 146, 139, 128, // 4224-4231
-102, 100, 106, 129, 126, 125, 116, 116, // 4232-4239
-127, 123, 128, 112, 128, 122, 136, 133, // 4240-4247
-134, 138, 140, 146, 134, 137, 140, 148, // 4248-4255
-144, 124, 100,  95, 113, 132, 128, 119, // 4256-4263
-113, 119, 129, 125, 120, 114, 129, 127, // 4264-4271
-132, 124, 134, 139, 151, 145, 134, 135, // 4272-4279
-145, 150, 136, 109,  93, 105, 128, 140, // 4280-4287
-122, 119, 114, 129, 123, 118, 111, 124, // 4288-4295
-137, 131, 124, 122, 137, 147, 148, 138, // 4296-4303
-128, 148, 152, 151, 120,  97,  97, 112, // 4304-4311
-135, 122, 120, 118, 130, 130, 114, 112, // 4312-4319
-111, 139, 130, 127, 116, 133, 150, 149, // 4320-4327
-146, 124, 144, 148, 155, 129, 103,  97, // 4328-4335
-110, 129, 128, 114, 119, 125, 135, 120, // 4336-4343
-109, 118, 129, 145, 118, 123, 118, 152, // 4344-4351
-147, 147, 129, 138, 154, 150, 134, 102, // 4352-4359
- 98, 110, 125, 131, 114, 121, 124, 132, // 4360-4367
-119, 110, 118, 129, 142, 120, 122, 119, // 4368-4375
-151, 145, 149, 131, 143, 153, 147, 133, // 4376-4383
-101, 101, 109, 122, 132, 116, 124, 120, // 4384-4391
-132, 119, 114, 113, 128, 138, 127, 118, // 4392-4399
-121, 144, 150, 147, 132, 141, 154, 151, // 4400-4407
-130,  99,  97, 114, 126, 132, 118, 125, // 4408-4415
-124, 128, 115, 110, 121, 133, 138, 120, // 4416-4423
-119, 124, 148, 145, 144, 132, 146, 154, // 4424-4431
-144, 129,  97, 107, 108, 127, 125, 120, // 4432-4439
-127, 121, 129, 109, 120, 120, 136, 131, // 4440-4447
-121, 120, 127, 149, 144, 149, 132, 154, // 4448-4455
-145, 146, 111,  99, 105, 118, 133, 120, // 4456-4463
-124, 119, 128, 120, 112, 115, 126, 140, // 4464-4471
-129, 123, 119, 139, 145, 147, 138, 143, // 4472-4479
-156, 148, 129, 101,  98, 114, 122, 131, // 4480-4487
-121, 127, 125, 122, 114, 112, 122, 132, // 4488-4495
-132, 125, 120, 131, 144, 146, 144, 136, // 4496-4503
-152, 148, 140, 113,  96, 109, 117, 133, // 4504-4511
-121, 128, 123, 127, 116, 112, 118, 124, // 4512-4519
-139, 120, 128, 116, 145, 142, 150, 140, // 4520-4527
-143, 154, 140, 127,  94, 102, 119, 129, // 4528-4535
-130, 118, 127, 126, 121, 113, 111, 128, // 4536-4543
-136, 130, 121, 120, 139, 145, 146, 138, // 4544-4551
-143, 156, 146, 127, 102,  97, 115, 121, // 4552-4559
-132, 123, 128, 125, 119, 115, 115, 122, // 4560-4567
-132, 130, 125, 120, 131, 145, 148, 145, // 4568-4575
-138, 153, 147, 135, 104,  93, 111, 122, // 4576-4583
-133, 123, 128, 126, 122, 117, 113, 120, // 4584-4591
-129, 132, 124, 123, 128, 145, 145, 147, // 4592-4599
-135, 153, 149, 137, 108,  91, 113, 123, // 4600-4607
-132, 122, 123, 129, 121, 118, 111, 122, // 4608-4615
-133, 130, 120, 119, 130, 146, 145, 146, // 4616-4623
-136, 157, 146, 136, 105,  93, 111, 122, // 4624-4631
-135, 123, 127, 123, 124, 114, 113, 120, // 4632-4639
-133, 134, 121, 119, 128, 147, 146, 145, // 4640-4647
-135, 153, 152, 132, 108,  91, 114, 126, // 4648-4655
-132, 127, 123, 128, 118, 115, 113, 120, // 4656-4663
-134, 129, 124, 119, 129, 145, 144, 148, // 4664-4671
-138, 155, 149, 131, 108,  89, 115, 123, // 4672-4679
-135, 124, 128, 126, 120, 113, 112, 123, // 4680-4687
-134, 131, 119, 120, 132, 144, 144, 144, // 4688-4695
-141, 155, 149, 130, 107,  92, 115, 122, // 4696-4703
-136, 123, 127, 125, 121, 116, 110, 123, // 4704-4711
-133, 136, 117, 119, 130, 149, 147, 140, // 4712-4719
-137, 153, 155, 128, 103,  89, 120, 128, // 4720-4727
-132, 121, 126, 129, 118, 113, 115, 125, // 4728-4735
-135, 129, 121, 121, 131, 145, 143, 145, // 4736-4743
-135, 156, 148, 133, 106,  88, 118, 125, // 4744-4751
-139, 119, 125, 126, 123, 119, 112, 118, // 4752-4759
-128, 138, 121, 123, 124, 152, 141, 145, // 4760-4767
-131, 156, 149, 135, 107,  87, 117, 128, // 4768-4775
-137, 120, 121, 130, 122, 120, 113, 116, // 4776-4783
-136, 132, 124, 114, 132, 149, 144, 142, // 4784-4791
-129, 158, 148, 138, 108,  89, 115, 120, // 4792-4799
-140, 122, 127, 123, 120, 118, 117, 122, // 4800-4807
-122, 134, 124, 126, 124, 140, 149, 142, // 4808-4815
-138, 140, 157, 136, 128,  88, 106, 121, // 4816-4823
-135, 130, 116, 130, 122, 119, 112, 116, // 4824-4831
-134, 132, 125, 114, 129, 145, 144, 139, // 4832-4839
-135, 147, 154, 136, 134,  99, 103, 114, // 4840-4847
-127, 138, 115, 130, 114, 127, 112, 120, // 4848-4855
-122, 134, 130, 118, 122, 135, 150, 142, // 4856-4863
-139, 136, 153, 145, 136, 110,  95, 114, // 4864-4871
-122, 137, 119, 126, 121, 123, 116, 116, // 4872-4879
-125, 124, 135, 117, 128, 126, 148, 142, // 4880-4887
-142, 137, 145, 151, 137, 128,  92, 109, // 4888-4895
-116, 134, 126, 120, 127, 121, 120, 113, // 4896-4903
-124, 125, 127, 124, 121, 133, 136, 145, // 4904-4911
-141, 144, 139, 148, 142, 139, 109,  96, // 4912-4919
-111, 126, 134, 119, 124, 124, 125, 108, // 4920-4927
-123, 117, 135, 119, 122, 124, 136, 147, // 4928-4935
-136, 145, 134, 149, 141, 143, 133, 100, // 4936-4943
-106, 114, 134, 128, 119, 125, 124, 124, // 4944-4951
-110, 121, 119, 137, 119, 122, 124, 142, // 4952-4959
-145, 137, 140, 136, 151, 139, 141, 124, // 4960-4967
- 99, 112, 114, 138, 123, 121, 127, 120, // 4968-4975
-125, 110, 126, 118, 134, 117, 125, 130, // 4976-4983
-142, 143, 136, 140, 135, 150, 137, 143, // 4984-4991
-114, 100, 110, 124, 137, 119, 123, 122, // 4992-4999
-127, 117, 116, 123, 126, 129, 118, 128, // 5000-5007
-131, 143, 138, 138, 139, 136, 149, 139, // 5008-5015
-144, 109, 103, 110, 125, 135, 118, 126, // 5016-5023
-122, 126, 114, 119, 125, 123, 129, 118, // 5024-5031
-132, 130, 141, 137, 138, 138, 135, 146, // 5032-5039
-145, 140, 119, 100, 113, 119, 133, 123, // 5040-5047
-124, 123, 122, 117, 117, 129, 123, 125, // 5048-5055
-118, 130, 132, 137, 137, 137, 139, 135, // 5056-5063
-141, 146, 140, 133, 103, 107, 117, 130, // 5064-5071
-129, 119, 124, 121, 124, 118, 124, 127, // 5072-5079
-117, 129, 117, 138, 127, 144, 134, 139, // 5080-5087
-134, 132, 148, 144, 143, 114, 102, 115, // 5088-5095
-121, 131, 120, 123, 127, 119, 126, 118, // 5096-5103
-132, 122, 115, 124, 125, 139, 129, 138, // 5104-5111
-137, 135, 133, 131, 154, 141, 137, 109, // 5112-5119
-107, 116, 126, 127, 122, 125, 126, 122, // 5120-5127
-124, 122, 131, 123, 113, 124, 128, 140, // 5128-5135
-131, 135, 136, 131, 134, 132, 155, 139, // 5136-5143
-136, 110, 108, 116, 123, 128, 122, 126, // 5144-5151
-125, 123, 124, 123, 128, 120, 119, 124, // 5152-5159
-127, 139, 132, 140, 128, 133, 129, 139, // 5160-5167
-148, 141, 135, 119, 108, 114, 119, 130, // 5168-5175
-121, 123, 122, 128, 126, 118, 129, 122, // 5176-5183
-120, 116, 132, 136, 140, 130, 134, 133, // 5184-5191
-135, 132, 139, 145, 138, 136, 108, 111, // 5192-5199
-118, 125, 124, 115, 128, 126, 127, 118, // 5200-5207
-127, 125, 119, 108, 132, 133, 142, 129, // 5208-5215
-137, 137, 128, 131, 131, 151, 142, 139, // 5216-5223
-132, 111, 111, 115, 123, 128, 114, 131, // 5224-5231
-120, 132, 112, 130, 123, 117, 116, 125, // 5232-5239
-141, 131, 138, 131, 138, 126, 133, 137, // 5240-5247
-147, 145, 135, 136, 108, 113, 115, 127, // 5248-5255
-124, 115, 126, 124, 128, 115, 129, 124, // 5256-5263
-122, 108, 132, 137, 139, 129, 131, 143, // 5264-5271
-126, 133, 127, 150, 141, 138, 135, 123, // 5272-5279
-107, 112, 116, 132, 113, 125, 123, 133, // 5280-5287
-118, 120, 128, 123, 117, 120, 139, 137, // 5288-5295
-138, 131, 141, 130, 128, 128, 140, 146, // 5296-5303
-138, 137, 131, 112, 108, 112, 125, 122, // 5304-5311
-119, 125, 127, 126, 117, 128, 121, 124, // 5312-5319
-118, 132, 137, 136, 138, 132, 137, 124, // 5320-5327
-131, 131, 141, 142, 139, 142, 128, 107, // 5328-5335
-110, 112, 127, 115, 122, 129, 126, 124, // 5336-5343
-111, 135, 122, 126, 108, 136, 142, 135, // 5344-5351
-132, 127, 146, 120, 132, 125, 148, 145, // 5352-5359
-143, 139, 130, 105, 105, 110, 131, 119, // 5360-5367
-118, 127, 129, 129, 113, 125, 126, 124, // 5368-5375
-122, 118, 143, 134, 141, 127, 134, 130, // 5376-5383
-126, 131, 133, 148, 143, 146, 131, 113, // 5384-5391
-105, 110, 120, 123, 120, 128, 126, 127, // 5392-5399
-118, 126, 124, 121, 121, 123, 137, 136, // 5400-5407
-140, 135, 134, 130, 125, 131, 132, 140, // 5408-5415
-143, 146, 140, 127, 102, 107, 110, 126, // 5416-5423
-116, 127, 128, 127, 120, 116, 129, 124, // 5424-5431
-122, 120, 131, 139, 135, 135, 136, 138, // 5432-5439
-126, 125, 131, 139, 140, 148, 141, 141, // 5440-5447
-120,  96, 105, 115, 129, 117, 121, 131, // 5448-5455
-124, 123, 114, 132, 128, 122, 118, 121, // 5456-5463
-147, 134, 139, 131, 140, 127, 121, 131, // 5464-5471
-137, 146, 142, 142, 137, 127,  96, 103, // 5472-5479
-113, 131, 118, 118, 132, 125, 124, 112, // 5480-5487
-130, 128, 124, 122, 121, 143, 139, 136, // 5488-5495
-132, 134, 133, 119, 130, 131, 145, 143, // 5496-5503
-145, 135, 135, 110,  97, 109, 125, 126, // 5504-5511
-115, 127, 130, 123, 120, 121, 131, 127, // 5512-5519
-124, 119, 131, 142, 137, 133, 135, 135, // 5520-5527
-123, 122, 129, 139, 141, 147, 140, 136, // 5528-5535
-129,  98, 102, 114, 128, 124, 117, 135, // 5536-5543
-124, 123, 116, 126, 129, 126, 122, 123, // 5544-5551
-131, 143, 136, 137, 132, 130, 124, 122, // 5552-5559
-131, 136, 145, 147, 137, 135, 129,  99, // 5560-5567
-105, 113, 131, 121, 118, 131, 126, 123, // 5568-5575
-117, 125, 131, 127, 126, 118, 137, 138, // 5576-5583
-138, 133, 134, 133, 120, 123, 126, 141, // 5584-5591
-140, 149, 139, 134, 132, 102, 103, 112, // 5592-5599
-127, 125, 113, 130, 126, 125, 118, 126, // 5600-5607
-129, 127, 123, 122, 131, 139, 139, 137, // 5608-5615
-133, 131, 122, 120, 126, 136, 140, 145, // 5616-5623
-146, 134, 139, 117,  99, 106, 116, 132, // 5624-5631
-114, 125, 129, 128, 120, 120, 132, 126, // 5632-5639
-128, 119, 128, 134, 141, 139, 134, 130, // 5640-5647
-124, 119, 123, 130, 138, 141, 146, 141, // 5648-5655
-134, 133, 112, 101, 110, 122, 130, 114, // 5656-5663
-127, 128, 129, 117, 121, 130, 124, 129, // 5664-5671
-125, 136, 126, 140, 136, 137, 125, 119, // 5672-5679
-128, 122, 133, 130, 146, 144, 141, 132, // 5680-5687
-137, 122,  97, 106, 120, 133, 115, 121, // 5688-5695
-133, 128, 120, 115, 133, 129, 128, 123, // 5696-5703
-130, 137, 128, 130, 138, 134, 126, 114, // 5704-5711
-130, 128, 132, 135, 147, 147, 133, 131, // 5712-5719
-134, 118,  95, 110, 123, 133, 110, 125, // 5720-5727
-130, 128, 118, 120, 134, 128, 126, 123, // 5728-5735
-130, 137, 133, 137, 133, 130, 120, 122, // 5736-5743
-125, 128, 135, 138, 143, 144, 139, 132, // 5744-5751
-137, 119,  96, 107, 120, 130, 111, 126, // 5752-5759
-133, 127, 117, 120, 132, 129, 125, 126, // 5760-5767
-132, 134, 132, 136, 135, 130, 120, 121, // 5768-5775
-125, 127, 130, 137, 143, 143, 140, 131, // 5776-5783
-135, 133, 102,  99, 117, 130, 122, 111, // 5784-5791
-136, 128, 125, 113, 129, 133, 129, 125, // 5792-5799
-129, 136, 131, 130, 134, 132, 125, 118, // 5800-5807
-127, 126, 129, 129, 140, 141, 143, 134, // 5808-5815
-132, 137, 133,  99, 103, 123, 128, 118, // 5816-5823
-112, 140, 127, 125, 115, 130, 131, 126, // 5824-5831
-122, 127, 137, 134, 126, 130, 136, 129, // 5832-5839
-120, 122, 129, 132, 128, 136, 140, 151, // 5840-5847
-135, 131, 133, 139, 113,  91, 117, 126, // 5848-5855
-126, 108, 130, 137, 124, 114, 119, 137, // 5856-5863
-126, 124, 123, 139, 137, 128, 128, 130, // 5864-5871
-133, 122, 122, 128, 130, 131, 129, 141, // 5872-5879
-141, 149, 133, 132, 135, 134, 101,  97, // 5880-5887
-122, 127, 122, 107, 138, 130, 121, 114, // 5888-5895
-126, 135, 124, 124, 129, 140, 136, 123, // 5896-5903
-131, 134, 130, 116, 122, 132, 131, 129, // 5904-5911
-133, 144, 142, 141, 131, 130, 132, 132, // 5912-5919
-113,  96, 123, 120, 127, 108, 131, 133, // 5920-5927
-121, 117, 120, 138, 127, 127, 129, 139, // 5928-5935
-136, 122, 129, 133, 132, 120, 124, 133, // 5936-5943
-129, 129, 131, 142, 139, 139, 137, 130, // 5944-5951
-133, 133, 125,  96, 111, 119, 126, 112, // 5952-5959
-121, 135, 126, 121, 119, 135, 130, 126, // 5960-5967
-125, 135, 137, 129, 125, 133, 133, 125, // 5968-5975
-119, 128, 130, 129, 129, 137, 141, 139, // 5976-5983
-138, 133, 129, 131, 133, 119,  95, 117, // 5984-5991
-118, 129, 108, 128, 134, 126, 119, 122, // 5992-5999
-135, 129, 125, 128, 136, 137, 123, 126, // 6000-6007
-136, 131, 123, 121, 133, 128, 126, 129, // 6008-6015
-138, 138, 134, 141, 137, 129, 129, 133, // 6016-6023
-125,  95, 110, 121, 127, 112, 121, 140, // 6024-6031
-127, 122, 119, 133, 131, 124, 128, 134, // 6032-6039
-139, 130, 126, 131, 128, 129, 119, 130, // 6040-6047
-126, 130, 129, 133, 137, 133, 137, 138, // 6048-6055
-129, 130, 131, 137, 109,  96, 123, 122, // 6056-6063
-125, 107, 138, 135, 122, 119, 126, 136, // 6064-6071
-126, 126, 133, 135, 135, 124, 130, 126, // 6072-6079
-131, 123, 125, 128, 127, 132, 128, 136, // 6080-6087
-133, 134, 135, 137, 130, 127, 134, 137, // 6088-6095
-110,  94, 121, 125, 124, 108, 136, 138, // 6096-6103
-123, 119, 126, 138, 126, 125, 131, 136, // 6104-6111
-132, 125, 132, 134, 124, 121, 121, 132, // 6112-6119
-128, 126, 131, 135, 137, 129, 132, 141, // 6120-6127
-136, 123, 130, 136, 131,  96, 103, 125, // 6128-6135
-123, 117, 115, 143, 133, 120, 119, 133, // 6136-6143
-135, 125, 127, 135, 133, 128, 125, 134, // 6144-6151
-129, 122, 126, 126, 131, 122, 130, 134, // 6152-6159
-132, 133, 129, 137, 138, 133, 126, 133, // 6160-6167
-136, 126,  94, 108, 127, 123, 116, 121, // 6168-6175
-145, 133, 119, 123, 133, 133, 123, 127, // 6176-6183
-135, 132, 126, 127, 131, 130, 120, 129, // 6184-6191
-125, 128, 123, 129, 136, 130, 133, 131, // 6192-6199
-137, 139, 126, 128, 132, 135, 124,  90, // 6200-6207
-118, 124, 122, 115, 126, 147, 126, 119, // 6208-6215
-125, 135, 128, 122, 130, 136, 129, 127, // 6216-6223
-126, 133, 128, 122, 128, 126, 129, 124, // 6224-6231
-131, 134, 132, 133, 132, 136, 137, 131, // 6232-6239
-126, 132, 133, 131, 105, 102, 124, 121, // 6240-6247
-119, 120, 137, 139, 120, 122, 131, 130, // 6248-6255
-125, 126, 135, 132, 128, 129, 131, 129, // 6256-6263
-122, 122, 130, 127, 126, 127, 133, 133, // 6264-6271
-126, 131, 135, 137, 137, 128, 130, 136, // 6272-6279
-129, 126, 100, 113, 124, 118, 122, 123, // 6280-6287
-142, 129, 122, 126, 131, 129, 122, 130, // 6288-6295
-135, 129, 127, 129, 134, 128, 120, 123, // 6296-6303
-124, 127, 126, 129, 135, 133, 131, 131, // 6304-6311
-133, 135, 136, 132, 127, 135, 129, 129, // 6312-6319
-109, 103, 127, 118, 122, 121, 135, 137, // 6320-6327
-119, 124, 130, 129, 124, 125, 135, 132, // 6328-6335
-126, 129, 132, 131, 119, 123, 126, 128, // 6336-6343
-125, 126, 136, 132, 130, 130, 133, 136, // 6344-6351
-134, 135, 130, 131, 130, 128, 123, 104, // 6352-6359
-113, 123, 119, 124, 125, 139, 129, 122, // 6360-6367
-129, 130, 127, 125, 130, 132, 127, 127, // 6368-6375
-131, 131, 126, 123, 124, 125, 125, 126, // 6376-6383
-130, 135, 132, 131, 131, 134, 135, 135, // 6384-6391
-132, 130, 132, 128, 128, 118, 104, 118, // 6392-6399
-122, 122, 123, 130, 139, 125, 124, 130, // 6400-6407
-131, 126, 123, 131, 131, 128, 126, 131, // 6408-6415
-130, 125, 122, 125, 132, 124, 128, 132, // 6416-6423
-134, 130, 128, 135, 134, 133, 134, 130, // 6424-6431
-132, 127, 126, 126, 117, 109, 118, 123, // 6432-6439
-124, 124, 128, 136, 129, 125, 129, 129, // 6440-6447
-125, 127, 128, 131, 128, 127, 131, 129, // 6448-6455
-126, 124, 124, 128, 127, 128, 131, 133, // 6456-6463
-132, 129, 130, 133, 133, 133, 129, 131, // 6464-6471
-129, 126, 126, 122, 116, 115, 123, 123, // 6472-6479
-124, 125, 133, 131, 127, 128, 129, 128, // 6480-6487
-126, 127, 129, 129, 127, 127, 129, 129, // 6488-6495
-125, 121, 128, 129, 127, 129, 130, 134, // 6496-6503
-131, 129, 131, 133, 134, 131, 128, 129, // 6504-6511
-126, 128, 125, 122, 117, 120, 124, 124, // 6512-6519
-125, 128, 132, 130, 127, 127, 127, 127, // 6520-6527
-127, 125, 128, 130, 129, 128, 127, 128, // 6528-6535
-126, 125, 126, 127, 128, 129, 130, 132, // 6536-6543
-132, 131, 130, 129, 129, 128, 128, 127, // 6544-6551
-128, 128, 127, 126, 126, 125, 125, 125, // 6552-6559
-125, 125, 126, 125, 126, 127, 127, 127, // 6560-6567
-127, 128, 128, 128, 128, 128, 129, 129, // 6568-6575
-127, 127, 128, 128, 128, 128, 130, 130, // 6576-6583
-129, 130, 128, 129, 129, 130, 130, 130, // 6584-6591
-129, 128, 129, 128, 126, 124, 123, 123, // 6592-6599
-123, 123, 123, 124, 125, 126, 128, 127, // 6600-6607
-127, 128, 129, 130, 130, 129, 129, 128, // 6608-6615
-128, 127, 127, 128, 128, 129, 129, 130, // 6616-6623
-129, 129, 129, 129, 130, 130, 131, 130, // 6624-6631
-130, 129, 128, 128, 127, 124, 122, 123, // 6632-6639
-123, 122, 123, 123, 125, 127, 127, 128, // 6640-6647
-128, 129, 130, 129, 129, 128, 128, 128, // 6648-6655
-128, 128, 128, 129, 128, 127, 128, 129, // 6656-6663
-129, 128, 129, 130, 130, 130, 130, 131, // 6664-6671
-130, 129, 128, 128, 126, 125, 124, 123, // 6672-6679
-122, 123, 123, 123, 123, 125, 126, 128, // 6680-6687
-129, 129, 130, 129, 129, 129, 128, 129, // 6688-6695
-129, 128, 128, 127, 128, 127, 127, 128, // 6696-6703
-128, 129, 130, 130, 130, 130, 131, 131, // 6704-6711
-130, 130, 128, 127, 128, 126, 126, 124, // 6712-6719
-123, 122, 122, 123, 124, 125, 126, 127, // 6720-6727
-128, 129, 128, 128, 129, 129, 129, 128, // 6728-6735
-128, 128, 128, 127, 127, 127, 128, 127, // 6736-6743
-128, 130, 130, 130, 130, 131, 131, 130, // 6744-6751
-130, 130, 129, 129, 127, 126, 126, 124, // 6752-6759
-124, 123, 123, 124, 124, 124, 125, 126, // 6760-6767
-127, 128, 128, 128, 128, 128, 128, 128, // 6768-6775
-127, 127, 128, 128, 127, 127, 128, 128, // 6776-6783
-129, 129, 130, 130, 130, 130, 130, 130, // 6784-6791
-130, 129, 129, 128, 128, 127, 126, 125, // 6792-6799
-124, 125, 124, 124, 124, 124, 125, 126, // 6800-6807
-126, 126, 127, 127, 128, 129, 128, 128, // 6808-6815
-127, 128, 128, 128, 127, 128, 128, 128, // 6816-6823
-129, 129, 129, 129, 130, 130, 130, 130, // 6824-6831
-130, 130, 130, 129, 129, 127, 126, 126, // 6832-6839
-125, 125, 125, 125, 125, 124, 125, 125, // 6840-6847
-125, 126, 127, 127, 128, 128, 128, 128, // 6848-6855
-128, 127, 127, 128, 128, 128, 128, 129, // 6856-6863
-128, 128, 129, 129, 129, 130, 130, 130, // 6864-6871
-131, 130, 130, 129, 129, 129, 128, 127, // 6872-6879
-126, 126, 125, 125, 124, 124, 124, 125, // 6880-6887
-126, 126, 127, 127, 127, 127, 128, 127, // 6888-6895
-127, 127, 128, 128, 128, 128, 128, 128, // 6896-6903
-128, 128, 129, 129, 129, 129, 130, 130, // 6904-6911
-130, 129, 129, 129, 129, 129, 128, 127, // 6912-6919
-126, 126, 125, 125, 125, 125, 125, 125, // 6920-6927
-126, 126, 126, 127, 127, 127, 128, 128, // 6928-6935
-128, 128, 128, 128, 128, 128, 128, 128, // 6936-6943
-127, 128, 128, 129, 129, 130, 130, 130, // 6944-6951
-130, 129, 129, 129, 128, 128, 128, 128, // 6952-6959
-127, 127, 126, 126, 126, 125, 125, 126, // 6960-6967
-126, 126, 127, 127, 127, 127, 127, 127, // 6968-6975
-128, 128, 128, 128, 128, 128, 128, 127, // 6976-6983
-128, 128, 128, 128, 128, 128, 129, 129, // 6984-6991
-128, 129, 129, 129, 128, 128, 128, 128, // 6992-6999
-127, 127, 127, 127, 126, 126, 126, 127, // 7000-7007
-127, 127, 127, 127, 127, 127, 127, 127, // 7008-7015
-127, 128, 128, 127, 127, 127, 127, 127, // 7016-7023
-127, 128, 128, 127, 128, 128, 128, 128, // 7024-7031
-128, 128, 129, 128, 128, 128, 128, 128, // 7032-7039
-127, 128, 127, 127, 127, 127, 127, 127, // 7040-7047
-127, 127, 127, 127, 127, 127, 127, 127, // 7048-7055
-127, 127, 127, 127, 127, 127, 127, 127, // 7056-7063
-128, 128, 128, 128, 128, 128, 128, 128, // 7064-7071
-128, 128, 128, 128, 128, 128, 128, 128, // 7072-7079
-127, 128, 128, 128, 128, 127, 128, 128, // 7080-7087
-128, 128, 127, 127, 127, 127, 127, 127, // 7088-7095
-127, 127, 127, 127, 127, 127, 127, 127, // 7096-7103
-128, 128, 128, 128, 128, 128, 128, 128, // 7104-7111
-127, 127, 128, 128, 128, 128, 128, 128, // 7112-7119
-128, 128, 128, 128, 128, 128, 128, 128, // 7120-7127
-128, 128, 127, 127, 127, 127, 127, 127, // 7128-7135
-127, 127, 127, 127, 127, 127, 127, 127, // 7136-7143
-127, 128, 128, 127, 127, 127, 127, 127, // 7144-7151
-127, 127, 127, 127, 127, 128, 128, 128, // 7152-7159
-128, 128, 128, 128, 128, 128, 128, 128, // 7160-7167
-128, 128, 128, 128, 128, 128, 127, 127, // 7168-7175
-127, 128, 127, 128, 128, 127, 128, 128, // 7176-7183
-128, 127, 127, 127, 127, 127, 127, 127, // 7184-7191
-127, 127, 127, 127, 127, 127, 127, 127, // 7192-7199
-128, 127, 127, 127, 127, 127, 127, 128, // 7200-7207
-128, 127, 127, 128, 128, 128, 128, 128, // 7208-7215
-128, 128, 128, 128, 128, 128, 128, 128, // 7216-7223
-128, 127, 127, 127, 127, 127, 127, 128, // 7224-7231
-127, 127, 127, 127, 127, 127, 127, 127, // 7232-7239
-127, 127, 127, 127, 127, 127, 127, 127, // 7240-7247
-127, 128, 128, 128, 128, 128, 128, 128, // 7248-7255
-128, 128, 128, 128, 128, 128, 128, 128, // 7256-7263
-128, 128, 128, 128, 128, 128, 128, 127, // 7264-7271
-128, 128, 127, 127, 127, 127, 127, 127, // 7272-7279
-127, 127, 127, 127, 127, 127, 127, 127, // 7280-7287
-127, 127, 128, 127, 127, 127, 127, 128, // 7288-7295
-127, 127, 127, 127, 128, 128, 127, 128, // 7296-7303
-128, 128, 128, 128, 128, 128, 128, 128, // 7304-7311
-128, 128, 128, 128, 127, 127, 127, 127, // 7312-7319
-127, 128, 128, 127, 127, 127, 128, 128, // 7320-7327
-128, 128, 127, 127, 128, 127, 127, 127, // 7328-7335
-127, 127, 127, 127, 128, 127, 127, 127, // 7336-7343
-128, 128, 127, 128, 128, 128, 128, 128, // 7344-7351
-127, 127, 128, 128, 128, 127, 127, 128, // 7352-7359
-128, 128, 128, 128, 128, 128, 128, 128, // 7360-7367
-128, 128, 127, 127, 127, 127, 127, 127, // 7368-7375
-127, 128, 128, 127, 127, 128, 128, 127, // 7376-7383
-127, 128, 128, 127, 127, 128, 128, 127, // 7384-7391
-127, 127, 128, 128, 127, 128, 128, 128, // 7392-7399
-128, 128, 128, 127, 127, 128, 128, 128, // 7400-7407
-127, 127, 127, 127, 127, 128, 128, 127, // 7408-7415
-127, 127, 128, 128, 127, 127, 127, 127, // 7416-7423
-127, 128, 127, 127, 127, 128, 128, 127, // 7424-7431
-127, 127, 128, 128, 128, 128, 128, 128, // 7432-7439
-128, 128, 128, 128, 127, 128, 128, 128, // 7440-7447
-128, 128, 128, 127, 127, 128, 128, 127, // 7448-7455
-127, 127, 127, 127, 127, 127, 127, 127, // 7456-7463
-127, 127, 127, 127, 127, 127, 127, 127, // 7464-7471
-127, 128, 127, 127, 128, 128, 128, 128, // 7472-7479
-128, 128, 128, 128, 128, 128, 128, 128, // 7480-7487
-128, 128, 128, 127, 128, 128, 128, 128, // 7488-7495
-128, 128, 128, 127, 127, 127, 127, 127, // 7496-7503
-127, 127, 127, 127, 127, 127, 127, 127, // 7504-7511
-127, 127, 127, 127, 127, 127, 127, 127, // 7512-7519
-127, 127, 127, 127, 127, 127, 128, 128, // 7520-7527
-128, 128, 128, 128, 128, 128, 128, 128, // 7528-7535
-128, 128, 127, 128, 128, 128, 128, 128, // 7536-7543
-128, 128, 128, 128, 127, 127, 128, 128, // 7544-7551
-128, 128, 128, 128, 127, 128, 127, 127, // 7552-7559
-127, 127, 128, 128, 128, 127, 128, 127, // 7560-7567
-128, 127, 128, 127, 127, 127, 128, 128, // 7568-7575
-127, 127, 127, 128, 127, 128, 128, 128, // 7576-7583
-127, 127, 128, 128, 127, 127, 128, 128, // 7584-7591
-128, 128, 128, 127, 127, 127, 127, 128, // 7592-7599
-127, 127, 128, 128, 128, 128, 127, 127, // 7600-7607
-127, 127, 128, 128, 128, 128, 127, 127, // 7608-7615
-127, 128, 128, 127, 128, 128, 128, 128, // 7616-7623
-128, 128, 128, 128, 127, 128, 127, 128, // 7624-7631
-127, 128, 127, 128, 127, 127, 128, 127, // 7632-7639
-128, 127, 127, 127, 128, 128, 128, 127, // 7640-7647
-127, 128, 127, 128, 128, 127, 127, 127, // 7648-7655
-128, 127, 128, 126, 129, 127, 128, 127, // 7656-7663
-128, 127, 127, 128, 127, 128, 127, 128, // 7664-7671
-127, 128, 127, 128, 127, 127, 127, 128, // 7672-7679
-128, 128, 127, 127, 127, 127, 127, 128, // 7680-7687
-128, 128, 128, 128, 127, 128, 127, 128, // 7688-7695
-127, 128, 128, 128, 128, 128, 128, 128, // 7696-7703
-127, 128, 127, 128, 127, 128, 127, 128, // 7704-7711
-127, 127, 127, 128, 127, 127, 127, 128, // 7712-7719
-127, 127, 127, 127, 127, 127, 128, 127, // 7720-7727
-128, 127, 128, 127, 128, 127, 128, 127, // 7728-7735
-128, 127, 128, 127, 128, 127, 128, 127, // 7736-7743
-128, 127, 128, 127, 128, 127, 128, 128, // 7744-7751
-128, 128, 128, 127, 127, 127, 128, 127, // 7752-7759
-128, 127, 128, 128, 128, 127, 127, 128, // 7760-7767
-128, 127, 127, 127, 128, 127, 128, 127, // 7768-7775
-128, 127, 129, 126, 128, 127, 128, 125, // 7776-7783
-128, 129, 129, 126, 124, 131, 128, 127, // 7784-7791
-124, 131, 128, 126, 125, 132, 129, 125, // 7792-7799
-125, 130, 130, 126, 125, 129, 129, 126, // 7800-7807
-127, 129, 128, 126, 126, 129, 128, 127, // 7808-7815
-126, 128, 128, 128, 127, 128, 128, 127, // 7816-7823
-127, 128, 128, 128, 127, 127, 128, 127, // 7824-7831
-127, 127, 128, 127, 127, 127, 128, 128, // 7832-7839
-127, 127, 128, 127, 128, 128, 128, 127, // 7840-7847
-128, 128, 128, 127, 128, 127, 127, 127, // 7848-7855
-128, 128, 127, 127, 128, 128, 127, 127, // 7856-7863
-128, 128, 127, 127, 128, 128, 127, 127, // 7864-7871
-128, 128, 127, 127, 128, 128, 128, 127, // 7872-7879
-127, 127, 128, 127, 127, 128, 128, 128, // 7880-7887
-127, 128, 127, 128, 127, 128, 128, 128, // 7888-7895
-128, 127, 128, 128, 128, 127, 127, 128, // 7896-7903
-128, 127, 127, 127, 128, 127, 127, 127, // 7904-7911
-130, 127, 125, 127, 129, 128, 125, 127, // 7912-7919
-128, 129, 126, 126, 128, 129, 127, 126, // 7920-7927
-127, 128, 128, 127, 127, 128, 128, 129, // 7928-7935
-128, 127, 127, 128, 128, 128, 127, 127, // 7936-7943
-128, 128, 127, 127, 128, 128, 128, 127, // 7944-7951
-128, 127, 128, 127, 128, 127, 127, 127, // 7952-7959
-127, 127, 127, 127, 128, 127, 127, 127, // 7960-7967
-128, 127, 128, 127, 128, 128, 128, 128, // 7968-7975
-127, 127, 128, 128, 127, 127, 128, 129, // 7976-7983
-127, 127, 127, 128, 128, 128, 127, 127, // 7984-7991
-127, 128, 128, 127, 127, 127, 128, 127, // 7992-7999
-127, 127, 127, 127, 127, 127, 127, 127, // 8000-8007
-127, 127, 127, 128, 127, 128, 127, 127, // 8008-8015
-127, 128, 128, 128, 128, 128, 128, 128, // 8016-8023
-128, 128, 128, 128, 128, 128, 128, 128, // 8024-8031
-128, 128, 128, 128, 127, 127, 127, 128, // 8032-8039
-127, 128, 127, 128, 128, 128, 127, 127, // 8040-8047
-127, 127, 128, 127, 127, 128, 127, 127, // 8048-8055
-127, 128, 128, 127, 126, 128, 129, 127, // 8056-8063
-127, 127, 129, 128, 128, 127, 128, 128, // 8064-8071
-128, 128, 127, 127, 128, 128, 128, 127, // 8072-8079
-128, 128, 128, 127, 127, 127, 127, 128, // 8080-8087
-128, 128, 127, 127, 128, 128, 128, 127, // 8088-8095
-127, 127, 127, 128, 127, 128, 128, 127, // 8096-8103
-128, 128, 128, 127, 127, 128, 128, 128, // 8104-8111
-128, 128, 128, 128, 128, 127, 127, 128, // 8112-8119
-128, 127, 127, 127, 128, 128, 127, 128, // 8120-8127
-127, 127, 127, 127, 128, 127, 127, 128, // 8128-8135
-128, 127, 127, 127, 128, 128, 127, 127, // 8136-8143
-128, 128, 128, 128, 128, 128, 128, 128, // 8144-8151
-127, 128, 128, 128, 127, 127, 128, 128, // 8152-8159
-128, 127, 127, 128, 127, 128, 127, 127, // 8160-8167
-127, 127, 127, 128, 128, 127, 127, 127, // 8168-8175
-127, 128, 128, 127, 127, 127, 128, 128, // 8176-8183
-128, 128, 127, 128, 128, 128, 128, 128, // 8184-8191
-127, 128, 128, 128, 128, 128, 128, 128, // 8192-8199
-127, 127, 128, 128, 127, 127, 127, 128, // 8200-8207
-128, 127, 127, 128, 128, 127, 127, 127, // 8208-8215
-128, 128, 127, 127, 127, 127, 127, 127, // 8216-8223
-127, 127, 128, 127, 127, 127, 128, 128, // 8224-8231
-128, 127, 128, 128, 128, 128, 127, 127, // 8232-8239
-128, 128, 128, 127, 127, 128, 128, 127, // 8240-8247
-127, 127, 127, 128, 127, 127, 127, 128, // 8248-8255
-128, 128, 127, 127, 128, 128, 127, 127, // 8256-8263
-127, 128, 128, 128, 128, 127, 128, 128, // 8264-8271
-128, 127, 128, 128, 128, 128, 128, 128, // 8272-8279
-127, 128, 128, 128, 128, 128, 128, 128, // 8280-8287
-128, 128, 128, 127, 127, 127, 127, 127, // 8288-8295
-127, 127, 128, 128, 127, 127, 127, 127, // 8296-8303
-127, 127, 127, 127, 128, 128, 127, 127, // 8304-8311
-127, 128, 128, 127, 127, 127, 128, 128, // 8312-8319
-128, 128, 128, 128, 127, 128, 127, 128, // 8320-8327
-128, 128, 127, 128, 128, 128, 128, 128, // 8328-8335
-127, 128, 128, 128, 128, 127, 128, 127, // 8336-8343
-127, 128, 127, 128, 127, 127, 127, 128, // 8344-8351
-128, 127, 128, 127, 127, 127, 128, 127, // 8352-8359
-128, 127, 128, 127, 127, 127, 128, 128, // 8360-8367
-128, 128, 127, 127, 127, 128, 128, 128, // 8368-8375
-127, 127, 127, 128, 128, 128, 127, 128, // 8376-8383
-128, 128, 127, 128, 127, 127, 127, 128, // 8384-8391
-128, 128, 127, 127, 127, 128, 128, 128, // 8392-8399
-127, 127, 127, 127, 127, 128, 128, 127, // 8400-8407
-127, 127, 127, 128, 128, 128, 127, 127, // 8408-8415
-127, 128, 128, 128, 128, 128, 128, 128, // 8416-8423
-128, 127, 127, 127, 128, 128, 128, 128, // 8424-8431
-127, 127, 127, 128, 128, 128, 128, 127, // 8432-8439
-127, 127, 128, 128, 128, 127, 127, 127, // 8440-8447
-127, 128, 128, 128, 127, 127, 127, 127, // 8448-8455
-128, 128, 128, 127, 127, 127, 127, 127, // 8456-8463
-127, 127, 128, 128, 128, 128, 128, 128, // 8464-8471
-128, 127, 128, 128, 128, 128, 128, 128, // 8472-8479
-128, 128, 128, 128, 128, 128, 127, 127, // 8480-8487
-127, 128, 128, 128, 128, 127, 127, 127, // 8488-8495
-128, 127, 127, 127, 127, 127, 128, 128, // 8496-8503
-127, 127, 127, 127, 127, 127, 127, 127, // 8504-8511
-127, 127, 127, 128, 128, 127, 128, 128, // 8512-8519
-128, 127, 128, 128, 128, 128, 127, 128, // 8520-8527
-128, 128, 128, 128, 127, 127, 128, 128, // 8528-8535
-128, 128, 128, 128, 127, 128, 128, 128, // 8536-8543
-127, 127, 127, 127, 128, 127, 128, 127, // 8544-8551
-128, 127, 127, 127, 127, 127, 127, 128, // 8552-8559
-128, 128, 127, 127, 127, 127, 127, 128, // 8560-8567
-128, 128, 127, 127, 127, 128, 128, 128, // 8568-8575
-128, 127, 128, 128, 128, 128, 127, 127, // 8576-8583
-127, 128, 128, 127, 127, 127, 128, 128, // 8584-8591
-128, 127, 127, 127, 128, 127, 128, 127, // 8592-8599
-127, 127, 127, 127, 128, 127, 127, 128, // 8600-8607
-128, 127, 127, 128, 127, 128, 127, 128, // 8608-8615
-128, 128, 128, 128, 128, 128, 127, 127, // 8616-8623
-127, 128, 128, 128, 128, 128, 128, 127, // 8624-8631
-127, 128, 128, 127, 127, 128, 127, 128, // 8632-8639
-127, 127, 127, 127, 127, 128, 128, 127, // 8640-8647
-127, 127, 127, 128, 128, 127, 127, 127, // 8648-8655
-128, 128, 127, 128, 128, 127, 128, 127, // 8656-8663
-128, 127, 128, 128, 128, 127, 127, 127, // 8664-8671
-127, 128, 128, 128, 128, 127, 127, 127, // 8672-8679
-128, 127, 128, 127, 127, 127, 128, 128, // 8680-8687
-128, 128, 127, 127, 128, 128, 128, 128, // 8688-8695
-127, 127, 127, 128, 128, 128, 127, 127, // 8696-8703
-127, 128, 128, 128, 128, 127, 127, 127, // 8704-8711
-127, 128, 128, 128, 127, 127, 128, 128, // 8712-8719
-127, 127, 128, 128, 128, 128, 128, 128, // 8720-8727
-127, 127, 128, 128, 128, 128, 127, 127, // 8728-8735
-127, 128, 128, 128, 128, 127, 127, 127, // 8736-8743
-127, 128, 128, 128, 127, 127, 127, 128, // 8744-8751
-127, 128, 127, 128, 128, 128, 127, 127, // 8752-8759
-127, 128, 128, 128, 128, 127, 127, 127, // 8760-8767
-127, 128, 128, 128, 128, 127, 127, 128, // 8768-8775
-128, 128, 128, 127, 128, 127, 128, 127, // 8776-8783
-128, 127, 127, 127, 128, 128, 128, 127, // 8784-8791
-127, 127, 127, 128, 127, 127, 127, 128, // 8792-8799
-127, 127, 127, 127, 128, 127, 127, 127, // 8800-8807
-128, 127, 128, 127, 128, 128, 128, 128, // 8808-8815
-127, 127, 127, 128, 128, 128, 128, 128, // 8816-8823
-128, 128, 128, 128, 127, 128, 127, 128, // 8824-8831
-128, 128, 128, 128, 128, 128, 127, 127, // 8832-8839
-127, 127, 128, 128, 128, 127, 127, 127, // 8840-8847
-127, 127, 127, 127, 127, 128, 128, 128, // 8848-8855
-128, 127, 127, 127, 127, 127, 128, 128, // 8856-8863
-128, 128, 128, 127, 127, 127, 128, 128, // 8864-8871
-128, 128, 128, 128, 127, 127, 127, 128, // 8872-8879
-128, 128, 127, 127, 127, 127, 127, 127, // 8880-8887
-127, 127, 127, 127, 127, 127, 127, 127, // 8888-8895
-127, 127, 127, 127, 127, 128, 128, 128, // 8896-8903
-128, 128, 128, 127, 128, 128, 128, 128, // 8904-8911
-128, 128, 128, 128, 128, 128, 128, 128, // 8912-8919
-128, 128, 128, 128, 127, 127, 127, 127, // 8920-8927
-127, 127, 127, 127, 127, 127, 127, 127, // 8928-8935
-127, 127, 127, 127, 127, 127, 127, 127, // 8936-8943
-127, 127, 127, 127, 127, 127, 127, 128, // 8944-8951
-128, 128, 128, 128, 128, 128, 128, 128, // 8952-8959
-128, 128, 128, 128, 128, 128, 128, 128, // 8960-8967
-128, 128, 128, 128, 128, 128, 127, 127, // 8968-8975
-127, 127, 127, 127, 127, 127, 127, 127, // 8976-8983
-127, 127, 127, 127, 127, 127, 127, 127, // 8984-8991
-127, 127, 127, 127, 127, 127, 128, 128, // 8992-8999
-128, 128, 127, 128, 128, 128, 128, 128, // 9000-9007
-128, 128, 128, 128, 128, 128, 128, 128, // 9008-9015
-128, 128, 128, 128, 127, 128, 127, 127, // 9016-9023
-127, 127, 127, 127, 127, 127, 127, 127, // 9024-9031
-127, 127, 127, 127, 127, 127, 127, 127, // 9032-9039
-127, 127, 127, 127, 128, 128, 128, 128, // 9040-9047
-128, 128, 128, 128, 128, 128, 128, 129, // 9048-9055
-129, 129, 128, 128, 128, 128, 128, 128, // 9056-9063
-128, 128, 128, 128, 128, 127, 127, 127, // 9064-9071
-127, 127, 127, 127, 126, 126, 126, 126, // 9072-9079
-127, 126, 126, 126, 126, 126, 127, 127, // 9080-9087
-127, 127, 127, 127, 128, 128, 128, 128, // 9088-9095
-128, 128, 128, 128, 128, 129, 129, 129, // 9096-9103
-129, 129, 129, 129, 129, 128, 128, 128, // 9104-9111
-128, 128, 128, 127, 127, 127, 127, 126, // 9112-9119
-126, 126, 126, 126, 126, 126, 126, 126, // 9120-9127
-126, 126, 126, 126, 126, 126, 126, 127, // 9128-9135
-127, 127, 127, 128, 128, 128, 128, 129, // 9136-9143
-129, 129, 129, 129, 129, 129, 129, 129, // 9144-9151
-129, 129, 129, 129, 129, 129, 129, 128, // 9152-9159
-128, 128, 128, 127, 127, 127, 127, 126, // 9160-9167
-126, 126, 126, 126, 127, 127, 126, 126, // 9168-9175
-126, 125, 125, 125, 125, 125, 126, 126, // 9176-9183
-127, 127, 128, 128, 128, 128, 129, 129, // 9184-9191
-129, 128, 128, 128, 129, 129, 129, 129, // 9192-9199
-129, 130, 130, 130, 130, 129, 129, 129, // 9200-9207
-128, 128, 127, 127, 127, 127, 127, 126, // 9208-9215
-126, 127, 127, 127, 127, 127, 127, 126, // 9216-9223
-126, 126, 125, 125, 125, 125, 125, 126, // 9224-9231
-127, 128, 128, 129, 129, 129, 129, 129, // 9232-9239
-129, 129, 128, 128, 128, 128, 128, 128, // 9240-9247
-128, 129, 130, 130, 130, 130, 130, 129, // 9248-9255
-129, 127, 127, 126, 126, 126, 126, 126, // 9256-9263
-126, 127, 127, 127, 128, 128, 128, 127, // 9264-9271
-127, 126, 124, 123, 123, 123, 123, 125, // 9272-9279
-126, 127, 128, 129, 129, 129, 129, 129, // 9280-9287
-130, 129, 129, 128, 127, 127, 127, 127, // 9288-9295
-128, 129, 131, 132, 132, 132, 132, 131, // 9296-9303
-130, 129, 128, 127, 127, 127, 127, 126, // 9304-9311
-126, 126, 127, 127, 128, 128, 129, 129, // 9312-9319
-128, 126, 124, 122, 121, 121, 121, 123, // 9320-9327
-124, 126, 127, 128, 128, 129, 129, 129, // 9328-9335
-130, 130, 130, 129, 128, 126, 126, 126, // 9336-9343
-127, 128, 130, 132, 133, 133, 133, 132, // 9344-9351
-131, 130, 129, 129, 128, 127, 127, 126, // 9352-9359
-126, 126, 126, 126, 127, 127, 128, 128, // 9360-9367
-128, 127, 126, 123, 121, 120, 120, 121, // 9368-9375
-123, 125, 127, 128, 128, 128, 129, 129, // 9376-9383
-130, 131, 131, 130, 129, 127, 126, 125, // 9384-9391
-125, 127, 129, 131, 132, 132, 132, 132, // 9392-9399
-132, 131, 131, 130, 129, 128, 127, 126, // 9400-9407
-126, 125, 125, 126, 127, 128, 128, 128, // 9408-9415
-128, 127, 125, 123, 120, 119, 119, 120, // 9416-9423
-122, 124, 126, 127, 128, 128, 129, 130, // 9424-9431
-132, 132, 132, 130, 129, 127, 126, 125, // 9432-9439
-126, 127, 129, 131, 132, 132, 133, 132, // 9440-9447
-132, 132, 131, 130, 129, 128, 127, 126, // 9448-9455
-126, 126, 126, 126, 127, 128, 128, 128, // 9456-9463
-127, 124, 121, 119, 118, 118, 120, 122, // 9464-9471
-125, 127, 128, 128, 129, 130, 131, 133, // 9472-9479
-133, 133, 131, 128, 126, 125, 125, 127, // 9480-9487
-128, 130, 131, 132, 132, 133, 133, 133, // 9488-9495
-132, 132, 130, 129, 128, 127, 126, 126, // 9496-9503
-126, 126, 126, 126, 127, 127, 127, 125, // 9504-9511
-122, 119, 117, 117, 118, 121, 123, 125, // 9512-9519
-126, 127, 128, 130, 132, 134, 134, 133, // 9520-9527
-131, 128, 127, 126, 126, 127, 128, 129, // 9528-9535
-130, 131, 132, 134, 134, 134, 134, 132, // 9536-9543
-131, 130, 129, 128, 128, 127, 126, 126, // 9544-9551
-125, 126, 127, 127, 125, 122, 118, 115, // 9552-9559
-115, 117, 120, 123, 124, 124, 125, 127, // 9560-9567
-130, 134, 135, 135, 133, 131, 129, 128, // 9568-9575
-128, 127, 126, 126, 127, 129, 131, 133, // 9576-9583
-134, 135, 135, 135, 134, 132, 131, 130, // 9584-9591
-129, 128, 127, 127, 125, 125, 126, 126, // 9592-9599
-125, 122, 118, 115, 115, 116, 118, 119, // 9600-9607
-121, 123, 126, 129, 132, 134, 134, 134, // 9608-9615
-133, 133, 131, 129, 127, 125, 125, 126, // 9616-9623
-128, 130, 131, 132, 134, 135, 136, 136, // 9624-9631
-135, 133, 132, 131, 130, 128, 127, 126, // 9632-9639
-126, 126, 126, 125, 122, 119, 116, 115, // 9640-9647
-116, 117, 117, 118, 121, 125, 129, 131, // 9648-9655
-132, 132, 133, 134, 133, 132, 129, 127, // 9656-9663
-126, 126, 126, 127, 128, 130, 133, 135, // 9664-9671
-137, 137, 136, 135, 135, 134, 132, 130, // 9672-9679
-129, 128, 127, 126, 126, 125, 124, 119, // 9680-9687
-115, 114, 115, 114, 113, 114, 118, 123, // 9688-9695
-126, 128, 130, 133, 134, 134, 132, 132, // 9696-9703
-130, 129, 126, 125, 127, 127, 129, 131, // 9704-9711
-133, 136, 138, 139, 139, 138, 137, 136, // 9712-9719
-134, 132, 130, 129, 127, 125, 124, 124, // 9720-9727
-119, 114, 114, 113, 111, 109, 111, 117, // 9728-9735
-120, 123, 127, 132, 134, 134, 133, 136, // 9736-9743
-134, 130, 129, 129, 127, 126, 126, 128, // 9744-9751
-130, 131, 134, 138, 138, 139, 139, 139, // 9752-9759
-137, 134, 134, 132, 128, 126, 126, 125, // 9760-9767
-123, 116, 114, 115, 110, 108, 112, 114, // 9768-9775
-115, 118, 124, 129, 129, 132, 135, 136, // 9776-9783
-134, 133, 133, 129, 128, 127, 126, 127, // 9784-9791
-128, 131, 133, 135, 139, 140, 141, 142, // 9792-9799
-138, 137, 138, 132, 129, 129, 125, 124, // 9800-9807
-121, 113, 116, 111, 105, 112, 110, 110, // 9808-9815
-118, 119, 123, 130, 129, 133, 137, 132, // 9816-9823
-137, 134, 132, 132, 127, 127, 128, 124, // 9824-9831
-129, 130, 132, 137, 137, 141, 143, 138, // 9832-9839
-141, 138, 133, 133, 131, 126, 128, 119, // 9840-9847
-114, 119, 103, 109, 110, 102, 117, 116, // 9848-9855
-115, 132, 125, 129, 140, 128, 140, 138, // 9856-9863
-131, 140, 130, 129, 131, 122, 129, 127, // 9864-9871
-126, 135, 130, 139, 140, 135, 143, 135, // 9872-9879
-137, 136, 130, 132, 127, 118, 122, 109, // 9880-9887
-106, 112,  99, 112, 113, 114, 127, 125, // 9888-9895
-129, 137, 132, 137, 138, 133, 138, 135, // 9896-9903
-131, 131, 125, 128, 127, 126, 133, 133, // 9904-9911
-135, 140, 137, 138, 139, 134, 136, 131, // 9912-9919
-132, 128, 119, 126, 103, 114, 105, 100, // 9920-9927
-114, 105, 117, 121, 125, 127, 137, 131, // 9928-9935
-136, 139, 134, 140, 134, 134, 133, 127, // 9936-9943
-130, 126, 128, 134, 132, 139, 141, 138, // 9944-9951
-143, 137, 139, 133, 134, 130, 117, 132, // 9952-9959
- 99, 119, 103,  98, 111, 102, 114, 116, // 9960-9967
-126, 121, 140, 128, 139, 138, 135, 142, // 9968-9975
-135, 137, 133, 130, 130, 129, 126, 133, // 9976-9983
-131, 135, 139, 137, 139, 141, 133, 139, // 9984-9991
-133, 127, 125, 120, 108, 113, 102, 102, // 9992-9999
-107, 104, 113, 119, 123, 128, 137, 131, // 10000-10007
-142, 135, 140, 138, 137, 136, 133, 130, // 10008-10015
-129, 127, 128, 131, 131, 136, 139, 137, // 10016-10023
-141, 137, 137, 135, 132, 122, 130, 106, // 10024-10031
-117, 103, 106, 103, 108, 107, 118, 120, // 10032-10039
-123, 136, 130, 139, 137, 138, 139, 138, // 10040-10047
-136, 136, 131, 130, 130, 127, 133, 131, // 10048-10055
-135, 137, 137, 138, 137, 137, 135, 132, // 10056-10063
-123, 128, 106, 121,  99, 110, 103, 107, // 10064-10071
-107, 118, 117, 125, 133, 130, 140, 135, // 10072-10079
-139, 138, 139, 137, 136, 132, 133, 130, // 10080-10087
-131, 133, 131, 140, 133, 141, 136, 137, // 10088-10095
-136, 133, 123, 129, 110, 115, 108, 102, // 10096-10103
-106, 105, 106, 112, 119, 119, 131, 132, // 10104-10111
-136, 140, 139, 139, 142, 136, 139, 133, // 10112-10119
-132, 131, 129, 132, 132, 135, 138, 136, // 10120-10127
-137, 137, 134, 137, 123, 129, 116, 109, // 10128-10135
-113,  98, 108, 104, 109, 109, 120, 118, // 10136-10143
-130, 132, 135, 138, 139, 140, 141, 139, // 10144-10151
-140, 134, 134, 132, 130, 133, 134, 134, // 10152-10159
-139, 137, 138, 136, 135, 134, 124, 129, // 10160-10167
-112, 113, 107, 103, 102, 105, 105, 110, // 10168-10175
-117, 119, 128, 133, 135, 140, 140, 140, // 10176-10183
-141, 140, 140, 135, 136, 132, 131, 131, // 10184-10191
-135, 131, 141, 134, 141, 134, 140, 126, // 10192-10199
-133, 120, 113, 112, 103, 103, 104, 104, // 10200-10207
-106, 113, 115, 123, 130, 135, 138, 142, // 10208-10215
-140, 142, 140, 142, 136, 137, 133, 132, // 10216-10223
-132, 136, 132, 139, 135, 138, 133, 140, // 10224-10231
-130, 130, 126, 113, 113, 106, 103, 103, // 10232-10239
-107, 104, 113, 113, 124, 126, 135, 135, // 10240-10247
-138, 140, 140, 139, 142, 136, 137, 133, // 10248-10255
-133, 132, 136, 134, 138, 138, 138, 137, // 10256-10263
-139, 129, 133, 124, 113, 117,  98, 109, // 10264-10271
- 97, 108, 102, 115, 112, 124, 124, 136, // 10272-10279
-133, 140, 138, 140, 139, 142, 136, 139, // 10280-10287
-132, 134, 132, 136, 135, 140, 138, 142, // 10288-10295
-136, 141, 130, 133, 122, 114, 112, 102, // 10296-10303
-104,  99, 105, 103, 111, 114, 122, 125, // 10304-10311
-136, 133, 143, 136, 143, 138, 143, 137, // 10312-10319
-138, 132, 135, 130, 138, 133, 142, 137, // 10320-10327
-143, 136, 142, 129, 134, 119, 116, 107, // 10328-10335
-105,  99, 105, 101, 108, 109, 117, 119, // 10336-10343
-131, 130, 140, 137, 141, 140, 139, 141, // 10344-10351
-136, 138, 134, 132, 134, 135, 135, 142, // 10352-10359
-137, 141, 138, 138, 129, 134, 112, 120, // 10360-10367
-103, 106, 100, 106, 102, 114, 108, 122, // 10368-10375
-119, 134, 130, 139, 136, 139, 137, 140, // 10376-10383
-136, 138, 133, 135, 131, 136, 135, 139, // 10384-10391
-140, 142, 138, 142, 130, 136, 124, 117, // 10392-10399
-114, 103, 106, 101, 105, 105, 111, 114, // 10400-10407
-121, 123, 135, 130, 141, 135, 140, 138, // 10408-10415
-139, 136, 137, 133, 135, 131, 137, 135, // 10416-10423
-140, 140, 140, 142, 136, 134, 131, 117, // 10424-10431
-121, 103, 108, 100, 104, 104, 110, 111, // 10432-10439
-119, 121, 131, 132, 136, 139, 137, 141, // 10440-10447
-137, 139, 135, 135, 133, 133, 133, 137, // 10448-10455
-136, 144, 136, 145, 133, 136, 130, 120, // 10456-10463
-120, 107, 108, 102, 105, 105, 108, 111, // 10464-10471
-117, 119, 130, 129, 137, 136, 138, 140, // 10472-10479
-138, 140, 136, 136, 134, 133, 134, 137, // 10480-10487
-135, 143, 135, 144, 133, 134, 131, 119, // 10488-10495
-121, 107, 110, 103, 108, 106, 111, 112, // 10496-10503
-119, 120, 130, 128, 136, 135, 136, 140, // 10504-10511
-135, 140, 134, 137, 133, 134, 134, 137, // 10512-10519
-137, 143, 135, 146, 130, 140, 126, 122, // 10520-10527
-119, 108, 109, 103, 106, 106, 111, 113, // 10528-10535
-118, 122, 128, 130, 135, 134, 137, 136, // 10536-10543
-137, 137, 135, 135, 132, 134, 134, 137, // 10544-10551
-137, 142, 138, 143, 135, 135, 131, 119, // 10552-10559
-123, 105, 112, 102, 108, 106, 111, 114, // 10560-10567
-118, 122, 129, 128, 137, 134, 136, 139, // 10568-10575
-134, 139, 132, 136, 131, 133, 134, 136, // 10576-10583
-137, 142, 136, 144, 131, 139, 123, 126, // 10584-10591
-114, 110, 109, 104, 108, 107, 112, 113, // 10592-10599
-119, 123, 129, 129, 139, 131, 142, 134, // 10600-10607
-140, 136, 136, 135, 133, 134, 136, 135, // 10608-10615
-142, 137, 142, 137, 133, 135, 119, 125, // 10616-10623
-108, 112, 105, 107, 107, 110, 112, 117, // 10624-10631
-119, 129, 128, 135, 136, 133, 140, 134, // 10632-10639
-140, 134, 136, 133, 133, 135, 136, 138, // 10640-10647
-142, 137, 142, 133, 135, 130, 120, 122, // 10648-10655
-106, 111, 103, 108, 107, 111, 113, 118, // 10656-10663
-121, 130, 128, 135, 135, 134, 139, 133, // 10664-10671
-140, 131, 136, 131, 133, 135, 136, 137, // 10672-10679
-141, 137, 141, 134, 135, 128, 121, 120, // 10680-10687
-108, 111, 106, 109, 109, 112, 116, 118, // 10688-10695
-125, 128, 130, 136, 131, 139, 135, 138, // 10696-10703
-135, 134, 134, 132, 135, 135, 137, 140, // 10704-10711
-138, 140, 137, 133, 134, 123, 124, 113, // 10712-10719
-112, 107, 109, 107, 110, 111, 116, 118, // 10720-10727
-128, 124, 136, 131, 136, 137, 135, 140, // 10728-10735
-133, 138, 131, 135, 135, 136, 139, 139, // 10736-10743
-140, 139, 137, 133, 132, 121, 122, 110, // 10744-10751
-110, 107, 106, 110, 108, 116, 115, 123, // 10752-10759
-127, 128, 136, 132, 136, 137, 135, 139, // 10760-10767
-132, 138, 131, 136, 135, 137, 139, 140, // 10768-10775
-138, 141, 131, 136, 126, 121, 119, 107, // 10776-10783
-112, 104, 109, 109, 111, 117, 117, 126, // 10784-10791
-129, 128, 138, 129, 140, 133, 137, 137, // 10792-10799
-131, 138, 128, 138, 132, 138, 138, 138, // 10800-10807
-138, 139, 131, 135, 123, 122, 117, 108, // 10808-10815
-112, 104, 111, 108, 116, 115, 121, 126, // 10816-10823
-127, 134, 132, 136, 135, 135, 137, 134, // 10824-10831
-136, 132, 134, 135, 134, 139, 136, 140, // 10832-10839
-137, 138, 131, 135, 121, 124, 114, 110, // 10840-10847
-112, 105, 112, 107, 117, 112, 124, 122, // 10848-10855
-130, 132, 133, 136, 135, 137, 136, 135, // 10856-10863
-135, 133, 135, 134, 137, 137, 139, 136, // 10864-10871
-139, 133, 133, 131, 119, 124, 109, 112, // 10872-10879
-107, 108, 110, 112, 116, 117, 126, 125, // 10880-10887
-133, 131, 136, 136, 136, 138, 135, 137, // 10888-10895
-134, 134, 135, 135, 137, 137, 137, 137, // 10896-10903
-136, 132, 131, 128, 117, 122, 106, 113, // 10904-10911
-105, 111, 110, 113, 117, 119, 127, 125, // 10912-10919
-135, 131, 138, 134, 138, 136, 136, 135, // 10920-10927
-134, 133, 134, 134, 138, 136, 137, 135, // 10928-10935
-136, 129, 132, 125, 119, 120, 107, 114, // 10936-10943
-106, 112, 111, 115, 117, 121, 125, 128, // 10944-10951
-133, 132, 137, 134, 138, 136, 137, 135, // 10952-10959
-134, 134, 133, 135, 137, 137, 138, 135, // 10960-10967
-137, 130, 134, 125, 121, 120, 108, 114, // 10968-10975
-105, 112, 109, 114, 116, 119, 125, 126, // 10976-10983
-133, 131, 136, 134, 137, 136, 136, 135, // 10984-10991
-133, 134, 134, 135, 137, 137, 137, 136, // 10992-10999
-136, 132, 133, 127, 121, 120, 110, 113, // 11000-11007
-107, 110, 110, 114, 117, 119, 126, 125, // 11008-11015
-134, 130, 138, 134, 138, 136, 136, 136, // 11016-11023
-132, 135, 133, 135, 136, 136, 138, 135, // 11024-11031
-136, 133, 129, 131, 116, 125, 106, 115, // 11032-11039
-106, 109, 112, 112, 118, 119, 126, 127, // 11040-11047
-133, 130, 138, 133, 139, 134, 137, 134, // 11048-11055
-133, 135, 132, 135, 134, 136, 136, 135, // 11056-11063
-135, 133, 131, 131, 119, 124, 109, 114, // 11064-11071
-108, 110, 112, 113, 118, 119, 125, 126, // 11072-11079
-132, 129, 137, 132, 138, 135, 137, 135, // 11080-11087
-132, 135, 130, 136, 134, 138, 137, 137, // 11088-11095
-136, 135, 132, 132, 123, 123, 114, 112, // 11096-11103
-110, 109, 112, 110, 119, 114, 125, 122, // 11104-11111
-131, 129, 133, 134, 133, 136, 134, 135, // 11112-11119
-135, 133, 135, 132, 137, 135, 137, 138, // 11120-11127
-135, 137, 133, 132, 129, 120, 120, 110, // 11128-11135
-110, 110, 108, 114, 112, 119, 119, 126, // 11136-11143
-127, 131, 132, 133, 135, 134, 138, 133, // 11144-11151
-137, 132, 134, 132, 134, 135, 137, 137, // 11152-11159
-138, 135, 137, 131, 132, 123, 120, 116, // 11160-11167
-108, 112, 105, 113, 110, 117, 118, 122, // 11168-11175
-127, 128, 133, 132, 134, 136, 135, 138, // 11176-11183
-134, 136, 131, 133, 132, 134, 137, 136, // 11184-11191
-139, 135, 136, 134, 130, 131, 120, 121, // 11192-11199
-111, 111, 109, 107, 112, 111, 117, 119, // 11200-11207
-123, 130, 126, 136, 129, 136, 134, 135, // 11208-11215
-138, 133, 136, 131, 134, 133, 135, 138, // 11216-11223
-136, 138, 136, 136, 135, 129, 130, 119, // 11224-11231
-118, 112, 108, 112, 107, 114, 111, 120, // 11232-11239
-118, 125, 127, 128, 134, 130, 138, 132, // 11240-11247
-138, 134, 134, 134, 130, 135, 133, 137, // 11248-11255
-138, 137, 139, 135, 136, 133, 129, 129, // 11256-11263
-118, 120, 110, 111, 111, 107, 116, 111, // 11264-11271
-121, 119, 126, 128, 129, 134, 131, 135, // 11272-11279
-134, 135, 136, 133, 135, 131, 133, 133, // 11280-11287
-135, 137, 137, 137, 136, 134, 134, 128, // 11288-11295
-129, 118, 120, 111, 111, 111, 108, 115, // 11296-11303
-112, 120, 119, 124, 129, 127, 135, 131, // 11304-11311
-135, 135, 134, 139, 132, 137, 130, 135, // 11312-11319
-133, 134, 137, 137, 137, 136, 134, 133, // 11320-11327
-129, 128, 122, 119, 114, 111, 110, 110, // 11328-11335
-112, 113, 117, 120, 124, 127, 130, 130, // 11336-11343
-134, 131, 136, 134, 137, 135, 134, 134, // 11344-11351
-131, 136, 133, 136, 137, 136, 137, 134, // 11352-11359
-134, 132, 127, 129, 116, 120, 111, 110, // 11360-11367
-112, 107, 115, 112, 119, 122, 123, 131, // 11368-11375
-126, 135, 131, 133, 137, 133, 139, 133, // 11376-11383
-135, 133, 131, 136, 132, 138, 136, 136, // 11384-11391
-136, 133, 132, 132, 126, 128, 117, 119, // 11392-11399
-112, 110, 112, 108, 116, 113, 122, 122, // 11400-11407
-126, 131, 129, 134, 132, 133, 137, 134, // 11408-11415
-138, 133, 135, 132, 131, 135, 132, 137, // 11416-11423
-135, 135, 134, 132, 132, 130, 126, 127, // 11424-11431
-117, 120, 112, 111, 112, 109, 116, 114, // 11432-11439
-121, 123, 126, 131, 130, 132, 135, 131, // 11440-11447
-139, 132, 138, 133, 133, 134, 129, 135, // 11448-11455
-132, 136, 138, 134, 137, 131, 134, 130, // 11456-11463
-128, 127, 120, 119, 115, 111, 113, 109, // 11464-11471
-115, 114, 120, 123, 126, 129, 130, 131, // 11472-11479
-133, 133, 133, 136, 134, 136, 132, 133, // 11480-11487
-131, 131, 134, 133, 137, 135, 137, 134, // 11488-11495
-133, 131, 129, 127, 125, 119, 117, 114, // 11496-11503
-109, 114, 108, 117, 115, 122, 124, 127, // 11504-11511
-131, 131, 132, 134, 131, 137, 133, 136, // 11512-11519
-134, 132, 132, 129, 133, 132, 134, 136, // 11520-11527
-134, 136, 132, 133, 130, 130, 126, 125, // 11528-11535
-119, 117, 114, 110, 113, 111, 116, 118, // 11536-11543
-122, 126, 128, 130, 131, 130, 134, 131, // 11544-11551
-136, 134, 135, 134, 130, 132, 129, 132, // 11552-11559
-132, 133, 136, 134, 136, 132, 133, 130, // 11560-11567
-129, 128, 124, 124, 117, 119, 111, 113, // 11568-11575
-113, 114, 120, 120, 127, 127, 129, 131, // 11576-11583
-130, 132, 132, 133, 135, 133, 134, 132, // 11584-11591
-131, 130, 130, 131, 132, 133, 135, 133, // 11592-11599
-134, 130, 131, 129, 129, 126, 125, 122, // 11600-11607
-117, 118, 111, 115, 112, 117, 120, 122, // 11608-11615
-127, 127, 130, 130, 131, 132, 133, 133, // 11616-11623
-135, 133, 134, 130, 131, 130, 129, 132, // 11624-11631
-132, 134, 136, 133, 135, 129, 133, 128, // 11632-11639
-130, 128, 125, 124, 116, 118, 111, 115, // 11640-11647
-112, 117, 118, 122, 126, 127, 129, 130, // 11648-11655
-130, 131, 132, 133, 134, 133, 133, 130, // 11656-11663
-130, 129, 129, 132, 132, 135, 135, 135, // 11664-11671
-134, 132, 132, 129, 130, 128, 126, 126, // 11672-11679
-119, 119, 113, 114, 114, 115, 120, 120, // 11680-11687
-125, 126, 129, 129, 130, 130, 132, 132, // 11688-11695
-133, 132, 133, 131, 129, 129, 128, 131, // 11696-11703
-132, 134, 134, 135, 133, 133, 131, 130, // 11704-11711
-130, 128, 129, 124, 125, 118, 118, 115, // 11712-11719
-113, 116, 116, 121, 123, 126, 128, 128, // 11720-11727
-131, 130, 131, 131, 132, 133, 132, 132, // 11728-11735
-130, 129, 129, 129, 130, 132, 133, 135, // 11736-11743
-133, 134, 133, 132, 130, 130, 129, 128, // 11744-11751
-126, 125, 120, 119, 115, 114, 115, 116, // 11752-11759
-120, 121, 126, 127, 129, 130, 131, 131, // 11760-11767
-132, 131, 133, 131, 131, 130, 129, 129, // 11768-11775
-128, 130, 131, 132, 133, 134, 134, 133, // 11776-11783
-133, 130, 132, 128, 131, 126, 126, 123, // 11784-11791
-117, 119, 112, 116, 115, 119, 122, 124, // 11792-11799
-127, 128, 130, 130, 130, 131, 131, 131, // 11800-11807
-133, 130, 131, 128, 128, 128, 128, 131, // 11808-11815
-131, 134, 135, 134, 135, 132, 132, 130, // 11816-11823
-130, 129, 129, 126, 125, 121, 118, 117, // 11824-11831
-113, 117, 116, 121, 122, 125, 127, 128, // 11832-11839
-129, 130, 130, 131, 131, 132, 131, 130, // 11840-11847
-130, 128, 128, 128, 129, 131, 132, 134, // 11848-11855
-134, 135, 133, 133, 132, 130, 131, 128, // 11856-11863
-129, 125, 125, 121, 117, 118, 114, 118, // 11864-11871
-117, 120, 123, 124, 127, 128, 129, 130, // 11872-11879
-130, 131, 131, 131, 131, 129, 129, 128, // 11880-11887
-128, 129, 129, 131, 132, 134, 134, 135, // 11888-11895
-134, 134, 132, 132, 130, 130, 128, 128, // 11896-11903
-124, 123, 118, 118, 115, 115, 118, 118, // 11904-11911
-123, 123, 126, 127, 128, 129, 129, 130, // 11912-11919
-131, 130, 131, 129, 129, 129, 128, 129, // 11920-11927
-128, 131, 131, 133, 135, 135, 135, 134, // 11928-11935
-133, 132, 131, 130, 129, 128, 126, 123, // 11936-11943
-123, 117, 118, 115, 117, 117, 120, 121, // 11944-11951
-125, 126, 128, 128, 130, 129, 130, 131, // 11952-11959
-129, 131, 128, 130, 128, 129, 129, 129, // 11960-11967
-131, 132, 133, 134, 134, 135, 134, 133, // 11968-11975
-132, 130, 130, 128, 128, 126, 124, 123, // 11976-11983
-119, 118, 117, 115, 119, 117, 123, 124, // 11984-11991
-127, 128, 128, 129, 129, 129, 130, 129, // 11992-11999
-130, 129, 129, 129, 128, 129, 129, 131, // 12000-12007
-132, 133, 135, 134, 135, 135, 133, 133, // 12008-12015
-130, 130, 129, 128, 127, 125, 122, 122, // 12016-12023
-117, 119, 115, 118, 118, 121, 123, 125, // 12024-12031
-126, 128, 128, 130, 129, 130, 130, 129, // 12032-12039
-130, 129, 129, 129, 129, 130, 130, 132, // 12040-12047
-132, 134, 134, 134, 134, 133, 132, 131, // 12048-12055
-130, 129, 128, 127, 126, 124, 123, 120, // 12056-12063
-118, 118, 116, 119, 119, 123, 124, 125, // 12064-12071
-128, 128, 130, 130, 130, 131, 129, 130, // 12072-12079
-129, 128, 129, 127, 130, 129, 130, 132, // 12080-12087
-132, 134, 134, 134, 134, 132, 133, 130, // 12088-12095
-129, 129, 127, 126, 126, 122, 124, 118, // 12096-12103
-120, 117, 117, 120, 118, 124, 124, 127, // 12104-12111
-128, 129, 129, 130, 129, 131, 128, 130, // 12112-12119
-128, 128, 129, 127, 130, 129, 131, 132, // 12120-12127
-133, 135, 134, 134, 135, 132, 133, 131, // 12128-12135
-129, 130, 126, 127, 125, 124, 123, 119, // 12136-12143
-119, 117, 117, 118, 119, 123, 124, 126, // 12144-12151
-127, 128, 129, 129, 130, 130, 130, 130, // 12152-12159
-129, 128, 129, 128, 128, 130, 130, 132, // 12160-12167
-133, 133, 134, 132, 134, 132, 133, 132, // 12168-12175
-130, 130, 128, 127, 126, 125, 123, 122, // 12176-12183
-118, 118, 117, 118, 120, 120, 124, 124, // 12184-12191
-126, 127, 128, 130, 129, 130, 131, 129, // 12192-12199
-131, 129, 128, 129, 127, 130, 129, 131, // 12200-12207
-132, 131, 134, 132, 133, 134, 132, 133, // 12208-12215
-130, 130, 129, 127, 127, 126, 124, 123, // 12216-12223
-121, 119, 119, 117, 119, 120, 122, 124, // 12224-12231
-125, 127, 128, 129, 130, 130, 130, 130, // 12232-12239
-129, 130, 128, 128, 128, 128, 130, 130, // 12240-12247
-131, 132, 132, 133, 133, 133, 134, 132, // 12248-12255
-133, 130, 130, 128, 127, 127, 125, 125, // 12256-12263
-122, 121, 119, 119, 117, 119, 119, 122, // 12264-12271
-123, 126, 127, 129, 129, 130, 130, 130, // 12272-12279
-130, 129, 129, 128, 128, 128, 128, 129, // 12280-12287
-130, 130, 132, 133, 133, 134, 133, 134, // 12288-12295
-133, 132, 131, 129, 129, 127, 126, 126, // 12296-12303
-124, 123, 121, 118, 118, 117, 119, 120, // 12304-12311
-122, 125, 126, 128, 129, 129, 130, 130, // 12312-12319
-130, 130, 129, 129, 128, 127, 128, 127, // 12320-12327
-129, 130, 130, 132, 132, 133, 133, 132, // 12328-12335
-133, 132, 132, 131, 129, 129, 126, 127, // 12336-12343
-124, 125, 122, 122, 119, 119, 118, 118, // 12344-12351
-121, 121, 125, 125, 128, 128, 129, 129, // 12352-12359
-130, 129, 131, 129, 129, 128, 128, 128, // 12360-12367
-128, 128, 130, 131, 132, 132, 132, 133, // 12368-12375
-133, 133, 133, 132, 132, 130, 130, 128, // 12376-12383
-127, 127, 126, 126, 123, 122, 119, 119, // 12384-12391
-117, 119, 119, 122, 124, 125, 127, 127, // 12392-12399
-128, 128, 129, 129, 129, 129, 129, 128, // 12400-12407
-127, 128, 127, 130, 130, 131, 132, 132, // 12408-12415
-133, 132, 133, 133, 133, 133, 131, 131, // 12416-12423
-129, 128, 128, 126, 127, 125, 124, 122, // 12424-12431
-120, 119, 118, 120, 120, 123, 124, 126, // 12432-12439
-127, 128, 128, 129, 128, 130, 129, 129, // 12440-12447
-129, 128, 128, 127, 129, 129, 130, 131, // 12448-12455
-131, 132, 132, 133, 132, 133, 132, 132, // 12456-12463
-131, 131, 129, 128, 127, 126, 126, 125, // 12464-12471
-123, 122, 120, 119, 119, 119, 121, 121, // 12472-12479
-124, 125, 126, 127, 128, 129, 129, 130, // 12480-12487
-129, 130, 129, 129, 128, 128, 129, 129, // 12488-12495
-131, 130, 132, 132, 132, 133, 132, 133, // 12496-12503
-133, 132, 132, 130, 130, 129, 127, 127, // 12504-12511
-126, 125, 124, 122, 121, 119, 119, 118, // 12512-12519
-120, 121, 122, 124, 125, 126, 127, 128, // 12520-12527
-129, 130, 130, 130, 129, 129, 129, 128, // 12528-12535
-129, 129, 130, 132, 131, 133, 132, 132, // 12536-12543
-132, 132, 132, 132, 131, 131, 130, 129, // 12544-12551
-128, 126, 126, 125, 124, 122, 122, 119, // 12552-12559
-120, 119, 120, 121, 122, 124, 125, 127, // 12560-12567
-127, 128, 129, 130, 129, 130, 129, 130, // 12568-12575
-129, 129, 129, 129, 130, 131, 131, 132, // 12576-12583
-132, 132, 132, 131, 131, 131, 131, 131, // 12584-12591
-130, 130, 128, 127, 127, 125, 125, 124, // 12592-12599
-122, 122, 120, 120, 120, 120, 122, 122, // 12600-12607
-125, 126, 127, 128, 129, 129, 130, 129, // 12608-12615
-130, 129, 129, 129, 128, 129, 128, 130, // 12616-12623
-130, 131, 131, 132, 131, 132, 131, 131, // 12624-12631
-132, 131, 131, 130, 130, 128, 127, 126, // 12632-12639
-126, 124, 124, 122, 123, 120, 120, 120, // 12640-12647
-120, 122, 122, 124, 126, 126, 127, 128, // 12648-12655
-128, 129, 128, 129, 129, 129, 129, 128, // 12656-12663
-129, 129, 130, 131, 131, 132, 132, 132, // 12664-12671
-132, 132, 132, 132, 131, 132, 130, 130, // 12672-12679
-129, 127, 127, 126, 124, 125, 122, 123, // 12680-12687
-121, 121, 121, 120, 123, 122, 124, 126, // 12688-12695
-125, 127, 127, 127, 129, 128, 129, 129, // 12696-12703
-129, 129, 128, 129, 129, 130, 131, 131, // 12704-12711
-132, 132, 131, 131, 131, 131, 131, 131, // 12712-12719
-131, 130, 130, 129, 128, 127, 126, 126, // 12720-12727
-125, 124, 123, 122, 121, 121, 121, 122, // 12728-12735
-122, 124, 125, 126, 127, 127, 128, 128, // 12736-12743
-129, 129, 130, 129, 129, 129, 129, 128, // 12744-12751
-129, 129, 131, 131, 131, 131, 131, 131, // 12752-12759
-131, 131, 131, 131, 131, 131, 129, 129, // 12760-12767
-127, 126, 126, 125, 124, 123, 122, 121, // 12768-12775
-121, 120, 121, 122, 124, 124, 126, 127, // 12776-12783
-127, 128, 128, 128, 129, 129, 130, 129, // 12784-12791
-129, 129, 128, 129, 129, 130, 131, 131, // 12792-12799
-132, 132, 131, 131, 131, 131, 131, 131, // 12800-12807
-131, 129, 129, 128, 126, 127, 125, 125, // 12808-12815
-124, 122, 122, 120, 121, 121, 121, 123, // 12816-12823
-124, 125, 126, 126, 127, 127, 128, 129, // 12824-12831
-129, 130, 130, 129, 129, 128, 129, 129, // 12832-12839
-130, 131, 131, 132, 131, 131, 131, 130, // 12840-12847
-131, 131, 131, 132, 130, 130, 128, 127, // 12848-12855
-127, 126, 125, 125, 123, 123, 121, 120, // 12856-12863
-121, 121, 123, 123, 125, 126, 126, 127, // 12864-12871
-128, 128, 129, 129, 130, 130, 130, 129, // 12872-12879
-129, 128, 129, 129, 129, 131, 130, 131, // 12880-12887
-131, 130, 131, 131, 131, 132, 131, 132, // 12888-12895
-130, 129, 129, 126, 127, 125, 124, 125, // 12896-12903
-122, 123, 121, 120, 122, 120, 123, 123, // 12904-12911
-124, 127, 125, 127, 127, 127, 129, 128, // 12912-12919
-129, 129, 129, 129, 129, 128, 129, 129, // 12920-12927
-129, 131, 131, 131, 132, 131, 132, 131, // 12928-12935
-131, 133, 130, 132, 130, 129, 129, 126, // 12936-12943
-127, 125, 125, 125, 122, 124, 120, 121, // 12944-12951
-121, 120, 124, 123, 125, 126, 125, 127, // 12952-12959
-127, 127, 128, 128, 130, 129, 129, 128, // 12960-12967
-129, 128, 129, 129, 130, 132, 130, 132, // 12968-12975
-131, 130, 132, 130, 132, 131, 131, 132, // 12976-12983
-129, 130, 127, 126, 127, 124, 126, 124, // 12984-12991
-123, 123, 120, 122, 120, 121, 124, 123, // 12992-12999
-126, 126, 126, 128, 127, 129, 128, 129, // 13000-13007
-130, 128, 130, 128, 129, 128, 128, 130, // 13008-13015
-129, 131, 131, 131, 132, 130, 132, 131, // 13016-13023
-132, 132, 131, 132, 130, 130, 128, 126, // 13024-13031
-127, 124, 125, 124, 122, 123, 120, 121, // 13032-13039
-121, 121, 124, 123, 126, 126, 126, 127, // 13040-13047
-127, 128, 128, 129, 129, 129, 130, 127, // 13048-13055
-129, 128, 128, 130, 128, 132, 131, 131, // 13056-13063
-132, 129, 132, 131, 131, 133, 130, 132, // 13064-13071
-129, 129, 128, 125, 127, 124, 125, 124, // 13072-13079
-121, 123, 120, 121, 121, 121, 124, 123, // 13080-13087
-126, 127, 126, 128, 127, 128, 129, 129, // 13088-13095
-130, 130, 130, 129, 129, 128, 129, 130, // 13096-13103
-129, 131, 131, 131, 132, 130, 131, 131, // 13104-13111
-131, 132, 131, 132, 130, 129, 128, 125, // 13112-13119
-126, 125, 124, 125, 122, 123, 121, 120, // 13120-13127
-122, 120, 124, 124, 125, 128, 126, 128, // 13128-13135
-128, 128, 129, 129, 130, 129, 130, 129, // 13136-13143
-128, 129, 127, 129, 130, 129, 132, 130, // 13144-13151
-131, 131, 130, 132, 131, 132, 132, 131, // 13152-13159
-131, 129, 128, 126, 126, 125, 124, 125, // 13160-13167
-122, 123, 121, 120, 122, 119, 124, 124, // 13168-13175
-124, 128, 126, 128, 128, 127, 129, 128, // 13176-13183
-130, 129, 130, 129, 128, 129, 128, 129, // 13184-13191
-130, 130, 132, 130, 131, 131, 130, 132, // 13192-13199
-130, 132, 132, 131, 132, 129, 129, 127, // 13200-13207
-126, 126, 124, 125, 123, 122, 122, 119, // 13208-13215
-122, 121, 122, 125, 124, 126, 127, 126, // 13216-13223
-128, 127, 128, 129, 129, 130, 130, 129, // 13224-13231
-128, 129, 128, 129, 130, 130, 131, 131, // 13232-13239
-130, 131, 130, 131, 131, 132, 132, 132, // 13240-13247
-131, 130, 129, 126, 127, 126, 124, 126, // 13248-13255
-123, 122, 122, 119, 122, 121, 122, 125, // 13256-13263
-124, 126, 127, 126, 127, 127, 128, 129, // 13264-13271
-130, 129, 130, 129, 128, 129, 127, 128, // 13272-13279
-130, 129, 131, 131, 130, 131, 130, 130, // 13280-13287
-132, 131, 132, 132, 131, 130, 129, 127, // 13288-13295
-126, 126, 124, 125, 124, 122, 123, 120, // 13296-13303
-121, 123, 121, 126, 126, 125, 129, 126, // 13304-13311
-127, 129, 127, 130, 130, 129, 130, 129, // 13312-13319
-128, 129, 127, 128, 130, 129, 130, 131, // 13320-13327
-129, 131, 130, 130, 131, 131, 132, 131, // 13328-13335
-131, 129, 129, 127, 125, 127, 123, 125, // 13336-13343
-124, 120, 124, 120, 120, 124, 120, 125, // 13344-13351
-126, 125, 129, 126, 127, 129, 127, 130, // 13352-13359
-130, 130, 130, 129, 128, 128, 128, 127, // 13360-13367
-129, 130, 130, 132, 130, 131, 131, 130, // 13368-13375
-132, 132, 132, 133, 131, 130, 129, 126, // 13376-13383
-126, 126, 124, 125, 123, 121, 122, 120, // 13384-13391
-120, 123, 121, 124, 126, 125, 128, 127, // 13392-13399
-127, 129, 127, 129, 130, 129, 129, 129, // 13400-13407
-128, 128, 128, 128, 129, 130, 131, 131, // 13408-13415
-131, 131, 131, 131, 132, 132, 133, 132, // 13416-13423
-131, 130, 129, 127, 126, 126, 124, 125, // 13424-13431
-124, 121, 122, 120, 120, 123, 121, 125, // 13432-13439
-126, 125, 129, 127, 127, 129, 127, 129, // 13440-13447
-130, 129, 129, 129, 128, 127, 128, 128, // 13448-13455
-129, 130, 129, 131, 130, 130, 131, 130, // 13456-13463
-131, 132, 132, 132, 131, 129, 129, 127, // 13464-13471
-126, 126, 124, 125, 124, 121, 123, 120, // 13472-13479
-120, 123, 122, 125, 127, 126, 128, 127, // 13480-13487
-127, 129, 128, 129, 130, 130, 129, 129, // 13488-13495
-127, 127, 128, 128, 129, 130, 130, 130, // 13496-13503
-130, 130, 130, 131, 131, 132, 132, 132, // 13504-13511
-131, 129, 128, 127, 125, 126, 124, 124, // 13512-13519
-124, 120, 122, 121, 120, 124, 122, 125, // 13520-13527
-128, 126, 128, 127, 127, 128, 128, 129, // 13528-13535
-129, 129, 129, 128, 128, 127, 128, 128, // 13536-13543
-129, 130, 131, 131, 131, 131, 131, 132, // 13544-13551
-132, 133, 133, 132, 131, 130, 128, 126, // 13552-13559
-126, 125, 123, 125, 122, 121, 123, 120, // 13560-13567
-120, 124, 122, 125, 127, 126, 128, 128, // 13568-13575
-127, 128, 129, 129, 130, 129, 129, 128, // 13576-13583
-127, 128, 127, 128, 129, 129, 131, 130, // 13584-13591
-130, 131, 130, 132, 132, 132, 133, 132, // 13592-13599
-131, 130, 127, 127, 125, 125, 124, 123, // 13600-13607
-123, 121, 121, 121, 119, 123, 124, 124, // 13608-13615
-128, 127, 127, 129, 127, 128, 129, 129, // 13616-13623
-130, 130, 129, 129, 128, 127, 128, 128, // 13624-13631
-128, 130, 130, 130, 131, 130, 130, 131, // 13632-13639
-132, 132, 133, 132, 131, 129, 127, 126, // 13640-13647
-125, 125, 124, 124, 123, 120, 122, 121, // 13648-13655
-120, 123, 124, 124, 127, 127, 127, 128, // 13656-13663
-127, 128, 129, 128, 130, 130, 129, 129, // 13664-13671
-128, 127, 128, 128, 129, 130, 131, 131, // 13672-13679
-131, 131, 131, 131, 132, 132, 133, 132, // 13680-13687
-131, 130, 127, 127, 126, 125, 124, 124, // 13688-13695
-124, 121, 120, 122, 119, 120, 125, 123, // 13696-13703
-125, 127, 127, 128, 127, 128, 129, 128, // 13704-13711
-129, 131, 129, 129, 129, 128, 128, 128, // 13712-13719
-129, 130, 130, 130, 131, 130, 131, 131, // 13720-13727
-131, 132, 133, 131, 132, 132, 128, 127, // 13728-13735
-127, 126, 124, 124, 125, 122, 119, 122, // 13736-13743
-122, 119, 122, 125, 124, 125, 127, 128, // 13744-13751
-127, 127, 129, 129, 128, 130, 130, 128, // 13752-13759
-128, 129, 128, 128, 128, 130, 130, 130, // 13760-13767
-131, 131, 131, 131, 131, 132, 132, 133, // 13768-13775
-131, 131, 130, 127, 126, 126, 125, 124, // 13776-13783
-124, 125, 122, 119, 123, 122, 119, 123, // 13784-13791
-126, 124, 125, 127, 128, 126, 126, 130, // 13792-13799
-129, 127, 130, 131, 129, 128, 129, 129, // 13800-13807
-128, 129, 131, 131, 130, 131, 132, 130, // 13808-13815
-130, 131, 132, 132, 131, 131, 131, 128, // 13816-13823
-127, 126, 126, 125, 124, 124, 124, 120, // 13824-13831
-120, 123, 121, 120, 124, 126, 125, 126, // 13832-13839
-128, 128, 126, 127, 129, 129, 128, 129, // 13840-13847
-129, 128, 128, 128, 128, 129, 129, 130, // 13848-13855
-131, 131, 130, 131, 131, 131, 131, 132, // 13856-13863
-132, 131, 130, 129, 128, 127, 126, 126, // 13864-13871
-125, 125, 125, 124, 123, 123, 123, 123, // 13872-13879
-124, 124, 125, 125, 125, 126, 126, 125, // 13880-13887
-127, 127, 128, 129, 129, 129, 129, 129, // 13888-13895
-129, 129, 129, 130, 130, 130, 130, 130, // 13896-13903
-130, 130, 130, 130, 130, 131, 131, 130, // 13904-13911
-130, 129, 128, 128, 127, 127, 127, 126, // 13912-13919
-126, 125, 122, 122, 123, 121, 122, 123, // 13920-13927
-123, 123, 125, 125, 125, 127, 127, 129, // 13928-13935
-129, 130, 130, 130, 129, 129, 129, 129, // 13936-13943
-129, 130, 130, 130, 130, 130, 130, 130, // 13944-13951
-131, 131, 131, 131, 131, 130, 129, 129, // 13952-13959
-128, 127, 127, 126, 125, 125, 124, 122, // 13960-13967
-122, 122, 121, 123, 124, 123, 125, 125, // 13968-13975
-125, 126, 127, 127, 129, 130, 130, 130, // 13976-13983
-130, 129, 129, 129, 129, 129, 129, 130, // 13984-13991
-130, 129, 130, 129, 129, 130, 130, 131, // 13992-13999
-131, 130, 130, 129, 128, 128, 128, 127, // 14000-14007
-126, 125, 125, 123, 122, 123, 122, 121, // 14008-14015
-123, 124, 123, 124, 126, 125, 126, 128, // 14016-14023
-128, 129, 130, 130, 130, 130, 129, 129, // 14024-14031
-129, 129, 129, 130, 130, 129, 130, 130, // 14032-14039
-129, 130, 131, 131, 131, 131, 131, 131, // 14040-14047
-129, 129, 128, 128, 127, 126, 125, 124, // 14048-14055
-123, 122, 122, 121, 121, 123, 123, 123, // 14056-14063
-125, 125, 125, 126, 127, 128, 129, 129, // 14064-14071
-129, 130, 129, 129, 130, 129, 129, 130, // 14072-14079
-130, 130, 130, 130, 130, 130, 131, 131, // 14080-14087
-131, 131, 131, 130, 130, 129, 128, 127, // 14088-14095
-127, 126, 125, 125, 124, 122, 122, 122, // 14096-14103
-122, 121, 123, 124, 124, 125, 125, 125, // 14104-14111
-127, 127, 128, 129, 129, 130, 130, 130, // 14112-14119
-129, 129, 130, 130, 130, 131, 131, 130, // 14120-14127
-130, 130, 130, 130, 131, 131, 130, 130, // 14128-14135
-129, 129, 128, 127, 127, 126, 126, 125, // 14136-14143
-124, 124, 122, 122, 122, 122, 122, 124, // 14144-14151
-124, 124, 125, 125, 126, 127, 128, 129, // 14152-14159
-130, 130, 130, 130, 130, 130, 129, 130, // 14160-14167
-130, 130, 131, 131, 130, 130, 131, 130, // 14168-14175
-131, 131, 131, 131, 130, 130, 128, 128, // 14176-14183
-127, 126, 126, 125, 124, 123, 123, 122, // 14184-14191
-122, 122, 122, 123, 123, 124, 124, 125, // 14192-14199
-125, 126, 128, 128, 128, 129, 129, 129, // 14200-14207
-129, 129, 129, 129, 130, 131, 130, 131, // 14208-14215
-131, 131, 131, 131, 131, 132, 132, 131, // 14216-14223
-131, 130, 129, 128, 127, 127, 126, 126, // 14224-14231
-125, 124, 123, 122, 122, 122, 122, 122, // 14232-14239
-123, 124, 124, 125, 126, 126, 128, 128, // 14240-14247
-129, 129, 129, 129, 129, 129, 130, 130, // 14248-14255
-130, 131, 131, 131, 131, 131, 131, 131, // 14256-14263
-131, 132, 132, 131, 131, 130, 129, 128, // 14264-14271
-127, 126, 126, 125, 124, 123, 122, 121, // 14272-14279
-121, 121, 121, 122, 122, 123, 124, 124, // 14280-14287
-125, 126, 127, 128, 129, 129, 129, 130, // 14288-14295
-130, 130, 131, 131, 132, 132, 133, 133, // 14296-14303
-132, 132, 132, 133, 133, 132, 132, 131, // 14304-14311
-130, 128, 128, 127, 126, 125, 124, 123, // 14312-14319
-122, 121, 121, 120, 120, 121, 121, 122, // 14320-14327
-123, 123, 124, 125, 126, 127, 129, 129, // 14328-14335
-130, 131, 131, 131, 132, 132, 133, 133, // 14336-14343
-133, 133, 133, 132, 132, 132, 131, 131, // 14344-14351
-130, 130, 129, 128, 126, 126, 125, 124, // 14352-14359
-123, 123, 121, 121, 121, 120, 120, 121, // 14360-14367
-122, 122, 124, 125, 125, 126, 128, 128, // 14368-14375
-129, 131, 131, 132, 132, 133, 133, 133, // 14376-14383
-133, 133, 133, 133, 133, 132, 132, 131, // 14384-14391
-130, 130, 129, 128, 127, 126, 125, 124, // 14392-14399
-124, 122, 122, 121, 121, 120, 121, 121, // 14400-14407
-121, 122, 122, 123, 125, 126, 127, 128, // 14408-14415
-129, 130, 131, 132, 132, 132, 133, 133, // 14416-14423
-133, 133, 133, 132, 132, 132, 131, 131, // 14424-14431
-131, 130, 130, 129, 128, 127, 126, 125, // 14432-14439
-125, 124, 123, 122, 121, 121, 121, 121, // 14440-14447
-121, 121, 122, 124, 124, 126, 127, 128, // 14448-14455
-129, 131, 131, 132, 133, 133, 133, 133, // 14456-14463
-133, 132, 132, 131, 131, 130, 130, 129, // 14464-14471
-129, 129, 128, 128, 128, 127, 126, 126, // 14472-14479
-125, 124, 123, 123, 122, 122, 121, 121, // 14480-14487
-122, 122, 123, 124, 125, 126, 128, 129, // 14488-14495
-130, 131, 132, 133, 133, 133, 133, 133, // 14496-14503
-132, 132, 131, 131, 130, 130, 129, 129, // 14504-14511
-128, 128, 128, 127, 127, 126, 126, 125, // 14512-14519
-125, 124, 124, 123, 122, 122, 122, 122, // 14520-14527
-122, 123, 124, 124, 125, 127, 127, 129, // 14528-14535
-130, 131, 131, 132, 132, 132, 132, 132, // 14536-14543
-132, 131, 131, 130, 130, 130, 129, 129, // 14544-14551
-128, 128, 128, 128, 128, 127, 126, 126, // 14552-14559
-125, 125, 124, 124, 123, 123, 123, 123, // 14560-14567
-123, 123, 124, 125, 126, 126, 128, 129, // 14568-14575
-129, 130, 131, 131, 131, 131, 132, 131, // 14576-14583
-131, 131, 130, 130, 130, 129, 129, 129, // 14584-14591
-128, 128, 128, 128, 127, 127, 127, 126, // 14592-14599
-126, 125, 124, 124, 124, 123, 123, 123, // 14600-14607
-123, 124, 124, 125, 126, 127, 127, 128, // 14608-14615
-129, 130, 130, 131, 131, 131, 131, 131, // 14616-14623
-131, 131, 130, 130, 129, 129, 129, 128, // 14624-14631
-128, 128, 128, 127, 128, 127, 127, 126, // 14632-14639
-126, 126, 125, 125, 125, 124, 124, 124, // 14640-14647
-124, 124, 125, 125, 125, 126, 127, 128, // 14648-14655
-129, 129, 129, 130, 130, 131, 131, 131, // 14656-14663
-131, 130, 130, 130, 130, 129, 129, 128, // 14664-14671
-128, 128, 128, 127, 127, 127, 127, 126, // 14672-14679
-126, 126, 126, 125, 125, 125, 125, 125, // 14680-14687
-125, 125, 125, 125, 126, 126, 127, 127, // 14688-14695
-128, 129, 129, 129, 130, 130, 130, 131, // 14696-14703
-130, 130, 130, 130, 130, 129, 129, 129, // 14704-14711
-129, 128, 128, 128, 127, 127, 127, 126, // 14712-14719
-126, 126, 126, 126, 125, 125, 125, 125, // 14720-14727
-125, 125, 125, 126, 126, 126, 127, 127, // 14728-14735
-128, 128, 129, 129, 130, 130, 130, 131, // 14736-14743
-130, 130, 130, 130, 129, 129, 128, 129, // 14744-14751
-128, 127, 128, 127, 127, 127, 126, 126, // 14752-14759
-126, 126, 125, 125, 126, 126, 125, 125, // 14760-14767
-125, 126, 125, 125, 126, 127, 127, 127, // 14768-14775
-127, 129, 130, 129, 130, 130, 131, 131, // 14776-14783
-130, 129, 131, 130, 129, 129, 129, 129, // 14784-14791
-128, 127, 128, 129, 128, 127, 126, 127, // 14792-14799
-127, 125, 125, 126, 126, 125, 124, 124, // 14800-14807
-125, 125, 124, 124, 126, 127, 126, 126, // 14808-14815
-128, 129, 128, 128, 130, 130, 130, 130, // 14816-14823
-130, 130, 130, 129, 129, 130, 130, 129, // 14824-14831
-129, 129, 129, 128, 128, 128, 128, 127, // 14832-14839
-126, 126, 126, 126, 124, 125, 125, 124, // 14840-14847
-124, 125, 125, 126, 126, 126, 127, 128, // 14848-14855
-128, 128, 129, 129, 129, 129, 130, 130, // 14856-14863
-130, 130, 130, 130, 129, 129, 129, 129, // 14864-14871
-129, 128, 128, 128, 127, 127, 127, 127, // 14872-14879
-126, 126, 125, 125, 125, 124, 125, 125, // 14880-14887
-124, 125, 125, 126, 126, 126};// 14888-14893
-
-#define P2_WIN_N 11045
-
-const uint8_t P2Win[P2_WIN_N] = {
-127, 124, 122, 120, 120, 121, 123, 127, // 0-7
-130, 133, 133, 133, 131, 130, 127, 126, // 8-15
-126, 126, 126, 126, 127, 126, 127, 128, // 16-23
-130, 131, 132, 133, 134, 133, 130, 127, // 24-31
-123, 119, 114, 114, 116, 121, 127, 133, // 32-39
-137, 139, 137, 134, 130, 126, 124, 124, // 40-47
-124, 125, 126, 127, 126, 126, 126, 127, // 48-55
-130, 132, 134, 135, 135, 134, 133, 131, // 56-63
-129, 124, 119, 114, 111, 112, 115, 122, // 64-71
-129, 136, 140, 141, 138, 134, 129, 125, // 72-79
-122, 122, 124, 125, 127, 128, 129, 128, // 80-87
-126, 125, 125, 127, 129, 132, 135, 136, // 88-95
-134, 132, 128, 126, 125, 126, 128, 128, // 96-103
-126, 122, 118, 114, 114, 116, 122, 130, // 104-111
-137, 141, 142, 139, 133, 127, 123, 120, // 112-119
-120, 123, 125, 127, 128, 128, 129, 129, // 120-127
-130, 132, 133, 134, 134, 133, 133, 131, // 128-135
-128, 124, 119, 114, 111, 111, 114, 120, // 136-143
-128, 136, 141, 143, 141, 136, 130, 124, // 144-151
-121, 120, 121, 123, 124, 125, 126, 127, // 152-159
-129, 131, 133, 135, 136, 137, 136, 135, // 160-167
-132, 128, 121, 115, 109, 107, 109, 114, // 168-175
-124, 134, 143, 147, 147, 141, 134, 126, // 176-183
-120, 118, 118, 121, 124, 126, 126, 126, // 184-191
-125, 125, 128, 132, 135, 138, 138, 137, // 192-199
-135, 133, 130, 127, 121, 115, 109, 106, // 200-207
-107, 113, 123, 134, 144, 149, 149, 144, // 208-215
-136, 127, 119, 115, 115, 117, 121, 124, // 216-223
-126, 127, 128, 130, 132, 135, 136, 137, // 224-231
-136, 135, 133, 131, 129, 127, 121, 115, // 232-239
-108, 106, 108, 115, 126, 137, 146, 151, // 240-247
-149, 142, 133, 123, 117, 115, 116, 121, // 248-255
-125, 127, 128, 128, 128, 129, 132, 136, // 256-263
-138, 139, 139, 138, 135, 132, 126, 117, // 264-271
-108, 100,  98, 104, 115, 130, 143, 152, // 272-279
-153, 148, 139, 128, 119, 115, 115, 118, // 280-287
-123, 126, 127, 125, 124, 124, 127, 133, // 288-295
-138, 142, 142, 140, 138, 136, 133, 129, // 296-303
-120, 111, 102,  98, 102, 112, 127, 142, // 304-311
-152, 155, 151, 141, 130, 120, 114, 113, // 312-319
-117, 122, 126, 127, 126, 124, 124, 126, // 320-327
-132, 137, 141, 141, 139, 136, 134, 132, // 328-335
-130, 124, 115, 106,  98,  99, 106, 121, // 336-343
-137, 149, 155, 153, 145, 134, 123, 116, // 344-351
-114, 117, 122, 125, 127, 125, 122, 123, // 352-359
-126, 133, 139, 143, 144, 141, 137, 134, // 360-367
-132, 130, 122, 113, 102,  95,  96, 105, // 368-375
-123, 140, 153, 159, 154, 143, 130, 119, // 376-383
-115, 114, 118, 123, 124, 124, 121, 121, // 384-391
-125, 131, 140, 145, 146, 143, 136, 134, // 392-399
-132, 133, 131, 120, 108,  94,  90,  95, // 400-407
-111, 133, 151, 161, 160, 149, 135, 121, // 408-415
-113, 113, 117, 123, 126, 125, 122, 117, // 416-423
-118, 124, 134, 144, 150, 148, 141, 131, // 424-431
-128, 130, 136, 137, 126, 112,  93,  87, // 432-439
- 93, 114, 139, 157, 165, 157, 141, 122, // 440-447
-109, 106, 113, 125, 135, 137, 134, 126, // 448-455
-120, 117, 120, 127, 134, 138, 138, 134, // 456-463
-131, 131, 138, 145, 148, 134, 113,  90, // 464-471
- 81,  90, 112, 142, 159, 164, 152, 132, // 472-479
-116, 109, 114, 124, 134, 138, 131, 123, // 480-487
-117, 119, 127, 132, 135, 131, 127, 124, // 488-495
-125, 132, 139, 149, 153, 149, 134, 107, // 496-503
- 89,  80,  96, 120, 144, 156, 148, 136, // 504-511
-122, 120, 127, 133, 133, 124, 114, 112, // 512-519
-119, 136, 146, 146, 132, 114, 109, 116, // 520-527
-132, 142, 144, 137, 131, 137, 145, 150, // 528-535
-129,  96,  77,  79, 117, 143, 161, 148, // 536-543
-126, 120, 125, 140, 142, 125, 108, 100, // 544-551
-117, 141, 154, 150, 126, 109, 108, 122, // 552-559
-139, 138, 130, 121, 127, 147, 165, 161, // 560-567
-137,  87,  73,  82, 119, 149, 140, 136, // 568-575
-116, 133, 148, 148, 135, 107,  98, 113, // 576-583
-130, 147, 139, 129, 127, 125, 136, 128, // 584-591
-122, 117, 119, 137, 143, 147, 148, 142, // 592-599
-141, 118,  88,  89,  89, 129, 133, 140, // 600-607
-137, 128, 144, 140, 135, 123, 107, 113, // 608-615
-124, 132, 140, 131, 137, 131, 125, 126, // 616-623
-117, 128, 126, 131, 137, 137, 151, 154, // 624-631
-145, 128,  80,  89,  99, 124, 137, 117, // 632-639
-135, 134, 152, 148, 121, 114, 112, 121, // 640-647
-134, 123, 127, 129, 138, 147, 122, 119, // 648-655
-112, 128, 137, 128, 131, 134, 151, 164, // 656-663
-144, 129,  86,  85, 113, 112, 131, 109, // 664-671
-135, 150, 148, 143, 117, 116, 129, 122, // 672-679
-120, 116, 126, 147, 138, 136, 120, 119, // 680-687
-130, 121, 127, 122, 134, 149, 145, 152, // 688-695
-145, 139, 119,  74, 106, 104, 122, 121, // 696-703
-117, 152, 147, 143, 130, 114, 132, 125, // 704-711
-113, 120, 121, 142, 137, 129, 131, 121, // 712-719
-128, 121, 118, 129, 131, 141, 142, 144, // 720-727
-157, 142, 129,  84,  96, 118, 109, 116, // 728-735
-115, 145, 152, 134, 128, 131, 130, 130, // 736-743
-107, 117, 131, 134, 133, 129, 136, 127, // 744-751
-122, 121, 126, 132, 130, 134, 144, 148, // 752-759
-155, 138, 130,  97,  99, 118,  99, 113, // 760-767
-119, 143, 140, 130, 132, 142, 126, 121, // 768-775
-115, 121, 130, 124, 130, 136, 135, 121, // 776-783
-115, 134, 130, 122, 127, 140, 151, 141, // 784-791
-148, 151, 139, 100,  92, 130, 102, 102, // 792-799
-116, 141, 138, 125, 132, 149, 126, 115, // 800-807
-125, 125, 127, 120, 130, 138, 122, 118, // 808-815
-136, 129, 122, 121, 136, 140, 136, 144, // 816-823
-157, 136, 131, 100, 120, 120,  86, 118, // 824-831
-130, 127, 127, 134, 142, 135, 114, 135, // 832-839
-129, 114, 126, 132, 131, 127, 124, 129, // 840-847
-133, 116, 128, 131, 129, 136, 145, 147, // 848-855
-145, 135, 135, 101, 123, 111,  94, 123, // 856-863
-124, 124, 130, 135, 136, 133, 122, 138, // 864-871
-121, 119, 134, 130, 124, 130, 128, 123, // 872-879
-130, 123, 126, 127, 132, 138, 141, 143, // 880-887
-145, 137, 134, 107, 124, 114,  92, 125, // 888-895
-121, 114, 130, 137, 129, 135, 125, 136, // 896-903
-123, 122, 135, 126, 124, 132, 126, 121, // 904-911
-128, 125, 125, 129, 134, 136, 142, 146, // 912-919
-142, 141, 130, 112, 131,  98, 107, 128, // 920-927
-107, 122, 136, 127, 131, 136, 127, 131, // 928-935
-124, 129, 128, 125, 129, 128, 124, 126, // 936-943
-122, 130, 125, 128, 137, 136, 141, 143, // 944-951
-141, 137, 118, 129, 112,  99, 126, 111, // 952-959
-114, 136, 125, 128, 139, 128, 131, 130, // 960-967
-126, 128, 128, 129, 129, 126, 126, 125, // 968-975
-125, 129, 127, 131, 136, 138, 140, 141, // 976-983
-141, 127, 127, 124,  99, 118, 115, 106, // 984-991
-127, 126, 122, 137, 132, 129, 134, 128, // 992-999
-126, 132, 129, 127, 126, 130, 124, 122, // 1000-1007
-133, 123, 130, 139, 133, 138, 144, 136, // 1008-1015
-135, 128, 131, 106, 115, 117, 103, 122, // 1016-1023
-125, 117, 132, 132, 126, 137, 131, 127, // 1024-1031
-132, 130, 125, 126, 131, 125, 121, 135, // 1032-1039
-122, 129, 139, 130, 136, 143, 133, 138, // 1040-1047
-130, 128, 120, 111, 122, 106, 116, 123, // 1048-1055
-117, 128, 131, 125, 134, 133, 128, 132, // 1056-1063
-131, 126, 127, 127, 126, 122, 128, 129, // 1064-1071
-125, 136, 134, 134, 141, 137, 137, 133, // 1072-1079
-130, 124, 112, 123, 109, 111, 123, 117, // 1080-1087
-122, 130, 125, 131, 136, 130, 131, 134, // 1088-1095
-129, 125, 128, 126, 121, 127, 128, 125, // 1096-1103
-135, 135, 134, 141, 138, 137, 135, 130, // 1104-1111
-129, 115, 121, 115, 108, 121, 117, 118, // 1112-1119
-127, 125, 126, 134, 132, 132, 133, 133, // 1120-1127
-127, 128, 129, 120, 126, 129, 124, 133, // 1128-1135
-136, 133, 140, 138, 136, 136, 131, 127, // 1136-1143
-117, 121, 115, 110, 120, 117, 118, 126, // 1144-1151
-125, 124, 132, 132, 129, 134, 132, 128, // 1152-1159
-129, 127, 124, 125, 126, 128, 131, 135, // 1160-1167
-136, 137, 140, 139, 134, 132, 129, 116, // 1168-1175
-120, 118, 110, 120, 121, 117, 125, 128, // 1176-1183
-123, 129, 134, 129, 132, 135, 128, 129, // 1184-1191
-130, 122, 122, 129, 123, 129, 135, 132, // 1192-1199
-137, 141, 137, 136, 134, 128, 118, 119, // 1200-1207
-117, 110, 119, 119, 118, 125, 127, 124, // 1208-1215
-129, 131, 129, 132, 135, 129, 131, 131, // 1216-1223
-124, 125, 127, 125, 128, 133, 133, 137, // 1224-1231
-139, 138, 139, 134, 132, 123, 118, 118, // 1232-1239
-111, 115, 119, 118, 122, 126, 126, 127, // 1240-1247
-131, 131, 130, 133, 131, 128, 130, 127, // 1248-1255
-123, 126, 127, 126, 131, 134, 134, 138, // 1256-1263
-140, 137, 135, 134, 125, 119, 120, 111, // 1264-1271
-113, 119, 117, 120, 126, 125, 126, 132, // 1272-1279
-132, 130, 133, 132, 128, 130, 129, 123, // 1280-1287
-126, 128, 125, 131, 134, 132, 137, 140, // 1288-1295
-137, 136, 135, 129, 121, 121, 115, 111, // 1296-1303
-117, 118, 117, 123, 125, 125, 130, 133, // 1304-1311
-130, 132, 133, 129, 129, 130, 125, 125, // 1312-1319
-128, 125, 128, 133, 132, 135, 138, 138, // 1320-1327
-138, 136, 133, 125, 120, 119, 113, 113, // 1328-1335
-118, 118, 119, 124, 126, 127, 131, 133, // 1336-1343
-130, 132, 132, 129, 129, 128, 124, 124, // 1344-1351
-128, 126, 129, 134, 133, 135, 139, 139, // 1352-1359
-136, 136, 131, 122, 119, 117, 112, 116, // 1360-1367
-119, 117, 121, 126, 125, 128, 133, 131, // 1368-1375
-131, 133, 131, 128, 129, 125, 124, 126, // 1376-1383
-126, 127, 132, 133, 135, 137, 139, 138, // 1384-1391
-134, 133, 126, 119, 119, 114, 114, 118, // 1392-1399
-119, 120, 124, 127, 126, 131, 133, 130, // 1400-1407
-132, 133, 128, 129, 128, 125, 126, 126, // 1408-1415
-127, 130, 133, 134, 136, 138, 139, 135, // 1416-1423
-133, 129, 119, 118, 116, 113, 116, 119, // 1424-1431
-119, 122, 127, 126, 129, 132, 131, 131, // 1432-1439
-133, 130, 128, 130, 125, 125, 127, 126, // 1440-1447
-128, 132, 132, 136, 138, 138, 138, 134, // 1448-1455
-130, 123, 119, 117, 113, 115, 118, 119, // 1456-1463
-121, 125, 126, 127, 131, 131, 130, 132, // 1464-1471
-131, 128, 130, 127, 125, 127, 127, 127, // 1472-1479
-131, 132, 135, 138, 138, 139, 135, 132, // 1480-1487
-126, 119, 118, 115, 114, 118, 120, 121, // 1488-1495
-125, 127, 127, 130, 131, 129, 131, 132, // 1496-1503
-129, 128, 129, 125, 125, 128, 126, 129, // 1504-1511
-134, 135, 137, 139, 139, 135, 133, 129, // 1512-1519
-119, 118, 116, 112, 117, 120, 119, 124, // 1520-1527
-127, 127, 129, 133, 130, 130, 133, 129, // 1528-1535
-127, 130, 125, 124, 128, 126, 129, 134, // 1536-1543
-135, 137, 139, 139, 136, 132, 129, 119, // 1544-1551
-117, 117, 112, 117, 121, 120, 124, 128, // 1552-1559
-127, 129, 132, 131, 129, 132, 129, 126, // 1560-1567
-130, 124, 124, 128, 126, 130, 134, 134, // 1568-1575
-138, 139, 138, 136, 129, 127, 118, 115, // 1576-1583
-117, 113, 118, 121, 122, 126, 129, 129, // 1584-1591
-130, 132, 131, 130, 132, 129, 126, 129, // 1592-1599
-124, 125, 128, 126, 130, 133, 134, 139, // 1600-1607
-138, 138, 136, 128, 127, 118, 114, 116, // 1608-1615
-113, 118, 121, 123, 126, 129, 129, 130, // 1616-1623
-132, 131, 130, 132, 129, 127, 128, 125, // 1624-1631
-125, 127, 127, 131, 134, 136, 139, 138, // 1632-1639
-139, 134, 127, 125, 115, 113, 115, 112, // 1640-1647
-118, 122, 124, 127, 130, 130, 130, 132, // 1648-1655
-131, 130, 132, 128, 128, 127, 126, 127, // 1656-1663
-127, 129, 132, 134, 138, 140, 137, 139, // 1664-1671
-130, 125, 123, 112, 113, 115, 113, 119, // 1672-1679
-123, 124, 128, 130, 130, 130, 132, 131, // 1680-1687
-130, 132, 128, 129, 126, 126, 127, 126, // 1688-1695
-129, 133, 135, 139, 140, 137, 138, 128, // 1696-1703
-123, 120, 110, 113, 115, 114, 121, 125, // 1704-1711
-126, 128, 131, 130, 131, 132, 131, 131, // 1712-1719
-129, 129, 129, 124, 127, 127, 126, 132, // 1720-1727
-134, 136, 142, 139, 138, 136, 123, 122, // 1728-1735
-115, 108, 114, 115, 116, 123, 127, 127, // 1736-1743
-130, 131, 131, 131, 131, 131, 131, 128, // 1744-1751
-130, 128, 124, 129, 127, 127, 133, 135, // 1752-1759
-137, 142, 137, 138, 131, 119, 121, 111, // 1760-1767
-109, 115, 117, 119, 126, 128, 128, 130, // 1768-1775
-131, 130, 130, 131, 131, 130, 128, 131, // 1776-1783
-127, 126, 129, 128, 129, 134, 136, 139, // 1784-1791
-141, 136, 137, 125, 118, 119, 109, 110, // 1792-1799
-116, 117, 120, 127, 130, 128, 130, 131, // 1800-1807
-130, 130, 131, 131, 131, 127, 129, 129, // 1808-1815
-123, 128, 130, 129, 133, 139, 140, 140, // 1816-1823
-138, 137, 124, 117, 119, 108, 109, 116, // 1824-1831
-119, 120, 126, 131, 128, 129, 131, 131, // 1832-1839
-128, 130, 133, 130, 126, 131, 128, 123, // 1840-1847
-128, 131, 129, 133, 140, 142, 138, 137, // 1848-1855
-138, 121, 116, 119, 108, 110, 117, 122, // 1856-1863
-121, 127, 131, 129, 127, 130, 131, 127, // 1864-1871
-129, 132, 131, 125, 130, 130, 123, 127, // 1872-1879
-132, 130, 131, 141, 143, 137, 137, 136, // 1880-1887
-119, 115, 117, 109, 110, 119, 124, 123, // 1888-1895
-128, 133, 130, 126, 129, 131, 126, 128, // 1896-1903
-133, 132, 125, 130, 131, 123, 125, 133, // 1904-1911
-131, 131, 141, 144, 138, 135, 136, 120, // 1912-1919
-113, 115, 110, 109, 118, 126, 124, 128, // 1920-1927
-133, 131, 125, 129, 132, 128, 128, 132, // 1928-1935
-134, 125, 127, 131, 124, 122, 131, 133, // 1936-1943
-130, 138, 146, 139, 133, 135, 123, 110, // 1944-1951
-114, 111, 107, 116, 127, 125, 125, 135, // 1952-1959
-134, 126, 126, 134, 129, 125, 132, 136, // 1960-1967
-126, 125, 133, 126, 121, 128, 134, 130, // 1968-1975
-135, 146, 142, 134, 135, 124, 109, 114, // 1976-1983
-113, 106, 113, 129, 129, 122, 134, 138, // 1984-1991
-126, 123, 134, 132, 124, 128, 137, 131, // 1992-1999
-121, 131, 133, 122, 123, 136, 136, 132, // 2000-2007
-142, 147, 136, 131, 127, 112, 110, 111, // 2008-2015
-108, 111, 124, 130, 123, 130, 136, 130, // 2016-2023
-122, 130, 133, 126, 126, 134, 133, 124, // 2024-2031
-129, 131, 125, 125, 133, 135, 135, 143, // 2032-2039
-145, 138, 134, 129, 111, 109, 115, 110, // 2040-2047
-106, 122, 134, 123, 123, 136, 135, 122, // 2048-2055
-126, 135, 129, 123, 131, 135, 125, 126, // 2056-2063
-131, 128, 124, 130, 136, 135, 140, 146, // 2064-2071
-141, 134, 132, 117, 106, 113, 114, 107, // 2072-2079
-114, 133, 130, 121, 131, 139, 128, 121, // 2080-2087
-131, 134, 126, 126, 133, 129, 126, 127, // 2088-2095
-128, 126, 129, 133, 134, 140, 147, 141, // 2096-2103
-134, 136, 122, 105, 111, 118, 109, 107, // 2104-2111
-130, 136, 121, 124, 141, 135, 120, 126, // 2112-2119
-135, 129, 123, 129, 132, 128, 126, 127, // 2120-2127
-127, 128, 131, 132, 138, 146, 143, 134, // 2128-2135
-134, 127, 106, 106, 117, 113, 106, 123, // 2136-2143
-138, 127, 121, 136, 139, 123, 122, 133, // 2144-2151
-133, 125, 127, 132, 129, 128, 127, 125, // 2152-2159
-128, 134, 133, 134, 145, 148, 136, 131, // 2160-2167
-130, 112, 104, 114, 115, 108, 117, 136, // 2168-2175
-131, 122, 133, 140, 127, 121, 131, 134, // 2176-2183
-126, 125, 131, 129, 127, 127, 125, 127, // 2184-2191
-133, 134, 133, 142, 148, 138, 130, 130, // 2192-2199
-116, 103, 111, 117, 109, 112, 133, 136, // 2200-2207
-123, 128, 141, 134, 121, 126, 135, 130, // 2208-2215
-122, 126, 133, 131, 124, 123, 132, 134, // 2216-2223
-130, 133, 147, 148, 136, 133, 132, 114, // 2224-2231
-102, 111, 117, 108, 112, 132, 135, 123, // 2232-2239
-128, 139, 133, 121, 125, 133, 129, 121, // 2240-2247
-126, 135, 131, 123, 125, 134, 132, 128, // 2248-2255
-135, 148, 147, 136, 136, 133, 114, 102, // 2256-2263
-112, 117, 109, 112, 131, 136, 125, 127, // 2264-2271
-138, 134, 122, 124, 132, 129, 123, 127, // 2272-2279
-133, 131, 126, 126, 130, 132, 131, 135, // 2280-2287
-145, 147, 139, 135, 129, 112, 103, 111, // 2288-2295
-115, 108, 114, 132, 135, 125, 128, 138, // 2296-2303
-134, 123, 125, 132, 130, 124, 124, 131, // 2304-2311
-133, 126, 123, 130, 135, 132, 132, 145, // 2312-2319
-150, 138, 131, 130, 113, 102, 110, 116, // 2320-2327
-109, 113, 133, 136, 125, 127, 139, 134, // 2328-2335
-122, 125, 133, 129, 122, 128, 133, 130, // 2336-2343
-125, 127, 130, 130, 132, 138, 145, 145, // 2344-2351
-139, 135, 126, 108, 104, 114, 113, 108, // 2352-2359
-117, 135, 134, 125, 129, 138, 132, 122, // 2360-2367
-125, 132, 129, 123, 127, 132, 131, 126, // 2368-2375
-125, 130, 133, 133, 136, 146, 147, 139, // 2376-2383
-131, 122, 109, 107, 112, 110, 110, 123, // 2384-2391
-134, 131, 127, 134, 136, 129, 124, 127, // 2392-2399
-130, 128, 124, 127, 132, 132, 124, 123, // 2400-2407
-133, 135, 131, 136, 149, 146, 134, 129, // 2408-2415
-121, 108, 107, 114, 111, 111, 126, 135, // 2416-2423
-130, 128, 136, 137, 128, 124, 128, 130, // 2424-2431
-127, 122, 127, 135, 131, 121, 124, 137, // 2432-2439
-135, 129, 140, 151, 143, 131, 126, 115, // 2440-2447
-106, 110, 112, 107, 115, 132, 134, 127, // 2448-2455
-131, 139, 134, 124, 127, 131, 129, 123, // 2456-2463
-124, 134, 133, 124, 123, 134, 136, 129, // 2464-2471
-135, 148, 146, 135, 132, 121, 106, 108, // 2472-2479
-114, 109, 108, 124, 134, 130, 129, 135, // 2480-2487
-136, 130, 127, 127, 128, 130, 125, 126, // 2488-2495
-133, 134, 124, 123, 135, 136, 131, 138, // 2496-2503
-147, 141, 133, 127, 112, 107, 113, 113, // 2504-2511
-106, 114, 131, 133, 129, 130, 137, 136, // 2512-2519
-129, 125, 128, 131, 127, 124, 130, 135, // 2520-2527
-129, 123, 131, 136, 133, 134, 143, 143, // 2528-2535
-135, 131, 118, 108, 111, 113, 108, 110, // 2536-2543
-125, 131, 130, 130, 134, 136, 130, 127, // 2544-2551
-126, 128, 126, 127, 131, 130, 129, 129, // 2552-2559
-131, 131, 132, 138, 142, 141, 136, 134, // 2560-2567
-121, 110, 111, 113, 111, 110, 121, 129, // 2568-2575
-131, 131, 132, 134, 131, 130, 128, 126, // 2576-2583
-126, 131, 132, 126, 128, 132, 131, 129, // 2584-2591
-132, 139, 141, 140, 137, 132, 122, 113, // 2592-2599
-113, 112, 111, 112, 118, 127, 130, 131, // 2600-2607
-132, 135, 133, 130, 129, 127, 127, 129, // 2608-2615
-131, 127, 128, 131, 130, 130, 132, 137, // 2616-2623
-139, 138, 135, 130, 122, 116, 115, 113, // 2624-2631
-112, 113, 117, 124, 129, 130, 131, 134, // 2632-2639
-135, 132, 129, 127, 129, 131, 129, 127, // 2640-2647
-130, 130, 129, 130, 133, 134, 135, 136, // 2648-2655
-134, 128, 123, 122, 120, 117, 116, 117, // 2656-2663
-118, 122, 125, 126, 127, 130, 131, 131, // 2664-2671
-131, 130, 130, 133, 131, 130, 130, 128, // 2672-2679
-128, 129, 130, 131, 132, 133, 133, 129, // 2680-2687
-126, 126, 125, 121, 119, 119, 119, 119, // 2688-2695
-121, 122, 123, 126, 129, 130, 131, 131, // 2696-2703
-133, 134, 134, 133, 131, 130, 130, 130, // 2704-2711
-130, 131, 131, 131, 131, 130, 127, 126, // 2712-2719
-125, 123, 121, 120, 119, 119, 119, 120, // 2720-2727
-122, 124, 127, 129, 130, 131, 133, 133, // 2728-2735
-133, 133, 132, 132, 132, 131, 131, 132, // 2736-2743
-131, 130, 130, 129, 127, 126, 124, 123, // 2744-2751
-122, 121, 120, 120, 120, 121, 122, 124, // 2752-2759
-126, 128, 131, 132, 132, 132, 133, 133, // 2760-2767
-132, 132, 132, 132, 132, 132, 131, 129, // 2768-2775
-128, 127, 126, 126, 125, 124, 124, 122, // 2776-2783
-122, 121, 121, 121, 122, 125, 126, 128, // 2784-2791
-130, 132, 131, 131, 132, 131, 131, 131, // 2792-2799
-132, 132, 132, 131, 129, 128, 127, 126, // 2800-2807
-125, 125, 125, 125, 124, 123, 123, 122, // 2808-2815
-122, 122, 123, 125, 126, 128, 129, 130, // 2816-2823
-131, 130, 131, 131, 132, 133, 133, 132, // 2824-2831
-132, 131, 129, 128, 126, 126, 126, 125, // 2832-2839
-125, 126, 126, 125, 124, 124, 123, 123, // 2840-2847
-124, 126, 126, 127, 129, 129, 129, 129, // 2848-2855
-129, 130, 131, 132, 132, 132, 132, 130, // 2856-2863
-129, 127, 126, 125, 125, 125, 124, 124, // 2864-2871
-125, 125, 124, 124, 125, 125, 126, 127, // 2872-2879
-127, 128, 129, 129, 129, 129, 129, 129, // 2880-2887
-130, 131, 131, 131, 131, 130, 129, 127, // 2888-2895
-127, 126, 126, 126, 126, 126, 126, 126, // 2896-2903
-125, 125, 125, 126, 127, 127, 127, 128, // 2904-2911
-128, 129, 129, 129, 128, 129, 129, 129, // 2912-2919
-129, 129, 129, 128, 128, 128, 127, 127, // 2920-2927
-126, 126, 126, 126, 126, 126, 126, 126, // 2928-2935
-126, 127, 127, 127, 127, 128, 128, 128, // 2936-2943
-128, 129, 129, 128, 128, 128, 129, 129, // 2944-2951
-129, 129, 129, 129, 128, 127, 126, 126, // 2952-2959
-126, 126, 127, 127, 126, 127, 127, 128, // 2960-2967
-127, 127, 128, 128, 128, 128, 128, 128, // 2968-2975
-128, 128, 128, 128, 128, 128, 128, 128, // 2976-2983
-129, 128, 128, 127, 127, 127, 126, 126, // 2984-2991
-127, 126, 127, 127, 127, 127, 127, 127, // 2992-2999
-127, 127, 127, 127, 128, 128, 128, 128, // 3000-3007
-128, 128, 128, 128, 128, 128, 128, 129, // 3008-3015
-128, 128, 128, 128, 128, 128, 128, 128, // 3016-3023
-127, 128, 128, 127, 127, 127, 127, 127, // 3024-3031
-127, 127, 127, 127, 127, 127, 127, 127, // 3032-3039
-127, 127, 127, 127, 127, 128, 128, 128, // 3040-3047
-128, 128, 128, 128, 128, 128, 128, 128, // 3048-3055
-128, 128, 127, 127, 127, 127, 127, 127, // 3056-3063
-128, 128, 127, 127, 127, 127, 127, 127, // 3064-3071
-127, 128, 127, 127, 128, 128, 128, 127, // 3072-3079
-127, 128, 128, 128, 128, 128, 128, 128, // 3080-3087
-128, 128, 128, 128, 128, 128, 128, 128, // 3088-3095
-128, 128, 127, 127, 127, 127, 127, 127, // 3096-3103
-127, 127, 127, 127, 127, 127, 127, 127, // 3104-3111
-127, 128, 128, 127, 128, 128, 128, 128, // 3112-3119
-128, 128, 128, 128, 128, 128, 128, 128, // 3120-3127
-128, 127, 127, 127, 127, 127, 127, 127, // 3128-3135
-127, 127, 127, 127, 127, 127, 127, 127, // 3136-3143
-127, 128, 128, 128, 128, 128, 129, 128, // 3144-3151
-128, 128, 128, 129, 128, 128, 128, 128, // 3152-3159
-127, 127, 127, 127, 127, 127, 127, 127, // 3160-3167
-127, 127, 127, 127, 127, 127, 127, 127, // 3168-3175
-127, 127, 127, 127, 127, 127, 127, 128, // 3176-3183
-127, 128, 128, 128, 128, 128, 128, 128, // 3184-3191
-128, 128, 127, 128, 128, 128, 128, 128, // 3192-3199
-128, 128, 127, 127, 127, 127, 127, 127, // 3200-3207
-127, 127, 127, 127, 127, 127, 127, 128, // 3208-3215
-128, 128, 128, 128, 128, 128, 128, 128, // 3216-3223
-128, 128, 128, 128, 128, 128, 128, 128, // 3224-3231
-128, 128, 127, 127, 128, 127, 127, 127, // 3232-3239
-127, 127, 127, 127, 127, 127, 127, 128, // 3240-3247
-128, 128, 128, 128, 127, 127, 127, 127, // 3248-3255
-127, 127, 128, 128, 128, 128, 128, 128, // 3256-3263
-128, 128, 128, 127, 127, 127, 127, 127, // 3264-3271
-127, 127, 127, 128, 128, 128, 128, 128, // 3272-3279
-128, 128, 128, 128, 128, 128, 128, 128, // 3280-3287
-128, 128, 128, 128, 128, 128, 128, 127, // 3288-3295
-127, 127, 127, 127, 127, 127, 127, 127, // 3296-3303
-127, 127, 127, 127, 128, 128, 127, 127, // 3304-3311
-127, 127, 127, 127, 127, 127, 127, 128, // 3312-3319
-128, 128, 128, 128, 128, 128, 128, 128, // 3320-3327
-128, 128, 128, 128, 128, 127, 128, 128, // 3328-3335
-128, 127, 128, 128, 128, 127, 127, 127, // 3336-3343
-127, 127, 127, 127, 127, 127, 127, 127, // 3344-3351
-128, 128, 128, 128, 128, 128, 128, 128, // 3352-3359
-128, 128, 128, 128, 128, 128, 128, 128, // 3360-3367
-128, 128, 128, 128, 128, 128, 128, 127, // 3368-3375
-127, 127, 127, 127, 127, 127, 127, 127, // 3376-3383
-127, 127, 127, 127, 127, 127, 127, 127, // 3384-3391
-127, 127, 127, 127, 128, 128, 128, 128, // 3392-3399
-128, 128, 128, 128, 128, 128, 128, 128, // 3400-3407
-127, 128, 128, 128, 128, 128, 128, 128, // 3408-3415
-128, 127, 128, 128, 128, 128, 128, 128, // 3416-3423
-127, 127, 127, 127, 127, 127, 127, 127, // 3424-3431
-127, 127, 127, 127, 127, 127, 127, 127, // 3432-3439
-128, 128, 128, 128, 128, 128, 128, 127, // 3440-3447
-127, 128, 127, 127, 128, 128, 127, 127, // 3448-3455
-127, 127, 127, 127, 128, 128, 128, 128, // 3456-3463
-128, 128, 127, 127, 127, 127, 127, 127, // 3464-3471
-127, 128, 127, 127, 127, 127, 127, 127, // 3472-3479
-127, 127, 127, 127, 127, 128, 128, 128, // 3480-3487
-128, 128, 128, 128, 128, 128, 128, 128, // 3488-3495
-128, 127, 127, 128, 128, 128, 128, 128, // 3496-3503
-128, 128, 128, 128, 128, 128, 128, 128, // 3504-3511
-128, 128, 128, 127, 128, 127, 127, 127, // 3512-3519
-127, 127, 127, 127, 127, 127, 127, 127, // 3520-3527
-127, 127, 127, 127, 127, 127, 128, 128, // 3528-3535
-128, 128, 128, 128, 128, 128, 128, 128, // 3536-3543
-128, 128, 128, 128, 128, 128, 128, 128, // 3544-3551
-128, 128, 128, 128, 128, 128, 128, 127, // 3552-3559
-127, 127, 127, 127, 127, 127, 127, 127, // 3560-3567
-127, 127, 127, 127, 127, 127, 127, 127, // 3568-3575
-127, 127, 127, 127, 127, 127, 128, 128, // 3576-3583
-128, 128, 128, 128, 128, 128, 128, 128, // 3584-3591
-128, 128, 128, 128, 128, 128, 128, 128, // 3592-3599
-128, 128, 128, 128, 128, 127, 127, 127, // 3600-3607
-127, 127, 127, 127, 127, 127, 127, 127, // 3608-3615
-127, 127, 127, 127, 127, 127, 127, 128, // 3616-3623
-128, 128, 128, 128, 128, 128, 128, 128, // 3624-3631
-128, 128, 128, 128, 128, 128, 128, 128, // 3632-3639
-128, 128, 128, 128, 128, 128, 128, 128, // 3640-3647
-127, 127, 127, 127, 127, 127, 127, 127, // 3648-3655
-127, 127, 127, 127, 127, 127, 128, 128, // 3656-3663
-128, 128, 128, 128, 128, 128, 127, 127, // 3664-3671
-127, 128, 127, 128, 128, 127, 128, 128, // 3672-3679
-128, 128, 128, 128, 128, 127, 128, 128, // 3680-3687
-128, 128, 127, 127, 127, 128, 127, 128, // 3688-3695
-127, 128, 127, 128, 127, 128, 127, 127, // 3696-3703
-127, 128, 128, 127, 127, 127, 127, 127, // 3704-3711
-127, 127, 127, 128, 128, 128, 128, 128, // 3712-3719
-128, 128, 128, 128, 128, 128, 127, 127, // 3720-3727
-128, 127, 127, 127, 128, 127, 127, 127, // 3728-3735
-127, 127, 128, 127, 127, 127, 127, 127, // 3736-3743
-128, 128, 128, 127, 128, 128, 128, 128, // 3744-3751
-128, 127, 128, 128, 128, 127, 128, 128, // 3752-3759
-128, 127, 128, 127, 128, 127, 128, 128, // 3760-3767
-127, 128, 127, 127, 128, 127, 128, 127, // 3768-3775
-128, 127, 127, 127, 127, 127, 128, 127, // 3776-3783
-128, 127, 128, 128, 128, 128, 128, 127, // 3784-3791
-128, 127, 127, 127, 128, 128, 127, 127, // 3792-3799
-128, 127, 129, 127, 127, 127, 128, 128, // 3800-3807
-127, 125, 130, 128, 128, 127, 127, 127, // 3808-3815
-128, 126, 129, 127, 129, 123, 120, 138, // 3816-3823
-129, 130, 125, 129, 127, 127, 127, 130, // 3824-3831
-126, 130, 119, 125, 134, 129, 129, 126, // 3832-3839
-130, 129, 125, 127, 128, 128, 129, 123, // 3840-3847
-127, 129, 127, 128, 125, 129, 129, 126, // 3848-3855
-126, 128, 128, 127, 126, 128, 128, 129, // 3856-3863
-129, 127, 128, 129, 127, 126, 128, 126, // 3864-3871
-128, 125, 129, 127, 128, 128, 127, 127, // 3872-3879
-128, 128, 128, 127, 127, 128, 126, 129, // 3880-3887
-128, 127, 128, 127, 126, 127, 128, 127, // 3888-3895
-127, 127, 128, 126, 128, 128, 129, 127, // 3896-3903
-128, 126, 128, 127, 128, 127, 128, 129, // 3904-3911
-128, 127, 129, 128, 127, 127, 128, 129, // 3912-3919
-126, 127, 123, 129, 129, 129, 128, 130, // 3920-3927
-128, 127, 125, 128, 126, 128, 125, 127, // 3928-3935
-128, 129, 126, 127, 128, 129, 128, 126, // 3936-3943
-128, 127, 129, 126, 127, 129, 127, 128, // 3944-3951
-127, 128, 129, 126, 128, 127, 128, 126, // 3952-3959
-126, 127, 129, 126, 130, 126, 128, 127, // 3960-3967
-127, 128, 128, 126, 129, 125, 129, 126, // 3968-3975
-128, 127, 128, 127, 128, 127, 130, 127, // 3976-3983
-127, 129, 127, 128, 127, 128, 127, 128, // 3984-3991
-127, 128, 127, 128, 127, 127, 128, 127, // 3992-3999
-128, 127, 127, 128, 126, 128, 128, 128, // 4000-4007
-127, 127, 128, 127, 128, 128, 128, 127, // 4008-4015
-128, 126, 128, 127, 128, 127, 128, 129, // 4016-4023
-126, 128, 127, 128, 127, 127, 127, 128, // 4024-4031
-128, 128, 127, 128, 128, 126, 128, 127, // 4032-4039
-130, 128, 127, 129, 128, 129, 127, 128, // 4040-4047
-127, 128, 127, 128, 126, 129, 126, 127, // 4048-4055
-127, 128, 127, 127, 126, 128, 125, 128, // 4056-4063
-127, 128, 128, 127, 127, 128, 127, 129, // 4064-4071
-127, 128, 128, 127, 129, 128, 127, 129, // 4072-4079
-128, 128, 127, 128, 128, 127, 128, 127, // 4080-4087
-126, 128, 126, 127, 128, 127, 129, 126, // 4088-4095
-128, 127, 128, 127, 127, 127, 129, 127, // 4096-4103
-128, 127, 129, 127, 127, 128, 129, 127, // 4104-4111
-128, 128, 129, 127, 127, 128, 127, 128, // 4112-4119
-127, 127, 128, 127, 126, 127, 128, 128, // 4120-4127
-127, 127, 128, 127, 127, 128, 127, 127, // 4128-4135
-127, 128, 128, 127, 128, 127, 127, 128, // 4136-4143
-127, 128, 128, 127, 128, 128, 128, 128, // 4144-4151
-128, 128, 127, 128, 128, 128, 128, 128, // 4152-4159
-127, 127, 128, 127, 127, 126, 127, 127, // 4160-4167
-128, 129, 129, 129, 128, 128, 127, 126, // 4168-4175
-125, 125, 124, 127, 128, 131, 132, 132, // 4176-4183
-130, 128, 127, 126, 123, 122, 122, 125, // 4184-4191
-128, 130, 133, 135, 134, 130, 128, 130, // 4192-4199
-124, 116, 115, 121, 127, 128, 132, 138, // 4200-4207
-139, 134, 128, 130, 129, 120, 108, 113, // 4208-4215
-124, 128, 130, 136, 144, 141, 131, 130, // 4216-4223
-132, 125, 113, 105, 116, 125, 127, 133, // 4224-4231
-141, 145, 137, 130, 132, 128, 118, 110, // 4232-4239
-109, 120, 126, 131, 139, 142, 139, 134, // 4240-4247
-131, 128, 121, 115, 112, 117, 125, 130, // 4248-4255
-138, 141, 136, 133, 132, 125, 119, 114, // 4256-4263
-114, 119, 125, 131, 141, 142, 136, 132, // 4264-4271
-130, 123, 115, 111, 114, 123, 128, 134, // 4272-4279
-145, 147, 138, 132, 130, 121, 110, 105, // 4280-4287
-112, 124, 128, 136, 148, 150, 139, 133, // 4288-4295
-129, 120, 108, 101, 109, 122, 128, 136, // 4296-4303
-150, 152, 141, 134, 130, 120, 110, 103, // 4304-4311
-107, 121, 128, 137, 149, 151, 143, 136, // 4312-4319
-128, 118, 112, 105, 107, 120, 130, 138, // 4320-4327
-148, 148, 141, 134, 124, 115, 111, 107, // 4328-4335
-109, 121, 131, 141, 150, 147, 140, 132, // 4336-4343
-121, 112, 110, 106, 112, 125, 135, 144, // 4344-4351
-152, 149, 140, 130, 117, 109, 108, 105, // 4352-4359
-111, 127, 139, 147, 154, 151, 142, 130, // 4360-4367
-113, 106, 106, 102, 107, 124, 138, 148, // 4368-4375
-155, 152, 146, 133, 114, 105, 106, 103, // 4376-4383
-105, 122, 138, 147, 156, 154, 147, 137, // 4384-4391
-116, 106, 107, 103, 105, 118, 135, 147, // 4392-4399
-155, 155, 148, 138, 119, 104, 106, 104, // 4400-4407
-103, 115, 131, 145, 155, 156, 149, 140, // 4408-4415
-124, 104, 100, 107, 103, 110, 128, 143, // 4416-4423
-155, 159, 152, 146, 130, 107,  96, 103, // 4424-4431
-105, 105, 122, 142, 153, 163, 157, 150, // 4432-4439
-138, 114,  95,  96, 102, 104, 114, 136, // 4440-4447
-150, 161, 164, 154, 142, 123, 100,  94, // 4448-4455
- 96,  98, 109, 127, 145, 156, 167, 164, // 4456-4463
-149, 132, 111,  91,  91,  97, 102, 117, // 4464-4471
-137, 152, 170, 170, 157, 144, 125,  99, // 4472-4479
- 82,  90, 100, 107, 126, 146, 161, 176, // 4480-4487
-167, 153, 137, 113,  89,  80,  89, 101, // 4488-4495
-112, 134, 150, 165, 179, 167, 149, 129, // 4496-4503
-105,  84,  74,  88, 109, 118, 137, 156, // 4504-4511
-175, 181, 162, 146, 128, 101,  74,  73, // 4512-4519
- 96, 110, 119, 143, 159, 178, 183, 163, // 4520-4527
-143, 119,  98,  75,  64,  87, 114, 128, // 4528-4535
-142, 155, 182, 190, 166, 138, 115, 102, // 4536-4543
- 80,  58,  79, 109, 131, 146, 153, 177, // 4544-4551
-193, 175, 146, 118, 103,  88,  67,  76, // 4552-4559
- 86, 110, 154, 156, 159, 186, 192, 174, // 4560-4567
-129,  96, 104,  84,  61,  71,  99, 136, // 4568-4575
-151, 149, 175, 189, 185, 158, 120, 104, // 4576-4583
- 92,  71,  72,  79, 102, 137, 151, 160, // 4584-4591
-170, 183, 188, 159, 116,  98,  92,  78, // 4592-4599
- 65,  82, 110, 135, 154, 158, 166, 183, // 4600-4607
-186, 163, 120,  95,  96,  82,  66,  79, // 4608-4615
-108, 137, 151, 151, 162, 178, 185, 169, // 4616-4623
-124,  99,  99,  86,  69,  74, 107, 142, // 4624-4631
-135, 136, 164, 175, 175, 171, 147, 120, // 4632-4639
- 95,  86,  81,  76,  94, 121, 133, 146, // 4640-4647
-156, 160, 172, 179, 169, 132,  97,  94, // 4648-4655
- 89,  72,  78, 106, 139, 147, 134, 147, // 4656-4663
-171, 178, 175, 154, 119, 100,  87,  79, // 4664-4671
- 75,  89, 120, 140, 141, 147, 157, 168, // 4672-4679
-174, 170, 151, 111,  87,  87,  84,  80, // 4680-4687
- 94, 122, 151, 149, 144, 149, 162, 173, // 4688-4695
-173, 144, 102,  88,  94,  90,  81,  94, // 4696-4703
-127, 154, 145, 135, 143, 164, 168, 164, // 4704-4711
-149, 114,  90,  95,  91,  91,  96, 117, // 4712-4719
-145, 154, 147, 137, 133, 154, 165, 162, // 4720-4727
-137,  95,  92, 109, 101,  95, 100, 128, // 4728-4735
-150, 142, 135, 137, 145, 151, 152, 162, // 4736-4743
-139,  98,  99, 106, 107, 101, 100, 125, // 4744-4751
-148, 142, 135, 117, 133, 158, 161, 163, // 4752-4759
-151, 109, 107, 106, 101,  96,  94, 112, // 4760-4767
-139, 131, 131, 132, 145, 159, 159, 164, // 4768-4775
-169, 124,  93,  94, 100,  97,  88,  96, // 4776-4783
-131, 150, 148, 137, 133, 153, 156, 148, // 4784-4791
-161, 162, 114,  88,  86, 102, 105,  94, // 4792-4799
- 99, 132, 145, 145, 131, 143, 160, 157, // 4800-4807
-152, 162, 150, 112,  80,  86, 103, 103, // 4808-4815
- 95, 107, 137, 159, 152, 141, 136, 137, // 4816-4823
-144, 146, 146, 160, 138,  93,  88, 101, // 4824-4831
-111, 107,  98, 115, 140, 148, 144, 130, // 4832-4839
-139, 149, 146, 149, 159, 161, 120,  79, // 4840-4847
- 88, 107, 107, 101,  95, 125, 151, 153, // 4848-4855
-142, 134, 140, 145, 143, 143, 147, 161, // 4856-4863
-138,  80,  87, 104, 111, 105, 100, 116, // 4864-4871
-157, 157, 152, 123, 120, 128, 136, 136, // 4872-4879
-140, 137, 168, 158, 116,  91,  92, 105, // 4880-4887
-112, 101, 113, 135, 147, 149, 130, 123, // 4888-4895
-125, 131, 134, 136, 139, 157, 174, 158, // 4896-4903
-104,  82,  91, 107, 109, 103, 112, 141, // 4904-4911
-157, 157, 124, 111, 122, 130, 133, 130, // 4912-4919
-132, 156, 171, 178, 139,  78,  74,  96, // 4920-4927
-107, 108, 101, 124, 159, 166, 145, 115, // 4928-4935
-112, 130, 132, 131, 123, 131, 154, 168, // 4936-4943
-171, 156,  94,  73,  87, 106, 106, 104, // 4944-4951
-114, 147, 159, 163, 125, 111, 125, 132, // 4952-4959
-131, 128, 116, 133, 149, 161, 164, 161, // 4960-4967
-123,  75,  76,  99, 107, 111, 120, 133, // 4968-4975
-157, 166, 147, 114, 109, 114, 125, 131, // 4976-4983
-126, 122, 138, 149, 152, 160, 167, 145, // 4984-4991
- 92,  74,  89, 111, 120, 118, 119, 142, // 4992-4999
-154, 149, 122, 116, 115, 119, 125, 131, // 5000-5007
-127, 132, 139, 141, 145, 154, 157, 158, // 5008-5015
-136,  84,  77,  98, 117, 116, 119, 122, // 5016-5023
-138, 152, 150, 111, 114, 119, 124, 131, // 5024-5031
-131, 122, 132, 139, 141, 136, 146, 153, // 5032-5039
-157, 164, 111,  69,  85, 108, 114, 119, // 5040-5047
-115, 123, 142, 164, 142, 109, 117, 117, // 5048-5055
-128, 131, 129, 118, 139, 133, 140, 127, // 5056-5063
-141, 140, 162, 162, 166, 111,  81,  77, // 5064-5071
- 95, 105, 118, 124, 130, 140, 154, 153, // 5072-5079
-117, 104,  93, 113, 137, 147, 140, 140, // 5080-5087
-129, 134, 137, 134, 134, 138, 155, 158, // 5088-5095
-172, 129,  73,  66,  90, 102, 126, 136, // 5096-5103
-126, 132, 149, 151, 132, 126,  88,  96, // 5104-5111
-122, 147, 144, 153, 129, 121, 130, 134, // 5112-5119
-127, 129, 137, 146, 169, 169, 165, 101, // 5120-5127
- 70,  69, 101, 108, 130, 127, 119, 126, // 5128-5135
-146, 142, 138, 134,  96, 109, 125, 139, // 5136-5143
-132, 150, 120, 130, 126, 139, 121, 145, // 5144-5151
-129, 145, 154, 168, 147, 164, 103,  70, // 5152-5159
- 74, 104,  92, 129, 133, 118, 126, 153, // 5160-5167
-134, 140, 144, 116, 109, 113, 119, 130, // 5168-5175
-151, 134, 124, 118, 126, 126, 140, 137, // 5176-5183
-136, 137, 153, 154, 161, 160, 150,  89, // 5184-5191
- 68,  73,  97,  94, 139, 129, 125, 135, // 5192-5199
-152, 130, 152, 136, 115, 115, 120, 113, // 5200-5207
-131, 143, 127, 128, 127, 119, 122, 138, // 5208-5215
-132, 131, 146, 138, 148, 156, 157, 140, // 5216-5223
-161, 110,  73,  71,  93,  79, 127, 143, // 5224-5231
-125, 137, 152, 132, 134, 150, 115, 124, // 5232-5239
-122, 122, 112, 138, 120, 130, 126, 134, // 5240-5247
-117, 133, 130, 135, 141, 150, 137, 143, // 5248-5255
-144, 143, 146, 155, 137,  90,  74,  85, // 5256-5263
- 89,  99, 145, 135, 133, 146, 134, 118, // 5264-5271
-145, 126, 125, 131, 125, 116, 125, 123, // 5272-5279
-122, 128, 128, 130, 127, 137, 131, 138, // 5280-5287
-141, 143, 133, 139, 137, 142, 145, 144, // 5288-5295
-144, 109,  81,  84,  94,  88, 137, 139, // 5296-5303
-132, 142, 137, 115, 137, 135, 128, 137, // 5304-5311
-127, 121, 120, 127, 119, 128, 124, 132, // 5312-5319
-125, 141, 133, 136, 135, 135, 126, 135, // 5320-5327
-130, 136, 145, 150, 147, 150, 135,  90, // 5328-5335
- 75,  92,  87, 103, 146, 128, 132, 148, // 5336-5343
-127, 122, 143, 126, 133, 138, 131, 122, // 5344-5351
-128, 121, 122, 121, 129, 121, 124, 134, // 5352-5359
-131, 133, 142, 132, 132, 133, 126, 132, // 5360-5367
-141, 145, 152, 147, 145, 131,  91,  79, // 5368-5375
- 92,  86, 107, 141, 131, 143, 152, 131, // 5376-5383
-127, 136, 123, 129, 128, 129, 122, 127, // 5384-5391
-124, 125, 125, 133, 121, 127, 130, 125, // 5392-5399
-131, 135, 128, 132, 133, 131, 138, 140, // 5400-5407
-143, 142, 145, 139, 135, 124,  96,  83, // 5408-5415
-102,  97, 109, 139, 132, 136, 149, 130, // 5416-5423
-127, 137, 126, 131, 131, 126, 122, 123, // 5424-5431
-120, 122, 122, 134, 125, 122, 126, 121, // 5432-5439
-124, 140, 136, 141, 144, 136, 132, 131, // 5440-5447
-132, 138, 142, 145, 139, 131, 128,  99, // 5448-5455
- 89, 107,  98, 104, 137, 127, 135, 148, // 5456-5463
-132, 127, 136, 124, 127, 128, 127, 122, // 5464-5471
-123, 124, 122, 121, 132, 128, 129, 130, // 5472-5479
-121, 120, 130, 132, 140, 146, 141, 134, // 5480-5487
-131, 129, 130, 135, 139, 141, 139, 138, // 5488-5495
-129, 103,  93, 102,  98, 108, 133, 129, // 5496-5503
-136, 145, 132, 126, 132, 122, 126, 129, // 5504-5511
-130, 127, 128, 126, 124, 123, 132, 129, // 5512-5519
-131, 132, 124, 123, 127, 127, 134, 136, // 5520-5527
-135, 134, 131, 129, 128, 133, 140, 139, // 5528-5535
-142, 140, 130, 127, 110,  94, 104, 102, // 5536-5543
-105, 130, 129, 132, 144, 134, 129, 132, // 5544-5551
-125, 127, 128, 129, 128, 126, 127, 126, // 5552-5559
-123, 132, 129, 130, 135, 126, 121, 123, // 5560-5567
-118, 125, 133, 137, 140, 139, 135, 130, // 5568-5575
-127, 131, 132, 135, 140, 135, 133, 131, // 5576-5583
-109, 102, 109, 102, 110, 130, 128, 136, // 5584-5591
-142, 132, 128, 131, 124, 125, 126, 128, // 5592-5599
-127, 127, 127, 124, 124, 130, 129, 132, // 5600-5607
-135, 130, 128, 124, 119, 120, 125, 130, // 5608-5615
-137, 140, 141, 135, 129, 126, 125, 130, // 5616-5623
-134, 135, 139, 138, 136, 120, 103, 106, // 5624-5631
-106, 107, 126, 129, 130, 141, 132, 126, // 5632-5639
-129, 123, 124, 128, 128, 131, 131, 130, // 5640-5647
-128, 124, 127, 127, 127, 131, 131, 129, // 5648-5655
-132, 127, 122, 123, 125, 127, 132, 134, // 5656-5663
-134, 133, 132, 128, 129, 131, 132, 136, // 5664-5671
-140, 137, 135, 123, 108, 108, 107, 106, // 5672-5679
-121, 125, 126, 135, 133, 128, 130, 127, // 5680-5687
-128, 130, 131, 131, 129, 129, 125, 122, // 5688-5695
-127, 128, 127, 132, 131, 131, 132, 127, // 5696-5703
-122, 123, 124, 126, 131, 134, 134, 134, // 5704-5711
-133, 128, 128, 131, 131, 134, 138, 135, // 5712-5719
-134, 127, 111, 107, 108, 104, 116, 125, // 5720-5727
-126, 137, 137, 130, 131, 128, 124, 126, // 5728-5735
-127, 130, 130, 131, 130, 126, 125, 126, // 5736-5743
-125, 130, 132, 131, 133, 132, 129, 126, // 5744-5751
-124, 123, 123, 126, 130, 132, 134, 132, // 5752-5759
-130, 130, 130, 131, 134, 135, 136, 137, // 5760-5767
-130, 116, 111, 108, 104, 114, 123, 125, // 5768-5775
-135, 136, 131, 132, 129, 126, 128, 129, // 5776-5783
-130, 130, 129, 127, 125, 125, 125, 124, // 5784-5791
-128, 130, 130, 133, 130, 128, 128, 125, // 5792-5799
-124, 126, 124, 127, 130, 131, 133, 133, // 5800-5807
-132, 132, 132, 133, 133, 134, 133, 132, // 5808-5815
-125, 116, 114, 112, 110, 118, 122, 126, // 5816-5823
-134, 134, 132, 133, 129, 127, 128, 125, // 5824-5831
-126, 126, 126, 126, 126, 126, 128, 128, // 5832-5839
-131, 131, 130, 130, 130, 129, 129, 127, // 5840-5847
-125, 124, 123, 125, 126, 130, 131, 132, // 5848-5855
-133, 132, 132, 133, 133, 134, 134, 133, // 5856-5863
-130, 121, 116, 113, 107, 113, 120, 121, // 5864-5871
-129, 135, 132, 134, 132, 129, 129, 128, // 5872-5879
-128, 128, 128, 128, 126, 126, 127, 126, // 5880-5887
-129, 130, 130, 131, 130, 130, 130, 129, // 5888-5895
-129, 127, 125, 124, 124, 126, 130, 130, // 5896-5903
-131, 131, 129, 130, 130, 130, 132, 132, // 5904-5911
-133, 130, 122, 118, 115, 110, 116, 120, // 5912-5919
-123, 131, 133, 132, 134, 131, 129, 129, // 5920-5927
-127, 127, 127, 127, 128, 127, 128, 128, // 5928-5935
-128, 130, 129, 129, 130, 128, 128, 129, // 5936-5943
-129, 129, 128, 127, 125, 125, 125, 124, // 5944-5951
-126, 129, 130, 131, 132, 131, 132, 132, // 5952-5959
-133, 132, 133, 128, 121, 119, 116, 113, // 5960-5967
-118, 121, 123, 131, 133, 132, 135, 132, // 5968-5975
-129, 129, 126, 125, 126, 126, 126, 126, // 5976-5983
-128, 129, 129, 131, 130, 129, 129, 128, // 5984-5991
-128, 129, 128, 128, 128, 127, 126, 125, // 5992-5999
-124, 124, 124, 127, 128, 129, 131, 131, // 6000-6007
-131, 132, 133, 134, 133, 133, 131, 124, // 6008-6015
-120, 117, 113, 116, 121, 122, 129, 132, // 6016-6023
-132, 134, 132, 130, 129, 128, 127, 127, // 6024-6031
-127, 127, 126, 127, 127, 126, 127, 128, // 6032-6039
-128, 130, 130, 129, 130, 129, 128, 128, // 6040-6047
-128, 128, 127, 127, 126, 124, 125, 125, // 6048-6055
-126, 128, 128, 129, 131, 131, 131, 132, // 6056-6063
-131, 132, 132, 132, 130, 124, 120, 118, // 6064-6071
-115, 117, 120, 121, 127, 131, 132, 134, // 6072-6079
-133, 131, 130, 128, 127, 126, 126, 127, // 6080-6087
-126, 127, 128, 127, 128, 129, 128, 128, // 6088-6095
-129, 129, 129, 129, 129, 128, 128, 128, // 6096-6103
-127, 127, 127, 125, 125, 125, 124, 126, // 6104-6111
-128, 128, 129, 130, 130, 130, 131, 131, // 6112-6119
-133, 134, 133, 132, 129, 123, 120, 117, // 6120-6127
-115, 118, 120, 123, 127, 129, 130, 132, // 6128-6135
-131, 131, 131, 129, 128, 127, 126, 125, // 6136-6143
-125, 126, 126, 127, 129, 129, 130, 130, // 6144-6151
-130, 130, 130, 129, 128, 128, 127, 127, // 6152-6159
-126, 126, 126, 125, 126, 127, 128, 129, // 6160-6167
-129, 129, 129, 129, 130, 131, 133, 134, // 6168-6175
-133, 132, 129, 124, 122, 118, 115, 118, // 6176-6183
-119, 122, 127, 129, 130, 132, 132, 131, // 6184-6191
-130, 129, 128, 127, 127, 127, 126, 127, // 6192-6199
-127, 127, 128, 128, 129, 130, 129, 129, // 6200-6207
-129, 128, 128, 127, 127, 127, 127, 127, // 6208-6215
-127, 128, 128, 128, 128, 128, 127, 128, // 6216-6223
-128, 129, 129, 131, 131, 131, 131, 128, // 6224-6231
-125, 123, 120, 120, 122, 122, 124, 127, // 6232-6239
-128, 130, 131, 130, 131, 130, 129, 128, // 6240-6247
-127, 127, 127, 127, 127, 127, 127, 127, // 6248-6255
-127, 128, 129, 128, 129, 129, 129, 129, // 6256-6263
-128, 127, 126, 126, 126, 127, 127, 128, // 6264-6271
-128, 129, 129, 128, 129, 129, 130, 130, // 6272-6279
-130, 130, 128, 125, 124, 121, 120, 122, // 6280-6287
-122, 124, 127, 129, 130, 131, 131, 130, // 6288-6295
-129, 128, 128, 127, 127, 127, 126, 127, // 6296-6303
-127, 127, 129, 129, 129, 129, 129, 128, // 6304-6311
-128, 128, 128, 128, 127, 127, 127, 127, // 6312-6319
-127, 127, 127, 127, 127, 128, 128, 129, // 6320-6327
-130, 131, 131, 130, 129, 126, 124, 122, // 6328-6335
-120, 121, 122, 124, 127, 128, 129, 131, // 6336-6343
-132, 131, 131, 130, 129, 128, 127, 126, // 6344-6351
-125, 126, 126, 126, 127, 128, 129, 130, // 6352-6359
-130, 129, 129, 128, 127, 127, 127, 127, // 6360-6367
-127, 127, 127, 127, 127, 127, 127, 128, // 6368-6375
-128, 128, 129, 130, 131, 131, 131, 130, // 6376-6383
-127, 125, 123, 120, 121, 121, 122, 125, // 6384-6391
-127, 128, 130, 130, 131, 131, 130, 129, // 6392-6399
-128, 127, 127, 126, 126, 126, 126, 127, // 6400-6407
-127, 127, 128, 129, 129, 129, 129, 129, // 6408-6415
-128, 128, 128, 128, 128, 128, 128, 128, // 6416-6423
-127, 127, 127, 127, 128, 129, 130, 130, // 6424-6431
-130, 130, 128, 126, 124, 122, 121, 122, // 6432-6439
-123, 125, 127, 128, 129, 130, 130, 131, // 6440-6447
-131, 130, 129, 128, 127, 127, 126, 126, // 6448-6455
-125, 126, 127, 127, 128, 129, 129, 129, // 6456-6463
-129, 128, 128, 127, 127, 127, 127, 128, // 6464-6471
-128, 128, 128, 128, 128, 128, 129, 130, // 6472-6479
-130, 130, 130, 128, 126, 124, 122, 122, // 6480-6487
-122, 123, 125, 126, 128, 130, 130, 130, // 6488-6495
-131, 130, 129, 128, 127, 127, 126, 126, // 6496-6503
-126, 126, 127, 127, 128, 129, 129, 129, // 6504-6511
-129, 129, 129, 128, 128, 127, 127, 127, // 6512-6519
-127, 127, 127, 126, 127, 127, 128, 128, // 6520-6527
-129, 129, 130, 130, 131, 131, 130, 129, // 6528-6535
-126, 125, 123, 122, 122, 122, 123, 125, // 6536-6543
-127, 128, 129, 130, 130, 130, 129, 129, // 6544-6551
-128, 128, 127, 127, 127, 127, 127, 127, // 6552-6559
-128, 128, 129, 129, 129, 129, 129, 128, // 6560-6567
-128, 127, 127, 127, 127, 128, 128, 128, // 6568-6575
-128, 128, 129, 129, 130, 130, 130, 129, // 6576-6583
-127, 126, 124, 122, 122, 122, 123, 124, // 6584-6591
-126, 127, 129, 130, 130, 130, 130, 129, // 6592-6599
-129, 128, 128, 127, 126, 126, 126, 127, // 6600-6607
-127, 128, 129, 129, 129, 129, 129, 129, // 6608-6615
-128, 128, 127, 127, 127, 127, 127, 128, // 6616-6623
-128, 128, 128, 129, 129, 130, 130, 130, // 6624-6631
-130, 128, 126, 124, 122, 121, 121, 122, // 6632-6639
-123, 125, 127, 128, 129, 130, 131, 131, // 6640-6647
-131, 130, 129, 129, 128, 127, 126, 126, // 6648-6655
-126, 127, 128, 128, 129, 129, 129, 129, // 6656-6663
-128, 128, 127, 127, 127, 127, 127, 127, // 6664-6671
-128, 128, 128, 129, 129, 130, 130, 130, // 6672-6679
-130, 128, 126, 124, 123, 122, 122, 122, // 6680-6687
-124, 125, 127, 128, 130, 130, 131, 131, // 6688-6695
-130, 130, 129, 128, 127, 126, 125, 125, // 6696-6703
-125, 126, 127, 128, 129, 129, 129, 129, // 6704-6711
-129, 128, 128, 128, 128, 128, 128, 128, // 6712-6719
-128, 128, 128, 128, 129, 129, 130, 130, // 6720-6727
-130, 128, 127, 125, 123, 122, 122, 123, // 6728-6735
-124, 125, 127, 128, 129, 130, 131, 131, // 6736-6743
-131, 131, 130, 129, 127, 126, 125, 125, // 6744-6751
-125, 125, 126, 127, 128, 129, 129, 129, // 6752-6759
-129, 128, 128, 127, 127, 127, 127, 127, // 6760-6767
-128, 128, 128, 129, 129, 130, 130, 130, // 6768-6775
-129, 127, 126, 124, 122, 122, 122, 123, // 6776-6783
-125, 126, 128, 129, 130, 131, 131, 131, // 6784-6791
-131, 130, 129, 128, 126, 126, 125, 125, // 6792-6799
-125, 126, 127, 128, 129, 129, 129, 128, // 6800-6807
-128, 128, 127, 128, 128, 128, 128, 129, // 6808-6815
-129, 129, 130, 130, 130, 129, 128, 126, // 6816-6823
-125, 123, 122, 122, 122, 123, 125, 126, // 6824-6831
-128, 129, 130, 131, 131, 131, 131, 130, // 6832-6839
-129, 127, 126, 125, 124, 124, 125, 126, // 6840-6847
-127, 129, 129, 130, 130, 129, 129, 128, // 6848-6855
-128, 128, 128, 128, 128, 128, 129, 129, // 6856-6863
-129, 130, 130, 129, 128, 126, 124, 122, // 6864-6871
-122, 122, 122, 124, 126, 127, 129, 130, // 6872-6879
-130, 131, 131, 131, 130, 129, 128, 127, // 6880-6887
-126, 125, 125, 125, 126, 127, 128, 128, // 6888-6895
-128, 129, 129, 129, 129, 129, 129, 129, // 6896-6903
-129, 129, 129, 129, 129, 129, 129, 129, // 6904-6911
-127, 126, 124, 123, 122, 122, 122, 123, // 6912-6919
-125, 126, 128, 129, 130, 131, 131, 131, // 6920-6927
-131, 130, 129, 127, 126, 125, 125, 125, // 6928-6935
-126, 126, 127, 128, 129, 129, 129, 129, // 6936-6943
-129, 129, 129, 129, 129, 129, 129, 129, // 6944-6951
-129, 130, 130, 129, 129, 127, 126, 124, // 6952-6959
-122, 121, 121, 122, 123, 125, 126, 128, // 6960-6967
-129, 130, 131, 131, 131, 131, 130, 128, // 6968-6975
-127, 126, 125, 125, 125, 126, 127, 128, // 6976-6983
-129, 129, 129, 129, 129, 129, 129, 129, // 6984-6991
-129, 129, 129, 129, 129, 130, 130, 130, // 6992-6999
-129, 128, 126, 124, 122, 121, 121, 121, // 7000-7007
-123, 124, 126, 128, 129, 130, 130, 131, // 7008-7015
-131, 131, 130, 129, 127, 126, 125, 124, // 7016-7023
-124, 125, 126, 128, 129, 129, 130, 130, // 7024-7031
-130, 130, 129, 129, 129, 129, 129, 129, // 7032-7039
-129, 129, 129, 129, 130, 129, 128, 126, // 7040-7047
-124, 122, 121, 121, 121, 122, 124, 125, // 7048-7055
-127, 129, 130, 131, 132, 132, 132, 131, // 7056-7063
-130, 128, 126, 125, 124, 124, 125, 126, // 7064-7071
-127, 128, 129, 129, 130, 130, 129, 129, // 7072-7079
-129, 129, 128, 129, 128, 129, 129, 130, // 7080-7087
-130, 131, 129, 127, 125, 123, 120, 120, // 7088-7095
-120, 121, 123, 125, 127, 129, 131, 132, // 7096-7103
-133, 133, 133, 132, 130, 128, 126, 124, // 7104-7111
-123, 123, 123, 125, 126, 128, 129, 130, // 7112-7119
-131, 130, 130, 129, 129, 129, 128, 128, // 7120-7127
-128, 128, 128, 129, 130, 130, 131, 129, // 7128-7135
-127, 125, 122, 120, 120, 119, 120, 123, // 7136-7143
-125, 127, 130, 131, 132, 133, 133, 133, // 7144-7151
-132, 131, 129, 127, 125, 124, 123, 124, // 7152-7159
-125, 127, 128, 129, 130, 130, 130, 130, // 7160-7167
-129, 129, 128, 128, 128, 128, 128, 129, // 7168-7175
-130, 130, 131, 130, 128, 126, 123, 120, // 7176-7183
-119, 119, 119, 122, 124, 126, 129, 131, // 7184-7191
-132, 134, 134, 133, 132, 130, 128, 126, // 7192-7199
-124, 123, 122, 123, 124, 126, 128, 130, // 7200-7207
-131, 131, 131, 130, 129, 129, 128, 128, // 7208-7215
-128, 128, 128, 129, 131, 132, 133, 133, // 7216-7223
-130, 128, 125, 121, 119, 119, 118, 119, // 7224-7231
-122, 124, 127, 131, 132, 134, 134, 134, // 7232-7239
-132, 131, 129, 126, 124, 123, 122, 122, // 7240-7247
-124, 125, 128, 129, 131, 131, 131, 130, // 7248-7255
-129, 128, 128, 127, 127, 128, 128, 129, // 7256-7263
-131, 132, 132, 133, 131, 129, 126, 123, // 7264-7271
-120, 119, 118, 118, 121, 123, 126, 130, // 7272-7279
-132, 133, 134, 134, 132, 131, 129, 127, // 7280-7287
-125, 124, 122, 122, 123, 125, 127, 129, // 7288-7295
-130, 131, 131, 131, 130, 129, 128, 128, // 7296-7303
-128, 128, 128, 129, 130, 131, 132, 132, // 7304-7311
-131, 128, 126, 123, 119, 118, 118, 117, // 7312-7319
-121, 124, 126, 130, 133, 134, 134, 134, // 7320-7327
-132, 131, 129, 127, 125, 124, 123, 123, // 7328-7335
-124, 125, 127, 129, 130, 131, 131, 130, // 7336-7343
-129, 129, 129, 128, 129, 129, 129, 130, // 7344-7351
-131, 131, 132, 132, 130, 127, 124, 121, // 7352-7359
-117, 117, 116, 117, 121, 125, 128, 132, // 7360-7367
-134, 134, 134, 133, 131, 130, 128, 126, // 7368-7375
-124, 124, 123, 123, 125, 127, 128, 130, // 7376-7383
-130, 130, 130, 129, 128, 128, 128, 128, // 7384-7391
-129, 130, 129, 131, 132, 131, 132, 132, // 7392-7399
-129, 126, 123, 118, 116, 116, 116, 118, // 7400-7407
-123, 127, 131, 135, 136, 136, 134, 132, // 7408-7415
-130, 128, 126, 124, 123, 123, 123, 125, // 7416-7423
-127, 128, 130, 131, 130, 130, 130, 128, // 7424-7431
-128, 128, 128, 128, 129, 129, 129, 130, // 7432-7439
-132, 132, 133, 134, 130, 126, 123, 117, // 7440-7447
-114, 115, 114, 117, 125, 129, 134, 138, // 7448-7455
-137, 135, 133, 129, 126, 125, 124, 123, // 7456-7463
-123, 124, 124, 126, 129, 130, 131, 131, // 7464-7471
-130, 130, 130, 129, 129, 129, 128, 128, // 7472-7479
-128, 129, 129, 130, 132, 133, 134, 135, // 7480-7487
-132, 126, 123, 117, 111, 112, 113, 115, // 7488-7495
-124, 131, 135, 140, 139, 135, 132, 128, // 7496-7503
-125, 124, 124, 123, 124, 125, 126, 127, // 7504-7511
-129, 130, 130, 131, 130, 129, 130, 129, // 7512-7519
-128, 128, 128, 127, 127, 129, 129, 130, // 7520-7527
-133, 134, 134, 135, 134, 127, 123, 117, // 7528-7535
-109, 110, 112, 115, 124, 134, 137, 141, // 7536-7543
-141, 135, 131, 127, 123, 123, 123, 124, // 7544-7551
-125, 127, 127, 128, 128, 128, 128, 129, // 7552-7559
-130, 130, 131, 131, 129, 128, 127, 126, // 7560-7567
-126, 128, 129, 131, 133, 134, 134, 134, // 7568-7575
-134, 128, 121, 117, 108, 106, 111, 115, // 7576-7583
-123, 136, 140, 141, 143, 134, 128, 126, // 7584-7591
-122, 122, 125, 125, 126, 128, 127, 126, // 7592-7599
-127, 127, 128, 130, 131, 132, 131, 131, // 7600-7607
-128, 127, 126, 127, 128, 130, 132, 132, // 7608-7615
-133, 135, 135, 134, 135, 130, 121, 117, // 7616-7623
-108, 102, 109, 116, 123, 137, 143, 139, // 7624-7631
-141, 134, 124, 125, 123, 122, 127, 128, // 7632-7639
-126, 127, 126, 123, 126, 127, 129, 133, // 7640-7647
-134, 133, 131, 128, 126, 125, 126, 127, // 7648-7655
-130, 131, 133, 132, 132, 133, 134, 135, // 7656-7663
-136, 133, 121, 114, 108, 100, 106, 117, // 7664-7671
-124, 136, 145, 140, 136, 135, 123, 123, // 7672-7679
-127, 125, 128, 131, 126, 124, 124, 122, // 7680-7687
-124, 129, 131, 134, 135, 131, 127, 125, // 7688-7695
-124, 125, 128, 131, 132, 132, 131, 131, // 7696-7703
-130, 133, 136, 137, 137, 135, 121, 110, // 7704-7711
-107,  99, 105, 120, 128, 136, 145, 140, // 7712-7719
-130, 133, 126, 123, 132, 129, 127, 129, // 7720-7727
-124, 119, 122, 124, 125, 133, 135, 133, // 7728-7735
-131, 126, 123, 124, 127, 130, 131, 132, // 7736-7743
-130, 128, 130, 131, 133, 138, 138, 136, // 7744-7751
-134, 131, 116, 108, 107, 100, 109, 123, // 7752-7759
-129, 135, 141, 136, 128, 135, 130, 127, // 7760-7767
-134, 128, 123, 124, 121, 119, 126, 131, // 7768-7775
-129, 134, 133, 127, 128, 126, 126, 130, // 7776-7783
-131, 130, 127, 128, 127, 129, 135, 136, // 7784-7791
-136, 138, 136, 132, 133, 128, 109, 108, // 7792-7799
-105, 101, 116, 129, 131, 136, 141, 129, // 7800-7807
-130, 138, 129, 130, 133, 123, 119, 123, // 7808-7815
-121, 123, 133, 130, 127, 131, 128, 127, // 7816-7823
-130, 130, 127, 129, 128, 124, 128, 130, // 7824-7831
-132, 135, 137, 134, 134, 136, 136, 134, // 7832-7839
-135, 117, 101, 104, 102, 107, 127, 135, // 7840-7847
-126, 137, 135, 127, 140, 141, 127, 127, // 7848-7855
-127, 113, 123, 128, 125, 128, 130, 122, // 7856-7863
-126, 134, 131, 134, 131, 125, 123, 128, // 7864-7871
-127, 130, 132, 132, 131, 135, 136, 134, // 7872-7879
-138, 138, 135, 135, 129, 105, 103, 107, // 7880-7887
-104, 114, 131, 124, 123, 140, 132, 135, // 7888-7895
-144, 133, 119, 128, 124, 119, 131, 126, // 7896-7903
-120, 126, 128, 124, 135, 134, 130, 131, // 7904-7911
-129, 126, 129, 130, 125, 128, 132, 135, // 7912-7919
-136, 138, 133, 133, 138, 140, 136, 133, // 7920-7927
-112,  98, 107, 109, 111, 120, 125, 115, // 7928-7935
-135, 143, 136, 140, 136, 121, 124, 135, // 7936-7943
-122, 125, 126, 119, 123, 132, 125, 126, // 7944-7951
-134, 128, 130, 132, 127, 123, 129, 127, // 7952-7959
-130, 136, 135, 133, 135, 136, 137, 141, // 7960-7967
-137, 134, 131, 113, 103, 113, 109, 104, // 7968-7975
-115, 124, 118, 138, 143, 131, 136, 138, // 7976-7983
-126, 128, 137, 120, 122, 128, 122, 123, // 7984-7991
-130, 122, 123, 136, 132, 129, 129, 128, // 7992-7999
-124, 128, 125, 127, 130, 133, 133, 134, // 8000-8007
-134, 134, 139, 137, 136, 136, 130, 106, // 8008-8015
-112, 117, 107, 104, 121, 123, 121, 144, // 8016-8023
-134, 129, 137, 137, 121, 133, 133, 119, // 8024-8031
-128, 129, 121, 124, 131, 120, 129, 134, // 8032-8039
-130, 127, 132, 129, 126, 128, 125, 129, // 8040-8047
-132, 134, 129, 136, 132, 136, 137, 137, // 8048-8055
-134, 136, 127, 105, 120, 115, 101, 102, // 8056-8063
-128, 121, 119, 139, 130, 129, 138, 136, // 8064-8071
-120, 138, 134, 121, 128, 131, 122, 124, // 8072-8079
-129, 120, 131, 135, 129, 126, 133, 128, // 8080-8087
-126, 128, 127, 130, 131, 131, 128, 138, // 8088-8095
-131, 132, 137, 137, 135, 138, 129, 106, // 8096-8103
-124, 115,  98, 108, 130, 116, 113, 142, // 8104-8111
-131, 125, 135, 138, 123, 137, 136, 121, // 8112-8119
-130, 132, 120, 121, 133, 121, 127, 134, // 8120-8127
-130, 127, 133, 127, 125, 131, 125, 127, // 8128-8135
-131, 131, 127, 135, 131, 128, 137, 137, // 8136-8143
-134, 136, 137, 113, 120, 128,  99, 109, // 8144-8151
-127, 118, 108, 139, 132, 119, 137, 138, // 8152-8159
-126, 128, 142, 123, 126, 133, 126, 119, // 8160-8167
-129, 126, 120, 133, 130, 127, 130, 134, // 8168-8175
-122, 130, 129, 125, 130, 133, 127, 130, // 8176-8183
-134, 130, 131, 137, 135, 134, 137, 134, // 8184-8191
-119, 122, 127,  97, 120, 121, 111, 116, // 8192-8199
-136, 123, 122, 141, 126, 130, 130, 139, // 8200-8207
-123, 130, 131, 125, 120, 129, 128, 120, // 8208-8215
-133, 130, 127, 129, 134, 121, 132, 129, // 8216-8223
-125, 130, 133, 125, 133, 132, 129, 134, // 8224-8231
-136, 135, 135, 138, 135, 127, 115, 134, // 8232-8239
- 98, 117, 121, 106, 121, 129, 122, 122, // 8240-8247
-140, 121, 136, 129, 134, 129, 130, 129, // 8248-8255
-128, 124, 126, 129, 121, 131, 127, 129, // 8256-8263
-127, 132, 122, 131, 128, 127, 129, 131, // 8264-8271
-129, 130, 131, 130, 135, 131, 138, 133, // 8272-8279
-137, 134, 135, 113, 135, 109, 104, 131, // 8280-8287
-102, 120, 125, 123, 121, 138, 122, 133, // 8288-8295
-133, 128, 136, 128, 132, 130, 128, 123, // 8296-8303
-131, 122, 126, 130, 127, 125, 132, 127, // 8304-8311
-126, 131, 126, 127, 132, 129, 126, 137, // 8312-8319
-127, 133, 134, 134, 133, 138, 133, 136, // 8320-8327
-125, 119, 131,  94, 128, 110, 108, 129, // 8328-8335
-118, 124, 129, 132, 124, 138, 127, 135, // 8336-8343
-131, 132, 130, 129, 127, 123, 128, 123, // 8344-8351
-127, 128, 128, 128, 131, 125, 127, 128, // 8352-8359
-128, 127, 134, 129, 132, 135, 131, 133, // 8360-8367
-137, 133, 138, 135, 135, 127, 119, 132, // 8368-8375
- 91, 129, 108, 106, 130, 113, 127, 126, // 8376-8383
-131, 124, 139, 127, 135, 134, 132, 130, // 8384-8391
-131, 126, 125, 130, 123, 129, 129, 129, // 8392-8399
-127, 130, 123, 128, 126, 128, 128, 132, // 8400-8407
-130, 131, 133, 131, 133, 134, 134, 136, // 8408-8415
-136, 133, 135, 115, 135, 101, 117, 120, // 8416-8423
- 98, 130, 112, 126, 123, 132, 124, 134, // 8424-8431
-132, 128, 137, 131, 130, 130, 130, 122, // 8432-8439
-131, 125, 126, 129, 128, 127, 130, 127, // 8440-8447
-127, 129, 127, 130, 129, 130, 129, 132, // 8448-8455
-130, 131, 133, 133, 136, 136, 135, 137, // 8456-8463
-129, 119, 132,  97, 127, 110, 107, 128, // 8464-8471
-111, 128, 120, 133, 120, 138, 129, 130, // 8472-8479
-137, 130, 130, 132, 129, 125, 132, 124, // 8480-8487
-128, 129, 128, 126, 130, 125, 127, 128, // 8488-8495
-127, 131, 128, 131, 130, 133, 130, 135, // 8496-8503
-132, 137, 135, 136, 133, 137, 114, 135, // 8504-8511
-104, 114, 124,  95, 132, 108, 128, 119, // 8512-8519
-134, 122, 132, 136, 125, 139, 130, 131, // 8520-8527
-131, 131, 123, 131, 126, 125, 129, 127, // 8528-8535
-126, 128, 126, 125, 128, 127, 129, 130, // 8536-8543
-131, 130, 135, 130, 135, 134, 135, 135, // 8544-8551
-137, 132, 136, 118, 132, 108, 111, 125, // 8552-8559
- 94, 133, 108, 126, 120, 132, 122, 131, // 8560-8567
-137, 123, 141, 130, 131, 131, 132, 124, // 8568-8575
-130, 127, 126, 129, 128, 128, 129, 126, // 8576-8583
-128, 126, 128, 129, 128, 132, 128, 133, // 8584-8591
-130, 133, 133, 134, 136, 136, 133, 137, // 8592-8599
-120, 130, 116, 104, 130,  94, 129, 113, // 8600-8607
-121, 121, 129, 125, 125, 141, 120, 140, // 8608-8615
-131, 131, 132, 133, 125, 129, 127, 124, // 8616-8623
-129, 127, 127, 128, 126, 126, 127, 126, // 8624-8631
-129, 128, 131, 131, 132, 132, 134, 134, // 8632-8639
-136, 137, 136, 136, 136, 126, 123, 126, // 8640-8647
- 97, 132,  98, 118, 122, 112, 126, 123, // 8648-8655
-130, 118, 144, 120, 136, 135, 130, 132, // 8656-8663
-133, 127, 126, 131, 123, 129, 129, 126, // 8664-8671
-129, 127, 125, 127, 126, 127, 129, 129, // 8672-8679
-130, 133, 131, 132, 136, 132, 138, 135, // 8680-8687
-136, 134, 134, 117, 132,  98, 124, 110, // 8688-8695
-103, 131, 106, 129, 118, 135, 117, 141, // 8696-8703
-128, 130, 140, 129, 133, 132, 129, 125, // 8704-8711
-132, 124, 128, 131, 126, 130, 128, 125, // 8712-8719
-126, 126, 126, 129, 129, 129, 133, 132, // 8720-8727
-131, 136, 131, 137, 135, 137, 133, 136, // 8728-8735
-116, 132, 103, 116, 118,  98, 132, 106, // 8736-8743
-129, 118, 134, 119, 137, 132, 127, 141, // 8744-8751
-129, 133, 132, 131, 124, 132, 124, 127, // 8752-8759
-129, 127, 127, 129, 123, 127, 125, 125, // 8760-8767
-130, 128, 131, 133, 133, 132, 136, 132, // 8768-8775
-137, 136, 136, 133, 137, 117, 131, 110, // 8776-8783
-109, 127,  95, 131, 111, 124, 121, 132, // 8784-8791
-121, 131, 136, 123, 141, 131, 131, 132, // 8792-8799
-130, 123, 131, 126, 125, 130, 127, 126, // 8800-8807
-129, 122, 127, 125, 126, 129, 129, 131, // 8808-8815
-131, 134, 130, 135, 133, 136, 137, 137, // 8816-8823
-136, 136, 126, 122, 127,  95, 134,  96, // 8824-8831
-120, 121, 112, 128, 122, 129, 122, 142, // 8832-8839
-122, 138, 134, 130, 133, 132, 125, 129, // 8840-8847
-128, 125, 130, 128, 127, 128, 125, 125, // 8848-8855
-127, 124, 130, 130, 131, 132, 134, 131, // 8856-8863
-135, 133, 134, 137, 136, 132, 137, 122, // 8864-8871
-121, 126,  94, 133,  96, 120, 120, 116, // 8872-8879
-125, 126, 128, 123, 142, 122, 138, 133, // 8880-8887
-131, 131, 134, 124, 130, 128, 125, 130, // 8888-8895
-127, 127, 129, 126, 124, 128, 125, 127, // 8896-8903
-133, 129, 133, 135, 130, 136, 134, 133, // 8904-8911
-138, 136, 135, 135, 131, 114, 135,  94, // 8912-8919
-126, 110, 104, 131, 106, 128, 121, 131, // 8920-8927
-119, 140, 125, 133, 137, 129, 131, 133, // 8928-8935
-126, 128, 130, 124, 130, 129, 127, 128, // 8936-8943
-129, 122, 129, 126, 126, 133, 128, 132, // 8944-8951
-134, 131, 133, 136, 130, 140, 135, 136, // 8952-8959
-136, 133, 116, 132, 104, 113, 124,  94, // 8960-8967
-135, 108, 124, 124, 128, 122, 135, 131, // 8968-8975
-128, 140, 129, 132, 133, 128, 126, 132, // 8976-8983
-123, 129, 129, 126, 127, 128, 121, 128, // 8984-8991
-126, 125, 132, 128, 132, 134, 132, 133, // 8992-8999
-137, 131, 140, 136, 136, 134, 135, 113, // 9000-9007
-135, 101, 112, 125,  91, 136, 108, 124, // 9008-9015
-124, 129, 121, 137, 131, 129, 140, 130, // 9016-9023
-132, 133, 128, 126, 132, 123, 130, 128, // 9024-9031
-127, 127, 128, 123, 127, 126, 124, 132, // 9032-9039
-129, 130, 135, 131, 133, 137, 130, 140, // 9040-9047
-134, 138, 133, 137, 114, 131, 111, 103, // 9048-9055
-132,  89, 133, 112, 120, 126, 128, 122, // 9056-9063
-134, 132, 126, 140, 129, 132, 131, 129, // 9064-9071
-124, 132, 123, 130, 128, 127, 127, 129, // 9072-9079
-122, 128, 126, 125, 131, 129, 131, 134, // 9080-9087
-133, 133, 138, 131, 140, 136, 138, 133, // 9088-9095
-138, 114, 129, 112, 101, 133,  90, 131, // 9096-9103
-114, 118, 128, 127, 124, 132, 134, 125, // 9104-9111
-140, 129, 132, 132, 129, 124, 133, 122, // 9112-9119
-129, 128, 126, 129, 128, 124, 126, 127, // 9120-9127
-123, 130, 129, 130, 133, 133, 131, 139, // 9128-9135
-130, 140, 136, 136, 136, 136, 119, 127, // 9136-9143
-117,  98, 135,  90, 128, 118, 114, 129, // 9144-9151
-126, 123, 132, 133, 124, 141, 129, 132, // 9152-9159
-132, 130, 124, 133, 122, 129, 128, 126, // 9160-9167
-129, 128, 124, 126, 127, 123, 130, 129, // 9168-9175
-130, 134, 134, 131, 139, 130, 139, 136, // 9176-9183
-136, 135, 136, 120, 124, 121,  94, 136, // 9184-9191
- 93, 124, 122, 112, 130, 126, 124, 130, // 9192-9199
-135, 123, 140, 128, 132, 131, 130, 124, // 9200-9207
-133, 123, 129, 130, 126, 129, 131, 123, // 9208-9215
-130, 126, 125, 132, 125, 134, 129, 133, // 9216-9223
-132, 135, 131, 139, 135, 137, 134, 136, // 9224-9231
-123, 118, 128,  90, 135,  99, 115, 130, // 9232-9239
-107, 131, 125, 124, 128, 136, 122, 141, // 9240-9247
-128, 132, 133, 130, 125, 132, 124, 127, // 9248-9255
-131, 125, 129, 129, 124, 127, 128, 124, // 9256-9263
-133, 127, 133, 131, 133, 131, 136, 130, // 9264-9271
-137, 137, 133, 135, 135, 118, 124, 121, // 9272-9279
- 95, 134,  99, 119, 127, 113, 129, 127, // 9280-9287
-124, 131, 134, 125, 139, 129, 131, 131, // 9288-9295
-129, 124, 133, 124, 128, 131, 125, 129, // 9296-9303
-129, 124, 128, 126, 126, 130, 127, 133, // 9304-9311
-129, 132, 132, 134, 132, 136, 136, 135, // 9312-9319
-136, 131, 129, 113, 131,  96, 123, 115, // 9320-9327
-105, 134, 112, 127, 128, 126, 126, 137, // 9328-9335
-123, 138, 129, 130, 132, 127, 126, 130, // 9336-9343
-126, 126, 132, 126, 129, 128, 128, 124, // 9344-9351
-129, 127, 128, 129, 132, 128, 133, 132, // 9352-9359
-132, 135, 132, 138, 133, 136, 129, 135, // 9360-9367
-107, 133, 105, 106, 133,  95, 132, 120, // 9368-9375
-121, 129, 131, 122, 138, 127, 132, 136, // 9376-9383
-126, 134, 129, 125, 128, 131, 121, 133, // 9384-9391
-128, 126, 129, 130, 123, 130, 126, 129, // 9392-9399
-128, 129, 133, 127, 134, 132, 133, 133, // 9400-9407
-138, 132, 138, 128, 137, 118, 116, 131, // 9408-9415
- 89, 132, 109, 110, 131, 118, 126, 131, // 9416-9423
-127, 129, 136, 123, 140, 126, 130, 132, // 9424-9431
-126, 124, 133, 124, 126, 132, 126, 127, // 9432-9439
-131, 128, 124, 132, 125, 130, 128, 131, // 9440-9447
-132, 129, 135, 133, 131, 137, 134, 134, // 9448-9455
-136, 128, 137, 107, 128, 116,  95, 136, // 9456-9463
-101, 120, 128, 120, 127, 132, 124, 134, // 9464-9471
-129, 127, 139, 121, 133, 130, 123, 127, // 9472-9479
-133, 122, 130, 132, 126, 129, 131, 127, // 9480-9487
-126, 131, 128, 128, 132, 129, 130, 133, // 9488-9495
-130, 133, 133, 132, 138, 131, 136, 130, // 9496-9503
-130, 107, 130, 110,  97, 139, 100, 122, // 9504-9511
-130, 122, 125, 134, 125, 135, 128, 131, // 9512-9519
-140, 120, 135, 132, 121, 128, 135, 119, // 9520-9527
-131, 132, 125, 128, 130, 126, 125, 129, // 9528-9535
-129, 128, 128, 135, 127, 134, 133, 132, // 9536-9543
-131, 137, 133, 135, 130, 135, 118, 106, // 9544-9551
-140,  87, 120, 129, 104, 127, 132, 123, // 9552-9559
-128, 132, 130, 134, 122, 141, 128, 122, // 9560-9567
-136, 129, 118, 135, 130, 121, 132, 130, // 9568-9575
-126, 126, 132, 125, 127, 128, 132, 127, // 9576-9583
-128, 136, 128, 131, 135, 131, 131, 138, // 9584-9591
-132, 136, 126, 139, 111, 110, 138,  84, // 9592-9599
-125, 126, 107, 128, 132, 125, 128, 130, // 9600-9607
-134, 131, 121, 143, 127, 120, 138, 128, // 9608-9615
-119, 134, 129, 123, 130, 130, 129, 125, // 9616-9623
-130, 129, 126, 127, 134, 127, 126, 134, // 9624-9631
-132, 128, 133, 137, 131, 136, 136, 135, // 9632-9639
-126, 134,  97, 133, 111,  90, 142, 110, // 9640-9647
-116, 133, 132, 124, 131, 131, 138, 121, // 9648-9655
-131, 143, 117, 128, 138, 120, 123, 135, // 9656-9663
-124, 126, 129, 131, 127, 124, 130, 130, // 9664-9671
-121, 131, 137, 121, 132, 136, 130, 128, // 9672-9679
-138, 135, 134, 132, 140, 127, 130, 109, // 9680-9687
-114, 130,  83, 129, 127, 110, 126, 138, // 9688-9695
-129, 125, 132, 138, 127, 119, 144, 125, // 9696-9703
-118, 135, 129, 119, 130, 130, 126, 127, // 9704-9711
-128, 134, 123, 127, 134, 128, 125, 134, // 9712-9719
-132, 127, 130, 137, 131, 129, 137, 138, // 9720-9727
-131, 134, 134, 131, 118,  96, 145,  93, // 9728-9735
- 98, 144, 114, 114, 133, 141, 123, 124, // 9736-9743
-136, 141, 111, 134, 143, 115, 126, 137, // 9744-9751
-125, 123, 129, 130, 131, 119, 133, 135, // 9752-9759
-119, 128, 136, 126, 125, 130, 136, 127, // 9760-9767
-126, 143, 131, 126, 142, 139, 129, 132, // 9768-9775
-134, 125,  85, 139, 115,  82, 139, 128, // 9776-9783
-115, 123, 145, 133, 119, 127, 147, 119, // 9784-9791
-119, 144, 126, 121, 128, 132, 128, 122, // 9792-9799
-127, 138, 121, 124, 137, 126, 122, 131, // 9800-9807
-130, 129, 128, 132, 136, 130, 132, 136, // 9808-9815
-133, 140, 132, 134, 135, 129, 104, 103, // 9816-9823
-141,  85, 108, 140, 120, 118, 130, 147, // 9824-9831
-127, 117, 138, 141, 112, 131, 137, 123, // 9832-9839
-124, 125, 133, 130, 117, 132, 138, 117, // 9840-9847
-127, 134, 125, 125, 130, 132, 131, 124, // 9848-9855
-134, 137, 128, 131, 137, 135, 137, 130, // 9856-9863
-139, 133, 126,  91, 124, 131,  76, 130, // 9864-9871
-134, 121, 117, 137, 145, 121, 118, 144, // 9872-9879
-132, 113, 133, 131, 127, 123, 124, 138, // 9880-9887
-129, 116, 134, 136, 119, 126, 132, 129, // 9888-9895
-124, 128, 132, 131, 123, 132, 135, 131, // 9896-9903
-128, 136, 140, 136, 129, 141, 132, 125, // 9904-9911
- 92, 122, 134,  80, 124, 137, 125, 117, // 9912-9919
-132, 146, 127, 115, 138, 137, 118, 126, // 9920-9927
-129, 132, 126, 119, 136, 136, 116, 127, // 9928-9935
-139, 125, 121, 130, 132, 128, 124, 130, // 9936-9943
-134, 126, 128, 132, 135, 129, 129, 141, // 9944-9951
-138, 129, 135, 133, 123,  87, 131, 125, // 9952-9959
- 87, 127, 133, 129, 118, 132, 143, 128, // 9960-9967
-118, 135, 133, 126, 124, 123, 137, 128, // 9968-9975
-117, 135, 137, 119, 128, 133, 130, 125, // 9976-9983
-125, 131, 134, 123, 125, 138, 131, 126, // 9984-9991
-130, 138, 133, 127, 139, 137, 131, 128, // 9992-9999
-131, 100, 108, 134,  94, 115, 132, 128, // 10000-10007
-125, 125, 139, 133, 123, 129, 131, 127, // 10008-10015
-131, 120, 127, 138, 121, 124, 136, 128, // 10016-10023
-127, 130, 128, 131, 126, 126, 132, 131, // 10024-10031
-123, 131, 133, 130, 130, 130, 137, 133, // 10032-10039
-135, 134, 134, 132, 130,  98, 110, 136, // 10040-10047
- 98, 112, 131, 132, 125, 123, 135, 135, // 10048-10055
-127, 127, 127, 129, 134, 118, 123, 137, // 10056-10063
-126, 123, 130, 127, 130, 131, 123, 129, // 10064-10071
-131, 126, 128, 130, 129, 130, 130, 131, // 10072-10079
-132, 131, 132, 134, 136, 134, 130, 130, // 10080-10087
-133, 105, 109, 132, 110, 113, 127, 129, // 10088-10095
-126, 127, 129, 128, 130, 130, 126, 126, // 10096-10103
-135, 126, 122, 131, 129, 126, 129, 126, // 10104-10111
-127, 131, 129, 125, 128, 131, 130, 127, // 10112-10119
-129, 131, 130, 129, 130, 130, 130, 132, // 10120-10127
-132, 131, 134, 130, 129, 119, 118, 127, // 10128-10135
-118, 119, 127, 123, 122, 128, 123, 121, // 10136-10143
-130, 127, 126, 130, 129, 127, 128, 129, // 10144-10151
-128, 127, 130, 129, 127, 130, 128, 127, // 10152-10159
-128, 129, 128, 129, 127, 130, 130, 127, // 10160-10167
-130, 131, 131, 134, 134, 132, 133, 132, // 10168-10175
-122, 121, 126, 117, 118, 125, 121, 120, // 10176-10183
-125, 122, 123, 128, 127, 128, 130, 131, // 10184-10191
-129, 129, 129, 129, 128, 129, 128, 128, // 10192-10199
-131, 128, 125, 129, 129, 127, 128, 129, // 10200-10207
-130, 129, 130, 132, 131, 135, 135, 133, // 10208-10215
-132, 133, 125, 120, 126, 119, 114, 124, // 10216-10223
-120, 117, 127, 125, 120, 129, 131, 127, // 10224-10231
-130, 131, 129, 128, 130, 127, 126, 129, // 10232-10239
-129, 125, 128, 129, 125, 128, 129, 127, // 10240-10247
-127, 131, 130, 128, 131, 133, 131, 134, // 10248-10255
-136, 134, 133, 134, 126, 119, 126, 119, // 10256-10263
-114, 123, 120, 117, 125, 124, 121, 129, // 10264-10271
-130, 128, 130, 132, 129, 127, 129, 128, // 10272-10279
-126, 128, 129, 126, 128, 129, 125, 128, // 10280-10287
-130, 126, 129, 131, 129, 129, 132, 132, // 10288-10295
-132, 135, 135, 133, 133, 132, 122, 122, // 10296-10303
-126, 117, 118, 124, 119, 119, 126, 122, // 10304-10311
-124, 130, 130, 129, 131, 132, 128, 128, // 10312-10319
-129, 127, 126, 129, 127, 125, 127, 126, // 10320-10327
-125, 128, 127, 127, 131, 130, 130, 132, // 10328-10335
-133, 134, 136, 135, 134, 133, 127, 122, // 10336-10343
-125, 119, 117, 123, 120, 118, 123, 123, // 10344-10351
-122, 128, 130, 130, 132, 132, 131, 130, // 10352-10359
-129, 129, 127, 129, 128, 126, 127, 126, // 10360-10367
-124, 125, 128, 127, 128, 130, 131, 132, // 10368-10375
-133, 135, 135, 135, 134, 126, 124, 127, // 10376-10383
-119, 119, 124, 119, 119, 124, 120, 122, // 10384-10391
-128, 127, 129, 131, 131, 130, 130, 131, // 10392-10399
-128, 127, 129, 128, 126, 129, 126, 124, // 10400-10407
-128, 126, 126, 130, 131, 131, 134, 135, // 10408-10415
-135, 134, 133, 127, 124, 126, 120, 118, // 10416-10423
-124, 122, 119, 124, 122, 120, 128, 128, // 10424-10431
-128, 131, 131, 129, 130, 129, 129, 128, // 10432-10439
-129, 129, 127, 127, 128, 125, 125, 128, // 10440-10447
-127, 129, 133, 134, 135, 137, 135, 132, // 10448-10455
-126, 126, 126, 119, 121, 123, 119, 121, // 10456-10463
-124, 120, 123, 128, 127, 129, 131, 130, // 10464-10471
-130, 130, 129, 129, 128, 129, 128, 127, // 10472-10479
-129, 127, 126, 127, 126, 128, 130, 131, // 10480-10487
-134, 136, 135, 136, 131, 124, 128, 124, // 10488-10495
-117, 123, 122, 117, 122, 122, 119, 125, // 10496-10503
-128, 127, 130, 130, 130, 129, 129, 130, // 10504-10511
-128, 128, 130, 128, 128, 130, 127, 126, // 10512-10519
-129, 129, 129, 132, 135, 135, 135, 135, // 10520-10527
-130, 123, 127, 124, 118, 123, 123, 118, // 10528-10535
-121, 122, 118, 124, 127, 126, 129, 131, // 10536-10543
-129, 128, 129, 129, 128, 129, 130, 128, // 10544-10551
-130, 131, 127, 128, 131, 128, 132, 136, // 10552-10559
-133, 134, 135, 126, 125, 127, 121, 123, // 10560-10567
-127, 122, 121, 123, 121, 121, 125, 127, // 10568-10575
-128, 130, 131, 129, 127, 129, 128, 126, // 10576-10583
-129, 130, 128, 129, 129, 128, 128, 129, // 10584-10591
-132, 133, 133, 135, 130, 123, 127, 125, // 10592-10599
-119, 126, 127, 121, 125, 125, 120, 124, // 10600-10607
-128, 126, 128, 131, 130, 128, 129, 130, // 10608-10615
-127, 128, 130, 128, 130, 131, 127, 129, // 10616-10623
-130, 129, 133, 135, 134, 134, 128, 123, // 10624-10631
-125, 121, 119, 126, 123, 121, 124, 122, // 10632-10639
-121, 125, 126, 127, 130, 131, 129, 129, // 10640-10647
-129, 128, 127, 129, 130, 129, 130, 129, // 10648-10655
-128, 129, 130, 132, 135, 135, 133, 127, // 10656-10663
-124, 124, 121, 121, 125, 123, 122, 124, // 10664-10671
-122, 121, 127, 127, 127, 131, 130, 128, // 10672-10679
-129, 129, 127, 128, 130, 130, 129, 130, // 10680-10687
-129, 127, 131, 133, 133, 136, 135, 129, // 10688-10695
-126, 125, 121, 120, 123, 123, 122, 123, // 10696-10703
-122, 120, 124, 127, 127, 129, 131, 129, // 10704-10711
-128, 129, 128, 129, 131, 129, 130, 132, // 10712-10719
-130, 129, 133, 132, 133, 134, 130, 126, // 10720-10727
-126, 122, 121, 123, 123, 122, 124, 123, // 10728-10735
-123, 125, 126, 127, 128, 130, 129, 127, // 10736-10743
-128, 129, 127, 127, 129, 130, 130, 132, // 10744-10751
-135, 134, 135, 135, 131, 127, 127, 124, // 10752-10759
-120, 124, 124, 120, 123, 124, 122, 124, // 10760-10767
-126, 125, 126, 130, 129, 126, 128, 129, // 10768-10775
-125, 127, 131, 128, 130, 136, 135, 134, // 10776-10783
-137, 133, 127, 128, 127, 121, 123, 126, // 10784-10791
-122, 121, 124, 122, 121, 127, 128, 126, // 10792-10799
-130, 130, 126, 127, 129, 125, 124, 130, // 10800-10807
-130, 130, 136, 136, 134, 136, 132, 126, // 10808-10815
-126, 126, 122, 123, 124, 122, 122, 123, // 10816-10823
-123, 123, 126, 129, 128, 128, 130, 127, // 10824-10831
-125, 128, 127, 128, 131, 133, 134, 137, // 10832-10839
-136, 132, 129, 127, 125, 123, 123, 124, // 10840-10847
-123, 123, 124, 123, 123, 126, 127, 128, // 10848-10855
-128, 128, 127, 124, 126, 128, 127, 131, // 10856-10863
-135, 134, 137, 138, 132, 128, 128, 125, // 10864-10871
-124, 125, 124, 122, 122, 123, 122, 123, // 10872-10879
-127, 128, 127, 129, 129, 124, 126, 129, // 10880-10887
-126, 129, 136, 134, 136, 138, 133, 129, // 10888-10895
-128, 125, 123, 124, 123, 121, 121, 121, // 10896-10903
-121, 123, 126, 126, 128, 128, 125, 127, // 10904-10911
-128, 126, 131, 135, 133, 137, 138, 132, // 10912-10919
-131, 130, 124, 123, 125, 124, 123, 123, // 10920-10927
-124, 122, 122, 125, 124, 125, 129, 129, // 10928-10935
-127, 131, 132, 131, 134, 135, 134, 131, // 10936-10943
-130, 128, 124, 123, 123, 122, 122, 125, // 10944-10951
-124, 123, 126, 126, 126, 127, 128, 130, // 10952-10959
-130, 131, 133, 132, 133, 135, 132, 130, // 10960-10967
-130, 125, 122, 123, 122, 121, 123, 123, // 10968-10975
-123, 124, 126, 127, 129, 132, 133, 132, // 10976-10983
-134, 134, 132, 133, 132, 129, 127, 126, // 10984-10991
-123, 122, 121, 119, 121, 122, 121, 123, // 10992-10999
-126, 127, 129, 132, 132, 133, 136, 135, // 11000-11007
-135, 135, 132, 128, 127, 127, 127, 127, // 11008-11015
-127, 127, 127, 127, 127, 128, 128, 128, // 11016-11023
-128, 128, 128, 128, 128, 127, 127, 128, // 11024-11031
-127, 127, 128, 128, 127, 127, 127, 127, // 11032-11039
-127, 127, 126, 127, 128};// 11040-11044
-
-#define WIN_N 5936
-const uint8_t Win[WIN_N] = {
-128, 128, 128, 128, 128, 128, 128, 128, // 0-7
-128, 129, 129, 129, 128, 128, 128, 128, // 8-15
-128, 127, 127, 127, 127, 127, 126, 126, // 16-23
-126, 126, 126, 126, 127, 127, 126, 126, // 24-31
-127, 127, 128, 128, 129, 129, 129, 129, // 32-39
-128, 128, 128, 128, 129, 129, 130, 129, // 40-47
-129, 129, 128, 128, 128, 128, 128, 128, // 48-55
-128, 127, 125, 124, 122, 121, 121, 122, // 56-63
-123, 125, 127, 128, 129, 130, 130, 130, // 64-71
-130, 130, 131, 131, 130, 131, 131, 131, // 72-79
-130, 129, 128, 128, 128, 129, 129, 130, // 80-87
-129, 128, 127, 124, 121, 119, 117, 118, // 88-95
-119, 122, 125, 127, 130, 130, 130, 129, // 96-103
-129, 129, 130, 131, 132, 132, 132, 131, // 104-111
-131, 132, 131, 132, 131, 130, 130, 130, // 112-119
-130, 130, 128, 126, 121, 117, 114, 112, // 120-127
-114, 117, 121, 127, 130, 131, 131, 130, // 128-135
-129, 129, 130, 131, 132, 133, 132, 132, // 136-143
-133, 133, 134, 133, 133, 132, 131, 132, // 144-151
-132, 132, 130, 125, 119, 113, 108, 107, // 152-159
-109, 115, 122, 128, 132, 132, 130, 129, // 160-167
-128, 129, 130, 132, 134, 134, 135, 135, // 168-175
-135, 136, 137, 137, 135, 134, 133, 134, // 176-183
-134, 131, 123, 115, 107, 100,  99, 104, // 184-191
-113, 124, 132, 134, 133, 130, 128, 128, // 192-199
-131, 134, 137, 138, 137, 134, 132, 133, // 200-207
-135, 138, 141, 142, 142, 140, 135, 128, // 208-215
-119, 108, 100,  95,  98, 106, 117, 126, // 216-223
-131, 131, 128, 125, 126, 130, 134, 139, // 224-231
-139, 137, 133, 129, 130, 134, 142, 146, // 232-239
-149, 146, 141, 138, 132, 123, 112, 101, // 240-247
- 93,  92, 101, 112, 122, 130, 130, 127, // 248-255
-126, 127, 131, 138, 142, 140, 135, 129, // 256-263
-125, 130, 140, 148, 153, 151, 144, 140, // 264-271
-137, 128, 116, 102,  90,  86,  93, 106, // 272-279
-118, 128, 130, 127, 127, 131, 137, 143, // 280-287
-143, 137, 130, 126, 128, 137, 146, 152, // 288-295
-151, 147, 144, 146, 142, 126, 105,  87, // 296-303
- 79,  85, 100, 113, 119, 122, 121, 124, // 304-311
-136, 147, 149, 145, 135, 125, 125, 135, // 312-319
-143, 147, 149, 145, 144, 151, 157, 145, // 320-327
-118,  91,  77,  81,  96, 107, 106, 103, // 328-335
-110, 125, 142, 153, 148, 137, 131, 133, // 336-343
-139, 143, 141, 138, 139, 150, 158, 161, // 344-351
-157, 136, 108,  94,  92,  95,  91,  86, // 352-359
- 87, 101, 125, 138, 137, 137, 139, 147, // 360-367
-151, 144, 131, 130, 143, 152, 155, 151, // 368-375
-146, 156, 154, 127,  97,  84,  91,  95, // 376-383
- 87,  83,  91, 118, 137, 132, 131, 140, // 384-391
-153, 156, 142, 132, 137, 152, 157, 147, // 392-399
-144, 153, 162, 141, 103,  91,  97, 100, // 400-407
- 85,  72,  95, 117, 125, 123, 121, 147, // 408-415
-161, 147, 135, 136, 151, 152, 143, 148, // 416-423
-155, 159, 159, 136, 107, 107, 102,  88, // 424-431
- 77,  77, 104, 114, 109, 123, 136, 148, // 432-439
-147, 140, 146, 148, 143, 142, 151, 159, // 440-447
-152, 149, 164, 136,  94, 109, 103,  81, // 448-455
- 72,  81, 111, 102, 104, 135, 134, 146, // 456-463
-147, 149, 156, 143, 146, 157, 157, 153, // 464-471
-147, 162, 148,  92, 108, 115,  72,  76, // 472-479
- 91, 100,  96, 109, 136, 124, 132, 156, // 480-487
-146, 143, 151, 153, 157, 158, 162, 156, // 488-495
-154, 152,  96, 105, 114,  61,  79,  98, // 496-503
- 87,  95, 120, 129, 122, 144, 156, 138, // 504-511
-150, 157, 141, 156, 169, 158, 155, 166, // 512-519
-136,  90, 132,  90,  50, 104,  82,  76, // 520-527
-115, 110, 123, 131, 153, 146, 142, 167, // 528-535
-146, 149, 174, 147, 165, 157, 152, 104, // 536-543
-114, 122,  49,  97,  94,  61, 114, 110, // 544-551
-105, 139, 144, 141, 149, 158, 147, 151, // 552-559
-175, 153, 159, 170, 148, 127, 103, 130, // 560-567
- 57,  78, 115,  39, 116, 121,  73, 163, // 568-575
-130, 127, 176, 137, 152, 160, 156, 165, // 576-583
-162, 157, 154, 132,  92, 143,  56,  82, // 584-591
-116,  35, 118, 113,  80, 158, 135, 129, // 592-599
-172, 145, 147, 169, 158, 156, 171, 155, // 600-607
-148, 124, 105, 121,  59,  95,  85,  56, // 608-615
-124,  88, 113, 147, 130, 156, 156, 153, // 616-623
-148, 165, 156, 162, 161, 156, 148,  96, // 624-631
-143,  72,  72, 125,  21, 120, 105,  64, // 632-639
-178, 102, 151, 175, 126, 181, 152, 161, // 640-647
-171, 153, 167, 141, 114, 123,  94,  64, // 648-655
-115,  48,  85, 124,  58, 160, 124, 129, // 656-663
-186, 128, 174, 163, 152, 175, 158, 159, // 664-671
-147, 109, 130,  78,  75, 103,  38, 112, // 672-679
- 90,  83, 166, 104, 171, 165, 141, 185, // 680-687
-145, 169, 166, 157, 161, 122, 135,  93, // 688-695
- 75,  96,  52,  81,  98,  81, 134, 127, // 696-703
-151, 164, 161, 163, 167, 160, 159, 170, // 704-711
-148, 144, 120, 108,  75,  86,  63,  76, // 712-719
- 90,  84, 128, 124, 156, 163, 163, 175, // 720-727
-164, 165, 160, 172, 141, 141, 119,  97, // 728-735
- 76,  80,  72,  67, 110,  81, 129, 135, // 736-743
-147, 170, 164, 169, 165, 158, 168, 159, // 744-751
-141, 148, 102, 103,  60,  92,  52,  89, // 752-759
- 94,  94, 140, 139, 162, 168, 173, 163, // 760-767
-169, 154, 173, 144, 149, 122, 100,  80, // 768-775
- 77,  68,  63, 105,  79, 129, 138, 150, // 776-783
-173, 170, 168, 169, 153, 177, 144, 158, // 784-791
-128, 109,  90,  66,  80,  49, 104,  77, // 792-799
-121, 131, 151, 165, 178, 170, 169, 159, // 800-807
-168, 151, 151, 132, 116,  84,  76,  75, // 808-815
- 49, 106,  75, 120, 133, 148, 165, 177, // 816-823
-167, 173, 154, 170, 146, 153, 131, 114, // 824-831
- 88,  77,  76,  59,  98,  86, 121, 131, // 832-839
-152, 164, 173, 169, 163, 155, 164, 143, // 840-847
-149, 124, 114,  75,  93,  56,  88,  86, // 848-855
-106, 123, 146, 154, 173, 168, 174, 148, // 856-863
-164, 147, 146, 137, 115, 102,  67,  91, // 864-871
- 50, 100,  91, 116, 138, 154, 167, 179, // 872-879
-169, 167, 158, 151, 148, 136, 123, 102, // 880-887
- 80,  75,  66,  77,  90, 107, 129, 152, // 888-895
-166, 180, 178, 168, 163, 153, 145, 144, // 896-903
-116, 118,  75,  87,  62,  76,  90,  99, // 904-911
-127, 145, 166, 176, 181, 169, 161, 155, // 912-919
-143, 144, 121, 109,  91,  73,  80,  73, // 920-927
- 93, 104, 121, 149, 161, 172, 180, 161, // 928-935
-161, 148, 146, 136, 124, 113,  86,  88, // 936-943
- 73,  80,  93, 104, 125, 151, 161, 179, // 944-951
-172, 165, 159, 145, 147, 132, 123, 106, // 952-959
- 94,  76,  87,  73,  98, 102, 122, 149, // 960-967
-158, 177, 173, 165, 160, 148, 146, 140, // 968-975
-117, 113,  88,  81,  83,  80,  96, 106, // 976-983
-122, 148, 158, 176, 170, 158, 159, 144, // 984-991
-147, 133, 125, 106,  92,  89,  83,  89, // 992-999
- 99, 108, 127, 152, 156, 175, 165, 157, // 1000-1007
-151, 141, 140, 128, 116, 105,  88,  91, // 1008-1015
- 89,  96, 106, 118, 134, 157, 160, 171, // 1016-1023
-159, 154, 144, 139, 133, 123, 113,  93, // 1024-1031
- 96,  84,  97, 100, 115, 126, 146, 161, // 1032-1039
-169, 168, 160, 146, 142, 133, 125, 115, // 1040-1047
-101,  90,  91,  87, 101, 107, 120, 140, // 1048-1055
-153, 168, 173, 162, 155, 145, 136, 131, // 1056-1063
-116, 108,  92,  90,  88,  94, 102, 117, // 1064-1071
-124, 152, 160, 172, 169, 158, 149, 140, // 1072-1079
-133, 122, 115,  94,  95,  86,  95, 101, // 1080-1087
-112, 124, 142, 158, 167, 172, 159, 150, // 1088-1095
-140, 129, 126, 111, 103,  94,  89,  95, // 1096-1103
-102, 109, 125, 135, 158, 162, 173, 160, // 1104-1111
-154, 141, 133, 124, 112, 105,  92,  93, // 1112-1119
- 92, 100, 108, 124, 133, 156, 161, 174, // 1120-1127
-160, 158, 142, 134, 126, 114, 105,  98, // 1128-1135
- 89,  96,  96, 110, 118, 132, 154, 155, // 1136-1143
-175, 160, 159, 143, 135, 126, 115, 109, // 1144-1151
- 96,  95,  95, 100, 107, 118, 129, 148, // 1152-1159
-156, 171, 161, 160, 143, 136, 126, 116, // 1160-1167
-111,  96,  99,  95, 103, 108, 119, 127, // 1168-1175
-147, 155, 166, 163, 155, 146, 134, 128, // 1176-1183
-116, 106, 101,  92, 101, 100, 112, 120, // 1184-1191
-129, 149, 151, 167, 155, 157, 140, 136, // 1192-1199
-125, 119, 109, 102,  97, 101, 103, 111, // 1200-1207
-121, 131, 148, 151, 164, 154, 154, 138, // 1208-1215
-135, 124, 114, 109, 100, 101, 102, 107, // 1216-1223
-118, 123, 140, 146, 159, 156, 156, 143, // 1224-1231
-140, 125, 123, 111, 105, 102,  98, 107, // 1232-1239
-105, 122, 123, 145, 149, 163, 158, 159, // 1240-1247
-145, 137, 127, 116, 108, 101,  95,  99, // 1248-1255
-102, 109, 121, 126, 149, 152, 167, 160, // 1256-1263
-160, 144, 140, 126, 117, 105, 100,  93, // 1264-1271
- 97, 101, 108, 121, 128, 149, 153, 168, // 1272-1279
-160, 157, 146, 136, 127, 117, 107,  97, // 1280-1287
- 96,  95, 101, 110, 118, 134, 145, 160, // 1288-1295
-163, 163, 154, 145, 135, 126, 114, 106, // 1296-1303
- 97,  96,  96, 103, 111, 121, 136, 147, // 1304-1311
-161, 161, 163, 150, 144, 135, 123, 116, // 1312-1319
-102,  99,  95, 100, 104, 114, 123, 136, // 1320-1327
-149, 158, 160, 158, 149, 142, 134, 122, // 1328-1335
-115, 103, 100,  97, 101, 108, 112, 128, // 1336-1343
-136, 152, 157, 160, 155, 147, 141, 128, // 1344-1351
-127, 109, 108,  97, 100, 103, 108, 118, // 1352-1359
-126, 141, 150, 160, 158, 154, 145, 136, // 1360-1367
-129, 119, 112, 104, 100, 100, 104, 109, // 1368-1375
-119, 127, 141, 152, 157, 161, 150, 147, // 1376-1383
-134, 130, 121, 110, 106,  97, 103, 103, // 1384-1391
-112, 119, 130, 141, 152, 159, 156, 153, // 1392-1399
-142, 137, 126, 121, 110, 105, 100, 102, // 1400-1407
-105, 112, 120, 128, 143, 151, 159, 155, // 1408-1415
-153, 140, 138, 125, 121, 109, 105, 101, // 1416-1423
-101, 109, 108, 123, 126, 144, 151, 158, // 1424-1431
-160, 149, 147, 133, 130, 118, 111, 106, // 1432-1439
- 98, 106, 102, 113, 116, 128, 140, 149, // 1440-1447
-160, 155, 155, 143, 138, 130, 122, 113, // 1448-1455
-104, 102,  99, 106, 107, 118, 123, 136, // 1456-1463
-148, 155, 159, 153, 147, 139, 133, 125, // 1464-1471
-117, 108, 102, 101, 101, 109, 111, 122, // 1472-1479
-131, 144, 155, 159, 158, 149, 144, 134, // 1480-1487
-129, 119, 111, 103,  99, 101, 104, 110, // 1488-1495
-117, 127, 138, 152, 157, 159, 152, 146, // 1496-1503
-139, 131, 126, 112, 109,  99, 101, 103, // 1504-1511
-107, 114, 119, 134, 143, 155, 158, 155, // 1512-1519
-150, 143, 137, 129, 121, 111, 104, 100, // 1520-1527
-103, 103, 111, 114, 127, 138, 149, 157, // 1528-1535
-155, 154, 144, 142, 133, 129, 117, 110, // 1536-1543
-102, 101, 103, 104, 112, 117, 131, 141, // 1544-1551
-153, 155, 155, 149, 144, 139, 131, 127, // 1552-1559
-113, 108, 102, 102, 105, 107, 115, 121, // 1560-1567
-136, 144, 154, 153, 153, 145, 143, 136, // 1568-1575
-132, 123, 113, 106, 101, 104, 103, 111, // 1576-1583
-113, 127, 135, 149, 153, 154, 150, 144, // 1584-1591
-143, 135, 133, 120, 114, 104, 103, 102, // 1592-1599
-104, 110, 113, 128, 135, 150, 152, 154, // 1600-1607
-150, 144, 144, 134, 133, 120, 112, 107, // 1608-1615
-101, 106, 103, 110, 115, 126, 138, 147, // 1616-1623
-154, 150, 151, 143, 144, 137, 131, 123, // 1624-1631
-111, 108, 100, 104, 102, 109, 113, 125, // 1632-1639
-138, 145, 154, 150, 152, 144, 144, 139, // 1640-1647
-130, 126, 110, 110, 100, 104, 103, 107, // 1648-1655
-116, 122, 140, 142, 154, 150, 151, 148, // 1656-1663
-142, 143, 130, 129, 114, 109, 104,  98, // 1664-1671
-106, 101, 116, 119, 135, 144, 148, 155, // 1672-1679
-147, 150, 142, 142, 135, 128, 120, 109, // 1680-1687
-105, 101, 102, 104, 110, 119, 130, 139, // 1688-1695
-149, 149, 151, 147, 146, 143, 138, 133, // 1696-1703
-121, 115, 106, 103, 102, 103, 109, 115, // 1704-1711
-126, 136, 144, 150, 148, 149, 144, 144, // 1712-1719
-141, 135, 129, 117, 112, 102, 103, 102, // 1720-1727
-106, 113, 120, 133, 139, 148, 147, 148, // 1728-1735
-146, 143, 145, 138, 136, 123, 115, 107, // 1736-1743
-101, 103, 102, 110, 116, 125, 136, 142, // 1744-1751
-148, 147, 148, 145, 145, 142, 138, 130, // 1752-1759
-120, 112, 104, 102, 101, 106, 111, 119, // 1760-1767
-129, 136, 144, 147, 149, 147, 146, 144, // 1768-1775
-141, 137, 128, 121, 109, 105, 101, 102, // 1776-1783
-107, 111, 121, 128, 138, 144, 147, 148, // 1784-1791
-146, 145, 144, 142, 137, 128, 118, 109, // 1792-1799
-103, 101, 103, 106, 112, 121, 129, 140, // 1800-1807
-144, 148, 146, 146, 144, 143, 143, 136, // 1808-1815
-129, 117, 109, 103, 102, 103, 107, 114, // 1816-1823
-121, 133, 139, 147, 147, 147, 146, 144, // 1824-1831
-145, 141, 136, 126, 117, 107, 104, 101, // 1832-1839
-104, 107, 114, 121, 130, 139, 144, 148, // 1840-1847
-147, 147, 145, 145, 141, 137, 127, 118, // 1848-1855
-107, 103, 100, 103, 106, 113, 120, 128, // 1856-1863
-138, 142, 149, 146, 148, 145, 147, 144, // 1864-1871
-140, 131, 120, 111, 102, 101, 100, 106, // 1872-1879
-109, 118, 125, 135, 142, 146, 147, 146, // 1880-1887
-146, 146, 146, 142, 136, 125, 115, 105, // 1888-1895
-101, 100, 104, 107, 114, 121, 129, 138, // 1896-1903
-142, 147, 145, 147, 145, 147, 144, 140, // 1904-1911
-130, 120, 109, 105, 102, 103, 108, 108, // 1912-1919
-120, 122, 136, 138, 146, 146, 145, 147, // 1920-1927
-144, 148, 140, 137, 125, 116, 108, 102, // 1928-1935
-103, 103, 108, 113, 120, 128, 136, 141, // 1936-1943
-146, 144, 148, 144, 148, 144, 141, 133, // 1944-1951
-121, 115, 103, 104, 100, 105, 107, 114, // 1952-1959
-122, 130, 139, 143, 147, 147, 147, 147, // 1960-1967
-147, 145, 141, 131, 122, 111, 104, 101, // 1968-1975
- 99, 104, 105, 116, 121, 133, 139, 144, // 1976-1983
-148, 144, 148, 145, 148, 145, 140, 134, // 1984-1991
-120, 114, 103, 101, 100, 103, 108, 114, // 1992-1999
-123, 130, 140, 142, 147, 144, 146, 144, // 2000-2007
-146, 145, 140, 134, 121, 116, 104, 106, // 2008-2015
-100, 107, 107, 114, 122, 128, 140, 139, // 2016-2023
-147, 141, 145, 143, 144, 146, 139, 137, // 2024-2031
-123, 118, 108, 106, 104, 104, 110, 111, // 2032-2039
-122, 125, 136, 139, 143, 143, 141, 144, // 2040-2047
-142, 146, 142, 138, 129, 120, 114, 108, // 2048-2055
-107, 105, 108, 110, 117, 124, 130, 138, // 2056-2063
-138, 142, 139, 141, 143, 143, 145, 138, // 2064-2071
-136, 124, 119, 112, 109, 108, 106, 111, // 2072-2079
-111, 121, 124, 134, 137, 139, 141, 139, // 2080-2087
-143, 142, 147, 141, 140, 130, 124, 116, // 2088-2095
-112, 110, 106, 111, 107, 116, 118, 128, // 2096-2103
-132, 136, 140, 138, 142, 141, 145, 145, // 2104-2111
-142, 138, 129, 123, 115, 113, 109, 108, // 2112-2119
-108, 109, 114, 120, 128, 134, 137, 139, // 2120-2127
-139, 141, 143, 146, 146, 142, 137, 129, // 2128-2135
-122, 116, 112, 109, 108, 107, 110, 114, // 2136-2143
-121, 126, 133, 136, 140, 141, 143, 144, // 2144-2151
-145, 145, 141, 136, 129, 123, 116, 112, // 2152-2159
-108, 106, 106, 109, 114, 121, 128, 133, // 2160-2167
-138, 140, 142, 142, 145, 144, 146, 141, // 2168-2175
-137, 129, 121, 115, 110, 109, 107, 109, // 2176-2183
-109, 116, 121, 128, 134, 137, 140, 139, // 2184-2191
-144, 144, 147, 146, 141, 135, 127, 121, // 2192-2199
-114, 112, 106, 108, 105, 110, 113, 121, // 2200-2207
-129, 132, 140, 138, 145, 141, 146, 144, // 2208-2215
-143, 142, 133, 132, 119, 119, 109, 109, // 2216-2223
-107, 105, 111, 111, 122, 125, 134, 138, // 2224-2231
-139, 144, 141, 145, 143, 143, 142, 135, // 2232-2239
-133, 123, 121, 114, 112, 110, 108, 111, // 2240-2247
-110, 119, 121, 131, 134, 138, 139, 139, // 2248-2255
-140, 140, 141, 140, 139, 134, 130, 124, // 2256-2263
-121, 117, 114, 112, 110, 112, 114, 119, // 2264-2271
-125, 129, 135, 135, 137, 137, 138, 141, // 2272-2279
-139, 142, 137, 135, 129, 125, 121, 117, // 2280-2287
-115, 111, 111, 111, 115, 119, 125, 129, // 2288-2295
-134, 134, 138, 137, 140, 142, 142, 143, // 2296-2303
-137, 136, 127, 125, 118, 115, 112, 109, // 2304-2311
-111, 110, 116, 118, 127, 130, 136, 137, // 2312-2319
-139, 140, 141, 143, 141, 142, 135, 134, // 2320-2327
-126, 123, 118, 113, 113, 108, 110, 110, // 2328-2335
-116, 123, 127, 134, 134, 138, 138, 139, // 2336-2343
-142, 140, 143, 138, 137, 131, 127, 122, // 2344-2351
-119, 115, 113, 112, 111, 114, 114, 123, // 2352-2359
-124, 133, 133, 137, 137, 136, 140, 137, // 2360-2367
-143, 138, 139, 133, 129, 126, 119, 121, // 2368-2375
-113, 116, 111, 114, 116, 119, 125, 126, // 2376-2383
-133, 132, 136, 135, 137, 139, 138, 140, // 2384-2391
-137, 136, 132, 128, 125, 121, 119, 114, // 2392-2399
-115, 110, 115, 115, 122, 126, 129, 133, // 2400-2407
-131, 136, 134, 139, 139, 141, 141, 137, // 2408-2415
-136, 130, 129, 123, 121, 116, 114, 112, // 2416-2423
-112, 115, 117, 123, 125, 130, 131, 134, // 2424-2431
-135, 137, 139, 140, 142, 140, 139, 134, // 2432-2439
-130, 126, 122, 120, 115, 114, 111, 113, // 2440-2447
-114, 118, 123, 126, 131, 132, 135, 135, // 2448-2455
-138, 139, 141, 141, 140, 137, 135, 130, // 2456-2463
-126, 123, 117, 116, 111, 112, 111, 114, // 2464-2471
-119, 122, 129, 129, 134, 133, 137, 137, // 2472-2479
-140, 142, 141, 141, 136, 135, 128, 127, // 2480-2487
-121, 119, 114, 112, 111, 111, 116, 118, // 2488-2495
-124, 126, 131, 132, 134, 136, 136, 139, // 2496-2503
-140, 141, 140, 137, 135, 129, 127, 123, // 2504-2511
-119, 117, 111, 114, 110, 116, 118, 122, // 2512-2519
-129, 129, 135, 132, 136, 136, 137, 141, // 2520-2527
-138, 142, 135, 135, 130, 126, 125, 117, // 2528-2535
-119, 111, 115, 111, 114, 119, 121, 129, // 2536-2543
-128, 134, 132, 135, 135, 136, 140, 138, // 2544-2551
-141, 136, 135, 130, 127, 124, 121, 119, // 2552-2559
-115, 114, 113, 116, 117, 122, 124, 129, // 2560-2567
-131, 133, 134, 134, 137, 137, 139, 139, // 2568-2575
-138, 136, 132, 130, 126, 124, 120, 118, // 2576-2583
-114, 113, 113, 114, 119, 121, 127, 128, // 2584-2591
-132, 133, 133, 137, 136, 141, 139, 141, // 2592-2599
-138, 134, 134, 127, 129, 121, 121, 116, // 2600-2607
-112, 113, 109, 116, 115, 123, 126, 128, // 2608-2615
-134, 131, 137, 135, 139, 141, 139, 144, // 2616-2623
-136, 138, 132, 128, 129, 119, 124, 112, // 2624-2631
-115, 110, 110, 115, 114, 125, 124, 131, // 2632-2639
-131, 133, 135, 135, 139, 140, 141, 141, // 2640-2647
-138, 136, 133, 127, 128, 120, 122, 115, // 2648-2655
-114, 113, 110, 118, 115, 126, 123, 131, // 2656-2663
-131, 132, 135, 134, 139, 138, 141, 140, // 2664-2671
-138, 135, 132, 128, 127, 122, 122, 118, // 2672-2679
-114, 115, 109, 118, 113, 125, 123, 129, // 2680-2687
-132, 130, 137, 131, 141, 136, 142, 140, // 2688-2695
-137, 138, 129, 133, 123, 128, 119, 122, // 2696-2703
-114, 114, 113, 111, 118, 116, 127, 125, // 2704-2711
-132, 131, 133, 136, 134, 141, 138, 142, // 2712-2719
-138, 138, 133, 132, 127, 128, 122, 123, // 2720-2727
-116, 115, 114, 110, 118, 112, 127, 120, // 2728-2735
-133, 129, 131, 137, 130, 143, 134, 144, // 2736-2743
-137, 138, 136, 129, 133, 125, 129, 121, // 2744-2751
-123, 114, 117, 110, 115, 113, 119, 124, // 2752-2759
-124, 133, 127, 137, 130, 137, 137, 138, // 2760-2767
-143, 136, 142, 130, 136, 126, 129, 125, // 2768-2775
-122, 123, 113, 119, 108, 117, 113, 121, // 2776-2783
-124, 126, 132, 128, 135, 131, 137, 136, // 2784-2791
-140, 141, 139, 138, 131, 133, 126, 130, // 2792-2799
-123, 125, 119, 115, 115, 109, 118, 112, // 2800-2807
-124, 122, 127, 131, 128, 136, 130, 138, // 2808-2815
-136, 141, 141, 139, 140, 132, 135, 126, // 2816-2823
-131, 123, 124, 119, 113, 117, 106, 118, // 2824-2831
-111, 123, 122, 125, 133, 126, 137, 129, // 2832-2839
-139, 138, 139, 144, 137, 142, 132, 134, // 2840-2847
-128, 128, 125, 121, 120, 113, 115, 109, // 2848-2855
-115, 114, 120, 124, 125, 132, 128, 136, // 2856-2863
-132, 138, 138, 141, 142, 140, 139, 133, // 2864-2871
-134, 126, 130, 122, 124, 117, 114, 116, // 2872-2879
-107, 119, 110, 124, 122, 127, 132, 127, // 2880-2887
-137, 129, 139, 136, 141, 141, 139, 139, // 2888-2895
-133, 133, 127, 128, 123, 124, 119, 117, // 2896-2903
-115, 111, 116, 113, 122, 122, 128, 130, // 2904-2911
-130, 134, 132, 137, 137, 140, 141, 139, // 2912-2919
-140, 133, 133, 126, 128, 124, 122, 122, // 2920-2927
-114, 118, 109, 116, 114, 118, 125, 122, // 2928-2935
-134, 127, 136, 132, 135, 138, 135, 144, // 2936-2943
-136, 142, 132, 133, 128, 124, 128, 120, // 2944-2951
-127, 115, 120, 113, 113, 117, 114, 126, // 2952-2959
-121, 132, 129, 131, 135, 130, 139, 133, // 2960-2967
-142, 138, 138, 137, 130, 132, 125, 129, // 2968-2975
-124, 124, 123, 117, 119, 111, 117, 115, // 2976-2983
-119, 125, 123, 132, 127, 133, 131, 132, // 2984-2991
-137, 134, 143, 136, 140, 135, 130, 133, // 2992-2999
-124, 132, 123, 127, 122, 116, 119, 110, // 3000-3007
-118, 114, 120, 124, 123, 132, 126, 133, // 3008-3015
-129, 132, 136, 135, 142, 136, 141, 133, // 3016-3023
-133, 130, 128, 130, 124, 128, 117, 122, // 3024-3031
-112, 116, 114, 115, 122, 119, 131, 124, // 3032-3039
-133, 129, 132, 134, 133, 141, 136, 142, // 3040-3047
-137, 136, 134, 129, 130, 126, 125, 124, // 3048-3055
-118, 120, 113, 115, 115, 114, 123, 119, // 3056-3063
-131, 125, 132, 131, 129, 137, 131, 142, // 3064-3071
-137, 140, 139, 132, 136, 126, 130, 126, // 3072-3079
-124, 126, 116, 121, 112, 116, 114, 115, // 3080-3087
-124, 120, 132, 126, 132, 131, 131, 137, // 3088-3095
-133, 142, 138, 140, 139, 132, 135, 126, // 3096-3103
-129, 128, 122, 128, 115, 121, 112, 111, // 3104-3111
-118, 109, 127, 117, 131, 129, 127, 138, // 3112-3119
-125, 140, 132, 140, 144, 136, 145, 131, // 3120-3127
-136, 130, 126, 132, 120, 129, 116, 119, // 3128-3135
-114, 109, 117, 109, 124, 118, 129, 128, // 3136-3143
-128, 134, 127, 137, 132, 140, 140, 139, // 3144-3151
-143, 134, 136, 129, 129, 129, 125, 128, // 3152-3159
-121, 119, 117, 112, 115, 113, 119, 121, // 3160-3167
-125, 128, 128, 130, 129, 131, 133, 137, // 3168-3175
-138, 142, 139, 140, 134, 132, 131, 126, // 3176-3183
-132, 123, 129, 118, 119, 115, 111, 118, // 3184-3191
-110, 125, 118, 129, 126, 128, 132, 126, // 3192-3199
-136, 131, 141, 139, 141, 141, 136, 135, // 3200-3207
-129, 130, 127, 129, 125, 126, 118, 119, // 3208-3215
-112, 114, 114, 115, 123, 120, 130, 125, // 3216-3223
-131, 130, 130, 135, 133, 140, 139, 141, // 3224-3231
-139, 136, 133, 131, 128, 130, 127, 126, // 3232-3239
-124, 115, 120, 109, 116, 113, 116, 123, // 3240-3247
-119, 131, 123, 132, 129, 130, 136, 133, // 3248-3255
-142, 138, 143, 138, 138, 133, 132, 130, // 3256-3263
-128, 131, 121, 129, 112, 121, 110, 112, // 3264-3271
-118, 109, 129, 114, 133, 124, 128, 134, // 3272-3279
-124, 140, 129, 142, 139, 140, 141, 135, // 3280-3287
-136, 130, 130, 128, 130, 123, 129, 115, // 3288-3295
-121, 113, 111, 120, 109, 129, 116, 130, // 3296-3303
-127, 124, 136, 122, 140, 129, 140, 140, // 3304-3311
-138, 144, 132, 139, 126, 134, 125, 131, // 3312-3319
-126, 124, 125, 112, 123, 105, 121, 112, // 3320-3327
-119, 126, 117, 135, 119, 134, 127, 129, // 3328-3335
-138, 130, 145, 136, 143, 137, 134, 135, // 3336-3343
-128, 133, 127, 131, 123, 126, 118, 117, // 3344-3351
-116, 109, 120, 111, 124, 120, 123, 130, // 3352-3359
-121, 135, 125, 135, 134, 136, 142, 138, // 3360-3367
-142, 137, 136, 133, 132, 130, 130, 127, // 3368-3375
-125, 124, 114, 119, 110, 114, 116, 113, // 3376-3383
-126, 116, 131, 124, 128, 133, 126, 139, // 3384-3391
-131, 142, 139, 141, 141, 135, 138, 129, // 3392-3399
-134, 127, 132, 124, 125, 120, 115, 117, // 3400-3407
-108, 118, 111, 121, 121, 124, 129, 124, // 3408-3415
-133, 126, 134, 133, 137, 141, 139, 144, // 3416-3423
-135, 140, 130, 133, 130, 127, 130, 121, // 3424-3431
-126, 114, 119, 112, 113, 116, 114, 122, // 3432-3439
-121, 127, 126, 129, 129, 130, 133, 135, // 3440-3447
-139, 139, 142, 139, 138, 136, 130, 132, // 3448-3455
-128, 128, 129, 122, 125, 115, 117, 114, // 3456-3463
-110, 119, 113, 124, 122, 125, 130, 125, // 3464-3471
-133, 129, 134, 137, 136, 142, 139, 140, // 3472-3479
-137, 134, 132, 130, 129, 129, 128, 123, // 3480-3487
-125, 114, 118, 113, 111, 120, 111, 126, // 3488-3495
-119, 126, 129, 124, 135, 127, 135, 136, // 3496-3503
-136, 143, 138, 141, 137, 135, 133, 130, // 3504-3511
-130, 129, 129, 123, 125, 116, 115, 116, // 3512-3519
-108, 121, 112, 123, 123, 122, 131, 123, // 3520-3527
-133, 130, 132, 138, 135, 141, 141, 138, // 3528-3535
-139, 135, 131, 133, 128, 131, 129, 121, // 3536-3543
-126, 113, 117, 115, 110, 121, 113, 122, // 3544-3551
-124, 120, 132, 124, 131, 132, 129, 139, // 3552-3559
-135, 140, 142, 137, 140, 133, 132, 132, // 3560-3567
-128, 130, 129, 123, 126, 116, 114, 118, // 3568-3575
-108, 121, 115, 119, 127, 118, 133, 123, // 3576-3583
-130, 133, 127, 140, 133, 141, 140, 137, // 3584-3591
-140, 131, 136, 128, 132, 128, 129, 127, // 3592-3599
-121, 125, 109, 121, 109, 115, 122, 112, // 3600-3607
-131, 118, 128, 130, 122, 137, 125, 137, // 3608-3615
-136, 135, 143, 135, 142, 133, 135, 133, // 3616-3623
-128, 134, 126, 132, 122, 125, 116, 114, // 3624-3631
-118, 108, 122, 115, 120, 127, 119, 130, // 3632-3639
-125, 127, 133, 129, 137, 135, 138, 141, // 3640-3647
-138, 140, 135, 135, 133, 131, 132, 129, // 3648-3655
-127, 123, 122, 114, 117, 113, 112, 120, // 3656-3663
-114, 123, 124, 121, 129, 124, 129, 131, // 3664-3671
-131, 136, 135, 140, 138, 139, 139, 135, // 3672-3679
-136, 132, 131, 131, 128, 126, 124, 120, // 3680-3687
-114, 118, 112, 115, 120, 116, 124, 123, // 3688-3695
-123, 127, 126, 129, 131, 133, 135, 137, // 3696-3703
-139, 139, 140, 137, 135, 133, 132, 130, // 3704-3711
-130, 129, 124, 125, 119, 114, 117, 111, // 3712-3719
-117, 119, 119, 124, 123, 125, 126, 129, // 3720-3727
-128, 131, 134, 133, 138, 139, 137, 141, // 3728-3735
-136, 134, 135, 129, 132, 129, 129, 126, // 3736-3743
-123, 121, 112, 117, 112, 114, 121, 118, // 3744-3751
-123, 124, 124, 125, 129, 128, 130, 135, // 3752-3759
-133, 138, 139, 138, 141, 138, 135, 135, // 3760-3767
-132, 132, 130, 130, 126, 121, 123, 112, // 3768-3775
-116, 115, 111, 120, 118, 119, 124, 124, // 3776-3783
-124, 129, 128, 130, 133, 134, 136, 139, // 3784-3791
-140, 139, 140, 137, 134, 134, 132, 128, // 3792-3799
-133, 127, 123, 126, 113, 116, 115, 112, // 3800-3807
-118, 119, 121, 120, 126, 122, 125, 131, // 3808-3815
-126, 134, 134, 134, 138, 139, 138, 138, // 3816-3823
-138, 133, 135, 132, 131, 131, 130, 125, // 3824-3831
-123, 122, 111, 118, 114, 112, 123, 117, // 3832-3839
-122, 124, 124, 125, 127, 131, 128, 136, // 3840-3847
-135, 133, 141, 136, 137, 140, 134, 134, // 3848-3855
-134, 131, 130, 130, 128, 122, 124, 116, // 3856-3863
-112, 119, 110, 117, 122, 116, 125, 124, // 3864-3871
-125, 127, 130, 130, 130, 137, 132, 136, // 3872-3879
-141, 135, 140, 139, 132, 136, 132, 130, // 3880-3887
-130, 129, 126, 122, 124, 113, 114, 118, // 3888-3895
-109, 120, 119, 119, 125, 124, 126, 125, // 3896-3903
-132, 129, 131, 139, 132, 139, 140, 135, // 3904-3911
-139, 137, 132, 135, 132, 130, 131, 130, // 3912-3919
-126, 122, 124, 113, 114, 119, 109, 120, // 3920-3927
-121, 118, 125, 124, 125, 126, 130, 131, // 3928-3935
-130, 138, 133, 136, 140, 134, 138, 137, // 3936-3943
-133, 134, 133, 132, 130, 131, 127, 121, // 3944-3951
-124, 115, 113, 118, 113, 116, 121, 119, // 3952-3959
-121, 124, 127, 124, 131, 132, 128, 137, // 3960-3967
-134, 133, 140, 136, 137, 138, 135, 133, // 3968-3975
-134, 134, 130, 132, 131, 120, 124, 119, // 3976-3983
-109, 119, 113, 113, 121, 119, 121, 123, // 3984-3991
-128, 124, 127, 134, 126, 134, 136, 132, // 3992-3999
-139, 138, 136, 137, 137, 134, 134, 136, // 4000-4007
-130, 130, 133, 123, 122, 122, 112, 114, // 4008-4015
-116, 114, 116, 121, 122, 120, 126, 127, // 4016-4023
-125, 130, 132, 130, 134, 135, 135, 137, // 4024-4031
-137, 136, 137, 136, 133, 134, 132, 131, // 4032-4039
-130, 130, 124, 119, 123, 112, 113, 119, // 4040-4047
-112, 118, 122, 122, 122, 126, 128, 125, // 4048-4055
-130, 133, 130, 135, 136, 134, 138, 137, // 4056-4063
-136, 137, 134, 133, 133, 131, 131, 129, // 4064-4071
-130, 123, 121, 122, 112, 114, 116, 114, // 4072-4079
-117, 122, 122, 123, 126, 128, 127, 129, // 4080-4087
-133, 131, 134, 136, 134, 137, 136, 136, // 4088-4095
-136, 135, 133, 133, 132, 130, 130, 130, // 4096-4103
-125, 121, 121, 115, 113, 117, 115, 117, // 4104-4111
-121, 123, 123, 125, 127, 127, 129, 131, // 4112-4119
-132, 134, 135, 134, 136, 135, 135, 136, // 4120-4127
-135, 133, 133, 133, 130, 131, 130, 128, // 4128-4135
-123, 121, 118, 113, 115, 115, 116, 118, // 4136-4143
-121, 124, 124, 125, 129, 129, 128, 132, // 4144-4151
-133, 133, 134, 137, 135, 135, 137, 136, // 4152-4159
-135, 133, 134, 132, 130, 130, 131, 127, // 4160-4167
-120, 121, 118, 111, 115, 118, 116, 119, // 4168-4175
-124, 124, 123, 125, 129, 127, 128, 132, // 4176-4183
-134, 132, 134, 138, 135, 133, 137, 137, // 4184-4191
-133, 133, 135, 131, 129, 130, 131, 125, // 4192-4199
-120, 122, 117, 112, 116, 119, 117, 118, // 4200-4207
-124, 125, 124, 126, 129, 128, 127, 132, // 4208-4215
-134, 134, 133, 136, 135, 133, 134, 136, // 4216-4223
-134, 130, 133, 132, 129, 129, 130, 126, // 4224-4231
-119, 119, 118, 114, 115, 119, 120, 119, // 4232-4239
-122, 127, 125, 125, 130, 131, 129, 131, // 4240-4247
-134, 134, 131, 134, 136, 134, 134, 135, // 4248-4255
-135, 132, 132, 132, 131, 128, 129, 127, // 4256-4263
-122, 118, 120, 116, 112, 117, 119, 119, // 4264-4271
-121, 125, 127, 125, 127, 131, 130, 130, // 4272-4279
-132, 134, 134, 134, 135, 135, 134, 135, // 4280-4287
-135, 135, 133, 132, 132, 129, 129, 130, // 4288-4295
-126, 120, 120, 117, 113, 114, 116, 118, // 4296-4303
-119, 122, 125, 126, 126, 127, 128, 130, // 4304-4311
-130, 133, 135, 134, 134, 134, 134, 135, // 4312-4319
-135, 135, 134, 133, 132, 131, 132, 130, // 4320-4327
-129, 124, 120, 118, 117, 115, 114, 117, // 4328-4335
-118, 120, 123, 125, 126, 125, 126, 128, // 4336-4343
-130, 132, 132, 133, 134, 134, 134, 134, // 4344-4351
-135, 135, 134, 133, 133, 132, 131, 130, // 4352-4359
-128, 128, 124, 121, 120, 118, 115, 115, // 4360-4367
-117, 119, 122, 123, 125, 125, 126, 127, // 4368-4375
-128, 131, 132, 132, 133, 134, 135, 134, // 4376-4383
-134, 135, 133, 134, 134, 132, 132, 131, // 4384-4391
-130, 130, 128, 127, 123, 120, 119, 118, // 4392-4399
-117, 116, 118, 120, 121, 124, 125, 125, // 4400-4407
-126, 128, 129, 131, 131, 133, 133, 134, // 4408-4415
-134, 134, 134, 132, 133, 133, 133, 133, // 4416-4423
-132, 131, 130, 130, 128, 128, 125, 122, // 4424-4431
-120, 119, 118, 118, 119, 119, 120, 123, // 4432-4439
-123, 124, 125, 127, 127, 129, 132, 132, // 4440-4447
-133, 133, 133, 133, 132, 134, 134, 133, // 4448-4455
-135, 134, 132, 131, 131, 130, 128, 128, // 4456-4463
-127, 124, 122, 120, 119, 117, 117, 118, // 4464-4471
-119, 121, 123, 123, 124, 125, 127, 128, // 4472-4479
-131, 132, 133, 134, 133, 134, 133, 133, // 4480-4487
-134, 134, 134, 134, 133, 132, 130, 130, // 4488-4495
-129, 128, 127, 126, 124, 121, 119, 118, // 4496-4503
-116, 117, 118, 119, 121, 123, 124, 126, // 4504-4511
-127, 128, 130, 132, 133, 134, 135, 134, // 4512-4519
-133, 133, 133, 133, 133, 134, 133, 132, // 4520-4527
-131, 130, 128, 128, 128, 127, 126, 123, // 4528-4535
-120, 118, 117, 117, 118, 119, 120, 122, // 4536-4543
-124, 125, 126, 127, 128, 130, 132, 134, // 4544-4551
-135, 134, 134, 133, 133, 132, 133, 133, // 4552-4559
-132, 132, 132, 131, 129, 128, 127, 127, // 4560-4567
-127, 126, 124, 121, 120, 118, 117, 118, // 4568-4575
-119, 120, 121, 124, 125, 125, 127, 129, // 4576-4583
-130, 133, 134, 135, 134, 133, 133, 133, // 4584-4591
-132, 132, 133, 133, 133, 132, 131, 129, // 4592-4599
-128, 128, 127, 127, 127, 125, 123, 120, // 4600-4607
-118, 118, 117, 118, 120, 121, 123, 125, // 4608-4615
-126, 127, 127, 129, 131, 133, 135, 134, // 4616-4623
-133, 132, 132, 132, 132, 133, 133, 132, // 4624-4631
-132, 131, 130, 129, 128, 128, 128, 127, // 4632-4639
-126, 124, 122, 120, 119, 118, 119, 120, // 4640-4647
-121, 122, 124, 125, 126, 127, 128, 129, // 4648-4655
-131, 133, 134, 134, 133, 132, 132, 132, // 4656-4663
-132, 132, 132, 132, 131, 131, 129, 128, // 4664-4671
-128, 128, 128, 128, 126, 124, 122, 120, // 4672-4679
-120, 120, 120, 120, 121, 123, 124, 124, // 4680-4687
-126, 126, 127, 130, 131, 133, 133, 133, // 4688-4695
-133, 132, 132, 131, 132, 132, 132, 132, // 4696-4703
-131, 131, 130, 128, 128, 128, 127, 127, // 4704-4711
-126, 125, 122, 120, 119, 119, 119, 121, // 4712-4719
-122, 123, 124, 125, 125, 126, 128, 130, // 4720-4727
-132, 133, 134, 133, 133, 132, 131, 131, // 4728-4735
-131, 132, 132, 131, 131, 130, 129, 128, // 4736-4743
-127, 127, 127, 127, 127, 125, 123, 121, // 4744-4751
-120, 120, 120, 121, 122, 123, 124, 125, // 4752-4759
-125, 127, 128, 130, 132, 133, 133, 133, // 4760-4767
-133, 132, 132, 131, 131, 132, 131, 131, // 4768-4775
-131, 130, 129, 128, 128, 127, 127, 127, // 4776-4783
-127, 126, 124, 123, 121, 121, 121, 121, // 4784-4791
-121, 123, 123, 124, 124, 125, 127, 129, // 4792-4799
-130, 132, 132, 132, 132, 132, 132, 132, // 4800-4807
-131, 131, 131, 131, 131, 130, 130, 129, // 4808-4815
-129, 128, 128, 128, 128, 127, 125, 124, // 4816-4823
-122, 121, 121, 121, 121, 122, 122, 123, // 4824-4831
-124, 125, 126, 128, 129, 130, 131, 132, // 4832-4839
-132, 132, 132, 131, 131, 131, 131, 131, // 4840-4847
-130, 131, 130, 130, 129, 129, 128, 128, // 4848-4855
-128, 127, 126, 125, 124, 123, 122, 121, // 4856-4863
-121, 121, 122, 123, 124, 124, 125, 126, // 4864-4871
-128, 129, 130, 131, 132, 132, 132, 131, // 4872-4879
-131, 131, 131, 130, 131, 131, 131, 130, // 4880-4887
-130, 130, 129, 128, 128, 128, 127, 126, // 4888-4895
-125, 124, 122, 122, 121, 121, 122, 122, // 4896-4903
-123, 123, 124, 125, 126, 128, 129, 130, // 4904-4911
-131, 132, 132, 132, 131, 131, 131, 131, // 4912-4919
-131, 131, 131, 130, 130, 130, 130, 129, // 4920-4927
-129, 128, 128, 128, 126, 125, 124, 123, // 4928-4935
-121, 121, 121, 121, 122, 122, 123, 124, // 4936-4943
-125, 126, 127, 129, 130, 131, 131, 131, // 4944-4951
-131, 131, 131, 131, 131, 131, 132, 131, // 4952-4959
-131, 130, 130, 130, 130, 129, 129, 128, // 4960-4967
-127, 126, 125, 124, 123, 122, 122, 122, // 4968-4975
-121, 122, 123, 123, 124, 125, 126, 126, // 4976-4983
-128, 129, 130, 131, 131, 131, 131, 131, // 4984-4991
-131, 132, 132, 131, 131, 131, 131, 131, // 4992-4999
-130, 129, 129, 128, 128, 127, 127, 126, // 5000-5007
-125, 124, 123, 122, 121, 121, 121, 122, // 5008-5015
-123, 124, 124, 125, 126, 127, 129, 130, // 5016-5023
-131, 132, 132, 132, 131, 131, 131, 131, // 5024-5031
-131, 131, 131, 131, 130, 130, 129, 129, // 5032-5039
-129, 128, 128, 127, 126, 125, 124, 123, // 5040-5047
-122, 122, 122, 122, 122, 123, 123, 124, // 5048-5055
-125, 126, 127, 128, 129, 130, 131, 131, // 5056-5063
-132, 132, 131, 131, 131, 131, 131, 131, // 5064-5071
-131, 130, 130, 130, 129, 129, 129, 128, // 5072-5079
-127, 127, 126, 125, 124, 123, 123, 122, // 5080-5087
-122, 122, 122, 122, 123, 124, 125, 126, // 5088-5095
-127, 128, 129, 130, 131, 131, 131, 131, // 5096-5103
-131, 131, 131, 131, 131, 131, 131, 130, // 5104-5111
-130, 129, 129, 129, 129, 128, 128, 127, // 5112-5119
-126, 125, 124, 123, 123, 122, 122, 122, // 5120-5127
-122, 122, 123, 124, 125, 126, 127, 128, // 5128-5135
-129, 130, 130, 131, 131, 132, 132, 131, // 5136-5143
-131, 131, 131, 131, 131, 130, 130, 130, // 5144-5151
-129, 129, 129, 128, 127, 127, 126, 125, // 5152-5159
-125, 124, 124, 123, 122, 122, 122, 122, // 5160-5167
-123, 124, 125, 126, 126, 127, 128, 129, // 5168-5175
-130, 131, 132, 132, 132, 132, 132, 132, // 5176-5183
-132, 131, 131, 130, 130, 129, 129, 129, // 5184-5191
-129, 128, 128, 127, 126, 125, 125, 124, // 5192-5199
-124, 123, 122, 122, 122, 122, 122, 123, // 5200-5207
-124, 125, 126, 126, 127, 129, 130, 131, // 5208-5215
-132, 132, 132, 132, 132, 132, 132, 132, // 5216-5223
-131, 131, 130, 130, 130, 129, 129, 129, // 5224-5231
-128, 128, 127, 126, 125, 125, 124, 123, // 5232-5239
-122, 122, 121, 121, 121, 122, 123, 124, // 5240-5247
-125, 126, 127, 128, 129, 131, 131, 132, // 5248-5255
-132, 132, 132, 132, 132, 132, 131, 131, // 5256-5263
-130, 130, 130, 129, 129, 129, 129, 128, // 5264-5271
-127, 126, 126, 125, 124, 124, 123, 122, // 5272-5279
-121, 121, 121, 122, 123, 124, 125, 126, // 5280-5287
-127, 127, 128, 130, 131, 132, 132, 132, // 5288-5295
-132, 132, 131, 131, 131, 131, 131, 130, // 5296-5303
-129, 129, 129, 129, 129, 129, 128, 127, // 5304-5311
-126, 125, 125, 124, 124, 123, 123, 122, // 5312-5319
-122, 122, 122, 123, 124, 125, 126, 127, // 5320-5327
-128, 129, 130, 131, 131, 132, 132, 132, // 5328-5335
-132, 131, 131, 131, 130, 130, 130, 129, // 5336-5343
-129, 129, 129, 129, 129, 128, 127, 126, // 5344-5351
-126, 125, 125, 124, 123, 122, 122, 122, // 5352-5359
-122, 123, 124, 124, 125, 126, 127, 128, // 5360-5367
-129, 130, 131, 131, 131, 131, 131, 131, // 5368-5375
-131, 131, 131, 130, 130, 130, 129, 129, // 5376-5383
-129, 129, 129, 128, 128, 127, 126, 126, // 5384-5391
-125, 124, 124, 123, 123, 122, 122, 122, // 5392-5399
-122, 123, 124, 126, 127, 128, 128, 129, // 5400-5407
-130, 131, 132, 132, 132, 132, 131, 131, // 5408-5415
-130, 130, 130, 130, 129, 129, 129, 129, // 5416-5423
-128, 128, 128, 127, 127, 126, 126, 125, // 5424-5431
-124, 124, 123, 122, 122, 122, 123, 123, // 5432-5439
-124, 125, 126, 127, 128, 129, 130, 131, // 5440-5447
-132, 132, 132, 132, 131, 131, 131, 130, // 5448-5455
-130, 130, 129, 129, 129, 129, 128, 128, // 5456-5463
-128, 128, 127, 126, 126, 125, 125, 124, // 5464-5471
-124, 123, 123, 122, 123, 123, 124, 125, // 5472-5479
-126, 126, 127, 128, 129, 130, 131, 131, // 5480-5487
-132, 132, 131, 131, 131, 130, 130, 130, // 5488-5495
-129, 129, 129, 129, 129, 128, 128, 128, // 5496-5503
-128, 127, 126, 126, 125, 125, 124, 124, // 5504-5511
-123, 123, 123, 123, 123, 124, 125, 126, // 5512-5519
-127, 128, 129, 129, 130, 130, 131, 131, // 5520-5527
-132, 132, 131, 131, 130, 130, 129, 129, // 5528-5535
-129, 129, 129, 128, 128, 128, 127, 127, // 5536-5543
-127, 127, 126, 126, 125, 124, 124, 124, // 5544-5551
-124, 123, 123, 123, 124, 125, 126, 127, // 5552-5559
-128, 128, 129, 130, 130, 131, 131, 132, // 5560-5567
-132, 131, 131, 130, 130, 129, 129, 129, // 5568-5575
-129, 128, 128, 128, 128, 128, 127, 127, // 5576-5583
-127, 126, 126, 125, 125, 124, 124, 124, // 5584-5591
-123, 123, 124, 124, 125, 126, 127, 127, // 5592-5599
-128, 129, 130, 130, 131, 131, 131, 131, // 5600-5607
-131, 130, 130, 130, 129, 129, 129, 129, // 5608-5615
-129, 129, 128, 128, 128, 127, 127, 127, // 5616-5623
-127, 126, 126, 125, 124, 124, 124, 124, // 5624-5631
-124, 124, 125, 125, 126, 126, 127, 128, // 5632-5639
-129, 129, 130, 130, 131, 131, 131, 131, // 5640-5647
-130, 130, 130, 129, 129, 129, 129, 129, // 5648-5655
-128, 128, 128, 128, 127, 127, 127, 127, // 5656-5663
-126, 126, 125, 125, 124, 124, 124, 124, // 5664-5671
-124, 124, 125, 125, 126, 127, 128, 128, // 5672-5679
-129, 130, 130, 131, 131, 131, 131, 131, // 5680-5687
-130, 130, 130, 129, 129, 129, 128, 128, // 5688-5695
-128, 128, 128, 127, 127, 127, 126, 126, // 5696-5703
-126, 125, 125, 124, 124, 124, 124, 124, // 5704-5711
-124, 125, 125, 126, 127, 127, 128, 129, // 5712-5719
-130, 130, 131, 131, 131, 131, 131, 131, // 5720-5727
-130, 130, 129, 129, 129, 129, 128, 128, // 5728-5735
-128, 127, 127, 127, 127, 126, 126, 126, // 5736-5743
-125, 125, 124, 124, 124, 124, 124, 124, // 5744-5751
-125, 125, 126, 126, 127, 128, 129, 130, // 5752-5759
-130, 131, 131, 131, 131, 131, 131, 130, // 5760-5767
-130, 130, 129, 129, 129, 128, 128, 128, // 5768-5775
-127, 127, 127, 127, 127, 126, 126, 125, // 5776-5783
-125, 124, 124, 124, 124, 124, 124, 125, // 5784-5791
-125, 125, 126, 127, 128, 129, 129, 130, // 5792-5799
-130, 131, 131, 131, 131, 131, 131, 130, // 5800-5807
-130, 129, 129, 129, 129, 128, 128, 128, // 5808-5815
-127, 127, 127, 127, 126, 126, 126, 125, // 5816-5823
-125, 124, 124, 124, 124, 124, 124, 125, // 5824-5831
-125, 126, 127, 127, 128, 128, 129, 130, // 5832-5839
-130, 130, 131, 131, 131, 131, 130, 130, // 5840-5847
-130, 129, 129, 129, 129, 128, 128, 128, // 5848-5855
-128, 127, 127, 127, 126, 126, 125, 125, // 5856-5863
-125, 124, 124, 124, 124, 124, 125, 125, // 5864-5871
-126, 126, 126, 127, 128, 129, 129, 130, // 5872-5879
-130, 130, 130, 131, 130, 130, 130, 130, // 5880-5887
-130, 129, 129, 129, 129, 128, 128, 128, // 5888-5895
-127, 127, 127, 127, 126, 126, 126, 125, // 5896-5903
-125, 125, 125, 124, 124, 125, 125, 125, // 5904-5911
-125, 126, 127, 127, 128, 128, 129, 129, // 5912-5919
-130, 130, 130, 130, 130, 130, 130, 130, // 5920-5927
-130, 129, 129, 129, 128, 128, 128, 128};// 5928-5935
-
-#define PEW_N 3320
-const uint8_t pew[PEW_N] = {
-113, 111, 114,  98, 112, 100, 105, 107, // 0-7
-103, 124, 127, 130, 175, 181, 199, 213, // 8-15
-187, 146, 117,  96,  87,  88, 107,  97, // 16-23
- 89, 101, 112, 115, 125, 130, 139, 143, // 24-31
-139, 135, 132, 141, 123, 128, 124, 129, // 32-39
-136, 160, 163, 180, 176, 198, 184, 168, // 40-47
-161, 138, 110, 116,  98, 121, 118, 127, // 48-55
-103,  87,  88,  99,  84,  69,  79,  99, // 56-63
-121, 107,  81,  81,  85,  95, 110, 124, // 64-71
-167, 181, 181, 179, 161, 132, 134, 144, // 72-79
-152, 155, 157, 141, 128, 117, 135, 121, // 80-87
-110, 101, 108, 121, 140, 127, 130, 103, // 88-95
-116, 106, 102, 104,  86,  91, 107, 129, // 96-103
-149, 131, 129, 108, 112, 114, 112, 118, // 104-111
-112, 116, 118, 117, 148, 139, 141, 156, // 112-119
-128, 165, 146, 165, 177, 175, 191, 209, // 120-127
-209, 220, 173, 193, 175, 150, 141, 103, // 128-135
- 96,  94,  76, 105,  71,  88,  82,  77, // 136-143
- 82,  71,  77,  93,  85, 115,  94, 114, // 144-151
-112,  95, 121, 106, 131, 122, 128, 131, // 152-159
-126, 137, 124, 123, 131, 134, 147, 140, // 160-167
-138, 129, 131, 128, 117, 119, 116, 128, // 168-175
-135, 122, 145, 138, 141, 162, 135, 158, // 176-183
-140, 146, 139, 124, 146, 114, 134, 135, // 184-191
-131, 141, 123, 134, 134, 133, 146, 122, // 192-199
-136, 118, 122, 120, 117, 123, 119, 112, // 200-207
-114, 119, 136, 137, 135, 125, 131, 132, // 208-215
-124, 129, 134, 124, 128, 105, 113, 116, // 216-223
-123, 127, 127, 124, 114, 124, 124, 124, // 224-231
-125, 118, 126, 117, 128, 128, 136, 127, // 232-239
-135, 115, 122, 120, 115, 134, 119, 129, // 240-247
-134, 129, 140, 127, 125, 132, 118, 136, // 248-255
-126, 148, 129, 152, 142, 141, 130, 125, // 256-263
-123, 132, 123, 130, 123, 123, 122, 119, // 264-271
-124, 111, 113, 116, 114, 128, 117, 130, // 272-279
-121, 127, 123, 133, 132, 125, 131, 127, // 280-287
-135, 134, 133, 129, 128, 133, 128, 134, // 288-295
-128, 141, 131, 137, 125, 130, 120, 125, // 296-303
-129, 127, 132, 127, 123, 125, 123, 122, // 304-311
-120, 122, 117, 126, 120, 127, 116, 129, // 312-319
-115, 125, 119, 120, 126, 118, 129, 122, // 320-327
-129, 130, 124, 132, 135, 127, 137, 130, // 328-335
-140, 140, 135, 146, 138, 141, 142, 137, // 336-343
-141, 132, 126, 129, 119, 137, 128, 134, // 344-351
-143, 117, 145, 112, 119, 103, 109,  77, // 352-359
-110,  63, 103,  84,  90, 112,  92, 134, // 360-367
-114, 149, 127, 162, 142, 155, 151, 140, // 368-375
-156, 130, 147, 131, 132, 135, 124, 133, // 376-383
-129, 128, 140, 129, 153, 141, 160, 148, // 384-391
-163, 141, 159, 136, 163, 157, 178,  91, // 392-399
-180,  39, 152,  50,  84,  86,  46,  92, // 400-407
- 65,  81,  97, 103, 107, 152, 108, 189, // 408-415
-129, 192, 157, 178, 163, 170, 145, 165, // 416-423
-118, 158,  82, 141,  83, 116,  99, 101, // 424-431
-117, 107, 123, 127, 126, 145, 131, 150, // 432-439
-142, 146, 153, 139, 155, 139, 143, 139, // 440-447
-130, 133, 133, 128, 161, 107, 148, 109, // 448-455
- 99, 132,  67, 122,  82,  86, 106,  80, // 456-463
-105, 112,  97, 137, 118, 141, 152, 136, // 464-471
-173, 142, 167, 152, 158, 141, 160, 113, // 472-479
-138, 113,  99, 132,  77, 135,  92, 123, // 480-487
-124, 113, 143, 122, 144, 141, 137, 155, // 488-495
-137, 151, 146, 135, 147, 125, 141, 127, // 496-503
-134, 144, 131, 128, 137,  91, 137,  79, // 504-511
-110,  94,  83, 104,  86,  97, 111,  98, // 512-519
-128, 122, 131, 149, 137, 160, 153, 154, // 520-527
-165, 147, 158, 138, 134, 135, 102, 135, // 528-535
- 91, 122, 106, 105, 126, 104, 135, 120, // 536-543
-134, 138, 134, 146, 141, 143, 149, 137, // 544-551
-152, 131, 145, 129, 140, 133, 156, 129, // 552-559
-135, 131,  88, 144,  58, 127,  69,  95, // 560-567
- 94,  90,  93, 117,  89, 141, 108, 145, // 568-575
-143, 141, 165, 148, 160, 162, 145, 164, // 576-583
-130, 143, 113, 125, 108, 109, 114, 101, // 584-591
-122, 107, 126, 120, 129, 134, 135, 142, // 592-599
-142, 143, 146, 143, 145, 142, 134, 145, // 600-607
-126, 150, 125, 168, 107, 160,  94, 116, // 608-615
-118,  67, 130,  55, 113,  74, 101,  90, // 616-623
-120,  89, 154,  96, 170, 123, 165, 152, // 624-631
-156, 158, 159, 146, 162, 121, 145, 107, // 632-639
-125, 109, 104, 118,  99, 126, 108, 126, // 640-647
-125, 128, 139, 135, 143, 145, 139, 153, // 648-655
-137, 148, 139, 136, 143, 131, 146, 137, // 656-663
-159, 107, 164,  70, 145,  75,  96, 106, // 664-671
- 61, 115,  69, 102,  97, 107, 110, 140, // 672-679
-110, 174, 118, 180, 145, 165, 163, 151, // 680-687
-159, 148, 143, 124, 120, 112, 103, 109, // 688-695
-100, 108, 110, 115, 121, 124, 130, 137, // 696-703
-136, 148, 140, 154, 143, 151, 144, 146, // 704-711
-137, 144, 130, 146, 131, 166, 104, 167, // 712-719
- 75, 135,  91,  75, 125,  39, 129,  53, // 720-727
-110,  86, 114,  98, 149, 100, 181, 114, // 728-735
-184, 144, 168, 161, 160, 148, 168, 113, // 736-743
-172,  78, 136, 106,  75, 151,  48, 157, // 744-751
- 81, 132, 126, 116, 148, 132, 139, 161, // 752-759
-123, 178, 123, 166, 137, 139, 148, 127, // 760-767
-145, 135, 149, 147, 112, 161,  48, 175, // 768-775
- 17, 154,  42, 103,  84,  81,  98, 103, // 776-783
- 98, 136, 117, 140, 160, 129, 191, 132, // 784-791
-186, 149, 161, 159, 144, 132, 136,  96, // 792-799
-125,  86, 112,  96, 108, 108, 118, 117, // 800-807
-134, 124, 150, 132, 157, 140, 157, 146, // 808-815
-153, 141, 149, 131, 148, 125, 149, 133, // 816-823
-167,  93, 179,  44, 163,  57,  96, 108, // 824-831
- 40, 129,  50, 110,  94, 104, 118, 139, // 832-839
-115, 180, 120, 187, 151, 160, 180, 137, // 840-847
-176, 135, 141, 123, 119,  96, 118,  84, // 848-855
-112, 100, 103, 128, 101, 146, 116, 151, // 856-863
-136, 150, 146, 153, 142, 162, 130, 160, // 864-871
-121, 154, 123, 147, 128, 169, 108, 158, // 872-879
- 91, 112, 113,  57, 129,  44, 110,  73, // 880-887
- 88, 100, 102, 108, 139, 115, 161, 142, // 888-895
-156, 175, 145, 184, 146, 166, 149, 146, // 896-903
-129, 114, 123,  77, 135,  62, 131,  85, // 904-911
-119, 120, 118, 134, 138, 135, 159, 135, // 912-919
-163, 144, 151, 153, 137, 145, 137, 131, // 920-927
-143, 126, 155, 149, 105, 177,  32, 183, // 928-935
- 31, 123,  90,  51, 134,  44, 122,  89, // 936-943
-107, 123, 133, 120, 178, 117, 193, 141, // 944-951
-168, 170, 143, 167, 142, 135, 150,  81, // 952-959
-146,  72, 104, 117,  61, 150,  74, 142, // 960-967
-121, 125, 154, 132, 150, 159, 133, 174, // 968-975
-127, 164, 139, 133, 148, 123, 139, 136, // 976-983
-133, 165, 100, 166,  70, 135,  90,  71, // 984-991
-129,  31, 135,  51, 109,  98, 101, 125, // 992-999
-128, 128, 161, 140, 165, 167, 150, 178, // 1000-1007
-143, 162, 147, 135, 142, 115,  94, 135, // 1008-1015
- 52, 138,  67, 115, 109, 109, 131, 132, // 1016-1023
-128, 162, 126, 170, 140, 155, 156, 139, // 1024-1031
-158, 132, 136, 138, 121, 143, 120, 160, // 1032-1039
-133, 121, 154,  54, 172,  31, 134,  75, // 1040-1047
- 67, 122,  52, 121,  90, 107, 129, 124, // 1048-1055
-137, 162, 135, 180, 151, 163, 172, 142, // 1056-1063
-167, 137, 137, 140, 108, 100, 125,  54, // 1064-1071
-137,  60, 123, 104, 115, 133, 134, 135, // 1072-1079
-161, 133, 168, 143, 153, 158, 136, 159, // 1080-1087
-127, 142, 129, 126, 135, 127, 154, 143, // 1088-1095
-108, 168,  45, 170,  46, 106, 104,  41, // 1096-1103
-137,  43, 119,  94, 103, 130, 127, 133, // 1104-1111
-162, 143, 167, 170, 149, 183, 142, 161, // 1112-1119
-149, 128, 141, 115, 102, 106,  97,  72, // 1120-1127
-130,  59, 142,  98, 130, 148, 125, 162, // 1128-1135
-143, 151, 158, 146, 153, 151, 137, 149, // 1136-1143
-123, 137, 127, 121, 144, 123, 178,  97, // 1144-1151
-167,  96,  95, 152,  17, 176,  17, 123, // 1152-1159
- 89,  62, 137,  73, 132, 122, 131, 145, // 1160-1167
-159, 144, 176, 155, 157, 175, 134, 167, // 1168-1175
-129, 134, 131, 109, 109, 100,  89, 107, // 1176-1183
- 77, 125,  89, 135, 123, 138, 149, 141, // 1184-1191
-155, 147, 153, 145, 153, 134, 155, 121, // 1192-1199
-145, 117, 136, 121, 139, 130, 170, 111, // 1200-1207
-149, 128,  71, 165,  29, 134,  72,  63, // 1208-1215
-125,  45, 125,  92, 112, 130, 132, 141, // 1216-1223
-160, 156, 160, 179, 147, 179, 148, 148, // 1224-1231
-150, 123, 130, 118, 100, 112,  76, 107, // 1232-1239
- 85,  98, 119, 105, 142, 129, 149, 145, // 1240-1247
-155, 142, 165, 133, 160, 134, 148, 136, // 1248-1255
-129, 129, 126, 126, 132, 135, 156, 145, // 1256-1263
-118, 171,  50, 172,  51,  97, 115,  27, // 1264-1271
-138,  45, 108,  98, 103, 123, 131, 144, // 1272-1279
-144, 179, 141, 189, 157, 162, 174, 133, // 1280-1287
-160, 127, 126, 122, 107, 107,  84, 103, // 1288-1295
- 79, 107,  91, 125, 113, 146, 134, 152, // 1296-1303
-150, 147, 157, 142, 154, 139, 149, 133, // 1304-1311
-142, 123, 132, 126, 127, 135, 139, 159, // 1312-1319
-138, 127, 159,  53, 168,  46,  97, 109, // 1320-1327
- 28, 131,  50, 103, 102, 107, 126, 135, // 1328-1335
-154, 139, 190, 143, 186, 168, 152, 178, // 1336-1343
-132, 155, 124, 127, 109, 116,  93, 102, // 1344-1351
- 83,  86, 112,  75, 146,  99, 155, 135, // 1352-1359
-159, 140, 167, 139, 153, 153, 131, 156, // 1360-1367
-129, 140, 125, 132, 119, 136, 122, 147, // 1368-1375
-144, 164, 105, 177,  72, 117, 127,  20, // 1376-1383
-151,  28,  93,  91,  66, 114,  97, 134, // 1384-1391
-113, 174, 133, 173, 183, 143, 202, 144, // 1392-1399
-172, 149, 142, 132, 121, 121,  96, 116, // 1400-1407
- 94,  87, 116,  68, 109, 121,  90, 162, // 1408-1415
-123, 156, 151, 162, 136, 169, 134, 146, // 1416-1423
-146, 131, 138, 136, 124, 126, 133, 123, // 1424-1431
-132, 146, 137, 171, 123, 143, 130,  71, // 1432-1439
-144,  44, 100,  78,  59,  96,  69, 109, // 1440-1447
- 88, 139, 118, 149, 167, 143, 191, 159, // 1448-1455
-176, 167, 160, 155, 137, 144, 106, 130, // 1456-1463
- 95, 107,  98,  99,  93, 101,  92, 108, // 1464-1471
-124, 109, 161, 123, 169, 140, 165, 135, // 1472-1479
-161, 133, 143, 141, 129, 138, 128, 132, // 1480-1487
-119, 136, 120, 139, 138, 147, 154, 158, // 1488-1495
-116, 154,  85, 111,  96,  59, 102,  52, // 1496-1503
- 93,  70,  98,  99, 110, 144, 122, 173, // 1504-1511
-152, 172, 177, 165, 180, 153, 168, 135, // 1512-1519
-142, 125, 110, 117,  92, 108,  90, 103, // 1520-1527
- 99,  95, 111, 107, 124, 128, 143, 142, // 1528-1535
-156, 149, 152, 146, 146, 139, 136, 137, // 1536-1543
-126, 136, 125, 132, 125, 130, 131, 135, // 1544-1551
-136, 146, 144, 167, 126, 144, 122,  81, // 1552-1559
-124,  59,  88,  74,  71,  85,  76, 114, // 1560-1567
- 88, 141, 128, 145, 169, 155, 183, 162, // 1568-1575
-183, 159, 161, 156, 129, 140, 111, 118, // 1576-1583
-100, 101,  99,  92, 109, 100, 115, 111, // 1584-1591
-124, 118, 133, 138, 138, 147, 148, 147, // 1592-1599
-145, 146, 132, 139, 129, 131, 126, 131, // 1600-1607
-128, 129, 134, 129, 137, 134, 140, 139, // 1608-1615
-147, 154, 146, 123, 134,  94,  93,  99, // 1616-1623
- 67,  84,  76,  87,  79, 103, 112, 113, // 1624-1631
-142, 142, 156, 161, 170, 171, 163, 173, // 1632-1639
-152, 152, 140, 134, 120, 114, 112,  97, // 1640-1647
-106, 100, 102, 109, 111, 122, 119, 133, // 1648-1655
-121, 134, 137, 134, 142, 139, 146, 134, // 1656-1663
-146, 130, 133, 130, 130, 127, 127, 135, // 1664-1671
-125, 135, 131, 140, 130, 140, 135, 138, // 1672-1679
-140, 145, 149, 113, 138,  96, 100,  93, // 1680-1687
- 84,  85,  76,  97,  82, 101, 111, 116, // 1688-1695
-134, 135, 158, 150, 166, 168, 162, 167, // 1696-1703
-153, 159, 136, 140, 127, 117, 115, 105, // 1704-1711
-107,  98, 108, 106, 110, 118, 120, 132, // 1712-1719
-124, 142, 125, 139, 136, 139, 137, 138, // 1720-1727
-142, 129, 142, 125, 132, 122, 132, 123, // 1728-1735
-128, 132, 130, 133, 134, 139, 131, 136, // 1736-1743
-134, 138, 132, 144, 142, 124, 124, 112, // 1744-1751
-101,  92,  93,  88,  84,  92,  97, 100, // 1752-1759
-110, 122, 131, 134, 151, 154, 157, 162, // 1760-1767
-163, 160, 152, 151, 143, 134, 127, 122, // 1768-1775
-114, 108, 109, 107, 107, 110, 113, 118, // 1776-1783
-121, 129, 132, 137, 133, 142, 123, 139, // 1784-1791
-128, 134, 128, 132, 134, 125, 134, 124, // 1792-1799
-132, 118, 136, 124, 133, 130, 138, 133, // 1800-1807
-136, 136, 135, 134, 129, 135, 129, 133, // 1808-1815
-138, 132, 121, 121, 106, 107,  94,  99, // 1816-1823
- 92,  93,  97,  99, 109, 111, 125, 130, // 1824-1831
-138, 147, 150, 158, 157, 159, 156, 153, // 1832-1839
-149, 141, 136, 127, 122, 117, 112, 112, // 1840-1847
-108, 111, 110, 115, 117, 122, 126, 131, // 1848-1855
-134, 138, 135, 133, 123, 133, 129, 125, // 1856-1863
-126, 129, 133, 124, 133, 127, 133, 125, // 1864-1871
-135, 131, 133, 135, 138, 136, 132, 135, // 1872-1879
-129, 132, 122, 129, 123, 131, 126, 130, // 1880-1887
-131, 123, 123, 110, 111, 102, 104,  99, // 1888-1895
- 99, 103, 104, 110, 116, 121, 132, 133, // 1896-1903
-145, 146, 153, 152, 154, 154, 150, 149, // 1904-1911
-139, 138, 129, 124, 119, 115, 114, 111, // 1912-1919
-113, 113, 116, 118, 121, 125, 128, 132, // 1920-1927
-134, 137, 139, 134, 129, 126, 128, 126, // 1928-1935
-122, 126, 126, 129, 125, 130, 128, 132, // 1936-1943
-128, 134, 133, 134, 136, 134, 137, 131, // 1944-1951
-130, 129, 127, 126, 123, 124, 126, 124, // 1952-1959
-125, 130, 127, 126, 120, 118, 110, 110, // 1960-1967
-108, 105, 107, 106, 111, 112, 118, 125, // 1968-1975
-129, 136, 139, 146, 147, 151, 151, 151, // 1976-1983
-149, 144, 142, 134, 131, 125, 121, 118, // 1984-1991
-115, 114, 114, 115, 117, 118, 123, 125, // 1992-1999
-129, 130, 133, 135, 136, 137, 138, 130, // 2000-2007
-125, 119, 122, 121, 119, 119, 123, 129, // 2008-2015
-126, 131, 130, 138, 133, 137, 135, 136, // 2016-2023
-134, 132, 134, 130, 128, 121, 122, 120, // 2024-2031
-124, 121, 125, 125, 130, 132, 131, 130, // 2032-2039
-126, 124, 120, 113, 113, 110, 108, 106, // 2040-2047
-109, 111, 115, 117, 124, 129, 134, 138, // 2048-2055
-144, 148, 148, 150, 149, 146, 144, 137, // 2056-2063
-134, 129, 124, 120, 117, 117, 116, 115, // 2064-2071
-117, 118, 121, 122, 126, 128, 132, 132, // 2072-2079
-135, 135, 137, 135, 136, 132, 122, 117, // 2080-2087
-116, 119, 117, 115, 120, 128, 132, 129, // 2088-2095
-133, 138, 139, 137, 133, 135, 133, 133, // 2096-2103
-127, 130, 125, 125, 119, 121, 123, 127, // 2104-2111
-124, 125, 131, 132, 133, 128, 130, 128, // 2112-2119
-124, 115, 113, 113, 110, 107, 105, 111, // 2120-2127
-115, 114, 119, 124, 133, 135, 139, 144, // 2128-2135
-147, 149, 147, 147, 145, 142, 135, 132, // 2136-2143
-129, 123, 120, 117, 117, 118, 117, 117, // 2144-2151
-119, 123, 125, 125, 129, 130, 133, 132, // 2152-2159
-134, 133, 135, 132, 132, 130, 127, 114, // 2160-2167
-109, 116, 118, 120, 115, 127, 131, 139, // 2168-2175
-132, 138, 140, 143, 137, 131, 134, 132, // 2176-2183
-130, 123, 124, 125, 124, 118, 123, 125, // 2184-2191
-129, 126, 128, 132, 133, 132, 127, 129, // 2192-2199
-126, 121, 113, 112, 110, 111, 105, 106, // 2200-2207
-111, 115, 117, 121, 127, 133, 139, 141, // 2208-2215
-144, 149, 150, 149, 146, 145, 141, 136, // 2216-2223
-128, 126, 122, 120, 116, 115, 115, 117, // 2224-2231
-119, 119, 123, 125, 129, 130, 132, 134, // 2232-2239
-135, 135, 134, 134, 133, 132, 129, 128, // 2240-2247
-125, 113, 106, 110, 117, 119, 115, 123, // 2248-2255
-130, 140, 137, 136, 141, 144, 142, 131, // 2256-2263
-131, 132, 132, 125, 122, 122, 125, 121, // 2264-2271
-121, 123, 130, 132, 131, 131, 131, 135, // 2272-2279
-130, 128, 122, 123, 115, 111, 107, 108, // 2280-2287
-109, 107, 109, 111, 119, 124, 127, 131, // 2288-2295
-138, 143, 146, 147, 147, 148, 147, 143, // 2296-2303
-139, 136, 131, 127, 121, 120, 117, 118, // 2304-2311
-115, 117, 119, 120, 122, 125, 127, 130, // 2312-2319
-131, 134, 133, 136, 134, 135, 132, 131, // 2320-2327
-129, 128, 125, 126, 120, 110, 106, 109, // 2328-2335
-117, 120, 120, 124, 133, 140, 141, 137, // 2336-2343
-141, 143, 142, 136, 129, 129, 131, 128, // 2344-2351
-122, 120, 122, 125, 125, 125, 127, 131, // 2352-2359
-133, 131, 130, 129, 130, 128, 123, 119, // 2360-2367
-113, 112, 108, 109, 106, 108, 110, 115, // 2368-2375
-120, 124, 128, 134, 140, 143, 145, 147, // 2376-2383
-148, 148, 146, 141, 138, 133, 131, 125, // 2384-2391
-122, 119, 118, 116, 116, 117, 119, 121, // 2392-2399
-124, 124, 129, 129, 132, 134, 134, 135, // 2400-2407
-134, 135, 132, 131, 129, 127, 125, 125, // 2408-2415
-123, 119, 106, 108, 109, 121, 120, 122, // 2416-2423
-125, 134, 143, 141, 141, 137, 143, 141, // 2424-2431
-138, 128, 124, 127, 126, 125, 117, 119, // 2432-2439
-121, 128, 127, 128, 129, 133, 135, 134, // 2440-2447
-131, 129, 129, 128, 122, 113, 110, 108, // 2448-2455
-110, 108, 107, 107, 113, 119, 125, 126, // 2456-2463
-131, 138, 143, 147, 146, 147, 146, 147, // 2464-2471
-144, 139, 134, 131, 129, 125, 122, 117, // 2472-2479
-118, 118, 119, 118, 119, 122, 124, 128, // 2480-2487
-129, 130, 131, 133, 135, 133, 134, 131, // 2488-2495
-132, 129, 129, 127, 124, 126, 123, 113, // 2496-2503
-106, 109, 117, 122, 123, 123, 127, 138, // 2504-2511
-141, 141, 137, 138, 141, 141, 137, 128, // 2512-2519
-126, 124, 127, 122, 120, 117, 122, 127, // 2520-2527
-129, 129, 129, 132, 135, 135, 131, 129, // 2528-2535
-127, 125, 119, 113, 108, 107, 110, 109, // 2536-2543
-110, 109, 115, 121, 127, 131, 134, 139, // 2544-2551
-144, 146, 148, 146, 146, 144, 142, 137, // 2552-2559
-133, 128, 125, 123, 119, 118, 116, 116, // 2560-2567
-117, 119, 121, 123, 124, 129, 130, 131, // 2568-2575
-133, 135, 134, 135, 133, 133, 131, 130, // 2576-2583
-128, 127, 124, 124, 123, 116, 111, 108, // 2584-2591
-112, 120, 123, 126, 125, 132, 138, 141, // 2592-2599
-139, 136, 137, 138, 140, 134, 130, 124, // 2600-2607
-126, 125, 124, 120, 121, 122, 127, 130, // 2608-2615
-130, 131, 130, 132, 133, 131, 129, 125, // 2616-2623
-122, 117, 113, 111, 109, 110, 110, 111, // 2624-2631
-113, 117, 123, 127, 132, 136, 138, 143, // 2632-2639
-144, 147, 145, 144, 140, 140, 137, 132, // 2640-2647
-129, 124, 123, 119, 119, 117, 117, 117, // 2648-2655
-120, 121, 124, 125, 128, 129, 132, 132, // 2656-2663
-135, 133, 134, 134, 132, 132, 129, 127, // 2664-2671
-126, 124, 124, 123, 121, 114, 111, 111, // 2672-2679
-118, 122, 124, 126, 127, 134, 137, 141, // 2680-2687
-136, 137, 137, 138, 137, 133, 129, 125, // 2688-2695
-125, 125, 124, 122, 120, 122, 124, 128, // 2696-2703
-128, 129, 129, 129, 132, 131, 131, 128, // 2704-2711
-127, 123, 118, 114, 111, 113, 114, 114, // 2712-2719
-114, 115, 118, 124, 128, 131, 134, 136, // 2720-2727
-140, 142, 144, 142, 142, 139, 138, 136, // 2728-2735
-132, 130, 125, 124, 121, 122, 119, 119, // 2736-2743
-119, 121, 123, 123, 126, 127, 128, 130, // 2744-2751
-131, 133, 132, 133, 131, 131, 131, 128, // 2752-2759
-129, 125, 126, 124, 126, 120, 115, 113, // 2760-2767
-113, 121, 122, 127, 123, 128, 132, 135, // 2768-2775
-140, 136, 138, 135, 138, 135, 134, 129, // 2776-2783
-126, 125, 124, 125, 122, 123, 122, 124, // 2784-2791
-125, 128, 129, 127, 128, 127, 129, 130, // 2792-2799
-129, 130, 129, 126, 122, 117, 115, 117, // 2800-2807
-118, 118, 116, 116, 117, 122, 125, 130, // 2808-2815
-130, 132, 136, 138, 140, 142, 140, 139, // 2816-2823
-138, 136, 134, 133, 128, 126, 123, 123, // 2824-2831
-122, 122, 120, 121, 120, 123, 123, 126, // 2832-2839
-126, 127, 128, 130, 130, 131, 131, 131, // 2840-2847
-131, 130, 129, 128, 127, 127, 124, 126, // 2848-2855
-122, 118, 115, 116, 120, 124, 126, 126, // 2856-2863
-127, 131, 133, 138, 137, 138, 135, 134, // 2864-2871
-133, 131, 131, 126, 126, 122, 124, 123, // 2872-2879
-124, 123, 124, 124, 126, 128, 127, 128, // 2880-2887
-127, 126, 127, 127, 127, 129, 129, 131, // 2888-2895
-125, 124, 117, 119, 119, 121, 121, 118, // 2896-2903
-120, 121, 124, 128, 129, 133, 132, 134, // 2904-2911
-137, 138, 140, 137, 137, 132, 133, 133, // 2912-2919
-129, 129, 124, 125, 122, 122, 123, 121, // 2920-2927
-123, 122, 124, 125, 125, 127, 126, 129, // 2928-2935
-128, 128, 130, 128, 129, 129, 128, 128, // 2936-2943
-128, 127, 127, 127, 125, 125, 121, 120, // 2944-2951
-119, 121, 124, 125, 128, 128, 129, 131, // 2952-2959
-133, 136, 136, 136, 133, 132, 131, 130, // 2960-2967
-129, 125, 124, 124, 123, 123, 124, 124, // 2968-2975
-123, 125, 124, 126, 125, 127, 125, 127, // 2976-2983
-127, 127, 126, 127, 126, 128, 128, 128, // 2984-2991
-126, 125, 123, 122, 124, 124, 124, 125, // 2992-2999
-124, 126, 126, 129, 130, 132, 132, 131, // 3000-3007
-133, 133, 134, 133, 132, 131, 129, 129, // 3008-3015
-127, 127, 126, 123, 125, 124, 123, 125, // 3016-3023
-124, 126, 124, 125, 126, 126, 127, 127, // 3024-3031
-128, 129, 128, 129, 126, 124, 122, 121, // 3032-3039
-124, 126, 129, 128, 127, 128, 129, 132, // 3040-3047
-132, 135, 132, 132, 130, 131, 130, 129, // 3048-3055
-127, 126, 125, 124, 124, 125, 125, 125, // 3056-3063
-124, 125, 127, 128, 131, 130, 128, 125, // 3064-3071
-121, 122, 122, 122, 122, 120, 121, 121, // 3072-3079
-123, 124, 128, 130, 130, 132, 132, 135, // 3080-3087
-136, 137, 137, 134, 134, 131, 132, 131, // 3088-3095
-129, 126, 124, 123, 124, 123, 124, 122, // 3096-3103
-123, 122, 124, 125, 126, 128, 128, 128, // 3104-3111
-129, 128, 130, 129, 130, 128, 128, 127, // 3112-3119
-127, 127, 127, 127, 125, 126, 125, 126, // 3120-3127
-126, 125, 126, 127, 127, 127, 127, 128, // 3128-3135
-128, 128, 128, 129, 129, 129, 129, 128, // 3136-3143
-129, 128, 128, 128, 125, 122, 122, 122, // 3144-3151
-125, 127, 127, 128, 126, 128, 130, 131, // 3152-3159
-133, 132, 132, 130, 130, 130, 128, 128, // 3160-3167
-125, 125, 123, 124, 123, 125, 125, 124, // 3168-3175
-125, 125, 127, 127, 128, 127, 128, 127, // 3176-3183
-128, 127, 128, 127, 126, 126, 125, 126, // 3184-3191
-125, 125, 125, 124, 124, 125, 126, 128, // 3192-3199
-128, 128, 130, 130, 131, 130, 132, 131, // 3200-3207
-132, 130, 131, 129, 129, 127, 128, 126, // 3208-3215
-126, 125, 126, 125, 126, 126, 127, 126, // 3216-3223
-127, 126, 127, 126, 127, 126, 127, 127, // 3224-3231
-125, 127, 125, 126, 126, 127, 127, 125, // 3232-3239
-127, 126, 128, 127, 127, 127, 126, 127, // 3240-3247
-126, 127, 126, 127, 126, 127, 126, 127, // 3248-3255
-126, 128, 127, 128, 128, 127, 129, 128, // 3256-3263
-129, 129, 128, 129, 129, 129, 129, 128, // 3264-3271
-129, 129, 129, 129, 128, 127, 127, 126, // 3272-3279
-127, 126, 126, 125, 126, 125, 126, 125, // 3280-3287
-126, 127, 126, 127, 126, 127, 126, 127, // 3288-3295
-128, 127, 128, 126, 127, 126, 128, 127, // 3296-3303
-128, 127, 126, 127, 126, 127, 126, 127, // 3304-3311
-126, 127, 126, 127, 126, 127, 127, 128};// 3312-3319
-
-#define PEW_NO_AMMO_N 2681
-
-const uint8_t pewNoAmmo[PEW_NO_AMMO_N] = {
-127, 128, 128, 127, 127, 127, 127, 127, // 0-7
-128, 127, 128, 128, 128, 127, 127, 127, // 8-15
-127, 128, 128, 129, 127, 129, 126, 132, // 16-23
-107, 104, 150, 150, 123, 115, 133, 136, // 24-31
-124, 124, 131, 131, 126, 124, 130, 129, // 32-39
-129, 127, 127, 126, 129, 128, 129, 127, // 40-47
-132, 131, 138, 133, 137, 126, 136,  73, // 48-55
-131, 186, 137, 108, 106, 148, 127, 125, // 56-63
-119, 136, 119, 121, 117, 127, 119, 127, // 64-71
-125, 130, 100,  28, 113, 216, 187,  97, // 72-79
- 89, 133, 161, 142, 134, 120, 113, 122, // 80-87
-136, 150, 140, 131, 107, 112, 124, 156, // 88-95
-160, 162, 151, 155, 152, 155, 130, 102, // 96-103
-101,  91, 101, 114, 140, 162, 152, 125, // 104-111
-112,  99,  96, 114, 122, 137, 120, 104, // 112-119
- 96, 118, 139, 136, 122, 124, 140, 133, // 120-127
-108,  73,  95, 128, 168, 171, 146, 129, // 128-135
-141, 166, 157, 125,  90,  91,  95,  94, // 136-143
- 97, 120, 153, 179, 158, 142, 140, 130, // 144-151
-125, 120, 117, 122, 133, 110, 103, 113, // 152-159
-124, 130, 144, 148, 137, 123, 114, 109, // 160-167
-112, 124, 153, 177, 191, 197, 195, 162, // 168-175
-115,  75,  68,  72,  94, 118, 143, 162, // 176-183
-168, 176, 172, 164, 150, 132, 108,  81, // 184-191
- 66,  66,  79,  91, 101, 114, 130, 133, // 192-199
-124, 113, 123, 125, 126, 127, 119, 106, // 200-207
- 95, 102, 125, 145, 160, 169, 172, 167, // 208-215
-157, 142, 132, 127, 126, 136, 135, 115, // 216-223
- 88,  64,  62,  62,  76, 101, 111, 129, // 224-231
-133, 137, 153, 180, 194, 191, 176, 159, // 232-239
-151, 154, 156, 149, 146, 145, 130, 126, // 240-247
-133, 140, 130, 120, 115, 117, 115, 104, // 248-255
- 99, 102,  99,  98,  97,  96, 117, 131, // 256-263
-139, 131, 123, 115, 120, 137, 153, 156, // 264-271
-150, 150, 139, 134, 128, 130, 125, 126, // 272-279
-118, 113, 116, 118, 108,  98,  96,  98, // 280-287
-101, 111, 123, 120, 120, 115, 116, 121, // 288-295
-128, 143, 163, 165, 162, 158, 143, 130, // 296-303
-131, 139, 140, 145, 144, 143, 135, 118, // 304-311
-111, 120, 133, 139, 143, 146, 144, 132, // 312-319
-125, 125, 126, 124, 121, 109,  97, 101, // 320-327
-109, 114, 117, 110, 110, 119, 127, 132, // 328-335
-130, 133, 142, 143, 131, 126, 131, 133, // 336-343
-132, 124, 117, 113, 116, 121, 133, 138, // 344-351
-139, 136, 139, 140, 136, 136, 135, 139, // 352-359
-131, 118, 111, 110, 112, 118, 121, 125, // 360-367
-125, 120, 121, 127, 138, 143, 148, 149, // 368-375
-146, 144, 137, 122, 113, 114, 116, 116, // 376-383
-113, 111, 117, 120, 126, 133, 141, 139, // 384-391
-136, 128, 123, 126, 128, 128, 124, 123, // 392-399
-121, 122, 124, 126, 120, 121, 120, 119, // 400-407
-122, 132, 140, 138, 132, 136, 140, 142, // 408-415
-145, 137, 130, 124, 131, 134, 137, 132, // 416-423
-131, 125, 119, 118, 125, 131, 131, 128, // 424-431
-124, 125, 124, 127, 129, 136, 124, 120, // 432-439
-122, 128, 127, 131, 131, 135, 129, 122, // 440-447
-121, 120, 122, 122, 123, 117, 118, 117, // 448-455
-123, 124, 126, 120, 121, 118, 120, 117, // 456-463
-126, 133, 134, 134, 131, 131, 133, 135, // 464-471
-131, 135, 137, 143, 141, 137, 132, 121, // 472-479
-115, 123, 122, 123, 132, 132, 132, 133, // 480-487
-132, 132, 133, 133, 136, 138, 135, 131, // 488-495
-127, 124, 127, 122, 122, 120, 119, 117, // 496-503
-122, 125, 126, 130, 132, 134, 135, 134, // 504-511
-127, 122, 118, 122, 125, 128, 123, 121, // 512-519
-118, 122, 123, 124, 126, 127, 127, 135, // 520-527
-138, 136, 129, 127, 127, 122, 125, 126, // 528-535
-131, 126, 123, 124, 127, 123, 126, 134, // 536-543
-138, 138, 129, 123, 122, 126, 124, 128, // 544-551
-131, 131, 125, 123, 120, 120, 122, 126, // 552-559
-130, 131, 135, 139, 141, 138, 135, 130, // 560-567
-130, 130, 130, 130, 125, 121, 122, 123, // 568-575
-127, 134, 132, 129, 127, 125, 126, 124, // 576-583
-121, 123, 123, 120, 120, 118, 122, 125, // 584-591
-125, 122, 125, 128, 133, 133, 129, 128, // 592-599
-128, 130, 130, 128, 127, 127, 125, 126, // 600-607
-126, 127, 126, 128, 129, 131, 128, 132, // 608-615
-135, 136, 134, 135, 135, 134, 129, 121, // 616-623
-122, 126, 132, 134, 131, 126, 124, 121, // 624-631
-122, 124, 126, 129, 128, 123, 124, 125, // 632-639
-127, 130, 131, 128, 123, 123, 124, 125, // 640-647
-125, 127, 126, 126, 127, 129, 129, 128, // 648-655
-127, 124, 123, 127, 127, 123, 123, 125, // 656-663
-125, 124, 126, 125, 125, 122, 124, 133, // 664-671
-135, 131, 132, 132, 132, 131, 129, 131, // 672-679
-133, 131, 129, 131, 129, 129, 131, 132, // 680-687
-130, 130, 131, 133, 130, 130, 133, 130, // 688-695
-127, 127, 127, 127, 129, 128, 128, 128, // 696-703
-126, 126, 131, 131, 133, 131, 131, 130, // 704-711
-130, 130, 131, 126, 123, 120, 115, 116, // 712-719
-115, 115, 114, 117, 115, 115, 116, 122, // 720-727
-125, 130, 131, 129, 126, 118, 117, 112, // 728-735
-111, 104, 101,  97, 102, 107, 115, 121, // 736-743
-125, 131, 136, 149, 157, 167, 168, 168, // 744-751
-161, 157, 154, 150, 147, 144, 139, 135, // 752-759
-134, 135, 139, 142, 143, 140, 138, 136, // 760-767
-138, 139, 143, 140, 141, 141, 139, 141, // 768-775
-143, 143, 135, 134, 120, 125, 121, 117, // 776-783
-102,  87,  66,  53,  50,  45,  54,  54, // 784-791
- 48,  45,  47,  40,  50,  75,  96, 128, // 792-799
-159, 179, 201, 220, 229, 237, 240, 225, // 800-807
-208, 187, 163, 141, 123,  96,  62,  38, // 808-815
- 25,  30,  68,  97, 138, 162, 182, 192, // 816-823
-214, 215, 219, 207, 187, 167, 148, 131, // 824-831
-113, 103,  85,  83,  83,  99, 113, 132, // 832-839
-144, 160, 172, 185, 193, 184, 173, 156, // 840-847
-141, 133, 127, 113, 108,  91,  81,  63, // 848-855
- 48,  29,  14,   5,   8,  25,  38,  53, // 856-863
- 49,  71,  89, 136, 174, 214, 227, 236, // 864-871
-234, 235, 237, 226, 208, 173, 140, 102, // 872-879
- 89,  76,  81,  80,  79,  73,  73,  62, // 880-887
- 86, 127, 162, 197, 209, 200, 188, 183, // 888-895
-173, 176, 159, 133, 105,  85,  84, 105, // 896-903
-121, 122, 119, 108, 114, 137, 164, 179, // 904-911
-183, 165, 154, 152, 155, 161, 152, 128, // 912-919
-103,  93, 100, 117, 133, 137, 120,  94, // 920-927
- 69,  34,  24,  15,  14,  18,  24,  25, // 928-935
- 38,  63,  93, 136, 173, 203, 221, 235, // 936-943
-242, 251, 248, 232, 207, 176, 141, 118, // 944-951
-100,  81,  73,  64,  67,  76,  89,  93, // 952-959
-105, 101, 121, 161, 187, 213, 212, 197, // 960-967
-166, 163, 146, 154, 136, 118,  89,  77, // 968-975
- 79, 104, 129, 135, 137, 124, 131, 140, // 976-983
-169, 180, 185, 163, 151, 137, 140, 143, // 984-991
-145, 127, 113, 103, 107, 124, 137, 140, // 992-999
-117,  83,  34,  17,   2,  12,  22,  27, // 1000-1007
- 27,  28,  51,  80, 136, 173, 210, 220, // 1008-1015
-234, 233, 245, 251, 239, 217, 179, 145, // 1016-1023
-114, 103,  88,  78,  63,  54,  57,  85, // 1024-1031
-107, 129, 139, 125, 106, 145, 161, 205, // 1032-1039
-219, 206, 163, 144, 118, 128, 143, 132, // 1040-1047
-124,  96,  77,  74, 111, 123, 154, 147, // 1048-1055
-142, 126, 142, 146, 172, 169, 159, 143, // 1056-1063
-134, 130, 140, 144, 126, 120, 109, 114, // 1064-1071
-128, 147, 136, 120,  78,  35,  13,   7, // 1072-1079
- 14,  28,  31,  25,  33,  54,  89, 141, // 1080-1087
-184, 211, 225, 232, 232, 241, 247, 235, // 1088-1095
-213, 179, 141, 115, 101,  88,  82,  69, // 1096-1103
- 58,  60,  79, 102, 128, 138, 129, 124, // 1104-1111
-132, 162, 185, 210, 197, 176, 144, 131, // 1112-1119
-123, 134, 134, 124, 109,  91,  88,  96, // 1120-1127
-117, 124, 143, 138, 144, 141, 150, 152, // 1128-1135
-159, 151, 147, 143, 141, 145, 144, 143, // 1136-1143
-131, 130, 122, 132, 136, 147, 130, 107, // 1144-1151
- 52,  23,   9,   4,  21,  30,  35,  25, // 1152-1159
- 46,  61, 115, 158, 203, 219, 232, 229, // 1160-1167
-236, 244, 239, 229, 198, 163, 122, 105, // 1168-1175
- 86,  83,  76,  68,  58,  63,  78, 107, // 1176-1183
-134, 150, 154, 147, 138, 149, 165, 180, // 1184-1191
-185, 171, 146, 125, 114, 116, 125, 124, // 1192-1199
-118, 109, 104, 108, 124, 129, 135, 132, // 1200-1207
-128, 131, 145, 149, 152, 145, 130, 122, // 1208-1215
-126, 137, 147, 157, 149, 138, 126, 125, // 1216-1223
-133, 147, 152, 137, 120,  76,  45,  27, // 1224-1231
- 25,  25,  36,  38,  30,  38,  56,  89, // 1232-1239
-128, 170, 192, 209, 215, 223, 236, 241, // 1240-1247
-231, 215, 185, 149, 127, 110,  97,  88, // 1248-1255
- 80,  68,  65,  70,  87, 114, 134, 144, // 1256-1263
-145, 138, 126, 148, 164, 180, 186, 171, // 1264-1271
-142, 127, 119, 122, 138, 130, 123, 107, // 1272-1279
-102, 104, 128, 136, 142, 130, 119, 114, // 1280-1287
-126, 140, 155, 157, 138, 125, 119, 127, // 1288-1295
-145, 164, 159, 154, 133, 124, 130, 146, // 1296-1303
-152, 152, 122,  72,  36,  13,  13,  24, // 1304-1311
- 41,  38,  35,  36,  54,  91, 136, 177, // 1312-1319
-202, 216, 216, 225, 234, 240, 234, 218, // 1320-1327
-184, 148, 120, 102,  92,  88,  81,  71, // 1328-1335
- 65,  67,  82, 109, 133, 150, 153, 147, // 1336-1343
-135, 140, 156, 170, 181, 170, 148, 122, // 1344-1351
-112, 108, 124, 128, 128, 117, 109, 106, // 1352-1359
-120, 137, 147, 149, 136, 125, 118, 124, // 1360-1367
-134, 147, 142, 135, 121, 116, 120, 137, // 1368-1375
-152, 162, 156, 149, 141, 138, 149, 149, // 1376-1383
-147, 115,  80,  43,  24,  14,  25,  35, // 1384-1391
- 37,  35,  40,  56,  83, 131, 168, 201, // 1392-1399
-214, 223, 222, 233, 234, 235, 222, 191, // 1400-1407
-156, 125, 103,  88,  87,  79,  73,  64, // 1408-1415
- 67,  73,  99, 121, 147, 157, 158, 153, // 1416-1423
-151, 150, 156, 167, 161, 155, 135, 121, // 1424-1431
-108, 112, 112, 124, 122, 122, 119, 122, // 1432-1439
-128, 139, 148, 145, 139, 126, 121, 119, // 1440-1447
-127, 132, 135, 129, 123, 118, 122, 134, // 1448-1455
-147, 157, 158, 154, 146, 145, 146, 148, // 1456-1463
-141, 123,  91,  58,  31,  17,  21,  27, // 1464-1471
- 35,  36,  42,  53,  80, 119, 158, 195, // 1472-1479
-215, 226, 227, 231, 231, 233, 222, 200, // 1480-1487
-170, 137, 108,  90,  82,  75,  73,  68, // 1488-1495
- 66,  72,  89, 110, 136, 155, 161, 160, // 1496-1503
-153, 143, 151, 159, 164, 164, 149, 127, // 1504-1511
-112, 107, 109, 123, 127, 128, 122, 119, // 1512-1519
-118, 130, 139, 146, 145, 136, 125, 118, // 1520-1527
-117, 120, 128, 128, 129, 129, 131, 135, // 1528-1535
-142, 147, 151, 153, 151, 151, 150, 146, // 1536-1543
-136, 122,  97,  73,  53,  39,  33,  33, // 1544-1551
- 36,  37,  46,  58,  80, 107, 139, 166, // 1552-1559
-191, 206, 217, 223, 227, 223, 217, 201, // 1560-1567
-178, 155, 131, 111,  97,  88,  78,  74, // 1568-1575
- 69,  73,  85, 102, 123, 141, 149, 148, // 1576-1583
-146, 139, 146, 155, 163, 162, 155, 136, // 1584-1591
-123, 116, 119, 126, 130, 129, 122, 119, // 1592-1599
-117, 128, 136, 144, 141, 135, 122, 119, // 1600-1607
-117, 123, 127, 127, 124, 122, 124, 132, // 1608-1615
-145, 151, 154, 149, 144, 142, 145, 150, // 1616-1623
-148, 136, 115,  85,  61,  45,  41,  44, // 1624-1631
- 48,  49,  47,  52,  65,  89, 121, 152, // 1632-1639
-176, 191, 200, 206, 213, 219, 219, 211, // 1640-1647
-192, 169, 144, 124, 110, 102,  93,  86, // 1648-1655
- 77,  73,  78,  90, 107, 131, 142, 145, // 1656-1663
-144, 137, 131, 148, 154, 166, 166, 154, // 1664-1671
-133, 123, 115, 121, 132, 133, 132, 122, // 1672-1679
-116, 114, 128, 134, 145, 140, 131, 119, // 1680-1687
-117, 116, 126, 132, 130, 129, 124, 125, // 1688-1695
-134, 146, 152, 156, 150, 143, 139, 141, // 1696-1703
-143, 141, 130, 105,  76,  53,  39,  39, // 1704-1711
- 46,  52,  53,  54,  59,  75, 103, 135, // 1712-1719
-165, 186, 197, 202, 207, 212, 217, 216, // 1720-1727
-204, 184, 158, 134, 116, 107,  99,  94, // 1728-1735
- 87,  77,  75,  81,  94, 114, 134, 138, // 1736-1743
-141, 134, 126, 137, 149, 160, 170, 166, // 1744-1751
-146, 135, 122, 122, 131, 136, 135, 131, // 1752-1759
-119, 112, 118, 123, 132, 137, 133, 122, // 1760-1767
-119, 114, 121, 130, 133, 134, 133, 128, // 1768-1775
-132, 142, 146, 155, 154, 144, 138, 136, // 1776-1783
-133, 137, 131, 116,  92,  68,  46,  42, // 1784-1791
- 45,  53,  60,  62,  64,  73,  90, 116, // 1792-1799
-148, 172, 190, 195, 199, 198, 204, 206, // 1800-1807
-204, 192, 174, 148, 127, 113, 105, 102, // 1808-1815
- 99,  92,  85,  83,  89,  99, 121, 133, // 1816-1823
-138, 137, 130, 120, 132, 142, 156, 169, // 1824-1831
-162, 149, 135, 125, 121, 135, 137, 144, // 1832-1839
-137, 128, 116, 119, 118, 127, 132, 128, // 1840-1847
-122, 118, 113, 117, 126, 129, 136, 136, // 1848-1855
-136, 138, 145, 144, 151, 146, 142, 138, // 1856-1863
-137, 133, 133, 123, 104,  83,  61,  49, // 1864-1871
- 47,  53,  58,  67,  66,  72,  82, 101, // 1872-1879
-125, 153, 172, 184, 190, 192, 197, 201, // 1880-1887
-202, 196, 186, 164, 146, 129, 118, 111, // 1888-1895
-106,  98,  90,  87,  86,  96, 108, 117, // 1896-1903
-122, 123, 115, 122, 132, 149, 166, 175, // 1904-1911
-168, 158, 143, 133, 136, 140, 145, 143, // 1912-1919
-134, 118, 112, 106, 111, 118, 125, 121, // 1920-1927
-120, 114, 115, 122, 130, 138, 144, 141, // 1928-1935
-138, 139, 137, 143, 147, 146, 141, 136, // 1936-1943
-127, 125, 124, 120, 112,  95,  77,  61, // 1944-1951
- 56,  57,  68,  77,  82,  84,  87,  94, // 1952-1959
-108, 131, 152, 171, 181, 187, 186, 188, // 1960-1967
-189, 190, 187, 180, 165, 149, 134, 119, // 1968-1975
-110, 104,  99,  96,  97,  94,  92,  95, // 1976-1983
- 94,  96, 112, 121, 140, 156, 166, 167, // 1984-1991
-170, 160, 158, 158, 156, 154, 151, 138, // 1992-1999
-127, 119, 108, 106, 106, 106, 105, 109, // 2000-2007
-108, 117, 125, 132, 140, 146, 144, 146, // 2008-2015
-145, 144, 147, 147, 143, 139, 132, 122, // 2016-2023
-118, 113, 108, 105,  97,  84,  74,  67, // 2024-2031
- 65,  70,  78,  86,  91,  97, 101, 110, // 2032-2039
-123, 140, 155, 170, 177, 181, 182, 180, // 2040-2047
-179, 178, 175, 167, 158, 143, 129, 117, // 2048-2055
-110, 105, 106, 104, 100,  95,  89,  89, // 2056-2063
- 99, 112, 129, 146, 155, 159, 160, 158, // 2064-2071
-158, 162, 163, 163, 157, 145, 132, 121, // 2072-2079
-112, 108, 107, 106, 105, 105, 104, 108, // 2080-2087
-117, 126, 137, 144, 148, 148, 147, 145, // 2088-2095
-147, 146, 146, 144, 138, 130, 123, 115, // 2096-2103
-109, 106, 101,  98,  92,  85,  80,  77, // 2104-2111
- 77,  81,  87,  91,  96, 100, 105, 113, // 2112-2119
-124, 137, 147, 158, 164, 169, 171, 173, // 2120-2127
-173, 173, 168, 163, 154, 144, 135, 128, // 2128-2135
-123, 119, 114, 108, 101,  95,  97, 103, // 2136-2143
-116, 130, 143, 150, 154, 154, 154, 156, // 2144-2151
-158, 160, 160, 154, 144, 133, 120, 110, // 2152-2159
-105, 102, 101, 103, 104, 107, 112, 118, // 2160-2167
-125, 134, 140, 146, 149, 149, 148, 147, // 2168-2175
-144, 142, 139, 133, 126, 119, 110, 103, // 2176-2183
-100,  96,  95,  93,  91,  88,  86,  85, // 2184-2191
- 88,  93, 100, 106, 112, 116, 120, 127, // 2192-2199
-135, 143, 153, 159, 163, 165, 165, 164, // 2200-2207
-163, 162, 158, 153, 146, 137, 131, 126, // 2208-2215
-122, 118, 114, 104, 103, 103, 108, 121, // 2216-2223
-135, 143, 149, 150, 146, 147, 148, 153, // 2224-2231
-158, 160, 152, 144, 129, 117, 109, 108, // 2232-2239
-107, 112, 112, 113, 112, 112, 114, 123, // 2240-2247
-131, 140, 146, 147, 143, 140, 135, 133, // 2248-2255
-134, 133, 130, 124, 115, 104,  98,  94, // 2256-2263
- 96,  99, 101,  98,  95,  89,  89,  92, // 2264-2271
-102, 111, 122, 125, 129, 128, 131, 136, // 2272-2279
-146, 154, 163, 165, 164, 158, 153, 147, // 2280-2287
-145, 144, 143, 141, 135, 128, 119, 112, // 2288-2295
-107, 109, 112, 120, 127, 134, 137, 139, // 2296-2303
-140, 143, 146, 153, 156, 159, 155, 149, // 2304-2311
-140, 131, 124, 120, 118, 117, 115, 114, // 2312-2319
-111, 111, 113, 117, 122, 129, 133, 135, // 2320-2327
-135, 134, 133, 133, 132, 131, 128, 123, // 2328-2335
-118, 111, 107, 105, 105, 105, 107, 107, // 2336-2343
-106, 103, 101, 100, 103, 109, 117, 124, // 2344-2351
-129, 131, 131, 131, 133, 137, 144, 149, // 2352-2359
-153, 153, 150, 145, 139, 136, 134, 135, // 2360-2367
-135, 135, 132, 130, 123, 121, 121, 124, // 2368-2375
-130, 137, 141, 144, 143, 139, 137, 136, // 2376-2383
-137, 140, 142, 141, 138, 132, 125, 120, // 2384-2391
-119, 118, 121, 123, 124, 124, 123, 122, // 2392-2399
-123, 124, 126, 127, 127, 127, 127, 126, // 2400-2407
-127, 127, 127, 125, 123, 120, 117, 116, // 2408-2415
-116, 118, 119, 118, 116, 112, 107, 105, // 2416-2423
-105, 108, 113, 119, 123, 126, 127, 128, // 2424-2431
-129, 133, 137, 143, 146, 147, 145, 142, // 2432-2439
-138, 134, 132, 132, 132, 132, 132, 131, // 2440-2447
-129, 128, 128, 129, 133, 136, 139, 140, // 2448-2455
-140, 139, 137, 135, 134, 133, 132, 131, // 2456-2463
-130, 128, 126, 123, 121, 120, 120, 121, // 2464-2471
-123, 125, 126, 127, 127, 126, 126, 126, // 2472-2479
-126, 126, 127, 128, 128, 128, 127, 125, // 2480-2487
-122, 120, 118, 118, 119, 120, 120, 118, // 2488-2495
-115, 112, 109, 108, 110, 115, 120, 125, // 2496-2503
-128, 130, 131, 131, 133, 135, 139, 141, // 2504-2511
-143, 142, 140, 136, 133, 129, 128, 128, // 2512-2519
-129, 131, 132, 132, 132, 132, 132, 133, // 2520-2527
-135, 136, 137, 137, 136, 134, 132, 129, // 2528-2535
-128, 127, 127, 126, 126, 125, 124, 124, // 2536-2543
-124, 124, 125, 126, 126, 127, 127, 126, // 2544-2551
-126, 125, 125, 125, 126, 127, 127, 127, // 2552-2559
-127, 125, 123, 122, 121, 121, 121, 121, // 2560-2567
-122, 121, 119, 116, 114, 114, 116, 119, // 2568-2575
-123, 126, 129, 130, 131, 131, 131, 132, // 2576-2583
-134, 135, 137, 137, 136, 135, 132, 130, // 2584-2591
-128, 128, 128, 130, 132, 133, 133, 133, // 2592-2599
-133, 133, 133, 134, 134, 134, 134, 133, // 2600-2607
-131, 130, 128, 127, 126, 125, 124, 125, // 2608-2615
-125, 126, 126, 126, 126, 126, 126, 126, // 2616-2623
-127, 128, 128, 127, 126, 125, 124, 125, // 2624-2631
-125, 126, 126, 125, 124, 122, 121, 120, // 2632-2639
-120, 120, 121, 120, 119, 118, 118, 119, // 2640-2647
-121, 123, 126, 128, 130, 131, 132, 133, // 2648-2655
-133, 135, 135, 135, 135, 134, 133, 131, // 2656-2663
-130, 129, 129, 129, 129, 130, 131, 132, // 2664-2671
-132, 132, 132, 132, 132, 132, 132, 132, // 2672-2679
-132};// 2680-2680
-
-#define KABOOM_N 7273
-const uint8_t kaboom[KABOOM_N] = {
- 73,  84, 121, 172, 165, 140, 130, 156, // 0-7
-161, 122, 120, 103, 138, 115, 117, 114, // 8-15
-136, 120, 137, 124, 102, 117, 145, 158, // 16-23
-138, 127, 128, 129, 119,  97, 125, 127, // 24-31
-115, 113, 117, 119, 130, 127, 133, 139, // 32-39
-125, 132, 154, 132, 126, 116, 133, 152, // 40-47
-123, 103, 150, 151, 141, 140, 108, 119, // 48-55
-114, 106, 105, 118, 111, 120, 133, 140, // 56-63
-148, 146, 144, 133, 127, 115, 107, 128, // 64-71
-116, 124, 114, 119, 120, 121, 116, 125, // 72-79
-112, 119, 151, 141, 177, 160, 151, 140, // 80-87
-153, 134, 123, 105,  94,  79,  86, 106, // 88-95
-139, 148, 165, 142, 123, 115, 119, 116, // 96-103
-125, 119, 128, 142, 129, 137, 114, 130, // 104-111
-122, 131, 126, 138, 126, 131, 118, 131, // 112-119
-125, 123, 128, 125, 122, 121, 120, 132, // 120-127
-130, 133, 127, 134, 148, 142, 130, 141, // 128-135
-142, 145, 129, 102,  90,  83,  94, 113, // 136-143
-134, 148, 150, 140, 127, 113, 113, 127, // 144-151
-147, 142, 140, 122, 116, 114, 117, 123, // 152-159
-126, 132, 144, 171, 196, 177, 104,  83, // 160-167
- 68,  69,  93, 126, 129, 137, 131, 130, // 168-175
-142, 147, 139, 136, 119, 119, 118, 129, // 176-183
-131, 119, 107, 105, 128, 151, 164, 155, // 184-191
-144, 145, 150, 137, 129, 113,  98, 110, // 192-199
-117, 123, 105,  85,  87,  89, 128, 159, // 200-207
-169, 159, 141, 101,  83, 101, 153, 155, // 208-215
-140, 119, 117, 155, 183, 193, 196, 186, // 216-223
- 95,  17,   8,  87, 193, 227, 180,  93, // 224-231
- 34,  13,  98, 162, 204, 191, 108,  74, // 232-239
-108, 168, 186, 147, 101, 124, 160, 172, // 240-247
-120,  73,  76, 107, 134, 161, 136, 106, // 248-255
-109, 143, 165, 124,  96, 102, 147, 176, // 256-263
-165, 109,  55,  50, 121, 196, 198, 127, // 264-271
- 57,  86, 159, 191, 157, 106, 101, 145, // 272-279
-167, 133,  82,  72, 116, 157, 152, 122, // 280-287
-104,  99, 134, 149, 146, 121, 102, 118, // 288-295
-160, 159, 115,  77, 113, 163, 184, 134, // 296-303
- 75,  80, 151, 177, 125,  78, 106, 179, // 304-311
-166,  91,  94, 138, 155, 120,  94, 120, // 312-319
-161, 162,  96,  79, 149, 212, 115,  21, // 320-327
- 64, 199, 244, 136,  29,  68, 176, 209, // 328-335
-123,  55,  90, 171, 166, 115,  71, 130, // 336-343
-186, 143,  62,  99, 202, 156,  81,  70, // 344-351
-146, 202, 145,  74,  99, 168, 144, 100, // 352-359
- 82, 138, 178, 141,  79, 102, 151, 160, // 360-367
-122, 109, 123, 150, 132,  87, 112, 184, // 368-375
-132,  79, 154, 135, 139, 123,  95,  63, // 376-383
-112, 213, 199, 123,  29,  80, 169, 201, // 384-391
-131,  71, 125, 199, 141,  35,  96, 196, // 392-399
-172,  79,  88, 177, 169,  82,  57, 123, // 400-407
-201, 148,  91, 115, 146, 130,  94, 114, // 408-415
-163, 156, 107,  89, 130, 157, 148, 114, // 416-423
-123,  99, 136, 167, 148,  95,  78, 144, // 424-431
-172, 144, 102,  91, 115, 144, 133, 120, // 432-439
-144, 147, 120,  63, 155, 163,  81, 130, // 440-447
-172, 134,  89, 123, 151, 139, 103, 149, // 448-455
-130, 147, 111,  83, 143, 168, 117, 105, // 456-463
-130, 121, 101, 117, 159, 160, 116, 100, // 464-471
-127, 154, 101, 134, 145, 100, 151, 121, // 472-479
-119, 118, 142, 134, 116, 120, 132, 153, // 480-487
-116, 105, 132, 155, 103, 104, 157, 143, // 488-495
- 97, 118, 158, 135, 100, 113, 169, 146, // 496-503
- 90, 111, 146, 151, 115, 102, 127, 135, // 504-511
-132, 125, 109, 128, 155, 127, 122, 102, // 512-519
-150, 137, 114, 109, 144, 148,  95, 117, // 520-527
-144, 150, 113, 105, 149, 139, 109, 116, // 528-535
-155, 109, 109, 160, 140, 113,  92, 140, // 536-543
-165, 108, 122, 117, 114, 157, 127,  98, // 544-551
-106, 170, 160,  81, 123, 145, 140, 124, // 552-559
-115, 111, 156, 121, 101, 133, 135, 134, // 560-567
-117, 129, 137, 123, 118, 142, 124, 128, // 568-575
-126, 138, 110, 136, 127, 128, 133, 135, // 576-583
- 96, 119, 149, 120, 128, 118, 162, 139, // 584-591
- 75,  88, 177, 182,  77,  88, 161, 133, // 592-599
-129, 138, 113, 120, 143, 126,  87, 166, // 600-607
-194,  68,  81, 177, 102, 103, 172, 129, // 608-615
-121, 123, 131, 109,  99, 166, 151, 102, // 616-623
-118, 151, 139,  97, 118, 126, 127, 124, // 624-631
-143, 130, 141, 122, 111, 124, 122, 147, // 632-639
-158, 126,  66, 121, 150, 144, 111, 110, // 640-647
-160, 135, 110, 153, 131, 108,  89, 134, // 648-655
-136, 140, 118, 145, 123, 142, 108, 101, // 656-663
-132, 173, 146, 100, 100, 129, 163,  97, // 664-671
-113, 142, 156,  91, 122, 142, 117, 113, // 672-679
-161, 138,  90, 104, 174, 143,  99, 128, // 680-687
-168, 129,  76, 109, 155, 144, 132,  73, // 688-695
-116, 186, 140, 119, 101, 150, 117, 109, // 696-703
-124, 154, 137,  91, 116, 148, 134, 128, // 704-711
-149, 108, 135, 111, 135, 113, 131, 149, // 712-719
-125, 109, 118, 131, 170,  90,  99, 123, // 720-727
-189, 133,  67, 118, 149, 140, 127, 160, // 728-735
-113, 115,  95, 140, 142,  98, 144, 193, // 736-743
- 68,  99, 150, 168,  97, 111, 153, 140, // 744-751
-104,  98, 138, 135, 120, 135, 125, 144, // 752-759
-113, 149, 154, 100, 108, 130, 131, 118, // 760-767
-108, 136, 152, 120, 110, 124, 172, 131, // 768-775
-107, 116, 126, 111, 163, 141,  61, 126, // 776-783
-154, 127, 172, 100,  92, 153, 158,  89, // 784-791
-126, 132, 143, 140, 141,  97, 101, 182, // 792-799
-105,  68, 151, 187, 110,  32, 122, 218, // 800-807
-161,  81, 110, 163, 126, 126,  96, 129, // 808-815
-131, 147, 118, 102, 160, 144, 101, 108, // 816-823
-164, 137, 109, 104, 136, 125, 132, 108, // 824-831
-145, 140, 110, 142, 111, 119, 153, 163, // 832-839
- 89,  93, 156, 167,  95,  99, 147, 123, // 840-847
- 91, 157, 142, 147, 111,  85, 166, 130, // 848-855
-111, 143, 136, 133, 119,  84, 145, 143, // 856-863
-124,  95, 142, 175,  91, 126, 116, 155, // 864-871
-131, 116, 139, 126, 122, 114, 111,  99, // 872-879
-194, 137,  84, 108, 165, 157,  87,  99, // 880-887
-159, 142,  89, 126, 158, 138, 115, 110, // 888-895
-144, 133, 152, 100, 133, 133,  88, 116, // 896-903
-105, 146, 179, 114,  97, 145, 128, 130, // 904-911
-121, 132, 126, 147, 146,  98,  99, 112, // 912-919
-155, 148, 116, 112, 104, 178, 124,  99, // 920-927
-142, 135, 130, 105, 112, 165, 103, 143, // 928-935
-133, 106, 134, 131, 124, 139, 112, 149, // 936-943
- 97, 106, 148, 143, 118, 157, 104, 137, // 944-951
-166,  81,  97, 156, 129,  81, 164, 136, // 952-959
-133, 111,  99, 176, 131,  99, 144, 139, // 960-967
-104, 133, 118, 104, 169, 123, 139, 107, // 968-975
-103, 143, 132, 123, 135, 126, 128, 151, // 976-983
-143, 108,  97, 131, 132, 114,  73, 133, // 984-991
-205, 143,  83, 141, 135, 126, 153,  83, // 992-999
-130, 160,  98,  91, 148, 156, 147,  90, // 1000-1007
-126, 146, 124,  90, 150, 150, 121,  98, // 1008-1015
-155, 123, 142, 106,  89, 130, 161, 159, // 1016-1023
- 95,  95, 168, 153,  86, 126, 120, 137, // 1024-1031
-153, 106, 106, 145, 155,  90, 154,  98, // 1032-1039
-127, 173,  93, 111, 120, 126, 168, 129, // 1040-1047
-105, 139, 105, 167, 117,  97, 138, 151, // 1048-1055
-124, 109, 110, 162, 125, 131, 108, 120, // 1056-1063
-149, 112, 109, 107, 167, 157,  99, 109, // 1064-1071
-132, 165, 101, 151,  99, 111, 155, 145, // 1072-1079
-114, 103, 116, 160, 145, 102, 102, 145, // 1080-1087
-155, 119,  91, 107, 160, 157, 100, 103, // 1088-1095
-125, 177, 161, 121,  71, 106, 179, 112, // 1096-1103
-109, 125, 119, 141, 141, 128, 120, 141, // 1104-1111
- 87, 166, 132, 110, 128, 116, 127, 137, // 1112-1119
-134, 110, 148, 123, 131,  95, 142, 147, // 1120-1127
-115, 102, 133, 163, 125, 109, 104, 149, // 1128-1135
-145, 114,  96, 130, 185, 141,  98,  97, // 1136-1143
-155, 125,  97,  98, 134, 169, 138,  99, // 1144-1151
-141, 150, 141,  91, 103, 162, 140, 107, // 1152-1159
-109, 113, 149, 145, 114, 125, 153, 118, // 1160-1167
-121, 114, 143, 119, 136, 108, 107, 128, // 1168-1175
-153, 143, 108, 132, 141, 135, 123, 127, // 1176-1183
-122, 148, 102, 106, 111, 140, 136, 137, // 1184-1191
-123, 127, 114, 147, 130, 127, 142, 111, // 1192-1199
-107, 158, 110, 117, 139, 139, 140, 134, // 1200-1207
-125, 121,  77, 114, 160, 151, 104, 112, // 1208-1215
-132, 165, 133, 102, 126, 137, 143, 106, // 1216-1223
-106, 146, 152, 109,  94, 124, 160, 126, // 1224-1231
-150, 127, 113, 126, 121, 102, 136, 132, // 1232-1239
-144, 126, 122, 108, 135, 122, 157, 116, // 1240-1247
-114, 139, 140, 127,  94, 131, 148, 159, // 1248-1255
-121,  73, 127, 157, 153,  92,  84, 154, // 1256-1263
-170, 122,  92,  95, 162, 166, 129, 113, // 1264-1271
-107, 137, 121, 130, 117, 138, 137, 117, // 1272-1279
-131, 110, 132, 138, 161, 109, 108, 118, // 1280-1287
-116, 144, 127, 119, 139, 135, 147, 117, // 1288-1295
- 94, 106, 142, 165, 119, 118, 116, 146, // 1296-1303
-128, 125, 143, 133, 125, 116, 115, 109, // 1304-1311
- 99, 142, 164, 137, 117, 112, 114, 149, // 1312-1319
-135, 136, 114, 129, 132, 117, 100, 135, // 1320-1327
-134, 142, 135, 133, 124, 126, 133, 148, // 1328-1335
-110,  96,  92, 129, 166, 142, 111,  85, // 1336-1343
-158, 169, 141, 109,  96, 127, 136, 142, // 1344-1351
-111, 113, 137, 168, 122, 112, 110, 145, // 1352-1359
-118, 120, 104, 130, 134, 133, 134, 115, // 1360-1367
-142, 140, 132, 121, 113, 119, 157, 139, // 1368-1375
-106,  83, 125, 181, 162, 100,  87, 103, // 1376-1383
-151, 148, 120, 108, 113, 127, 154, 140, // 1384-1391
-136, 128, 131, 110, 132, 133, 109, 117, // 1392-1399
-109, 146, 136, 142, 133, 133, 127, 101, // 1400-1407
- 89, 123, 157, 170, 124,  82, 114, 142, // 1408-1415
-156, 130, 110, 114, 141, 151, 140, 120, // 1416-1423
-130,  99,  91, 111, 143, 174, 140,  99, // 1424-1431
- 71, 126, 184, 180, 117,  88, 100, 135, // 1432-1439
-171, 130,  90,  89, 130, 189, 173, 107, // 1440-1447
- 72,  83, 137, 159, 146, 104, 103, 136, // 1448-1455
-157, 153, 144, 120,  99, 100, 130, 154, // 1456-1463
-137, 116,  97, 116, 137, 144, 125, 111, // 1464-1471
-134, 141, 142, 130, 140, 119, 112, 106, // 1472-1479
-122, 133, 144, 122, 120, 112, 132, 140, // 1480-1487
-143, 138, 125, 122, 113, 117, 130, 141, // 1488-1495
-149, 125,  98,  90, 122, 142, 156, 150, // 1496-1503
-121, 122, 111, 138, 131, 143, 118, 114, // 1504-1511
-130, 124, 120, 104, 112, 147, 168, 150, // 1512-1519
-119,  92, 103, 119, 162, 157, 144,  90, // 1520-1527
- 78, 102, 142, 188, 182, 136,  85,  66, // 1528-1535
-100, 151, 156, 141, 119, 109, 118, 129, // 1536-1543
-154, 162, 129,  98,  83, 119, 140, 161, // 1544-1551
-152, 120,  98, 106, 115, 127, 151, 159, // 1552-1559
-140, 118,  86, 100, 134, 160, 148, 132, // 1560-1567
-105, 116, 130, 144, 136, 116, 108, 114, // 1568-1575
-124, 128, 133, 136, 144, 137, 139, 126, // 1576-1583
-115,  96, 117, 141, 146, 145, 117, 109, // 1584-1591
-107, 120, 133, 143, 150, 140, 124, 111, // 1592-1599
-117, 113, 117, 128, 149, 164, 154, 115, // 1600-1607
- 90,  87,  98, 135, 156, 154, 136, 120, // 1608-1615
-114, 120, 134, 141, 137, 125, 121, 119, // 1616-1623
-129, 126, 136, 128, 124, 116, 104, 108, // 1624-1631
-124, 137, 152, 159, 140, 123, 106, 115, // 1632-1639
-134, 142, 130, 121, 112, 119, 124, 123, // 1640-1647
-128, 132, 126, 132, 128, 131, 132, 129, // 1648-1655
-128, 129, 126, 121, 125, 130, 127, 125, // 1656-1663
-124, 128, 134, 127, 128, 125, 129, 123, // 1664-1671
-122, 122, 129, 131, 127, 123, 127, 129, // 1672-1679
-131, 130, 128, 126, 125, 131, 128, 127, // 1680-1687
-125, 125, 126, 125, 125, 126, 129, 130, // 1688-1695
-129, 129, 125, 126, 123, 127, 129, 131, // 1696-1703
-131, 131, 124, 122, 122, 129, 127, 131, // 1704-1711
-127, 124, 128, 130, 128, 124, 126, 126, // 1712-1719
-127, 128, 127, 127, 129, 127, 129, 126, // 1720-1727
-127, 128, 125, 125, 123, 127, 130, 128, // 1728-1735
-128, 128, 127, 127, 127, 127, 128, 129, // 1736-1743
-127, 125, 128, 125, 126, 126, 129, 127, // 1744-1751
-127, 127, 127, 127, 127, 129, 128, 125, // 1752-1759
-128, 127, 127, 127, 128, 125, 126, 127, // 1760-1767
-128, 128, 128, 129, 128, 124, 126, 125, // 1768-1775
-128, 130, 126, 126, 125, 126, 129, 129, // 1776-1783
-128, 127, 127, 123, 128, 125, 133, 131, // 1784-1791
-131, 123, 127, 109, 105, 101, 115, 111, // 1792-1799
-110, 116, 131, 117, 126, 139, 134, 140, // 1800-1807
-156, 122, 125, 162, 155, 150, 147, 127, // 1808-1815
-133, 126, 115, 115, 117, 125, 122, 131, // 1816-1823
-120, 123, 125, 152, 137, 143, 125, 111, // 1824-1831
-101,  80,  66,  96, 123, 119, 122, 127, // 1832-1839
-148, 143, 146, 147, 145, 133, 148, 133, // 1840-1847
-143, 144, 139, 134, 134, 123,  92, 120, // 1848-1855
-141, 146, 109,  81, 126, 136, 112, 124, // 1856-1863
-126, 142, 125, 130, 126, 128, 136, 137, // 1864-1871
-124, 132, 120, 138, 132, 121, 111, 129, // 1872-1879
-132, 125, 122, 135, 126, 131, 131, 128, // 1880-1887
-132, 129, 114, 115, 116, 117, 120, 113, // 1888-1895
-118, 121, 129, 124, 132, 130, 147, 144, // 1896-1903
-143, 140, 149, 130, 138, 127, 128, 132, // 1904-1911
-138, 141, 150, 141, 128, 114,  84,  79, // 1912-1919
- 81,  98, 114, 155, 146, 145, 133, 122, // 1920-1927
-112, 133, 119, 137, 142, 118, 152, 143, // 1928-1935
-134, 149, 154, 119, 117,  71,  58,  76, // 1936-1943
- 88, 121, 132, 155, 160, 161, 145, 145, // 1944-1951
-142, 138, 126, 132, 135, 140, 153, 160, // 1952-1959
-151, 159, 136, 126,  91,  72,  85,  85, // 1960-1967
-110, 135, 153, 150, 130, 118, 109, 106, // 1968-1975
-106, 115, 139, 134, 140, 156, 144, 122, // 1976-1983
-133, 122, 100, 122, 135, 140, 150, 128, // 1984-1991
-123, 129, 135, 145, 146, 114, 131, 116, // 1992-1999
-145, 149, 110, 120, 108,  63, 138, 104, // 2000-2007
-135, 122,  95, 122, 102, 114, 140, 141, // 2008-2015
-151, 146, 141, 127, 148, 154, 134, 146, // 2016-2023
-153, 142, 130, 117, 119, 113, 108,  95, // 2024-2031
-108, 114, 137, 141, 156, 124, 107,  89, // 2032-2039
- 86, 123, 167, 174, 172, 172, 148, 102, // 2040-2047
- 86, 100, 120, 145, 146, 130,  91,  88, // 2048-2055
-107, 127, 148, 162, 137, 117,  79, 111, // 2056-2063
-143, 154, 136, 151, 136, 136, 118, 134, // 2064-2071
-110, 129, 123, 116,  84,  90, 100, 129, // 2072-2079
-140, 158, 142, 142, 138, 137, 139, 101, // 2080-2087
-109, 112, 121, 144, 129, 146, 145, 152, // 2088-2095
-138, 125, 136, 113, 125, 120, 124, 128, // 2096-2103
-141, 149, 150, 137, 133, 128, 122, 111, // 2104-2111
- 97,  95,  80,  97, 112, 133, 148, 180, // 2112-2119
-192, 177, 139,  48,  18,  17,  92, 176, // 2120-2127
-229, 236, 196, 141,  88,  79,  87, 113, // 2128-2135
-139, 150, 152, 125,  99,  74,  64,  87, // 2136-2143
-139, 181, 204, 184, 149, 113,  80,  94, // 2144-2151
-130, 154, 145, 120,  88, 106, 135, 153, // 2152-2159
-167, 166, 128,  79,  62,  96, 122, 116, // 2160-2167
-118, 144, 185, 182, 138, 105, 102, 116, // 2168-2175
-144, 155, 163, 133,  92,  58,  79, 124, // 2176-2183
-159, 147, 110, 107, 137, 169, 159, 145, // 2184-2191
-128, 111, 118, 118, 141, 163, 137,  86, // 2192-2199
- 67,  83, 134, 150, 154, 134, 130, 127, // 2200-2207
-152, 136, 119, 106, 127, 154, 131,  90, // 2208-2215
-100, 100, 132, 147, 155, 145, 138, 120, // 2216-2223
-110, 134, 158, 145, 146, 132, 125, 131, // 2224-2231
-126, 108,  89, 100, 128, 124, 101, 105, // 2232-2239
-143, 188, 128,  46,  33, 131, 224, 242, // 2240-2247
-151,  72,  61, 121, 168, 158, 107,  75, // 2248-2255
- 98, 134, 150, 131, 115, 124, 150, 179, // 2256-2263
-177,  94,  42,  49, 133, 188, 170, 101, // 2264-2271
- 62, 126, 189, 199, 142,  89,  56, 133, // 2272-2279
-197, 175,  95,  43,  64, 131, 188, 179, // 2280-2287
-116,  59,  66, 145, 190, 186, 141, 109, // 2288-2295
-124, 152, 144, 100,  86, 124, 168, 177, // 2296-2303
-125,  98,  93, 168, 117,  82,  54, 130, // 2304-2311
-184, 202, 102, 119,  93,  89, 129, 144, // 2312-2319
-146, 102, 105, 118, 170, 158, 132,  96, // 2320-2327
-124, 144, 162, 135, 131, 121, 127, 116, // 2328-2335
-121, 115, 135, 135, 139, 121, 122, 106, // 2336-2343
-125, 142, 178, 118,  52,  72, 114, 165, // 2344-2351
-152, 111,  97, 147, 184, 159,  99,  86, // 2352-2359
-122, 164, 170, 128,  98, 116, 138, 136, // 2360-2367
-127, 121, 140, 133, 112, 102, 118, 135, // 2368-2375
-137, 124, 125, 119, 134, 123, 112, 128, // 2376-2383
-130, 129, 132, 149, 146, 116,  97, 109, // 2384-2391
-142, 157, 133, 112, 120, 138, 135, 121, // 2392-2399
-121, 135, 139, 142, 125, 101, 111, 103, // 2400-2407
-111, 131, 136, 140, 130, 131, 132, 131, // 2408-2415
-110, 114, 129, 154, 148, 118, 100, 125, // 2416-2423
-159, 159, 118,  91, 105, 149, 169, 137, // 2424-2431
- 96, 110, 164, 154, 111,  90,  95, 149, // 2432-2439
-158, 114,  74,  94, 156, 194, 142,  88, // 2440-2447
- 65, 121, 185, 155, 100,  82, 123, 152, // 2448-2455
-138, 116, 132, 168, 185, 143,  87,  69, // 2456-2463
-131, 165, 141, 107, 101, 122, 143, 120, // 2464-2471
-108, 128, 160, 133, 110, 113, 123, 118, // 2472-2479
-123, 136, 143, 135,  97, 104, 141, 164, // 2480-2487
-143, 101, 106, 151, 157, 123,  97, 118, // 2488-2495
-143, 146, 116, 115, 120, 135, 136, 112, // 2496-2503
-107, 135, 152, 131, 115, 113, 125, 144, // 2504-2511
-147, 120, 111, 114, 139, 142, 132, 118, // 2512-2519
-135, 148, 140,  85,  73, 126, 174, 163, // 2520-2527
- 90,  84, 114, 169, 163, 114,  80, 120, // 2528-2535
-163, 174, 128, 107, 124, 157, 147, 122, // 2536-2543
- 99, 116, 158, 101,  71,  97, 161, 177, // 2544-2551
-132,  83,  85, 148, 187, 154, 107, 100, // 2552-2559
-130, 156, 128,  94, 109, 147, 162, 115, // 2560-2567
- 74, 113, 170, 184, 131,  84, 106, 145, // 2568-2575
-150, 121,  91, 109, 142, 146, 130, 103, // 2576-2583
-101, 130, 150, 132, 123, 126, 139, 142, // 2584-2591
-133, 123, 121, 128, 145, 130, 114, 129, // 2592-2599
-134, 118, 104, 117, 131, 150, 136, 119, // 2600-2607
-122, 137, 126, 123, 101,  95, 100, 122, // 2608-2615
-151, 160, 157, 148, 142, 120, 112, 121, // 2616-2623
-126, 128, 123, 113, 123, 135, 137, 120, // 2624-2631
-120, 125, 133, 120, 126, 129, 144, 137, // 2632-2639
-112, 118, 126, 128, 137, 118, 127, 131, // 2640-2647
-132, 118, 119, 126, 140, 154, 129, 102, // 2648-2655
-105, 129, 148, 135, 118, 115, 124, 149, // 2656-2663
-150, 115, 124, 131, 113, 106, 106, 133, // 2664-2671
-154, 132,  97, 131, 137, 148, 124, 100, // 2672-2679
-108, 136, 161, 156, 134, 112, 118, 129, // 2680-2687
-121, 122, 133, 139, 124, 102,  89, 117, // 2688-2695
-158, 167, 143, 112, 115, 130, 149, 127, // 2696-2703
- 99, 100, 129, 147, 146, 129, 128, 121, // 2704-2711
-124, 130, 109, 104, 120, 145, 150, 119, // 2712-2719
- 88, 104, 157, 186, 166, 116,  82, 115, // 2720-2727
-149, 152, 120,  87, 101, 143, 162, 141, // 2728-2735
-102, 102, 141, 155, 143, 113,  85, 128, // 2736-2743
-153, 129, 103, 111, 127, 156, 153, 121, // 2744-2751
-108, 105, 125, 136, 139, 138, 140, 127, // 2752-2759
-126, 121, 125, 130, 136, 120, 114, 127, // 2760-2767
-143, 129, 118, 110, 125, 150, 127, 111, // 2768-2775
-113, 138, 143, 131, 115, 127, 135, 151, // 2776-2783
-132, 103, 107, 143, 154, 134, 109,  99, // 2784-2791
-112, 122, 145, 132,  93,  87, 137, 172, // 2792-2799
-169, 126, 110, 132, 162, 138, 101,  95, // 2800-2807
-115, 151, 142, 111, 106, 134, 146, 137, // 2808-2815
-118, 116, 126, 134, 135, 131, 123, 119, // 2816-2823
-129, 130, 136, 121, 106, 109, 132, 151, // 2824-2831
-147, 113,  96, 113, 141, 153, 134, 106, // 2832-2839
- 98, 129, 158, 158, 139, 129, 124, 133, // 2840-2847
-123, 112,  99, 119, 131, 136, 128, 111, // 2848-2855
-134, 141, 135, 120, 120, 122, 132, 137, // 2856-2863
-130, 116, 126, 139, 149, 156, 136,  77, // 2864-2871
-113, 134, 129, 116, 101, 122, 156, 152, // 2872-2879
- 97,  72, 102, 166, 170, 129, 100, 117, // 2880-2887
-148, 155, 133, 119, 127, 149, 141, 128, // 2888-2895
-106, 107, 124, 136, 128, 122, 123, 126, // 2896-2903
-129, 128, 126, 129, 134, 122, 124, 142, // 2904-2911
-143, 138, 128,  91,  90, 119, 135, 139, // 2912-2919
-124, 110, 132, 132, 122, 127, 141, 147, // 2920-2927
-145, 122, 123, 139, 144, 133, 114, 103, // 2928-2935
-120, 133, 140, 124, 106, 117, 135, 136, // 2936-2943
-126, 125, 122, 123, 127, 133, 146, 135, // 2944-2951
-120, 124, 137, 118,  94, 109, 143, 160, // 2952-2959
-123,  95, 102, 142, 164, 144, 106, 107, // 2960-2967
-132, 156, 155, 123,  99, 115, 130, 140, // 2968-2975
-128, 120, 125, 132, 128, 120, 126, 132, // 2976-2983
-138, 125, 116, 115, 133, 121, 108, 113, // 2984-2991
-144, 162, 153, 121, 104, 115, 134, 135, // 2992-2999
-126, 120, 134, 140, 132, 123, 119, 113, // 3000-3007
-132, 135, 123, 115, 106, 124, 146, 153, // 3008-3015
-130, 106, 114, 145, 146, 119, 101, 120, // 3016-3023
-142, 147, 127, 115, 118, 136, 132, 120, // 3024-3031
-116, 138, 144, 138, 113, 108, 130, 149, // 3032-3039
-136, 113, 110, 122, 136, 130, 132, 122, // 3040-3047
-124, 130, 131, 122, 123, 124, 129, 128, // 3048-3055
-128, 123, 122, 135, 132, 128, 120, 125, // 3056-3063
-138, 143, 128, 122, 120, 131, 129, 126, // 3064-3071
-121, 126, 121, 135, 131, 135, 135, 130, // 3072-3079
-117, 101, 103, 122, 142, 132, 116, 105, // 3080-3087
-122, 154, 166, 144, 125, 114, 122, 130, // 3088-3095
-132, 119, 112, 117, 130, 144, 145, 127, // 3096-3103
-115, 110, 125, 140, 139, 116, 110, 119, // 3104-3111
-145, 154, 123, 107, 111, 137, 140, 128, // 3112-3119
-109, 113, 130, 147, 150, 137, 116, 104, // 3120-3127
-115, 135, 141, 128,  95,  80, 118, 159, // 3128-3135
-169, 148, 131, 131, 137, 125, 117, 112, // 3136-3143
-120, 131, 133, 121, 118, 116, 127, 138, // 3144-3151
-136, 137, 135, 132, 112, 112, 119, 132, // 3152-3159
-128, 120, 121, 128, 140, 142, 126, 115, // 3160-3167
-126, 138, 138, 126, 108, 110, 132, 147, // 3168-3175
-151, 130, 111, 107, 128, 138, 145, 122, // 3176-3183
-106, 115, 143, 144, 133, 106, 101, 117, // 3184-3191
-143, 150, 138, 102,  93, 121, 164, 167, // 3192-3199
-140,  98, 102, 132, 163, 149, 107,  90, // 3200-3207
-115, 144, 145, 132, 117, 123, 135, 131, // 3208-3215
-125, 127, 132, 125, 115, 121, 133, 133, // 3216-3223
-111,  95,  95, 135, 169, 163, 126, 108, // 3224-3231
-108, 130, 156, 151, 124, 114, 110, 133, // 3232-3239
-149, 141, 112, 107, 119, 146, 146, 127, // 3240-3247
-106, 131, 158, 142,  76,  61, 104, 163, // 3248-3255
-159, 112,  76, 102, 165, 192, 167, 120, // 3256-3263
-100, 119, 152, 161, 130,  87,  84, 122, // 3264-3271
-158, 157, 120, 103, 115, 152, 160, 128, // 3272-3279
- 99,  98, 104, 137, 143, 122, 104, 103, // 3280-3287
-118, 148, 151, 146, 127, 124, 141, 151, // 3288-3295
-133, 116, 108, 111, 125, 134, 138, 131, // 3296-3303
-128, 123, 129, 133, 125, 107, 118, 131, // 3304-3311
-142, 137, 126, 106, 112, 121, 143, 141, // 3312-3319
-132, 121, 120, 116, 127, 131, 150, 153, // 3320-3327
-135, 111,  97, 107, 143, 148, 135, 115, // 3328-3335
-113, 129, 146, 133, 121, 109, 118, 133, // 3336-3343
-135, 127, 122, 121, 126, 132, 136, 136, // 3344-3351
-127, 116, 111, 123, 140, 141, 127, 121, // 3352-3359
-122, 142, 138, 120,  99, 119, 150, 156, // 3360-3367
-126, 110, 106, 129, 147, 138, 119, 102, // 3368-3375
-103, 134, 146, 142, 119, 108, 120, 140, // 3376-3383
-146, 146, 130, 132, 132, 133, 126, 103, // 3384-3391
- 76,  89, 127, 165, 154, 124, 106, 131, // 3392-3399
-165, 165, 139, 119, 109, 116, 132, 137, // 3400-3407
-127,  86,  81, 116, 157, 170, 142,  97, // 3408-3415
- 95, 118, 155, 154, 128, 108, 111, 131, // 3416-3423
-151, 136, 126, 119, 127, 136, 133, 121, // 3424-3431
-117, 121, 132, 136, 126, 120, 115, 127, // 3432-3439
-136, 138, 132, 119, 112, 116, 125, 140, // 3440-3447
-145, 134, 111, 111, 124, 141, 144, 133, // 3448-3455
-114, 108, 124, 142, 139, 128, 120, 118, // 3456-3463
-123, 133, 136, 124, 112, 120, 134, 139, // 3464-3471
-130, 114, 123, 138, 138, 129, 119, 123, // 3472-3479
-135, 126, 126, 133, 135, 119,  99, 107, // 3480-3487
-129, 151, 160, 141, 126, 111,  92, 114, // 3488-3495
-138, 149, 142, 115,  99, 124, 145, 152, // 3496-3503
-130,  93,  98, 144, 171, 168, 129,  93, // 3504-3511
- 97, 124, 140, 148, 144, 113,  87,  87, // 3512-3519
-120, 162, 178, 138,  90,  79, 119, 152, // 3520-3527
-159, 134, 117, 115, 138, 145, 137, 118, // 3528-3535
-123, 131, 135, 132, 120, 108, 116, 132, // 3536-3543
-138, 132, 119, 117, 121, 124, 124, 130, // 3544-3551
-136, 135, 127, 126, 125, 126, 118, 123, // 3552-3559
-132, 144, 135, 123, 112, 122, 137, 141, // 3560-3567
-133, 123, 116, 124, 130, 136, 129, 116, // 3568-3575
-121, 141, 136, 121, 108, 111, 124, 132, // 3576-3583
-134, 138, 139, 133, 120, 110, 119, 138, // 3584-3591
-143, 139, 129, 124, 122, 120, 119, 127, // 3592-3599
-133, 132, 117, 118, 127, 142, 139, 130, // 3600-3607
-115, 115, 119, 127, 127, 135, 136, 132, // 3608-3615
-124, 118, 122, 133, 137, 136, 124, 114, // 3616-3623
-114, 125, 139, 136, 129, 124, 126, 132, // 3624-3631
-132, 125, 119, 122, 132, 131, 125, 121, // 3632-3639
-114, 123, 141, 142, 136, 117, 108, 123, // 3640-3647
-145, 140, 122, 103, 111, 136, 150, 144, // 3648-3655
-128, 112, 113, 122, 135, 143, 134, 113, // 3656-3663
-105, 123, 143, 149, 130, 116, 114, 123, // 3664-3671
-134, 135, 127, 122, 110, 108, 130, 148, // 3672-3679
-147, 131, 114, 114, 133, 143, 139, 126, // 3680-3687
-113, 112, 124, 137, 140, 127, 118, 120, // 3688-3695
-139, 135, 121, 111, 120, 136, 144, 126, // 3696-3703
-115, 110, 119, 137, 142, 130, 109, 104, // 3704-3711
-128, 164, 167, 133,  93,  88, 119, 150, // 3712-3719
-152, 129, 109, 117, 131, 146, 145, 132, // 3720-3727
-111, 108, 113, 132, 151, 150, 124, 118, // 3728-3735
-114, 110, 115, 111, 113, 132, 143, 139, // 3736-3743
-132, 130, 138, 138, 135, 131, 128, 125, // 3744-3751
-127, 114, 123, 125, 128, 126, 130, 120, // 3752-3759
-121, 121, 131, 134, 136, 122, 129, 137, // 3760-3767
-138, 123, 101,  91, 120, 144, 152, 138, // 3768-3775
-119, 116, 129, 142, 147, 138, 122, 117, // 3776-3783
-119, 129, 126, 121, 114, 128, 135, 134, // 3784-3791
-118, 116, 122, 140, 135, 124, 112, 122, // 3792-3799
-135, 153, 147, 137, 110,  92,  93, 123, // 3800-3807
-157, 176, 156, 115,  80,  96, 122, 140, // 3808-3815
-138, 122, 111, 125, 148, 159, 149, 130, // 3816-3823
-117, 115, 132, 150, 127,  99,  89,  91, // 3824-3831
-125, 160, 157, 127, 102, 104, 131, 166, // 3832-3839
-168, 136,  95,  89, 108, 140, 153, 139, // 3840-3847
-116, 115, 130, 144, 140, 128, 125, 124, // 3848-3855
-128, 128, 123, 122, 134, 129, 119, 108, // 3856-3863
-110, 129, 150, 128, 106,  96, 121, 158, // 3864-3871
-172, 142, 117, 102, 125, 144, 146, 127, // 3872-3879
-108, 104, 132, 142, 142, 127, 113, 110, // 3880-3887
-133, 143, 150, 137, 111,  94, 106, 131, // 3888-3895
-149, 141, 117, 104, 109, 134, 154, 145, // 3896-3903
-124, 111, 117, 138, 152, 138, 118, 109, // 3904-3911
-120, 137, 139, 134, 119, 108, 114, 137, // 3912-3919
-148, 143, 116,  98, 111, 142, 153, 141, // 3920-3927
-114, 106, 118, 131, 137, 137, 126, 123, // 3928-3935
-122, 124, 128, 134, 128, 121, 125, 136, // 3936-3943
-135, 129, 121, 120, 127, 135, 133, 129, // 3944-3951
-129, 126, 116, 115, 124, 131, 139, 136, // 3952-3959
-126, 119, 114, 117, 129, 139, 139, 129, // 3960-3967
-119, 118, 128, 135, 134, 128, 120, 121, // 3968-3975
-127, 131, 131, 127, 126, 131, 129, 125, // 3976-3983
-118, 123, 130, 138, 133, 131, 125, 121, // 3984-3991
-124, 135, 137, 139, 125, 112, 109, 116, // 3992-3999
-115, 114, 115, 130, 141, 150, 144, 133, // 4000-4007
-125, 124, 130, 129, 128, 122, 123, 131, // 4008-4015
-138, 129, 116, 113, 124, 136, 140, 125, // 4016-4023
-113, 111, 129, 146, 156, 142, 116,  89, // 4024-4031
- 96, 126, 156, 154, 119,  75,  72, 115, // 4032-4039
-168, 192, 171, 130, 106, 110, 125, 142, // 4040-4047
-143, 129, 119, 115, 112, 119, 130, 126, // 4048-4055
-124, 123, 122, 128, 133, 126, 117, 113, // 4056-4063
-123, 135, 150, 149, 130, 104, 106, 121, // 4064-4071
-145, 155, 143, 116, 111, 113, 124, 144, // 4072-4079
-148, 127, 109, 105, 120, 143, 146, 125, // 4080-4087
-112, 113, 128, 137, 135, 129, 126, 128, // 4088-4095
-136, 133, 119, 108, 109, 126, 143, 140, // 4096-4103
-123, 119, 128, 145, 145, 133, 111, 110, // 4104-4111
-120, 140, 141, 130, 112, 106, 115, 138, // 4112-4119
-149, 144, 122, 103, 102, 131, 154, 154, // 4120-4127
-130, 113, 110, 130, 151, 158, 144, 112, // 4128-4135
- 79,  82, 116, 148, 146, 122, 108, 123, // 4136-4143
-147, 154, 134, 113, 109, 123, 136, 141, // 4144-4151
-134, 125, 125, 131, 141, 140, 136, 118, // 4152-4159
-108, 108, 126, 138, 139, 125, 121, 116, // 4160-4167
-125, 124, 123, 113, 120, 116, 127, 138, // 4168-4175
-150, 138, 130, 122, 131, 136, 141, 127, // 4176-4183
-115, 114, 123, 126, 130, 130, 126, 124, // 4184-4191
-132, 138, 136, 129, 119, 112, 115, 125, // 4192-4199
-132, 131, 127, 120, 112, 115, 128, 143, // 4200-4207
-146, 140, 118, 110, 117, 140, 152, 150, // 4208-4215
-130, 115, 110, 122, 129, 135, 129, 131, // 4216-4223
-121, 113, 107, 122, 136, 145, 128, 108, // 4224-4231
-102, 124, 144, 153, 140, 130, 120, 127, // 4232-4239
-135, 139, 129, 121, 120, 126, 131, 127, // 4240-4247
-115, 111, 114, 124, 131, 139, 136, 125, // 4248-4255
-118, 121, 136, 150, 150, 128, 106,  98, // 4256-4263
-112, 132, 142, 135, 121, 120, 132, 141, // 4264-4271
-141, 130, 121, 116, 119, 132, 147, 150, // 4272-4279
-132, 102,  95, 112, 131, 131, 117, 113, // 4280-4287
-119, 122, 123, 134, 157, 172, 163, 127, // 4288-4295
-101, 106, 126, 139, 137, 125, 112, 109, // 4296-4303
-123, 133, 137, 133, 121, 111, 111, 121, // 4304-4311
-127, 128, 131, 127, 125, 130, 139, 139, // 4312-4319
-133, 130, 127, 130, 133, 130, 121, 121, // 4320-4327
-129, 135, 136, 135, 126, 124, 126, 125, // 4328-4335
-112, 107, 113, 126, 125, 116, 109, 119, // 4336-4343
-145, 166, 160, 137, 114,  99, 104, 130, // 4344-4351
-153, 151, 130, 110, 109, 129, 152, 150, // 4352-4359
-127, 106, 105, 115, 131, 144, 136, 113, // 4360-4367
- 99, 108, 130, 155, 161, 143, 125, 126, // 4368-4375
-136, 133, 117,  93,  85, 100, 133, 147, // 4376-4383
-135, 119, 115, 131, 152, 163, 146, 124, // 4384-4391
-117, 128, 136, 138, 132, 122, 110, 112, // 4392-4399
-122, 135, 136, 123, 112, 137, 180, 176, // 4400-4407
- 96,  32,  31, 105, 185, 207, 162, 104, // 4408-4415
- 86, 103, 137, 164, 165, 135, 101,  92, // 4416-4423
-116, 147, 168, 151, 124, 112, 127, 135, // 4424-4431
-132, 114, 103, 103, 123, 137, 139, 134, // 4432-4439
-132, 122, 115, 119, 132, 143, 146, 126, // 4440-4447
- 97,  82,  96, 128, 156, 159, 136, 107, // 4448-4455
-103, 132, 173, 192, 171, 114,  67,  72, // 4456-4463
-121, 171, 174, 135,  90,  87, 120, 151, // 4464-4471
-150, 127, 100,  95, 106, 122, 132, 134, // 4472-4479
-129, 121, 120, 127, 143, 151, 147, 133, // 4480-4487
-127, 126, 130, 125, 120, 118, 130, 140, // 4488-4495
-146, 143, 140, 133, 123, 106,  97,  92, // 4496-4503
-100, 116, 134, 143, 141, 127, 123, 131, // 4504-4511
-145, 147, 137, 121, 112, 115, 123, 133, // 4512-4519
-133, 127, 116, 109, 115, 137, 154, 159, // 4520-4527
-142, 121, 112, 122, 137, 143, 136, 119, // 4528-4535
-104, 101, 109, 125, 139, 145, 134, 120, // 4536-4543
-109, 111, 121, 137, 145, 138, 125, 117, // 4544-4551
-119, 136, 147, 145, 126, 115, 114, 128, // 4552-4559
-140, 143, 127, 112, 109, 119, 130, 138, // 4560-4567
-135, 127, 117, 118, 119, 124, 129, 136, // 4568-4575
-132, 133, 130, 134, 132, 138, 126, 116, // 4576-4583
-105, 116, 121, 134, 140, 142, 127, 116, // 4584-4591
-110, 114, 129, 142, 141, 129, 121, 121, // 4592-4599
-123, 136, 145, 132, 116, 110, 117, 126, // 4600-4607
-139, 142, 141, 135, 136, 130, 143, 152, // 4608-4615
-145,  84,  49,  55, 111, 163, 188, 156, // 4616-4623
-121,  99, 111, 126, 151, 154, 140, 119, // 4624-4631
-119, 124, 131, 132, 127, 118, 120, 129, // 4632-4639
-137, 135, 130, 114, 102, 117, 146, 162, // 4640-4647
-149, 119,  91,  98, 127, 154, 148, 126, // 4648-4655
-107, 112, 123, 129, 114, 104, 113, 139, // 4656-4663
-158, 161, 141, 123, 115, 130, 140, 141, // 4664-4671
-127, 112, 106, 115, 125, 133, 128, 129, // 4672-4679
-127, 128, 126, 126, 127, 128, 133, 130, // 4680-4687
-126, 122, 123, 123, 124, 127, 130, 136, // 4688-4695
-138, 131, 119, 111, 118, 124, 133, 138, // 4696-4703
-140, 137, 131, 115, 111, 116, 133, 143, // 4704-4711
-140, 127, 115, 115, 125, 139, 146, 138, // 4712-4719
-124, 110, 112, 120, 126, 124, 120, 119, // 4720-4727
-126, 128, 128, 128, 129, 136, 140, 145, // 4728-4735
-142, 138, 128, 116, 108, 107, 115, 124, // 4736-4743
-135, 143, 143, 133, 119, 113, 119, 135, // 4744-4751
-141, 131, 117, 119, 128, 137, 127, 113, // 4752-4759
-102, 114, 130, 140, 130, 123, 122, 136, // 4760-4767
-147, 152, 133, 116, 107, 121, 137, 149, // 4768-4775
-140, 126, 114, 125, 140, 155, 152, 130, // 4776-4783
- 87,  64,  68, 102, 146, 168, 151, 117, // 4784-4791
- 98, 113, 147, 177, 177, 145, 109,  91, // 4792-4799
-104, 132, 155, 151, 121,  94,  94, 120, // 4800-4807
-153, 166, 145, 107,  88,  98, 128, 154, // 4808-4815
-158, 130, 105,  99, 126, 153, 164, 138, // 4816-4823
-107,  94, 114, 137, 138, 121, 103, 104, // 4824-4831
-128, 149, 157, 143, 125, 109, 108, 127, // 4832-4839
-148, 156, 143, 122, 105, 111, 128, 143, // 4840-4847
-139, 127, 113, 107, 111, 123, 133, 136, // 4848-4855
-135, 128, 123, 123, 127, 133, 130, 125, // 4856-4863
-116, 117, 128, 142, 142, 135, 124, 118, // 4864-4871
-123, 132, 134, 133, 126, 122, 120, 122, // 4872-4879
-125, 129, 130, 130, 125, 122, 123, 126, // 4880-4887
-132, 134, 133, 132, 132, 131, 127, 121, // 4888-4895
-120, 120, 124, 123, 119, 112, 117, 125, // 4896-4903
-136, 141, 142, 134, 125, 124, 128, 134, // 4904-4911
-137, 133, 123, 122, 128, 134, 132, 125, // 4912-4919
-119, 122, 125, 124, 112, 112, 131, 151, // 4920-4927
-148, 129, 104, 100, 117, 138, 138, 125, // 4928-4935
-117, 121, 132, 139, 134, 123, 119, 131, // 4936-4943
-144, 152, 148, 129, 114, 113, 125, 133, // 4944-4951
-133, 121, 104, 104, 120, 138, 141, 132, // 4952-4959
-116, 109, 120, 141, 147, 140, 125, 114, // 4960-4967
-113, 121, 135, 137, 134, 123, 114, 112, // 4968-4975
-128, 142, 150, 142, 131, 118, 120, 128, // 4976-4983
-134, 135, 132, 121, 112, 113, 130, 152, // 4984-4991
-160, 140,  97,  67,  70, 100, 137, 154, // 4992-4999
-150, 132, 120, 119, 134, 155, 169, 164, // 5000-5007
-138, 116, 103, 109, 121, 136, 136, 138, // 5008-5015
-131, 128, 123, 126, 119, 106,  89,  98, // 5016-5023
-117, 151, 159, 144, 108,  96, 101, 129, // 5024-5031
-155, 163, 140, 114, 101, 115, 145, 174, // 5032-5039
-165, 131, 104, 104, 121, 144, 152, 155, // 5040-5047
-153, 156, 120,  58,  22,  37,  99, 171, // 5048-5055
-203, 162, 106,  76,  95, 144, 200, 205, // 5056-5063
-162, 102,  76,  80, 129, 168, 174, 137, // 5064-5071
-108,  88,  99, 129, 159, 152, 132, 109, // 5072-5079
- 99, 109, 139, 147, 136, 119, 108, 102, // 5080-5087
-113, 125, 136, 140, 149, 142, 130, 122, // 5088-5095
-124, 124, 131, 131, 122, 109, 112, 123, // 5096-5103
-142, 159, 155, 125, 103, 106, 126, 151, // 5104-5111
-155, 140, 118, 114, 114, 103,  93, 101, // 5112-5119
-121, 147, 157, 144, 126, 127, 131, 133, // 5120-5127
-122, 112, 110, 127, 145, 153, 140, 128, // 5128-5135
-118, 122, 132, 139, 134, 120, 109, 106, // 5136-5143
-110, 122, 132, 136, 138, 135, 127, 120, // 5144-5151
-115, 118, 124, 134, 138, 140, 137, 136, // 5152-5159
-132, 127, 123, 121, 121, 125, 128, 127, // 5160-5167
-123, 120, 122, 124, 129, 135, 135, 131, // 5168-5175
-123, 113, 110, 118, 130, 132, 126, 124, // 5176-5183
-129, 145, 159, 157, 137, 119, 113, 121, // 5184-5191
-133, 141, 133, 116, 105, 100, 105, 115, // 5192-5199
-123, 129, 129, 131, 130, 128, 131, 137, // 5200-5207
-140, 142, 129, 113, 103, 117, 139, 157, // 5208-5215
-153, 138, 122, 123, 131, 135, 129, 127, // 5216-5223
-124, 126, 118, 106,  95, 104, 121, 134, // 5224-5231
-133, 126, 119, 128, 137, 142, 137, 127, // 5232-5239
-120, 120, 129, 144, 150, 147, 132, 120, // 5240-5247
-114, 123, 134, 137, 128, 117, 109, 110, // 5248-5255
-121, 127, 130, 127, 128, 126, 130, 128, // 5256-5263
-129, 128, 132, 128, 123, 114, 113, 117, // 5264-5271
-131, 142, 145, 138, 127, 119, 118, 124, // 5272-5279
-137, 141, 138, 126, 118, 117, 126, 138, // 5280-5287
-140, 137, 128, 123, 122, 126, 123, 116, // 5288-5295
-109, 107, 114, 126, 138, 137, 129, 118, // 5296-5303
-110, 105, 115, 137, 163, 174, 159, 119, // 5304-5311
- 88,  91, 127, 165, 176, 155, 119,  95, // 5312-5319
- 99, 115, 140, 154, 157, 134, 106,  80, // 5320-5327
- 80,  97, 131, 151, 150, 128, 109,  94, // 5328-5335
-107, 132, 159, 158, 149, 128, 123, 130, // 5336-5343
-146, 142, 137, 132, 130, 119, 117, 127, // 5344-5351
-160, 187, 184, 110,  32,  14,  57, 147, // 5352-5359
-211, 214, 149,  84,  52,  75, 130, 188, // 5360-5367
-200, 168, 115,  79,  79, 123, 171, 185, // 5368-5375
-157, 115,  79,  78, 109, 148, 161, 151, // 5376-5383
-120,  99, 100, 129, 151, 154, 133, 111, // 5384-5391
- 97, 112, 135, 146, 143, 129, 114, 108, // 5392-5399
-118, 133, 139, 138, 129, 117, 116, 125, // 5400-5407
-138, 142, 141, 130, 121, 117, 125, 131, // 5408-5415
-136, 131, 121, 112, 119, 128, 137, 135, // 5416-5423
-128, 118, 114, 120, 127, 133, 138, 135, // 5424-5431
-125, 120, 118, 126, 132, 138, 132, 126, // 5432-5439
-120, 123, 126, 136, 138, 137, 127, 119, // 5440-5447
-116, 123, 132, 138, 133, 122, 111, 107, // 5448-5455
-116, 132, 141, 142, 132, 125, 122, 132, // 5456-5463
-137, 134, 119, 111, 110, 124, 137, 143, // 5464-5471
-134, 125, 118, 122, 128, 135, 134, 128, // 5472-5479
-118, 114, 118, 130, 141, 142, 130, 121, // 5480-5487
-113, 115, 125, 139, 144, 149, 140, 128, // 5488-5495
-113, 109, 107, 113, 121, 134, 137, 134, // 5496-5503
-120, 107, 106, 128, 148, 158, 148, 131, // 5504-5511
-114, 111, 119, 128, 140, 141, 130, 112, // 5512-5519
-111, 120, 139, 145, 140, 135, 150, 166, // 5520-5527
-153,  91,  37,  25,  82, 169, 228, 210, // 5528-5535
-142,  71,  47,  80, 143, 187, 187, 148, // 5536-5543
-100,  78,  98, 138, 172, 169, 144, 103, // 5544-5551
- 85,  93, 127, 153, 167, 149, 125, 104, // 5552-5559
-108, 118, 133, 135, 137, 124, 118, 102, // 5560-5567
- 98, 104, 135, 154, 161, 141, 120, 102, // 5568-5575
-111, 127, 147, 150, 149, 126, 113, 107, // 5576-5583
-121, 133, 144, 136, 123, 111, 111, 115, // 5584-5591
-123, 134, 140, 135, 124, 122, 138, 169, // 5592-5599
-180, 149,  73,  43,  50, 124, 184, 213, // 5600-5607
-167, 111,  64,  79, 116, 171, 184, 166, // 5608-5615
-114,  83,  74, 112, 151, 176, 155, 127, // 5616-5623
- 94,  91, 109, 139, 152, 152, 137, 123, // 5624-5631
-112, 115, 120, 128, 134, 136, 135, 127, // 5632-5639
-122, 114, 115, 125, 138, 142, 141, 128, // 5640-5647
-117, 107, 113, 123, 136, 144, 139, 124, // 5648-5655
-112, 112, 125, 136, 142, 133, 122, 115, // 5656-5663
-120, 127, 135, 137, 134, 127, 124, 123, // 5664-5671
-126, 132, 135, 132, 126, 120, 116, 120, // 5672-5679
-126, 134, 133, 131, 124, 120, 122, 124, // 5680-5687
-127, 127, 126, 122, 123, 126, 133, 135, // 5688-5695
-134, 128, 123, 121, 126, 130, 135, 133, // 5696-5703
-132, 125, 125, 126, 134, 140, 142, 127, // 5704-5711
-111,  95, 100, 118, 145, 155, 150, 126, // 5712-5719
-109, 102, 114, 131, 144, 143, 132, 119, // 5720-5727
-113, 118, 128, 135, 137, 129, 125, 124, // 5728-5735
-130, 136, 138, 132, 127, 120, 120, 121, // 5736-5743
-126, 127, 128, 126, 126, 126, 130, 132, // 5744-5751
-133, 129, 125, 121, 122, 124, 125, 128, // 5752-5759
-126, 125, 122, 124, 126, 129, 132, 130, // 5760-5767
-126, 126, 126, 130, 134, 132, 131, 128, // 5768-5775
-129, 127, 129, 127, 123, 119, 117, 120, // 5776-5783
-127, 136, 142, 139, 127, 113, 110, 115, // 5784-5791
-131, 139, 141, 132, 123, 121, 123, 130, // 5792-5799
-131, 132, 128, 126, 121, 118, 117, 120, // 5800-5807
-128, 137, 138, 133, 122, 118, 122, 134, // 5808-5815
-143, 143, 134, 124, 118, 123, 126, 131, // 5816-5823
-125, 122, 118, 122, 126, 132, 132, 129, // 5824-5831
-127, 125, 124, 126, 128, 129, 127, 125, // 5832-5839
-121, 121, 123, 125, 131, 132, 133, 130, // 5840-5847
-128, 127, 131, 133, 135, 131, 126, 120, // 5848-5855
-118, 121, 130, 137, 143, 134, 119, 102, // 5856-5863
-101, 115, 135, 150, 147, 132, 114, 109, // 5864-5871
-115, 133, 144, 145, 133, 120, 112, 116, // 5872-5879
-127, 139, 140, 134, 122, 116, 116, 124, // 5880-5887
-132, 136, 135, 128, 123, 123, 126, 133, // 5888-5895
-133, 132, 127, 125, 123, 123, 118, 120, // 5896-5903
-126, 135, 139, 132, 119, 109, 111, 124, // 5904-5911
-135, 140, 136, 127, 124, 125, 130, 132, // 5912-5919
-134, 131, 126, 123, 123, 125, 128, 129, // 5920-5927
-125, 121, 121, 126, 131, 134, 131, 125, // 5928-5935
-120, 120, 125, 130, 133, 132, 128, 124, // 5936-5943
-123, 125, 130, 134, 135, 133, 129, 123, // 5944-5951
-124, 128, 135, 135, 131, 126, 125, 131, // 5952-5959
-131, 122,  99,  91, 101, 128, 152, 157, // 5960-5967
-142, 121, 111, 113, 126, 137, 142, 139, // 5968-5975
-130, 121, 115, 117, 128, 136, 138, 131, // 5976-5983
-122, 119, 122, 128, 133, 140, 148, 154, // 5984-5991
-147, 124,  92,  76,  84, 116, 148, 161, // 5992-5999
-149, 123, 101, 104, 122, 150, 162, 154, // 6000-6007
-130, 107, 100, 113, 132, 147, 146, 133, // 6008-6015
-115, 106, 110, 126, 142, 150, 139, 128, // 6016-6023
-117, 126, 139, 150, 133, 102,  76,  78, // 6024-6031
-114, 158, 181, 169, 131,  93,  85, 106, // 6032-6039
-141, 165, 163, 137, 108,  91, 104, 128, // 6040-6047
-152, 156, 141, 115, 100, 100, 118, 136, // 6048-6055
-148, 142, 130, 116, 117, 124, 138, 142, // 6056-6063
-136, 123, 114, 113, 123, 134, 140, 134, // 6064-6071
-128, 121, 121, 127, 134, 139, 137, 130, // 6072-6079
-118, 110, 109, 116, 129, 139, 142, 134, // 6080-6087
-122, 113, 113, 121, 133, 140, 139, 132, // 6088-6095
-120, 116, 118, 129, 136, 139, 136, 130, // 6096-6103
-128, 132, 134, 135, 126, 115, 106, 106, // 6104-6111
-115, 129, 139, 142, 133, 122, 116, 121, // 6112-6119
-129, 140, 137, 131, 120, 119, 124, 133, // 6120-6127
-137, 135, 128, 123, 122, 123, 126, 129, // 6128-6135
-126, 127, 124, 123, 122, 122, 124, 128, // 6136-6143
-133, 134, 135, 132, 132, 130, 130, 127, // 6144-6151
-127, 123, 125, 125, 128, 127, 126, 129, // 6152-6159
-134, 136, 131, 113,  96,  91, 109, 136, // 6160-6167
-159, 161, 144, 116, 102, 103, 124, 144, // 6168-6175
-153, 146, 129, 112, 108, 117, 132, 144, // 6176-6183
-142, 133, 118, 110, 114, 124, 135, 139, // 6184-6191
-133, 125, 117, 118, 122, 130, 132, 133, // 6192-6199
-129, 126, 124, 128, 131, 137, 138, 139, // 6200-6207
-132, 127, 121, 121, 118, 119, 116, 114, // 6208-6215
-117, 122, 131, 136, 137, 133, 127, 123, // 6216-6223
-123, 125, 131, 134, 133, 130, 123, 122, // 6224-6231
-123, 128, 131, 132, 127, 125, 123, 124, // 6232-6239
-127, 128, 127, 127, 126, 127, 126, 124, // 6240-6247
-124, 126, 131, 134, 133, 130, 130, 142, // 6248-6255
-152, 155, 134,  94,  65,  63, 102, 151, // 6256-6263
-185, 176, 140,  98,  86, 104, 140, 167, // 6264-6271
-167, 142, 110,  90,  93, 113, 139, 154, // 6272-6279
-153, 132, 114, 101, 108, 126, 144, 149, // 6280-6287
-139, 118, 108, 110, 125, 141, 147, 141, // 6288-6295
-130, 118, 118, 123, 136, 145, 150, 143, // 6296-6303
-124, 103,  88,  95, 115, 142, 152, 145, // 6304-6311
-123, 107, 104, 121, 139, 152, 146, 134, // 6312-6319
-115, 112, 112, 128, 135, 145, 137, 133, // 6320-6327
-120, 123, 128, 142, 143, 136, 111,  97, // 6328-6335
- 92, 113, 133, 153, 145, 133, 111, 110, // 6336-6343
-114, 133, 141, 145, 137, 128, 118, 116, // 6344-6351
-120, 130, 140, 143, 136, 122, 110, 111, // 6352-6359
-124, 135, 142, 132, 120, 112, 120, 128, // 6360-6367
-135, 127, 127, 131, 155, 164, 165, 114, // 6368-6375
- 72,  42,  72, 124, 185, 195, 174, 116, // 6376-6383
- 82,  75, 113, 149, 178, 165, 139,  99, // 6384-6391
- 87,  94, 122, 149, 163, 152, 127, 103, // 6392-6399
- 96, 107, 132, 151, 151, 137, 115, 104, // 6400-6407
-108, 125, 140, 147, 140, 127, 116, 116, // 6408-6415
-123, 136, 140, 141, 131, 121, 116, 120, // 6416-6423
-127, 140, 143, 140, 126, 110,  97,  95, // 6424-6431
-103, 125, 144, 156, 149, 133, 110, 105, // 6432-6439
-111, 133, 148, 153, 140, 123, 109, 111, // 6440-6447
-122, 141, 150, 151, 142, 131, 119, 112, // 6448-6455
-105, 107, 110, 122, 132, 141, 138, 132, // 6456-6463
-120, 116, 115, 126, 135, 143, 140, 134, // 6464-6471
-123, 120, 122, 128, 135, 135, 131, 121, // 6472-6479
-116, 114, 122, 128, 134, 131, 127, 122, // 6480-6487
-124, 128, 136, 138, 139, 131, 126, 120, // 6488-6495
-121, 123, 128, 129, 128, 126, 123, 122, // 6496-6503
-123, 123, 127, 127, 129, 129, 130, 129, // 6504-6511
-127, 126, 124, 124, 126, 127, 129, 129, // 6512-6519
-130, 131, 129, 130, 129, 130, 129, 131, // 6520-6527
-128, 126, 118, 116, 116, 125, 134, 140, // 6528-6535
-136, 126, 112, 110, 117, 133, 146, 147, // 6536-6543
-138, 122, 110, 110, 118, 133, 142, 141, // 6544-6551
-133, 121, 115, 115, 125, 133, 140, 138, // 6552-6559
-134, 130, 131, 136, 139, 132, 117, 102, // 6560-6567
- 93, 101, 119, 139, 151, 149, 133, 119, // 6568-6575
-110, 115, 127, 138, 145, 141, 132, 120, // 6576-6583
-115, 116, 125, 133, 140, 136, 129, 117, // 6584-6591
-115, 116, 127, 134, 136, 132, 129, 131, // 6592-6599
-140, 146, 145, 124,  98,  80,  84, 110, // 6600-6607
-145, 170, 171, 148, 115,  93,  93, 112, // 6608-6615
-140, 158, 158, 142, 119, 103, 104, 118, // 6616-6623
-138, 150, 148, 133, 114, 104, 107, 122, // 6624-6631
-138, 146, 141, 129, 115, 111, 114, 127, // 6632-6639
-135, 141, 135, 126, 118, 116, 122, 131, // 6640-6647
-138, 138, 133, 124, 117, 118, 124, 132, // 6648-6655
-137, 135, 131, 125, 125, 127, 130, 131, // 6656-6663
-129, 123, 116, 113, 113, 118, 126, 135, // 6664-6671
-141, 140, 135, 125, 119, 116, 122, 129, // 6672-6679
-134, 137, 131, 125, 120, 119, 125, 132, // 6680-6687
-137, 139, 134, 133, 129, 131, 131, 130, // 6688-6695
-122, 116, 107, 107, 111, 121, 132, 139, // 6696-6703
-140, 136, 127, 123, 121, 126, 130, 136, // 6704-6711
-137, 133, 125, 121, 119, 122, 128, 131, // 6712-6719
-132, 127, 123, 121, 124, 128, 134, 135, // 6720-6727
-134, 130, 127, 125, 127, 127, 129, 127, // 6728-6735
-125, 122, 119, 120, 122, 126, 127, 130, // 6736-6743
-127, 127, 127, 127, 130, 132, 132, 131, // 6744-6751
-128, 127, 127, 127, 125, 125, 125, 124, // 6752-6759
-127, 127, 130, 128, 129, 126, 128, 126, // 6760-6767
-128, 127, 126, 125, 126, 126, 129, 128, // 6768-6775
-130, 127, 124, 121, 122, 126, 130, 134, // 6776-6783
-135, 129, 126, 122, 124, 127, 133, 133, // 6784-6791
-132, 126, 125, 124, 128, 130, 130, 129, // 6792-6799
-125, 123, 122, 122, 123, 122, 121, 121, // 6800-6807
-121, 127, 130, 134, 133, 132, 130, 130, // 6808-6815
-136, 141, 142, 136, 120, 107,  98, 105, // 6816-6823
-119, 137, 148, 146, 135, 121, 113, 112, // 6824-6831
-121, 132, 139, 142, 136, 127, 117, 114, // 6832-6839
-118, 129, 138, 141, 135, 123, 115, 115, // 6840-6847
-123, 134, 137, 134, 127, 121, 121, 125, // 6848-6855
-129, 130, 133, 136, 146, 152, 148, 124, // 6856-6863
- 96,  76,  80, 105, 137, 161, 163, 147, // 6864-6871
-122, 107, 107, 121, 139, 149, 148, 135, // 6872-6879
-118, 108, 107, 119, 134, 146, 144, 135, // 6880-6887
-119, 108, 110, 120, 134, 143, 140, 133, // 6888-6895
-121, 118, 119, 126, 134, 138, 134, 128, // 6896-6903
-122, 120, 121, 125, 127, 130, 129, 127, // 6904-6911
-126, 126, 127, 128, 130, 132, 134, 134, // 6912-6919
-130, 123, 114, 108, 110, 120, 136, 145, // 6920-6927
-146, 136, 122, 114, 115, 123, 135, 140, // 6928-6935
-138, 128, 118, 114, 118, 125, 136, 138, // 6936-6943
-138, 132, 128, 130, 136, 142, 139, 126, // 6944-6951
-107,  92,  91, 104, 129, 148, 159, 149, // 6952-6959
-131, 113, 106, 114, 130, 144, 149, 142, // 6960-6967
-128, 115, 110, 114, 124, 135, 140, 137, // 6968-6975
-129, 118, 111, 113, 122, 135, 142, 141, // 6976-6983
-129, 118, 116, 127, 147, 161, 157, 129, // 6984-6991
- 92,  69,  70, 105, 145, 179, 178, 155, // 6992-6999
-116,  94,  90, 112, 139, 158, 157, 140, // 7000-7007
-116, 102, 100, 116, 133, 150, 148, 139, // 7008-7015
-120, 108, 106, 119, 133, 145, 144, 134, // 7016-7023
-120, 111, 113, 122, 135, 142, 141, 133, // 7024-7031
-124, 117, 116, 122, 130, 135, 136, 132, // 7032-7039
-125, 119, 119, 123, 130, 134, 134, 130, // 7040-7047
-127, 127, 132, 133, 131, 119, 110, 106, // 7048-7055
-114, 127, 142, 147, 141, 127, 114, 109, // 7056-7063
-116, 129, 139, 144, 138, 128, 117, 115, // 7064-7071
-119, 132, 141, 148, 144, 135, 121, 113, // 7072-7079
-109, 115, 121, 129, 130, 130, 122, 119, // 7080-7087
-117, 122, 127, 136, 139, 136, 131, 126, // 7088-7095
-122, 123, 125, 130, 133, 130, 127, 120, // 7096-7103
-118, 118, 125, 130, 136, 136, 132, 126, // 7104-7111
-124, 125, 130, 134, 135, 132, 126, 121, // 7112-7119
-119, 121, 126, 129, 129, 127, 123, 121, // 7120-7127
-122, 125, 128, 131, 131, 128, 127, 125, // 7128-7135
-125, 127, 128, 130, 128, 127, 125, 125, // 7136-7143
-126, 127, 130, 130, 129, 128, 127, 127, // 7144-7151
-127, 130, 129, 131, 128, 128, 124, 125, // 7152-7159
-125, 129, 131, 131, 128, 121, 114, 112, // 7160-7167
-116, 125, 136, 142, 143, 138, 128, 122, // 7168-7175
-119, 121, 127, 130, 132, 129, 125, 122, // 7176-7183
-119, 121, 125, 131, 133, 133, 130, 126, // 7184-7191
-128, 131, 139, 144, 142, 133, 116, 100, // 7192-7199
- 94,  98, 114, 131, 147, 151, 145, 134, // 7200-7207
-122, 115, 116, 122, 133, 139, 139, 133, // 7208-7215
-124, 118, 116, 119, 128, 133, 137, 133, // 7216-7223
-126, 119, 118, 121, 130, 135, 138, 131, // 7224-7231
-124, 117, 119, 127, 138, 144, 142, 129, // 7232-7239
-115, 105, 108, 118, 132, 141, 141, 133, // 7240-7247
-124, 118, 118, 123, 131, 135, 134, 129, // 7248-7255
-124, 121, 121, 125, 128, 133, 133, 130, // 7256-7263
-127, 123, 122, 124, 128, 131, 131, 130, // 7264-7271
-126};// 7272-7272
-
-
-#define KAPOW_N 5352
-const uint8_t kapow[KAPOW_N] = {
-121, 114, 143, 165, 106,  24, 151, 233, // 0-7
-142,  59,  98, 214, 163,  61,  69, 155, // 8-15
-194, 107,  61, 134, 189, 134,  38, 126, // 16-23
-203, 186,  78,  83,  88, 195, 160, 117, // 24-31
- 89,  78, 169, 223,  51,  69, 208, 153, // 32-39
- 31, 111, 165, 183, 128,  57, 139, 177, // 40-47
-123,  88,  99, 150, 164, 122, 132, 135, // 48-55
-135,  89,  98, 167, 180, 113, 102,  59, // 56-63
-139, 137, 165, 185, 119,  21, 116, 174, // 64-71
-193,  82, 108, 164, 167,  64,  87, 158, // 72-79
-202,  87,  37, 127, 198, 144, 109, 110, // 80-87
-162, 167,  95, 107, 147, 133, 104, 114, // 88-95
-125, 134, 108, 136, 151, 130, 106, 104, // 96-103
-138, 160, 141, 147, 111, 115, 134, 131, // 104-111
- 96, 108, 135, 151, 121,  99, 145, 171, // 112-119
-126,  81, 119, 183, 140, 100, 112, 147, // 120-127
-146, 114,  95, 149, 162, 119, 113, 135, // 128-135
-144, 112, 109, 147, 126, 126, 116, 109, // 136-143
-136, 137, 136, 144, 117, 126, 121, 118, // 144-151
-129, 127, 131, 150, 125, 109, 118, 129, // 152-159
-128, 110, 105, 134, 119,  88, 110, 162, // 160-167
-162, 133, 138, 151, 148, 126,  97, 108, // 168-175
-144, 113,  95, 125, 138, 107, 125, 130, // 176-183
-155, 138, 129, 129, 143, 141, 130, 119, // 184-191
-123, 151, 136, 112, 110, 131, 153, 134, // 192-199
-115, 147, 148, 125, 113, 121, 133, 149, // 200-207
-124,  98, 132, 136, 128, 121, 135, 141, // 208-215
-126, 115, 112, 124, 128, 102, 127, 124, // 216-223
-121, 104, 132, 132, 115, 113, 126, 139, // 224-231
-139, 128, 123, 142, 135, 129, 138, 151, // 232-239
-134, 138, 130, 114, 110, 147, 135, 135, // 240-247
- 90,  92, 118, 115,  63,  76, 129, 161, // 248-255
-117, 127, 138, 159, 174, 180, 148, 177, // 256-263
-160, 164, 150, 157, 145, 143, 116, 178, // 264-271
- 97,   4,  34,  92,  64,  13,  34, 117, // 272-279
-210, 208, 154, 143, 190, 182, 167, 131, // 280-287
-143, 183, 181, 147, 107, 134, 170, 188, // 288-295
-138,  13,  69, 105,  88,  57,  80,  82, // 296-303
-177, 197, 154, 133, 158, 153, 167, 143, // 304-311
-127, 143, 161, 138, 115, 106, 131, 188, // 312-319
-180, 145,  61,  38,  90,  72,  51,  45, // 320-327
- 78, 130, 192, 171, 146, 145, 162, 153, // 328-335
-160, 138, 145, 160, 159, 121, 121, 127, // 336-343
-162, 198, 184, 107,  25,  59,  77,  58, // 344-351
- 55,  41,  75, 188, 216, 186, 153, 132, // 352-359
-145, 175, 151, 130, 142, 149, 147, 139, // 360-367
-127, 139, 184, 188, 157,  28,  12,  41, // 368-375
- 79,  82,  67,  26, 149, 238, 230, 170, // 376-383
-117,  98, 173, 187, 149, 118, 117, 129, // 384-391
-170, 169, 158, 170, 166, 110,   7,  19, // 392-399
- 26,  71, 107,  87,  73, 193, 211, 212, // 400-407
-168,  97, 102, 174, 171, 159, 115,  99, // 408-415
-142, 179, 179, 185, 172, 154,  23,  28, // 416-423
- 26,  34,  72,  79,  49, 162, 233, 229, // 424-431
-204, 127,  86, 141, 170, 155, 139, 109, // 432-439
-124, 165, 180, 185, 170, 148,  59,   7, // 440-447
- 44,  13,  67,  75,  68, 154, 220, 227, // 448-455
-211, 136,  75, 114, 147, 161, 149, 125, // 456-463
-121, 157, 182, 194, 182, 178,  88,   4, // 464-471
- 23,  23,  85, 100,  85, 127, 195, 209, // 472-479
-193, 158, 116, 121, 148, 170, 153, 155, // 480-487
-163, 172, 142, 151, 125, 134,  71,   5, // 488-495
- 20,  43, 103, 110, 130, 130, 187, 200, // 496-503
-209, 136, 108,  96, 126, 169, 170, 160, // 504-511
-150, 153, 140, 143, 143, 150,  91,  55, // 512-519
- 14,  11,  36,  95, 133, 135, 130, 116, // 520-527
-103, 147, 220, 141, 130, 185, 235, 221, // 528-535
-193, 169, 189, 204, 237, 222, 119,  14, // 536-543
- 16,  53, 120, 163, 131,  84,  82,  80, // 544-551
-121, 167, 168, 172, 158, 151, 152, 149, // 552-559
-134, 138, 122,  75,  44,  68,  67, 118, // 560-567
-179, 137, 160, 166, 167, 166, 150, 157, // 568-575
-138, 138, 125, 126, 167, 183, 181,  58, // 576-583
-  4,  73, 126, 154, 165, 181, 139, 109, // 584-591
-116, 103,  88,  83,  97, 123, 133, 134, // 592-599
-125, 128, 129, 143, 151, 151, 132, 129, // 600-607
-132, 132, 127, 129, 128, 123, 112, 112, // 608-615
-113, 119, 122, 128, 128, 132, 133, 135, // 616-623
-134, 135, 133, 134, 132, 132, 133, 136, // 624-631
-135, 137, 134, 136, 133, 132, 133, 129, // 632-639
-117, 114, 112, 112, 114, 122, 127, 130, // 640-647
-133, 133, 130, 128, 128, 129, 131, 132, // 648-655
-131, 131, 131, 130, 130, 130, 130, 130, // 656-663
-129, 127, 126, 124, 122, 122, 122, 122, // 664-671
-122, 122, 123, 125, 127, 128, 128, 128, // 672-679
-129, 128, 128, 128, 128, 128, 128, 128, // 680-687
-127, 126, 126, 126, 127, 127, 127, 128, // 688-695
-128, 127, 128, 128, 128, 128, 128, 127, // 696-703
-127, 127, 127, 127, 128, 127, 127, 127, // 704-711
-128, 127, 128, 127, 127, 127, 127, 127, // 712-719
-128, 128, 129, 128, 129, 129, 130, 130, // 720-727
-130, 130, 130, 130, 130, 129, 129, 128, // 728-735
-127, 127, 126, 125, 125, 125, 125, 124, // 736-743
-125, 125, 126, 126, 126, 126, 128, 128, // 744-751
-129, 129, 129, 129, 130, 129, 129, 129, // 752-759
-129, 128, 128, 128, 128, 127, 128, 128, // 760-767
-129, 128, 129, 128, 127, 126, 127, 127, // 768-775
-127, 128, 128, 128, 128, 127, 127, 126, // 776-783
-126, 126, 126, 126, 127, 127, 126, 125, // 784-791
-125, 127, 128, 128, 127, 128, 129, 130, // 792-799
-129, 129, 129, 129, 129, 128, 127, 127, // 800-807
-127, 127, 127, 127, 127, 128, 128, 127, // 808-815
-127, 127, 126, 127, 127, 128, 128, 129, // 816-823
-129, 129, 128, 128, 128, 128, 128, 128, // 824-831
-128, 128, 128, 128, 128, 128, 128, 128, // 832-839
-127, 128, 128, 128, 127, 127, 127, 127, // 840-847
-127, 127, 127, 127, 127, 128, 127, 127, // 848-855
-127, 127, 127, 127, 127, 127, 127, 127, // 856-863
-128, 128, 128, 127, 127, 128, 128, 128, // 864-871
-128, 128, 128, 129, 129, 128, 127, 126, // 872-879
-123, 124, 126, 126, 127, 127, 128, 128, // 880-887
-128, 128, 128, 129, 129, 129, 129, 129, // 888-895
-129, 129, 129, 129, 129, 128, 128, 128, // 896-903
-128, 128, 128, 128, 128, 127, 127, 127, // 904-911
-127, 127, 127, 126, 126, 126, 126, 125, // 912-919
-127, 126, 126, 128, 129, 128, 129, 129, // 920-927
-130, 128, 126, 125, 125, 126, 129, 129, // 928-935
-130, 128, 127, 127, 128, 128, 124, 127, // 936-943
-129, 131, 135, 134, 132, 129, 125, 124, // 944-951
-125, 126, 131, 131, 129, 127, 125, 124, // 952-959
-125, 127, 129, 128, 129, 126, 127, 127, // 960-967
-128, 127, 127, 128, 126, 122, 122, 121, // 968-975
-123, 126, 129, 131, 132, 130, 128, 126, // 976-983
-125, 115, 113, 122, 128, 130, 133, 124, // 984-991
-124, 127, 126, 125, 137, 152, 146, 126, // 992-999
-119, 117, 128, 134, 134, 137, 139, 128, // 1000-1007
-127, 128, 123, 126, 131, 131, 132, 132, // 1008-1015
-125, 113, 118, 135, 135, 131, 125, 113, // 1016-1023
-100, 106, 104,  89, 128, 176, 187, 152, // 1024-1031
-107, 131, 144, 150, 132, 136, 151, 143, // 1032-1039
-127, 130, 126, 130, 104,  86, 100, 125, // 1040-1047
-125, 124, 126, 130, 123, 126, 123, 124, // 1048-1055
-118, 120, 122, 127, 127, 130, 129, 132, // 1056-1063
-127, 131, 127, 130, 124, 126, 120, 129, // 1064-1071
-126, 130, 126, 128, 133, 134, 133, 133, // 1072-1079
-130, 131, 127, 131, 130, 132, 124, 121, // 1080-1087
-117, 113,  97,  86,  79,  96,  95, 107, // 1088-1095
- 95, 123, 196, 177, 208, 176, 174, 129, // 1096-1103
-166, 170, 196, 163, 131, 121, 135, 153, // 1104-1111
-152, 143, 130, 115, 104, 104, 103, 101, // 1112-1119
- 99,  99, 110, 129, 134, 119, 106,  79, // 1120-1127
- 67,  94, 116, 141, 141, 143, 108,  93, // 1128-1135
- 86, 121, 110,  34,  99, 203, 204, 210, // 1136-1143
-162, 136, 125, 117, 126, 100,  68,  74, // 1144-1151
- 89,  92, 119,  87, 131, 202, 251, 214, // 1152-1159
-158, 136, 154, 191, 178, 162, 146, 127, // 1160-1167
-124, 129, 124, 117, 111, 106, 112, 112, // 1168-1175
-118, 115, 117, 116, 117, 115, 117, 113, // 1176-1183
-123, 131, 141, 143, 141, 102,  81,  76, // 1184-1191
- 96, 108, 117, 106,  99,  84,  79,  82, // 1192-1199
-101,  99, 119, 114, 122, 105, 135, 210, // 1200-1207
-221, 184, 226, 191,  57, 113, 183, 189, // 1208-1215
-112, 105, 192, 168, 148, 176, 162, 116, // 1216-1223
- 65, 116, 128, 152, 101,  76,  71, 114, // 1224-1231
-153, 204, 166, 123,  97, 150, 131,  85, // 1232-1239
-170, 150, 137, 135, 121, 105,  97,  90, // 1240-1247
- 81,  83,  92,  93,  92, 103, 109, 137, // 1248-1255
-146, 134, 110,  74,  73,  89,  94,  96, // 1256-1263
-158, 225,  93, 109,  81, 207, 198, 154, // 1264-1271
-174, 163, 204, 169, 106, 113, 135, 137, // 1272-1279
-153,  79,  84,  92,  97, 115, 143, 106, // 1280-1287
- 99, 109, 159, 209, 161, 149, 149, 167, // 1288-1295
- 80,  80,  77, 175, 180, 124, 148, 200, // 1296-1303
-153, 104, 112, 151, 160, 112, 129,  50, // 1304-1311
- 67,  67,  89,  80,  99,  82, 175, 111, // 1312-1319
-121, 170, 142, 207, 180,  70,  79,  90, // 1320-1327
- 97, 101,  96, 196, 227, 106,  88,  93, // 1328-1335
-102,  99, 196, 232, 145,  80,  97,  99, // 1336-1343
-156, 104, 113, 103, 163, 136, 114, 102, // 1344-1351
-151, 207, 106, 105, 109, 105, 128, 205, // 1352-1359
-193, 114,  74, 167, 151,  77, 164,  99, // 1360-1367
-124, 175, 179, 143,  61, 107,  87,  87, // 1368-1375
-139, 223,  96,  68, 129, 217, 142,  88, // 1376-1383
- 83,  85,  92, 158, 148, 101,  92, 104, // 1384-1391
-117, 108,  87, 170, 208, 186, 172, 169, // 1392-1399
-142, 102,  61,  79, 176, 168, 140, 109, // 1400-1407
-135, 148, 151, 114,  58,  71, 116, 167, // 1408-1415
-204, 133,  60,  65, 120, 133, 112, 144, // 1416-1423
-170,  75,  97, 106, 101, 160, 178, 208, // 1424-1431
-180, 143, 167, 120, 115, 144, 167, 139, // 1432-1439
-112,  96, 114, 127, 133, 138, 124, 119, // 1440-1447
-107, 100,  76,  60,  73,  72,  94, 188, // 1448-1455
-204, 165,  72,  72, 168, 213, 181, 153, // 1456-1463
-116, 102,  86,  88,  94, 155, 203, 194, // 1464-1471
-145, 129,  90,  66,  90,  89, 119, 112, // 1472-1479
-104, 120, 101, 113, 218, 229, 148, 141, // 1480-1487
-139, 140, 136, 187, 147, 106,  89, 128, // 1488-1495
-175, 150, 105,  78,  98, 122, 135,  74, // 1496-1503
- 73, 131, 159, 171, 162, 142, 139, 170, // 1504-1511
-175, 132,  98,  68,  74,  89,  76,  77, // 1512-1519
- 84,  96, 121, 150, 181, 193, 192, 147, // 1520-1527
-129,  87,  70, 104, 153, 175, 184, 167, // 1528-1535
-128, 105,  91,  94, 109, 103, 128, 151, // 1536-1543
-163, 158, 137, 133, 124, 113, 113, 112, // 1544-1551
-117, 123, 130, 123, 131, 139, 139, 129, // 1552-1559
-120, 125, 115, 131, 135, 117, 109, 124, // 1560-1567
-112, 111, 135, 125, 120, 128, 141, 126, // 1568-1575
-125, 130, 127, 138, 133, 125, 141, 140, // 1576-1583
-118, 137, 127, 118, 138, 128, 125, 134, // 1584-1591
-136, 139, 137, 138, 130, 128, 126, 130, // 1592-1599
-120, 122, 127, 134, 134, 123, 114, 130, // 1600-1607
-130, 120, 125, 122, 130, 136, 131, 126, // 1608-1615
-128, 124, 120, 134, 128, 117, 127, 125, // 1616-1623
-127, 121, 116, 120, 143, 120, 127, 139, // 1624-1631
-126, 130, 135, 124, 126, 133, 122, 121, // 1632-1639
-126, 129, 124, 130, 136, 127, 116, 115, // 1640-1647
-125, 134, 118, 123, 144, 141, 140, 122, // 1648-1655
-123, 129, 135, 111, 127, 135, 122, 133, // 1656-1663
-132, 124, 116, 130, 112, 130, 136, 131, // 1664-1671
-129, 131, 133, 131, 125, 121, 130, 122, // 1672-1679
-131, 133, 130, 136, 111, 110, 123, 125, // 1680-1687
-134, 138, 130, 132, 146, 124, 116, 120, // 1688-1695
-144, 124, 122, 121, 129, 139, 119, 115, // 1696-1703
-120, 142, 112, 125, 137, 131, 127, 128, // 1704-1711
-135, 141, 126, 112, 135, 139, 120, 116, // 1712-1719
-121, 137, 133, 125, 118, 131, 122, 126, // 1720-1727
-132, 127, 129, 141, 140, 114, 125, 136, // 1728-1735
-122, 120, 128, 131, 138, 128, 113, 111, // 1736-1743
-124, 121, 130, 139, 136, 143, 141, 111, // 1744-1751
-120, 140, 123, 118, 132, 130, 126, 128, // 1752-1759
-124, 116, 121, 123, 124, 137, 139, 125, // 1760-1767
-125, 142, 134, 120, 129, 127, 121, 122, // 1768-1775
-124, 126, 133, 142, 110, 113, 147, 123, // 1776-1783
-108, 142, 134, 132, 130, 122, 133, 138, // 1784-1791
-126, 120, 131, 125, 129, 125, 124, 119, // 1792-1799
-120, 123, 121, 136, 150, 134, 127, 134, // 1800-1807
-133, 114, 116, 132, 129, 121, 131, 141, // 1808-1815
-134, 123, 106, 111, 125, 131, 136, 138, // 1816-1823
-136, 139, 131, 120, 119, 124, 126, 133, // 1824-1831
-125, 124, 126, 113, 111, 123, 142, 146, // 1832-1839
-139, 133, 133, 119, 114, 120, 128, 133, // 1840-1847
-137, 134, 136, 138, 109,  93, 115, 124, // 1848-1855
-129, 146, 153, 142, 129, 122, 115, 120, // 1856-1863
-116, 129, 135, 136, 139, 135, 113, 107, // 1864-1871
-125, 126, 116, 134, 151, 139, 128, 128, // 1872-1879
-126, 122, 124, 125, 128, 126, 132, 134, // 1880-1887
-104, 113, 134, 129, 138, 139, 129, 130, // 1888-1895
-136, 124, 114, 126, 130, 134, 139, 125, // 1896-1903
-114, 116, 114, 119, 140, 139, 140, 137, // 1904-1911
-129, 123, 124, 122, 119, 123, 138, 144, // 1912-1919
-128, 119, 120, 122, 119, 115, 132, 146, // 1920-1927
-132, 129, 136, 132, 128, 129, 115, 117, // 1928-1935
-137, 131, 122, 135, 135, 102, 118, 134, // 1936-1943
-120, 135, 153, 135, 117, 131, 123, 117, // 1944-1951
-122, 127, 139, 139, 130, 131, 121,  95, // 1952-1959
-114, 139, 122, 135, 159, 142, 118, 125, // 1960-1967
-114, 119, 134, 129, 129, 131, 131, 123, // 1968-1975
-111, 112, 126, 129, 143, 142, 139, 136, // 1976-1983
-121, 115, 118, 123, 127, 131, 137, 148, // 1984-1991
-132, 101, 104, 112, 117, 140, 152, 148, // 1992-1999
-147, 129, 107, 115, 127, 115, 126, 148, // 2000-2007
-141, 133, 129, 105,  96, 121, 128, 136, // 2008-2015
-151, 150, 131, 130, 123, 110, 117, 127, // 2016-2023
-127, 132, 133, 124, 128, 124, 117, 130, // 2024-2031
-138, 133, 128, 125, 133, 131, 122, 125, // 2032-2039
-136, 131, 114, 118, 141, 132, 104, 122, // 2040-2047
-138, 127, 128, 135, 137, 131, 119, 120, // 2048-2055
-138, 129, 115, 128, 144, 130, 125, 129, // 2056-2063
-122, 105, 117, 127, 132, 149, 148, 130, // 2064-2071
-128, 129, 113, 120, 112, 114, 143, 137, // 2072-2079
-125, 136, 129, 114, 123, 132, 123, 129, // 2080-2087
-141, 143, 131, 118, 123, 129, 124, 135, // 2088-2095
-136,  94, 104, 136, 135, 129, 136, 132, // 2096-2103
-140, 137, 112, 110, 135, 130, 122, 138, // 2104-2111
-137, 134, 133, 127, 109, 121, 128, 102, // 2112-2119
-122, 152, 133, 125, 139, 143, 129, 116, // 2120-2127
-120, 125, 118, 119, 119, 133, 136, 135, // 2128-2135
-133, 137, 132, 119, 118, 126, 132, 129, // 2136-2143
-141, 138, 123, 133, 112,  98, 112, 129, // 2144-2151
-136, 147, 149, 131, 122, 116, 104, 106, // 2152-2159
-131, 144, 149, 145, 132, 122, 128, 121, // 2160-2167
-121, 140, 158, 111,  81, 123, 132, 113, // 2168-2175
-123, 148, 149, 145, 131, 111, 112, 117, // 2176-2183
-104, 121, 157, 154, 131, 135, 140, 118, // 2184-2191
-109, 119, 128, 141, 146, 109, 109, 129, // 2192-2199
-122, 109, 125, 146, 151, 143, 119, 111, // 2200-2207
-121, 116, 112, 134, 156, 141, 126, 130, // 2208-2215
-133, 123, 122, 121, 123, 127, 149, 132, // 2216-2223
-106, 103, 124, 137, 128, 133, 137, 140, // 2224-2231
-118, 123, 114, 120, 127, 139, 141, 147, // 2232-2239
-133, 123, 122, 117, 123, 119, 128, 142, // 2240-2247
-128, 102, 127, 142, 126, 119, 133, 142, // 2248-2255
-139, 120, 108, 124, 143, 127, 110, 128, // 2256-2263
-138, 129, 130, 124, 127, 128, 134, 129, // 2264-2271
-131, 141, 143, 124, 135, 118,  59, 109, // 2272-2279
-145, 134, 133, 161, 158, 137, 107,  77, // 2280-2287
-100, 137, 129, 134, 168, 161, 124, 123, // 2288-2295
-122, 111, 110, 136, 155, 109, 110, 138, // 2296-2303
-123, 102, 119, 142, 146, 148, 130, 122, // 2304-2311
-119, 106,  98, 127, 146, 141, 150, 143, // 2312-2319
-130, 113, 116, 123, 126, 133, 142, 150, // 2320-2327
-134,  92,  98, 121, 117, 124, 144, 155, // 2328-2335
-153, 134, 105, 103, 112, 113, 124, 148, // 2336-2343
-158, 138, 121, 125, 134, 120, 118, 144, // 2344-2351
-139, 146, 141,  81,  87, 117, 116, 122, // 2352-2359
-159, 170, 150, 126, 108,  99,  99, 109, // 2360-2367
-127, 154, 168, 147, 129, 125, 122, 115, // 2368-2375
-110, 123, 157, 161,  88,  89, 129, 134, // 2376-2383
-119, 135, 142, 144, 144, 118,  99, 110, // 2384-2391
-121, 124, 141, 149, 149, 133, 119, 116, // 2392-2399
-122, 127, 136, 140, 148, 129,  79, 112, // 2400-2407
-130, 114, 117, 155, 157, 142, 132, 115, // 2408-2415
- 99, 105, 111, 123, 151, 155, 144, 138, // 2416-2423
-129, 122, 117, 118, 128, 138, 141, 151, // 2424-2431
-122,  77, 111, 128, 112, 124, 153, 159, // 2432-2439
-153, 128,  98,  95, 106, 110, 135, 166, // 2440-2447
-163, 141, 120, 119, 123, 107, 127, 149, // 2448-2455
-139, 157, 126,  70,  92, 129, 117, 130, // 2456-2463
-164, 160, 149, 127,  95,  84, 115, 121, // 2464-2471
-132, 155, 159, 141, 124, 120, 127, 112, // 2472-2479
-113, 138, 149, 142, 147, 101,  88, 114, // 2480-2487
-120, 116, 137, 164, 158, 141, 117,  98, // 2488-2495
- 95, 108, 117, 145, 162, 155, 132, 125, // 2496-2503
-114, 122, 119, 129, 151, 148, 149, 115, // 2504-2511
- 73,  91, 120, 121, 134, 161, 167, 152, // 2512-2519
-128,  93,  80, 103, 124, 139, 156, 161, // 2520-2527
-146, 126, 118, 112, 120, 131, 135, 145, // 2528-2535
-160, 123,  69,  96, 122, 128, 131, 150, // 2536-2543
-156, 155, 132,  97,  96, 103, 108, 134, // 2544-2551
-148, 156, 157, 140, 113, 115, 123, 122, // 2552-2559
-130, 147, 141, 145, 110,  80, 107, 125, // 2560-2567
-127, 131, 149, 152, 152, 124,  98,  94, // 2568-2575
-109, 119, 136, 154, 153, 142, 133, 127, // 2576-2583
-119, 122, 112, 128, 148, 169, 138,  61, // 2584-2591
- 91, 128, 119, 110, 147, 167, 169, 142, // 2592-2599
- 96,  81, 108, 109, 122, 156, 172, 151, // 2600-2607
-125, 112, 117, 130, 118, 128, 148, 161, // 2608-2615
-156,  77,  61, 116, 132, 124, 135, 160, // 2616-2623
-162, 148, 114,  94,  97, 113, 119, 134, // 2624-2631
-158, 159, 140, 120, 110, 126, 137, 122, // 2632-2639
-127, 150, 162, 128,  66,  82, 121, 134, // 2640-2647
-129, 144, 160, 163, 133,  98, 100, 106, // 2648-2655
- 99, 121, 157, 161, 153, 137, 114, 113, // 2656-2663
-124, 135, 134, 131, 134, 161, 131,  64, // 2664-2671
- 84, 123, 131, 135, 151, 157, 158, 133, // 2672-2679
- 93,  93, 104, 106, 128, 155, 169, 161, // 2680-2687
-133, 108, 109, 117, 127, 139, 133, 143, // 2688-2695
-147, 139,  95,  70, 114, 138, 136, 132, // 2696-2703
-148, 151, 144, 115,  97,  96, 116, 130, // 2704-2711
-144, 152, 160, 133, 108, 114, 133, 133, // 2712-2719
-118, 131, 148, 161, 144,  76,  56, 117, // 2720-2727
-142, 130, 134, 160, 166, 145, 109,  80, // 2728-2735
- 92, 121, 130, 142, 159, 156, 135, 115, // 2736-2743
-111, 127, 133, 126, 138, 166, 166, 113, // 2744-2751
- 33,  70, 123, 138, 153, 170, 165, 155, // 2752-2759
-121,  79,  79,  99, 127, 144, 161, 161, // 2760-2767
-147, 120,  99, 111, 139, 145, 142, 142, // 2768-2775
-170, 139,  31,  53, 127, 145, 149, 166, // 2776-2783
-158, 152, 130,  81,  79, 115, 123, 121, // 2784-2791
-157, 167, 144, 126, 117, 112, 127, 135, // 2792-2799
-132, 138, 146, 134, 160,  98,  36,  92, // 2800-2807
-146, 145, 151, 162, 150, 142, 112,  84, // 2808-2815
- 95, 112, 114, 142, 170, 158, 140, 129, // 2816-2823
-108, 107, 121, 128, 149, 158, 142, 132, // 2824-2831
-146,  66,  51, 108, 134, 152, 176, 169, // 2832-2839
-145, 127,  92,  68,  85, 125, 154, 175, // 2840-2847
-166, 148, 127,  95, 100, 115, 138, 150, // 2848-2855
-145, 153, 154, 127,  36,  66, 137, 150, // 2856-2863
-143, 153, 155, 148, 127,  86,  85, 105, // 2864-2871
-136, 145, 156, 154, 146, 116, 100, 110, // 2872-2879
-131, 145, 141, 136, 144, 145, 142,  93, // 2880-2887
- 45, 100, 136, 149, 143, 157, 155, 148, // 2888-2895
-113,  78,  88, 121, 137, 150, 153, 153, // 2896-2903
-133, 110, 101, 120, 142, 153, 147, 148, // 2904-2911
-143, 154,  66,  10,  91, 149, 172, 172, // 2912-2919
-175, 145, 133,  89,  62,  84, 134, 152, // 2920-2927
-158, 161, 143, 122, 105, 103, 136, 153, // 2928-2935
-142, 141, 134, 153, 143,  36,  47, 131, // 2936-2943
-156, 154, 165, 155, 143, 128,  87,  76, // 2944-2951
- 98, 129, 147, 161, 158, 140, 118, 104, // 2952-2959
-109, 137, 147, 139, 137, 142, 142, 158, // 2960-2967
- 80,  32,  98, 157, 145, 140, 158, 144, // 2968-2975
-140, 115,  96, 103, 116, 120, 144, 154, // 2976-2983
-140, 135, 134, 122, 121, 124, 125, 137, // 2984-2991
-136, 141, 158, 164,  79,  19,  86, 157, // 2992-2999
-163, 146, 152, 149, 148, 103,  74,  90, // 3000-3007
-138, 149, 144, 138, 147, 143, 116,  92, // 3008-3015
-122, 152, 153, 133, 134, 143, 160,  99, // 3016-3023
- 17,  84, 141, 168, 167, 147, 134, 145, // 3024-3031
-114,  82,  87, 126, 142, 146, 147, 146, // 3032-3039
-133, 117, 115, 124, 140, 143, 136, 135, // 3040-3047
-128, 162, 143,  31,  54, 123, 152, 166, // 3048-3055
-168, 152, 142, 121,  67,  71, 123, 152, // 3056-3063
-149, 160, 152, 123, 104,  95, 128, 169, // 3064-3071
-151, 125, 118, 124, 136, 172, 107,  29, // 3072-3079
- 93, 146, 160, 163, 149, 123, 133, 114, // 3080-3087
- 75,  98, 142, 154, 150, 148, 131, 125, // 3088-3095
-108, 102, 131, 160, 148, 130, 129, 126, // 3096-3103
-148, 158,  66,  35, 126, 152, 152, 156, // 3104-3111
-143, 133, 140,  96,  68, 119, 153, 146, // 3112-3119
-142, 140, 135, 121, 101, 111, 148, 159, // 3120-3127
-147, 135, 120, 114, 153, 176,  50,  14, // 3128-3135
-107, 160, 180, 177, 143, 129, 130,  86, // 3136-3143
- 56, 105, 159, 165, 162, 147, 123, 107, // 3144-3151
-103, 107, 152, 167, 144, 124, 131, 126, // 3152-3159
-141, 139,  46,  54, 133, 164, 167, 162, // 3160-3167
-133, 119, 124,  96,  78, 114, 151, 153, // 3168-3175
-158, 141, 121, 109, 111, 123, 153, 146, // 3176-3183
-145, 137, 120, 111, 169, 142,  18,  64, // 3184-3191
-132, 159, 186, 176, 121, 119, 115,  65, // 3192-3199
- 95, 140, 140, 157, 164, 135, 126, 108, // 3200-3207
- 86, 128, 164, 154, 146, 129, 114, 118, // 3208-3215
-164, 130,  44,  79, 129, 151, 167, 158, // 3216-3223
-125, 132, 123,  82,  86, 136, 148, 152, // 3224-3231
-150, 134, 129, 117,  97, 112, 152, 156, // 3232-3239
-143, 122, 128, 129, 160, 176,  56,  12, // 3240-3247
-109, 159, 157, 176, 146, 117, 140, 107, // 3248-3255
- 68,  95, 150, 157, 156, 144, 123, 124, // 3256-3263
-108,  97, 134, 172, 165, 140, 111, 103, // 3264-3271
-140, 182,  97,  10,  75, 151, 184, 187, // 3272-3279
-149,  98, 120, 121,  98,  96, 119, 153, // 3280-3287
-172, 152, 115, 118, 120, 114, 122, 140, // 3288-3295
-153, 146, 138, 119, 123, 150, 158,  73, // 3296-3303
- 33,  83, 142, 186, 188, 152, 116, 114, // 3304-3311
- 96,  96,  97, 122, 159, 173, 145, 128, // 3312-3319
-117, 108, 114, 126, 140, 160, 156, 122, // 3320-3327
-105, 134, 146, 169,  79,  33,  73, 141, // 3328-3335
-198, 194, 156, 102, 106, 104,  89,  83, // 3336-3343
-124, 162, 182, 164, 121, 105, 109, 105, // 3344-3351
-123, 147, 165, 162, 125, 102, 130, 161, // 3352-3359
-149,  35,  31, 107, 176, 208, 181, 115, // 3360-3367
- 99, 119, 102,  95,  90, 135, 179, 180, // 3368-3375
-135, 113, 110, 114, 117, 126, 144, 160, // 3376-3383
-157, 124, 120, 136, 155, 121,  18,  54, // 3384-3391
-129, 188, 204, 165, 102,  99, 108,  99, // 3392-3399
-106, 115, 140, 179, 160, 124, 112, 120, // 3400-3407
-113, 117, 119, 148, 160, 151, 108, 117, // 3408-3415
-140, 186, 134,  44,  89,  83, 180, 190, // 3416-3423
-171, 100,  92, 114, 110, 101, 101, 119, // 3424-3431
-166, 175, 136, 111, 112, 116, 123, 125, // 3432-3439
-137, 155, 155, 128, 111, 123, 161, 165, // 3440-3447
- 69,  20,  77, 150, 204, 204, 148,  98, // 3448-3455
-103,  99,  97, 114, 122, 152, 179, 155, // 3456-3463
-116, 116, 115, 118, 131, 130, 133, 156, // 3464-3471
-145, 118, 124, 135, 141, 153,  74,  33, // 3472-3479
- 94, 151, 186, 192, 149,  99, 103, 100, // 3480-3487
- 94, 111, 128, 155, 172, 153, 121, 113, // 3488-3495
-113, 112, 119, 129, 143, 166, 153, 115, // 3496-3503
-102, 132, 160, 158,  60,  24,  88, 156, // 3504-3511
-202, 194, 139, 100, 106,  96,  96, 106, // 3512-3519
-130, 165, 178, 145, 114, 110, 116, 115, // 3520-3527
-119, 131, 154, 168, 144, 113, 113, 131, // 3528-3535
-159, 138,  37,  44, 112, 171, 207, 185, // 3536-3543
-118,  93, 104,  94, 109, 117, 130, 163, // 3544-3551
-171, 139, 119, 116, 111, 116, 129, 135, // 3552-3559
-153, 157, 129, 114, 126, 145, 163,  97, // 3560-3567
- 27,  68, 130, 183, 202, 165, 109, 103, // 3568-3575
-100,  95, 112, 117, 137, 168, 162, 129, // 3576-3583
-122, 117, 115, 127, 121, 127, 151, 155, // 3584-3591
-133, 126, 133, 137, 168,  95,  17,  57, // 3592-3599
-125, 186, 216, 176, 108,  98,  93,  91, // 3600-3607
-111, 121, 140, 174, 169, 128, 113, 112, // 3608-3615
-112, 121, 129, 137, 155, 152, 127, 113, // 3616-3623
-127, 143, 165, 134,  31,  44, 108, 163, // 3624-3631
-201, 190, 127,  99, 106,  90, 105, 122, // 3632-3639
-122, 153, 176, 147, 119, 114, 109, 120, // 3640-3647
-136, 127, 131, 150, 151, 130, 124, 128, // 3648-3655
-138, 158,  89,  36,  77, 125, 177, 204, // 3656-3663
-169, 111, 103,  93,  94, 122, 121, 126, // 3664-3671
-161, 161, 139, 131, 115, 105, 122, 123, // 3672-3679
-130, 153, 154, 136, 123, 120, 130, 154, // 3680-3687
-155,  58,  37,  85, 138, 199, 204, 153, // 3688-3695
-107,  96,  81, 100, 122, 123, 149, 171, // 3696-3703
-153, 130, 118, 104, 117, 131, 130, 136, // 3704-3711
-142, 141, 133, 126, 131, 141, 161, 139, // 3712-3719
- 38,  38,  92, 148, 207, 206, 141, 101, // 3720-3727
- 96,  78, 101, 130, 125, 150, 176, 149, // 3728-3735
-126, 117, 101, 117, 135, 129, 139, 149, // 3736-3743
-139, 136, 125, 117, 132, 169, 124,  50, // 3744-3751
- 62,  89, 150, 204, 190, 135, 111,  93, // 3752-3759
- 85, 115, 124, 116, 145, 167, 148, 138, // 3760-3767
-123, 103, 119, 131, 121, 133, 143, 133, // 3768-3775
-137, 142, 130, 139, 155, 137,  49,  37, // 3776-3783
- 84, 140, 206, 208, 156, 108,  92,  77, // 3784-3791
- 99, 125, 126, 140, 169, 159, 139, 119, // 3792-3799
-101, 112, 136, 132, 128, 135, 139, 137, // 3800-3807
-138, 123, 129, 147, 161, 117,  46,  52, // 3808-3815
- 87, 158, 208, 194, 142, 103,  85,  87, // 3816-3823
-114, 126, 124, 141, 161, 154, 139, 120, // 3824-3831
-107, 117, 130, 127, 131, 135, 138, 142, // 3832-3839
-136, 119, 134, 150, 153, 107,  48,  57, // 3840-3847
- 94, 166, 204, 190, 144, 105,  84,  85, // 3848-3855
-108, 124, 128, 143, 160, 153, 141, 121, // 3856-3863
-110, 113, 123, 129, 133, 137, 139, 131, // 3864-3871
-133, 138, 139, 142, 150, 114,  47,  58, // 3872-3879
- 88, 148, 203, 199, 155, 117,  87,  76, // 3880-3887
-104, 124, 125, 139, 156, 152, 148, 131, // 3888-3895
-107, 110, 123, 128, 131, 139, 133, 135, // 3896-3903
-137, 127, 129, 141, 147, 149, 101,  44, // 3904-3911
- 60, 103, 166, 204, 193, 142, 105,  83, // 3912-3919
- 82, 110, 128, 126, 141, 158, 152, 144, // 3920-3927
-127, 106, 112, 126, 128, 131, 131, 132, // 3928-3935
-144, 144, 128, 126, 131, 141, 155, 104, // 3936-3943
- 47,  61,  98, 163, 207, 196, 146, 105, // 3944-3951
- 77,  76, 109, 131, 133, 142, 153, 149, // 3952-3959
-145, 129, 109, 110, 123, 129, 135, 136, // 3960-3967
-129, 130, 141, 134, 131, 137, 139, 151, // 3968-3975
-125,  61,  53,  85, 134, 193, 201, 165, // 3976-3983
-124,  92,  75,  94, 121, 130, 136, 151, // 3984-3991
-149, 147, 138, 118, 110, 117, 128, 133, // 3992-3999
-136, 129, 125, 134, 138, 132, 132, 137, // 4000-4007
-141, 156, 122,  52,  54,  82, 136, 198, // 4008-4015
-205, 167, 126,  88,  66,  93, 120, 133, // 4016-4023
-142, 150, 149, 151, 140, 117, 108, 112, // 4024-4031
-125, 136, 137, 130, 129, 132, 135, 140, // 4032-4039
-132, 133, 138, 147, 121,  61,  64,  83, // 4040-4047
-137, 194, 201, 166, 125,  88,  68,  96, // 4048-4055
-122, 133, 144, 150, 145, 146, 137, 116, // 4056-4063
-113, 117, 124, 133, 135, 131, 133, 132, // 4064-4071
-134, 133, 134, 128, 134, 143, 140,  89, // 4072-4079
- 62,  79, 106, 168, 196, 182, 143, 108, // 4080-4087
- 78,  82, 112, 127, 136, 147, 147, 144, // 4088-4095
-144, 128, 115, 119, 118, 123, 134, 133, // 4096-4103
-127, 133, 138, 132, 137, 132, 132, 142, // 4104-4111
-149, 104,  58,  70,  85, 149, 197, 195, // 4112-4119
-163, 125,  83,  70,  97, 120, 137, 145, // 4120-4127
-146, 144, 147, 138, 121, 116, 115, 122, // 4128-4135
-131, 135, 130, 129, 129, 132, 139, 140, // 4136-4143
-133, 130, 134, 141, 113,  70,  75,  89, // 4144-4151
-138, 186, 191, 166, 130,  93,  75,  93, // 4152-4159
-115, 132, 142, 148, 145, 147, 143, 125, // 4160-4167
-114, 111, 115, 126, 138, 138, 134, 131, // 4168-4175
-128, 129, 135, 133, 129, 132, 142, 140, // 4176-4183
- 94,  73,  80, 100, 157, 187, 182, 154, // 4184-4191
-121,  85,  81, 100, 118, 136, 147, 145, // 4192-4199
-144, 147, 134, 122, 117, 110, 117, 129, // 4200-4207
-138, 137, 137, 129, 129, 134, 133, 133, // 4208-4215
-132, 136, 146, 115,  71,  77,  85, 130, // 4216-4223
-181, 191, 170, 139,  99,  75,  92, 112, // 4224-4231
-131, 142, 140, 138, 145, 146, 134, 125, // 4232-4239
-112, 111, 122, 133, 136, 135, 126, 126, // 4240-4247
-137, 140, 140, 131, 124, 127, 138, 116, // 4248-4255
- 84,  89,  91, 128, 173, 183, 167, 140, // 4256-4263
-101,  79,  96, 111, 131, 143, 138, 136, // 4264-4271
-142, 141, 133, 130, 117, 114, 125, 127, // 4272-4279
-130, 133, 131, 130, 134, 132, 132, 130, // 4280-4287
-130, 132, 133, 140, 118,  82,  81,  94, // 4288-4295
-127, 170, 184, 166, 140, 109,  86,  94, // 4296-4303
-111, 124, 134, 140, 138, 143, 149, 137, // 4304-4311
-126, 117, 111, 117, 130, 134, 135, 133, // 4312-4319
-128, 132, 136, 134, 133, 130, 133, 140, // 4320-4327
-135,  95,  70,  75,  97, 154, 191, 190, // 4328-4335
-163, 126,  85,  74,  96, 118, 139, 145, // 4336-4343
-136, 134, 140, 143, 139, 132, 116, 111, // 4344-4351
-118, 126, 133, 134, 131, 127, 134, 138, // 4352-4359
-136, 135, 127, 125, 133, 134, 113,  88, // 4360-4367
- 86,  93, 129, 168, 180, 170, 142, 108, // 4368-4375
- 86,  94, 107, 125, 141, 137, 132, 137, // 4376-4383
-142, 141, 138, 125, 113, 117, 120, 125, // 4384-4391
-133, 134, 131, 133, 131, 132, 136, 130, // 4392-4399
-128, 128, 130, 134, 130,  98,  85,  93, // 4400-4407
-109, 149, 176, 176, 155, 127,  96,  87, // 4408-4415
-101, 116, 133, 138, 135, 135, 139, 143, // 4416-4423
-141, 134, 121, 113, 114, 119, 127, 133, // 4424-4431
-135, 135, 135, 136, 132, 130, 129, 126, // 4432-4439
-129, 135, 138, 111,  85,  86,  93, 131, // 4440-4447
-170, 182, 170, 145, 110,  84,  92, 104, // 4448-4455
-123, 141, 140, 135, 135, 138, 137, 139, // 4456-4463
-131, 117, 115, 117, 122, 132, 137, 134, // 4464-4471
-131, 131, 128, 131, 135, 132, 131, 135, // 4472-4479
-136, 135, 115,  82,  78,  88, 120, 166, // 4480-4487
-188, 180, 155, 120,  84,  81,  96, 117, // 4488-4495
-140, 147, 140, 133, 135, 135, 137, 136, // 4496-4503
-124, 116, 115, 119, 128, 136, 137, 132, // 4504-4511
-130, 127, 130, 135, 132, 130, 128, 129, // 4512-4519
-132, 137, 116,  91,  88,  91, 120, 160, // 4520-4527
-179, 176, 156, 123,  89,  85,  95, 111, // 4528-4535
-136, 144, 141, 139, 136, 134, 136, 135, // 4536-4543
-123, 118, 116, 117, 126, 135, 135, 133, // 4544-4551
-133, 131, 130, 132, 132, 127, 128, 125, // 4552-4559
-125, 135, 138, 122, 103,  95,  92, 112, // 4560-4567
-147, 166, 172, 160, 132, 102,  92,  96, // 4568-4575
-108, 128, 139, 137, 136, 135, 134, 139, // 4576-4583
-139, 130, 122, 117, 114, 119, 129, 132, // 4584-4591
-135, 135, 131, 131, 132, 131, 132, 134, // 4592-4599
-128, 129, 136, 136, 120,  97,  86,  81, // 4600-4607
-104, 145, 173, 185, 174, 144, 106,  86, // 4608-4615
- 85,  97, 120, 137, 141, 140, 140, 137, // 4616-4623
-138, 140, 132, 123, 117, 112, 115, 124, // 4624-4631
-134, 136, 138, 134, 127, 128, 131, 133, // 4632-4639
-135, 133, 127, 125, 130, 132, 122, 106, // 4640-4647
- 97,  91, 104, 136, 160, 174, 171, 150, // 4648-4655
-119,  97,  89,  94, 111, 130, 138, 140, // 4656-4663
-141, 139, 138, 139, 135, 127, 119, 113, // 4664-4671
-112, 119, 130, 136, 141, 139, 132, 129, // 4672-4679
-126, 125, 128, 133, 132, 129, 128, 128, // 4680-4687
-133, 131, 114,  99,  93,  95, 118, 148, // 4688-4695
-168, 172, 162, 136, 108,  95,  93, 102, // 4696-4703
-120, 134, 137, 137, 138, 136, 138, 140, // 4704-4711
-136, 127, 119, 112, 111, 120, 130, 136, // 4712-4719
-141, 137, 131, 129, 126, 129, 132, 132, // 4720-4727
-131, 126, 124, 128, 135, 133, 119, 105, // 4728-4735
- 91,  92, 111, 140, 163, 174, 167, 142, // 4736-4743
-115,  96,  91, 101, 119, 133, 139, 138, // 4744-4751
-133, 131, 135, 137, 139, 135, 126, 117, // 4752-4759
-114, 117, 123, 133, 137, 136, 133, 128, // 4760-4767
-126, 127, 129, 130, 135, 134, 129, 132, // 4768-4775
-135, 134, 123, 108,  92,  86,  98, 122, // 4776-4783
-151, 171, 175, 161, 136, 112,  94,  94, // 4784-4791
-105, 120, 133, 138, 136, 132, 131, 133, // 4792-4799
-136, 138, 134, 128, 120, 116, 117, 123, // 4800-4807
-131, 136, 137, 134, 129, 125, 125, 127, // 4808-4815
-131, 133, 134, 132, 129, 130, 135, 133, // 4816-4823
-123, 109,  95,  88,  98, 120, 146, 166, // 4824-4831
-173, 162, 141, 119, 101,  97, 105, 118, // 4832-4839
-128, 134, 134, 131, 131, 132, 136, 140, // 4840-4847
-136, 128, 120, 113, 113, 121, 131, 139, // 4848-4855
-142, 138, 130, 124, 121, 122, 127, 132, // 4856-4863
-134, 134, 132, 128, 128, 130, 134, 138, // 4864-4871
-127, 112,  98,  88,  95, 115, 143, 162, // 4872-4879
-172, 165, 144, 123, 105,  98, 103, 116, // 4880-4887
-127, 133, 136, 131, 127, 128, 132, 137, // 4888-4895
-140, 136, 128, 120, 114, 115, 122, 131, // 4896-4903
-137, 140, 136, 129, 124, 122, 123, 128, // 4904-4911
-132, 133, 133, 131, 129, 129, 130, 134, // 4912-4919
-128, 119, 107,  97,  97, 108, 129, 148, // 4920-4927
-161, 164, 152, 136, 118, 106, 103, 109, // 4928-4935
-120, 128, 133, 132, 129, 127, 128, 134, // 4936-4943
-138, 141, 137, 128, 118, 110, 112, 119, // 4944-4951
-129, 140, 144, 142, 134, 126, 120, 119, // 4952-4959
-122, 127, 132, 134, 135, 132, 129, 129, // 4960-4967
-131, 133, 129, 120, 108,  98,  97, 105, // 4968-4975
-124, 143, 158, 164, 157, 143, 126, 112, // 4976-4983
-105, 108, 115, 123, 129, 131, 129, 129, // 4984-4991
-129, 133, 138, 141, 140, 133, 122, 112, // 4992-4999
-106, 108, 117, 130, 142, 148, 146, 138, // 5000-5007
-128, 120, 117, 119, 125, 131, 134, 135, // 5008-5015
-133, 130, 129, 130, 133, 130, 125, 115, // 5016-5023
-104,  99, 102, 114, 131, 148, 158, 158, // 5024-5031
-150, 137, 123, 112, 109, 112, 117, 125, // 5032-5039
-129, 130, 129, 127, 129, 132, 138, 141, // 5040-5047
-142, 137, 127, 115, 105, 102, 108, 121, // 5048-5055
-136, 148, 152, 148, 137, 125, 117, 114, // 5056-5063
-117, 124, 131, 136, 136, 135, 131, 128, // 5064-5071
-128, 131, 131, 127, 119, 108, 101, 101, // 5072-5079
-109, 123, 139, 153, 158, 155, 144, 130, // 5080-5087
-117, 111, 110, 115, 122, 127, 129, 128, // 5088-5095
-126, 126, 128, 133, 139, 143, 143, 137, // 5096-5103
-127, 116, 107, 104, 109, 118, 131, 142, // 5104-5111
-147, 145, 139, 130, 122, 119, 120, 124, // 5112-5119
-128, 132, 133, 132, 131, 129, 129, 131, // 5120-5127
-134, 133, 128, 120, 109, 101, 101, 108, // 5128-5135
-122, 137, 151, 156, 154, 145, 131, 121, // 5136-5143
-114, 113, 117, 123, 126, 127, 126, 124, // 5144-5151
-123, 126, 132, 138, 143, 144, 139, 130, // 5152-5159
-121, 112, 108, 110, 116, 125, 133, 140, // 5160-5167
-141, 139, 134, 128, 124, 123, 124, 127, // 5168-5175
-129, 130, 130, 129, 128, 128, 129, 131, // 5176-5183
-134, 136, 132, 125, 116, 106, 101, 105, // 5184-5191
-114, 127, 141, 151, 153, 149, 140, 129, // 5192-5199
-121, 117, 117, 120, 125, 127, 126, 125, // 5200-5207
-122, 121, 124, 130, 136, 141, 143, 139, // 5208-5215
-133, 124, 116, 111, 112, 117, 124, 132, // 5216-5223
-136, 137, 135, 131, 127, 125, 125, 126, // 5224-5231
-129, 131, 131, 130, 128, 126, 125, 126, // 5232-5239
-128, 130, 134, 136, 133, 128, 120, 111, // 5240-5247
-106, 107, 112, 121, 133, 143, 147, 147, // 5248-5255
-142, 133, 127, 122, 121, 122, 125, 126, // 5256-5263
-125, 124, 122, 120, 122, 125, 131, 137, // 5264-5271
-141, 141, 138, 131, 124, 118, 114, 115, // 5272-5279
-119, 126, 131, 134, 135, 132, 129, 127, // 5280-5287
-125, 126, 128, 130, 131, 130, 128, 126, // 5288-5295
-124, 124, 126, 128, 130, 132, 133, 134, // 5296-5303
-131, 128, 122, 117, 113, 112, 115, 120, // 5304-5311
-127, 134, 139, 141, 140, 136, 132, 129, // 5312-5319
-126, 125, 125, 124, 124, 122, 121, 121, // 5320-5327
-122, 125, 129, 133, 136, 137, 136, 133, // 5328-5335
-128, 124, 121, 120, 121, 124, 126, 129, // 5336-5343
-130, 130, 129, 128, 128, 128, 129, 130};// 5344-5351
-
-#endif
+#ifndef SOUNDS_H
+#define SOUNDS_H
+#include <stdint.h>
+
+#define P1_WIN_N 14894
+
+const uint8_t P1Win[P1_WIN_N] = {
+127, 128, 128, 128, 127, 128, 131, 133, // 0-7
+132, 128, 128, 130, 133, 134, 136, 130, // 8-15
+113, 100, 104, 122, 137, 140, 136, 131, // 16-23
+127, 122, 118, 122, 128, 136, 136, 131, // 24-31
+125, 122, 126, 134, 140, 140, 133, 129, // 32-39
+135, 146, 139, 105,  75,  82, 123, 158, // 40-47
+159, 136, 117, 119, 124, 126, 120, 118, // 48-55
+124, 132, 140, 139, 131, 124, 123, 128, // 56-63
+136, 144, 139, 129, 130, 142, 153, 128, // 64-71
+ 82,  61,  94, 146, 167, 150, 122, 114, // 72-79
+126, 130, 122, 106, 111, 138, 156, 150, // 80-87
+125, 116, 120, 134, 141, 144, 145, 134, // 88-95
+128, 135, 149, 128,  79,  58,  93, 147, // 96-103
+167, 147, 120, 117, 129, 126, 110, 105, // 104-111
+124, 150, 154, 136, 121, 124, 134, 137, // 112-119
+133, 136, 148, 146, 137, 138, 138, 105, // 120-127
+ 66,  68, 110, 157, 161, 138, 118, 122, // 128-135
+127, 120, 107, 103, 131, 154, 152, 131, // 136-143
+118, 128, 136, 139, 133, 143, 150, 145, // 144-151
+139, 140, 122,  73,  60,  94, 147, 165, // 152-159
+143, 122, 122, 132, 120, 102,  97, 132, // 160-167
+160, 153, 127, 115, 129, 140, 137, 127, // 168-175
+140, 157, 153, 138, 140, 129,  77,  54, // 176-183
+ 86, 141, 164, 143, 125, 125, 133, 119, // 184-191
+ 99,  98, 131, 160, 153, 126, 114, 131, // 192-199
+142, 136, 126, 137, 162, 159, 137, 138, // 200-207
+122,  72,  53,  92, 146, 163, 138, 122, // 208-215
+131, 133, 113,  91, 106, 146, 162, 142, // 216-223
+118, 124, 140, 141, 128, 128, 152, 167, // 224-231
+147, 128, 141, 115,  59,  54, 105, 162, // 232-239
+159, 124, 119, 133, 134, 100,  85, 125, // 240-247
+163, 159, 123, 116, 139, 149, 131, 120, // 248-255
+140, 170, 161, 131, 134, 131,  74,  49, // 256-263
+ 92, 143, 165, 130, 125, 130, 134,  97, // 264-271
+ 85, 125, 161, 158, 122, 121, 140, 145, // 272-279
+131, 124, 146, 165, 155, 130, 139, 141, // 280-287
+ 70,  38,  95, 157, 165, 117, 123, 147, // 288-295
+137,  84,  69, 137, 171, 150, 109, 127, // 296-303
+157, 135, 117, 127, 166, 170, 138, 124, // 304-311
+145, 133,  46,  53, 115, 164, 150, 112, // 312-319
+142, 148, 116,  62,  98, 159, 157, 133, // 320-327
+114, 155, 139, 116, 124, 157, 175, 142, // 328-335
+135, 144, 150,  74,  26,  95, 149, 156, // 336-343
+111, 140, 164, 126,  68,  82, 145, 149, // 344-351
+130, 131, 157, 145, 109, 127, 157, 168, // 352-359
+139, 137, 157, 158,  79,  28,  91, 137, // 360-367
+135, 112, 149, 179, 125,  68,  91, 142, // 368-375
+134, 119, 141, 162, 138, 112, 137, 161, // 376-383
+160, 137, 142, 158, 134,  67,  43, 117, // 384-391
+134, 119, 124, 150, 165, 108,  91,  97, // 392-399
+145, 116, 129, 157, 143, 132, 106, 160, // 400-407
+148, 159, 142, 152, 149, 114,  78,  53, // 408-415
+118, 119, 130, 130, 153, 147,  97,  94, // 416-423
+124, 130, 121, 138, 153, 138, 116, 133, // 424-431
+149, 154, 158, 153, 148, 138, 107,  50, // 432-439
+ 88, 119, 123, 126, 142, 163, 121,  94, // 440-447
+101, 132, 118, 127, 150, 147, 132, 123, // 448-455
+145, 137, 155, 167, 151, 132, 135,  81, // 456-463
+ 63, 107, 106, 134, 127, 146, 149, 114, // 464-471
+102, 109, 124, 122, 143, 149, 132, 130, // 472-479
+138, 145, 152, 163, 154, 134, 146,  86, // 480-487
+ 48, 110, 117, 109, 134, 155, 147, 104, // 488-495
+104, 121, 115, 118, 141, 153, 133, 135, // 496-503
+145, 137, 138, 162, 169, 135, 135,  95, // 504-511
+ 61, 108, 101, 115, 134, 149, 146, 118, // 512-519
+108, 111, 113, 121, 134, 144, 136, 142, // 520-527
+143, 142, 154, 166, 150, 126, 147,  80, // 528-535
+ 60, 120, 103, 115, 129, 156, 132, 107, // 536-543
+131, 107, 110, 127, 141, 140, 128, 150, // 544-551
+137, 143, 159, 160, 159, 129, 125,  74, // 552-559
+ 72, 119,  93, 123, 151, 144, 127, 124, // 560-567
+109, 114, 111, 130, 134, 134, 149, 134, // 568-575
+146, 153, 161, 157, 129, 163,  91,  50, // 576-583
+132,  92,  92, 139, 150, 130, 123, 134, // 584-591
+111,  93, 144, 123, 126, 143, 140, 134, // 592-599
+148, 161, 151, 172, 136, 136,  74,  83, // 600-607
+114,  82, 112, 145, 139, 130, 137, 105, // 608-615
+123, 107, 134, 129, 130, 148, 128, 147, // 616-623
+152, 154, 175, 130, 163,  97,  56, 134, // 624-631
+ 76,  96, 139, 141, 126, 134, 126, 113, // 632-639
+105, 140, 120, 132, 151, 129, 141, 144, // 640-647
+154, 155, 161, 145, 126,  73, 110,  90, // 648-655
+ 84, 131, 127, 135, 136, 131, 121, 105, // 656-663
+129, 121, 123, 144, 136, 140, 147, 156, // 664-671
+158, 153, 142, 136,  69, 112, 104,  70, // 672-679
+137, 126, 128, 135, 147,  98, 129, 134, // 680-687
+ 93, 153, 128, 133, 144, 146, 143, 157, // 688-695
+172, 131, 146,  84,  95, 115,  73, 123, // 696-703
+128, 127, 132, 134, 123, 113, 133, 125, // 704-711
+119, 147, 128, 138, 146, 147, 160, 162, // 712-719
+141, 136,  78, 112,  99,  76, 131, 119, // 720-727
+134, 135, 128, 126, 116, 123, 126, 125, // 728-735
+141, 134, 142, 141, 152, 157, 158, 139, // 736-743
+134,  82, 111,  98,  81, 134, 118, 128, // 744-751
+141, 127, 123, 124, 126, 118, 131, 130, // 752-759
+130, 148, 144, 154, 164, 152, 141, 126, // 760-767
+ 74, 130,  78,  94, 138, 103, 145, 127, // 768-775
+128, 132, 111, 136, 110, 137, 131, 134, // 776-783
+146, 139, 160, 156, 154, 140, 111,  90, // 784-791
+127,  68, 113, 132, 103, 145, 128, 128, // 792-799
+125, 127, 123, 117, 142, 121, 142, 144, // 800-807
+141, 158, 159, 148, 138,  99, 108, 104, // 808-815
+ 78, 130, 106, 130, 143, 125, 125, 130, // 816-823
+124, 112, 141, 116, 135, 150, 133, 153, // 824-831
+167, 140, 154, 132,  73, 144,  70,  99, // 832-839
+138,  91, 149, 127, 125, 135, 121, 126, // 840-847
+121, 131, 124, 134, 143, 134, 159, 152, // 848-855
+157, 139, 121, 100, 111,  91,  98, 126, // 856-863
+109, 145, 125, 129, 137, 111, 138, 115, // 864-871
+131, 128, 135, 143, 140, 158, 158, 141, // 872-879
+147, 100, 111, 115,  73, 131, 103, 124, // 880-887
+143, 117, 141, 129, 119, 131, 120, 130, // 888-895
+125, 141, 136, 152, 148, 156, 141, 137, // 896-903
+110, 110, 108,  86, 126,  96, 131, 132, // 904-911
+121, 145, 121, 132, 128, 121, 131, 124, // 912-919
+141, 138, 147, 154, 150, 142, 136,  99, // 920-927
+126,  97,  92, 127,  97, 127, 135, 115, // 928-935
+142, 128, 125, 135, 124, 125, 133, 133, // 936-943
+142, 149, 151, 152, 141, 133, 103, 125, // 944-951
+ 94, 105, 118, 104, 126, 128, 121, 138, // 952-959
+128, 131, 129, 127, 128, 132, 135, 142, // 960-967
+145, 159, 141, 147, 128, 101, 132,  84, // 968-975
+115, 117, 102, 129, 124, 120, 138, 127, // 976-983
+127, 135, 125, 129, 135, 130, 144, 144, // 984-991
+155, 142, 144, 129, 101, 134,  85, 113, // 992-999
+120,  98, 139, 113, 132, 129, 127, 133, // 1000-1007
+125, 134, 127, 133, 135, 140, 146, 147, // 1008-1015
+152, 132, 137, 109, 116, 111,  96, 127, // 1016-1023
+103, 125, 125, 121, 132, 127, 129, 132, // 1024-1031
+129, 130, 133, 135, 140, 147, 145, 150, // 1032-1039
+135, 131, 117, 113, 110, 101, 120, 106, // 1040-1047
+123, 126, 118, 138, 120, 131, 133, 123, // 1048-1055
+136, 129, 137, 139, 143, 148, 144, 142, // 1056-1063
+127, 125, 111, 115, 106, 110, 119, 109, // 1064-1071
+133, 119, 121, 143, 114, 138, 131, 121, // 1072-1079
+144, 124, 143, 144, 145, 149, 140, 135, // 1080-1087
+122, 120, 108, 110, 109, 110, 118, 118, // 1088-1095
+129, 123, 132, 127, 129, 131, 129, 132, // 1096-1103
+135, 134, 143, 138, 154, 135, 142, 133, // 1104-1111
+111, 130,  98, 114, 110, 105, 123, 123, // 1112-1119
+120, 138, 121, 133, 133, 120, 141, 125, // 1120-1127
+141, 136, 143, 150, 139, 147, 128, 122, // 1128-1135
+127, 101, 118, 104, 110, 120, 117, 124, // 1136-1143
+127, 129, 127, 135, 123, 137, 130, 133, // 1144-1151
+140, 137, 148, 144, 142, 140, 124, 124, // 1152-1159
+114, 109, 109, 110, 110, 125, 119, 124, // 1160-1167
+134, 120, 134, 128, 127, 137, 129, 137, // 1168-1175
+139, 144, 147, 143, 143, 125, 129, 114, // 1176-1183
+108, 112, 106, 113, 119, 121, 122, 134, // 1184-1191
+123, 132, 130, 127, 136, 128, 137, 135, // 1192-1199
+139, 148, 138, 146, 136, 118, 131, 103, // 1200-1207
+112, 112, 106, 122, 122, 120, 129, 130, // 1208-1215
+123, 137, 124, 134, 133, 128, 140, 136, // 1216-1223
+142, 147, 139, 144, 123, 129, 112, 107, // 1224-1231
+116, 101, 120, 118, 121, 129, 126, 128, // 1232-1239
+134, 128, 134, 131, 131, 137, 132, 142, // 1240-1247
+144, 141, 144, 133, 122, 126, 107, 111, // 1248-1255
+113, 104, 125, 118, 121, 134, 121, 133, // 1256-1263
+130, 126, 136, 127, 135, 134, 138, 143, // 1264-1271
+144, 143, 140, 128, 125, 118, 107, 114, // 1272-1279
+109, 112, 123, 120, 125, 126, 128, 126, // 1280-1287
+132, 130, 127, 137, 127, 138, 137, 145, // 1288-1295
+145, 136, 149, 115, 131, 117, 100, 127, // 1296-1303
+100, 118, 126, 113, 132, 127, 122, 139, // 1304-1311
+120, 132, 131, 125, 139, 132, 141, 147, // 1312-1319
+141, 143, 134, 126, 122, 117, 107, 118, // 1320-1327
+108, 117, 123, 116, 132, 125, 127, 135, // 1328-1335
+122, 136, 124, 133, 133, 136, 141, 146, // 1336-1343
+140, 146, 133, 124, 129, 106, 117, 110, // 1344-1351
+110, 119, 122, 118, 135, 116, 139, 119, // 1352-1359
+128, 135, 118, 143, 126, 138, 144, 142, // 1360-1367
+145, 142, 138, 125, 125, 117, 107, 117, // 1368-1375
+110, 111, 130, 111, 132, 125, 123, 135, // 1376-1383
+121, 130, 130, 127, 138, 131, 144, 141, // 1384-1391
+147, 142, 142, 126, 130, 116, 112, 115, // 1392-1399
+108, 114, 121, 117, 125, 127, 121, 131, // 1400-1407
+124, 127, 131, 126, 136, 132, 139, 145, // 1408-1415
+144, 146, 144, 133, 128, 125, 109, 114, // 1416-1423
+111, 107, 117, 123, 112, 136, 116, 129, // 1424-1431
+130, 121, 135, 126, 130, 138, 128, 149, // 1432-1439
+139, 150, 143, 142, 128, 131, 115, 112, // 1440-1447
+113, 106, 114, 115, 122, 117, 131, 123, // 1448-1455
+124, 135, 117, 138, 124, 133, 139, 132, // 1456-1463
+148, 143, 145, 150, 136, 130, 129, 111, // 1464-1471
+115, 106, 113, 106, 120, 119, 117, 133, // 1472-1479
+122, 123, 138, 114, 139, 125, 130, 143, // 1480-1487
+130, 152, 142, 147, 148, 136, 130, 128, // 1488-1495
+110, 114, 105, 110, 106, 119, 120, 119, // 1496-1503
+134, 117, 140, 117, 134, 128, 123, 142, // 1504-1511
+127, 143, 144, 142, 151, 140, 147, 122, // 1512-1519
+131, 113, 107, 115, 100, 115, 111, 125, // 1520-1527
+120, 129, 130, 123, 135, 124, 130, 132, // 1528-1535
+125, 142, 131, 143, 143, 145, 140, 145, // 1536-1543
+133, 118, 130, 101, 113, 110, 106, 115, // 1544-1551
+121, 124, 122, 137, 123, 132, 133, 124, // 1552-1559
+136, 127, 132, 140, 130, 146, 136, 143, // 1560-1567
+137, 140, 125, 123, 121, 106, 113, 109, // 1568-1575
+112, 114, 128, 120, 131, 133, 125, 136, // 1576-1583
+128, 130, 133, 129, 134, 136, 132, 140, // 1584-1591
+135, 142, 132, 144, 123, 123, 128, 100, // 1592-1599
+121, 105, 113, 116, 123, 127, 125, 137, // 1600-1607
+126, 132, 133, 124, 134, 126, 133, 134, // 1608-1615
+131, 139, 136, 141, 135, 143, 131, 121, // 1616-1623
+135, 102, 119, 110, 107, 120, 120, 126, // 1624-1631
+131, 127, 136, 125, 129, 129, 121, 133, // 1632-1639
+126, 132, 136, 134, 140, 139, 143, 132, // 1640-1647
+151, 120, 129, 130,  97, 128, 102, 113, // 1648-1655
+124, 116, 132, 124, 129, 128, 122, 128, // 1656-1663
+119, 129, 125, 133, 133, 136, 138, 135, // 1664-1671
+145, 137, 137, 149, 118, 138, 120, 110, // 1672-1679
+119, 106, 113, 120, 119, 127, 127, 125, // 1680-1687
+128, 124, 124, 126, 128, 129, 137, 133, // 1688-1695
+139, 138, 137, 140, 141, 133, 144, 131, // 1696-1703
+121, 133, 104, 116, 112, 106, 120, 118, // 1704-1711
+122, 131, 126, 126, 130, 121, 131, 128, // 1712-1719
+128, 141, 132, 139, 140, 134, 139, 137, // 1720-1727
+136, 130, 146, 116, 128, 125,  96, 123, // 1728-1735
+105, 108, 126, 116, 129, 129, 128, 124, // 1736-1743
+134, 118, 130, 134, 123, 149, 129, 138, // 1744-1751
+142, 126, 139, 133, 130, 139, 136, 130, // 1752-1759
+124, 129, 106, 115, 114, 104, 126, 118, // 1760-1767
+126, 132, 125, 126, 130, 123, 126, 133, // 1768-1775
+124, 140, 133, 133, 140, 129, 133, 139, // 1776-1783
+131, 138, 139, 141, 121, 133, 118, 101, // 1784-1791
+126,  99, 117, 126, 117, 130, 130, 121, // 1792-1799
+127, 130, 116, 132, 131, 125, 147, 126, // 1800-1807
+140, 139, 127, 140, 134, 132, 143, 134, // 1808-1815
+144, 116, 129, 115,  99, 124, 100, 119, // 1816-1823
+126, 117, 134, 126, 128, 123, 126, 131, // 1824-1831
+117, 146, 122, 143, 140, 129, 142, 129, // 1832-1839
+131, 143, 124, 144, 132, 137, 127, 112, // 1840-1847
+130,  92, 123, 109, 110, 132, 119, 129, // 1848-1855
+132, 124, 123, 131, 119, 129, 135, 124, // 1856-1863
+143, 135, 133, 139, 129, 133, 135, 135, // 1864-1871
+131, 138, 134, 136, 115, 124, 117, 100, // 1872-1879
+126, 106, 119, 131, 120, 129, 133, 117, // 1880-1887
+130, 127, 117, 140, 125, 135, 141, 129, // 1888-1895
+140, 134, 131, 133, 134, 135, 132, 140, // 1896-1903
+134, 138, 111, 126, 115,  98, 125, 109, // 1904-1911
+118, 130, 121, 126, 131, 120, 121, 135, // 1912-1919
+116, 135, 138, 125, 146, 133, 131, 140, // 1920-1927
+127, 133, 135, 134, 130, 141, 133, 138, // 1928-1935
+123, 108, 132,  93, 118, 117, 111, 128, // 1936-1943
+128, 120, 135, 127, 122, 128, 132, 123, // 1944-1951
+135, 139, 129, 140, 134, 126, 136, 127, // 1952-1959
+128, 137, 132, 129, 143, 130, 139, 110, // 1960-1967
+123, 121,  94, 131, 109, 119, 138, 120, // 1968-1975
+128, 134, 121, 121, 135, 121, 125, 144, // 1976-1983
+122, 142, 134, 125, 136, 128, 126, 134, // 1984-1991
+131, 137, 133, 141, 138, 137, 106, 131, // 1992-1999
+108, 101, 126, 108, 122, 134, 121, 129, // 2000-2007
+130, 124, 119, 133, 125, 123, 146, 124, // 2008-2015
+139, 139, 124, 135, 130, 126, 135, 135, // 2016-2023
+136, 131, 144, 132, 139, 111, 113, 123, // 2024-2031
+ 94, 120, 119, 117, 132, 131, 122, 133, // 2032-2039
+126, 125, 126, 125, 137, 124, 139, 139, // 2040-2047
+126, 139, 126, 122, 133, 126, 131, 140, // 2048-2055
+126, 138, 141, 132, 134, 101, 128, 109, // 2056-2063
+100, 130, 116, 123, 139, 126, 125, 134, // 2064-2071
+125, 123, 125, 131, 129, 129, 141, 130, // 2072-2079
+129, 135, 122, 126, 132, 125, 135, 139, // 2080-2087
+130, 142, 139, 137, 132,  95, 132, 108, // 2088-2095
+ 94, 137, 115, 121, 141, 125, 124, 133, // 2096-2103
+123, 120, 125, 137, 119, 139, 141, 125, // 2104-2111
+137, 132, 122, 133, 127, 129, 138, 136, // 2112-2119
+131, 138, 138, 134, 126,  98, 126, 107, // 2120-2127
+100, 128, 123, 121, 138, 130, 124, 130, // 2128-2135
+127, 122, 126, 135, 127, 133, 141, 127, // 2136-2143
+131, 133, 123, 128, 129, 128, 133, 138, // 2144-2151
+134, 134, 138, 137, 136, 105, 111, 128, // 2152-2159
+ 93, 118, 132, 118, 127, 139, 121, 127, // 2160-2167
+128, 127, 122, 130, 121, 136, 135, 123, // 2168-2175
+141, 130, 123, 136, 126, 127, 137, 133, // 2176-2183
+138, 134, 137, 138, 132, 136,  96, 115, // 2184-2191
+125,  90, 122, 134, 118, 130, 138, 121, // 2192-2199
+126, 129, 125, 120, 129, 134, 129, 132, // 2200-2207
+140, 127, 130, 132, 125, 127, 134, 129, // 2208-2215
+137, 138, 132, 135, 138, 133, 133,  96, // 2216-2223
+114, 125,  98, 115, 140, 124, 124, 139, // 2224-2231
+125, 122, 129, 123, 120, 136, 127, 133, // 2232-2239
+136, 132, 129, 130, 127, 126, 128, 130, // 2240-2247
+131, 134, 140, 133, 137, 139, 133, 137, // 2248-2255
+103, 104, 130, 101, 110, 138, 128, 121, // 2256-2263
+138, 125, 121, 125, 125, 117, 128, 137, // 2264-2271
+126, 135, 139, 128, 127, 132, 126, 127, // 2272-2279
+131, 131, 135, 138, 136, 134, 136, 134, // 2280-2287
+133, 124,  94, 117, 126,  99, 122, 140, // 2288-2295
+121, 123, 134, 124, 121, 127, 128, 125, // 2296-2303
+124, 144, 133, 126, 140, 132, 119, 132, // 2304-2311
+130, 124, 131, 134, 136, 137, 134, 135, // 2312-2319
+133, 128, 136, 123,  95, 118, 126, 101, // 2320-2327
+119, 139, 124, 121, 133, 127, 123, 125, // 2328-2335
+129, 124, 129, 138, 130, 131, 136, 129, // 2336-2343
+127, 130, 128, 129, 131, 132, 138, 138, // 2344-2351
+135, 134, 131, 132, 132, 124, 100, 112, // 2352-2359
+128, 105, 113, 140, 126, 118, 134, 128, // 2360-2367
+122, 127, 127, 128, 130, 132, 135, 132, // 2368-2375
+130, 131, 129, 126, 129, 131, 129, 131, // 2376-2383
+137, 137, 134, 133, 130, 129, 132, 130, // 2384-2391
+107, 104, 128, 113, 106, 134, 134, 119, // 2392-2399
+129, 132, 126, 124, 128, 127, 126, 131, // 2400-2407
+135, 132, 128, 131, 132, 126, 127, 131, // 2408-2415
+128, 129, 134, 136, 137, 134, 129, 133, // 2416-2423
+132, 130, 122, 106, 112, 122, 113, 115, // 2424-2431
+133, 131, 122, 129, 130, 125, 125, 128, // 2432-2439
+131, 130, 128, 136, 135, 126, 132, 134, // 2440-2447
+124, 126, 130, 127, 128, 134, 137, 137, // 2448-2455
+130, 130, 131, 127, 130, 122, 101, 115, // 2456-2463
+128, 109, 115, 138, 130, 120, 130, 132, // 2464-2471
+124, 125, 128, 133, 128, 129, 139, 131, // 2472-2479
+124, 133, 131, 122, 128, 131, 128, 130, // 2480-2487
+135, 137, 135, 130, 129, 132, 128, 129, // 2488-2495
+127, 106, 112, 127, 114, 112, 131, 133, // 2496-2503
+122, 126, 131, 128, 122, 127, 135, 127, // 2504-2511
+126, 138, 132, 124, 132, 132, 125, 127, // 2512-2519
+130, 129, 129, 133, 137, 138, 131, 129, // 2520-2527
+131, 130, 128, 129, 114, 101, 123, 124, // 2528-2535
+109, 123, 140, 126, 121, 131, 131, 124, // 2536-2543
+123, 130, 132, 130, 128, 135, 134, 127, // 2544-2551
+128, 133, 127, 124, 130, 131, 130, 133, // 2552-2559
+136, 135, 129, 127, 129, 131, 130, 123, // 2560-2567
+110, 114, 125, 116, 115, 131, 135, 123, // 2568-2575
+125, 132, 129, 125, 128, 131, 132, 126, // 2576-2583
+129, 136, 129, 125, 131, 132, 122, 126, // 2584-2591
+130, 129, 130, 135, 137, 132, 127, 129, // 2592-2599
+132, 128, 129, 127, 108, 112, 128, 118, // 2600-2607
+112, 130, 137, 124, 124, 131, 132, 124, // 2608-2615
+127, 131, 129, 129, 130, 131, 130, 130, // 2616-2623
+128, 128, 128, 128, 127, 129, 133, 136, // 2624-2631
+135, 132, 129, 128, 129, 128, 130, 128, // 2632-2639
+109, 108, 127, 122, 111, 128, 140, 126, // 2640-2647
+123, 132, 132, 125, 126, 131, 128, 126, // 2648-2655
+131, 132, 129, 129, 130, 128, 128, 127, // 2656-2663
+126, 130, 133, 134, 133, 134, 130, 128, // 2664-2671
+127, 130, 130, 127, 119, 108, 118, 126, // 2672-2679
+117, 119, 134, 133, 124, 126, 131, 130, // 2680-2687
+126, 127, 131, 131, 125, 127, 136, 132, // 2688-2695
+124, 129, 134, 127, 121, 127, 133, 134, // 2696-2703
+133, 134, 134, 129, 127, 129, 130, 129, // 2704-2711
+125, 111, 111, 124, 123, 116, 124, 136, // 2712-2719
+130, 123, 125, 132, 129, 126, 127, 132, // 2720-2727
+129, 123, 131, 134, 128, 126, 132, 129, // 2728-2735
+125, 125, 128, 133, 136, 135, 133, 132, // 2736-2743
+127, 127, 128, 129, 130, 127, 109, 110, // 2744-2751
+126, 124, 116, 127, 137, 131, 124, 124, // 2752-2759
+131, 130, 125, 125, 131, 129, 123, 128, // 2760-2767
+134, 131, 126, 129, 128, 126, 125, 127, // 2768-2775
+132, 137, 136, 131, 131, 129, 128, 128, // 2776-2783
+129, 130, 127, 110, 109, 125, 127, 119, // 2784-2791
+125, 137, 134, 125, 122, 128, 131, 127, // 2792-2799
+124, 126, 128, 130, 130, 126, 128, 131, // 2800-2807
+128, 123, 125, 126, 130, 132, 135, 137, // 2808-2815
+136, 130, 126, 129, 131, 130, 129, 127, // 2816-2823
+114, 111, 121, 126, 122, 125, 133, 131, // 2824-2831
+127, 124, 126, 130, 130, 126, 127, 127, // 2832-2839
+128, 131, 129, 128, 129, 130, 127, 125, // 2840-2847
+124, 128, 132, 136, 136, 134, 130, 129, // 2848-2855
+129, 127, 130, 133, 128, 112, 107, 120, // 2856-2863
+128, 124, 122, 129, 133, 130, 124, 123, // 2864-2871
+129, 132, 128, 124, 124, 131, 135, 129, // 2872-2879
+125, 128, 131, 126, 124, 125, 129, 134, // 2880-2887
+136, 135, 134, 131, 128, 127, 128, 129, // 2888-2895
+132, 129, 114, 107, 117, 127, 127, 125, // 2896-2903
+126, 130, 133, 127, 122, 127, 133, 132, // 2904-2911
+127, 123, 126, 135, 134, 127, 125, 128, // 2912-2919
+130, 128, 124, 125, 132, 138, 139, 134, // 2920-2927
+127, 126, 129, 129, 128, 129, 130, 121, // 2928-2935
+110, 112, 121, 127, 128, 127, 127, 130, // 2936-2943
+129, 127, 126, 127, 130, 131, 125, 124, // 2944-2951
+131, 132, 131, 129, 126, 126, 129, 127, // 2952-2959
+126, 129, 134, 138, 136, 131, 127, 128, // 2960-2967
+129, 130, 131, 130, 121, 112, 113, 120, // 2968-2975
+126, 128, 128, 127, 129, 129, 127, 127, // 2976-2983
+127, 129, 131, 127, 125, 129, 131, 131, // 2984-2991
+129, 126, 125, 127, 128, 127, 129, 132, // 2992-2999
+136, 137, 132, 126, 127, 129, 130, 131, // 3000-3007
+131, 125, 113, 110, 118, 126, 130, 130, // 3008-3015
+127, 126, 128, 129, 129, 127, 127, 127, // 3016-3023
+126, 127, 130, 130, 130, 129, 127, 127, // 3024-3031
+128, 126, 126, 129, 132, 136, 136, 132, // 3032-3039
+127, 127, 128, 129, 130, 130, 125, 114, // 3040-3047
+111, 116, 124, 131, 132, 129, 126, 126, // 3048-3055
+128, 130, 129, 128, 127, 126, 127, 131, // 3056-3063
+131, 130, 129, 126, 126, 127, 128, 127, // 3064-3071
+129, 131, 135, 136, 133, 128, 125, 126, // 3072-3079
+129, 131, 131, 126, 115, 110, 112, 121, // 3080-3087
+130, 134, 131, 127, 124, 125, 130, 132, // 3088-3095
+131, 127, 124, 124, 130, 132, 133, 129, // 3096-3103
+125, 124, 126, 129, 130, 130, 130, 134, // 3104-3111
+136, 134, 132, 127, 124, 125, 129, 132, // 3112-3119
+128, 117, 110, 111, 120, 130, 136, 134, // 3120-3127
+127, 122, 123, 128, 132, 134, 130, 124, // 3128-3135
+123, 127, 131, 134, 132, 127, 123, 123, // 3136-3143
+127, 131, 133, 132, 133, 133, 133, 130, // 3144-3151
+128, 126, 127, 129, 129, 123, 115, 111, // 3152-3159
+113, 121, 130, 135, 134, 128, 123, 122, // 3160-3167
+125, 131, 134, 132, 128, 124, 125, 129, // 3168-3175
+133, 133, 129, 125, 124, 125, 129, 134, // 3176-3183
+136, 136, 134, 130, 127, 126, 128, 130, // 3184-3191
+131, 127, 118, 111, 110, 115, 125, 133, // 3192-3199
+137, 134, 128, 122, 121, 125, 131, 133, // 3200-3207
+132, 128, 125, 125, 127, 130, 132, 130, // 3208-3215
+127, 125, 125, 128, 133, 137, 137, 134, // 3216-3223
+130, 126, 126, 128, 131, 131, 125, 116, // 3224-3231
+110, 111, 117, 127, 135, 137, 134, 128, // 3232-3239
+122, 120, 124, 129, 132, 133, 130, 128, // 3240-3247
+126, 127, 128, 130, 130, 128, 126, 126, // 3248-3255
+129, 133, 136, 136, 133, 128, 126, 126, // 3256-3263
+129, 131, 128, 120, 113, 111, 113, 121, // 3264-3271
+130, 136, 137, 133, 128, 123, 121, 124, // 3272-3279
+129, 132, 133, 132, 129, 127, 127, 128, // 3280-3287
+128, 129, 128, 128, 129, 132, 135, 135, // 3288-3295
+133, 130, 127, 126, 128, 129, 127, 121, // 3296-3303
+115, 111, 113, 119, 127, 134, 137, 135, // 3304-3311
+131, 126, 124, 124, 126, 128, 130, 132, // 3312-3319
+131, 130, 128, 127, 127, 127, 126, 128, // 3320-3327
+130, 132, 135, 136, 134, 131, 128, 127, // 3328-3335
+127, 128, 127, 122, 116, 112, 112, 117, // 3336-3343
+125, 132, 136, 136, 132, 128, 126, 124, // 3344-3351
+125, 127, 128, 130, 130, 130, 130, 129, // 3352-3359
+128, 127, 127, 128, 129, 132, 134, 136, // 3360-3367
+134, 132, 130, 129, 128, 127, 124, 120, // 3368-3375
+116, 113, 114, 119, 125, 130, 134, 135, // 3376-3383
+132, 129, 127, 126, 126, 127, 127, 128, // 3384-3391
+129, 129, 129, 129, 128, 127, 127, 128, // 3392-3399
+129, 132, 135, 136, 135, 132, 130, 129, // 3400-3407
+129, 127, 122, 118, 115, 115, 116, 121, // 3408-3415
+126, 131, 134, 134, 132, 130, 128, 126, // 3416-3423
+126, 126, 127, 128, 129, 129, 128, 128, // 3424-3431
+128, 127, 127, 128, 130, 133, 135, 135, // 3432-3439
+133, 132, 130, 129, 129, 124, 118, 115, // 3440-3447
+114, 115, 120, 124, 128, 132, 134, 133, // 3448-3455
+131, 130, 129, 128, 127, 127, 127, 128, // 3456-3463
+128, 128, 128, 128, 128, 128, 129, 129, // 3464-3471
+131, 133, 134, 133, 133, 132, 131, 130, // 3472-3479
+126, 119, 114, 113, 114, 118, 123, 128, // 3480-3487
+132, 133, 132, 130, 129, 129, 128, 128, // 3488-3495
+128, 127, 127, 128, 128, 128, 128, 128, // 3496-3503
+128, 129, 130, 131, 134, 135, 133, 132, // 3504-3511
+132, 132, 130, 125, 119, 115, 114, 114, // 3512-3519
+117, 122, 127, 131, 133, 131, 129, 128, // 3520-3527
+128, 128, 128, 128, 128, 128, 128, 128, // 3528-3535
+127, 128, 128, 129, 130, 131, 134, 135, // 3536-3543
+136, 134, 133, 133, 132, 129, 123, 116, // 3544-3551
+112, 111, 114, 119, 124, 130, 132, 132, // 3552-3559
+131, 129, 128, 128, 128, 128, 128, 128, // 3560-3567
+129, 129, 128, 127, 127, 128, 128, 130, // 3568-3575
+133, 135, 137, 136, 135, 133, 131, 127, // 3576-3583
+120, 114, 112, 112, 114, 119, 124, 129, // 3584-3591
+133, 134, 132, 130, 128, 127, 128, 128, // 3592-3599
+128, 128, 129, 128, 128, 129, 128, 129, // 3600-3607
+130, 131, 133, 136, 137, 136, 134, 133, // 3608-3615
+132, 127, 120, 113, 110, 111, 114, 119, // 3616-3623
+125, 129, 133, 134, 132, 130, 129, 127, // 3624-3631
+126, 127, 128, 129, 130, 130, 129, 128, // 3632-3639
+129, 129, 130, 132, 134, 136, 136, 136, // 3640-3647
+135, 134, 129, 121, 114, 109, 109, 112, // 3648-3655
+118, 123, 128, 133, 134, 132, 130, 128, // 3656-3663
+127, 127, 128, 129, 131, 132, 131, 130, // 3664-3671
+129, 127, 126, 128, 131, 134, 137, 137, // 3672-3679
+136, 136, 134, 128, 120, 112, 108, 108, // 3680-3687
+113, 119, 124, 129, 133, 133, 132, 130, // 3688-3695
+128, 127, 128, 128, 130, 132, 132, 132, // 3696-3703
+130, 128, 127, 127, 130, 132, 135, 136, // 3704-3711
+136, 136, 136, 131, 122, 114, 108, 107, // 3712-3719
+111, 118, 124, 130, 133, 133, 131, 129, // 3720-3727
+127, 126, 126, 127, 129, 132, 133, 133, // 3728-3735
+131, 129, 127, 127, 129, 132, 135, 137, // 3736-3743
+138, 138, 136, 130, 120, 112, 108, 108, // 3744-3751
+113, 120, 126, 131, 134, 133, 130, 128, // 3752-3759
+124, 123, 125, 128, 130, 134, 135, 132, // 3760-3767
+129, 127, 125, 128, 131, 134, 137, 140, // 3768-3775
+140, 139, 134, 124, 113, 107, 104, 108, // 3776-3783
+116, 124, 131, 135, 135, 132, 128, 125, // 3784-3791
+123, 124, 126, 128, 132, 134, 134, 132, // 3792-3799
+128, 126, 127, 130, 133, 138, 141, 142, // 3800-3807
+141, 135, 124, 112, 105, 103, 109, 118, // 3808-3815
+127, 134, 136, 135, 130, 126, 122, 122, // 3816-3823
+124, 127, 131, 135, 136, 134, 130, 126, // 3824-3831
+124, 125, 129, 133, 139, 142, 142, 139, // 3832-3839
+130, 117, 107, 102, 104, 113, 125, 134, // 3840-3847
+139, 138, 133, 126, 122, 119, 120, 125, // 3848-3855
+132, 137, 138, 136, 132, 127, 123, 124, // 3856-3863
+127, 133, 140, 144, 144, 141, 130, 114, // 3864-3871
+102,  98, 103, 115, 130, 139, 144, 139, // 3872-3879
+130, 120, 115, 114, 119, 127, 137, 142, // 3880-3887
+142, 138, 129, 122, 119, 121, 127, 137, // 3888-3895
+146, 151, 149, 139, 121, 103,  93,  95, // 3896-3903
+107, 125, 140, 147, 145, 135, 121, 110, // 3904-3911
+109, 114, 125, 138, 146, 146, 142, 131, // 3912-3919
+120, 115, 118, 124, 136, 148, 153, 151, // 3920-3927
+141, 122, 101,  90,  92, 104, 125, 143, // 3928-3935
+149, 145, 133, 117, 106, 108, 115, 129, // 3936-3943
+144, 152, 147, 139, 127, 116, 115, 121, // 3944-3951
+131, 142, 154, 154, 146, 133, 113,  94, // 3952-3959
+ 90,  99, 113, 135, 148, 147, 136, 122, // 3960-3967
+107, 103, 113, 127, 141, 151, 150, 137, // 3968-3975
+127, 117, 115, 122, 135, 143, 150, 152, // 3976-3983
+143, 133, 120, 106,  96, 100, 110, 125, // 3984-3991
+139, 144, 136, 125, 115, 107, 112, 123, // 3992-3999
+135, 142, 145, 137, 127, 123, 121, 125, // 4000-4007
+135, 143, 145, 146, 143, 136, 129, 117, // 4008-4015
+103,  96, 103, 114, 131, 144, 142, 131, // 4016-4023
+118, 108, 108, 120, 133, 142, 144, 139, // 4024-4031
+127, 123, 122, 129, 136, 144, 143, 142, // 4032-4039
+141, 139, 133, 122, 107,  96,  99, 111, // 4040-4047
+129, 141, 143, 129, 118, 107, 112, 121, // 4048-4055
+137, 142, 140, 132, 124, 126, 129, 138, // 4056-4063
+140, 142, 138, 139, 140, 141, 135, 116, // 4064-4071
+100,  90,  99, 118, 139, 145, 136, 119, // 4072-4079
+106, 107, 121, 135, 143, 137, 130, 123, // 4080-4087
+127, 137, 143, 143, 135, 131, 131, 145, // 4088-4095
+151, 148, 124,  98,  81,  93, 118, 141, // 4096-4103
+146, 132, 112, 106, 114, 132, 136, 136, // 4104-4111
+122, 119, 125, 138, 149, 143, 136, 121, // 4112-4119
+128, 136, 157, 157, 148, 116,  94,  87, // 4120-4127
+106, 127, 136, 132, 116, 113, 119, 129, // 4128-4135
+135, 126, 119, 113, 123, 139, 145, 147, // 4136-4143
+131, 129, 125, 139, 146, 153, 148, 136, // 4144-4151
+114, 102, 100, 113, 124, 126, 125, 117, // 4152-4159
+121, 124, 128, 128, 121, 124, 120, 133, // 4160-4167
+134, 140, 137, 133, 135, 133, 142, 144, // 4168-4175
+150, 143, 132, 108, 101, 100, 121, 124, // 4176-4183
+129, 120, 115, 120, 123, 131, 123, 123, // 4184-4191
+122, 125, 136, 134, 140, 131, 137, 134, // 4192-4199
+140, 142, 146, 146, 139, 118, 102,  98, // 4200-4207
+112, 127, 127, 126, 113, 121, 121, 129, // 4208-4215
+123, 121, 124, 125, 136, 136, 139, 136, // 4216-4223
+137, 140, 135, 141, 139, 146, 139, 128, // 4224-4231
+102, 100, 106, 129, 126, 125, 116, 116, // 4232-4239
+127, 123, 128, 112, 128, 122, 136, 133, // 4240-4247
+134, 138, 140, 146, 134, 137, 140, 148, // 4248-4255
+144, 124, 100,  95, 113, 132, 128, 119, // 4256-4263
+113, 119, 129, 125, 120, 114, 129, 127, // 4264-4271
+132, 124, 134, 139, 151, 145, 134, 135, // 4272-4279
+145, 150, 136, 109,  93, 105, 128, 140, // 4280-4287
+122, 119, 114, 129, 123, 118, 111, 124, // 4288-4295
+137, 131, 124, 122, 137, 147, 148, 138, // 4296-4303
+128, 148, 152, 151, 120,  97,  97, 112, // 4304-4311
+135, 122, 120, 118, 130, 130, 114, 112, // 4312-4319
+111, 139, 130, 127, 116, 133, 150, 149, // 4320-4327
+146, 124, 144, 148, 155, 129, 103,  97, // 4328-4335
+110, 129, 128, 114, 119, 125, 135, 120, // 4336-4343
+109, 118, 129, 145, 118, 123, 118, 152, // 4344-4351
+147, 147, 129, 138, 154, 150, 134, 102, // 4352-4359
+ 98, 110, 125, 131, 114, 121, 124, 132, // 4360-4367
+119, 110, 118, 129, 142, 120, 122, 119, // 4368-4375
+151, 145, 149, 131, 143, 153, 147, 133, // 4376-4383
+101, 101, 109, 122, 132, 116, 124, 120, // 4384-4391
+132, 119, 114, 113, 128, 138, 127, 118, // 4392-4399
+121, 144, 150, 147, 132, 141, 154, 151, // 4400-4407
+130,  99,  97, 114, 126, 132, 118, 125, // 4408-4415
+124, 128, 115, 110, 121, 133, 138, 120, // 4416-4423
+119, 124, 148, 145, 144, 132, 146, 154, // 4424-4431
+144, 129,  97, 107, 108, 127, 125, 120, // 4432-4439
+127, 121, 129, 109, 120, 120, 136, 131, // 4440-4447
+121, 120, 127, 149, 144, 149, 132, 154, // 4448-4455
+145, 146, 111,  99, 105, 118, 133, 120, // 4456-4463
+124, 119, 128, 120, 112, 115, 126, 140, // 4464-4471
+129, 123, 119, 139, 145, 147, 138, 143, // 4472-4479
+156, 148, 129, 101,  98, 114, 122, 131, // 4480-4487
+121, 127, 125, 122, 114, 112, 122, 132, // 4488-4495
+132, 125, 120, 131, 144, 146, 144, 136, // 4496-4503
+152, 148, 140, 113,  96, 109, 117, 133, // 4504-4511
+121, 128, 123, 127, 116, 112, 118, 124, // 4512-4519
+139, 120, 128, 116, 145, 142, 150, 140, // 4520-4527
+143, 154, 140, 127,  94, 102, 119, 129, // 4528-4535
+130, 118, 127, 126, 121, 113, 111, 128, // 4536-4543
+136, 130, 121, 120, 139, 145, 146, 138, // 4544-4551
+143, 156, 146, 127, 102,  97, 115, 121, // 4552-4559
+132, 123, 128, 125, 119, 115, 115, 122, // 4560-4567
+132, 130, 125, 120, 131, 145, 148, 145, // 4568-4575
+138, 153, 147, 135, 104,  93, 111, 122, // 4576-4583
+133, 123, 128, 126, 122, 117, 113, 120, // 4584-4591
+129, 132, 124, 123, 128, 145, 145, 147, // 4592-4599
+135, 153, 149, 137, 108,  91, 113, 123, // 4600-4607
+132, 122, 123, 129, 121, 118, 111, 122, // 4608-4615
+133, 130, 120, 119, 130, 146, 145, 146, // 4616-4623
+136, 157, 146, 136, 105,  93, 111, 122, // 4624-4631
+135, 123, 127, 123, 124, 114, 113, 120, // 4632-4639
+133, 134, 121, 119, 128, 147, 146, 145, // 4640-4647
+135, 153, 152, 132, 108,  91, 114, 126, // 4648-4655
+132, 127, 123, 128, 118, 115, 113, 120, // 4656-4663
+134, 129, 124, 119, 129, 145, 144, 148, // 4664-4671
+138, 155, 149, 131, 108,  89, 115, 123, // 4672-4679
+135, 124, 128, 126, 120, 113, 112, 123, // 4680-4687
+134, 131, 119, 120, 132, 144, 144, 144, // 4688-4695
+141, 155, 149, 130, 107,  92, 115, 122, // 4696-4703
+136, 123, 127, 125, 121, 116, 110, 123, // 4704-4711
+133, 136, 117, 119, 130, 149, 147, 140, // 4712-4719
+137, 153, 155, 128, 103,  89, 120, 128, // 4720-4727
+132, 121, 126, 129, 118, 113, 115, 125, // 4728-4735
+135, 129, 121, 121, 131, 145, 143, 145, // 4736-4743
+135, 156, 148, 133, 106,  88, 118, 125, // 4744-4751
+139, 119, 125, 126, 123, 119, 112, 118, // 4752-4759
+128, 138, 121, 123, 124, 152, 141, 145, // 4760-4767
+131, 156, 149, 135, 107,  87, 117, 128, // 4768-4775
+137, 120, 121, 130, 122, 120, 113, 116, // 4776-4783
+136, 132, 124, 114, 132, 149, 144, 142, // 4784-4791
+129, 158, 148, 138, 108,  89, 115, 120, // 4792-4799
+140, 122, 127, 123, 120, 118, 117, 122, // 4800-4807
+122, 134, 124, 126, 124, 140, 149, 142, // 4808-4815
+138, 140, 157, 136, 128,  88, 106, 121, // 4816-4823
+135, 130, 116, 130, 122, 119, 112, 116, // 4824-4831
+134, 132, 125, 114, 129, 145, 144, 139, // 4832-4839
+135, 147, 154, 136, 134,  99, 103, 114, // 4840-4847
+127, 138, 115, 130, 114, 127, 112, 120, // 4848-4855
+122, 134, 130, 118, 122, 135, 150, 142, // 4856-4863
+139, 136, 153, 145, 136, 110,  95, 114, // 4864-4871
+122, 137, 119, 126, 121, 123, 116, 116, // 4872-4879
+125, 124, 135, 117, 128, 126, 148, 142, // 4880-4887
+142, 137, 145, 151, 137, 128,  92, 109, // 4888-4895
+116, 134, 126, 120, 127, 121, 120, 113, // 4896-4903
+124, 125, 127, 124, 121, 133, 136, 145, // 4904-4911
+141, 144, 139, 148, 142, 139, 109,  96, // 4912-4919
+111, 126, 134, 119, 124, 124, 125, 108, // 4920-4927
+123, 117, 135, 119, 122, 124, 136, 147, // 4928-4935
+136, 145, 134, 149, 141, 143, 133, 100, // 4936-4943
+106, 114, 134, 128, 119, 125, 124, 124, // 4944-4951
+110, 121, 119, 137, 119, 122, 124, 142, // 4952-4959
+145, 137, 140, 136, 151, 139, 141, 124, // 4960-4967
+ 99, 112, 114, 138, 123, 121, 127, 120, // 4968-4975
+125, 110, 126, 118, 134, 117, 125, 130, // 4976-4983
+142, 143, 136, 140, 135, 150, 137, 143, // 4984-4991
+114, 100, 110, 124, 137, 119, 123, 122, // 4992-4999
+127, 117, 116, 123, 126, 129, 118, 128, // 5000-5007
+131, 143, 138, 138, 139, 136, 149, 139, // 5008-5015
+144, 109, 103, 110, 125, 135, 118, 126, // 5016-5023
+122, 126, 114, 119, 125, 123, 129, 118, // 5024-5031
+132, 130, 141, 137, 138, 138, 135, 146, // 5032-5039
+145, 140, 119, 100, 113, 119, 133, 123, // 5040-5047
+124, 123, 122, 117, 117, 129, 123, 125, // 5048-5055
+118, 130, 132, 137, 137, 137, 139, 135, // 5056-5063
+141, 146, 140, 133, 103, 107, 117, 130, // 5064-5071
+129, 119, 124, 121, 124, 118, 124, 127, // 5072-5079
+117, 129, 117, 138, 127, 144, 134, 139, // 5080-5087
+134, 132, 148, 144, 143, 114, 102, 115, // 5088-5095
+121, 131, 120, 123, 127, 119, 126, 118, // 5096-5103
+132, 122, 115, 124, 125, 139, 129, 138, // 5104-5111
+137, 135, 133, 131, 154, 141, 137, 109, // 5112-5119
+107, 116, 126, 127, 122, 125, 126, 122, // 5120-5127
+124, 122, 131, 123, 113, 124, 128, 140, // 5128-5135
+131, 135, 136, 131, 134, 132, 155, 139, // 5136-5143
+136, 110, 108, 116, 123, 128, 122, 126, // 5144-5151
+125, 123, 124, 123, 128, 120, 119, 124, // 5152-5159
+127, 139, 132, 140, 128, 133, 129, 139, // 5160-5167
+148, 141, 135, 119, 108, 114, 119, 130, // 5168-5175
+121, 123, 122, 128, 126, 118, 129, 122, // 5176-5183
+120, 116, 132, 136, 140, 130, 134, 133, // 5184-5191
+135, 132, 139, 145, 138, 136, 108, 111, // 5192-5199
+118, 125, 124, 115, 128, 126, 127, 118, // 5200-5207
+127, 125, 119, 108, 132, 133, 142, 129, // 5208-5215
+137, 137, 128, 131, 131, 151, 142, 139, // 5216-5223
+132, 111, 111, 115, 123, 128, 114, 131, // 5224-5231
+120, 132, 112, 130, 123, 117, 116, 125, // 5232-5239
+141, 131, 138, 131, 138, 126, 133, 137, // 5240-5247
+147, 145, 135, 136, 108, 113, 115, 127, // 5248-5255
+124, 115, 126, 124, 128, 115, 129, 124, // 5256-5263
+122, 108, 132, 137, 139, 129, 131, 143, // 5264-5271
+126, 133, 127, 150, 141, 138, 135, 123, // 5272-5279
+107, 112, 116, 132, 113, 125, 123, 133, // 5280-5287
+118, 120, 128, 123, 117, 120, 139, 137, // 5288-5295
+138, 131, 141, 130, 128, 128, 140, 146, // 5296-5303
+138, 137, 131, 112, 108, 112, 125, 122, // 5304-5311
+119, 125, 127, 126, 117, 128, 121, 124, // 5312-5319
+118, 132, 137, 136, 138, 132, 137, 124, // 5320-5327
+131, 131, 141, 142, 139, 142, 128, 107, // 5328-5335
+110, 112, 127, 115, 122, 129, 126, 124, // 5336-5343
+111, 135, 122, 126, 108, 136, 142, 135, // 5344-5351
+132, 127, 146, 120, 132, 125, 148, 145, // 5352-5359
+143, 139, 130, 105, 105, 110, 131, 119, // 5360-5367
+118, 127, 129, 129, 113, 125, 126, 124, // 5368-5375
+122, 118, 143, 134, 141, 127, 134, 130, // 5376-5383
+126, 131, 133, 148, 143, 146, 131, 113, // 5384-5391
+105, 110, 120, 123, 120, 128, 126, 127, // 5392-5399
+118, 126, 124, 121, 121, 123, 137, 136, // 5400-5407
+140, 135, 134, 130, 125, 131, 132, 140, // 5408-5415
+143, 146, 140, 127, 102, 107, 110, 126, // 5416-5423
+116, 127, 128, 127, 120, 116, 129, 124, // 5424-5431
+122, 120, 131, 139, 135, 135, 136, 138, // 5432-5439
+126, 125, 131, 139, 140, 148, 141, 141, // 5440-5447
+120,  96, 105, 115, 129, 117, 121, 131, // 5448-5455
+124, 123, 114, 132, 128, 122, 118, 121, // 5456-5463
+147, 134, 139, 131, 140, 127, 121, 131, // 5464-5471
+137, 146, 142, 142, 137, 127,  96, 103, // 5472-5479
+113, 131, 118, 118, 132, 125, 124, 112, // 5480-5487
+130, 128, 124, 122, 121, 143, 139, 136, // 5488-5495
+132, 134, 133, 119, 130, 131, 145, 143, // 5496-5503
+145, 135, 135, 110,  97, 109, 125, 126, // 5504-5511
+115, 127, 130, 123, 120, 121, 131, 127, // 5512-5519
+124, 119, 131, 142, 137, 133, 135, 135, // 5520-5527
+123, 122, 129, 139, 141, 147, 140, 136, // 5528-5535
+129,  98, 102, 114, 128, 124, 117, 135, // 5536-5543
+124, 123, 116, 126, 129, 126, 122, 123, // 5544-5551
+131, 143, 136, 137, 132, 130, 124, 122, // 5552-5559
+131, 136, 145, 147, 137, 135, 129,  99, // 5560-5567
+105, 113, 131, 121, 118, 131, 126, 123, // 5568-5575
+117, 125, 131, 127, 126, 118, 137, 138, // 5576-5583
+138, 133, 134, 133, 120, 123, 126, 141, // 5584-5591
+140, 149, 139, 134, 132, 102, 103, 112, // 5592-5599
+127, 125, 113, 130, 126, 125, 118, 126, // 5600-5607
+129, 127, 123, 122, 131, 139, 139, 137, // 5608-5615
+133, 131, 122, 120, 126, 136, 140, 145, // 5616-5623
+146, 134, 139, 117,  99, 106, 116, 132, // 5624-5631
+114, 125, 129, 128, 120, 120, 132, 126, // 5632-5639
+128, 119, 128, 134, 141, 139, 134, 130, // 5640-5647
+124, 119, 123, 130, 138, 141, 146, 141, // 5648-5655
+134, 133, 112, 101, 110, 122, 130, 114, // 5656-5663
+127, 128, 129, 117, 121, 130, 124, 129, // 5664-5671
+125, 136, 126, 140, 136, 137, 125, 119, // 5672-5679
+128, 122, 133, 130, 146, 144, 141, 132, // 5680-5687
+137, 122,  97, 106, 120, 133, 115, 121, // 5688-5695
+133, 128, 120, 115, 133, 129, 128, 123, // 5696-5703
+130, 137, 128, 130, 138, 134, 126, 114, // 5704-5711
+130, 128, 132, 135, 147, 147, 133, 131, // 5712-5719
+134, 118,  95, 110, 123, 133, 110, 125, // 5720-5727
+130, 128, 118, 120, 134, 128, 126, 123, // 5728-5735
+130, 137, 133, 137, 133, 130, 120, 122, // 5736-5743
+125, 128, 135, 138, 143, 144, 139, 132, // 5744-5751
+137, 119,  96, 107, 120, 130, 111, 126, // 5752-5759
+133, 127, 117, 120, 132, 129, 125, 126, // 5760-5767
+132, 134, 132, 136, 135, 130, 120, 121, // 5768-5775
+125, 127, 130, 137, 143, 143, 140, 131, // 5776-5783
+135, 133, 102,  99, 117, 130, 122, 111, // 5784-5791
+136, 128, 125, 113, 129, 133, 129, 125, // 5792-5799
+129, 136, 131, 130, 134, 132, 125, 118, // 5800-5807
+127, 126, 129, 129, 140, 141, 143, 134, // 5808-5815
+132, 137, 133,  99, 103, 123, 128, 118, // 5816-5823
+112, 140, 127, 125, 115, 130, 131, 126, // 5824-5831
+122, 127, 137, 134, 126, 130, 136, 129, // 5832-5839
+120, 122, 129, 132, 128, 136, 140, 151, // 5840-5847
+135, 131, 133, 139, 113,  91, 117, 126, // 5848-5855
+126, 108, 130, 137, 124, 114, 119, 137, // 5856-5863
+126, 124, 123, 139, 137, 128, 128, 130, // 5864-5871
+133, 122, 122, 128, 130, 131, 129, 141, // 5872-5879
+141, 149, 133, 132, 135, 134, 101,  97, // 5880-5887
+122, 127, 122, 107, 138, 130, 121, 114, // 5888-5895
+126, 135, 124, 124, 129, 140, 136, 123, // 5896-5903
+131, 134, 130, 116, 122, 132, 131, 129, // 5904-5911
+133, 144, 142, 141, 131, 130, 132, 132, // 5912-5919
+113,  96, 123, 120, 127, 108, 131, 133, // 5920-5927
+121, 117, 120, 138, 127, 127, 129, 139, // 5928-5935
+136, 122, 129, 133, 132, 120, 124, 133, // 5936-5943
+129, 129, 131, 142, 139, 139, 137, 130, // 5944-5951
+133, 133, 125,  96, 111, 119, 126, 112, // 5952-5959
+121, 135, 126, 121, 119, 135, 130, 126, // 5960-5967
+125, 135, 137, 129, 125, 133, 133, 125, // 5968-5975
+119, 128, 130, 129, 129, 137, 141, 139, // 5976-5983
+138, 133, 129, 131, 133, 119,  95, 117, // 5984-5991
+118, 129, 108, 128, 134, 126, 119, 122, // 5992-5999
+135, 129, 125, 128, 136, 137, 123, 126, // 6000-6007
+136, 131, 123, 121, 133, 128, 126, 129, // 6008-6015
+138, 138, 134, 141, 137, 129, 129, 133, // 6016-6023
+125,  95, 110, 121, 127, 112, 121, 140, // 6024-6031
+127, 122, 119, 133, 131, 124, 128, 134, // 6032-6039
+139, 130, 126, 131, 128, 129, 119, 130, // 6040-6047
+126, 130, 129, 133, 137, 133, 137, 138, // 6048-6055
+129, 130, 131, 137, 109,  96, 123, 122, // 6056-6063
+125, 107, 138, 135, 122, 119, 126, 136, // 6064-6071
+126, 126, 133, 135, 135, 124, 130, 126, // 6072-6079
+131, 123, 125, 128, 127, 132, 128, 136, // 6080-6087
+133, 134, 135, 137, 130, 127, 134, 137, // 6088-6095
+110,  94, 121, 125, 124, 108, 136, 138, // 6096-6103
+123, 119, 126, 138, 126, 125, 131, 136, // 6104-6111
+132, 125, 132, 134, 124, 121, 121, 132, // 6112-6119
+128, 126, 131, 135, 137, 129, 132, 141, // 6120-6127
+136, 123, 130, 136, 131,  96, 103, 125, // 6128-6135
+123, 117, 115, 143, 133, 120, 119, 133, // 6136-6143
+135, 125, 127, 135, 133, 128, 125, 134, // 6144-6151
+129, 122, 126, 126, 131, 122, 130, 134, // 6152-6159
+132, 133, 129, 137, 138, 133, 126, 133, // 6160-6167
+136, 126,  94, 108, 127, 123, 116, 121, // 6168-6175
+145, 133, 119, 123, 133, 133, 123, 127, // 6176-6183
+135, 132, 126, 127, 131, 130, 120, 129, // 6184-6191
+125, 128, 123, 129, 136, 130, 133, 131, // 6192-6199
+137, 139, 126, 128, 132, 135, 124,  90, // 6200-6207
+118, 124, 122, 115, 126, 147, 126, 119, // 6208-6215
+125, 135, 128, 122, 130, 136, 129, 127, // 6216-6223
+126, 133, 128, 122, 128, 126, 129, 124, // 6224-6231
+131, 134, 132, 133, 132, 136, 137, 131, // 6232-6239
+126, 132, 133, 131, 105, 102, 124, 121, // 6240-6247
+119, 120, 137, 139, 120, 122, 131, 130, // 6248-6255
+125, 126, 135, 132, 128, 129, 131, 129, // 6256-6263
+122, 122, 130, 127, 126, 127, 133, 133, // 6264-6271
+126, 131, 135, 137, 137, 128, 130, 136, // 6272-6279
+129, 126, 100, 113, 124, 118, 122, 123, // 6280-6287
+142, 129, 122, 126, 131, 129, 122, 130, // 6288-6295
+135, 129, 127, 129, 134, 128, 120, 123, // 6296-6303
+124, 127, 126, 129, 135, 133, 131, 131, // 6304-6311
+133, 135, 136, 132, 127, 135, 129, 129, // 6312-6319
+109, 103, 127, 118, 122, 121, 135, 137, // 6320-6327
+119, 124, 130, 129, 124, 125, 135, 132, // 6328-6335
+126, 129, 132, 131, 119, 123, 126, 128, // 6336-6343
+125, 126, 136, 132, 130, 130, 133, 136, // 6344-6351
+134, 135, 130, 131, 130, 128, 123, 104, // 6352-6359
+113, 123, 119, 124, 125, 139, 129, 122, // 6360-6367
+129, 130, 127, 125, 130, 132, 127, 127, // 6368-6375
+131, 131, 126, 123, 124, 125, 125, 126, // 6376-6383
+130, 135, 132, 131, 131, 134, 135, 135, // 6384-6391
+132, 130, 132, 128, 128, 118, 104, 118, // 6392-6399
+122, 122, 123, 130, 139, 125, 124, 130, // 6400-6407
+131, 126, 123, 131, 131, 128, 126, 131, // 6408-6415
+130, 125, 122, 125, 132, 124, 128, 132, // 6416-6423
+134, 130, 128, 135, 134, 133, 134, 130, // 6424-6431
+132, 127, 126, 126, 117, 109, 118, 123, // 6432-6439
+124, 124, 128, 136, 129, 125, 129, 129, // 6440-6447
+125, 127, 128, 131, 128, 127, 131, 129, // 6448-6455
+126, 124, 124, 128, 127, 128, 131, 133, // 6456-6463
+132, 129, 130, 133, 133, 133, 129, 131, // 6464-6471
+129, 126, 126, 122, 116, 115, 123, 123, // 6472-6479
+124, 125, 133, 131, 127, 128, 129, 128, // 6480-6487
+126, 127, 129, 129, 127, 127, 129, 129, // 6488-6495
+125, 121, 128, 129, 127, 129, 130, 134, // 6496-6503
+131, 129, 131, 133, 134, 131, 128, 129, // 6504-6511
+126, 128, 125, 122, 117, 120, 124, 124, // 6512-6519
+125, 128, 132, 130, 127, 127, 127, 127, // 6520-6527
+127, 125, 128, 130, 129, 128, 127, 128, // 6528-6535
+126, 125, 126, 127, 128, 129, 130, 132, // 6536-6543
+132, 131, 130, 129, 129, 128, 128, 127, // 6544-6551
+128, 128, 127, 126, 126, 125, 125, 125, // 6552-6559
+125, 125, 126, 125, 126, 127, 127, 127, // 6560-6567
+127, 128, 128, 128, 128, 128, 129, 129, // 6568-6575
+127, 127, 128, 128, 128, 128, 130, 130, // 6576-6583
+129, 130, 128, 129, 129, 130, 130, 130, // 6584-6591
+129, 128, 129, 128, 126, 124, 123, 123, // 6592-6599
+123, 123, 123, 124, 125, 126, 128, 127, // 6600-6607
+127, 128, 129, 130, 130, 129, 129, 128, // 6608-6615
+128, 127, 127, 128, 128, 129, 129, 130, // 6616-6623
+129, 129, 129, 129, 130, 130, 131, 130, // 6624-6631
+130, 129, 128, 128, 127, 124, 122, 123, // 6632-6639
+123, 122, 123, 123, 125, 127, 127, 128, // 6640-6647
+128, 129, 130, 129, 129, 128, 128, 128, // 6648-6655
+128, 128, 128, 129, 128, 127, 128, 129, // 6656-6663
+129, 128, 129, 130, 130, 130, 130, 131, // 6664-6671
+130, 129, 128, 128, 126, 125, 124, 123, // 6672-6679
+122, 123, 123, 123, 123, 125, 126, 128, // 6680-6687
+129, 129, 130, 129, 129, 129, 128, 129, // 6688-6695
+129, 128, 128, 127, 128, 127, 127, 128, // 6696-6703
+128, 129, 130, 130, 130, 130, 131, 131, // 6704-6711
+130, 130, 128, 127, 128, 126, 126, 124, // 6712-6719
+123, 122, 122, 123, 124, 125, 126, 127, // 6720-6727
+128, 129, 128, 128, 129, 129, 129, 128, // 6728-6735
+128, 128, 128, 127, 127, 127, 128, 127, // 6736-6743
+128, 130, 130, 130, 130, 131, 131, 130, // 6744-6751
+130, 130, 129, 129, 127, 126, 126, 124, // 6752-6759
+124, 123, 123, 124, 124, 124, 125, 126, // 6760-6767
+127, 128, 128, 128, 128, 128, 128, 128, // 6768-6775
+127, 127, 128, 128, 127, 127, 128, 128, // 6776-6783
+129, 129, 130, 130, 130, 130, 130, 130, // 6784-6791
+130, 129, 129, 128, 128, 127, 126, 125, // 6792-6799
+124, 125, 124, 124, 124, 124, 125, 126, // 6800-6807
+126, 126, 127, 127, 128, 129, 128, 128, // 6808-6815
+127, 128, 128, 128, 127, 128, 128, 128, // 6816-6823
+129, 129, 129, 129, 130, 130, 130, 130, // 6824-6831
+130, 130, 130, 129, 129, 127, 126, 126, // 6832-6839
+125, 125, 125, 125, 125, 124, 125, 125, // 6840-6847
+125, 126, 127, 127, 128, 128, 128, 128, // 6848-6855
+128, 127, 127, 128, 128, 128, 128, 129, // 6856-6863
+128, 128, 129, 129, 129, 130, 130, 130, // 6864-6871
+131, 130, 130, 129, 129, 129, 128, 127, // 6872-6879
+126, 126, 125, 125, 124, 124, 124, 125, // 6880-6887
+126, 126, 127, 127, 127, 127, 128, 127, // 6888-6895
+127, 127, 128, 128, 128, 128, 128, 128, // 6896-6903
+128, 128, 129, 129, 129, 129, 130, 130, // 6904-6911
+130, 129, 129, 129, 129, 129, 128, 127, // 6912-6919
+126, 126, 125, 125, 125, 125, 125, 125, // 6920-6927
+126, 126, 126, 127, 127, 127, 128, 128, // 6928-6935
+128, 128, 128, 128, 128, 128, 128, 128, // 6936-6943
+127, 128, 128, 129, 129, 130, 130, 130, // 6944-6951
+130, 129, 129, 129, 128, 128, 128, 128, // 6952-6959
+127, 127, 126, 126, 126, 125, 125, 126, // 6960-6967
+126, 126, 127, 127, 127, 127, 127, 127, // 6968-6975
+128, 128, 128, 128, 128, 128, 128, 127, // 6976-6983
+128, 128, 128, 128, 128, 128, 129, 129, // 6984-6991
+128, 129, 129, 129, 128, 128, 128, 128, // 6992-6999
+127, 127, 127, 127, 126, 126, 126, 127, // 7000-7007
+127, 127, 127, 127, 127, 127, 127, 127, // 7008-7015
+127, 128, 128, 127, 127, 127, 127, 127, // 7016-7023
+127, 128, 128, 127, 128, 128, 128, 128, // 7024-7031
+128, 128, 129, 128, 128, 128, 128, 128, // 7032-7039
+127, 128, 127, 127, 127, 127, 127, 127, // 7040-7047
+127, 127, 127, 127, 127, 127, 127, 127, // 7048-7055
+127, 127, 127, 127, 127, 127, 127, 127, // 7056-7063
+128, 128, 128, 128, 128, 128, 128, 128, // 7064-7071
+128, 128, 128, 128, 128, 128, 128, 128, // 7072-7079
+127, 128, 128, 128, 128, 127, 128, 128, // 7080-7087
+128, 128, 127, 127, 127, 127, 127, 127, // 7088-7095
+127, 127, 127, 127, 127, 127, 127, 127, // 7096-7103
+128, 128, 128, 128, 128, 128, 128, 128, // 7104-7111
+127, 127, 128, 128, 128, 128, 128, 128, // 7112-7119
+128, 128, 128, 128, 128, 128, 128, 128, // 7120-7127
+128, 128, 127, 127, 127, 127, 127, 127, // 7128-7135
+127, 127, 127, 127, 127, 127, 127, 127, // 7136-7143
+127, 128, 128, 127, 127, 127, 127, 127, // 7144-7151
+127, 127, 127, 127, 127, 128, 128, 128, // 7152-7159
+128, 128, 128, 128, 128, 128, 128, 128, // 7160-7167
+128, 128, 128, 128, 128, 128, 127, 127, // 7168-7175
+127, 128, 127, 128, 128, 127, 128, 128, // 7176-7183
+128, 127, 127, 127, 127, 127, 127, 127, // 7184-7191
+127, 127, 127, 127, 127, 127, 127, 127, // 7192-7199
+128, 127, 127, 127, 127, 127, 127, 128, // 7200-7207
+128, 127, 127, 128, 128, 128, 128, 128, // 7208-7215
+128, 128, 128, 128, 128, 128, 128, 128, // 7216-7223
+128, 127, 127, 127, 127, 127, 127, 128, // 7224-7231
+127, 127, 127, 127, 127, 127, 127, 127, // 7232-7239
+127, 127, 127, 127, 127, 127, 127, 127, // 7240-7247
+127, 128, 128, 128, 128, 128, 128, 128, // 7248-7255
+128, 128, 128, 128, 128, 128, 128, 128, // 7256-7263
+128, 128, 128, 128, 128, 128, 128, 127, // 7264-7271
+128, 128, 127, 127, 127, 127, 127, 127, // 7272-7279
+127, 127, 127, 127, 127, 127, 127, 127, // 7280-7287
+127, 127, 128, 127, 127, 127, 127, 128, // 7288-7295
+127, 127, 127, 127, 128, 128, 127, 128, // 7296-7303
+128, 128, 128, 128, 128, 128, 128, 128, // 7304-7311
+128, 128, 128, 128, 127, 127, 127, 127, // 7312-7319
+127, 128, 128, 127, 127, 127, 128, 128, // 7320-7327
+128, 128, 127, 127, 128, 127, 127, 127, // 7328-7335
+127, 127, 127, 127, 128, 127, 127, 127, // 7336-7343
+128, 128, 127, 128, 128, 128, 128, 128, // 7344-7351
+127, 127, 128, 128, 128, 127, 127, 128, // 7352-7359
+128, 128, 128, 128, 128, 128, 128, 128, // 7360-7367
+128, 128, 127, 127, 127, 127, 127, 127, // 7368-7375
+127, 128, 128, 127, 127, 128, 128, 127, // 7376-7383
+127, 128, 128, 127, 127, 128, 128, 127, // 7384-7391
+127, 127, 128, 128, 127, 128, 128, 128, // 7392-7399
+128, 128, 128, 127, 127, 128, 128, 128, // 7400-7407
+127, 127, 127, 127, 127, 128, 128, 127, // 7408-7415
+127, 127, 128, 128, 127, 127, 127, 127, // 7416-7423
+127, 128, 127, 127, 127, 128, 128, 127, // 7424-7431
+127, 127, 128, 128, 128, 128, 128, 128, // 7432-7439
+128, 128, 128, 128, 127, 128, 128, 128, // 7440-7447
+128, 128, 128, 127, 127, 128, 128, 127, // 7448-7455
+127, 127, 127, 127, 127, 127, 127, 127, // 7456-7463
+127, 127, 127, 127, 127, 127, 127, 127, // 7464-7471
+127, 128, 127, 127, 128, 128, 128, 128, // 7472-7479
+128, 128, 128, 128, 128, 128, 128, 128, // 7480-7487
+128, 128, 128, 127, 128, 128, 128, 128, // 7488-7495
+128, 128, 128, 127, 127, 127, 127, 127, // 7496-7503
+127, 127, 127, 127, 127, 127, 127, 127, // 7504-7511
+127, 127, 127, 127, 127, 127, 127, 127, // 7512-7519
+127, 127, 127, 127, 127, 127, 128, 128, // 7520-7527
+128, 128, 128, 128, 128, 128, 128, 128, // 7528-7535
+128, 128, 127, 128, 128, 128, 128, 128, // 7536-7543
+128, 128, 128, 128, 127, 127, 128, 128, // 7544-7551
+128, 128, 128, 128, 127, 128, 127, 127, // 7552-7559
+127, 127, 128, 128, 128, 127, 128, 127, // 7560-7567
+128, 127, 128, 127, 127, 127, 128, 128, // 7568-7575
+127, 127, 127, 128, 127, 128, 128, 128, // 7576-7583
+127, 127, 128, 128, 127, 127, 128, 128, // 7584-7591
+128, 128, 128, 127, 127, 127, 127, 128, // 7592-7599
+127, 127, 128, 128, 128, 128, 127, 127, // 7600-7607
+127, 127, 128, 128, 128, 128, 127, 127, // 7608-7615
+127, 128, 128, 127, 128, 128, 128, 128, // 7616-7623
+128, 128, 128, 128, 127, 128, 127, 128, // 7624-7631
+127, 128, 127, 128, 127, 127, 128, 127, // 7632-7639
+128, 127, 127, 127, 128, 128, 128, 127, // 7640-7647
+127, 128, 127, 128, 128, 127, 127, 127, // 7648-7655
+128, 127, 128, 126, 129, 127, 128, 127, // 7656-7663
+128, 127, 127, 128, 127, 128, 127, 128, // 7664-7671
+127, 128, 127, 128, 127, 127, 127, 128, // 7672-7679
+128, 128, 127, 127, 127, 127, 127, 128, // 7680-7687
+128, 128, 128, 128, 127, 128, 127, 128, // 7688-7695
+127, 128, 128, 128, 128, 128, 128, 128, // 7696-7703
+127, 128, 127, 128, 127, 128, 127, 128, // 7704-7711
+127, 127, 127, 128, 127, 127, 127, 128, // 7712-7719
+127, 127, 127, 127, 127, 127, 128, 127, // 7720-7727
+128, 127, 128, 127, 128, 127, 128, 127, // 7728-7735
+128, 127, 128, 127, 128, 127, 128, 127, // 7736-7743
+128, 127, 128, 127, 128, 127, 128, 128, // 7744-7751
+128, 128, 128, 127, 127, 127, 128, 127, // 7752-7759
+128, 127, 128, 128, 128, 127, 127, 128, // 7760-7767
+128, 127, 127, 127, 128, 127, 128, 127, // 7768-7775
+128, 127, 129, 126, 128, 127, 128, 125, // 7776-7783
+128, 129, 129, 126, 124, 131, 128, 127, // 7784-7791
+124, 131, 128, 126, 125, 132, 129, 125, // 7792-7799
+125, 130, 130, 126, 125, 129, 129, 126, // 7800-7807
+127, 129, 128, 126, 126, 129, 128, 127, // 7808-7815
+126, 128, 128, 128, 127, 128, 128, 127, // 7816-7823
+127, 128, 128, 128, 127, 127, 128, 127, // 7824-7831
+127, 127, 128, 127, 127, 127, 128, 128, // 7832-7839
+127, 127, 128, 127, 128, 128, 128, 127, // 7840-7847
+128, 128, 128, 127, 128, 127, 127, 127, // 7848-7855
+128, 128, 127, 127, 128, 128, 127, 127, // 7856-7863
+128, 128, 127, 127, 128, 128, 127, 127, // 7864-7871
+128, 128, 127, 127, 128, 128, 128, 127, // 7872-7879
+127, 127, 128, 127, 127, 128, 128, 128, // 7880-7887
+127, 128, 127, 128, 127, 128, 128, 128, // 7888-7895
+128, 127, 128, 128, 128, 127, 127, 128, // 7896-7903
+128, 127, 127, 127, 128, 127, 127, 127, // 7904-7911
+130, 127, 125, 127, 129, 128, 125, 127, // 7912-7919
+128, 129, 126, 126, 128, 129, 127, 126, // 7920-7927
+127, 128, 128, 127, 127, 128, 128, 129, // 7928-7935
+128, 127, 127, 128, 128, 128, 127, 127, // 7936-7943
+128, 128, 127, 127, 128, 128, 128, 127, // 7944-7951
+128, 127, 128, 127, 128, 127, 127, 127, // 7952-7959
+127, 127, 127, 127, 128, 127, 127, 127, // 7960-7967
+128, 127, 128, 127, 128, 128, 128, 128, // 7968-7975
+127, 127, 128, 128, 127, 127, 128, 129, // 7976-7983
+127, 127, 127, 128, 128, 128, 127, 127, // 7984-7991
+127, 128, 128, 127, 127, 127, 128, 127, // 7992-7999
+127, 127, 127, 127, 127, 127, 127, 127, // 8000-8007
+127, 127, 127, 128, 127, 128, 127, 127, // 8008-8015
+127, 128, 128, 128, 128, 128, 128, 128, // 8016-8023
+128, 128, 128, 128, 128, 128, 128, 128, // 8024-8031
+128, 128, 128, 128, 127, 127, 127, 128, // 8032-8039
+127, 128, 127, 128, 128, 128, 127, 127, // 8040-8047
+127, 127, 128, 127, 127, 128, 127, 127, // 8048-8055
+127, 128, 128, 127, 126, 128, 129, 127, // 8056-8063
+127, 127, 129, 128, 128, 127, 128, 128, // 8064-8071
+128, 128, 127, 127, 128, 128, 128, 127, // 8072-8079
+128, 128, 128, 127, 127, 127, 127, 128, // 8080-8087
+128, 128, 127, 127, 128, 128, 128, 127, // 8088-8095
+127, 127, 127, 128, 127, 128, 128, 127, // 8096-8103
+128, 128, 128, 127, 127, 128, 128, 128, // 8104-8111
+128, 128, 128, 128, 128, 127, 127, 128, // 8112-8119
+128, 127, 127, 127, 128, 128, 127, 128, // 8120-8127
+127, 127, 127, 127, 128, 127, 127, 128, // 8128-8135
+128, 127, 127, 127, 128, 128, 127, 127, // 8136-8143
+128, 128, 128, 128, 128, 128, 128, 128, // 8144-8151
+127, 128, 128, 128, 127, 127, 128, 128, // 8152-8159
+128, 127, 127, 128, 127, 128, 127, 127, // 8160-8167
+127, 127, 127, 128, 128, 127, 127, 127, // 8168-8175
+127, 128, 128, 127, 127, 127, 128, 128, // 8176-8183
+128, 128, 127, 128, 128, 128, 128, 128, // 8184-8191
+127, 128, 128, 128, 128, 128, 128, 128, // 8192-8199
+127, 127, 128, 128, 127, 127, 127, 128, // 8200-8207
+128, 127, 127, 128, 128, 127, 127, 127, // 8208-8215
+128, 128, 127, 127, 127, 127, 127, 127, // 8216-8223
+127, 127, 128, 127, 127, 127, 128, 128, // 8224-8231
+128, 127, 128, 128, 128, 128, 127, 127, // 8232-8239
+128, 128, 128, 127, 127, 128, 128, 127, // 8240-8247
+127, 127, 127, 128, 127, 127, 127, 128, // 8248-8255
+128, 128, 127, 127, 128, 128, 127, 127, // 8256-8263
+127, 128, 128, 128, 128, 127, 128, 128, // 8264-8271
+128, 127, 128, 128, 128, 128, 128, 128, // 8272-8279
+127, 128, 128, 128, 128, 128, 128, 128, // 8280-8287
+128, 128, 128, 127, 127, 127, 127, 127, // 8288-8295
+127, 127, 128, 128, 127, 127, 127, 127, // 8296-8303
+127, 127, 127, 127, 128, 128, 127, 127, // 8304-8311
+127, 128, 128, 127, 127, 127, 128, 128, // 8312-8319
+128, 128, 128, 128, 127, 128, 127, 128, // 8320-8327
+128, 128, 127, 128, 128, 128, 128, 128, // 8328-8335
+127, 128, 128, 128, 128, 127, 128, 127, // 8336-8343
+127, 128, 127, 128, 127, 127, 127, 128, // 8344-8351
+128, 127, 128, 127, 127, 127, 128, 127, // 8352-8359
+128, 127, 128, 127, 127, 127, 128, 128, // 8360-8367
+128, 128, 127, 127, 127, 128, 128, 128, // 8368-8375
+127, 127, 127, 128, 128, 128, 127, 128, // 8376-8383
+128, 128, 127, 128, 127, 127, 127, 128, // 8384-8391
+128, 128, 127, 127, 127, 128, 128, 128, // 8392-8399
+127, 127, 127, 127, 127, 128, 128, 127, // 8400-8407
+127, 127, 127, 128, 128, 128, 127, 127, // 8408-8415
+127, 128, 128, 128, 128, 128, 128, 128, // 8416-8423
+128, 127, 127, 127, 128, 128, 128, 128, // 8424-8431
+127, 127, 127, 128, 128, 128, 128, 127, // 8432-8439
+127, 127, 128, 128, 128, 127, 127, 127, // 8440-8447
+127, 128, 128, 128, 127, 127, 127, 127, // 8448-8455
+128, 128, 128, 127, 127, 127, 127, 127, // 8456-8463
+127, 127, 128, 128, 128, 128, 128, 128, // 8464-8471
+128, 127, 128, 128, 128, 128, 128, 128, // 8472-8479
+128, 128, 128, 128, 128, 128, 127, 127, // 8480-8487
+127, 128, 128, 128, 128, 127, 127, 127, // 8488-8495
+128, 127, 127, 127, 127, 127, 128, 128, // 8496-8503
+127, 127, 127, 127, 127, 127, 127, 127, // 8504-8511
+127, 127, 127, 128, 128, 127, 128, 128, // 8512-8519
+128, 127, 128, 128, 128, 128, 127, 128, // 8520-8527
+128, 128, 128, 128, 127, 127, 128, 128, // 8528-8535
+128, 128, 128, 128, 127, 128, 128, 128, // 8536-8543
+127, 127, 127, 127, 128, 127, 128, 127, // 8544-8551
+128, 127, 127, 127, 127, 127, 127, 128, // 8552-8559
+128, 128, 127, 127, 127, 127, 127, 128, // 8560-8567
+128, 128, 127, 127, 127, 128, 128, 128, // 8568-8575
+128, 127, 128, 128, 128, 128, 127, 127, // 8576-8583
+127, 128, 128, 127, 127, 127, 128, 128, // 8584-8591
+128, 127, 127, 127, 128, 127, 128, 127, // 8592-8599
+127, 127, 127, 127, 128, 127, 127, 128, // 8600-8607
+128, 127, 127, 128, 127, 128, 127, 128, // 8608-8615
+128, 128, 128, 128, 128, 128, 127, 127, // 8616-8623
+127, 128, 128, 128, 128, 128, 128, 127, // 8624-8631
+127, 128, 128, 127, 127, 128, 127, 128, // 8632-8639
+127, 127, 127, 127, 127, 128, 128, 127, // 8640-8647
+127, 127, 127, 128, 128, 127, 127, 127, // 8648-8655
+128, 128, 127, 128, 128, 127, 128, 127, // 8656-8663
+128, 127, 128, 128, 128, 127, 127, 127, // 8664-8671
+127, 128, 128, 128, 128, 127, 127, 127, // 8672-8679
+128, 127, 128, 127, 127, 127, 128, 128, // 8680-8687
+128, 128, 127, 127, 128, 128, 128, 128, // 8688-8695
+127, 127, 127, 128, 128, 128, 127, 127, // 8696-8703
+127, 128, 128, 128, 128, 127, 127, 127, // 8704-8711
+127, 128, 128, 128, 127, 127, 128, 128, // 8712-8719
+127, 127, 128, 128, 128, 128, 128, 128, // 8720-8727
+127, 127, 128, 128, 128, 128, 127, 127, // 8728-8735
+127, 128, 128, 128, 128, 127, 127, 127, // 8736-8743
+127, 128, 128, 128, 127, 127, 127, 128, // 8744-8751
+127, 128, 127, 128, 128, 128, 127, 127, // 8752-8759
+127, 128, 128, 128, 128, 127, 127, 127, // 8760-8767
+127, 128, 128, 128, 128, 127, 127, 128, // 8768-8775
+128, 128, 128, 127, 128, 127, 128, 127, // 8776-8783
+128, 127, 127, 127, 128, 128, 128, 127, // 8784-8791
+127, 127, 127, 128, 127, 127, 127, 128, // 8792-8799
+127, 127, 127, 127, 128, 127, 127, 127, // 8800-8807
+128, 127, 128, 127, 128, 128, 128, 128, // 8808-8815
+127, 127, 127, 128, 128, 128, 128, 128, // 8816-8823
+128, 128, 128, 128, 127, 128, 127, 128, // 8824-8831
+128, 128, 128, 128, 128, 128, 127, 127, // 8832-8839
+127, 127, 128, 128, 128, 127, 127, 127, // 8840-8847
+127, 127, 127, 127, 127, 128, 128, 128, // 8848-8855
+128, 127, 127, 127, 127, 127, 128, 128, // 8856-8863
+128, 128, 128, 127, 127, 127, 128, 128, // 8864-8871
+128, 128, 128, 128, 127, 127, 127, 128, // 8872-8879
+128, 128, 127, 127, 127, 127, 127, 127, // 8880-8887
+127, 127, 127, 127, 127, 127, 127, 127, // 8888-8895
+127, 127, 127, 127, 127, 128, 128, 128, // 8896-8903
+128, 128, 128, 127, 128, 128, 128, 128, // 8904-8911
+128, 128, 128, 128, 128, 128, 128, 128, // 8912-8919
+128, 128, 128, 128, 127, 127, 127, 127, // 8920-8927
+127, 127, 127, 127, 127, 127, 127, 127, // 8928-8935
+127, 127, 127, 127, 127, 127, 127, 127, // 8936-8943
+127, 127, 127, 127, 127, 127, 127, 128, // 8944-8951
+128, 128, 128, 128, 128, 128, 128, 128, // 8952-8959
+128, 128, 128, 128, 128, 128, 128, 128, // 8960-8967
+128, 128, 128, 128, 128, 128, 127, 127, // 8968-8975
+127, 127, 127, 127, 127, 127, 127, 127, // 8976-8983
+127, 127, 127, 127, 127, 127, 127, 127, // 8984-8991
+127, 127, 127, 127, 127, 127, 128, 128, // 8992-8999
+128, 128, 127, 128, 128, 128, 128, 128, // 9000-9007
+128, 128, 128, 128, 128, 128, 128, 128, // 9008-9015
+128, 128, 128, 128, 127, 128, 127, 127, // 9016-9023
+127, 127, 127, 127, 127, 127, 127, 127, // 9024-9031
+127, 127, 127, 127, 127, 127, 127, 127, // 9032-9039
+127, 127, 127, 127, 128, 128, 128, 128, // 9040-9047
+128, 128, 128, 128, 128, 128, 128, 129, // 9048-9055
+129, 129, 128, 128, 128, 128, 128, 128, // 9056-9063
+128, 128, 128, 128, 128, 127, 127, 127, // 9064-9071
+127, 127, 127, 127, 126, 126, 126, 126, // 9072-9079
+127, 126, 126, 126, 126, 126, 127, 127, // 9080-9087
+127, 127, 127, 127, 128, 128, 128, 128, // 9088-9095
+128, 128, 128, 128, 128, 129, 129, 129, // 9096-9103
+129, 129, 129, 129, 129, 128, 128, 128, // 9104-9111
+128, 128, 128, 127, 127, 127, 127, 126, // 9112-9119
+126, 126, 126, 126, 126, 126, 126, 126, // 9120-9127
+126, 126, 126, 126, 126, 126, 126, 127, // 9128-9135
+127, 127, 127, 128, 128, 128, 128, 129, // 9136-9143
+129, 129, 129, 129, 129, 129, 129, 129, // 9144-9151
+129, 129, 129, 129, 129, 129, 129, 128, // 9152-9159
+128, 128, 128, 127, 127, 127, 127, 126, // 9160-9167
+126, 126, 126, 126, 127, 127, 126, 126, // 9168-9175
+126, 125, 125, 125, 125, 125, 126, 126, // 9176-9183
+127, 127, 128, 128, 128, 128, 129, 129, // 9184-9191
+129, 128, 128, 128, 129, 129, 129, 129, // 9192-9199
+129, 130, 130, 130, 130, 129, 129, 129, // 9200-9207
+128, 128, 127, 127, 127, 127, 127, 126, // 9208-9215
+126, 127, 127, 127, 127, 127, 127, 126, // 9216-9223
+126, 126, 125, 125, 125, 125, 125, 126, // 9224-9231
+127, 128, 128, 129, 129, 129, 129, 129, // 9232-9239
+129, 129, 128, 128, 128, 128, 128, 128, // 9240-9247
+128, 129, 130, 130, 130, 130, 130, 129, // 9248-9255
+129, 127, 127, 126, 126, 126, 126, 126, // 9256-9263
+126, 127, 127, 127, 128, 128, 128, 127, // 9264-9271
+127, 126, 124, 123, 123, 123, 123, 125, // 9272-9279
+126, 127, 128, 129, 129, 129, 129, 129, // 9280-9287
+130, 129, 129, 128, 127, 127, 127, 127, // 9288-9295
+128, 129, 131, 132, 132, 132, 132, 131, // 9296-9303
+130, 129, 128, 127, 127, 127, 127, 126, // 9304-9311
+126, 126, 127, 127, 128, 128, 129, 129, // 9312-9319
+128, 126, 124, 122, 121, 121, 121, 123, // 9320-9327
+124, 126, 127, 128, 128, 129, 129, 129, // 9328-9335
+130, 130, 130, 129, 128, 126, 126, 126, // 9336-9343
+127, 128, 130, 132, 133, 133, 133, 132, // 9344-9351
+131, 130, 129, 129, 128, 127, 127, 126, // 9352-9359
+126, 126, 126, 126, 127, 127, 128, 128, // 9360-9367
+128, 127, 126, 123, 121, 120, 120, 121, // 9368-9375
+123, 125, 127, 128, 128, 128, 129, 129, // 9376-9383
+130, 131, 131, 130, 129, 127, 126, 125, // 9384-9391
+125, 127, 129, 131, 132, 132, 132, 132, // 9392-9399
+132, 131, 131, 130, 129, 128, 127, 126, // 9400-9407
+126, 125, 125, 126, 127, 128, 128, 128, // 9408-9415
+128, 127, 125, 123, 120, 119, 119, 120, // 9416-9423
+122, 124, 126, 127, 128, 128, 129, 130, // 9424-9431
+132, 132, 132, 130, 129, 127, 126, 125, // 9432-9439
+126, 127, 129, 131, 132, 132, 133, 132, // 9440-9447
+132, 132, 131, 130, 129, 128, 127, 126, // 9448-9455
+126, 126, 126, 126, 127, 128, 128, 128, // 9456-9463
+127, 124, 121, 119, 118, 118, 120, 122, // 9464-9471
+125, 127, 128, 128, 129, 130, 131, 133, // 9472-9479
+133, 133, 131, 128, 126, 125, 125, 127, // 9480-9487
+128, 130, 131, 132, 132, 133, 133, 133, // 9488-9495
+132, 132, 130, 129, 128, 127, 126, 126, // 9496-9503
+126, 126, 126, 126, 127, 127, 127, 125, // 9504-9511
+122, 119, 117, 117, 118, 121, 123, 125, // 9512-9519
+126, 127, 128, 130, 132, 134, 134, 133, // 9520-9527
+131, 128, 127, 126, 126, 127, 128, 129, // 9528-9535
+130, 131, 132, 134, 134, 134, 134, 132, // 9536-9543
+131, 130, 129, 128, 128, 127, 126, 126, // 9544-9551
+125, 126, 127, 127, 125, 122, 118, 115, // 9552-9559
+115, 117, 120, 123, 124, 124, 125, 127, // 9560-9567
+130, 134, 135, 135, 133, 131, 129, 128, // 9568-9575
+128, 127, 126, 126, 127, 129, 131, 133, // 9576-9583
+134, 135, 135, 135, 134, 132, 131, 130, // 9584-9591
+129, 128, 127, 127, 125, 125, 126, 126, // 9592-9599
+125, 122, 118, 115, 115, 116, 118, 119, // 9600-9607
+121, 123, 126, 129, 132, 134, 134, 134, // 9608-9615
+133, 133, 131, 129, 127, 125, 125, 126, // 9616-9623
+128, 130, 131, 132, 134, 135, 136, 136, // 9624-9631
+135, 133, 132, 131, 130, 128, 127, 126, // 9632-9639
+126, 126, 126, 125, 122, 119, 116, 115, // 9640-9647
+116, 117, 117, 118, 121, 125, 129, 131, // 9648-9655
+132, 132, 133, 134, 133, 132, 129, 127, // 9656-9663
+126, 126, 126, 127, 128, 130, 133, 135, // 9664-9671
+137, 137, 136, 135, 135, 134, 132, 130, // 9672-9679
+129, 128, 127, 126, 126, 125, 124, 119, // 9680-9687
+115, 114, 115, 114, 113, 114, 118, 123, // 9688-9695
+126, 128, 130, 133, 134, 134, 132, 132, // 9696-9703
+130, 129, 126, 125, 127, 127, 129, 131, // 9704-9711
+133, 136, 138, 139, 139, 138, 137, 136, // 9712-9719
+134, 132, 130, 129, 127, 125, 124, 124, // 9720-9727
+119, 114, 114, 113, 111, 109, 111, 117, // 9728-9735
+120, 123, 127, 132, 134, 134, 133, 136, // 9736-9743
+134, 130, 129, 129, 127, 126, 126, 128, // 9744-9751
+130, 131, 134, 138, 138, 139, 139, 139, // 9752-9759
+137, 134, 134, 132, 128, 126, 126, 125, // 9760-9767
+123, 116, 114, 115, 110, 108, 112, 114, // 9768-9775
+115, 118, 124, 129, 129, 132, 135, 136, // 9776-9783
+134, 133, 133, 129, 128, 127, 126, 127, // 9784-9791
+128, 131, 133, 135, 139, 140, 141, 142, // 9792-9799
+138, 137, 138, 132, 129, 129, 125, 124, // 9800-9807
+121, 113, 116, 111, 105, 112, 110, 110, // 9808-9815
+118, 119, 123, 130, 129, 133, 137, 132, // 9816-9823
+137, 134, 132, 132, 127, 127, 128, 124, // 9824-9831
+129, 130, 132, 137, 137, 141, 143, 138, // 9832-9839
+141, 138, 133, 133, 131, 126, 128, 119, // 9840-9847
+114, 119, 103, 109, 110, 102, 117, 116, // 9848-9855
+115, 132, 125, 129, 140, 128, 140, 138, // 9856-9863
+131, 140, 130, 129, 131, 122, 129, 127, // 9864-9871
+126, 135, 130, 139, 140, 135, 143, 135, // 9872-9879
+137, 136, 130, 132, 127, 118, 122, 109, // 9880-9887
+106, 112,  99, 112, 113, 114, 127, 125, // 9888-9895
+129, 137, 132, 137, 138, 133, 138, 135, // 9896-9903
+131, 131, 125, 128, 127, 126, 133, 133, // 9904-9911
+135, 140, 137, 138, 139, 134, 136, 131, // 9912-9919
+132, 128, 119, 126, 103, 114, 105, 100, // 9920-9927
+114, 105, 117, 121, 125, 127, 137, 131, // 9928-9935
+136, 139, 134, 140, 134, 134, 133, 127, // 9936-9943
+130, 126, 128, 134, 132, 139, 141, 138, // 9944-9951
+143, 137, 139, 133, 134, 130, 117, 132, // 9952-9959
+ 99, 119, 103,  98, 111, 102, 114, 116, // 9960-9967
+126, 121, 140, 128, 139, 138, 135, 142, // 9968-9975
+135, 137, 133, 130, 130, 129, 126, 133, // 9976-9983
+131, 135, 139, 137, 139, 141, 133, 139, // 9984-9991
+133, 127, 125, 120, 108, 113, 102, 102, // 9992-9999
+107, 104, 113, 119, 123, 128, 137, 131, // 10000-10007
+142, 135, 140, 138, 137, 136, 133, 130, // 10008-10015
+129, 127, 128, 131, 131, 136, 139, 137, // 10016-10023
+141, 137, 137, 135, 132, 122, 130, 106, // 10024-10031
+117, 103, 106, 103, 108, 107, 118, 120, // 10032-10039
+123, 136, 130, 139, 137, 138, 139, 138, // 10040-10047
+136, 136, 131, 130, 130, 127, 133, 131, // 10048-10055
+135, 137, 137, 138, 137, 137, 135, 132, // 10056-10063
+123, 128, 106, 121,  99, 110, 103, 107, // 10064-10071
+107, 118, 117, 125, 133, 130, 140, 135, // 10072-10079
+139, 138, 139, 137, 136, 132, 133, 130, // 10080-10087
+131, 133, 131, 140, 133, 141, 136, 137, // 10088-10095
+136, 133, 123, 129, 110, 115, 108, 102, // 10096-10103
+106, 105, 106, 112, 119, 119, 131, 132, // 10104-10111
+136, 140, 139, 139, 142, 136, 139, 133, // 10112-10119
+132, 131, 129, 132, 132, 135, 138, 136, // 10120-10127
+137, 137, 134, 137, 123, 129, 116, 109, // 10128-10135
+113,  98, 108, 104, 109, 109, 120, 118, // 10136-10143
+130, 132, 135, 138, 139, 140, 141, 139, // 10144-10151
+140, 134, 134, 132, 130, 133, 134, 134, // 10152-10159
+139, 137, 138, 136, 135, 134, 124, 129, // 10160-10167
+112, 113, 107, 103, 102, 105, 105, 110, // 10168-10175
+117, 119, 128, 133, 135, 140, 140, 140, // 10176-10183
+141, 140, 140, 135, 136, 132, 131, 131, // 10184-10191
+135, 131, 141, 134, 141, 134, 140, 126, // 10192-10199
+133, 120, 113, 112, 103, 103, 104, 104, // 10200-10207
+106, 113, 115, 123, 130, 135, 138, 142, // 10208-10215
+140, 142, 140, 142, 136, 137, 133, 132, // 10216-10223
+132, 136, 132, 139, 135, 138, 133, 140, // 10224-10231
+130, 130, 126, 113, 113, 106, 103, 103, // 10232-10239
+107, 104, 113, 113, 124, 126, 135, 135, // 10240-10247
+138, 140, 140, 139, 142, 136, 137, 133, // 10248-10255
+133, 132, 136, 134, 138, 138, 138, 137, // 10256-10263
+139, 129, 133, 124, 113, 117,  98, 109, // 10264-10271
+ 97, 108, 102, 115, 112, 124, 124, 136, // 10272-10279
+133, 140, 138, 140, 139, 142, 136, 139, // 10280-10287
+132, 134, 132, 136, 135, 140, 138, 142, // 10288-10295
+136, 141, 130, 133, 122, 114, 112, 102, // 10296-10303
+104,  99, 105, 103, 111, 114, 122, 125, // 10304-10311
+136, 133, 143, 136, 143, 138, 143, 137, // 10312-10319
+138, 132, 135, 130, 138, 133, 142, 137, // 10320-10327
+143, 136, 142, 129, 134, 119, 116, 107, // 10328-10335
+105,  99, 105, 101, 108, 109, 117, 119, // 10336-10343
+131, 130, 140, 137, 141, 140, 139, 141, // 10344-10351
+136, 138, 134, 132, 134, 135, 135, 142, // 10352-10359
+137, 141, 138, 138, 129, 134, 112, 120, // 10360-10367
+103, 106, 100, 106, 102, 114, 108, 122, // 10368-10375
+119, 134, 130, 139, 136, 139, 137, 140, // 10376-10383
+136, 138, 133, 135, 131, 136, 135, 139, // 10384-10391
+140, 142, 138, 142, 130, 136, 124, 117, // 10392-10399
+114, 103, 106, 101, 105, 105, 111, 114, // 10400-10407
+121, 123, 135, 130, 141, 135, 140, 138, // 10408-10415
+139, 136, 137, 133, 135, 131, 137, 135, // 10416-10423
+140, 140, 140, 142, 136, 134, 131, 117, // 10424-10431
+121, 103, 108, 100, 104, 104, 110, 111, // 10432-10439
+119, 121, 131, 132, 136, 139, 137, 141, // 10440-10447
+137, 139, 135, 135, 133, 133, 133, 137, // 10448-10455
+136, 144, 136, 145, 133, 136, 130, 120, // 10456-10463
+120, 107, 108, 102, 105, 105, 108, 111, // 10464-10471
+117, 119, 130, 129, 137, 136, 138, 140, // 10472-10479
+138, 140, 136, 136, 134, 133, 134, 137, // 10480-10487
+135, 143, 135, 144, 133, 134, 131, 119, // 10488-10495
+121, 107, 110, 103, 108, 106, 111, 112, // 10496-10503
+119, 120, 130, 128, 136, 135, 136, 140, // 10504-10511
+135, 140, 134, 137, 133, 134, 134, 137, // 10512-10519
+137, 143, 135, 146, 130, 140, 126, 122, // 10520-10527
+119, 108, 109, 103, 106, 106, 111, 113, // 10528-10535
+118, 122, 128, 130, 135, 134, 137, 136, // 10536-10543
+137, 137, 135, 135, 132, 134, 134, 137, // 10544-10551
+137, 142, 138, 143, 135, 135, 131, 119, // 10552-10559
+123, 105, 112, 102, 108, 106, 111, 114, // 10560-10567
+118, 122, 129, 128, 137, 134, 136, 139, // 10568-10575
+134, 139, 132, 136, 131, 133, 134, 136, // 10576-10583
+137, 142, 136, 144, 131, 139, 123, 126, // 10584-10591
+114, 110, 109, 104, 108, 107, 112, 113, // 10592-10599
+119, 123, 129, 129, 139, 131, 142, 134, // 10600-10607
+140, 136, 136, 135, 133, 134, 136, 135, // 10608-10615
+142, 137, 142, 137, 133, 135, 119, 125, // 10616-10623
+108, 112, 105, 107, 107, 110, 112, 117, // 10624-10631
+119, 129, 128, 135, 136, 133, 140, 134, // 10632-10639
+140, 134, 136, 133, 133, 135, 136, 138, // 10640-10647
+142, 137, 142, 133, 135, 130, 120, 122, // 10648-10655
+106, 111, 103, 108, 107, 111, 113, 118, // 10656-10663
+121, 130, 128, 135, 135, 134, 139, 133, // 10664-10671
+140, 131, 136, 131, 133, 135, 136, 137, // 10672-10679
+141, 137, 141, 134, 135, 128, 121, 120, // 10680-10687
+108, 111, 106, 109, 109, 112, 116, 118, // 10688-10695
+125, 128, 130, 136, 131, 139, 135, 138, // 10696-10703
+135, 134, 134, 132, 135, 135, 137, 140, // 10704-10711
+138, 140, 137, 133, 134, 123, 124, 113, // 10712-10719
+112, 107, 109, 107, 110, 111, 116, 118, // 10720-10727
+128, 124, 136, 131, 136, 137, 135, 140, // 10728-10735
+133, 138, 131, 135, 135, 136, 139, 139, // 10736-10743
+140, 139, 137, 133, 132, 121, 122, 110, // 10744-10751
+110, 107, 106, 110, 108, 116, 115, 123, // 10752-10759
+127, 128, 136, 132, 136, 137, 135, 139, // 10760-10767
+132, 138, 131, 136, 135, 137, 139, 140, // 10768-10775
+138, 141, 131, 136, 126, 121, 119, 107, // 10776-10783
+112, 104, 109, 109, 111, 117, 117, 126, // 10784-10791
+129, 128, 138, 129, 140, 133, 137, 137, // 10792-10799
+131, 138, 128, 138, 132, 138, 138, 138, // 10800-10807
+138, 139, 131, 135, 123, 122, 117, 108, // 10808-10815
+112, 104, 111, 108, 116, 115, 121, 126, // 10816-10823
+127, 134, 132, 136, 135, 135, 137, 134, // 10824-10831
+136, 132, 134, 135, 134, 139, 136, 140, // 10832-10839
+137, 138, 131, 135, 121, 124, 114, 110, // 10840-10847
+112, 105, 112, 107, 117, 112, 124, 122, // 10848-10855
+130, 132, 133, 136, 135, 137, 136, 135, // 10856-10863
+135, 133, 135, 134, 137, 137, 139, 136, // 10864-10871
+139, 133, 133, 131, 119, 124, 109, 112, // 10872-10879
+107, 108, 110, 112, 116, 117, 126, 125, // 10880-10887
+133, 131, 136, 136, 136, 138, 135, 137, // 10888-10895
+134, 134, 135, 135, 137, 137, 137, 137, // 10896-10903
+136, 132, 131, 128, 117, 122, 106, 113, // 10904-10911
+105, 111, 110, 113, 117, 119, 127, 125, // 10912-10919
+135, 131, 138, 134, 138, 136, 136, 135, // 10920-10927
+134, 133, 134, 134, 138, 136, 137, 135, // 10928-10935
+136, 129, 132, 125, 119, 120, 107, 114, // 10936-10943
+106, 112, 111, 115, 117, 121, 125, 128, // 10944-10951
+133, 132, 137, 134, 138, 136, 137, 135, // 10952-10959
+134, 134, 133, 135, 137, 137, 138, 135, // 10960-10967
+137, 130, 134, 125, 121, 120, 108, 114, // 10968-10975
+105, 112, 109, 114, 116, 119, 125, 126, // 10976-10983
+133, 131, 136, 134, 137, 136, 136, 135, // 10984-10991
+133, 134, 134, 135, 137, 137, 137, 136, // 10992-10999
+136, 132, 133, 127, 121, 120, 110, 113, // 11000-11007
+107, 110, 110, 114, 117, 119, 126, 125, // 11008-11015
+134, 130, 138, 134, 138, 136, 136, 136, // 11016-11023
+132, 135, 133, 135, 136, 136, 138, 135, // 11024-11031
+136, 133, 129, 131, 116, 125, 106, 115, // 11032-11039
+106, 109, 112, 112, 118, 119, 126, 127, // 11040-11047
+133, 130, 138, 133, 139, 134, 137, 134, // 11048-11055
+133, 135, 132, 135, 134, 136, 136, 135, // 11056-11063
+135, 133, 131, 131, 119, 124, 109, 114, // 11064-11071
+108, 110, 112, 113, 118, 119, 125, 126, // 11072-11079
+132, 129, 137, 132, 138, 135, 137, 135, // 11080-11087
+132, 135, 130, 136, 134, 138, 137, 137, // 11088-11095
+136, 135, 132, 132, 123, 123, 114, 112, // 11096-11103
+110, 109, 112, 110, 119, 114, 125, 122, // 11104-11111
+131, 129, 133, 134, 133, 136, 134, 135, // 11112-11119
+135, 133, 135, 132, 137, 135, 137, 138, // 11120-11127
+135, 137, 133, 132, 129, 120, 120, 110, // 11128-11135
+110, 110, 108, 114, 112, 119, 119, 126, // 11136-11143
+127, 131, 132, 133, 135, 134, 138, 133, // 11144-11151
+137, 132, 134, 132, 134, 135, 137, 137, // 11152-11159
+138, 135, 137, 131, 132, 123, 120, 116, // 11160-11167
+108, 112, 105, 113, 110, 117, 118, 122, // 11168-11175
+127, 128, 133, 132, 134, 136, 135, 138, // 11176-11183
+134, 136, 131, 133, 132, 134, 137, 136, // 11184-11191
+139, 135, 136, 134, 130, 131, 120, 121, // 11192-11199
+111, 111, 109, 107, 112, 111, 117, 119, // 11200-11207
+123, 130, 126, 136, 129, 136, 134, 135, // 11208-11215
+138, 133, 136, 131, 134, 133, 135, 138, // 11216-11223
+136, 138, 136, 136, 135, 129, 130, 119, // 11224-11231
+118, 112, 108, 112, 107, 114, 111, 120, // 11232-11239
+118, 125, 127, 128, 134, 130, 138, 132, // 11240-11247
+138, 134, 134, 134, 130, 135, 133, 137, // 11248-11255
+138, 137, 139, 135, 136, 133, 129, 129, // 11256-11263
+118, 120, 110, 111, 111, 107, 116, 111, // 11264-11271
+121, 119, 126, 128, 129, 134, 131, 135, // 11272-11279
+134, 135, 136, 133, 135, 131, 133, 133, // 11280-11287
+135, 137, 137, 137, 136, 134, 134, 128, // 11288-11295
+129, 118, 120, 111, 111, 111, 108, 115, // 11296-11303
+112, 120, 119, 124, 129, 127, 135, 131, // 11304-11311
+135, 135, 134, 139, 132, 137, 130, 135, // 11312-11319
+133, 134, 137, 137, 137, 136, 134, 133, // 11320-11327
+129, 128, 122, 119, 114, 111, 110, 110, // 11328-11335
+112, 113, 117, 120, 124, 127, 130, 130, // 11336-11343
+134, 131, 136, 134, 137, 135, 134, 134, // 11344-11351
+131, 136, 133, 136, 137, 136, 137, 134, // 11352-11359
+134, 132, 127, 129, 116, 120, 111, 110, // 11360-11367
+112, 107, 115, 112, 119, 122, 123, 131, // 11368-11375
+126, 135, 131, 133, 137, 133, 139, 133, // 11376-11383
+135, 133, 131, 136, 132, 138, 136, 136, // 11384-11391
+136, 133, 132, 132, 126, 128, 117, 119, // 11392-11399
+112, 110, 112, 108, 116, 113, 122, 122, // 11400-11407
+126, 131, 129, 134, 132, 133, 137, 134, // 11408-11415
+138, 133, 135, 132, 131, 135, 132, 137, // 11416-11423
+135, 135, 134, 132, 132, 130, 126, 127, // 11424-11431
+117, 120, 112, 111, 112, 109, 116, 114, // 11432-11439
+121, 123, 126, 131, 130, 132, 135, 131, // 11440-11447
+139, 132, 138, 133, 133, 134, 129, 135, // 11448-11455
+132, 136, 138, 134, 137, 131, 134, 130, // 11456-11463
+128, 127, 120, 119, 115, 111, 113, 109, // 11464-11471
+115, 114, 120, 123, 126, 129, 130, 131, // 11472-11479
+133, 133, 133, 136, 134, 136, 132, 133, // 11480-11487
+131, 131, 134, 133, 137, 135, 137, 134, // 11488-11495
+133, 131, 129, 127, 125, 119, 117, 114, // 11496-11503
+109, 114, 108, 117, 115, 122, 124, 127, // 11504-11511
+131, 131, 132, 134, 131, 137, 133, 136, // 11512-11519
+134, 132, 132, 129, 133, 132, 134, 136, // 11520-11527
+134, 136, 132, 133, 130, 130, 126, 125, // 11528-11535
+119, 117, 114, 110, 113, 111, 116, 118, // 11536-11543
+122, 126, 128, 130, 131, 130, 134, 131, // 11544-11551
+136, 134, 135, 134, 130, 132, 129, 132, // 11552-11559
+132, 133, 136, 134, 136, 132, 133, 130, // 11560-11567
+129, 128, 124, 124, 117, 119, 111, 113, // 11568-11575
+113, 114, 120, 120, 127, 127, 129, 131, // 11576-11583
+130, 132, 132, 133, 135, 133, 134, 132, // 11584-11591
+131, 130, 130, 131, 132, 133, 135, 133, // 11592-11599
+134, 130, 131, 129, 129, 126, 125, 122, // 11600-11607
+117, 118, 111, 115, 112, 117, 120, 122, // 11608-11615
+127, 127, 130, 130, 131, 132, 133, 133, // 11616-11623
+135, 133, 134, 130, 131, 130, 129, 132, // 11624-11631
+132, 134, 136, 133, 135, 129, 133, 128, // 11632-11639
+130, 128, 125, 124, 116, 118, 111, 115, // 11640-11647
+112, 117, 118, 122, 126, 127, 129, 130, // 11648-11655
+130, 131, 132, 133, 134, 133, 133, 130, // 11656-11663
+130, 129, 129, 132, 132, 135, 135, 135, // 11664-11671
+134, 132, 132, 129, 130, 128, 126, 126, // 11672-11679
+119, 119, 113, 114, 114, 115, 120, 120, // 11680-11687
+125, 126, 129, 129, 130, 130, 132, 132, // 11688-11695
+133, 132, 133, 131, 129, 129, 128, 131, // 11696-11703
+132, 134, 134, 135, 133, 133, 131, 130, // 11704-11711
+130, 128, 129, 124, 125, 118, 118, 115, // 11712-11719
+113, 116, 116, 121, 123, 126, 128, 128, // 11720-11727
+131, 130, 131, 131, 132, 133, 132, 132, // 11728-11735
+130, 129, 129, 129, 130, 132, 133, 135, // 11736-11743
+133, 134, 133, 132, 130, 130, 129, 128, // 11744-11751
+126, 125, 120, 119, 115, 114, 115, 116, // 11752-11759
+120, 121, 126, 127, 129, 130, 131, 131, // 11760-11767
+132, 131, 133, 131, 131, 130, 129, 129, // 11768-11775
+128, 130, 131, 132, 133, 134, 134, 133, // 11776-11783
+133, 130, 132, 128, 131, 126, 126, 123, // 11784-11791
+117, 119, 112, 116, 115, 119, 122, 124, // 11792-11799
+127, 128, 130, 130, 130, 131, 131, 131, // 11800-11807
+133, 130, 131, 128, 128, 128, 128, 131, // 11808-11815
+131, 134, 135, 134, 135, 132, 132, 130, // 11816-11823
+130, 129, 129, 126, 125, 121, 118, 117, // 11824-11831
+113, 117, 116, 121, 122, 125, 127, 128, // 11832-11839
+129, 130, 130, 131, 131, 132, 131, 130, // 11840-11847
+130, 128, 128, 128, 129, 131, 132, 134, // 11848-11855
+134, 135, 133, 133, 132, 130, 131, 128, // 11856-11863
+129, 125, 125, 121, 117, 118, 114, 118, // 11864-11871
+117, 120, 123, 124, 127, 128, 129, 130, // 11872-11879
+130, 131, 131, 131, 131, 129, 129, 128, // 11880-11887
+128, 129, 129, 131, 132, 134, 134, 135, // 11888-11895
+134, 134, 132, 132, 130, 130, 128, 128, // 11896-11903
+124, 123, 118, 118, 115, 115, 118, 118, // 11904-11911
+123, 123, 126, 127, 128, 129, 129, 130, // 11912-11919
+131, 130, 131, 129, 129, 129, 128, 129, // 11920-11927
+128, 131, 131, 133, 135, 135, 135, 134, // 11928-11935
+133, 132, 131, 130, 129, 128, 126, 123, // 11936-11943
+123, 117, 118, 115, 117, 117, 120, 121, // 11944-11951
+125, 126, 128, 128, 130, 129, 130, 131, // 11952-11959
+129, 131, 128, 130, 128, 129, 129, 129, // 11960-11967
+131, 132, 133, 134, 134, 135, 134, 133, // 11968-11975
+132, 130, 130, 128, 128, 126, 124, 123, // 11976-11983
+119, 118, 117, 115, 119, 117, 123, 124, // 11984-11991
+127, 128, 128, 129, 129, 129, 130, 129, // 11992-11999
+130, 129, 129, 129, 128, 129, 129, 131, // 12000-12007
+132, 133, 135, 134, 135, 135, 133, 133, // 12008-12015
+130, 130, 129, 128, 127, 125, 122, 122, // 12016-12023
+117, 119, 115, 118, 118, 121, 123, 125, // 12024-12031
+126, 128, 128, 130, 129, 130, 130, 129, // 12032-12039
+130, 129, 129, 129, 129, 130, 130, 132, // 12040-12047
+132, 134, 134, 134, 134, 133, 132, 131, // 12048-12055
+130, 129, 128, 127, 126, 124, 123, 120, // 12056-12063
+118, 118, 116, 119, 119, 123, 124, 125, // 12064-12071
+128, 128, 130, 130, 130, 131, 129, 130, // 12072-12079
+129, 128, 129, 127, 130, 129, 130, 132, // 12080-12087
+132, 134, 134, 134, 134, 132, 133, 130, // 12088-12095
+129, 129, 127, 126, 126, 122, 124, 118, // 12096-12103
+120, 117, 117, 120, 118, 124, 124, 127, // 12104-12111
+128, 129, 129, 130, 129, 131, 128, 130, // 12112-12119
+128, 128, 129, 127, 130, 129, 131, 132, // 12120-12127
+133, 135, 134, 134, 135, 132, 133, 131, // 12128-12135
+129, 130, 126, 127, 125, 124, 123, 119, // 12136-12143
+119, 117, 117, 118, 119, 123, 124, 126, // 12144-12151
+127, 128, 129, 129, 130, 130, 130, 130, // 12152-12159
+129, 128, 129, 128, 128, 130, 130, 132, // 12160-12167
+133, 133, 134, 132, 134, 132, 133, 132, // 12168-12175
+130, 130, 128, 127, 126, 125, 123, 122, // 12176-12183
+118, 118, 117, 118, 120, 120, 124, 124, // 12184-12191
+126, 127, 128, 130, 129, 130, 131, 129, // 12192-12199
+131, 129, 128, 129, 127, 130, 129, 131, // 12200-12207
+132, 131, 134, 132, 133, 134, 132, 133, // 12208-12215
+130, 130, 129, 127, 127, 126, 124, 123, // 12216-12223
+121, 119, 119, 117, 119, 120, 122, 124, // 12224-12231
+125, 127, 128, 129, 130, 130, 130, 130, // 12232-12239
+129, 130, 128, 128, 128, 128, 130, 130, // 12240-12247
+131, 132, 132, 133, 133, 133, 134, 132, // 12248-12255
+133, 130, 130, 128, 127, 127, 125, 125, // 12256-12263
+122, 121, 119, 119, 117, 119, 119, 122, // 12264-12271
+123, 126, 127, 129, 129, 130, 130, 130, // 12272-12279
+130, 129, 129, 128, 128, 128, 128, 129, // 12280-12287
+130, 130, 132, 133, 133, 134, 133, 134, // 12288-12295
+133, 132, 131, 129, 129, 127, 126, 126, // 12296-12303
+124, 123, 121, 118, 118, 117, 119, 120, // 12304-12311
+122, 125, 126, 128, 129, 129, 130, 130, // 12312-12319
+130, 130, 129, 129, 128, 127, 128, 127, // 12320-12327
+129, 130, 130, 132, 132, 133, 133, 132, // 12328-12335
+133, 132, 132, 131, 129, 129, 126, 127, // 12336-12343
+124, 125, 122, 122, 119, 119, 118, 118, // 12344-12351
+121, 121, 125, 125, 128, 128, 129, 129, // 12352-12359
+130, 129, 131, 129, 129, 128, 128, 128, // 12360-12367
+128, 128, 130, 131, 132, 132, 132, 133, // 12368-12375
+133, 133, 133, 132, 132, 130, 130, 128, // 12376-12383
+127, 127, 126, 126, 123, 122, 119, 119, // 12384-12391
+117, 119, 119, 122, 124, 125, 127, 127, // 12392-12399
+128, 128, 129, 129, 129, 129, 129, 128, // 12400-12407
+127, 128, 127, 130, 130, 131, 132, 132, // 12408-12415
+133, 132, 133, 133, 133, 133, 131, 131, // 12416-12423
+129, 128, 128, 126, 127, 125, 124, 122, // 12424-12431
+120, 119, 118, 120, 120, 123, 124, 126, // 12432-12439
+127, 128, 128, 129, 128, 130, 129, 129, // 12440-12447
+129, 128, 128, 127, 129, 129, 130, 131, // 12448-12455
+131, 132, 132, 133, 132, 133, 132, 132, // 12456-12463
+131, 131, 129, 128, 127, 126, 126, 125, // 12464-12471
+123, 122, 120, 119, 119, 119, 121, 121, // 12472-12479
+124, 125, 126, 127, 128, 129, 129, 130, // 12480-12487
+129, 130, 129, 129, 128, 128, 129, 129, // 12488-12495
+131, 130, 132, 132, 132, 133, 132, 133, // 12496-12503
+133, 132, 132, 130, 130, 129, 127, 127, // 12504-12511
+126, 125, 124, 122, 121, 119, 119, 118, // 12512-12519
+120, 121, 122, 124, 125, 126, 127, 128, // 12520-12527
+129, 130, 130, 130, 129, 129, 129, 128, // 12528-12535
+129, 129, 130, 132, 131, 133, 132, 132, // 12536-12543
+132, 132, 132, 132, 131, 131, 130, 129, // 12544-12551
+128, 126, 126, 125, 124, 122, 122, 119, // 12552-12559
+120, 119, 120, 121, 122, 124, 125, 127, // 12560-12567
+127, 128, 129, 130, 129, 130, 129, 130, // 12568-12575
+129, 129, 129, 129, 130, 131, 131, 132, // 12576-12583
+132, 132, 132, 131, 131, 131, 131, 131, // 12584-12591
+130, 130, 128, 127, 127, 125, 125, 124, // 12592-12599
+122, 122, 120, 120, 120, 120, 122, 122, // 12600-12607
+125, 126, 127, 128, 129, 129, 130, 129, // 12608-12615
+130, 129, 129, 129, 128, 129, 128, 130, // 12616-12623
+130, 131, 131, 132, 131, 132, 131, 131, // 12624-12631
+132, 131, 131, 130, 130, 128, 127, 126, // 12632-12639
+126, 124, 124, 122, 123, 120, 120, 120, // 12640-12647
+120, 122, 122, 124, 126, 126, 127, 128, // 12648-12655
+128, 129, 128, 129, 129, 129, 129, 128, // 12656-12663
+129, 129, 130, 131, 131, 132, 132, 132, // 12664-12671
+132, 132, 132, 132, 131, 132, 130, 130, // 12672-12679
+129, 127, 127, 126, 124, 125, 122, 123, // 12680-12687
+121, 121, 121, 120, 123, 122, 124, 126, // 12688-12695
+125, 127, 127, 127, 129, 128, 129, 129, // 12696-12703
+129, 129, 128, 129, 129, 130, 131, 131, // 12704-12711
+132, 132, 131, 131, 131, 131, 131, 131, // 12712-12719
+131, 130, 130, 129, 128, 127, 126, 126, // 12720-12727
+125, 124, 123, 122, 121, 121, 121, 122, // 12728-12735
+122, 124, 125, 126, 127, 127, 128, 128, // 12736-12743
+129, 129, 130, 129, 129, 129, 129, 128, // 12744-12751
+129, 129, 131, 131, 131, 131, 131, 131, // 12752-12759
+131, 131, 131, 131, 131, 131, 129, 129, // 12760-12767
+127, 126, 126, 125, 124, 123, 122, 121, // 12768-12775
+121, 120, 121, 122, 124, 124, 126, 127, // 12776-12783
+127, 128, 128, 128, 129, 129, 130, 129, // 12784-12791
+129, 129, 128, 129, 129, 130, 131, 131, // 12792-12799
+132, 132, 131, 131, 131, 131, 131, 131, // 12800-12807
+131, 129, 129, 128, 126, 127, 125, 125, // 12808-12815
+124, 122, 122, 120, 121, 121, 121, 123, // 12816-12823
+124, 125, 126, 126, 127, 127, 128, 129, // 12824-12831
+129, 130, 130, 129, 129, 128, 129, 129, // 12832-12839
+130, 131, 131, 132, 131, 131, 131, 130, // 12840-12847
+131, 131, 131, 132, 130, 130, 128, 127, // 12848-12855
+127, 126, 125, 125, 123, 123, 121, 120, // 12856-12863
+121, 121, 123, 123, 125, 126, 126, 127, // 12864-12871
+128, 128, 129, 129, 130, 130, 130, 129, // 12872-12879
+129, 128, 129, 129, 129, 131, 130, 131, // 12880-12887
+131, 130, 131, 131, 131, 132, 131, 132, // 12888-12895
+130, 129, 129, 126, 127, 125, 124, 125, // 12896-12903
+122, 123, 121, 120, 122, 120, 123, 123, // 12904-12911
+124, 127, 125, 127, 127, 127, 129, 128, // 12912-12919
+129, 129, 129, 129, 129, 128, 129, 129, // 12920-12927
+129, 131, 131, 131, 132, 131, 132, 131, // 12928-12935
+131, 133, 130, 132, 130, 129, 129, 126, // 12936-12943
+127, 125, 125, 125, 122, 124, 120, 121, // 12944-12951
+121, 120, 124, 123, 125, 126, 125, 127, // 12952-12959
+127, 127, 128, 128, 130, 129, 129, 128, // 12960-12967
+129, 128, 129, 129, 130, 132, 130, 132, // 12968-12975
+131, 130, 132, 130, 132, 131, 131, 132, // 12976-12983
+129, 130, 127, 126, 127, 124, 126, 124, // 12984-12991
+123, 123, 120, 122, 120, 121, 124, 123, // 12992-12999
+126, 126, 126, 128, 127, 129, 128, 129, // 13000-13007
+130, 128, 130, 128, 129, 128, 128, 130, // 13008-13015
+129, 131, 131, 131, 132, 130, 132, 131, // 13016-13023
+132, 132, 131, 132, 130, 130, 128, 126, // 13024-13031
+127, 124, 125, 124, 122, 123, 120, 121, // 13032-13039
+121, 121, 124, 123, 126, 126, 126, 127, // 13040-13047
+127, 128, 128, 129, 129, 129, 130, 127, // 13048-13055
+129, 128, 128, 130, 128, 132, 131, 131, // 13056-13063
+132, 129, 132, 131, 131, 133, 130, 132, // 13064-13071
+129, 129, 128, 125, 127, 124, 125, 124, // 13072-13079
+121, 123, 120, 121, 121, 121, 124, 123, // 13080-13087
+126, 127, 126, 128, 127, 128, 129, 129, // 13088-13095
+130, 130, 130, 129, 129, 128, 129, 130, // 13096-13103
+129, 131, 131, 131, 132, 130, 131, 131, // 13104-13111
+131, 132, 131, 132, 130, 129, 128, 125, // 13112-13119
+126, 125, 124, 125, 122, 123, 121, 120, // 13120-13127
+122, 120, 124, 124, 125, 128, 126, 128, // 13128-13135
+128, 128, 129, 129, 130, 129, 130, 129, // 13136-13143
+128, 129, 127, 129, 130, 129, 132, 130, // 13144-13151
+131, 131, 130, 132, 131, 132, 132, 131, // 13152-13159
+131, 129, 128, 126, 126, 125, 124, 125, // 13160-13167
+122, 123, 121, 120, 122, 119, 124, 124, // 13168-13175
+124, 128, 126, 128, 128, 127, 129, 128, // 13176-13183
+130, 129, 130, 129, 128, 129, 128, 129, // 13184-13191
+130, 130, 132, 130, 131, 131, 130, 132, // 13192-13199
+130, 132, 132, 131, 132, 129, 129, 127, // 13200-13207
+126, 126, 124, 125, 123, 122, 122, 119, // 13208-13215
+122, 121, 122, 125, 124, 126, 127, 126, // 13216-13223
+128, 127, 128, 129, 129, 130, 130, 129, // 13224-13231
+128, 129, 128, 129, 130, 130, 131, 131, // 13232-13239
+130, 131, 130, 131, 131, 132, 132, 132, // 13240-13247
+131, 130, 129, 126, 127, 126, 124, 126, // 13248-13255
+123, 122, 122, 119, 122, 121, 122, 125, // 13256-13263
+124, 126, 127, 126, 127, 127, 128, 129, // 13264-13271
+130, 129, 130, 129, 128, 129, 127, 128, // 13272-13279
+130, 129, 131, 131, 130, 131, 130, 130, // 13280-13287
+132, 131, 132, 132, 131, 130, 129, 127, // 13288-13295
+126, 126, 124, 125, 124, 122, 123, 120, // 13296-13303
+121, 123, 121, 126, 126, 125, 129, 126, // 13304-13311
+127, 129, 127, 130, 130, 129, 130, 129, // 13312-13319
+128, 129, 127, 128, 130, 129, 130, 131, // 13320-13327
+129, 131, 130, 130, 131, 131, 132, 131, // 13328-13335
+131, 129, 129, 127, 125, 127, 123, 125, // 13336-13343
+124, 120, 124, 120, 120, 124, 120, 125, // 13344-13351
+126, 125, 129, 126, 127, 129, 127, 130, // 13352-13359
+130, 130, 130, 129, 128, 128, 128, 127, // 13360-13367
+129, 130, 130, 132, 130, 131, 131, 130, // 13368-13375
+132, 132, 132, 133, 131, 130, 129, 126, // 13376-13383
+126, 126, 124, 125, 123, 121, 122, 120, // 13384-13391
+120, 123, 121, 124, 126, 125, 128, 127, // 13392-13399
+127, 129, 127, 129, 130, 129, 129, 129, // 13400-13407
+128, 128, 128, 128, 129, 130, 131, 131, // 13408-13415
+131, 131, 131, 131, 132, 132, 133, 132, // 13416-13423
+131, 130, 129, 127, 126, 126, 124, 125, // 13424-13431
+124, 121, 122, 120, 120, 123, 121, 125, // 13432-13439
+126, 125, 129, 127, 127, 129, 127, 129, // 13440-13447
+130, 129, 129, 129, 128, 127, 128, 128, // 13448-13455
+129, 130, 129, 131, 130, 130, 131, 130, // 13456-13463
+131, 132, 132, 132, 131, 129, 129, 127, // 13464-13471
+126, 126, 124, 125, 124, 121, 123, 120, // 13472-13479
+120, 123, 122, 125, 127, 126, 128, 127, // 13480-13487
+127, 129, 128, 129, 130, 130, 129, 129, // 13488-13495
+127, 127, 128, 128, 129, 130, 130, 130, // 13496-13503
+130, 130, 130, 131, 131, 132, 132, 132, // 13504-13511
+131, 129, 128, 127, 125, 126, 124, 124, // 13512-13519
+124, 120, 122, 121, 120, 124, 122, 125, // 13520-13527
+128, 126, 128, 127, 127, 128, 128, 129, // 13528-13535
+129, 129, 129, 128, 128, 127, 128, 128, // 13536-13543
+129, 130, 131, 131, 131, 131, 131, 132, // 13544-13551
+132, 133, 133, 132, 131, 130, 128, 126, // 13552-13559
+126, 125, 123, 125, 122, 121, 123, 120, // 13560-13567
+120, 124, 122, 125, 127, 126, 128, 128, // 13568-13575
+127, 128, 129, 129, 130, 129, 129, 128, // 13576-13583
+127, 128, 127, 128, 129, 129, 131, 130, // 13584-13591
+130, 131, 130, 132, 132, 132, 133, 132, // 13592-13599
+131, 130, 127, 127, 125, 125, 124, 123, // 13600-13607
+123, 121, 121, 121, 119, 123, 124, 124, // 13608-13615
+128, 127, 127, 129, 127, 128, 129, 129, // 13616-13623
+130, 130, 129, 129, 128, 127, 128, 128, // 13624-13631
+128, 130, 130, 130, 131, 130, 130, 131, // 13632-13639
+132, 132, 133, 132, 131, 129, 127, 126, // 13640-13647
+125, 125, 124, 124, 123, 120, 122, 121, // 13648-13655
+120, 123, 124, 124, 127, 127, 127, 128, // 13656-13663
+127, 128, 129, 128, 130, 130, 129, 129, // 13664-13671
+128, 127, 128, 128, 129, 130, 131, 131, // 13672-13679
+131, 131, 131, 131, 132, 132, 133, 132, // 13680-13687
+131, 130, 127, 127, 126, 125, 124, 124, // 13688-13695
+124, 121, 120, 122, 119, 120, 125, 123, // 13696-13703
+125, 127, 127, 128, 127, 128, 129, 128, // 13704-13711
+129, 131, 129, 129, 129, 128, 128, 128, // 13712-13719
+129, 130, 130, 130, 131, 130, 131, 131, // 13720-13727
+131, 132, 133, 131, 132, 132, 128, 127, // 13728-13735
+127, 126, 124, 124, 125, 122, 119, 122, // 13736-13743
+122, 119, 122, 125, 124, 125, 127, 128, // 13744-13751
+127, 127, 129, 129, 128, 130, 130, 128, // 13752-13759
+128, 129, 128, 128, 128, 130, 130, 130, // 13760-13767
+131, 131, 131, 131, 131, 132, 132, 133, // 13768-13775
+131, 131, 130, 127, 126, 126, 125, 124, // 13776-13783
+124, 125, 122, 119, 123, 122, 119, 123, // 13784-13791
+126, 124, 125, 127, 128, 126, 126, 130, // 13792-13799
+129, 127, 130, 131, 129, 128, 129, 129, // 13800-13807
+128, 129, 131, 131, 130, 131, 132, 130, // 13808-13815
+130, 131, 132, 132, 131, 131, 131, 128, // 13816-13823
+127, 126, 126, 125, 124, 124, 124, 120, // 13824-13831
+120, 123, 121, 120, 124, 126, 125, 126, // 13832-13839
+128, 128, 126, 127, 129, 129, 128, 129, // 13840-13847
+129, 128, 128, 128, 128, 129, 129, 130, // 13848-13855
+131, 131, 130, 131, 131, 131, 131, 132, // 13856-13863
+132, 131, 130, 129, 128, 127, 126, 126, // 13864-13871
+125, 125, 125, 124, 123, 123, 123, 123, // 13872-13879
+124, 124, 125, 125, 125, 126, 126, 125, // 13880-13887
+127, 127, 128, 129, 129, 129, 129, 129, // 13888-13895
+129, 129, 129, 130, 130, 130, 130, 130, // 13896-13903
+130, 130, 130, 130, 130, 131, 131, 130, // 13904-13911
+130, 129, 128, 128, 127, 127, 127, 126, // 13912-13919
+126, 125, 122, 122, 123, 121, 122, 123, // 13920-13927
+123, 123, 125, 125, 125, 127, 127, 129, // 13928-13935
+129, 130, 130, 130, 129, 129, 129, 129, // 13936-13943
+129, 130, 130, 130, 130, 130, 130, 130, // 13944-13951
+131, 131, 131, 131, 131, 130, 129, 129, // 13952-13959
+128, 127, 127, 126, 125, 125, 124, 122, // 13960-13967
+122, 122, 121, 123, 124, 123, 125, 125, // 13968-13975
+125, 126, 127, 127, 129, 130, 130, 130, // 13976-13983
+130, 129, 129, 129, 129, 129, 129, 130, // 13984-13991
+130, 129, 130, 129, 129, 130, 130, 131, // 13992-13999
+131, 130, 130, 129, 128, 128, 128, 127, // 14000-14007
+126, 125, 125, 123, 122, 123, 122, 121, // 14008-14015
+123, 124, 123, 124, 126, 125, 126, 128, // 14016-14023
+128, 129, 130, 130, 130, 130, 129, 129, // 14024-14031
+129, 129, 129, 130, 130, 129, 130, 130, // 14032-14039
+129, 130, 131, 131, 131, 131, 131, 131, // 14040-14047
+129, 129, 128, 128, 127, 126, 125, 124, // 14048-14055
+123, 122, 122, 121, 121, 123, 123, 123, // 14056-14063
+125, 125, 125, 126, 127, 128, 129, 129, // 14064-14071
+129, 130, 129, 129, 130, 129, 129, 130, // 14072-14079
+130, 130, 130, 130, 130, 130, 131, 131, // 14080-14087
+131, 131, 131, 130, 130, 129, 128, 127, // 14088-14095
+127, 126, 125, 125, 124, 122, 122, 122, // 14096-14103
+122, 121, 123, 124, 124, 125, 125, 125, // 14104-14111
+127, 127, 128, 129, 129, 130, 130, 130, // 14112-14119
+129, 129, 130, 130, 130, 131, 131, 130, // 14120-14127
+130, 130, 130, 130, 131, 131, 130, 130, // 14128-14135
+129, 129, 128, 127, 127, 126, 126, 125, // 14136-14143
+124, 124, 122, 122, 122, 122, 122, 124, // 14144-14151
+124, 124, 125, 125, 126, 127, 128, 129, // 14152-14159
+130, 130, 130, 130, 130, 130, 129, 130, // 14160-14167
+130, 130, 131, 131, 130, 130, 131, 130, // 14168-14175
+131, 131, 131, 131, 130, 130, 128, 128, // 14176-14183
+127, 126, 126, 125, 124, 123, 123, 122, // 14184-14191
+122, 122, 122, 123, 123, 124, 124, 125, // 14192-14199
+125, 126, 128, 128, 128, 129, 129, 129, // 14200-14207
+129, 129, 129, 129, 130, 131, 130, 131, // 14208-14215
+131, 131, 131, 131, 131, 132, 132, 131, // 14216-14223
+131, 130, 129, 128, 127, 127, 126, 126, // 14224-14231
+125, 124, 123, 122, 122, 122, 122, 122, // 14232-14239
+123, 124, 124, 125, 126, 126, 128, 128, // 14240-14247
+129, 129, 129, 129, 129, 129, 130, 130, // 14248-14255
+130, 131, 131, 131, 131, 131, 131, 131, // 14256-14263
+131, 132, 132, 131, 131, 130, 129, 128, // 14264-14271
+127, 126, 126, 125, 124, 123, 122, 121, // 14272-14279
+121, 121, 121, 122, 122, 123, 124, 124, // 14280-14287
+125, 126, 127, 128, 129, 129, 129, 130, // 14288-14295
+130, 130, 131, 131, 132, 132, 133, 133, // 14296-14303
+132, 132, 132, 133, 133, 132, 132, 131, // 14304-14311
+130, 128, 128, 127, 126, 125, 124, 123, // 14312-14319
+122, 121, 121, 120, 120, 121, 121, 122, // 14320-14327
+123, 123, 124, 125, 126, 127, 129, 129, // 14328-14335
+130, 131, 131, 131, 132, 132, 133, 133, // 14336-14343
+133, 133, 133, 132, 132, 132, 131, 131, // 14344-14351
+130, 130, 129, 128, 126, 126, 125, 124, // 14352-14359
+123, 123, 121, 121, 121, 120, 120, 121, // 14360-14367
+122, 122, 124, 125, 125, 126, 128, 128, // 14368-14375
+129, 131, 131, 132, 132, 133, 133, 133, // 14376-14383
+133, 133, 133, 133, 133, 132, 132, 131, // 14384-14391
+130, 130, 129, 128, 127, 126, 125, 124, // 14392-14399
+124, 122, 122, 121, 121, 120, 121, 121, // 14400-14407
+121, 122, 122, 123, 125, 126, 127, 128, // 14408-14415
+129, 130, 131, 132, 132, 132, 133, 133, // 14416-14423
+133, 133, 133, 132, 132, 132, 131, 131, // 14424-14431
+131, 130, 130, 129, 128, 127, 126, 125, // 14432-14439
+125, 124, 123, 122, 121, 121, 121, 121, // 14440-14447
+121, 121, 122, 124, 124, 126, 127, 128, // 14448-14455
+129, 131, 131, 132, 133, 133, 133, 133, // 14456-14463
+133, 132, 132, 131, 131, 130, 130, 129, // 14464-14471
+129, 129, 128, 128, 128, 127, 126, 126, // 14472-14479
+125, 124, 123, 123, 122, 122, 121, 121, // 14480-14487
+122, 122, 123, 124, 125, 126, 128, 129, // 14488-14495
+130, 131, 132, 133, 133, 133, 133, 133, // 14496-14503
+132, 132, 131, 131, 130, 130, 129, 129, // 14504-14511
+128, 128, 128, 127, 127, 126, 126, 125, // 14512-14519
+125, 124, 124, 123, 122, 122, 122, 122, // 14520-14527
+122, 123, 124, 124, 125, 127, 127, 129, // 14528-14535
+130, 131, 131, 132, 132, 132, 132, 132, // 14536-14543
+132, 131, 131, 130, 130, 130, 129, 129, // 14544-14551
+128, 128, 128, 128, 128, 127, 126, 126, // 14552-14559
+125, 125, 124, 124, 123, 123, 123, 123, // 14560-14567
+123, 123, 124, 125, 126, 126, 128, 129, // 14568-14575
+129, 130, 131, 131, 131, 131, 132, 131, // 14576-14583
+131, 131, 130, 130, 130, 129, 129, 129, // 14584-14591
+128, 128, 128, 128, 127, 127, 127, 126, // 14592-14599
+126, 125, 124, 124, 124, 123, 123, 123, // 14600-14607
+123, 124, 124, 125, 126, 127, 127, 128, // 14608-14615
+129, 130, 130, 131, 131, 131, 131, 131, // 14616-14623
+131, 131, 130, 130, 129, 129, 129, 128, // 14624-14631
+128, 128, 128, 127, 128, 127, 127, 126, // 14632-14639
+126, 126, 125, 125, 125, 124, 124, 124, // 14640-14647
+124, 124, 125, 125, 125, 126, 127, 128, // 14648-14655
+129, 129, 129, 130, 130, 131, 131, 131, // 14656-14663
+131, 130, 130, 130, 130, 129, 129, 128, // 14664-14671
+128, 128, 128, 127, 127, 127, 127, 126, // 14672-14679
+126, 126, 126, 125, 125, 125, 125, 125, // 14680-14687
+125, 125, 125, 125, 126, 126, 127, 127, // 14688-14695
+128, 129, 129, 129, 130, 130, 130, 131, // 14696-14703
+130, 130, 130, 130, 130, 129, 129, 129, // 14704-14711
+129, 128, 128, 128, 127, 127, 127, 126, // 14712-14719
+126, 126, 126, 126, 125, 125, 125, 125, // 14720-14727
+125, 125, 125, 126, 126, 126, 127, 127, // 14728-14735
+128, 128, 129, 129, 130, 130, 130, 131, // 14736-14743
+130, 130, 130, 130, 129, 129, 128, 129, // 14744-14751
+128, 127, 128, 127, 127, 127, 126, 126, // 14752-14759
+126, 126, 125, 125, 126, 126, 125, 125, // 14760-14767
+125, 126, 125, 125, 126, 127, 127, 127, // 14768-14775
+127, 129, 130, 129, 130, 130, 131, 131, // 14776-14783
+130, 129, 131, 130, 129, 129, 129, 129, // 14784-14791
+128, 127, 128, 129, 128, 127, 126, 127, // 14792-14799
+127, 125, 125, 126, 126, 125, 124, 124, // 14800-14807
+125, 125, 124, 124, 126, 127, 126, 126, // 14808-14815
+128, 129, 128, 128, 130, 130, 130, 130, // 14816-14823
+130, 130, 130, 129, 129, 130, 130, 129, // 14824-14831
+129, 129, 129, 128, 128, 128, 128, 127, // 14832-14839
+126, 126, 126, 126, 124, 125, 125, 124, // 14840-14847
+124, 125, 125, 126, 126, 126, 127, 128, // 14848-14855
+128, 128, 129, 129, 129, 129, 130, 130, // 14856-14863
+130, 130, 130, 130, 129, 129, 129, 129, // 14864-14871
+129, 128, 128, 128, 127, 127, 127, 127, // 14872-14879
+126, 126, 125, 125, 125, 124, 125, 125, // 14880-14887
+124, 125, 125, 126, 126, 126};// 14888-14893
+
+#define P2_WIN_N 11045
+
+const uint8_t P2Win[P2_WIN_N] = {
+127, 124, 122, 120, 120, 121, 123, 127, // 0-7
+130, 133, 133, 133, 131, 130, 127, 126, // 8-15
+126, 126, 126, 126, 127, 126, 127, 128, // 16-23
+130, 131, 132, 133, 134, 133, 130, 127, // 24-31
+123, 119, 114, 114, 116, 121, 127, 133, // 32-39
+137, 139, 137, 134, 130, 126, 124, 124, // 40-47
+124, 125, 126, 127, 126, 126, 126, 127, // 48-55
+130, 132, 134, 135, 135, 134, 133, 131, // 56-63
+129, 124, 119, 114, 111, 112, 115, 122, // 64-71
+129, 136, 140, 141, 138, 134, 129, 125, // 72-79
+122, 122, 124, 125, 127, 128, 129, 128, // 80-87
+126, 125, 125, 127, 129, 132, 135, 136, // 88-95
+134, 132, 128, 126, 125, 126, 128, 128, // 96-103
+126, 122, 118, 114, 114, 116, 122, 130, // 104-111
+137, 141, 142, 139, 133, 127, 123, 120, // 112-119
+120, 123, 125, 127, 128, 128, 129, 129, // 120-127
+130, 132, 133, 134, 134, 133, 133, 131, // 128-135
+128, 124, 119, 114, 111, 111, 114, 120, // 136-143
+128, 136, 141, 143, 141, 136, 130, 124, // 144-151
+121, 120, 121, 123, 124, 125, 126, 127, // 152-159
+129, 131, 133, 135, 136, 137, 136, 135, // 160-167
+132, 128, 121, 115, 109, 107, 109, 114, // 168-175
+124, 134, 143, 147, 147, 141, 134, 126, // 176-183
+120, 118, 118, 121, 124, 126, 126, 126, // 184-191
+125, 125, 128, 132, 135, 138, 138, 137, // 192-199
+135, 133, 130, 127, 121, 115, 109, 106, // 200-207
+107, 113, 123, 134, 144, 149, 149, 144, // 208-215
+136, 127, 119, 115, 115, 117, 121, 124, // 216-223
+126, 127, 128, 130, 132, 135, 136, 137, // 224-231
+136, 135, 133, 131, 129, 127, 121, 115, // 232-239
+108, 106, 108, 115, 126, 137, 146, 151, // 240-247
+149, 142, 133, 123, 117, 115, 116, 121, // 248-255
+125, 127, 128, 128, 128, 129, 132, 136, // 256-263
+138, 139, 139, 138, 135, 132, 126, 117, // 264-271
+108, 100,  98, 104, 115, 130, 143, 152, // 272-279
+153, 148, 139, 128, 119, 115, 115, 118, // 280-287
+123, 126, 127, 125, 124, 124, 127, 133, // 288-295
+138, 142, 142, 140, 138, 136, 133, 129, // 296-303
+120, 111, 102,  98, 102, 112, 127, 142, // 304-311
+152, 155, 151, 141, 130, 120, 114, 113, // 312-319
+117, 122, 126, 127, 126, 124, 124, 126, // 320-327
+132, 137, 141, 141, 139, 136, 134, 132, // 328-335
+130, 124, 115, 106,  98,  99, 106, 121, // 336-343
+137, 149, 155, 153, 145, 134, 123, 116, // 344-351
+114, 117, 122, 125, 127, 125, 122, 123, // 352-359
+126, 133, 139, 143, 144, 141, 137, 134, // 360-367
+132, 130, 122, 113, 102,  95,  96, 105, // 368-375
+123, 140, 153, 159, 154, 143, 130, 119, // 376-383
+115, 114, 118, 123, 124, 124, 121, 121, // 384-391
+125, 131, 140, 145, 146, 143, 136, 134, // 392-399
+132, 133, 131, 120, 108,  94,  90,  95, // 400-407
+111, 133, 151, 161, 160, 149, 135, 121, // 408-415
+113, 113, 117, 123, 126, 125, 122, 117, // 416-423
+118, 124, 134, 144, 150, 148, 141, 131, // 424-431
+128, 130, 136, 137, 126, 112,  93,  87, // 432-439
+ 93, 114, 139, 157, 165, 157, 141, 122, // 440-447
+109, 106, 113, 125, 135, 137, 134, 126, // 448-455
+120, 117, 120, 127, 134, 138, 138, 134, // 456-463
+131, 131, 138, 145, 148, 134, 113,  90, // 464-471
+ 81,  90, 112, 142, 159, 164, 152, 132, // 472-479
+116, 109, 114, 124, 134, 138, 131, 123, // 480-487
+117, 119, 127, 132, 135, 131, 127, 124, // 488-495
+125, 132, 139, 149, 153, 149, 134, 107, // 496-503
+ 89,  80,  96, 120, 144, 156, 148, 136, // 504-511
+122, 120, 127, 133, 133, 124, 114, 112, // 512-519
+119, 136, 146, 146, 132, 114, 109, 116, // 520-527
+132, 142, 144, 137, 131, 137, 145, 150, // 528-535
+129,  96,  77,  79, 117, 143, 161, 148, // 536-543
+126, 120, 125, 140, 142, 125, 108, 100, // 544-551
+117, 141, 154, 150, 126, 109, 108, 122, // 552-559
+139, 138, 130, 121, 127, 147, 165, 161, // 560-567
+137,  87,  73,  82, 119, 149, 140, 136, // 568-575
+116, 133, 148, 148, 135, 107,  98, 113, // 576-583
+130, 147, 139, 129, 127, 125, 136, 128, // 584-591
+122, 117, 119, 137, 143, 147, 148, 142, // 592-599
+141, 118,  88,  89,  89, 129, 133, 140, // 600-607
+137, 128, 144, 140, 135, 123, 107, 113, // 608-615
+124, 132, 140, 131, 137, 131, 125, 126, // 616-623
+117, 128, 126, 131, 137, 137, 151, 154, // 624-631
+145, 128,  80,  89,  99, 124, 137, 117, // 632-639
+135, 134, 152, 148, 121, 114, 112, 121, // 640-647
+134, 123, 127, 129, 138, 147, 122, 119, // 648-655
+112, 128, 137, 128, 131, 134, 151, 164, // 656-663
+144, 129,  86,  85, 113, 112, 131, 109, // 664-671
+135, 150, 148, 143, 117, 116, 129, 122, // 672-679
+120, 116, 126, 147, 138, 136, 120, 119, // 680-687
+130, 121, 127, 122, 134, 149, 145, 152, // 688-695
+145, 139, 119,  74, 106, 104, 122, 121, // 696-703
+117, 152, 147, 143, 130, 114, 132, 125, // 704-711
+113, 120, 121, 142, 137, 129, 131, 121, // 712-719
+128, 121, 118, 129, 131, 141, 142, 144, // 720-727
+157, 142, 129,  84,  96, 118, 109, 116, // 728-735
+115, 145, 152, 134, 128, 131, 130, 130, // 736-743
+107, 117, 131, 134, 133, 129, 136, 127, // 744-751
+122, 121, 126, 132, 130, 134, 144, 148, // 752-759
+155, 138, 130,  97,  99, 118,  99, 113, // 760-767
+119, 143, 140, 130, 132, 142, 126, 121, // 768-775
+115, 121, 130, 124, 130, 136, 135, 121, // 776-783
+115, 134, 130, 122, 127, 140, 151, 141, // 784-791
+148, 151, 139, 100,  92, 130, 102, 102, // 792-799
+116, 141, 138, 125, 132, 149, 126, 115, // 800-807
+125, 125, 127, 120, 130, 138, 122, 118, // 808-815
+136, 129, 122, 121, 136, 140, 136, 144, // 816-823
+157, 136, 131, 100, 120, 120,  86, 118, // 824-831
+130, 127, 127, 134, 142, 135, 114, 135, // 832-839
+129, 114, 126, 132, 131, 127, 124, 129, // 840-847
+133, 116, 128, 131, 129, 136, 145, 147, // 848-855
+145, 135, 135, 101, 123, 111,  94, 123, // 856-863
+124, 124, 130, 135, 136, 133, 122, 138, // 864-871
+121, 119, 134, 130, 124, 130, 128, 123, // 872-879
+130, 123, 126, 127, 132, 138, 141, 143, // 880-887
+145, 137, 134, 107, 124, 114,  92, 125, // 888-895
+121, 114, 130, 137, 129, 135, 125, 136, // 896-903
+123, 122, 135, 126, 124, 132, 126, 121, // 904-911
+128, 125, 125, 129, 134, 136, 142, 146, // 912-919
+142, 141, 130, 112, 131,  98, 107, 128, // 920-927
+107, 122, 136, 127, 131, 136, 127, 131, // 928-935
+124, 129, 128, 125, 129, 128, 124, 126, // 936-943
+122, 130, 125, 128, 137, 136, 141, 143, // 944-951
+141, 137, 118, 129, 112,  99, 126, 111, // 952-959
+114, 136, 125, 128, 139, 128, 131, 130, // 960-967
+126, 128, 128, 129, 129, 126, 126, 125, // 968-975
+125, 129, 127, 131, 136, 138, 140, 141, // 976-983
+141, 127, 127, 124,  99, 118, 115, 106, // 984-991
+127, 126, 122, 137, 132, 129, 134, 128, // 992-999
+126, 132, 129, 127, 126, 130, 124, 122, // 1000-1007
+133, 123, 130, 139, 133, 138, 144, 136, // 1008-1015
+135, 128, 131, 106, 115, 117, 103, 122, // 1016-1023
+125, 117, 132, 132, 126, 137, 131, 127, // 1024-1031
+132, 130, 125, 126, 131, 125, 121, 135, // 1032-1039
+122, 129, 139, 130, 136, 143, 133, 138, // 1040-1047
+130, 128, 120, 111, 122, 106, 116, 123, // 1048-1055
+117, 128, 131, 125, 134, 133, 128, 132, // 1056-1063
+131, 126, 127, 127, 126, 122, 128, 129, // 1064-1071
+125, 136, 134, 134, 141, 137, 137, 133, // 1072-1079
+130, 124, 112, 123, 109, 111, 123, 117, // 1080-1087
+122, 130, 125, 131, 136, 130, 131, 134, // 1088-1095
+129, 125, 128, 126, 121, 127, 128, 125, // 1096-1103
+135, 135, 134, 141, 138, 137, 135, 130, // 1104-1111
+129, 115, 121, 115, 108, 121, 117, 118, // 1112-1119
+127, 125, 126, 134, 132, 132, 133, 133, // 1120-1127
+127, 128, 129, 120, 126, 129, 124, 133, // 1128-1135
+136, 133, 140, 138, 136, 136, 131, 127, // 1136-1143
+117, 121, 115, 110, 120, 117, 118, 126, // 1144-1151
+125, 124, 132, 132, 129, 134, 132, 128, // 1152-1159
+129, 127, 124, 125, 126, 128, 131, 135, // 1160-1167
+136, 137, 140, 139, 134, 132, 129, 116, // 1168-1175
+120, 118, 110, 120, 121, 117, 125, 128, // 1176-1183
+123, 129, 134, 129, 132, 135, 128, 129, // 1184-1191
+130, 122, 122, 129, 123, 129, 135, 132, // 1192-1199
+137, 141, 137, 136, 134, 128, 118, 119, // 1200-1207
+117, 110, 119, 119, 118, 125, 127, 124, // 1208-1215
+129, 131, 129, 132, 135, 129, 131, 131, // 1216-1223
+124, 125, 127, 125, 128, 133, 133, 137, // 1224-1231
+139, 138, 139, 134, 132, 123, 118, 118, // 1232-1239
+111, 115, 119, 118, 122, 126, 126, 127, // 1240-1247
+131, 131, 130, 133, 131, 128, 130, 127, // 1248-1255
+123, 126, 127, 126, 131, 134, 134, 138, // 1256-1263
+140, 137, 135, 134, 125, 119, 120, 111, // 1264-1271
+113, 119, 117, 120, 126, 125, 126, 132, // 1272-1279
+132, 130, 133, 132, 128, 130, 129, 123, // 1280-1287
+126, 128, 125, 131, 134, 132, 137, 140, // 1288-1295
+137, 136, 135, 129, 121, 121, 115, 111, // 1296-1303
+117, 118, 117, 123, 125, 125, 130, 133, // 1304-1311
+130, 132, 133, 129, 129, 130, 125, 125, // 1312-1319
+128, 125, 128, 133, 132, 135, 138, 138, // 1320-1327
+138, 136, 133, 125, 120, 119, 113, 113, // 1328-1335
+118, 118, 119, 124, 126, 127, 131, 133, // 1336-1343
+130, 132, 132, 129, 129, 128, 124, 124, // 1344-1351
+128, 126, 129, 134, 133, 135, 139, 139, // 1352-1359
+136, 136, 131, 122, 119, 117, 112, 116, // 1360-1367
+119, 117, 121, 126, 125, 128, 133, 131, // 1368-1375
+131, 133, 131, 128, 129, 125, 124, 126, // 1376-1383
+126, 127, 132, 133, 135, 137, 139, 138, // 1384-1391
+134, 133, 126, 119, 119, 114, 114, 118, // 1392-1399
+119, 120, 124, 127, 126, 131, 133, 130, // 1400-1407
+132, 133, 128, 129, 128, 125, 126, 126, // 1408-1415
+127, 130, 133, 134, 136, 138, 139, 135, // 1416-1423
+133, 129, 119, 118, 116, 113, 116, 119, // 1424-1431
+119, 122, 127, 126, 129, 132, 131, 131, // 1432-1439
+133, 130, 128, 130, 125, 125, 127, 126, // 1440-1447
+128, 132, 132, 136, 138, 138, 138, 134, // 1448-1455
+130, 123, 119, 117, 113, 115, 118, 119, // 1456-1463
+121, 125, 126, 127, 131, 131, 130, 132, // 1464-1471
+131, 128, 130, 127, 125, 127, 127, 127, // 1472-1479
+131, 132, 135, 138, 138, 139, 135, 132, // 1480-1487
+126, 119, 118, 115, 114, 118, 120, 121, // 1488-1495
+125, 127, 127, 130, 131, 129, 131, 132, // 1496-1503
+129, 128, 129, 125, 125, 128, 126, 129, // 1504-1511
+134, 135, 137, 139, 139, 135, 133, 129, // 1512-1519
+119, 118, 116, 112, 117, 120, 119, 124, // 1520-1527
+127, 127, 129, 133, 130, 130, 133, 129, // 1528-1535
+127, 130, 125, 124, 128, 126, 129, 134, // 1536-1543
+135, 137, 139, 139, 136, 132, 129, 119, // 1544-1551
+117, 117, 112, 117, 121, 120, 124, 128, // 1552-1559
+127, 129, 132, 131, 129, 132, 129, 126, // 1560-1567
+130, 124, 124, 128, 126, 130, 134, 134, // 1568-1575
+138, 139, 138, 136, 129, 127, 118, 115, // 1576-1583
+117, 113, 118, 121, 122, 126, 129, 129, // 1584-1591
+130, 132, 131, 130, 132, 129, 126, 129, // 1592-1599
+124, 125, 128, 126, 130, 133, 134, 139, // 1600-1607
+138, 138, 136, 128, 127, 118, 114, 116, // 1608-1615
+113, 118, 121, 123, 126, 129, 129, 130, // 1616-1623
+132, 131, 130, 132, 129, 127, 128, 125, // 1624-1631
+125, 127, 127, 131, 134, 136, 139, 138, // 1632-1639
+139, 134, 127, 125, 115, 113, 115, 112, // 1640-1647
+118, 122, 124, 127, 130, 130, 130, 132, // 1648-1655
+131, 130, 132, 128, 128, 127, 126, 127, // 1656-1663
+127, 129, 132, 134, 138, 140, 137, 139, // 1664-1671
+130, 125, 123, 112, 113, 115, 113, 119, // 1672-1679
+123, 124, 128, 130, 130, 130, 132, 131, // 1680-1687
+130, 132, 128, 129, 126, 126, 127, 126, // 1688-1695
+129, 133, 135, 139, 140, 137, 138, 128, // 1696-1703
+123, 120, 110, 113, 115, 114, 121, 125, // 1704-1711
+126, 128, 131, 130, 131, 132, 131, 131, // 1712-1719
+129, 129, 129, 124, 127, 127, 126, 132, // 1720-1727
+134, 136, 142, 139, 138, 136, 123, 122, // 1728-1735
+115, 108, 114, 115, 116, 123, 127, 127, // 1736-1743
+130, 131, 131, 131, 131, 131, 131, 128, // 1744-1751
+130, 128, 124, 129, 127, 127, 133, 135, // 1752-1759
+137, 142, 137, 138, 131, 119, 121, 111, // 1760-1767
+109, 115, 117, 119, 126, 128, 128, 130, // 1768-1775
+131, 130, 130, 131, 131, 130, 128, 131, // 1776-1783
+127, 126, 129, 128, 129, 134, 136, 139, // 1784-1791
+141, 136, 137, 125, 118, 119, 109, 110, // 1792-1799
+116, 117, 120, 127, 130, 128, 130, 131, // 1800-1807
+130, 130, 131, 131, 131, 127, 129, 129, // 1808-1815
+123, 128, 130, 129, 133, 139, 140, 140, // 1816-1823
+138, 137, 124, 117, 119, 108, 109, 116, // 1824-1831
+119, 120, 126, 131, 128, 129, 131, 131, // 1832-1839
+128, 130, 133, 130, 126, 131, 128, 123, // 1840-1847
+128, 131, 129, 133, 140, 142, 138, 137, // 1848-1855
+138, 121, 116, 119, 108, 110, 117, 122, // 1856-1863
+121, 127, 131, 129, 127, 130, 131, 127, // 1864-1871
+129, 132, 131, 125, 130, 130, 123, 127, // 1872-1879
+132, 130, 131, 141, 143, 137, 137, 136, // 1880-1887
+119, 115, 117, 109, 110, 119, 124, 123, // 1888-1895
+128, 133, 130, 126, 129, 131, 126, 128, // 1896-1903
+133, 132, 125, 130, 131, 123, 125, 133, // 1904-1911
+131, 131, 141, 144, 138, 135, 136, 120, // 1912-1919
+113, 115, 110, 109, 118, 126, 124, 128, // 1920-1927
+133, 131, 125, 129, 132, 128, 128, 132, // 1928-1935
+134, 125, 127, 131, 124, 122, 131, 133, // 1936-1943
+130, 138, 146, 139, 133, 135, 123, 110, // 1944-1951
+114, 111, 107, 116, 127, 125, 125, 135, // 1952-1959
+134, 126, 126, 134, 129, 125, 132, 136, // 1960-1967
+126, 125, 133, 126, 121, 128, 134, 130, // 1968-1975
+135, 146, 142, 134, 135, 124, 109, 114, // 1976-1983
+113, 106, 113, 129, 129, 122, 134, 138, // 1984-1991
+126, 123, 134, 132, 124, 128, 137, 131, // 1992-1999
+121, 131, 133, 122, 123, 136, 136, 132, // 2000-2007
+142, 147, 136, 131, 127, 112, 110, 111, // 2008-2015
+108, 111, 124, 130, 123, 130, 136, 130, // 2016-2023
+122, 130, 133, 126, 126, 134, 133, 124, // 2024-2031
+129, 131, 125, 125, 133, 135, 135, 143, // 2032-2039
+145, 138, 134, 129, 111, 109, 115, 110, // 2040-2047
+106, 122, 134, 123, 123, 136, 135, 122, // 2048-2055
+126, 135, 129, 123, 131, 135, 125, 126, // 2056-2063
+131, 128, 124, 130, 136, 135, 140, 146, // 2064-2071
+141, 134, 132, 117, 106, 113, 114, 107, // 2072-2079
+114, 133, 130, 121, 131, 139, 128, 121, // 2080-2087
+131, 134, 126, 126, 133, 129, 126, 127, // 2088-2095
+128, 126, 129, 133, 134, 140, 147, 141, // 2096-2103
+134, 136, 122, 105, 111, 118, 109, 107, // 2104-2111
+130, 136, 121, 124, 141, 135, 120, 126, // 2112-2119
+135, 129, 123, 129, 132, 128, 126, 127, // 2120-2127
+127, 128, 131, 132, 138, 146, 143, 134, // 2128-2135
+134, 127, 106, 106, 117, 113, 106, 123, // 2136-2143
+138, 127, 121, 136, 139, 123, 122, 133, // 2144-2151
+133, 125, 127, 132, 129, 128, 127, 125, // 2152-2159
+128, 134, 133, 134, 145, 148, 136, 131, // 2160-2167
+130, 112, 104, 114, 115, 108, 117, 136, // 2168-2175
+131, 122, 133, 140, 127, 121, 131, 134, // 2176-2183
+126, 125, 131, 129, 127, 127, 125, 127, // 2184-2191
+133, 134, 133, 142, 148, 138, 130, 130, // 2192-2199
+116, 103, 111, 117, 109, 112, 133, 136, // 2200-2207
+123, 128, 141, 134, 121, 126, 135, 130, // 2208-2215
+122, 126, 133, 131, 124, 123, 132, 134, // 2216-2223
+130, 133, 147, 148, 136, 133, 132, 114, // 2224-2231
+102, 111, 117, 108, 112, 132, 135, 123, // 2232-2239
+128, 139, 133, 121, 125, 133, 129, 121, // 2240-2247
+126, 135, 131, 123, 125, 134, 132, 128, // 2248-2255
+135, 148, 147, 136, 136, 133, 114, 102, // 2256-2263
+112, 117, 109, 112, 131, 136, 125, 127, // 2264-2271
+138, 134, 122, 124, 132, 129, 123, 127, // 2272-2279
+133, 131, 126, 126, 130, 132, 131, 135, // 2280-2287
+145, 147, 139, 135, 129, 112, 103, 111, // 2288-2295
+115, 108, 114, 132, 135, 125, 128, 138, // 2296-2303
+134, 123, 125, 132, 130, 124, 124, 131, // 2304-2311
+133, 126, 123, 130, 135, 132, 132, 145, // 2312-2319
+150, 138, 131, 130, 113, 102, 110, 116, // 2320-2327
+109, 113, 133, 136, 125, 127, 139, 134, // 2328-2335
+122, 125, 133, 129, 122, 128, 133, 130, // 2336-2343
+125, 127, 130, 130, 132, 138, 145, 145, // 2344-2351
+139, 135, 126, 108, 104, 114, 113, 108, // 2352-2359
+117, 135, 134, 125, 129, 138, 132, 122, // 2360-2367
+125, 132, 129, 123, 127, 132, 131, 126, // 2368-2375
+125, 130, 133, 133, 136, 146, 147, 139, // 2376-2383
+131, 122, 109, 107, 112, 110, 110, 123, // 2384-2391
+134, 131, 127, 134, 136, 129, 124, 127, // 2392-2399
+130, 128, 124, 127, 132, 132, 124, 123, // 2400-2407
+133, 135, 131, 136, 149, 146, 134, 129, // 2408-2415
+121, 108, 107, 114, 111, 111, 126, 135, // 2416-2423
+130, 128, 136, 137, 128, 124, 128, 130, // 2424-2431
+127, 122, 127, 135, 131, 121, 124, 137, // 2432-2439
+135, 129, 140, 151, 143, 131, 126, 115, // 2440-2447
+106, 110, 112, 107, 115, 132, 134, 127, // 2448-2455
+131, 139, 134, 124, 127, 131, 129, 123, // 2456-2463
+124, 134, 133, 124, 123, 134, 136, 129, // 2464-2471
+135, 148, 146, 135, 132, 121, 106, 108, // 2472-2479
+114, 109, 108, 124, 134, 130, 129, 135, // 2480-2487
+136, 130, 127, 127, 128, 130, 125, 126, // 2488-2495
+133, 134, 124, 123, 135, 136, 131, 138, // 2496-2503
+147, 141, 133, 127, 112, 107, 113, 113, // 2504-2511
+106, 114, 131, 133, 129, 130, 137, 136, // 2512-2519
+129, 125, 128, 131, 127, 124, 130, 135, // 2520-2527
+129, 123, 131, 136, 133, 134, 143, 143, // 2528-2535
+135, 131, 118, 108, 111, 113, 108, 110, // 2536-2543
+125, 131, 130, 130, 134, 136, 130, 127, // 2544-2551
+126, 128, 126, 127, 131, 130, 129, 129, // 2552-2559
+131, 131, 132, 138, 142, 141, 136, 134, // 2560-2567
+121, 110, 111, 113, 111, 110, 121, 129, // 2568-2575
+131, 131, 132, 134, 131, 130, 128, 126, // 2576-2583
+126, 131, 132, 126, 128, 132, 131, 129, // 2584-2591
+132, 139, 141, 140, 137, 132, 122, 113, // 2592-2599
+113, 112, 111, 112, 118, 127, 130, 131, // 2600-2607
+132, 135, 133, 130, 129, 127, 127, 129, // 2608-2615
+131, 127, 128, 131, 130, 130, 132, 137, // 2616-2623
+139, 138, 135, 130, 122, 116, 115, 113, // 2624-2631
+112, 113, 117, 124, 129, 130, 131, 134, // 2632-2639
+135, 132, 129, 127, 129, 131, 129, 127, // 2640-2647
+130, 130, 129, 130, 133, 134, 135, 136, // 2648-2655
+134, 128, 123, 122, 120, 117, 116, 117, // 2656-2663
+118, 122, 125, 126, 127, 130, 131, 131, // 2664-2671
+131, 130, 130, 133, 131, 130, 130, 128, // 2672-2679
+128, 129, 130, 131, 132, 133, 133, 129, // 2680-2687
+126, 126, 125, 121, 119, 119, 119, 119, // 2688-2695
+121, 122, 123, 126, 129, 130, 131, 131, // 2696-2703
+133, 134, 134, 133, 131, 130, 130, 130, // 2704-2711
+130, 131, 131, 131, 131, 130, 127, 126, // 2712-2719
+125, 123, 121, 120, 119, 119, 119, 120, // 2720-2727
+122, 124, 127, 129, 130, 131, 133, 133, // 2728-2735
+133, 133, 132, 132, 132, 131, 131, 132, // 2736-2743
+131, 130, 130, 129, 127, 126, 124, 123, // 2744-2751
+122, 121, 120, 120, 120, 121, 122, 124, // 2752-2759
+126, 128, 131, 132, 132, 132, 133, 133, // 2760-2767
+132, 132, 132, 132, 132, 132, 131, 129, // 2768-2775
+128, 127, 126, 126, 125, 124, 124, 122, // 2776-2783
+122, 121, 121, 121, 122, 125, 126, 128, // 2784-2791
+130, 132, 131, 131, 132, 131, 131, 131, // 2792-2799
+132, 132, 132, 131, 129, 128, 127, 126, // 2800-2807
+125, 125, 125, 125, 124, 123, 123, 122, // 2808-2815
+122, 122, 123, 125, 126, 128, 129, 130, // 2816-2823
+131, 130, 131, 131, 132, 133, 133, 132, // 2824-2831
+132, 131, 129, 128, 126, 126, 126, 125, // 2832-2839
+125, 126, 126, 125, 124, 124, 123, 123, // 2840-2847
+124, 126, 126, 127, 129, 129, 129, 129, // 2848-2855
+129, 130, 131, 132, 132, 132, 132, 130, // 2856-2863
+129, 127, 126, 125, 125, 125, 124, 124, // 2864-2871
+125, 125, 124, 124, 125, 125, 126, 127, // 2872-2879
+127, 128, 129, 129, 129, 129, 129, 129, // 2880-2887
+130, 131, 131, 131, 131, 130, 129, 127, // 2888-2895
+127, 126, 126, 126, 126, 126, 126, 126, // 2896-2903
+125, 125, 125, 126, 127, 127, 127, 128, // 2904-2911
+128, 129, 129, 129, 128, 129, 129, 129, // 2912-2919
+129, 129, 129, 128, 128, 128, 127, 127, // 2920-2927
+126, 126, 126, 126, 126, 126, 126, 126, // 2928-2935
+126, 127, 127, 127, 127, 128, 128, 128, // 2936-2943
+128, 129, 129, 128, 128, 128, 129, 129, // 2944-2951
+129, 129, 129, 129, 128, 127, 126, 126, // 2952-2959
+126, 126, 127, 127, 126, 127, 127, 128, // 2960-2967
+127, 127, 128, 128, 128, 128, 128, 128, // 2968-2975
+128, 128, 128, 128, 128, 128, 128, 128, // 2976-2983
+129, 128, 128, 127, 127, 127, 126, 126, // 2984-2991
+127, 126, 127, 127, 127, 127, 127, 127, // 2992-2999
+127, 127, 127, 127, 128, 128, 128, 128, // 3000-3007
+128, 128, 128, 128, 128, 128, 128, 129, // 3008-3015
+128, 128, 128, 128, 128, 128, 128, 128, // 3016-3023
+127, 128, 128, 127, 127, 127, 127, 127, // 3024-3031
+127, 127, 127, 127, 127, 127, 127, 127, // 3032-3039
+127, 127, 127, 127, 127, 128, 128, 128, // 3040-3047
+128, 128, 128, 128, 128, 128, 128, 128, // 3048-3055
+128, 128, 127, 127, 127, 127, 127, 127, // 3056-3063
+128, 128, 127, 127, 127, 127, 127, 127, // 3064-3071
+127, 128, 127, 127, 128, 128, 128, 127, // 3072-3079
+127, 128, 128, 128, 128, 128, 128, 128, // 3080-3087
+128, 128, 128, 128, 128, 128, 128, 128, // 3088-3095
+128, 128, 127, 127, 127, 127, 127, 127, // 3096-3103
+127, 127, 127, 127, 127, 127, 127, 127, // 3104-3111
+127, 128, 128, 127, 128, 128, 128, 128, // 3112-3119
+128, 128, 128, 128, 128, 128, 128, 128, // 3120-3127
+128, 127, 127, 127, 127, 127, 127, 127, // 3128-3135
+127, 127, 127, 127, 127, 127, 127, 127, // 3136-3143
+127, 128, 128, 128, 128, 128, 129, 128, // 3144-3151
+128, 128, 128, 129, 128, 128, 128, 128, // 3152-3159
+127, 127, 127, 127, 127, 127, 127, 127, // 3160-3167
+127, 127, 127, 127, 127, 127, 127, 127, // 3168-3175
+127, 127, 127, 127, 127, 127, 127, 128, // 3176-3183
+127, 128, 128, 128, 128, 128, 128, 128, // 3184-3191
+128, 128, 127, 128, 128, 128, 128, 128, // 3192-3199
+128, 128, 127, 127, 127, 127, 127, 127, // 3200-3207
+127, 127, 127, 127, 127, 127, 127, 128, // 3208-3215
+128, 128, 128, 128, 128, 128, 128, 128, // 3216-3223
+128, 128, 128, 128, 128, 128, 128, 128, // 3224-3231
+128, 128, 127, 127, 128, 127, 127, 127, // 3232-3239
+127, 127, 127, 127, 127, 127, 127, 128, // 3240-3247
+128, 128, 128, 128, 127, 127, 127, 127, // 3248-3255
+127, 127, 128, 128, 128, 128, 128, 128, // 3256-3263
+128, 128, 128, 127, 127, 127, 127, 127, // 3264-3271
+127, 127, 127, 128, 128, 128, 128, 128, // 3272-3279
+128, 128, 128, 128, 128, 128, 128, 128, // 3280-3287
+128, 128, 128, 128, 128, 128, 128, 127, // 3288-3295
+127, 127, 127, 127, 127, 127, 127, 127, // 3296-3303
+127, 127, 127, 127, 128, 128, 127, 127, // 3304-3311
+127, 127, 127, 127, 127, 127, 127, 128, // 3312-3319
+128, 128, 128, 128, 128, 128, 128, 128, // 3320-3327
+128, 128, 128, 128, 128, 127, 128, 128, // 3328-3335
+128, 127, 128, 128, 128, 127, 127, 127, // 3336-3343
+127, 127, 127, 127, 127, 127, 127, 127, // 3344-3351
+128, 128, 128, 128, 128, 128, 128, 128, // 3352-3359
+128, 128, 128, 128, 128, 128, 128, 128, // 3360-3367
+128, 128, 128, 128, 128, 128, 128, 127, // 3368-3375
+127, 127, 127, 127, 127, 127, 127, 127, // 3376-3383
+127, 127, 127, 127, 127, 127, 127, 127, // 3384-3391
+127, 127, 127, 127, 128, 128, 128, 128, // 3392-3399
+128, 128, 128, 128, 128, 128, 128, 128, // 3400-3407
+127, 128, 128, 128, 128, 128, 128, 128, // 3408-3415
+128, 127, 128, 128, 128, 128, 128, 128, // 3416-3423
+127, 127, 127, 127, 127, 127, 127, 127, // 3424-3431
+127, 127, 127, 127, 127, 127, 127, 127, // 3432-3439
+128, 128, 128, 128, 128, 128, 128, 127, // 3440-3447
+127, 128, 127, 127, 128, 128, 127, 127, // 3448-3455
+127, 127, 127, 127, 128, 128, 128, 128, // 3456-3463
+128, 128, 127, 127, 127, 127, 127, 127, // 3464-3471
+127, 128, 127, 127, 127, 127, 127, 127, // 3472-3479
+127, 127, 127, 127, 127, 128, 128, 128, // 3480-3487
+128, 128, 128, 128, 128, 128, 128, 128, // 3488-3495
+128, 127, 127, 128, 128, 128, 128, 128, // 3496-3503
+128, 128, 128, 128, 128, 128, 128, 128, // 3504-3511
+128, 128, 128, 127, 128, 127, 127, 127, // 3512-3519
+127, 127, 127, 127, 127, 127, 127, 127, // 3520-3527
+127, 127, 127, 127, 127, 127, 128, 128, // 3528-3535
+128, 128, 128, 128, 128, 128, 128, 128, // 3536-3543
+128, 128, 128, 128, 128, 128, 128, 128, // 3544-3551
+128, 128, 128, 128, 128, 128, 128, 127, // 3552-3559
+127, 127, 127, 127, 127, 127, 127, 127, // 3560-3567
+127, 127, 127, 127, 127, 127, 127, 127, // 3568-3575
+127, 127, 127, 127, 127, 127, 128, 128, // 3576-3583
+128, 128, 128, 128, 128, 128, 128, 128, // 3584-3591
+128, 128, 128, 128, 128, 128, 128, 128, // 3592-3599
+128, 128, 128, 128, 128, 127, 127, 127, // 3600-3607
+127, 127, 127, 127, 127, 127, 127, 127, // 3608-3615
+127, 127, 127, 127, 127, 127, 127, 128, // 3616-3623
+128, 128, 128, 128, 128, 128, 128, 128, // 3624-3631
+128, 128, 128, 128, 128, 128, 128, 128, // 3632-3639
+128, 128, 128, 128, 128, 128, 128, 128, // 3640-3647
+127, 127, 127, 127, 127, 127, 127, 127, // 3648-3655
+127, 127, 127, 127, 127, 127, 128, 128, // 3656-3663
+128, 128, 128, 128, 128, 128, 127, 127, // 3664-3671
+127, 128, 127, 128, 128, 127, 128, 128, // 3672-3679
+128, 128, 128, 128, 128, 127, 128, 128, // 3680-3687
+128, 128, 127, 127, 127, 128, 127, 128, // 3688-3695
+127, 128, 127, 128, 127, 128, 127, 127, // 3696-3703
+127, 128, 128, 127, 127, 127, 127, 127, // 3704-3711
+127, 127, 127, 128, 128, 128, 128, 128, // 3712-3719
+128, 128, 128, 128, 128, 128, 127, 127, // 3720-3727
+128, 127, 127, 127, 128, 127, 127, 127, // 3728-3735
+127, 127, 128, 127, 127, 127, 127, 127, // 3736-3743
+128, 128, 128, 127, 128, 128, 128, 128, // 3744-3751
+128, 127, 128, 128, 128, 127, 128, 128, // 3752-3759
+128, 127, 128, 127, 128, 127, 128, 128, // 3760-3767
+127, 128, 127, 127, 128, 127, 128, 127, // 3768-3775
+128, 127, 127, 127, 127, 127, 128, 127, // 3776-3783
+128, 127, 128, 128, 128, 128, 128, 127, // 3784-3791
+128, 127, 127, 127, 128, 128, 127, 127, // 3792-3799
+128, 127, 129, 127, 127, 127, 128, 128, // 3800-3807
+127, 125, 130, 128, 128, 127, 127, 127, // 3808-3815
+128, 126, 129, 127, 129, 123, 120, 138, // 3816-3823
+129, 130, 125, 129, 127, 127, 127, 130, // 3824-3831
+126, 130, 119, 125, 134, 129, 129, 126, // 3832-3839
+130, 129, 125, 127, 128, 128, 129, 123, // 3840-3847
+127, 129, 127, 128, 125, 129, 129, 126, // 3848-3855
+126, 128, 128, 127, 126, 128, 128, 129, // 3856-3863
+129, 127, 128, 129, 127, 126, 128, 126, // 3864-3871
+128, 125, 129, 127, 128, 128, 127, 127, // 3872-3879
+128, 128, 128, 127, 127, 128, 126, 129, // 3880-3887
+128, 127, 128, 127, 126, 127, 128, 127, // 3888-3895
+127, 127, 128, 126, 128, 128, 129, 127, // 3896-3903
+128, 126, 128, 127, 128, 127, 128, 129, // 3904-3911
+128, 127, 129, 128, 127, 127, 128, 129, // 3912-3919
+126, 127, 123, 129, 129, 129, 128, 130, // 3920-3927
+128, 127, 125, 128, 126, 128, 125, 127, // 3928-3935
+128, 129, 126, 127, 128, 129, 128, 126, // 3936-3943
+128, 127, 129, 126, 127, 129, 127, 128, // 3944-3951
+127, 128, 129, 126, 128, 127, 128, 126, // 3952-3959
+126, 127, 129, 126, 130, 126, 128, 127, // 3960-3967
+127, 128, 128, 126, 129, 125, 129, 126, // 3968-3975
+128, 127, 128, 127, 128, 127, 130, 127, // 3976-3983
+127, 129, 127, 128, 127, 128, 127, 128, // 3984-3991
+127, 128, 127, 128, 127, 127, 128, 127, // 3992-3999
+128, 127, 127, 128, 126, 128, 128, 128, // 4000-4007
+127, 127, 128, 127, 128, 128, 128, 127, // 4008-4015
+128, 126, 128, 127, 128, 127, 128, 129, // 4016-4023
+126, 128, 127, 128, 127, 127, 127, 128, // 4024-4031
+128, 128, 127, 128, 128, 126, 128, 127, // 4032-4039
+130, 128, 127, 129, 128, 129, 127, 128, // 4040-4047
+127, 128, 127, 128, 126, 129, 126, 127, // 4048-4055
+127, 128, 127, 127, 126, 128, 125, 128, // 4056-4063
+127, 128, 128, 127, 127, 128, 127, 129, // 4064-4071
+127, 128, 128, 127, 129, 128, 127, 129, // 4072-4079
+128, 128, 127, 128, 128, 127, 128, 127, // 4080-4087
+126, 128, 126, 127, 128, 127, 129, 126, // 4088-4095
+128, 127, 128, 127, 127, 127, 129, 127, // 4096-4103
+128, 127, 129, 127, 127, 128, 129, 127, // 4104-4111
+128, 128, 129, 127, 127, 128, 127, 128, // 4112-4119
+127, 127, 128, 127, 126, 127, 128, 128, // 4120-4127
+127, 127, 128, 127, 127, 128, 127, 127, // 4128-4135
+127, 128, 128, 127, 128, 127, 127, 128, // 4136-4143
+127, 128, 128, 127, 128, 128, 128, 128, // 4144-4151
+128, 128, 127, 128, 128, 128, 128, 128, // 4152-4159
+127, 127, 128, 127, 127, 126, 127, 127, // 4160-4167
+128, 129, 129, 129, 128, 128, 127, 126, // 4168-4175
+125, 125, 124, 127, 128, 131, 132, 132, // 4176-4183
+130, 128, 127, 126, 123, 122, 122, 125, // 4184-4191
+128, 130, 133, 135, 134, 130, 128, 130, // 4192-4199
+124, 116, 115, 121, 127, 128, 132, 138, // 4200-4207
+139, 134, 128, 130, 129, 120, 108, 113, // 4208-4215
+124, 128, 130, 136, 144, 141, 131, 130, // 4216-4223
+132, 125, 113, 105, 116, 125, 127, 133, // 4224-4231
+141, 145, 137, 130, 132, 128, 118, 110, // 4232-4239
+109, 120, 126, 131, 139, 142, 139, 134, // 4240-4247
+131, 128, 121, 115, 112, 117, 125, 130, // 4248-4255
+138, 141, 136, 133, 132, 125, 119, 114, // 4256-4263
+114, 119, 125, 131, 141, 142, 136, 132, // 4264-4271
+130, 123, 115, 111, 114, 123, 128, 134, // 4272-4279
+145, 147, 138, 132, 130, 121, 110, 105, // 4280-4287
+112, 124, 128, 136, 148, 150, 139, 133, // 4288-4295
+129, 120, 108, 101, 109, 122, 128, 136, // 4296-4303
+150, 152, 141, 134, 130, 120, 110, 103, // 4304-4311
+107, 121, 128, 137, 149, 151, 143, 136, // 4312-4319
+128, 118, 112, 105, 107, 120, 130, 138, // 4320-4327
+148, 148, 141, 134, 124, 115, 111, 107, // 4328-4335
+109, 121, 131, 141, 150, 147, 140, 132, // 4336-4343
+121, 112, 110, 106, 112, 125, 135, 144, // 4344-4351
+152, 149, 140, 130, 117, 109, 108, 105, // 4352-4359
+111, 127, 139, 147, 154, 151, 142, 130, // 4360-4367
+113, 106, 106, 102, 107, 124, 138, 148, // 4368-4375
+155, 152, 146, 133, 114, 105, 106, 103, // 4376-4383
+105, 122, 138, 147, 156, 154, 147, 137, // 4384-4391
+116, 106, 107, 103, 105, 118, 135, 147, // 4392-4399
+155, 155, 148, 138, 119, 104, 106, 104, // 4400-4407
+103, 115, 131, 145, 155, 156, 149, 140, // 4408-4415
+124, 104, 100, 107, 103, 110, 128, 143, // 4416-4423
+155, 159, 152, 146, 130, 107,  96, 103, // 4424-4431
+105, 105, 122, 142, 153, 163, 157, 150, // 4432-4439
+138, 114,  95,  96, 102, 104, 114, 136, // 4440-4447
+150, 161, 164, 154, 142, 123, 100,  94, // 4448-4455
+ 96,  98, 109, 127, 145, 156, 167, 164, // 4456-4463
+149, 132, 111,  91,  91,  97, 102, 117, // 4464-4471
+137, 152, 170, 170, 157, 144, 125,  99, // 4472-4479
+ 82,  90, 100, 107, 126, 146, 161, 176, // 4480-4487
+167, 153, 137, 113,  89,  80,  89, 101, // 4488-4495
+112, 134, 150, 165, 179, 167, 149, 129, // 4496-4503
+105,  84,  74,  88, 109, 118, 137, 156, // 4504-4511
+175, 181, 162, 146, 128, 101,  74,  73, // 4512-4519
+ 96, 110, 119, 143, 159, 178, 183, 163, // 4520-4527
+143, 119,  98,  75,  64,  87, 114, 128, // 4528-4535
+142, 155, 182, 190, 166, 138, 115, 102, // 4536-4543
+ 80,  58,  79, 109, 131, 146, 153, 177, // 4544-4551
+193, 175, 146, 118, 103,  88,  67,  76, // 4552-4559
+ 86, 110, 154, 156, 159, 186, 192, 174, // 4560-4567
+129,  96, 104,  84,  61,  71,  99, 136, // 4568-4575
+151, 149, 175, 189, 185, 158, 120, 104, // 4576-4583
+ 92,  71,  72,  79, 102, 137, 151, 160, // 4584-4591
+170, 183, 188, 159, 116,  98,  92,  78, // 4592-4599
+ 65,  82, 110, 135, 154, 158, 166, 183, // 4600-4607
+186, 163, 120,  95,  96,  82,  66,  79, // 4608-4615
+108, 137, 151, 151, 162, 178, 185, 169, // 4616-4623
+124,  99,  99,  86,  69,  74, 107, 142, // 4624-4631
+135, 136, 164, 175, 175, 171, 147, 120, // 4632-4639
+ 95,  86,  81,  76,  94, 121, 133, 146, // 4640-4647
+156, 160, 172, 179, 169, 132,  97,  94, // 4648-4655
+ 89,  72,  78, 106, 139, 147, 134, 147, // 4656-4663
+171, 178, 175, 154, 119, 100,  87,  79, // 4664-4671
+ 75,  89, 120, 140, 141, 147, 157, 168, // 4672-4679
+174, 170, 151, 111,  87,  87,  84,  80, // 4680-4687
+ 94, 122, 151, 149, 144, 149, 162, 173, // 4688-4695
+173, 144, 102,  88,  94,  90,  81,  94, // 4696-4703
+127, 154, 145, 135, 143, 164, 168, 164, // 4704-4711
+149, 114,  90,  95,  91,  91,  96, 117, // 4712-4719
+145, 154, 147, 137, 133, 154, 165, 162, // 4720-4727
+137,  95,  92, 109, 101,  95, 100, 128, // 4728-4735
+150, 142, 135, 137, 145, 151, 152, 162, // 4736-4743
+139,  98,  99, 106, 107, 101, 100, 125, // 4744-4751
+148, 142, 135, 117, 133, 158, 161, 163, // 4752-4759
+151, 109, 107, 106, 101,  96,  94, 112, // 4760-4767
+139, 131, 131, 132, 145, 159, 159, 164, // 4768-4775
+169, 124,  93,  94, 100,  97,  88,  96, // 4776-4783
+131, 150, 148, 137, 133, 153, 156, 148, // 4784-4791
+161, 162, 114,  88,  86, 102, 105,  94, // 4792-4799
+ 99, 132, 145, 145, 131, 143, 160, 157, // 4800-4807
+152, 162, 150, 112,  80,  86, 103, 103, // 4808-4815
+ 95, 107, 137, 159, 152, 141, 136, 137, // 4816-4823
+144, 146, 146, 160, 138,  93,  88, 101, // 4824-4831
+111, 107,  98, 115, 140, 148, 144, 130, // 4832-4839
+139, 149, 146, 149, 159, 161, 120,  79, // 4840-4847
+ 88, 107, 107, 101,  95, 125, 151, 153, // 4848-4855
+142, 134, 140, 145, 143, 143, 147, 161, // 4856-4863
+138,  80,  87, 104, 111, 105, 100, 116, // 4864-4871
+157, 157, 152, 123, 120, 128, 136, 136, // 4872-4879
+140, 137, 168, 158, 116,  91,  92, 105, // 4880-4887
+112, 101, 113, 135, 147, 149, 130, 123, // 4888-4895
+125, 131, 134, 136, 139, 157, 174, 158, // 4896-4903
+104,  82,  91, 107, 109, 103, 112, 141, // 4904-4911
+157, 157, 124, 111, 122, 130, 133, 130, // 4912-4919
+132, 156, 171, 178, 139,  78,  74,  96, // 4920-4927
+107, 108, 101, 124, 159, 166, 145, 115, // 4928-4935
+112, 130, 132, 131, 123, 131, 154, 168, // 4936-4943
+171, 156,  94,  73,  87, 106, 106, 104, // 4944-4951
+114, 147, 159, 163, 125, 111, 125, 132, // 4952-4959
+131, 128, 116, 133, 149, 161, 164, 161, // 4960-4967
+123,  75,  76,  99, 107, 111, 120, 133, // 4968-4975
+157, 166, 147, 114, 109, 114, 125, 131, // 4976-4983
+126, 122, 138, 149, 152, 160, 167, 145, // 4984-4991
+ 92,  74,  89, 111, 120, 118, 119, 142, // 4992-4999
+154, 149, 122, 116, 115, 119, 125, 131, // 5000-5007
+127, 132, 139, 141, 145, 154, 157, 158, // 5008-5015
+136,  84,  77,  98, 117, 116, 119, 122, // 5016-5023
+138, 152, 150, 111, 114, 119, 124, 131, // 5024-5031
+131, 122, 132, 139, 141, 136, 146, 153, // 5032-5039
+157, 164, 111,  69,  85, 108, 114, 119, // 5040-5047
+115, 123, 142, 164, 142, 109, 117, 117, // 5048-5055
+128, 131, 129, 118, 139, 133, 140, 127, // 5056-5063
+141, 140, 162, 162, 166, 111,  81,  77, // 5064-5071
+ 95, 105, 118, 124, 130, 140, 154, 153, // 5072-5079
+117, 104,  93, 113, 137, 147, 140, 140, // 5080-5087
+129, 134, 137, 134, 134, 138, 155, 158, // 5088-5095
+172, 129,  73,  66,  90, 102, 126, 136, // 5096-5103
+126, 132, 149, 151, 132, 126,  88,  96, // 5104-5111
+122, 147, 144, 153, 129, 121, 130, 134, // 5112-5119
+127, 129, 137, 146, 169, 169, 165, 101, // 5120-5127
+ 70,  69, 101, 108, 130, 127, 119, 126, // 5128-5135
+146, 142, 138, 134,  96, 109, 125, 139, // 5136-5143
+132, 150, 120, 130, 126, 139, 121, 145, // 5144-5151
+129, 145, 154, 168, 147, 164, 103,  70, // 5152-5159
+ 74, 104,  92, 129, 133, 118, 126, 153, // 5160-5167
+134, 140, 144, 116, 109, 113, 119, 130, // 5168-5175
+151, 134, 124, 118, 126, 126, 140, 137, // 5176-5183
+136, 137, 153, 154, 161, 160, 150,  89, // 5184-5191
+ 68,  73,  97,  94, 139, 129, 125, 135, // 5192-5199
+152, 130, 152, 136, 115, 115, 120, 113, // 5200-5207
+131, 143, 127, 128, 127, 119, 122, 138, // 5208-5215
+132, 131, 146, 138, 148, 156, 157, 140, // 5216-5223
+161, 110,  73,  71,  93,  79, 127, 143, // 5224-5231
+125, 137, 152, 132, 134, 150, 115, 124, // 5232-5239
+122, 122, 112, 138, 120, 130, 126, 134, // 5240-5247
+117, 133, 130, 135, 141, 150, 137, 143, // 5248-5255
+144, 143, 146, 155, 137,  90,  74,  85, // 5256-5263
+ 89,  99, 145, 135, 133, 146, 134, 118, // 5264-5271
+145, 126, 125, 131, 125, 116, 125, 123, // 5272-5279
+122, 128, 128, 130, 127, 137, 131, 138, // 5280-5287
+141, 143, 133, 139, 137, 142, 145, 144, // 5288-5295
+144, 109,  81,  84,  94,  88, 137, 139, // 5296-5303
+132, 142, 137, 115, 137, 135, 128, 137, // 5304-5311
+127, 121, 120, 127, 119, 128, 124, 132, // 5312-5319
+125, 141, 133, 136, 135, 135, 126, 135, // 5320-5327
+130, 136, 145, 150, 147, 150, 135,  90, // 5328-5335
+ 75,  92,  87, 103, 146, 128, 132, 148, // 5336-5343
+127, 122, 143, 126, 133, 138, 131, 122, // 5344-5351
+128, 121, 122, 121, 129, 121, 124, 134, // 5352-5359
+131, 133, 142, 132, 132, 133, 126, 132, // 5360-5367
+141, 145, 152, 147, 145, 131,  91,  79, // 5368-5375
+ 92,  86, 107, 141, 131, 143, 152, 131, // 5376-5383
+127, 136, 123, 129, 128, 129, 122, 127, // 5384-5391
+124, 125, 125, 133, 121, 127, 130, 125, // 5392-5399
+131, 135, 128, 132, 133, 131, 138, 140, // 5400-5407
+143, 142, 145, 139, 135, 124,  96,  83, // 5408-5415
+102,  97, 109, 139, 132, 136, 149, 130, // 5416-5423
+127, 137, 126, 131, 131, 126, 122, 123, // 5424-5431
+120, 122, 122, 134, 125, 122, 126, 121, // 5432-5439
+124, 140, 136, 141, 144, 136, 132, 131, // 5440-5447
+132, 138, 142, 145, 139, 131, 128,  99, // 5448-5455
+ 89, 107,  98, 104, 137, 127, 135, 148, // 5456-5463
+132, 127, 136, 124, 127, 128, 127, 122, // 5464-5471
+123, 124, 122, 121, 132, 128, 129, 130, // 5472-5479
+121, 120, 130, 132, 140, 146, 141, 134, // 5480-5487
+131, 129, 130, 135, 139, 141, 139, 138, // 5488-5495
+129, 103,  93, 102,  98, 108, 133, 129, // 5496-5503
+136, 145, 132, 126, 132, 122, 126, 129, // 5504-5511
+130, 127, 128, 126, 124, 123, 132, 129, // 5512-5519
+131, 132, 124, 123, 127, 127, 134, 136, // 5520-5527
+135, 134, 131, 129, 128, 133, 140, 139, // 5528-5535
+142, 140, 130, 127, 110,  94, 104, 102, // 5536-5543
+105, 130, 129, 132, 144, 134, 129, 132, // 5544-5551
+125, 127, 128, 129, 128, 126, 127, 126, // 5552-5559
+123, 132, 129, 130, 135, 126, 121, 123, // 5560-5567
+118, 125, 133, 137, 140, 139, 135, 130, // 5568-5575
+127, 131, 132, 135, 140, 135, 133, 131, // 5576-5583
+109, 102, 109, 102, 110, 130, 128, 136, // 5584-5591
+142, 132, 128, 131, 124, 125, 126, 128, // 5592-5599
+127, 127, 127, 124, 124, 130, 129, 132, // 5600-5607
+135, 130, 128, 124, 119, 120, 125, 130, // 5608-5615
+137, 140, 141, 135, 129, 126, 125, 130, // 5616-5623
+134, 135, 139, 138, 136, 120, 103, 106, // 5624-5631
+106, 107, 126, 129, 130, 141, 132, 126, // 5632-5639
+129, 123, 124, 128, 128, 131, 131, 130, // 5640-5647
+128, 124, 127, 127, 127, 131, 131, 129, // 5648-5655
+132, 127, 122, 123, 125, 127, 132, 134, // 5656-5663
+134, 133, 132, 128, 129, 131, 132, 136, // 5664-5671
+140, 137, 135, 123, 108, 108, 107, 106, // 5672-5679
+121, 125, 126, 135, 133, 128, 130, 127, // 5680-5687
+128, 130, 131, 131, 129, 129, 125, 122, // 5688-5695
+127, 128, 127, 132, 131, 131, 132, 127, // 5696-5703
+122, 123, 124, 126, 131, 134, 134, 134, // 5704-5711
+133, 128, 128, 131, 131, 134, 138, 135, // 5712-5719
+134, 127, 111, 107, 108, 104, 116, 125, // 5720-5727
+126, 137, 137, 130, 131, 128, 124, 126, // 5728-5735
+127, 130, 130, 131, 130, 126, 125, 126, // 5736-5743
+125, 130, 132, 131, 133, 132, 129, 126, // 5744-5751
+124, 123, 123, 126, 130, 132, 134, 132, // 5752-5759
+130, 130, 130, 131, 134, 135, 136, 137, // 5760-5767
+130, 116, 111, 108, 104, 114, 123, 125, // 5768-5775
+135, 136, 131, 132, 129, 126, 128, 129, // 5776-5783
+130, 130, 129, 127, 125, 125, 125, 124, // 5784-5791
+128, 130, 130, 133, 130, 128, 128, 125, // 5792-5799
+124, 126, 124, 127, 130, 131, 133, 133, // 5800-5807
+132, 132, 132, 133, 133, 134, 133, 132, // 5808-5815
+125, 116, 114, 112, 110, 118, 122, 126, // 5816-5823
+134, 134, 132, 133, 129, 127, 128, 125, // 5824-5831
+126, 126, 126, 126, 126, 126, 128, 128, // 5832-5839
+131, 131, 130, 130, 130, 129, 129, 127, // 5840-5847
+125, 124, 123, 125, 126, 130, 131, 132, // 5848-5855
+133, 132, 132, 133, 133, 134, 134, 133, // 5856-5863
+130, 121, 116, 113, 107, 113, 120, 121, // 5864-5871
+129, 135, 132, 134, 132, 129, 129, 128, // 5872-5879
+128, 128, 128, 128, 126, 126, 127, 126, // 5880-5887
+129, 130, 130, 131, 130, 130, 130, 129, // 5888-5895
+129, 127, 125, 124, 124, 126, 130, 130, // 5896-5903
+131, 131, 129, 130, 130, 130, 132, 132, // 5904-5911
+133, 130, 122, 118, 115, 110, 116, 120, // 5912-5919
+123, 131, 133, 132, 134, 131, 129, 129, // 5920-5927
+127, 127, 127, 127, 128, 127, 128, 128, // 5928-5935
+128, 130, 129, 129, 130, 128, 128, 129, // 5936-5943
+129, 129, 128, 127, 125, 125, 125, 124, // 5944-5951
+126, 129, 130, 131, 132, 131, 132, 132, // 5952-5959
+133, 132, 133, 128, 121, 119, 116, 113, // 5960-5967
+118, 121, 123, 131, 133, 132, 135, 132, // 5968-5975
+129, 129, 126, 125, 126, 126, 126, 126, // 5976-5983
+128, 129, 129, 131, 130, 129, 129, 128, // 5984-5991
+128, 129, 128, 128, 128, 127, 126, 125, // 5992-5999
+124, 124, 124, 127, 128, 129, 131, 131, // 6000-6007
+131, 132, 133, 134, 133, 133, 131, 124, // 6008-6015
+120, 117, 113, 116, 121, 122, 129, 132, // 6016-6023
+132, 134, 132, 130, 129, 128, 127, 127, // 6024-6031
+127, 127, 126, 127, 127, 126, 127, 128, // 6032-6039
+128, 130, 130, 129, 130, 129, 128, 128, // 6040-6047
+128, 128, 127, 127, 126, 124, 125, 125, // 6048-6055
+126, 128, 128, 129, 131, 131, 131, 132, // 6056-6063
+131, 132, 132, 132, 130, 124, 120, 118, // 6064-6071
+115, 117, 120, 121, 127, 131, 132, 134, // 6072-6079
+133, 131, 130, 128, 127, 126, 126, 127, // 6080-6087
+126, 127, 128, 127, 128, 129, 128, 128, // 6088-6095
+129, 129, 129, 129, 129, 128, 128, 128, // 6096-6103
+127, 127, 127, 125, 125, 125, 124, 126, // 6104-6111
+128, 128, 129, 130, 130, 130, 131, 131, // 6112-6119
+133, 134, 133, 132, 129, 123, 120, 117, // 6120-6127
+115, 118, 120, 123, 127, 129, 130, 132, // 6128-6135
+131, 131, 131, 129, 128, 127, 126, 125, // 6136-6143
+125, 126, 126, 127, 129, 129, 130, 130, // 6144-6151
+130, 130, 130, 129, 128, 128, 127, 127, // 6152-6159
+126, 126, 126, 125, 126, 127, 128, 129, // 6160-6167
+129, 129, 129, 129, 130, 131, 133, 134, // 6168-6175
+133, 132, 129, 124, 122, 118, 115, 118, // 6176-6183
+119, 122, 127, 129, 130, 132, 132, 131, // 6184-6191
+130, 129, 128, 127, 127, 127, 126, 127, // 6192-6199
+127, 127, 128, 128, 129, 130, 129, 129, // 6200-6207
+129, 128, 128, 127, 127, 127, 127, 127, // 6208-6215
+127, 128, 128, 128, 128, 128, 127, 128, // 6216-6223
+128, 129, 129, 131, 131, 131, 131, 128, // 6224-6231
+125, 123, 120, 120, 122, 122, 124, 127, // 6232-6239
+128, 130, 131, 130, 131, 130, 129, 128, // 6240-6247
+127, 127, 127, 127, 127, 127, 127, 127, // 6248-6255
+127, 128, 129, 128, 129, 129, 129, 129, // 6256-6263
+128, 127, 126, 126, 126, 127, 127, 128, // 6264-6271
+128, 129, 129, 128, 129, 129, 130, 130, // 6272-6279
+130, 130, 128, 125, 124, 121, 120, 122, // 6280-6287
+122, 124, 127, 129, 130, 131, 131, 130, // 6288-6295
+129, 128, 128, 127, 127, 127, 126, 127, // 6296-6303
+127, 127, 129, 129, 129, 129, 129, 128, // 6304-6311
+128, 128, 128, 128, 127, 127, 127, 127, // 6312-6319
+127, 127, 127, 127, 127, 128, 128, 129, // 6320-6327
+130, 131, 131, 130, 129, 126, 124, 122, // 6328-6335
+120, 121, 122, 124, 127, 128, 129, 131, // 6336-6343
+132, 131, 131, 130, 129, 128, 127, 126, // 6344-6351
+125, 126, 126, 126, 127, 128, 129, 130, // 6352-6359
+130, 129, 129, 128, 127, 127, 127, 127, // 6360-6367
+127, 127, 127, 127, 127, 127, 127, 128, // 6368-6375
+128, 128, 129, 130, 131, 131, 131, 130, // 6376-6383
+127, 125, 123, 120, 121, 121, 122, 125, // 6384-6391
+127, 128, 130, 130, 131, 131, 130, 129, // 6392-6399
+128, 127, 127, 126, 126, 126, 126, 127, // 6400-6407
+127, 127, 128, 129, 129, 129, 129, 129, // 6408-6415
+128, 128, 128, 128, 128, 128, 128, 128, // 6416-6423
+127, 127, 127, 127, 128, 129, 130, 130, // 6424-6431
+130, 130, 128, 126, 124, 122, 121, 122, // 6432-6439
+123, 125, 127, 128, 129, 130, 130, 131, // 6440-6447
+131, 130, 129, 128, 127, 127, 126, 126, // 6448-6455
+125, 126, 127, 127, 128, 129, 129, 129, // 6456-6463
+129, 128, 128, 127, 127, 127, 127, 128, // 6464-6471
+128, 128, 128, 128, 128, 128, 129, 130, // 6472-6479
+130, 130, 130, 128, 126, 124, 122, 122, // 6480-6487
+122, 123, 125, 126, 128, 130, 130, 130, // 6488-6495
+131, 130, 129, 128, 127, 127, 126, 126, // 6496-6503
+126, 126, 127, 127, 128, 129, 129, 129, // 6504-6511
+129, 129, 129, 128, 128, 127, 127, 127, // 6512-6519
+127, 127, 127, 126, 127, 127, 128, 128, // 6520-6527
+129, 129, 130, 130, 131, 131, 130, 129, // 6528-6535
+126, 125, 123, 122, 122, 122, 123, 125, // 6536-6543
+127, 128, 129, 130, 130, 130, 129, 129, // 6544-6551
+128, 128, 127, 127, 127, 127, 127, 127, // 6552-6559
+128, 128, 129, 129, 129, 129, 129, 128, // 6560-6567
+128, 127, 127, 127, 127, 128, 128, 128, // 6568-6575
+128, 128, 129, 129, 130, 130, 130, 129, // 6576-6583
+127, 126, 124, 122, 122, 122, 123, 124, // 6584-6591
+126, 127, 129, 130, 130, 130, 130, 129, // 6592-6599
+129, 128, 128, 127, 126, 126, 126, 127, // 6600-6607
+127, 128, 129, 129, 129, 129, 129, 129, // 6608-6615
+128, 128, 127, 127, 127, 127, 127, 128, // 6616-6623
+128, 128, 128, 129, 129, 130, 130, 130, // 6624-6631
+130, 128, 126, 124, 122, 121, 121, 122, // 6632-6639
+123, 125, 127, 128, 129, 130, 131, 131, // 6640-6647
+131, 130, 129, 129, 128, 127, 126, 126, // 6648-6655
+126, 127, 128, 128, 129, 129, 129, 129, // 6656-6663
+128, 128, 127, 127, 127, 127, 127, 127, // 6664-6671
+128, 128, 128, 129, 129, 130, 130, 130, // 6672-6679
+130, 128, 126, 124, 123, 122, 122, 122, // 6680-6687
+124, 125, 127, 128, 130, 130, 131, 131, // 6688-6695
+130, 130, 129, 128, 127, 126, 125, 125, // 6696-6703
+125, 126, 127, 128, 129, 129, 129, 129, // 6704-6711
+129, 128, 128, 128, 128, 128, 128, 128, // 6712-6719
+128, 128, 128, 128, 129, 129, 130, 130, // 6720-6727
+130, 128, 127, 125, 123, 122, 122, 123, // 6728-6735
+124, 125, 127, 128, 129, 130, 131, 131, // 6736-6743
+131, 131, 130, 129, 127, 126, 125, 125, // 6744-6751
+125, 125, 126, 127, 128, 129, 129, 129, // 6752-6759
+129, 128, 128, 127, 127, 127, 127, 127, // 6760-6767
+128, 128, 128, 129, 129, 130, 130, 130, // 6768-6775
+129, 127, 126, 124, 122, 122, 122, 123, // 6776-6783
+125, 126, 128, 129, 130, 131, 131, 131, // 6784-6791
+131, 130, 129, 128, 126, 126, 125, 125, // 6792-6799
+125, 126, 127, 128, 129, 129, 129, 128, // 6800-6807
+128, 128, 127, 128, 128, 128, 128, 129, // 6808-6815
+129, 129, 130, 130, 130, 129, 128, 126, // 6816-6823
+125, 123, 122, 122, 122, 123, 125, 126, // 6824-6831
+128, 129, 130, 131, 131, 131, 131, 130, // 6832-6839
+129, 127, 126, 125, 124, 124, 125, 126, // 6840-6847
+127, 129, 129, 130, 130, 129, 129, 128, // 6848-6855
+128, 128, 128, 128, 128, 128, 129, 129, // 6856-6863
+129, 130, 130, 129, 128, 126, 124, 122, // 6864-6871
+122, 122, 122, 124, 126, 127, 129, 130, // 6872-6879
+130, 131, 131, 131, 130, 129, 128, 127, // 6880-6887
+126, 125, 125, 125, 126, 127, 128, 128, // 6888-6895
+128, 129, 129, 129, 129, 129, 129, 129, // 6896-6903
+129, 129, 129, 129, 129, 129, 129, 129, // 6904-6911
+127, 126, 124, 123, 122, 122, 122, 123, // 6912-6919
+125, 126, 128, 129, 130, 131, 131, 131, // 6920-6927
+131, 130, 129, 127, 126, 125, 125, 125, // 6928-6935
+126, 126, 127, 128, 129, 129, 129, 129, // 6936-6943
+129, 129, 129, 129, 129, 129, 129, 129, // 6944-6951
+129, 130, 130, 129, 129, 127, 126, 124, // 6952-6959
+122, 121, 121, 122, 123, 125, 126, 128, // 6960-6967
+129, 130, 131, 131, 131, 131, 130, 128, // 6968-6975
+127, 126, 125, 125, 125, 126, 127, 128, // 6976-6983
+129, 129, 129, 129, 129, 129, 129, 129, // 6984-6991
+129, 129, 129, 129, 129, 130, 130, 130, // 6992-6999
+129, 128, 126, 124, 122, 121, 121, 121, // 7000-7007
+123, 124, 126, 128, 129, 130, 130, 131, // 7008-7015
+131, 131, 130, 129, 127, 126, 125, 124, // 7016-7023
+124, 125, 126, 128, 129, 129, 130, 130, // 7024-7031
+130, 130, 129, 129, 129, 129, 129, 129, // 7032-7039
+129, 129, 129, 129, 130, 129, 128, 126, // 7040-7047
+124, 122, 121, 121, 121, 122, 124, 125, // 7048-7055
+127, 129, 130, 131, 132, 132, 132, 131, // 7056-7063
+130, 128, 126, 125, 124, 124, 125, 126, // 7064-7071
+127, 128, 129, 129, 130, 130, 129, 129, // 7072-7079
+129, 129, 128, 129, 128, 129, 129, 130, // 7080-7087
+130, 131, 129, 127, 125, 123, 120, 120, // 7088-7095
+120, 121, 123, 125, 127, 129, 131, 132, // 7096-7103
+133, 133, 133, 132, 130, 128, 126, 124, // 7104-7111
+123, 123, 123, 125, 126, 128, 129, 130, // 7112-7119
+131, 130, 130, 129, 129, 129, 128, 128, // 7120-7127
+128, 128, 128, 129, 130, 130, 131, 129, // 7128-7135
+127, 125, 122, 120, 120, 119, 120, 123, // 7136-7143
+125, 127, 130, 131, 132, 133, 133, 133, // 7144-7151
+132, 131, 129, 127, 125, 124, 123, 124, // 7152-7159
+125, 127, 128, 129, 130, 130, 130, 130, // 7160-7167
+129, 129, 128, 128, 128, 128, 128, 129, // 7168-7175
+130, 130, 131, 130, 128, 126, 123, 120, // 7176-7183
+119, 119, 119, 122, 124, 126, 129, 131, // 7184-7191
+132, 134, 134, 133, 132, 130, 128, 126, // 7192-7199
+124, 123, 122, 123, 124, 126, 128, 130, // 7200-7207
+131, 131, 131, 130, 129, 129, 128, 128, // 7208-7215
+128, 128, 128, 129, 131, 132, 133, 133, // 7216-7223
+130, 128, 125, 121, 119, 119, 118, 119, // 7224-7231
+122, 124, 127, 131, 132, 134, 134, 134, // 7232-7239
+132, 131, 129, 126, 124, 123, 122, 122, // 7240-7247
+124, 125, 128, 129, 131, 131, 131, 130, // 7248-7255
+129, 128, 128, 127, 127, 128, 128, 129, // 7256-7263
+131, 132, 132, 133, 131, 129, 126, 123, // 7264-7271
+120, 119, 118, 118, 121, 123, 126, 130, // 7272-7279
+132, 133, 134, 134, 132, 131, 129, 127, // 7280-7287
+125, 124, 122, 122, 123, 125, 127, 129, // 7288-7295
+130, 131, 131, 131, 130, 129, 128, 128, // 7296-7303
+128, 128, 128, 129, 130, 131, 132, 132, // 7304-7311
+131, 128, 126, 123, 119, 118, 118, 117, // 7312-7319
+121, 124, 126, 130, 133, 134, 134, 134, // 7320-7327
+132, 131, 129, 127, 125, 124, 123, 123, // 7328-7335
+124, 125, 127, 129, 130, 131, 131, 130, // 7336-7343
+129, 129, 129, 128, 129, 129, 129, 130, // 7344-7351
+131, 131, 132, 132, 130, 127, 124, 121, // 7352-7359
+117, 117, 116, 117, 121, 125, 128, 132, // 7360-7367
+134, 134, 134, 133, 131, 130, 128, 126, // 7368-7375
+124, 124, 123, 123, 125, 127, 128, 130, // 7376-7383
+130, 130, 130, 129, 128, 128, 128, 128, // 7384-7391
+129, 130, 129, 131, 132, 131, 132, 132, // 7392-7399
+129, 126, 123, 118, 116, 116, 116, 118, // 7400-7407
+123, 127, 131, 135, 136, 136, 134, 132, // 7408-7415
+130, 128, 126, 124, 123, 123, 123, 125, // 7416-7423
+127, 128, 130, 131, 130, 130, 130, 128, // 7424-7431
+128, 128, 128, 128, 129, 129, 129, 130, // 7432-7439
+132, 132, 133, 134, 130, 126, 123, 117, // 7440-7447
+114, 115, 114, 117, 125, 129, 134, 138, // 7448-7455
+137, 135, 133, 129, 126, 125, 124, 123, // 7456-7463
+123, 124, 124, 126, 129, 130, 131, 131, // 7464-7471
+130, 130, 130, 129, 129, 129, 128, 128, // 7472-7479
+128, 129, 129, 130, 132, 133, 134, 135, // 7480-7487
+132, 126, 123, 117, 111, 112, 113, 115, // 7488-7495
+124, 131, 135, 140, 139, 135, 132, 128, // 7496-7503
+125, 124, 124, 123, 124, 125, 126, 127, // 7504-7511
+129, 130, 130, 131, 130, 129, 130, 129, // 7512-7519
+128, 128, 128, 127, 127, 129, 129, 130, // 7520-7527
+133, 134, 134, 135, 134, 127, 123, 117, // 7528-7535
+109, 110, 112, 115, 124, 134, 137, 141, // 7536-7543
+141, 135, 131, 127, 123, 123, 123, 124, // 7544-7551
+125, 127, 127, 128, 128, 128, 128, 129, // 7552-7559
+130, 130, 131, 131, 129, 128, 127, 126, // 7560-7567
+126, 128, 129, 131, 133, 134, 134, 134, // 7568-7575
+134, 128, 121, 117, 108, 106, 111, 115, // 7576-7583
+123, 136, 140, 141, 143, 134, 128, 126, // 7584-7591
+122, 122, 125, 125, 126, 128, 127, 126, // 7592-7599
+127, 127, 128, 130, 131, 132, 131, 131, // 7600-7607
+128, 127, 126, 127, 128, 130, 132, 132, // 7608-7615
+133, 135, 135, 134, 135, 130, 121, 117, // 7616-7623
+108, 102, 109, 116, 123, 137, 143, 139, // 7624-7631
+141, 134, 124, 125, 123, 122, 127, 128, // 7632-7639
+126, 127, 126, 123, 126, 127, 129, 133, // 7640-7647
+134, 133, 131, 128, 126, 125, 126, 127, // 7648-7655
+130, 131, 133, 132, 132, 133, 134, 135, // 7656-7663
+136, 133, 121, 114, 108, 100, 106, 117, // 7664-7671
+124, 136, 145, 140, 136, 135, 123, 123, // 7672-7679
+127, 125, 128, 131, 126, 124, 124, 122, // 7680-7687
+124, 129, 131, 134, 135, 131, 127, 125, // 7688-7695
+124, 125, 128, 131, 132, 132, 131, 131, // 7696-7703
+130, 133, 136, 137, 137, 135, 121, 110, // 7704-7711
+107,  99, 105, 120, 128, 136, 145, 140, // 7712-7719
+130, 133, 126, 123, 132, 129, 127, 129, // 7720-7727
+124, 119, 122, 124, 125, 133, 135, 133, // 7728-7735
+131, 126, 123, 124, 127, 130, 131, 132, // 7736-7743
+130, 128, 130, 131, 133, 138, 138, 136, // 7744-7751
+134, 131, 116, 108, 107, 100, 109, 123, // 7752-7759
+129, 135, 141, 136, 128, 135, 130, 127, // 7760-7767
+134, 128, 123, 124, 121, 119, 126, 131, // 7768-7775
+129, 134, 133, 127, 128, 126, 126, 130, // 7776-7783
+131, 130, 127, 128, 127, 129, 135, 136, // 7784-7791
+136, 138, 136, 132, 133, 128, 109, 108, // 7792-7799
+105, 101, 116, 129, 131, 136, 141, 129, // 7800-7807
+130, 138, 129, 130, 133, 123, 119, 123, // 7808-7815
+121, 123, 133, 130, 127, 131, 128, 127, // 7816-7823
+130, 130, 127, 129, 128, 124, 128, 130, // 7824-7831
+132, 135, 137, 134, 134, 136, 136, 134, // 7832-7839
+135, 117, 101, 104, 102, 107, 127, 135, // 7840-7847
+126, 137, 135, 127, 140, 141, 127, 127, // 7848-7855
+127, 113, 123, 128, 125, 128, 130, 122, // 7856-7863
+126, 134, 131, 134, 131, 125, 123, 128, // 7864-7871
+127, 130, 132, 132, 131, 135, 136, 134, // 7872-7879
+138, 138, 135, 135, 129, 105, 103, 107, // 7880-7887
+104, 114, 131, 124, 123, 140, 132, 135, // 7888-7895
+144, 133, 119, 128, 124, 119, 131, 126, // 7896-7903
+120, 126, 128, 124, 135, 134, 130, 131, // 7904-7911
+129, 126, 129, 130, 125, 128, 132, 135, // 7912-7919
+136, 138, 133, 133, 138, 140, 136, 133, // 7920-7927
+112,  98, 107, 109, 111, 120, 125, 115, // 7928-7935
+135, 143, 136, 140, 136, 121, 124, 135, // 7936-7943
+122, 125, 126, 119, 123, 132, 125, 126, // 7944-7951
+134, 128, 130, 132, 127, 123, 129, 127, // 7952-7959
+130, 136, 135, 133, 135, 136, 137, 141, // 7960-7967
+137, 134, 131, 113, 103, 113, 109, 104, // 7968-7975
+115, 124, 118, 138, 143, 131, 136, 138, // 7976-7983
+126, 128, 137, 120, 122, 128, 122, 123, // 7984-7991
+130, 122, 123, 136, 132, 129, 129, 128, // 7992-7999
+124, 128, 125, 127, 130, 133, 133, 134, // 8000-8007
+134, 134, 139, 137, 136, 136, 130, 106, // 8008-8015
+112, 117, 107, 104, 121, 123, 121, 144, // 8016-8023
+134, 129, 137, 137, 121, 133, 133, 119, // 8024-8031
+128, 129, 121, 124, 131, 120, 129, 134, // 8032-8039
+130, 127, 132, 129, 126, 128, 125, 129, // 8040-8047
+132, 134, 129, 136, 132, 136, 137, 137, // 8048-8055
+134, 136, 127, 105, 120, 115, 101, 102, // 8056-8063
+128, 121, 119, 139, 130, 129, 138, 136, // 8064-8071
+120, 138, 134, 121, 128, 131, 122, 124, // 8072-8079
+129, 120, 131, 135, 129, 126, 133, 128, // 8080-8087
+126, 128, 127, 130, 131, 131, 128, 138, // 8088-8095
+131, 132, 137, 137, 135, 138, 129, 106, // 8096-8103
+124, 115,  98, 108, 130, 116, 113, 142, // 8104-8111
+131, 125, 135, 138, 123, 137, 136, 121, // 8112-8119
+130, 132, 120, 121, 133, 121, 127, 134, // 8120-8127
+130, 127, 133, 127, 125, 131, 125, 127, // 8128-8135
+131, 131, 127, 135, 131, 128, 137, 137, // 8136-8143
+134, 136, 137, 113, 120, 128,  99, 109, // 8144-8151
+127, 118, 108, 139, 132, 119, 137, 138, // 8152-8159
+126, 128, 142, 123, 126, 133, 126, 119, // 8160-8167
+129, 126, 120, 133, 130, 127, 130, 134, // 8168-8175
+122, 130, 129, 125, 130, 133, 127, 130, // 8176-8183
+134, 130, 131, 137, 135, 134, 137, 134, // 8184-8191
+119, 122, 127,  97, 120, 121, 111, 116, // 8192-8199
+136, 123, 122, 141, 126, 130, 130, 139, // 8200-8207
+123, 130, 131, 125, 120, 129, 128, 120, // 8208-8215
+133, 130, 127, 129, 134, 121, 132, 129, // 8216-8223
+125, 130, 133, 125, 133, 132, 129, 134, // 8224-8231
+136, 135, 135, 138, 135, 127, 115, 134, // 8232-8239
+ 98, 117, 121, 106, 121, 129, 122, 122, // 8240-8247
+140, 121, 136, 129, 134, 129, 130, 129, // 8248-8255
+128, 124, 126, 129, 121, 131, 127, 129, // 8256-8263
+127, 132, 122, 131, 128, 127, 129, 131, // 8264-8271
+129, 130, 131, 130, 135, 131, 138, 133, // 8272-8279
+137, 134, 135, 113, 135, 109, 104, 131, // 8280-8287
+102, 120, 125, 123, 121, 138, 122, 133, // 8288-8295
+133, 128, 136, 128, 132, 130, 128, 123, // 8296-8303
+131, 122, 126, 130, 127, 125, 132, 127, // 8304-8311
+126, 131, 126, 127, 132, 129, 126, 137, // 8312-8319
+127, 133, 134, 134, 133, 138, 133, 136, // 8320-8327
+125, 119, 131,  94, 128, 110, 108, 129, // 8328-8335
+118, 124, 129, 132, 124, 138, 127, 135, // 8336-8343
+131, 132, 130, 129, 127, 123, 128, 123, // 8344-8351
+127, 128, 128, 128, 131, 125, 127, 128, // 8352-8359
+128, 127, 134, 129, 132, 135, 131, 133, // 8360-8367
+137, 133, 138, 135, 135, 127, 119, 132, // 8368-8375
+ 91, 129, 108, 106, 130, 113, 127, 126, // 8376-8383
+131, 124, 139, 127, 135, 134, 132, 130, // 8384-8391
+131, 126, 125, 130, 123, 129, 129, 129, // 8392-8399
+127, 130, 123, 128, 126, 128, 128, 132, // 8400-8407
+130, 131, 133, 131, 133, 134, 134, 136, // 8408-8415
+136, 133, 135, 115, 135, 101, 117, 120, // 8416-8423
+ 98, 130, 112, 126, 123, 132, 124, 134, // 8424-8431
+132, 128, 137, 131, 130, 130, 130, 122, // 8432-8439
+131, 125, 126, 129, 128, 127, 130, 127, // 8440-8447
+127, 129, 127, 130, 129, 130, 129, 132, // 8448-8455
+130, 131, 133, 133, 136, 136, 135, 137, // 8456-8463
+129, 119, 132,  97, 127, 110, 107, 128, // 8464-8471
+111, 128, 120, 133, 120, 138, 129, 130, // 8472-8479
+137, 130, 130, 132, 129, 125, 132, 124, // 8480-8487
+128, 129, 128, 126, 130, 125, 127, 128, // 8488-8495
+127, 131, 128, 131, 130, 133, 130, 135, // 8496-8503
+132, 137, 135, 136, 133, 137, 114, 135, // 8504-8511
+104, 114, 124,  95, 132, 108, 128, 119, // 8512-8519
+134, 122, 132, 136, 125, 139, 130, 131, // 8520-8527
+131, 131, 123, 131, 126, 125, 129, 127, // 8528-8535
+126, 128, 126, 125, 128, 127, 129, 130, // 8536-8543
+131, 130, 135, 130, 135, 134, 135, 135, // 8544-8551
+137, 132, 136, 118, 132, 108, 111, 125, // 8552-8559
+ 94, 133, 108, 126, 120, 132, 122, 131, // 8560-8567
+137, 123, 141, 130, 131, 131, 132, 124, // 8568-8575
+130, 127, 126, 129, 128, 128, 129, 126, // 8576-8583
+128, 126, 128, 129, 128, 132, 128, 133, // 8584-8591
+130, 133, 133, 134, 136, 136, 133, 137, // 8592-8599
+120, 130, 116, 104, 130,  94, 129, 113, // 8600-8607
+121, 121, 129, 125, 125, 141, 120, 140, // 8608-8615
+131, 131, 132, 133, 125, 129, 127, 124, // 8616-8623
+129, 127, 127, 128, 126, 126, 127, 126, // 8624-8631
+129, 128, 131, 131, 132, 132, 134, 134, // 8632-8639
+136, 137, 136, 136, 136, 126, 123, 126, // 8640-8647
+ 97, 132,  98, 118, 122, 112, 126, 123, // 8648-8655
+130, 118, 144, 120, 136, 135, 130, 132, // 8656-8663
+133, 127, 126, 131, 123, 129, 129, 126, // 8664-8671
+129, 127, 125, 127, 126, 127, 129, 129, // 8672-8679
+130, 133, 131, 132, 136, 132, 138, 135, // 8680-8687
+136, 134, 134, 117, 132,  98, 124, 110, // 8688-8695
+103, 131, 106, 129, 118, 135, 117, 141, // 8696-8703
+128, 130, 140, 129, 133, 132, 129, 125, // 8704-8711
+132, 124, 128, 131, 126, 130, 128, 125, // 8712-8719
+126, 126, 126, 129, 129, 129, 133, 132, // 8720-8727
+131, 136, 131, 137, 135, 137, 133, 136, // 8728-8735
+116, 132, 103, 116, 118,  98, 132, 106, // 8736-8743
+129, 118, 134, 119, 137, 132, 127, 141, // 8744-8751
+129, 133, 132, 131, 124, 132, 124, 127, // 8752-8759
+129, 127, 127, 129, 123, 127, 125, 125, // 8760-8767
+130, 128, 131, 133, 133, 132, 136, 132, // 8768-8775
+137, 136, 136, 133, 137, 117, 131, 110, // 8776-8783
+109, 127,  95, 131, 111, 124, 121, 132, // 8784-8791
+121, 131, 136, 123, 141, 131, 131, 132, // 8792-8799
+130, 123, 131, 126, 125, 130, 127, 126, // 8800-8807
+129, 122, 127, 125, 126, 129, 129, 131, // 8808-8815
+131, 134, 130, 135, 133, 136, 137, 137, // 8816-8823
+136, 136, 126, 122, 127,  95, 134,  96, // 8824-8831
+120, 121, 112, 128, 122, 129, 122, 142, // 8832-8839
+122, 138, 134, 130, 133, 132, 125, 129, // 8840-8847
+128, 125, 130, 128, 127, 128, 125, 125, // 8848-8855
+127, 124, 130, 130, 131, 132, 134, 131, // 8856-8863
+135, 133, 134, 137, 136, 132, 137, 122, // 8864-8871
+121, 126,  94, 133,  96, 120, 120, 116, // 8872-8879
+125, 126, 128, 123, 142, 122, 138, 133, // 8880-8887
+131, 131, 134, 124, 130, 128, 125, 130, // 8888-8895
+127, 127, 129, 126, 124, 128, 125, 127, // 8896-8903
+133, 129, 133, 135, 130, 136, 134, 133, // 8904-8911
+138, 136, 135, 135, 131, 114, 135,  94, // 8912-8919
+126, 110, 104, 131, 106, 128, 121, 131, // 8920-8927
+119, 140, 125, 133, 137, 129, 131, 133, // 8928-8935
+126, 128, 130, 124, 130, 129, 127, 128, // 8936-8943
+129, 122, 129, 126, 126, 133, 128, 132, // 8944-8951
+134, 131, 133, 136, 130, 140, 135, 136, // 8952-8959
+136, 133, 116, 132, 104, 113, 124,  94, // 8960-8967
+135, 108, 124, 124, 128, 122, 135, 131, // 8968-8975
+128, 140, 129, 132, 133, 128, 126, 132, // 8976-8983
+123, 129, 129, 126, 127, 128, 121, 128, // 8984-8991
+126, 125, 132, 128, 132, 134, 132, 133, // 8992-8999
+137, 131, 140, 136, 136, 134, 135, 113, // 9000-9007
+135, 101, 112, 125,  91, 136, 108, 124, // 9008-9015
+124, 129, 121, 137, 131, 129, 140, 130, // 9016-9023
+132, 133, 128, 126, 132, 123, 130, 128, // 9024-9031
+127, 127, 128, 123, 127, 126, 124, 132, // 9032-9039
+129, 130, 135, 131, 133, 137, 130, 140, // 9040-9047
+134, 138, 133, 137, 114, 131, 111, 103, // 9048-9055
+132,  89, 133, 112, 120, 126, 128, 122, // 9056-9063
+134, 132, 126, 140, 129, 132, 131, 129, // 9064-9071
+124, 132, 123, 130, 128, 127, 127, 129, // 9072-9079
+122, 128, 126, 125, 131, 129, 131, 134, // 9080-9087
+133, 133, 138, 131, 140, 136, 138, 133, // 9088-9095
+138, 114, 129, 112, 101, 133,  90, 131, // 9096-9103
+114, 118, 128, 127, 124, 132, 134, 125, // 9104-9111
+140, 129, 132, 132, 129, 124, 133, 122, // 9112-9119
+129, 128, 126, 129, 128, 124, 126, 127, // 9120-9127
+123, 130, 129, 130, 133, 133, 131, 139, // 9128-9135
+130, 140, 136, 136, 136, 136, 119, 127, // 9136-9143
+117,  98, 135,  90, 128, 118, 114, 129, // 9144-9151
+126, 123, 132, 133, 124, 141, 129, 132, // 9152-9159
+132, 130, 124, 133, 122, 129, 128, 126, // 9160-9167
+129, 128, 124, 126, 127, 123, 130, 129, // 9168-9175
+130, 134, 134, 131, 139, 130, 139, 136, // 9176-9183
+136, 135, 136, 120, 124, 121,  94, 136, // 9184-9191
+ 93, 124, 122, 112, 130, 126, 124, 130, // 9192-9199
+135, 123, 140, 128, 132, 131, 130, 124, // 9200-9207
+133, 123, 129, 130, 126, 129, 131, 123, // 9208-9215
+130, 126, 125, 132, 125, 134, 129, 133, // 9216-9223
+132, 135, 131, 139, 135, 137, 134, 136, // 9224-9231
+123, 118, 128,  90, 135,  99, 115, 130, // 9232-9239
+107, 131, 125, 124, 128, 136, 122, 141, // 9240-9247
+128, 132, 133, 130, 125, 132, 124, 127, // 9248-9255
+131, 125, 129, 129, 124, 127, 128, 124, // 9256-9263
+133, 127, 133, 131, 133, 131, 136, 130, // 9264-9271
+137, 137, 133, 135, 135, 118, 124, 121, // 9272-9279
+ 95, 134,  99, 119, 127, 113, 129, 127, // 9280-9287
+124, 131, 134, 125, 139, 129, 131, 131, // 9288-9295
+129, 124, 133, 124, 128, 131, 125, 129, // 9296-9303
+129, 124, 128, 126, 126, 130, 127, 133, // 9304-9311
+129, 132, 132, 134, 132, 136, 136, 135, // 9312-9319
+136, 131, 129, 113, 131,  96, 123, 115, // 9320-9327
+105, 134, 112, 127, 128, 126, 126, 137, // 9328-9335
+123, 138, 129, 130, 132, 127, 126, 130, // 9336-9343
+126, 126, 132, 126, 129, 128, 128, 124, // 9344-9351
+129, 127, 128, 129, 132, 128, 133, 132, // 9352-9359
+132, 135, 132, 138, 133, 136, 129, 135, // 9360-9367
+107, 133, 105, 106, 133,  95, 132, 120, // 9368-9375
+121, 129, 131, 122, 138, 127, 132, 136, // 9376-9383
+126, 134, 129, 125, 128, 131, 121, 133, // 9384-9391
+128, 126, 129, 130, 123, 130, 126, 129, // 9392-9399
+128, 129, 133, 127, 134, 132, 133, 133, // 9400-9407
+138, 132, 138, 128, 137, 118, 116, 131, // 9408-9415
+ 89, 132, 109, 110, 131, 118, 126, 131, // 9416-9423
+127, 129, 136, 123, 140, 126, 130, 132, // 9424-9431
+126, 124, 133, 124, 126, 132, 126, 127, // 9432-9439
+131, 128, 124, 132, 125, 130, 128, 131, // 9440-9447
+132, 129, 135, 133, 131, 137, 134, 134, // 9448-9455
+136, 128, 137, 107, 128, 116,  95, 136, // 9456-9463
+101, 120, 128, 120, 127, 132, 124, 134, // 9464-9471
+129, 127, 139, 121, 133, 130, 123, 127, // 9472-9479
+133, 122, 130, 132, 126, 129, 131, 127, // 9480-9487
+126, 131, 128, 128, 132, 129, 130, 133, // 9488-9495
+130, 133, 133, 132, 138, 131, 136, 130, // 9496-9503
+130, 107, 130, 110,  97, 139, 100, 122, // 9504-9511
+130, 122, 125, 134, 125, 135, 128, 131, // 9512-9519
+140, 120, 135, 132, 121, 128, 135, 119, // 9520-9527
+131, 132, 125, 128, 130, 126, 125, 129, // 9528-9535
+129, 128, 128, 135, 127, 134, 133, 132, // 9536-9543
+131, 137, 133, 135, 130, 135, 118, 106, // 9544-9551
+140,  87, 120, 129, 104, 127, 132, 123, // 9552-9559
+128, 132, 130, 134, 122, 141, 128, 122, // 9560-9567
+136, 129, 118, 135, 130, 121, 132, 130, // 9568-9575
+126, 126, 132, 125, 127, 128, 132, 127, // 9576-9583
+128, 136, 128, 131, 135, 131, 131, 138, // 9584-9591
+132, 136, 126, 139, 111, 110, 138,  84, // 9592-9599
+125, 126, 107, 128, 132, 125, 128, 130, // 9600-9607
+134, 131, 121, 143, 127, 120, 138, 128, // 9608-9615
+119, 134, 129, 123, 130, 130, 129, 125, // 9616-9623
+130, 129, 126, 127, 134, 127, 126, 134, // 9624-9631
+132, 128, 133, 137, 131, 136, 136, 135, // 9632-9639
+126, 134,  97, 133, 111,  90, 142, 110, // 9640-9647
+116, 133, 132, 124, 131, 131, 138, 121, // 9648-9655
+131, 143, 117, 128, 138, 120, 123, 135, // 9656-9663
+124, 126, 129, 131, 127, 124, 130, 130, // 9664-9671
+121, 131, 137, 121, 132, 136, 130, 128, // 9672-9679
+138, 135, 134, 132, 140, 127, 130, 109, // 9680-9687
+114, 130,  83, 129, 127, 110, 126, 138, // 9688-9695
+129, 125, 132, 138, 127, 119, 144, 125, // 9696-9703
+118, 135, 129, 119, 130, 130, 126, 127, // 9704-9711
+128, 134, 123, 127, 134, 128, 125, 134, // 9712-9719
+132, 127, 130, 137, 131, 129, 137, 138, // 9720-9727
+131, 134, 134, 131, 118,  96, 145,  93, // 9728-9735
+ 98, 144, 114, 114, 133, 141, 123, 124, // 9736-9743
+136, 141, 111, 134, 143, 115, 126, 137, // 9744-9751
+125, 123, 129, 130, 131, 119, 133, 135, // 9752-9759
+119, 128, 136, 126, 125, 130, 136, 127, // 9760-9767
+126, 143, 131, 126, 142, 139, 129, 132, // 9768-9775
+134, 125,  85, 139, 115,  82, 139, 128, // 9776-9783
+115, 123, 145, 133, 119, 127, 147, 119, // 9784-9791
+119, 144, 126, 121, 128, 132, 128, 122, // 9792-9799
+127, 138, 121, 124, 137, 126, 122, 131, // 9800-9807
+130, 129, 128, 132, 136, 130, 132, 136, // 9808-9815
+133, 140, 132, 134, 135, 129, 104, 103, // 9816-9823
+141,  85, 108, 140, 120, 118, 130, 147, // 9824-9831
+127, 117, 138, 141, 112, 131, 137, 123, // 9832-9839
+124, 125, 133, 130, 117, 132, 138, 117, // 9840-9847
+127, 134, 125, 125, 130, 132, 131, 124, // 9848-9855
+134, 137, 128, 131, 137, 135, 137, 130, // 9856-9863
+139, 133, 126,  91, 124, 131,  76, 130, // 9864-9871
+134, 121, 117, 137, 145, 121, 118, 144, // 9872-9879
+132, 113, 133, 131, 127, 123, 124, 138, // 9880-9887
+129, 116, 134, 136, 119, 126, 132, 129, // 9888-9895
+124, 128, 132, 131, 123, 132, 135, 131, // 9896-9903
+128, 136, 140, 136, 129, 141, 132, 125, // 9904-9911
+ 92, 122, 134,  80, 124, 137, 125, 117, // 9912-9919
+132, 146, 127, 115, 138, 137, 118, 126, // 9920-9927
+129, 132, 126, 119, 136, 136, 116, 127, // 9928-9935
+139, 125, 121, 130, 132, 128, 124, 130, // 9936-9943
+134, 126, 128, 132, 135, 129, 129, 141, // 9944-9951
+138, 129, 135, 133, 123,  87, 131, 125, // 9952-9959
+ 87, 127, 133, 129, 118, 132, 143, 128, // 9960-9967
+118, 135, 133, 126, 124, 123, 137, 128, // 9968-9975
+117, 135, 137, 119, 128, 133, 130, 125, // 9976-9983
+125, 131, 134, 123, 125, 138, 131, 126, // 9984-9991
+130, 138, 133, 127, 139, 137, 131, 128, // 9992-9999
+131, 100, 108, 134,  94, 115, 132, 128, // 10000-10007
+125, 125, 139, 133, 123, 129, 131, 127, // 10008-10015
+131, 120, 127, 138, 121, 124, 136, 128, // 10016-10023
+127, 130, 128, 131, 126, 126, 132, 131, // 10024-10031
+123, 131, 133, 130, 130, 130, 137, 133, // 10032-10039
+135, 134, 134, 132, 130,  98, 110, 136, // 10040-10047
+ 98, 112, 131, 132, 125, 123, 135, 135, // 10048-10055
+127, 127, 127, 129, 134, 118, 123, 137, // 10056-10063
+126, 123, 130, 127, 130, 131, 123, 129, // 10064-10071
+131, 126, 128, 130, 129, 130, 130, 131, // 10072-10079
+132, 131, 132, 134, 136, 134, 130, 130, // 10080-10087
+133, 105, 109, 132, 110, 113, 127, 129, // 10088-10095
+126, 127, 129, 128, 130, 130, 126, 126, // 10096-10103
+135, 126, 122, 131, 129, 126, 129, 126, // 10104-10111
+127, 131, 129, 125, 128, 131, 130, 127, // 10112-10119
+129, 131, 130, 129, 130, 130, 130, 132, // 10120-10127
+132, 131, 134, 130, 129, 119, 118, 127, // 10128-10135
+118, 119, 127, 123, 122, 128, 123, 121, // 10136-10143
+130, 127, 126, 130, 129, 127, 128, 129, // 10144-10151
+128, 127, 130, 129, 127, 130, 128, 127, // 10152-10159
+128, 129, 128, 129, 127, 130, 130, 127, // 10160-10167
+130, 131, 131, 134, 134, 132, 133, 132, // 10168-10175
+122, 121, 126, 117, 118, 125, 121, 120, // 10176-10183
+125, 122, 123, 128, 127, 128, 130, 131, // 10184-10191
+129, 129, 129, 129, 128, 129, 128, 128, // 10192-10199
+131, 128, 125, 129, 129, 127, 128, 129, // 10200-10207
+130, 129, 130, 132, 131, 135, 135, 133, // 10208-10215
+132, 133, 125, 120, 126, 119, 114, 124, // 10216-10223
+120, 117, 127, 125, 120, 129, 131, 127, // 10224-10231
+130, 131, 129, 128, 130, 127, 126, 129, // 10232-10239
+129, 125, 128, 129, 125, 128, 129, 127, // 10240-10247
+127, 131, 130, 128, 131, 133, 131, 134, // 10248-10255
+136, 134, 133, 134, 126, 119, 126, 119, // 10256-10263
+114, 123, 120, 117, 125, 124, 121, 129, // 10264-10271
+130, 128, 130, 132, 129, 127, 129, 128, // 10272-10279
+126, 128, 129, 126, 128, 129, 125, 128, // 10280-10287
+130, 126, 129, 131, 129, 129, 132, 132, // 10288-10295
+132, 135, 135, 133, 133, 132, 122, 122, // 10296-10303
+126, 117, 118, 124, 119, 119, 126, 122, // 10304-10311
+124, 130, 130, 129, 131, 132, 128, 128, // 10312-10319
+129, 127, 126, 129, 127, 125, 127, 126, // 10320-10327
+125, 128, 127, 127, 131, 130, 130, 132, // 10328-10335
+133, 134, 136, 135, 134, 133, 127, 122, // 10336-10343
+125, 119, 117, 123, 120, 118, 123, 123, // 10344-10351
+122, 128, 130, 130, 132, 132, 131, 130, // 10352-10359
+129, 129, 127, 129, 128, 126, 127, 126, // 10360-10367
+124, 125, 128, 127, 128, 130, 131, 132, // 10368-10375
+133, 135, 135, 135, 134, 126, 124, 127, // 10376-10383
+119, 119, 124, 119, 119, 124, 120, 122, // 10384-10391
+128, 127, 129, 131, 131, 130, 130, 131, // 10392-10399
+128, 127, 129, 128, 126, 129, 126, 124, // 10400-10407
+128, 126, 126, 130, 131, 131, 134, 135, // 10408-10415
+135, 134, 133, 127, 124, 126, 120, 118, // 10416-10423
+124, 122, 119, 124, 122, 120, 128, 128, // 10424-10431
+128, 131, 131, 129, 130, 129, 129, 128, // 10432-10439
+129, 129, 127, 127, 128, 125, 125, 128, // 10440-10447
+127, 129, 133, 134, 135, 137, 135, 132, // 10448-10455
+126, 126, 126, 119, 121, 123, 119, 121, // 10456-10463
+124, 120, 123, 128, 127, 129, 131, 130, // 10464-10471
+130, 130, 129, 129, 128, 129, 128, 127, // 10472-10479
+129, 127, 126, 127, 126, 128, 130, 131, // 10480-10487
+134, 136, 135, 136, 131, 124, 128, 124, // 10488-10495
+117, 123, 122, 117, 122, 122, 119, 125, // 10496-10503
+128, 127, 130, 130, 130, 129, 129, 130, // 10504-10511
+128, 128, 130, 128, 128, 130, 127, 126, // 10512-10519
+129, 129, 129, 132, 135, 135, 135, 135, // 10520-10527
+130, 123, 127, 124, 118, 123, 123, 118, // 10528-10535
+121, 122, 118, 124, 127, 126, 129, 131, // 10536-10543
+129, 128, 129, 129, 128, 129, 130, 128, // 10544-10551
+130, 131, 127, 128, 131, 128, 132, 136, // 10552-10559
+133, 134, 135, 126, 125, 127, 121, 123, // 10560-10567
+127, 122, 121, 123, 121, 121, 125, 127, // 10568-10575
+128, 130, 131, 129, 127, 129, 128, 126, // 10576-10583
+129, 130, 128, 129, 129, 128, 128, 129, // 10584-10591
+132, 133, 133, 135, 130, 123, 127, 125, // 10592-10599
+119, 126, 127, 121, 125, 125, 120, 124, // 10600-10607
+128, 126, 128, 131, 130, 128, 129, 130, // 10608-10615
+127, 128, 130, 128, 130, 131, 127, 129, // 10616-10623
+130, 129, 133, 135, 134, 134, 128, 123, // 10624-10631
+125, 121, 119, 126, 123, 121, 124, 122, // 10632-10639
+121, 125, 126, 127, 130, 131, 129, 129, // 10640-10647
+129, 128, 127, 129, 130, 129, 130, 129, // 10648-10655
+128, 129, 130, 132, 135, 135, 133, 127, // 10656-10663
+124, 124, 121, 121, 125, 123, 122, 124, // 10664-10671
+122, 121, 127, 127, 127, 131, 130, 128, // 10672-10679
+129, 129, 127, 128, 130, 130, 129, 130, // 10680-10687
+129, 127, 131, 133, 133, 136, 135, 129, // 10688-10695
+126, 125, 121, 120, 123, 123, 122, 123, // 10696-10703
+122, 120, 124, 127, 127, 129, 131, 129, // 10704-10711
+128, 129, 128, 129, 131, 129, 130, 132, // 10712-10719
+130, 129, 133, 132, 133, 134, 130, 126, // 10720-10727
+126, 122, 121, 123, 123, 122, 124, 123, // 10728-10735
+123, 125, 126, 127, 128, 130, 129, 127, // 10736-10743
+128, 129, 127, 127, 129, 130, 130, 132, // 10744-10751
+135, 134, 135, 135, 131, 127, 127, 124, // 10752-10759
+120, 124, 124, 120, 123, 124, 122, 124, // 10760-10767
+126, 125, 126, 130, 129, 126, 128, 129, // 10768-10775
+125, 127, 131, 128, 130, 136, 135, 134, // 10776-10783
+137, 133, 127, 128, 127, 121, 123, 126, // 10784-10791
+122, 121, 124, 122, 121, 127, 128, 126, // 10792-10799
+130, 130, 126, 127, 129, 125, 124, 130, // 10800-10807
+130, 130, 136, 136, 134, 136, 132, 126, // 10808-10815
+126, 126, 122, 123, 124, 122, 122, 123, // 10816-10823
+123, 123, 126, 129, 128, 128, 130, 127, // 10824-10831
+125, 128, 127, 128, 131, 133, 134, 137, // 10832-10839
+136, 132, 129, 127, 125, 123, 123, 124, // 10840-10847
+123, 123, 124, 123, 123, 126, 127, 128, // 10848-10855
+128, 128, 127, 124, 126, 128, 127, 131, // 10856-10863
+135, 134, 137, 138, 132, 128, 128, 125, // 10864-10871
+124, 125, 124, 122, 122, 123, 122, 123, // 10872-10879
+127, 128, 127, 129, 129, 124, 126, 129, // 10880-10887
+126, 129, 136, 134, 136, 138, 133, 129, // 10888-10895
+128, 125, 123, 124, 123, 121, 121, 121, // 10896-10903
+121, 123, 126, 126, 128, 128, 125, 127, // 10904-10911
+128, 126, 131, 135, 133, 137, 138, 132, // 10912-10919
+131, 130, 124, 123, 125, 124, 123, 123, // 10920-10927
+124, 122, 122, 125, 124, 125, 129, 129, // 10928-10935
+127, 131, 132, 131, 134, 135, 134, 131, // 10936-10943
+130, 128, 124, 123, 123, 122, 122, 125, // 10944-10951
+124, 123, 126, 126, 126, 127, 128, 130, // 10952-10959
+130, 131, 133, 132, 133, 135, 132, 130, // 10960-10967
+130, 125, 122, 123, 122, 121, 123, 123, // 10968-10975
+123, 124, 126, 127, 129, 132, 133, 132, // 10976-10983
+134, 134, 132, 133, 132, 129, 127, 126, // 10984-10991
+123, 122, 121, 119, 121, 122, 121, 123, // 10992-10999
+126, 127, 129, 132, 132, 133, 136, 135, // 11000-11007
+135, 135, 132, 128, 127, 127, 127, 127, // 11008-11015
+127, 127, 127, 127, 127, 128, 128, 128, // 11016-11023
+128, 128, 128, 128, 128, 127, 127, 128, // 11024-11031
+127, 127, 128, 128, 127, 127, 127, 127, // 11032-11039
+127, 127, 126, 127, 128};// 11040-11044
+
+#define WIN_N 5936
+const uint8_t Win[WIN_N] = {
+128, 128, 128, 128, 128, 128, 128, 128, // 0-7
+128, 129, 129, 129, 128, 128, 128, 128, // 8-15
+128, 127, 127, 127, 127, 127, 126, 126, // 16-23
+126, 126, 126, 126, 127, 127, 126, 126, // 24-31
+127, 127, 128, 128, 129, 129, 129, 129, // 32-39
+128, 128, 128, 128, 129, 129, 130, 129, // 40-47
+129, 129, 128, 128, 128, 128, 128, 128, // 48-55
+128, 127, 125, 124, 122, 121, 121, 122, // 56-63
+123, 125, 127, 128, 129, 130, 130, 130, // 64-71
+130, 130, 131, 131, 130, 131, 131, 131, // 72-79
+130, 129, 128, 128, 128, 129, 129, 130, // 80-87
+129, 128, 127, 124, 121, 119, 117, 118, // 88-95
+119, 122, 125, 127, 130, 130, 130, 129, // 96-103
+129, 129, 130, 131, 132, 132, 132, 131, // 104-111
+131, 132, 131, 132, 131, 130, 130, 130, // 112-119
+130, 130, 128, 126, 121, 117, 114, 112, // 120-127
+114, 117, 121, 127, 130, 131, 131, 130, // 128-135
+129, 129, 130, 131, 132, 133, 132, 132, // 136-143
+133, 133, 134, 133, 133, 132, 131, 132, // 144-151
+132, 132, 130, 125, 119, 113, 108, 107, // 152-159
+109, 115, 122, 128, 132, 132, 130, 129, // 160-167
+128, 129, 130, 132, 134, 134, 135, 135, // 168-175
+135, 136, 137, 137, 135, 134, 133, 134, // 176-183
+134, 131, 123, 115, 107, 100,  99, 104, // 184-191
+113, 124, 132, 134, 133, 130, 128, 128, // 192-199
+131, 134, 137, 138, 137, 134, 132, 133, // 200-207
+135, 138, 141, 142, 142, 140, 135, 128, // 208-215
+119, 108, 100,  95,  98, 106, 117, 126, // 216-223
+131, 131, 128, 125, 126, 130, 134, 139, // 224-231
+139, 137, 133, 129, 130, 134, 142, 146, // 232-239
+149, 146, 141, 138, 132, 123, 112, 101, // 240-247
+ 93,  92, 101, 112, 122, 130, 130, 127, // 248-255
+126, 127, 131, 138, 142, 140, 135, 129, // 256-263
+125, 130, 140, 148, 153, 151, 144, 140, // 264-271
+137, 128, 116, 102,  90,  86,  93, 106, // 272-279
+118, 128, 130, 127, 127, 131, 137, 143, // 280-287
+143, 137, 130, 126, 128, 137, 146, 152, // 288-295
+151, 147, 144, 146, 142, 126, 105,  87, // 296-303
+ 79,  85, 100, 113, 119, 122, 121, 124, // 304-311
+136, 147, 149, 145, 135, 125, 125, 135, // 312-319
+143, 147, 149, 145, 144, 151, 157, 145, // 320-327
+118,  91,  77,  81,  96, 107, 106, 103, // 328-335
+110, 125, 142, 153, 148, 137, 131, 133, // 336-343
+139, 143, 141, 138, 139, 150, 158, 161, // 344-351
+157, 136, 108,  94,  92,  95,  91,  86, // 352-359
+ 87, 101, 125, 138, 137, 137, 139, 147, // 360-367
+151, 144, 131, 130, 143, 152, 155, 151, // 368-375
+146, 156, 154, 127,  97,  84,  91,  95, // 376-383
+ 87,  83,  91, 118, 137, 132, 131, 140, // 384-391
+153, 156, 142, 132, 137, 152, 157, 147, // 392-399
+144, 153, 162, 141, 103,  91,  97, 100, // 400-407
+ 85,  72,  95, 117, 125, 123, 121, 147, // 408-415
+161, 147, 135, 136, 151, 152, 143, 148, // 416-423
+155, 159, 159, 136, 107, 107, 102,  88, // 424-431
+ 77,  77, 104, 114, 109, 123, 136, 148, // 432-439
+147, 140, 146, 148, 143, 142, 151, 159, // 440-447
+152, 149, 164, 136,  94, 109, 103,  81, // 448-455
+ 72,  81, 111, 102, 104, 135, 134, 146, // 456-463
+147, 149, 156, 143, 146, 157, 157, 153, // 464-471
+147, 162, 148,  92, 108, 115,  72,  76, // 472-479
+ 91, 100,  96, 109, 136, 124, 132, 156, // 480-487
+146, 143, 151, 153, 157, 158, 162, 156, // 488-495
+154, 152,  96, 105, 114,  61,  79,  98, // 496-503
+ 87,  95, 120, 129, 122, 144, 156, 138, // 504-511
+150, 157, 141, 156, 169, 158, 155, 166, // 512-519
+136,  90, 132,  90,  50, 104,  82,  76, // 520-527
+115, 110, 123, 131, 153, 146, 142, 167, // 528-535
+146, 149, 174, 147, 165, 157, 152, 104, // 536-543
+114, 122,  49,  97,  94,  61, 114, 110, // 544-551
+105, 139, 144, 141, 149, 158, 147, 151, // 552-559
+175, 153, 159, 170, 148, 127, 103, 130, // 560-567
+ 57,  78, 115,  39, 116, 121,  73, 163, // 568-575
+130, 127, 176, 137, 152, 160, 156, 165, // 576-583
+162, 157, 154, 132,  92, 143,  56,  82, // 584-591
+116,  35, 118, 113,  80, 158, 135, 129, // 592-599
+172, 145, 147, 169, 158, 156, 171, 155, // 600-607
+148, 124, 105, 121,  59,  95,  85,  56, // 608-615
+124,  88, 113, 147, 130, 156, 156, 153, // 616-623
+148, 165, 156, 162, 161, 156, 148,  96, // 624-631
+143,  72,  72, 125,  21, 120, 105,  64, // 632-639
+178, 102, 151, 175, 126, 181, 152, 161, // 640-647
+171, 153, 167, 141, 114, 123,  94,  64, // 648-655
+115,  48,  85, 124,  58, 160, 124, 129, // 656-663
+186, 128, 174, 163, 152, 175, 158, 159, // 664-671
+147, 109, 130,  78,  75, 103,  38, 112, // 672-679
+ 90,  83, 166, 104, 171, 165, 141, 185, // 680-687
+145, 169, 166, 157, 161, 122, 135,  93, // 688-695
+ 75,  96,  52,  81,  98,  81, 134, 127, // 696-703
+151, 164, 161, 163, 167, 160, 159, 170, // 704-711
+148, 144, 120, 108,  75,  86,  63,  76, // 712-719
+ 90,  84, 128, 124, 156, 163, 163, 175, // 720-727
+164, 165, 160, 172, 141, 141, 119,  97, // 728-735
+ 76,  80,  72,  67, 110,  81, 129, 135, // 736-743
+147, 170, 164, 169, 165, 158, 168, 159, // 744-751
+141, 148, 102, 103,  60,  92,  52,  89, // 752-759
+ 94,  94, 140, 139, 162, 168, 173, 163, // 760-767
+169, 154, 173, 144, 149, 122, 100,  80, // 768-775
+ 77,  68,  63, 105,  79, 129, 138, 150, // 776-783
+173, 170, 168, 169, 153, 177, 144, 158, // 784-791
+128, 109,  90,  66,  80,  49, 104,  77, // 792-799
+121, 131, 151, 165, 178, 170, 169, 159, // 800-807
+168, 151, 151, 132, 116,  84,  76,  75, // 808-815
+ 49, 106,  75, 120, 133, 148, 165, 177, // 816-823
+167, 173, 154, 170, 146, 153, 131, 114, // 824-831
+ 88,  77,  76,  59,  98,  86, 121, 131, // 832-839
+152, 164, 173, 169, 163, 155, 164, 143, // 840-847
+149, 124, 114,  75,  93,  56,  88,  86, // 848-855
+106, 123, 146, 154, 173, 168, 174, 148, // 856-863
+164, 147, 146, 137, 115, 102,  67,  91, // 864-871
+ 50, 100,  91, 116, 138, 154, 167, 179, // 872-879
+169, 167, 158, 151, 148, 136, 123, 102, // 880-887
+ 80,  75,  66,  77,  90, 107, 129, 152, // 888-895
+166, 180, 178, 168, 163, 153, 145, 144, // 896-903
+116, 118,  75,  87,  62,  76,  90,  99, // 904-911
+127, 145, 166, 176, 181, 169, 161, 155, // 912-919
+143, 144, 121, 109,  91,  73,  80,  73, // 920-927
+ 93, 104, 121, 149, 161, 172, 180, 161, // 928-935
+161, 148, 146, 136, 124, 113,  86,  88, // 936-943
+ 73,  80,  93, 104, 125, 151, 161, 179, // 944-951
+172, 165, 159, 145, 147, 132, 123, 106, // 952-959
+ 94,  76,  87,  73,  98, 102, 122, 149, // 960-967
+158, 177, 173, 165, 160, 148, 146, 140, // 968-975
+117, 113,  88,  81,  83,  80,  96, 106, // 976-983
+122, 148, 158, 176, 170, 158, 159, 144, // 984-991
+147, 133, 125, 106,  92,  89,  83,  89, // 992-999
+ 99, 108, 127, 152, 156, 175, 165, 157, // 1000-1007
+151, 141, 140, 128, 116, 105,  88,  91, // 1008-1015
+ 89,  96, 106, 118, 134, 157, 160, 171, // 1016-1023
+159, 154, 144, 139, 133, 123, 113,  93, // 1024-1031
+ 96,  84,  97, 100, 115, 126, 146, 161, // 1032-1039
+169, 168, 160, 146, 142, 133, 125, 115, // 1040-1047
+101,  90,  91,  87, 101, 107, 120, 140, // 1048-1055
+153, 168, 173, 162, 155, 145, 136, 131, // 1056-1063
+116, 108,  92,  90,  88,  94, 102, 117, // 1064-1071
+124, 152, 160, 172, 169, 158, 149, 140, // 1072-1079
+133, 122, 115,  94,  95,  86,  95, 101, // 1080-1087
+112, 124, 142, 158, 167, 172, 159, 150, // 1088-1095
+140, 129, 126, 111, 103,  94,  89,  95, // 1096-1103
+102, 109, 125, 135, 158, 162, 173, 160, // 1104-1111
+154, 141, 133, 124, 112, 105,  92,  93, // 1112-1119
+ 92, 100, 108, 124, 133, 156, 161, 174, // 1120-1127
+160, 158, 142, 134, 126, 114, 105,  98, // 1128-1135
+ 89,  96,  96, 110, 118, 132, 154, 155, // 1136-1143
+175, 160, 159, 143, 135, 126, 115, 109, // 1144-1151
+ 96,  95,  95, 100, 107, 118, 129, 148, // 1152-1159
+156, 171, 161, 160, 143, 136, 126, 116, // 1160-1167
+111,  96,  99,  95, 103, 108, 119, 127, // 1168-1175
+147, 155, 166, 163, 155, 146, 134, 128, // 1176-1183
+116, 106, 101,  92, 101, 100, 112, 120, // 1184-1191
+129, 149, 151, 167, 155, 157, 140, 136, // 1192-1199
+125, 119, 109, 102,  97, 101, 103, 111, // 1200-1207
+121, 131, 148, 151, 164, 154, 154, 138, // 1208-1215
+135, 124, 114, 109, 100, 101, 102, 107, // 1216-1223
+118, 123, 140, 146, 159, 156, 156, 143, // 1224-1231
+140, 125, 123, 111, 105, 102,  98, 107, // 1232-1239
+105, 122, 123, 145, 149, 163, 158, 159, // 1240-1247
+145, 137, 127, 116, 108, 101,  95,  99, // 1248-1255
+102, 109, 121, 126, 149, 152, 167, 160, // 1256-1263
+160, 144, 140, 126, 117, 105, 100,  93, // 1264-1271
+ 97, 101, 108, 121, 128, 149, 153, 168, // 1272-1279
+160, 157, 146, 136, 127, 117, 107,  97, // 1280-1287
+ 96,  95, 101, 110, 118, 134, 145, 160, // 1288-1295
+163, 163, 154, 145, 135, 126, 114, 106, // 1296-1303
+ 97,  96,  96, 103, 111, 121, 136, 147, // 1304-1311
+161, 161, 163, 150, 144, 135, 123, 116, // 1312-1319
+102,  99,  95, 100, 104, 114, 123, 136, // 1320-1327
+149, 158, 160, 158, 149, 142, 134, 122, // 1328-1335
+115, 103, 100,  97, 101, 108, 112, 128, // 1336-1343
+136, 152, 157, 160, 155, 147, 141, 128, // 1344-1351
+127, 109, 108,  97, 100, 103, 108, 118, // 1352-1359
+126, 141, 150, 160, 158, 154, 145, 136, // 1360-1367
+129, 119, 112, 104, 100, 100, 104, 109, // 1368-1375
+119, 127, 141, 152, 157, 161, 150, 147, // 1376-1383
+134, 130, 121, 110, 106,  97, 103, 103, // 1384-1391
+112, 119, 130, 141, 152, 159, 156, 153, // 1392-1399
+142, 137, 126, 121, 110, 105, 100, 102, // 1400-1407
+105, 112, 120, 128, 143, 151, 159, 155, // 1408-1415
+153, 140, 138, 125, 121, 109, 105, 101, // 1416-1423
+101, 109, 108, 123, 126, 144, 151, 158, // 1424-1431
+160, 149, 147, 133, 130, 118, 111, 106, // 1432-1439
+ 98, 106, 102, 113, 116, 128, 140, 149, // 1440-1447
+160, 155, 155, 143, 138, 130, 122, 113, // 1448-1455
+104, 102,  99, 106, 107, 118, 123, 136, // 1456-1463
+148, 155, 159, 153, 147, 139, 133, 125, // 1464-1471
+117, 108, 102, 101, 101, 109, 111, 122, // 1472-1479
+131, 144, 155, 159, 158, 149, 144, 134, // 1480-1487
+129, 119, 111, 103,  99, 101, 104, 110, // 1488-1495
+117, 127, 138, 152, 157, 159, 152, 146, // 1496-1503
+139, 131, 126, 112, 109,  99, 101, 103, // 1504-1511
+107, 114, 119, 134, 143, 155, 158, 155, // 1512-1519
+150, 143, 137, 129, 121, 111, 104, 100, // 1520-1527
+103, 103, 111, 114, 127, 138, 149, 157, // 1528-1535
+155, 154, 144, 142, 133, 129, 117, 110, // 1536-1543
+102, 101, 103, 104, 112, 117, 131, 141, // 1544-1551
+153, 155, 155, 149, 144, 139, 131, 127, // 1552-1559
+113, 108, 102, 102, 105, 107, 115, 121, // 1560-1567
+136, 144, 154, 153, 153, 145, 143, 136, // 1568-1575
+132, 123, 113, 106, 101, 104, 103, 111, // 1576-1583
+113, 127, 135, 149, 153, 154, 150, 144, // 1584-1591
+143, 135, 133, 120, 114, 104, 103, 102, // 1592-1599
+104, 110, 113, 128, 135, 150, 152, 154, // 1600-1607
+150, 144, 144, 134, 133, 120, 112, 107, // 1608-1615
+101, 106, 103, 110, 115, 126, 138, 147, // 1616-1623
+154, 150, 151, 143, 144, 137, 131, 123, // 1624-1631
+111, 108, 100, 104, 102, 109, 113, 125, // 1632-1639
+138, 145, 154, 150, 152, 144, 144, 139, // 1640-1647
+130, 126, 110, 110, 100, 104, 103, 107, // 1648-1655
+116, 122, 140, 142, 154, 150, 151, 148, // 1656-1663
+142, 143, 130, 129, 114, 109, 104,  98, // 1664-1671
+106, 101, 116, 119, 135, 144, 148, 155, // 1672-1679
+147, 150, 142, 142, 135, 128, 120, 109, // 1680-1687
+105, 101, 102, 104, 110, 119, 130, 139, // 1688-1695
+149, 149, 151, 147, 146, 143, 138, 133, // 1696-1703
+121, 115, 106, 103, 102, 103, 109, 115, // 1704-1711
+126, 136, 144, 150, 148, 149, 144, 144, // 1712-1719
+141, 135, 129, 117, 112, 102, 103, 102, // 1720-1727
+106, 113, 120, 133, 139, 148, 147, 148, // 1728-1735
+146, 143, 145, 138, 136, 123, 115, 107, // 1736-1743
+101, 103, 102, 110, 116, 125, 136, 142, // 1744-1751
+148, 147, 148, 145, 145, 142, 138, 130, // 1752-1759
+120, 112, 104, 102, 101, 106, 111, 119, // 1760-1767
+129, 136, 144, 147, 149, 147, 146, 144, // 1768-1775
+141, 137, 128, 121, 109, 105, 101, 102, // 1776-1783
+107, 111, 121, 128, 138, 144, 147, 148, // 1784-1791
+146, 145, 144, 142, 137, 128, 118, 109, // 1792-1799
+103, 101, 103, 106, 112, 121, 129, 140, // 1800-1807
+144, 148, 146, 146, 144, 143, 143, 136, // 1808-1815
+129, 117, 109, 103, 102, 103, 107, 114, // 1816-1823
+121, 133, 139, 147, 147, 147, 146, 144, // 1824-1831
+145, 141, 136, 126, 117, 107, 104, 101, // 1832-1839
+104, 107, 114, 121, 130, 139, 144, 148, // 1840-1847
+147, 147, 145, 145, 141, 137, 127, 118, // 1848-1855
+107, 103, 100, 103, 106, 113, 120, 128, // 1856-1863
+138, 142, 149, 146, 148, 145, 147, 144, // 1864-1871
+140, 131, 120, 111, 102, 101, 100, 106, // 1872-1879
+109, 118, 125, 135, 142, 146, 147, 146, // 1880-1887
+146, 146, 146, 142, 136, 125, 115, 105, // 1888-1895
+101, 100, 104, 107, 114, 121, 129, 138, // 1896-1903
+142, 147, 145, 147, 145, 147, 144, 140, // 1904-1911
+130, 120, 109, 105, 102, 103, 108, 108, // 1912-1919
+120, 122, 136, 138, 146, 146, 145, 147, // 1920-1927
+144, 148, 140, 137, 125, 116, 108, 102, // 1928-1935
+103, 103, 108, 113, 120, 128, 136, 141, // 1936-1943
+146, 144, 148, 144, 148, 144, 141, 133, // 1944-1951
+121, 115, 103, 104, 100, 105, 107, 114, // 1952-1959
+122, 130, 139, 143, 147, 147, 147, 147, // 1960-1967
+147, 145, 141, 131, 122, 111, 104, 101, // 1968-1975
+ 99, 104, 105, 116, 121, 133, 139, 144, // 1976-1983
+148, 144, 148, 145, 148, 145, 140, 134, // 1984-1991
+120, 114, 103, 101, 100, 103, 108, 114, // 1992-1999
+123, 130, 140, 142, 147, 144, 146, 144, // 2000-2007
+146, 145, 140, 134, 121, 116, 104, 106, // 2008-2015
+100, 107, 107, 114, 122, 128, 140, 139, // 2016-2023
+147, 141, 145, 143, 144, 146, 139, 137, // 2024-2031
+123, 118, 108, 106, 104, 104, 110, 111, // 2032-2039
+122, 125, 136, 139, 143, 143, 141, 144, // 2040-2047
+142, 146, 142, 138, 129, 120, 114, 108, // 2048-2055
+107, 105, 108, 110, 117, 124, 130, 138, // 2056-2063
+138, 142, 139, 141, 143, 143, 145, 138, // 2064-2071
+136, 124, 119, 112, 109, 108, 106, 111, // 2072-2079
+111, 121, 124, 134, 137, 139, 141, 139, // 2080-2087
+143, 142, 147, 141, 140, 130, 124, 116, // 2088-2095
+112, 110, 106, 111, 107, 116, 118, 128, // 2096-2103
+132, 136, 140, 138, 142, 141, 145, 145, // 2104-2111
+142, 138, 129, 123, 115, 113, 109, 108, // 2112-2119
+108, 109, 114, 120, 128, 134, 137, 139, // 2120-2127
+139, 141, 143, 146, 146, 142, 137, 129, // 2128-2135
+122, 116, 112, 109, 108, 107, 110, 114, // 2136-2143
+121, 126, 133, 136, 140, 141, 143, 144, // 2144-2151
+145, 145, 141, 136, 129, 123, 116, 112, // 2152-2159
+108, 106, 106, 109, 114, 121, 128, 133, // 2160-2167
+138, 140, 142, 142, 145, 144, 146, 141, // 2168-2175
+137, 129, 121, 115, 110, 109, 107, 109, // 2176-2183
+109, 116, 121, 128, 134, 137, 140, 139, // 2184-2191
+144, 144, 147, 146, 141, 135, 127, 121, // 2192-2199
+114, 112, 106, 108, 105, 110, 113, 121, // 2200-2207
+129, 132, 140, 138, 145, 141, 146, 144, // 2208-2215
+143, 142, 133, 132, 119, 119, 109, 109, // 2216-2223
+107, 105, 111, 111, 122, 125, 134, 138, // 2224-2231
+139, 144, 141, 145, 143, 143, 142, 135, // 2232-2239
+133, 123, 121, 114, 112, 110, 108, 111, // 2240-2247
+110, 119, 121, 131, 134, 138, 139, 139, // 2248-2255
+140, 140, 141, 140, 139, 134, 130, 124, // 2256-2263
+121, 117, 114, 112, 110, 112, 114, 119, // 2264-2271
+125, 129, 135, 135, 137, 137, 138, 141, // 2272-2279
+139, 142, 137, 135, 129, 125, 121, 117, // 2280-2287
+115, 111, 111, 111, 115, 119, 125, 129, // 2288-2295
+134, 134, 138, 137, 140, 142, 142, 143, // 2296-2303
+137, 136, 127, 125, 118, 115, 112, 109, // 2304-2311
+111, 110, 116, 118, 127, 130, 136, 137, // 2312-2319
+139, 140, 141, 143, 141, 142, 135, 134, // 2320-2327
+126, 123, 118, 113, 113, 108, 110, 110, // 2328-2335
+116, 123, 127, 134, 134, 138, 138, 139, // 2336-2343
+142, 140, 143, 138, 137, 131, 127, 122, // 2344-2351
+119, 115, 113, 112, 111, 114, 114, 123, // 2352-2359
+124, 133, 133, 137, 137, 136, 140, 137, // 2360-2367
+143, 138, 139, 133, 129, 126, 119, 121, // 2368-2375
+113, 116, 111, 114, 116, 119, 125, 126, // 2376-2383
+133, 132, 136, 135, 137, 139, 138, 140, // 2384-2391
+137, 136, 132, 128, 125, 121, 119, 114, // 2392-2399
+115, 110, 115, 115, 122, 126, 129, 133, // 2400-2407
+131, 136, 134, 139, 139, 141, 141, 137, // 2408-2415
+136, 130, 129, 123, 121, 116, 114, 112, // 2416-2423
+112, 115, 117, 123, 125, 130, 131, 134, // 2424-2431
+135, 137, 139, 140, 142, 140, 139, 134, // 2432-2439
+130, 126, 122, 120, 115, 114, 111, 113, // 2440-2447
+114, 118, 123, 126, 131, 132, 135, 135, // 2448-2455
+138, 139, 141, 141, 140, 137, 135, 130, // 2456-2463
+126, 123, 117, 116, 111, 112, 111, 114, // 2464-2471
+119, 122, 129, 129, 134, 133, 137, 137, // 2472-2479
+140, 142, 141, 141, 136, 135, 128, 127, // 2480-2487
+121, 119, 114, 112, 111, 111, 116, 118, // 2488-2495
+124, 126, 131, 132, 134, 136, 136, 139, // 2496-2503
+140, 141, 140, 137, 135, 129, 127, 123, // 2504-2511
+119, 117, 111, 114, 110, 116, 118, 122, // 2512-2519
+129, 129, 135, 132, 136, 136, 137, 141, // 2520-2527
+138, 142, 135, 135, 130, 126, 125, 117, // 2528-2535
+119, 111, 115, 111, 114, 119, 121, 129, // 2536-2543
+128, 134, 132, 135, 135, 136, 140, 138, // 2544-2551
+141, 136, 135, 130, 127, 124, 121, 119, // 2552-2559
+115, 114, 113, 116, 117, 122, 124, 129, // 2560-2567
+131, 133, 134, 134, 137, 137, 139, 139, // 2568-2575
+138, 136, 132, 130, 126, 124, 120, 118, // 2576-2583
+114, 113, 113, 114, 119, 121, 127, 128, // 2584-2591
+132, 133, 133, 137, 136, 141, 139, 141, // 2592-2599
+138, 134, 134, 127, 129, 121, 121, 116, // 2600-2607
+112, 113, 109, 116, 115, 123, 126, 128, // 2608-2615
+134, 131, 137, 135, 139, 141, 139, 144, // 2616-2623
+136, 138, 132, 128, 129, 119, 124, 112, // 2624-2631
+115, 110, 110, 115, 114, 125, 124, 131, // 2632-2639
+131, 133, 135, 135, 139, 140, 141, 141, // 2640-2647
+138, 136, 133, 127, 128, 120, 122, 115, // 2648-2655
+114, 113, 110, 118, 115, 126, 123, 131, // 2656-2663
+131, 132, 135, 134, 139, 138, 141, 140, // 2664-2671
+138, 135, 132, 128, 127, 122, 122, 118, // 2672-2679
+114, 115, 109, 118, 113, 125, 123, 129, // 2680-2687
+132, 130, 137, 131, 141, 136, 142, 140, // 2688-2695
+137, 138, 129, 133, 123, 128, 119, 122, // 2696-2703
+114, 114, 113, 111, 118, 116, 127, 125, // 2704-2711
+132, 131, 133, 136, 134, 141, 138, 142, // 2712-2719
+138, 138, 133, 132, 127, 128, 122, 123, // 2720-2727
+116, 115, 114, 110, 118, 112, 127, 120, // 2728-2735
+133, 129, 131, 137, 130, 143, 134, 144, // 2736-2743
+137, 138, 136, 129, 133, 125, 129, 121, // 2744-2751
+123, 114, 117, 110, 115, 113, 119, 124, // 2752-2759
+124, 133, 127, 137, 130, 137, 137, 138, // 2760-2767
+143, 136, 142, 130, 136, 126, 129, 125, // 2768-2775
+122, 123, 113, 119, 108, 117, 113, 121, // 2776-2783
+124, 126, 132, 128, 135, 131, 137, 136, // 2784-2791
+140, 141, 139, 138, 131, 133, 126, 130, // 2792-2799
+123, 125, 119, 115, 115, 109, 118, 112, // 2800-2807
+124, 122, 127, 131, 128, 136, 130, 138, // 2808-2815
+136, 141, 141, 139, 140, 132, 135, 126, // 2816-2823
+131, 123, 124, 119, 113, 117, 106, 118, // 2824-2831
+111, 123, 122, 125, 133, 126, 137, 129, // 2832-2839
+139, 138, 139, 144, 137, 142, 132, 134, // 2840-2847
+128, 128, 125, 121, 120, 113, 115, 109, // 2848-2855
+115, 114, 120, 124, 125, 132, 128, 136, // 2856-2863
+132, 138, 138, 141, 142, 140, 139, 133, // 2864-2871
+134, 126, 130, 122, 124, 117, 114, 116, // 2872-2879
+107, 119, 110, 124, 122, 127, 132, 127, // 2880-2887
+137, 129, 139, 136, 141, 141, 139, 139, // 2888-2895
+133, 133, 127, 128, 123, 124, 119, 117, // 2896-2903
+115, 111, 116, 113, 122, 122, 128, 130, // 2904-2911
+130, 134, 132, 137, 137, 140, 141, 139, // 2912-2919
+140, 133, 133, 126, 128, 124, 122, 122, // 2920-2927
+114, 118, 109, 116, 114, 118, 125, 122, // 2928-2935
+134, 127, 136, 132, 135, 138, 135, 144, // 2936-2943
+136, 142, 132, 133, 128, 124, 128, 120, // 2944-2951
+127, 115, 120, 113, 113, 117, 114, 126, // 2952-2959
+121, 132, 129, 131, 135, 130, 139, 133, // 2960-2967
+142, 138, 138, 137, 130, 132, 125, 129, // 2968-2975
+124, 124, 123, 117, 119, 111, 117, 115, // 2976-2983
+119, 125, 123, 132, 127, 133, 131, 132, // 2984-2991
+137, 134, 143, 136, 140, 135, 130, 133, // 2992-2999
+124, 132, 123, 127, 122, 116, 119, 110, // 3000-3007
+118, 114, 120, 124, 123, 132, 126, 133, // 3008-3015
+129, 132, 136, 135, 142, 136, 141, 133, // 3016-3023
+133, 130, 128, 130, 124, 128, 117, 122, // 3024-3031
+112, 116, 114, 115, 122, 119, 131, 124, // 3032-3039
+133, 129, 132, 134, 133, 141, 136, 142, // 3040-3047
+137, 136, 134, 129, 130, 126, 125, 124, // 3048-3055
+118, 120, 113, 115, 115, 114, 123, 119, // 3056-3063
+131, 125, 132, 131, 129, 137, 131, 142, // 3064-3071
+137, 140, 139, 132, 136, 126, 130, 126, // 3072-3079
+124, 126, 116, 121, 112, 116, 114, 115, // 3080-3087
+124, 120, 132, 126, 132, 131, 131, 137, // 3088-3095
+133, 142, 138, 140, 139, 132, 135, 126, // 3096-3103
+129, 128, 122, 128, 115, 121, 112, 111, // 3104-3111
+118, 109, 127, 117, 131, 129, 127, 138, // 3112-3119
+125, 140, 132, 140, 144, 136, 145, 131, // 3120-3127
+136, 130, 126, 132, 120, 129, 116, 119, // 3128-3135
+114, 109, 117, 109, 124, 118, 129, 128, // 3136-3143
+128, 134, 127, 137, 132, 140, 140, 139, // 3144-3151
+143, 134, 136, 129, 129, 129, 125, 128, // 3152-3159
+121, 119, 117, 112, 115, 113, 119, 121, // 3160-3167
+125, 128, 128, 130, 129, 131, 133, 137, // 3168-3175
+138, 142, 139, 140, 134, 132, 131, 126, // 3176-3183
+132, 123, 129, 118, 119, 115, 111, 118, // 3184-3191
+110, 125, 118, 129, 126, 128, 132, 126, // 3192-3199
+136, 131, 141, 139, 141, 141, 136, 135, // 3200-3207
+129, 130, 127, 129, 125, 126, 118, 119, // 3208-3215
+112, 114, 114, 115, 123, 120, 130, 125, // 3216-3223
+131, 130, 130, 135, 133, 140, 139, 141, // 3224-3231
+139, 136, 133, 131, 128, 130, 127, 126, // 3232-3239
+124, 115, 120, 109, 116, 113, 116, 123, // 3240-3247
+119, 131, 123, 132, 129, 130, 136, 133, // 3248-3255
+142, 138, 143, 138, 138, 133, 132, 130, // 3256-3263
+128, 131, 121, 129, 112, 121, 110, 112, // 3264-3271
+118, 109, 129, 114, 133, 124, 128, 134, // 3272-3279
+124, 140, 129, 142, 139, 140, 141, 135, // 3280-3287
+136, 130, 130, 128, 130, 123, 129, 115, // 3288-3295
+121, 113, 111, 120, 109, 129, 116, 130, // 3296-3303
+127, 124, 136, 122, 140, 129, 140, 140, // 3304-3311
+138, 144, 132, 139, 126, 134, 125, 131, // 3312-3319
+126, 124, 125, 112, 123, 105, 121, 112, // 3320-3327
+119, 126, 117, 135, 119, 134, 127, 129, // 3328-3335
+138, 130, 145, 136, 143, 137, 134, 135, // 3336-3343
+128, 133, 127, 131, 123, 126, 118, 117, // 3344-3351
+116, 109, 120, 111, 124, 120, 123, 130, // 3352-3359
+121, 135, 125, 135, 134, 136, 142, 138, // 3360-3367
+142, 137, 136, 133, 132, 130, 130, 127, // 3368-3375
+125, 124, 114, 119, 110, 114, 116, 113, // 3376-3383
+126, 116, 131, 124, 128, 133, 126, 139, // 3384-3391
+131, 142, 139, 141, 141, 135, 138, 129, // 3392-3399
+134, 127, 132, 124, 125, 120, 115, 117, // 3400-3407
+108, 118, 111, 121, 121, 124, 129, 124, // 3408-3415
+133, 126, 134, 133, 137, 141, 139, 144, // 3416-3423
+135, 140, 130, 133, 130, 127, 130, 121, // 3424-3431
+126, 114, 119, 112, 113, 116, 114, 122, // 3432-3439
+121, 127, 126, 129, 129, 130, 133, 135, // 3440-3447
+139, 139, 142, 139, 138, 136, 130, 132, // 3448-3455
+128, 128, 129, 122, 125, 115, 117, 114, // 3456-3463
+110, 119, 113, 124, 122, 125, 130, 125, // 3464-3471
+133, 129, 134, 137, 136, 142, 139, 140, // 3472-3479
+137, 134, 132, 130, 129, 129, 128, 123, // 3480-3487
+125, 114, 118, 113, 111, 120, 111, 126, // 3488-3495
+119, 126, 129, 124, 135, 127, 135, 136, // 3496-3503
+136, 143, 138, 141, 137, 135, 133, 130, // 3504-3511
+130, 129, 129, 123, 125, 116, 115, 116, // 3512-3519
+108, 121, 112, 123, 123, 122, 131, 123, // 3520-3527
+133, 130, 132, 138, 135, 141, 141, 138, // 3528-3535
+139, 135, 131, 133, 128, 131, 129, 121, // 3536-3543
+126, 113, 117, 115, 110, 121, 113, 122, // 3544-3551
+124, 120, 132, 124, 131, 132, 129, 139, // 3552-3559
+135, 140, 142, 137, 140, 133, 132, 132, // 3560-3567
+128, 130, 129, 123, 126, 116, 114, 118, // 3568-3575
+108, 121, 115, 119, 127, 118, 133, 123, // 3576-3583
+130, 133, 127, 140, 133, 141, 140, 137, // 3584-3591
+140, 131, 136, 128, 132, 128, 129, 127, // 3592-3599
+121, 125, 109, 121, 109, 115, 122, 112, // 3600-3607
+131, 118, 128, 130, 122, 137, 125, 137, // 3608-3615
+136, 135, 143, 135, 142, 133, 135, 133, // 3616-3623
+128, 134, 126, 132, 122, 125, 116, 114, // 3624-3631
+118, 108, 122, 115, 120, 127, 119, 130, // 3632-3639
+125, 127, 133, 129, 137, 135, 138, 141, // 3640-3647
+138, 140, 135, 135, 133, 131, 132, 129, // 3648-3655
+127, 123, 122, 114, 117, 113, 112, 120, // 3656-3663
+114, 123, 124, 121, 129, 124, 129, 131, // 3664-3671
+131, 136, 135, 140, 138, 139, 139, 135, // 3672-3679
+136, 132, 131, 131, 128, 126, 124, 120, // 3680-3687
+114, 118, 112, 115, 120, 116, 124, 123, // 3688-3695
+123, 127, 126, 129, 131, 133, 135, 137, // 3696-3703
+139, 139, 140, 137, 135, 133, 132, 130, // 3704-3711
+130, 129, 124, 125, 119, 114, 117, 111, // 3712-3719
+117, 119, 119, 124, 123, 125, 126, 129, // 3720-3727
+128, 131, 134, 133, 138, 139, 137, 141, // 3728-3735
+136, 134, 135, 129, 132, 129, 129, 126, // 3736-3743
+123, 121, 112, 117, 112, 114, 121, 118, // 3744-3751
+123, 124, 124, 125, 129, 128, 130, 135, // 3752-3759
+133, 138, 139, 138, 141, 138, 135, 135, // 3760-3767
+132, 132, 130, 130, 126, 121, 123, 112, // 3768-3775
+116, 115, 111, 120, 118, 119, 124, 124, // 3776-3783
+124, 129, 128, 130, 133, 134, 136, 139, // 3784-3791
+140, 139, 140, 137, 134, 134, 132, 128, // 3792-3799
+133, 127, 123, 126, 113, 116, 115, 112, // 3800-3807
+118, 119, 121, 120, 126, 122, 125, 131, // 3808-3815
+126, 134, 134, 134, 138, 139, 138, 138, // 3816-3823
+138, 133, 135, 132, 131, 131, 130, 125, // 3824-3831
+123, 122, 111, 118, 114, 112, 123, 117, // 3832-3839
+122, 124, 124, 125, 127, 131, 128, 136, // 3840-3847
+135, 133, 141, 136, 137, 140, 134, 134, // 3848-3855
+134, 131, 130, 130, 128, 122, 124, 116, // 3856-3863
+112, 119, 110, 117, 122, 116, 125, 124, // 3864-3871
+125, 127, 130, 130, 130, 137, 132, 136, // 3872-3879
+141, 135, 140, 139, 132, 136, 132, 130, // 3880-3887
+130, 129, 126, 122, 124, 113, 114, 118, // 3888-3895
+109, 120, 119, 119, 125, 124, 126, 125, // 3896-3903
+132, 129, 131, 139, 132, 139, 140, 135, // 3904-3911
+139, 137, 132, 135, 132, 130, 131, 130, // 3912-3919
+126, 122, 124, 113, 114, 119, 109, 120, // 3920-3927
+121, 118, 125, 124, 125, 126, 130, 131, // 3928-3935
+130, 138, 133, 136, 140, 134, 138, 137, // 3936-3943
+133, 134, 133, 132, 130, 131, 127, 121, // 3944-3951
+124, 115, 113, 118, 113, 116, 121, 119, // 3952-3959
+121, 124, 127, 124, 131, 132, 128, 137, // 3960-3967
+134, 133, 140, 136, 137, 138, 135, 133, // 3968-3975
+134, 134, 130, 132, 131, 120, 124, 119, // 3976-3983
+109, 119, 113, 113, 121, 119, 121, 123, // 3984-3991
+128, 124, 127, 134, 126, 134, 136, 132, // 3992-3999
+139, 138, 136, 137, 137, 134, 134, 136, // 4000-4007
+130, 130, 133, 123, 122, 122, 112, 114, // 4008-4015
+116, 114, 116, 121, 122, 120, 126, 127, // 4016-4023
+125, 130, 132, 130, 134, 135, 135, 137, // 4024-4031
+137, 136, 137, 136, 133, 134, 132, 131, // 4032-4039
+130, 130, 124, 119, 123, 112, 113, 119, // 4040-4047
+112, 118, 122, 122, 122, 126, 128, 125, // 4048-4055
+130, 133, 130, 135, 136, 134, 138, 137, // 4056-4063
+136, 137, 134, 133, 133, 131, 131, 129, // 4064-4071
+130, 123, 121, 122, 112, 114, 116, 114, // 4072-4079
+117, 122, 122, 123, 126, 128, 127, 129, // 4080-4087
+133, 131, 134, 136, 134, 137, 136, 136, // 4088-4095
+136, 135, 133, 133, 132, 130, 130, 130, // 4096-4103
+125, 121, 121, 115, 113, 117, 115, 117, // 4104-4111
+121, 123, 123, 125, 127, 127, 129, 131, // 4112-4119
+132, 134, 135, 134, 136, 135, 135, 136, // 4120-4127
+135, 133, 133, 133, 130, 131, 130, 128, // 4128-4135
+123, 121, 118, 113, 115, 115, 116, 118, // 4136-4143
+121, 124, 124, 125, 129, 129, 128, 132, // 4144-4151
+133, 133, 134, 137, 135, 135, 137, 136, // 4152-4159
+135, 133, 134, 132, 130, 130, 131, 127, // 4160-4167
+120, 121, 118, 111, 115, 118, 116, 119, // 4168-4175
+124, 124, 123, 125, 129, 127, 128, 132, // 4176-4183
+134, 132, 134, 138, 135, 133, 137, 137, // 4184-4191
+133, 133, 135, 131, 129, 130, 131, 125, // 4192-4199
+120, 122, 117, 112, 116, 119, 117, 118, // 4200-4207
+124, 125, 124, 126, 129, 128, 127, 132, // 4208-4215
+134, 134, 133, 136, 135, 133, 134, 136, // 4216-4223
+134, 130, 133, 132, 129, 129, 130, 126, // 4224-4231
+119, 119, 118, 114, 115, 119, 120, 119, // 4232-4239
+122, 127, 125, 125, 130, 131, 129, 131, // 4240-4247
+134, 134, 131, 134, 136, 134, 134, 135, // 4248-4255
+135, 132, 132, 132, 131, 128, 129, 127, // 4256-4263
+122, 118, 120, 116, 112, 117, 119, 119, // 4264-4271
+121, 125, 127, 125, 127, 131, 130, 130, // 4272-4279
+132, 134, 134, 134, 135, 135, 134, 135, // 4280-4287
+135, 135, 133, 132, 132, 129, 129, 130, // 4288-4295
+126, 120, 120, 117, 113, 114, 116, 118, // 4296-4303
+119, 122, 125, 126, 126, 127, 128, 130, // 4304-4311
+130, 133, 135, 134, 134, 134, 134, 135, // 4312-4319
+135, 135, 134, 133, 132, 131, 132, 130, // 4320-4327
+129, 124, 120, 118, 117, 115, 114, 117, // 4328-4335
+118, 120, 123, 125, 126, 125, 126, 128, // 4336-4343
+130, 132, 132, 133, 134, 134, 134, 134, // 4344-4351
+135, 135, 134, 133, 133, 132, 131, 130, // 4352-4359
+128, 128, 124, 121, 120, 118, 115, 115, // 4360-4367
+117, 119, 122, 123, 125, 125, 126, 127, // 4368-4375
+128, 131, 132, 132, 133, 134, 135, 134, // 4376-4383
+134, 135, 133, 134, 134, 132, 132, 131, // 4384-4391
+130, 130, 128, 127, 123, 120, 119, 118, // 4392-4399
+117, 116, 118, 120, 121, 124, 125, 125, // 4400-4407
+126, 128, 129, 131, 131, 133, 133, 134, // 4408-4415
+134, 134, 134, 132, 133, 133, 133, 133, // 4416-4423
+132, 131, 130, 130, 128, 128, 125, 122, // 4424-4431
+120, 119, 118, 118, 119, 119, 120, 123, // 4432-4439
+123, 124, 125, 127, 127, 129, 132, 132, // 4440-4447
+133, 133, 133, 133, 132, 134, 134, 133, // 4448-4455
+135, 134, 132, 131, 131, 130, 128, 128, // 4456-4463
+127, 124, 122, 120, 119, 117, 117, 118, // 4464-4471
+119, 121, 123, 123, 124, 125, 127, 128, // 4472-4479
+131, 132, 133, 134, 133, 134, 133, 133, // 4480-4487
+134, 134, 134, 134, 133, 132, 130, 130, // 4488-4495
+129, 128, 127, 126, 124, 121, 119, 118, // 4496-4503
+116, 117, 118, 119, 121, 123, 124, 126, // 4504-4511
+127, 128, 130, 132, 133, 134, 135, 134, // 4512-4519
+133, 133, 133, 133, 133, 134, 133, 132, // 4520-4527
+131, 130, 128, 128, 128, 127, 126, 123, // 4528-4535
+120, 118, 117, 117, 118, 119, 120, 122, // 4536-4543
+124, 125, 126, 127, 128, 130, 132, 134, // 4544-4551
+135, 134, 134, 133, 133, 132, 133, 133, // 4552-4559
+132, 132, 132, 131, 129, 128, 127, 127, // 4560-4567
+127, 126, 124, 121, 120, 118, 117, 118, // 4568-4575
+119, 120, 121, 124, 125, 125, 127, 129, // 4576-4583
+130, 133, 134, 135, 134, 133, 133, 133, // 4584-4591
+132, 132, 133, 133, 133, 132, 131, 129, // 4592-4599
+128, 128, 127, 127, 127, 125, 123, 120, // 4600-4607
+118, 118, 117, 118, 120, 121, 123, 125, // 4608-4615
+126, 127, 127, 129, 131, 133, 135, 134, // 4616-4623
+133, 132, 132, 132, 132, 133, 133, 132, // 4624-4631
+132, 131, 130, 129, 128, 128, 128, 127, // 4632-4639
+126, 124, 122, 120, 119, 118, 119, 120, // 4640-4647
+121, 122, 124, 125, 126, 127, 128, 129, // 4648-4655
+131, 133, 134, 134, 133, 132, 132, 132, // 4656-4663
+132, 132, 132, 132, 131, 131, 129, 128, // 4664-4671
+128, 128, 128, 128, 126, 124, 122, 120, // 4672-4679
+120, 120, 120, 120, 121, 123, 124, 124, // 4680-4687
+126, 126, 127, 130, 131, 133, 133, 133, // 4688-4695
+133, 132, 132, 131, 132, 132, 132, 132, // 4696-4703
+131, 131, 130, 128, 128, 128, 127, 127, // 4704-4711
+126, 125, 122, 120, 119, 119, 119, 121, // 4712-4719
+122, 123, 124, 125, 125, 126, 128, 130, // 4720-4727
+132, 133, 134, 133, 133, 132, 131, 131, // 4728-4735
+131, 132, 132, 131, 131, 130, 129, 128, // 4736-4743
+127, 127, 127, 127, 127, 125, 123, 121, // 4744-4751
+120, 120, 120, 121, 122, 123, 124, 125, // 4752-4759
+125, 127, 128, 130, 132, 133, 133, 133, // 4760-4767
+133, 132, 132, 131, 131, 132, 131, 131, // 4768-4775
+131, 130, 129, 128, 128, 127, 127, 127, // 4776-4783
+127, 126, 124, 123, 121, 121, 121, 121, // 4784-4791
+121, 123, 123, 124, 124, 125, 127, 129, // 4792-4799
+130, 132, 132, 132, 132, 132, 132, 132, // 4800-4807
+131, 131, 131, 131, 131, 130, 130, 129, // 4808-4815
+129, 128, 128, 128, 128, 127, 125, 124, // 4816-4823
+122, 121, 121, 121, 121, 122, 122, 123, // 4824-4831
+124, 125, 126, 128, 129, 130, 131, 132, // 4832-4839
+132, 132, 132, 131, 131, 131, 131, 131, // 4840-4847
+130, 131, 130, 130, 129, 129, 128, 128, // 4848-4855
+128, 127, 126, 125, 124, 123, 122, 121, // 4856-4863
+121, 121, 122, 123, 124, 124, 125, 126, // 4864-4871
+128, 129, 130, 131, 132, 132, 132, 131, // 4872-4879
+131, 131, 131, 130, 131, 131, 131, 130, // 4880-4887
+130, 130, 129, 128, 128, 128, 127, 126, // 4888-4895
+125, 124, 122, 122, 121, 121, 122, 122, // 4896-4903
+123, 123, 124, 125, 126, 128, 129, 130, // 4904-4911
+131, 132, 132, 132, 131, 131, 131, 131, // 4912-4919
+131, 131, 131, 130, 130, 130, 130, 129, // 4920-4927
+129, 128, 128, 128, 126, 125, 124, 123, // 4928-4935
+121, 121, 121, 121, 122, 122, 123, 124, // 4936-4943
+125, 126, 127, 129, 130, 131, 131, 131, // 4944-4951
+131, 131, 131, 131, 131, 131, 132, 131, // 4952-4959
+131, 130, 130, 130, 130, 129, 129, 128, // 4960-4967
+127, 126, 125, 124, 123, 122, 122, 122, // 4968-4975
+121, 122, 123, 123, 124, 125, 126, 126, // 4976-4983
+128, 129, 130, 131, 131, 131, 131, 131, // 4984-4991
+131, 132, 132, 131, 131, 131, 131, 131, // 4992-4999
+130, 129, 129, 128, 128, 127, 127, 126, // 5000-5007
+125, 124, 123, 122, 121, 121, 121, 122, // 5008-5015
+123, 124, 124, 125, 126, 127, 129, 130, // 5016-5023
+131, 132, 132, 132, 131, 131, 131, 131, // 5024-5031
+131, 131, 131, 131, 130, 130, 129, 129, // 5032-5039
+129, 128, 128, 127, 126, 125, 124, 123, // 5040-5047
+122, 122, 122, 122, 122, 123, 123, 124, // 5048-5055
+125, 126, 127, 128, 129, 130, 131, 131, // 5056-5063
+132, 132, 131, 131, 131, 131, 131, 131, // 5064-5071
+131, 130, 130, 130, 129, 129, 129, 128, // 5072-5079
+127, 127, 126, 125, 124, 123, 123, 122, // 5080-5087
+122, 122, 122, 122, 123, 124, 125, 126, // 5088-5095
+127, 128, 129, 130, 131, 131, 131, 131, // 5096-5103
+131, 131, 131, 131, 131, 131, 131, 130, // 5104-5111
+130, 129, 129, 129, 129, 128, 128, 127, // 5112-5119
+126, 125, 124, 123, 123, 122, 122, 122, // 5120-5127
+122, 122, 123, 124, 125, 126, 127, 128, // 5128-5135
+129, 130, 130, 131, 131, 132, 132, 131, // 5136-5143
+131, 131, 131, 131, 131, 130, 130, 130, // 5144-5151
+129, 129, 129, 128, 127, 127, 126, 125, // 5152-5159
+125, 124, 124, 123, 122, 122, 122, 122, // 5160-5167
+123, 124, 125, 126, 126, 127, 128, 129, // 5168-5175
+130, 131, 132, 132, 132, 132, 132, 132, // 5176-5183
+132, 131, 131, 130, 130, 129, 129, 129, // 5184-5191
+129, 128, 128, 127, 126, 125, 125, 124, // 5192-5199
+124, 123, 122, 122, 122, 122, 122, 123, // 5200-5207
+124, 125, 126, 126, 127, 129, 130, 131, // 5208-5215
+132, 132, 132, 132, 132, 132, 132, 132, // 5216-5223
+131, 131, 130, 130, 130, 129, 129, 129, // 5224-5231
+128, 128, 127, 126, 125, 125, 124, 123, // 5232-5239
+122, 122, 121, 121, 121, 122, 123, 124, // 5240-5247
+125, 126, 127, 128, 129, 131, 131, 132, // 5248-5255
+132, 132, 132, 132, 132, 132, 131, 131, // 5256-5263
+130, 130, 130, 129, 129, 129, 129, 128, // 5264-5271
+127, 126, 126, 125, 124, 124, 123, 122, // 5272-5279
+121, 121, 121, 122, 123, 124, 125, 126, // 5280-5287
+127, 127, 128, 130, 131, 132, 132, 132, // 5288-5295
+132, 132, 131, 131, 131, 131, 131, 130, // 5296-5303
+129, 129, 129, 129, 129, 129, 128, 127, // 5304-5311
+126, 125, 125, 124, 124, 123, 123, 122, // 5312-5319
+122, 122, 122, 123, 124, 125, 126, 127, // 5320-5327
+128, 129, 130, 131, 131, 132, 132, 132, // 5328-5335
+132, 131, 131, 131, 130, 130, 130, 129, // 5336-5343
+129, 129, 129, 129, 129, 128, 127, 126, // 5344-5351
+126, 125, 125, 124, 123, 122, 122, 122, // 5352-5359
+122, 123, 124, 124, 125, 126, 127, 128, // 5360-5367
+129, 130, 131, 131, 131, 131, 131, 131, // 5368-5375
+131, 131, 131, 130, 130, 130, 129, 129, // 5376-5383
+129, 129, 129, 128, 128, 127, 126, 126, // 5384-5391
+125, 124, 124, 123, 123, 122, 122, 122, // 5392-5399
+122, 123, 124, 126, 127, 128, 128, 129, // 5400-5407
+130, 131, 132, 132, 132, 132, 131, 131, // 5408-5415
+130, 130, 130, 130, 129, 129, 129, 129, // 5416-5423
+128, 128, 128, 127, 127, 126, 126, 125, // 5424-5431
+124, 124, 123, 122, 122, 122, 123, 123, // 5432-5439
+124, 125, 126, 127, 128, 129, 130, 131, // 5440-5447
+132, 132, 132, 132, 131, 131, 131, 130, // 5448-5455
+130, 130, 129, 129, 129, 129, 128, 128, // 5456-5463
+128, 128, 127, 126, 126, 125, 125, 124, // 5464-5471
+124, 123, 123, 122, 123, 123, 124, 125, // 5472-5479
+126, 126, 127, 128, 129, 130, 131, 131, // 5480-5487
+132, 132, 131, 131, 131, 130, 130, 130, // 5488-5495
+129, 129, 129, 129, 129, 128, 128, 128, // 5496-5503
+128, 127, 126, 126, 125, 125, 124, 124, // 5504-5511
+123, 123, 123, 123, 123, 124, 125, 126, // 5512-5519
+127, 128, 129, 129, 130, 130, 131, 131, // 5520-5527
+132, 132, 131, 131, 130, 130, 129, 129, // 5528-5535
+129, 129, 129, 128, 128, 128, 127, 127, // 5536-5543
+127, 127, 126, 126, 125, 124, 124, 124, // 5544-5551
+124, 123, 123, 123, 124, 125, 126, 127, // 5552-5559
+128, 128, 129, 130, 130, 131, 131, 132, // 5560-5567
+132, 131, 131, 130, 130, 129, 129, 129, // 5568-5575
+129, 128, 128, 128, 128, 128, 127, 127, // 5576-5583
+127, 126, 126, 125, 125, 124, 124, 124, // 5584-5591
+123, 123, 124, 124, 125, 126, 127, 127, // 5592-5599
+128, 129, 130, 130, 131, 131, 131, 131, // 5600-5607
+131, 130, 130, 130, 129, 129, 129, 129, // 5608-5615
+129, 129, 128, 128, 128, 127, 127, 127, // 5616-5623
+127, 126, 126, 125, 124, 124, 124, 124, // 5624-5631
+124, 124, 125, 125, 126, 126, 127, 128, // 5632-5639
+129, 129, 130, 130, 131, 131, 131, 131, // 5640-5647
+130, 130, 130, 129, 129, 129, 129, 129, // 5648-5655
+128, 128, 128, 128, 127, 127, 127, 127, // 5656-5663
+126, 126, 125, 125, 124, 124, 124, 124, // 5664-5671
+124, 124, 125, 125, 126, 127, 128, 128, // 5672-5679
+129, 130, 130, 131, 131, 131, 131, 131, // 5680-5687
+130, 130, 130, 129, 129, 129, 128, 128, // 5688-5695
+128, 128, 128, 127, 127, 127, 126, 126, // 5696-5703
+126, 125, 125, 124, 124, 124, 124, 124, // 5704-5711
+124, 125, 125, 126, 127, 127, 128, 129, // 5712-5719
+130, 130, 131, 131, 131, 131, 131, 131, // 5720-5727
+130, 130, 129, 129, 129, 129, 128, 128, // 5728-5735
+128, 127, 127, 127, 127, 126, 126, 126, // 5736-5743
+125, 125, 124, 124, 124, 124, 124, 124, // 5744-5751
+125, 125, 126, 126, 127, 128, 129, 130, // 5752-5759
+130, 131, 131, 131, 131, 131, 131, 130, // 5760-5767
+130, 130, 129, 129, 129, 128, 128, 128, // 5768-5775
+127, 127, 127, 127, 127, 126, 126, 125, // 5776-5783
+125, 124, 124, 124, 124, 124, 124, 125, // 5784-5791
+125, 125, 126, 127, 128, 129, 129, 130, // 5792-5799
+130, 131, 131, 131, 131, 131, 131, 130, // 5800-5807
+130, 129, 129, 129, 129, 128, 128, 128, // 5808-5815
+127, 127, 127, 127, 126, 126, 126, 125, // 5816-5823
+125, 124, 124, 124, 124, 124, 124, 125, // 5824-5831
+125, 126, 127, 127, 128, 128, 129, 130, // 5832-5839
+130, 130, 131, 131, 131, 131, 130, 130, // 5840-5847
+130, 129, 129, 129, 129, 128, 128, 128, // 5848-5855
+128, 127, 127, 127, 126, 126, 125, 125, // 5856-5863
+125, 124, 124, 124, 124, 124, 125, 125, // 5864-5871
+126, 126, 126, 127, 128, 129, 129, 130, // 5872-5879
+130, 130, 130, 131, 130, 130, 130, 130, // 5880-5887
+130, 129, 129, 129, 129, 128, 128, 128, // 5888-5895
+127, 127, 127, 127, 126, 126, 126, 125, // 5896-5903
+125, 125, 125, 124, 124, 125, 125, 125, // 5904-5911
+125, 126, 127, 127, 128, 128, 129, 129, // 5912-5919
+130, 130, 130, 130, 130, 130, 130, 130, // 5920-5927
+130, 129, 129, 129, 128, 128, 128, 128};// 5928-5935
+
+#define PEW_N 3320
+const uint8_t pew[PEW_N] = {
+113, 111, 114,  98, 112, 100, 105, 107, // 0-7
+103, 124, 127, 130, 175, 181, 199, 213, // 8-15
+187, 146, 117,  96,  87,  88, 107,  97, // 16-23
+ 89, 101, 112, 115, 125, 130, 139, 143, // 24-31
+139, 135, 132, 141, 123, 128, 124, 129, // 32-39
+136, 160, 163, 180, 176, 198, 184, 168, // 40-47
+161, 138, 110, 116,  98, 121, 118, 127, // 48-55
+103,  87,  88,  99,  84,  69,  79,  99, // 56-63
+121, 107,  81,  81,  85,  95, 110, 124, // 64-71
+167, 181, 181, 179, 161, 132, 134, 144, // 72-79
+152, 155, 157, 141, 128, 117, 135, 121, // 80-87
+110, 101, 108, 121, 140, 127, 130, 103, // 88-95
+116, 106, 102, 104,  86,  91, 107, 129, // 96-103
+149, 131, 129, 108, 112, 114, 112, 118, // 104-111
+112, 116, 118, 117, 148, 139, 141, 156, // 112-119
+128, 165, 146, 165, 177, 175, 191, 209, // 120-127
+209, 220, 173, 193, 175, 150, 141, 103, // 128-135
+ 96,  94,  76, 105,  71,  88,  82,  77, // 136-143
+ 82,  71,  77,  93,  85, 115,  94, 114, // 144-151
+112,  95, 121, 106, 131, 122, 128, 131, // 152-159
+126, 137, 124, 123, 131, 134, 147, 140, // 160-167
+138, 129, 131, 128, 117, 119, 116, 128, // 168-175
+135, 122, 145, 138, 141, 162, 135, 158, // 176-183
+140, 146, 139, 124, 146, 114, 134, 135, // 184-191
+131, 141, 123, 134, 134, 133, 146, 122, // 192-199
+136, 118, 122, 120, 117, 123, 119, 112, // 200-207
+114, 119, 136, 137, 135, 125, 131, 132, // 208-215
+124, 129, 134, 124, 128, 105, 113, 116, // 216-223
+123, 127, 127, 124, 114, 124, 124, 124, // 224-231
+125, 118, 126, 117, 128, 128, 136, 127, // 232-239
+135, 115, 122, 120, 115, 134, 119, 129, // 240-247
+134, 129, 140, 127, 125, 132, 118, 136, // 248-255
+126, 148, 129, 152, 142, 141, 130, 125, // 256-263
+123, 132, 123, 130, 123, 123, 122, 119, // 264-271
+124, 111, 113, 116, 114, 128, 117, 130, // 272-279
+121, 127, 123, 133, 132, 125, 131, 127, // 280-287
+135, 134, 133, 129, 128, 133, 128, 134, // 288-295
+128, 141, 131, 137, 125, 130, 120, 125, // 296-303
+129, 127, 132, 127, 123, 125, 123, 122, // 304-311
+120, 122, 117, 126, 120, 127, 116, 129, // 312-319
+115, 125, 119, 120, 126, 118, 129, 122, // 320-327
+129, 130, 124, 132, 135, 127, 137, 130, // 328-335
+140, 140, 135, 146, 138, 141, 142, 137, // 336-343
+141, 132, 126, 129, 119, 137, 128, 134, // 344-351
+143, 117, 145, 112, 119, 103, 109,  77, // 352-359
+110,  63, 103,  84,  90, 112,  92, 134, // 360-367
+114, 149, 127, 162, 142, 155, 151, 140, // 368-375
+156, 130, 147, 131, 132, 135, 124, 133, // 376-383
+129, 128, 140, 129, 153, 141, 160, 148, // 384-391
+163, 141, 159, 136, 163, 157, 178,  91, // 392-399
+180,  39, 152,  50,  84,  86,  46,  92, // 400-407
+ 65,  81,  97, 103, 107, 152, 108, 189, // 408-415
+129, 192, 157, 178, 163, 170, 145, 165, // 416-423
+118, 158,  82, 141,  83, 116,  99, 101, // 424-431
+117, 107, 123, 127, 126, 145, 131, 150, // 432-439
+142, 146, 153, 139, 155, 139, 143, 139, // 440-447
+130, 133, 133, 128, 161, 107, 148, 109, // 448-455
+ 99, 132,  67, 122,  82,  86, 106,  80, // 456-463
+105, 112,  97, 137, 118, 141, 152, 136, // 464-471
+173, 142, 167, 152, 158, 141, 160, 113, // 472-479
+138, 113,  99, 132,  77, 135,  92, 123, // 480-487
+124, 113, 143, 122, 144, 141, 137, 155, // 488-495
+137, 151, 146, 135, 147, 125, 141, 127, // 496-503
+134, 144, 131, 128, 137,  91, 137,  79, // 504-511
+110,  94,  83, 104,  86,  97, 111,  98, // 512-519
+128, 122, 131, 149, 137, 160, 153, 154, // 520-527
+165, 147, 158, 138, 134, 135, 102, 135, // 528-535
+ 91, 122, 106, 105, 126, 104, 135, 120, // 536-543
+134, 138, 134, 146, 141, 143, 149, 137, // 544-551
+152, 131, 145, 129, 140, 133, 156, 129, // 552-559
+135, 131,  88, 144,  58, 127,  69,  95, // 560-567
+ 94,  90,  93, 117,  89, 141, 108, 145, // 568-575
+143, 141, 165, 148, 160, 162, 145, 164, // 576-583
+130, 143, 113, 125, 108, 109, 114, 101, // 584-591
+122, 107, 126, 120, 129, 134, 135, 142, // 592-599
+142, 143, 146, 143, 145, 142, 134, 145, // 600-607
+126, 150, 125, 168, 107, 160,  94, 116, // 608-615
+118,  67, 130,  55, 113,  74, 101,  90, // 616-623
+120,  89, 154,  96, 170, 123, 165, 152, // 624-631
+156, 158, 159, 146, 162, 121, 145, 107, // 632-639
+125, 109, 104, 118,  99, 126, 108, 126, // 640-647
+125, 128, 139, 135, 143, 145, 139, 153, // 648-655
+137, 148, 139, 136, 143, 131, 146, 137, // 656-663
+159, 107, 164,  70, 145,  75,  96, 106, // 664-671
+ 61, 115,  69, 102,  97, 107, 110, 140, // 672-679
+110, 174, 118, 180, 145, 165, 163, 151, // 680-687
+159, 148, 143, 124, 120, 112, 103, 109, // 688-695
+100, 108, 110, 115, 121, 124, 130, 137, // 696-703
+136, 148, 140, 154, 143, 151, 144, 146, // 704-711
+137, 144, 130, 146, 131, 166, 104, 167, // 712-719
+ 75, 135,  91,  75, 125,  39, 129,  53, // 720-727
+110,  86, 114,  98, 149, 100, 181, 114, // 728-735
+184, 144, 168, 161, 160, 148, 168, 113, // 736-743
+172,  78, 136, 106,  75, 151,  48, 157, // 744-751
+ 81, 132, 126, 116, 148, 132, 139, 161, // 752-759
+123, 178, 123, 166, 137, 139, 148, 127, // 760-767
+145, 135, 149, 147, 112, 161,  48, 175, // 768-775
+ 17, 154,  42, 103,  84,  81,  98, 103, // 776-783
+ 98, 136, 117, 140, 160, 129, 191, 132, // 784-791
+186, 149, 161, 159, 144, 132, 136,  96, // 792-799
+125,  86, 112,  96, 108, 108, 118, 117, // 800-807
+134, 124, 150, 132, 157, 140, 157, 146, // 808-815
+153, 141, 149, 131, 148, 125, 149, 133, // 816-823
+167,  93, 179,  44, 163,  57,  96, 108, // 824-831
+ 40, 129,  50, 110,  94, 104, 118, 139, // 832-839
+115, 180, 120, 187, 151, 160, 180, 137, // 840-847
+176, 135, 141, 123, 119,  96, 118,  84, // 848-855
+112, 100, 103, 128, 101, 146, 116, 151, // 856-863
+136, 150, 146, 153, 142, 162, 130, 160, // 864-871
+121, 154, 123, 147, 128, 169, 108, 158, // 872-879
+ 91, 112, 113,  57, 129,  44, 110,  73, // 880-887
+ 88, 100, 102, 108, 139, 115, 161, 142, // 888-895
+156, 175, 145, 184, 146, 166, 149, 146, // 896-903
+129, 114, 123,  77, 135,  62, 131,  85, // 904-911
+119, 120, 118, 134, 138, 135, 159, 135, // 912-919
+163, 144, 151, 153, 137, 145, 137, 131, // 920-927
+143, 126, 155, 149, 105, 177,  32, 183, // 928-935
+ 31, 123,  90,  51, 134,  44, 122,  89, // 936-943
+107, 123, 133, 120, 178, 117, 193, 141, // 944-951
+168, 170, 143, 167, 142, 135, 150,  81, // 952-959
+146,  72, 104, 117,  61, 150,  74, 142, // 960-967
+121, 125, 154, 132, 150, 159, 133, 174, // 968-975
+127, 164, 139, 133, 148, 123, 139, 136, // 976-983
+133, 165, 100, 166,  70, 135,  90,  71, // 984-991
+129,  31, 135,  51, 109,  98, 101, 125, // 992-999
+128, 128, 161, 140, 165, 167, 150, 178, // 1000-1007
+143, 162, 147, 135, 142, 115,  94, 135, // 1008-1015
+ 52, 138,  67, 115, 109, 109, 131, 132, // 1016-1023
+128, 162, 126, 170, 140, 155, 156, 139, // 1024-1031
+158, 132, 136, 138, 121, 143, 120, 160, // 1032-1039
+133, 121, 154,  54, 172,  31, 134,  75, // 1040-1047
+ 67, 122,  52, 121,  90, 107, 129, 124, // 1048-1055
+137, 162, 135, 180, 151, 163, 172, 142, // 1056-1063
+167, 137, 137, 140, 108, 100, 125,  54, // 1064-1071
+137,  60, 123, 104, 115, 133, 134, 135, // 1072-1079
+161, 133, 168, 143, 153, 158, 136, 159, // 1080-1087
+127, 142, 129, 126, 135, 127, 154, 143, // 1088-1095
+108, 168,  45, 170,  46, 106, 104,  41, // 1096-1103
+137,  43, 119,  94, 103, 130, 127, 133, // 1104-1111
+162, 143, 167, 170, 149, 183, 142, 161, // 1112-1119
+149, 128, 141, 115, 102, 106,  97,  72, // 1120-1127
+130,  59, 142,  98, 130, 148, 125, 162, // 1128-1135
+143, 151, 158, 146, 153, 151, 137, 149, // 1136-1143
+123, 137, 127, 121, 144, 123, 178,  97, // 1144-1151
+167,  96,  95, 152,  17, 176,  17, 123, // 1152-1159
+ 89,  62, 137,  73, 132, 122, 131, 145, // 1160-1167
+159, 144, 176, 155, 157, 175, 134, 167, // 1168-1175
+129, 134, 131, 109, 109, 100,  89, 107, // 1176-1183
+ 77, 125,  89, 135, 123, 138, 149, 141, // 1184-1191
+155, 147, 153, 145, 153, 134, 155, 121, // 1192-1199
+145, 117, 136, 121, 139, 130, 170, 111, // 1200-1207
+149, 128,  71, 165,  29, 134,  72,  63, // 1208-1215
+125,  45, 125,  92, 112, 130, 132, 141, // 1216-1223
+160, 156, 160, 179, 147, 179, 148, 148, // 1224-1231
+150, 123, 130, 118, 100, 112,  76, 107, // 1232-1239
+ 85,  98, 119, 105, 142, 129, 149, 145, // 1240-1247
+155, 142, 165, 133, 160, 134, 148, 136, // 1248-1255
+129, 129, 126, 126, 132, 135, 156, 145, // 1256-1263
+118, 171,  50, 172,  51,  97, 115,  27, // 1264-1271
+138,  45, 108,  98, 103, 123, 131, 144, // 1272-1279
+144, 179, 141, 189, 157, 162, 174, 133, // 1280-1287
+160, 127, 126, 122, 107, 107,  84, 103, // 1288-1295
+ 79, 107,  91, 125, 113, 146, 134, 152, // 1296-1303
+150, 147, 157, 142, 154, 139, 149, 133, // 1304-1311
+142, 123, 132, 126, 127, 135, 139, 159, // 1312-1319
+138, 127, 159,  53, 168,  46,  97, 109, // 1320-1327
+ 28, 131,  50, 103, 102, 107, 126, 135, // 1328-1335
+154, 139, 190, 143, 186, 168, 152, 178, // 1336-1343
+132, 155, 124, 127, 109, 116,  93, 102, // 1344-1351
+ 83,  86, 112,  75, 146,  99, 155, 135, // 1352-1359
+159, 140, 167, 139, 153, 153, 131, 156, // 1360-1367
+129, 140, 125, 132, 119, 136, 122, 147, // 1368-1375
+144, 164, 105, 177,  72, 117, 127,  20, // 1376-1383
+151,  28,  93,  91,  66, 114,  97, 134, // 1384-1391
+113, 174, 133, 173, 183, 143, 202, 144, // 1392-1399
+172, 149, 142, 132, 121, 121,  96, 116, // 1400-1407
+ 94,  87, 116,  68, 109, 121,  90, 162, // 1408-1415
+123, 156, 151, 162, 136, 169, 134, 146, // 1416-1423
+146, 131, 138, 136, 124, 126, 133, 123, // 1424-1431
+132, 146, 137, 171, 123, 143, 130,  71, // 1432-1439
+144,  44, 100,  78,  59,  96,  69, 109, // 1440-1447
+ 88, 139, 118, 149, 167, 143, 191, 159, // 1448-1455
+176, 167, 160, 155, 137, 144, 106, 130, // 1456-1463
+ 95, 107,  98,  99,  93, 101,  92, 108, // 1464-1471
+124, 109, 161, 123, 169, 140, 165, 135, // 1472-1479
+161, 133, 143, 141, 129, 138, 128, 132, // 1480-1487
+119, 136, 120, 139, 138, 147, 154, 158, // 1488-1495
+116, 154,  85, 111,  96,  59, 102,  52, // 1496-1503
+ 93,  70,  98,  99, 110, 144, 122, 173, // 1504-1511
+152, 172, 177, 165, 180, 153, 168, 135, // 1512-1519
+142, 125, 110, 117,  92, 108,  90, 103, // 1520-1527
+ 99,  95, 111, 107, 124, 128, 143, 142, // 1528-1535
+156, 149, 152, 146, 146, 139, 136, 137, // 1536-1543
+126, 136, 125, 132, 125, 130, 131, 135, // 1544-1551
+136, 146, 144, 167, 126, 144, 122,  81, // 1552-1559
+124,  59,  88,  74,  71,  85,  76, 114, // 1560-1567
+ 88, 141, 128, 145, 169, 155, 183, 162, // 1568-1575
+183, 159, 161, 156, 129, 140, 111, 118, // 1576-1583
+100, 101,  99,  92, 109, 100, 115, 111, // 1584-1591
+124, 118, 133, 138, 138, 147, 148, 147, // 1592-1599
+145, 146, 132, 139, 129, 131, 126, 131, // 1600-1607
+128, 129, 134, 129, 137, 134, 140, 139, // 1608-1615
+147, 154, 146, 123, 134,  94,  93,  99, // 1616-1623
+ 67,  84,  76,  87,  79, 103, 112, 113, // 1624-1631
+142, 142, 156, 161, 170, 171, 163, 173, // 1632-1639
+152, 152, 140, 134, 120, 114, 112,  97, // 1640-1647
+106, 100, 102, 109, 111, 122, 119, 133, // 1648-1655
+121, 134, 137, 134, 142, 139, 146, 134, // 1656-1663
+146, 130, 133, 130, 130, 127, 127, 135, // 1664-1671
+125, 135, 131, 140, 130, 140, 135, 138, // 1672-1679
+140, 145, 149, 113, 138,  96, 100,  93, // 1680-1687
+ 84,  85,  76,  97,  82, 101, 111, 116, // 1688-1695
+134, 135, 158, 150, 166, 168, 162, 167, // 1696-1703
+153, 159, 136, 140, 127, 117, 115, 105, // 1704-1711
+107,  98, 108, 106, 110, 118, 120, 132, // 1712-1719
+124, 142, 125, 139, 136, 139, 137, 138, // 1720-1727
+142, 129, 142, 125, 132, 122, 132, 123, // 1728-1735
+128, 132, 130, 133, 134, 139, 131, 136, // 1736-1743
+134, 138, 132, 144, 142, 124, 124, 112, // 1744-1751
+101,  92,  93,  88,  84,  92,  97, 100, // 1752-1759
+110, 122, 131, 134, 151, 154, 157, 162, // 1760-1767
+163, 160, 152, 151, 143, 134, 127, 122, // 1768-1775
+114, 108, 109, 107, 107, 110, 113, 118, // 1776-1783
+121, 129, 132, 137, 133, 142, 123, 139, // 1784-1791
+128, 134, 128, 132, 134, 125, 134, 124, // 1792-1799
+132, 118, 136, 124, 133, 130, 138, 133, // 1800-1807
+136, 136, 135, 134, 129, 135, 129, 133, // 1808-1815
+138, 132, 121, 121, 106, 107,  94,  99, // 1816-1823
+ 92,  93,  97,  99, 109, 111, 125, 130, // 1824-1831
+138, 147, 150, 158, 157, 159, 156, 153, // 1832-1839
+149, 141, 136, 127, 122, 117, 112, 112, // 1840-1847
+108, 111, 110, 115, 117, 122, 126, 131, // 1848-1855
+134, 138, 135, 133, 123, 133, 129, 125, // 1856-1863
+126, 129, 133, 124, 133, 127, 133, 125, // 1864-1871
+135, 131, 133, 135, 138, 136, 132, 135, // 1872-1879
+129, 132, 122, 129, 123, 131, 126, 130, // 1880-1887
+131, 123, 123, 110, 111, 102, 104,  99, // 1888-1895
+ 99, 103, 104, 110, 116, 121, 132, 133, // 1896-1903
+145, 146, 153, 152, 154, 154, 150, 149, // 1904-1911
+139, 138, 129, 124, 119, 115, 114, 111, // 1912-1919
+113, 113, 116, 118, 121, 125, 128, 132, // 1920-1927
+134, 137, 139, 134, 129, 126, 128, 126, // 1928-1935
+122, 126, 126, 129, 125, 130, 128, 132, // 1936-1943
+128, 134, 133, 134, 136, 134, 137, 131, // 1944-1951
+130, 129, 127, 126, 123, 124, 126, 124, // 1952-1959
+125, 130, 127, 126, 120, 118, 110, 110, // 1960-1967
+108, 105, 107, 106, 111, 112, 118, 125, // 1968-1975
+129, 136, 139, 146, 147, 151, 151, 151, // 1976-1983
+149, 144, 142, 134, 131, 125, 121, 118, // 1984-1991
+115, 114, 114, 115, 117, 118, 123, 125, // 1992-1999
+129, 130, 133, 135, 136, 137, 138, 130, // 2000-2007
+125, 119, 122, 121, 119, 119, 123, 129, // 2008-2015
+126, 131, 130, 138, 133, 137, 135, 136, // 2016-2023
+134, 132, 134, 130, 128, 121, 122, 120, // 2024-2031
+124, 121, 125, 125, 130, 132, 131, 130, // 2032-2039
+126, 124, 120, 113, 113, 110, 108, 106, // 2040-2047
+109, 111, 115, 117, 124, 129, 134, 138, // 2048-2055
+144, 148, 148, 150, 149, 146, 144, 137, // 2056-2063
+134, 129, 124, 120, 117, 117, 116, 115, // 2064-2071
+117, 118, 121, 122, 126, 128, 132, 132, // 2072-2079
+135, 135, 137, 135, 136, 132, 122, 117, // 2080-2087
+116, 119, 117, 115, 120, 128, 132, 129, // 2088-2095
+133, 138, 139, 137, 133, 135, 133, 133, // 2096-2103
+127, 130, 125, 125, 119, 121, 123, 127, // 2104-2111
+124, 125, 131, 132, 133, 128, 130, 128, // 2112-2119
+124, 115, 113, 113, 110, 107, 105, 111, // 2120-2127
+115, 114, 119, 124, 133, 135, 139, 144, // 2128-2135
+147, 149, 147, 147, 145, 142, 135, 132, // 2136-2143
+129, 123, 120, 117, 117, 118, 117, 117, // 2144-2151
+119, 123, 125, 125, 129, 130, 133, 132, // 2152-2159
+134, 133, 135, 132, 132, 130, 127, 114, // 2160-2167
+109, 116, 118, 120, 115, 127, 131, 139, // 2168-2175
+132, 138, 140, 143, 137, 131, 134, 132, // 2176-2183
+130, 123, 124, 125, 124, 118, 123, 125, // 2184-2191
+129, 126, 128, 132, 133, 132, 127, 129, // 2192-2199
+126, 121, 113, 112, 110, 111, 105, 106, // 2200-2207
+111, 115, 117, 121, 127, 133, 139, 141, // 2208-2215
+144, 149, 150, 149, 146, 145, 141, 136, // 2216-2223
+128, 126, 122, 120, 116, 115, 115, 117, // 2224-2231
+119, 119, 123, 125, 129, 130, 132, 134, // 2232-2239
+135, 135, 134, 134, 133, 132, 129, 128, // 2240-2247
+125, 113, 106, 110, 117, 119, 115, 123, // 2248-2255
+130, 140, 137, 136, 141, 144, 142, 131, // 2256-2263
+131, 132, 132, 125, 122, 122, 125, 121, // 2264-2271
+121, 123, 130, 132, 131, 131, 131, 135, // 2272-2279
+130, 128, 122, 123, 115, 111, 107, 108, // 2280-2287
+109, 107, 109, 111, 119, 124, 127, 131, // 2288-2295
+138, 143, 146, 147, 147, 148, 147, 143, // 2296-2303
+139, 136, 131, 127, 121, 120, 117, 118, // 2304-2311
+115, 117, 119, 120, 122, 125, 127, 130, // 2312-2319
+131, 134, 133, 136, 134, 135, 132, 131, // 2320-2327
+129, 128, 125, 126, 120, 110, 106, 109, // 2328-2335
+117, 120, 120, 124, 133, 140, 141, 137, // 2336-2343
+141, 143, 142, 136, 129, 129, 131, 128, // 2344-2351
+122, 120, 122, 125, 125, 125, 127, 131, // 2352-2359
+133, 131, 130, 129, 130, 128, 123, 119, // 2360-2367
+113, 112, 108, 109, 106, 108, 110, 115, // 2368-2375
+120, 124, 128, 134, 140, 143, 145, 147, // 2376-2383
+148, 148, 146, 141, 138, 133, 131, 125, // 2384-2391
+122, 119, 118, 116, 116, 117, 119, 121, // 2392-2399
+124, 124, 129, 129, 132, 134, 134, 135, // 2400-2407
+134, 135, 132, 131, 129, 127, 125, 125, // 2408-2415
+123, 119, 106, 108, 109, 121, 120, 122, // 2416-2423
+125, 134, 143, 141, 141, 137, 143, 141, // 2424-2431
+138, 128, 124, 127, 126, 125, 117, 119, // 2432-2439
+121, 128, 127, 128, 129, 133, 135, 134, // 2440-2447
+131, 129, 129, 128, 122, 113, 110, 108, // 2448-2455
+110, 108, 107, 107, 113, 119, 125, 126, // 2456-2463
+131, 138, 143, 147, 146, 147, 146, 147, // 2464-2471
+144, 139, 134, 131, 129, 125, 122, 117, // 2472-2479
+118, 118, 119, 118, 119, 122, 124, 128, // 2480-2487
+129, 130, 131, 133, 135, 133, 134, 131, // 2488-2495
+132, 129, 129, 127, 124, 126, 123, 113, // 2496-2503
+106, 109, 117, 122, 123, 123, 127, 138, // 2504-2511
+141, 141, 137, 138, 141, 141, 137, 128, // 2512-2519
+126, 124, 127, 122, 120, 117, 122, 127, // 2520-2527
+129, 129, 129, 132, 135, 135, 131, 129, // 2528-2535
+127, 125, 119, 113, 108, 107, 110, 109, // 2536-2543
+110, 109, 115, 121, 127, 131, 134, 139, // 2544-2551
+144, 146, 148, 146, 146, 144, 142, 137, // 2552-2559
+133, 128, 125, 123, 119, 118, 116, 116, // 2560-2567
+117, 119, 121, 123, 124, 129, 130, 131, // 2568-2575
+133, 135, 134, 135, 133, 133, 131, 130, // 2576-2583
+128, 127, 124, 124, 123, 116, 111, 108, // 2584-2591
+112, 120, 123, 126, 125, 132, 138, 141, // 2592-2599
+139, 136, 137, 138, 140, 134, 130, 124, // 2600-2607
+126, 125, 124, 120, 121, 122, 127, 130, // 2608-2615
+130, 131, 130, 132, 133, 131, 129, 125, // 2616-2623
+122, 117, 113, 111, 109, 110, 110, 111, // 2624-2631
+113, 117, 123, 127, 132, 136, 138, 143, // 2632-2639
+144, 147, 145, 144, 140, 140, 137, 132, // 2640-2647
+129, 124, 123, 119, 119, 117, 117, 117, // 2648-2655
+120, 121, 124, 125, 128, 129, 132, 132, // 2656-2663
+135, 133, 134, 134, 132, 132, 129, 127, // 2664-2671
+126, 124, 124, 123, 121, 114, 111, 111, // 2672-2679
+118, 122, 124, 126, 127, 134, 137, 141, // 2680-2687
+136, 137, 137, 138, 137, 133, 129, 125, // 2688-2695
+125, 125, 124, 122, 120, 122, 124, 128, // 2696-2703
+128, 129, 129, 129, 132, 131, 131, 128, // 2704-2711
+127, 123, 118, 114, 111, 113, 114, 114, // 2712-2719
+114, 115, 118, 124, 128, 131, 134, 136, // 2720-2727
+140, 142, 144, 142, 142, 139, 138, 136, // 2728-2735
+132, 130, 125, 124, 121, 122, 119, 119, // 2736-2743
+119, 121, 123, 123, 126, 127, 128, 130, // 2744-2751
+131, 133, 132, 133, 131, 131, 131, 128, // 2752-2759
+129, 125, 126, 124, 126, 120, 115, 113, // 2760-2767
+113, 121, 122, 127, 123, 128, 132, 135, // 2768-2775
+140, 136, 138, 135, 138, 135, 134, 129, // 2776-2783
+126, 125, 124, 125, 122, 123, 122, 124, // 2784-2791
+125, 128, 129, 127, 128, 127, 129, 130, // 2792-2799
+129, 130, 129, 126, 122, 117, 115, 117, // 2800-2807
+118, 118, 116, 116, 117, 122, 125, 130, // 2808-2815
+130, 132, 136, 138, 140, 142, 140, 139, // 2816-2823
+138, 136, 134, 133, 128, 126, 123, 123, // 2824-2831
+122, 122, 120, 121, 120, 123, 123, 126, // 2832-2839
+126, 127, 128, 130, 130, 131, 131, 131, // 2840-2847
+131, 130, 129, 128, 127, 127, 124, 126, // 2848-2855
+122, 118, 115, 116, 120, 124, 126, 126, // 2856-2863
+127, 131, 133, 138, 137, 138, 135, 134, // 2864-2871
+133, 131, 131, 126, 126, 122, 124, 123, // 2872-2879
+124, 123, 124, 124, 126, 128, 127, 128, // 2880-2887
+127, 126, 127, 127, 127, 129, 129, 131, // 2888-2895
+125, 124, 117, 119, 119, 121, 121, 118, // 2896-2903
+120, 121, 124, 128, 129, 133, 132, 134, // 2904-2911
+137, 138, 140, 137, 137, 132, 133, 133, // 2912-2919
+129, 129, 124, 125, 122, 122, 123, 121, // 2920-2927
+123, 122, 124, 125, 125, 127, 126, 129, // 2928-2935
+128, 128, 130, 128, 129, 129, 128, 128, // 2936-2943
+128, 127, 127, 127, 125, 125, 121, 120, // 2944-2951
+119, 121, 124, 125, 128, 128, 129, 131, // 2952-2959
+133, 136, 136, 136, 133, 132, 131, 130, // 2960-2967
+129, 125, 124, 124, 123, 123, 124, 124, // 2968-2975
+123, 125, 124, 126, 125, 127, 125, 127, // 2976-2983
+127, 127, 126, 127, 126, 128, 128, 128, // 2984-2991
+126, 125, 123, 122, 124, 124, 124, 125, // 2992-2999
+124, 126, 126, 129, 130, 132, 132, 131, // 3000-3007
+133, 133, 134, 133, 132, 131, 129, 129, // 3008-3015
+127, 127, 126, 123, 125, 124, 123, 125, // 3016-3023
+124, 126, 124, 125, 126, 126, 127, 127, // 3024-3031
+128, 129, 128, 129, 126, 124, 122, 121, // 3032-3039
+124, 126, 129, 128, 127, 128, 129, 132, // 3040-3047
+132, 135, 132, 132, 130, 131, 130, 129, // 3048-3055
+127, 126, 125, 124, 124, 125, 125, 125, // 3056-3063
+124, 125, 127, 128, 131, 130, 128, 125, // 3064-3071
+121, 122, 122, 122, 122, 120, 121, 121, // 3072-3079
+123, 124, 128, 130, 130, 132, 132, 135, // 3080-3087
+136, 137, 137, 134, 134, 131, 132, 131, // 3088-3095
+129, 126, 124, 123, 124, 123, 124, 122, // 3096-3103
+123, 122, 124, 125, 126, 128, 128, 128, // 3104-3111
+129, 128, 130, 129, 130, 128, 128, 127, // 3112-3119
+127, 127, 127, 127, 125, 126, 125, 126, // 3120-3127
+126, 125, 126, 127, 127, 127, 127, 128, // 3128-3135
+128, 128, 128, 129, 129, 129, 129, 128, // 3136-3143
+129, 128, 128, 128, 125, 122, 122, 122, // 3144-3151
+125, 127, 127, 128, 126, 128, 130, 131, // 3152-3159
+133, 132, 132, 130, 130, 130, 128, 128, // 3160-3167
+125, 125, 123, 124, 123, 125, 125, 124, // 3168-3175
+125, 125, 127, 127, 128, 127, 128, 127, // 3176-3183
+128, 127, 128, 127, 126, 126, 125, 126, // 3184-3191
+125, 125, 125, 124, 124, 125, 126, 128, // 3192-3199
+128, 128, 130, 130, 131, 130, 132, 131, // 3200-3207
+132, 130, 131, 129, 129, 127, 128, 126, // 3208-3215
+126, 125, 126, 125, 126, 126, 127, 126, // 3216-3223
+127, 126, 127, 126, 127, 126, 127, 127, // 3224-3231
+125, 127, 125, 126, 126, 127, 127, 125, // 3232-3239
+127, 126, 128, 127, 127, 127, 126, 127, // 3240-3247
+126, 127, 126, 127, 126, 127, 126, 127, // 3248-3255
+126, 128, 127, 128, 128, 127, 129, 128, // 3256-3263
+129, 129, 128, 129, 129, 129, 129, 128, // 3264-3271
+129, 129, 129, 129, 128, 127, 127, 126, // 3272-3279
+127, 126, 126, 125, 126, 125, 126, 125, // 3280-3287
+126, 127, 126, 127, 126, 127, 126, 127, // 3288-3295
+128, 127, 128, 126, 127, 126, 128, 127, // 3296-3303
+128, 127, 126, 127, 126, 127, 126, 127, // 3304-3311
+126, 127, 126, 127, 126, 127, 127, 128};// 3312-3319
+
+#define PEW_NO_AMMO_N 2681
+
+const uint8_t pewNoAmmo[PEW_NO_AMMO_N] = {
+127, 128, 128, 127, 127, 127, 127, 127, // 0-7
+128, 127, 128, 128, 128, 127, 127, 127, // 8-15
+127, 128, 128, 129, 127, 129, 126, 132, // 16-23
+107, 104, 150, 150, 123, 115, 133, 136, // 24-31
+124, 124, 131, 131, 126, 124, 130, 129, // 32-39
+129, 127, 127, 126, 129, 128, 129, 127, // 40-47
+132, 131, 138, 133, 137, 126, 136,  73, // 48-55
+131, 186, 137, 108, 106, 148, 127, 125, // 56-63
+119, 136, 119, 121, 117, 127, 119, 127, // 64-71
+125, 130, 100,  28, 113, 216, 187,  97, // 72-79
+ 89, 133, 161, 142, 134, 120, 113, 122, // 80-87
+136, 150, 140, 131, 107, 112, 124, 156, // 88-95
+160, 162, 151, 155, 152, 155, 130, 102, // 96-103
+101,  91, 101, 114, 140, 162, 152, 125, // 104-111
+112,  99,  96, 114, 122, 137, 120, 104, // 112-119
+ 96, 118, 139, 136, 122, 124, 140, 133, // 120-127
+108,  73,  95, 128, 168, 171, 146, 129, // 128-135
+141, 166, 157, 125,  90,  91,  95,  94, // 136-143
+ 97, 120, 153, 179, 158, 142, 140, 130, // 144-151
+125, 120, 117, 122, 133, 110, 103, 113, // 152-159
+124, 130, 144, 148, 137, 123, 114, 109, // 160-167
+112, 124, 153, 177, 191, 197, 195, 162, // 168-175
+115,  75,  68,  72,  94, 118, 143, 162, // 176-183
+168, 176, 172, 164, 150, 132, 108,  81, // 184-191
+ 66,  66,  79,  91, 101, 114, 130, 133, // 192-199
+124, 113, 123, 125, 126, 127, 119, 106, // 200-207
+ 95, 102, 125, 145, 160, 169, 172, 167, // 208-215
+157, 142, 132, 127, 126, 136, 135, 115, // 216-223
+ 88,  64,  62,  62,  76, 101, 111, 129, // 224-231
+133, 137, 153, 180, 194, 191, 176, 159, // 232-239
+151, 154, 156, 149, 146, 145, 130, 126, // 240-247
+133, 140, 130, 120, 115, 117, 115, 104, // 248-255
+ 99, 102,  99,  98,  97,  96, 117, 131, // 256-263
+139, 131, 123, 115, 120, 137, 153, 156, // 264-271
+150, 150, 139, 134, 128, 130, 125, 126, // 272-279
+118, 113, 116, 118, 108,  98,  96,  98, // 280-287
+101, 111, 123, 120, 120, 115, 116, 121, // 288-295
+128, 143, 163, 165, 162, 158, 143, 130, // 296-303
+131, 139, 140, 145, 144, 143, 135, 118, // 304-311
+111, 120, 133, 139, 143, 146, 144, 132, // 312-319
+125, 125, 126, 124, 121, 109,  97, 101, // 320-327
+109, 114, 117, 110, 110, 119, 127, 132, // 328-335
+130, 133, 142, 143, 131, 126, 131, 133, // 336-343
+132, 124, 117, 113, 116, 121, 133, 138, // 344-351
+139, 136, 139, 140, 136, 136, 135, 139, // 352-359
+131, 118, 111, 110, 112, 118, 121, 125, // 360-367
+125, 120, 121, 127, 138, 143, 148, 149, // 368-375
+146, 144, 137, 122, 113, 114, 116, 116, // 376-383
+113, 111, 117, 120, 126, 133, 141, 139, // 384-391
+136, 128, 123, 126, 128, 128, 124, 123, // 392-399
+121, 122, 124, 126, 120, 121, 120, 119, // 400-407
+122, 132, 140, 138, 132, 136, 140, 142, // 408-415
+145, 137, 130, 124, 131, 134, 137, 132, // 416-423
+131, 125, 119, 118, 125, 131, 131, 128, // 424-431
+124, 125, 124, 127, 129, 136, 124, 120, // 432-439
+122, 128, 127, 131, 131, 135, 129, 122, // 440-447
+121, 120, 122, 122, 123, 117, 118, 117, // 448-455
+123, 124, 126, 120, 121, 118, 120, 117, // 456-463
+126, 133, 134, 134, 131, 131, 133, 135, // 464-471
+131, 135, 137, 143, 141, 137, 132, 121, // 472-479
+115, 123, 122, 123, 132, 132, 132, 133, // 480-487
+132, 132, 133, 133, 136, 138, 135, 131, // 488-495
+127, 124, 127, 122, 122, 120, 119, 117, // 496-503
+122, 125, 126, 130, 132, 134, 135, 134, // 504-511
+127, 122, 118, 122, 125, 128, 123, 121, // 512-519
+118, 122, 123, 124, 126, 127, 127, 135, // 520-527
+138, 136, 129, 127, 127, 122, 125, 126, // 528-535
+131, 126, 123, 124, 127, 123, 126, 134, // 536-543
+138, 138, 129, 123, 122, 126, 124, 128, // 544-551
+131, 131, 125, 123, 120, 120, 122, 126, // 552-559
+130, 131, 135, 139, 141, 138, 135, 130, // 560-567
+130, 130, 130, 130, 125, 121, 122, 123, // 568-575
+127, 134, 132, 129, 127, 125, 126, 124, // 576-583
+121, 123, 123, 120, 120, 118, 122, 125, // 584-591
+125, 122, 125, 128, 133, 133, 129, 128, // 592-599
+128, 130, 130, 128, 127, 127, 125, 126, // 600-607
+126, 127, 126, 128, 129, 131, 128, 132, // 608-615
+135, 136, 134, 135, 135, 134, 129, 121, // 616-623
+122, 126, 132, 134, 131, 126, 124, 121, // 624-631
+122, 124, 126, 129, 128, 123, 124, 125, // 632-639
+127, 130, 131, 128, 123, 123, 124, 125, // 640-647
+125, 127, 126, 126, 127, 129, 129, 128, // 648-655
+127, 124, 123, 127, 127, 123, 123, 125, // 656-663
+125, 124, 126, 125, 125, 122, 124, 133, // 664-671
+135, 131, 132, 132, 132, 131, 129, 131, // 672-679
+133, 131, 129, 131, 129, 129, 131, 132, // 680-687
+130, 130, 131, 133, 130, 130, 133, 130, // 688-695
+127, 127, 127, 127, 129, 128, 128, 128, // 696-703
+126, 126, 131, 131, 133, 131, 131, 130, // 704-711
+130, 130, 131, 126, 123, 120, 115, 116, // 712-719
+115, 115, 114, 117, 115, 115, 116, 122, // 720-727
+125, 130, 131, 129, 126, 118, 117, 112, // 728-735
+111, 104, 101,  97, 102, 107, 115, 121, // 736-743
+125, 131, 136, 149, 157, 167, 168, 168, // 744-751
+161, 157, 154, 150, 147, 144, 139, 135, // 752-759
+134, 135, 139, 142, 143, 140, 138, 136, // 760-767
+138, 139, 143, 140, 141, 141, 139, 141, // 768-775
+143, 143, 135, 134, 120, 125, 121, 117, // 776-783
+102,  87,  66,  53,  50,  45,  54,  54, // 784-791
+ 48,  45,  47,  40,  50,  75,  96, 128, // 792-799
+159, 179, 201, 220, 229, 237, 240, 225, // 800-807
+208, 187, 163, 141, 123,  96,  62,  38, // 808-815
+ 25,  30,  68,  97, 138, 162, 182, 192, // 816-823
+214, 215, 219, 207, 187, 167, 148, 131, // 824-831
+113, 103,  85,  83,  83,  99, 113, 132, // 832-839
+144, 160, 172, 185, 193, 184, 173, 156, // 840-847
+141, 133, 127, 113, 108,  91,  81,  63, // 848-855
+ 48,  29,  14,   5,   8,  25,  38,  53, // 856-863
+ 49,  71,  89, 136, 174, 214, 227, 236, // 864-871
+234, 235, 237, 226, 208, 173, 140, 102, // 872-879
+ 89,  76,  81,  80,  79,  73,  73,  62, // 880-887
+ 86, 127, 162, 197, 209, 200, 188, 183, // 888-895
+173, 176, 159, 133, 105,  85,  84, 105, // 896-903
+121, 122, 119, 108, 114, 137, 164, 179, // 904-911
+183, 165, 154, 152, 155, 161, 152, 128, // 912-919
+103,  93, 100, 117, 133, 137, 120,  94, // 920-927
+ 69,  34,  24,  15,  14,  18,  24,  25, // 928-935
+ 38,  63,  93, 136, 173, 203, 221, 235, // 936-943
+242, 251, 248, 232, 207, 176, 141, 118, // 944-951
+100,  81,  73,  64,  67,  76,  89,  93, // 952-959
+105, 101, 121, 161, 187, 213, 212, 197, // 960-967
+166, 163, 146, 154, 136, 118,  89,  77, // 968-975
+ 79, 104, 129, 135, 137, 124, 131, 140, // 976-983
+169, 180, 185, 163, 151, 137, 140, 143, // 984-991
+145, 127, 113, 103, 107, 124, 137, 140, // 992-999
+117,  83,  34,  17,   2,  12,  22,  27, // 1000-1007
+ 27,  28,  51,  80, 136, 173, 210, 220, // 1008-1015
+234, 233, 245, 251, 239, 217, 179, 145, // 1016-1023
+114, 103,  88,  78,  63,  54,  57,  85, // 1024-1031
+107, 129, 139, 125, 106, 145, 161, 205, // 1032-1039
+219, 206, 163, 144, 118, 128, 143, 132, // 1040-1047
+124,  96,  77,  74, 111, 123, 154, 147, // 1048-1055
+142, 126, 142, 146, 172, 169, 159, 143, // 1056-1063
+134, 130, 140, 144, 126, 120, 109, 114, // 1064-1071
+128, 147, 136, 120,  78,  35,  13,   7, // 1072-1079
+ 14,  28,  31,  25,  33,  54,  89, 141, // 1080-1087
+184, 211, 225, 232, 232, 241, 247, 235, // 1088-1095
+213, 179, 141, 115, 101,  88,  82,  69, // 1096-1103
+ 58,  60,  79, 102, 128, 138, 129, 124, // 1104-1111
+132, 162, 185, 210, 197, 176, 144, 131, // 1112-1119
+123, 134, 134, 124, 109,  91,  88,  96, // 1120-1127
+117, 124, 143, 138, 144, 141, 150, 152, // 1128-1135
+159, 151, 147, 143, 141, 145, 144, 143, // 1136-1143
+131, 130, 122, 132, 136, 147, 130, 107, // 1144-1151
+ 52,  23,   9,   4,  21,  30,  35,  25, // 1152-1159
+ 46,  61, 115, 158, 203, 219, 232, 229, // 1160-1167
+236, 244, 239, 229, 198, 163, 122, 105, // 1168-1175
+ 86,  83,  76,  68,  58,  63,  78, 107, // 1176-1183
+134, 150, 154, 147, 138, 149, 165, 180, // 1184-1191
+185, 171, 146, 125, 114, 116, 125, 124, // 1192-1199
+118, 109, 104, 108, 124, 129, 135, 132, // 1200-1207
+128, 131, 145, 149, 152, 145, 130, 122, // 1208-1215
+126, 137, 147, 157, 149, 138, 126, 125, // 1216-1223
+133, 147, 152, 137, 120,  76,  45,  27, // 1224-1231
+ 25,  25,  36,  38,  30,  38,  56,  89, // 1232-1239
+128, 170, 192, 209, 215, 223, 236, 241, // 1240-1247
+231, 215, 185, 149, 127, 110,  97,  88, // 1248-1255
+ 80,  68,  65,  70,  87, 114, 134, 144, // 1256-1263
+145, 138, 126, 148, 164, 180, 186, 171, // 1264-1271
+142, 127, 119, 122, 138, 130, 123, 107, // 1272-1279
+102, 104, 128, 136, 142, 130, 119, 114, // 1280-1287
+126, 140, 155, 157, 138, 125, 119, 127, // 1288-1295
+145, 164, 159, 154, 133, 124, 130, 146, // 1296-1303
+152, 152, 122,  72,  36,  13,  13,  24, // 1304-1311
+ 41,  38,  35,  36,  54,  91, 136, 177, // 1312-1319
+202, 216, 216, 225, 234, 240, 234, 218, // 1320-1327
+184, 148, 120, 102,  92,  88,  81,  71, // 1328-1335
+ 65,  67,  82, 109, 133, 150, 153, 147, // 1336-1343
+135, 140, 156, 170, 181, 170, 148, 122, // 1344-1351
+112, 108, 124, 128, 128, 117, 109, 106, // 1352-1359
+120, 137, 147, 149, 136, 125, 118, 124, // 1360-1367
+134, 147, 142, 135, 121, 116, 120, 137, // 1368-1375
+152, 162, 156, 149, 141, 138, 149, 149, // 1376-1383
+147, 115,  80,  43,  24,  14,  25,  35, // 1384-1391
+ 37,  35,  40,  56,  83, 131, 168, 201, // 1392-1399
+214, 223, 222, 233, 234, 235, 222, 191, // 1400-1407
+156, 125, 103,  88,  87,  79,  73,  64, // 1408-1415
+ 67,  73,  99, 121, 147, 157, 158, 153, // 1416-1423
+151, 150, 156, 167, 161, 155, 135, 121, // 1424-1431
+108, 112, 112, 124, 122, 122, 119, 122, // 1432-1439
+128, 139, 148, 145, 139, 126, 121, 119, // 1440-1447
+127, 132, 135, 129, 123, 118, 122, 134, // 1448-1455
+147, 157, 158, 154, 146, 145, 146, 148, // 1456-1463
+141, 123,  91,  58,  31,  17,  21,  27, // 1464-1471
+ 35,  36,  42,  53,  80, 119, 158, 195, // 1472-1479
+215, 226, 227, 231, 231, 233, 222, 200, // 1480-1487
+170, 137, 108,  90,  82,  75,  73,  68, // 1488-1495
+ 66,  72,  89, 110, 136, 155, 161, 160, // 1496-1503
+153, 143, 151, 159, 164, 164, 149, 127, // 1504-1511
+112, 107, 109, 123, 127, 128, 122, 119, // 1512-1519
+118, 130, 139, 146, 145, 136, 125, 118, // 1520-1527
+117, 120, 128, 128, 129, 129, 131, 135, // 1528-1535
+142, 147, 151, 153, 151, 151, 150, 146, // 1536-1543
+136, 122,  97,  73,  53,  39,  33,  33, // 1544-1551
+ 36,  37,  46,  58,  80, 107, 139, 166, // 1552-1559
+191, 206, 217, 223, 227, 223, 217, 201, // 1560-1567
+178, 155, 131, 111,  97,  88,  78,  74, // 1568-1575
+ 69,  73,  85, 102, 123, 141, 149, 148, // 1576-1583
+146, 139, 146, 155, 163, 162, 155, 136, // 1584-1591
+123, 116, 119, 126, 130, 129, 122, 119, // 1592-1599
+117, 128, 136, 144, 141, 135, 122, 119, // 1600-1607
+117, 123, 127, 127, 124, 122, 124, 132, // 1608-1615
+145, 151, 154, 149, 144, 142, 145, 150, // 1616-1623
+148, 136, 115,  85,  61,  45,  41,  44, // 1624-1631
+ 48,  49,  47,  52,  65,  89, 121, 152, // 1632-1639
+176, 191, 200, 206, 213, 219, 219, 211, // 1640-1647
+192, 169, 144, 124, 110, 102,  93,  86, // 1648-1655
+ 77,  73,  78,  90, 107, 131, 142, 145, // 1656-1663
+144, 137, 131, 148, 154, 166, 166, 154, // 1664-1671
+133, 123, 115, 121, 132, 133, 132, 122, // 1672-1679
+116, 114, 128, 134, 145, 140, 131, 119, // 1680-1687
+117, 116, 126, 132, 130, 129, 124, 125, // 1688-1695
+134, 146, 152, 156, 150, 143, 139, 141, // 1696-1703
+143, 141, 130, 105,  76,  53,  39,  39, // 1704-1711
+ 46,  52,  53,  54,  59,  75, 103, 135, // 1712-1719
+165, 186, 197, 202, 207, 212, 217, 216, // 1720-1727
+204, 184, 158, 134, 116, 107,  99,  94, // 1728-1735
+ 87,  77,  75,  81,  94, 114, 134, 138, // 1736-1743
+141, 134, 126, 137, 149, 160, 170, 166, // 1744-1751
+146, 135, 122, 122, 131, 136, 135, 131, // 1752-1759
+119, 112, 118, 123, 132, 137, 133, 122, // 1760-1767
+119, 114, 121, 130, 133, 134, 133, 128, // 1768-1775
+132, 142, 146, 155, 154, 144, 138, 136, // 1776-1783
+133, 137, 131, 116,  92,  68,  46,  42, // 1784-1791
+ 45,  53,  60,  62,  64,  73,  90, 116, // 1792-1799
+148, 172, 190, 195, 199, 198, 204, 206, // 1800-1807
+204, 192, 174, 148, 127, 113, 105, 102, // 1808-1815
+ 99,  92,  85,  83,  89,  99, 121, 133, // 1816-1823
+138, 137, 130, 120, 132, 142, 156, 169, // 1824-1831
+162, 149, 135, 125, 121, 135, 137, 144, // 1832-1839
+137, 128, 116, 119, 118, 127, 132, 128, // 1840-1847
+122, 118, 113, 117, 126, 129, 136, 136, // 1848-1855
+136, 138, 145, 144, 151, 146, 142, 138, // 1856-1863
+137, 133, 133, 123, 104,  83,  61,  49, // 1864-1871
+ 47,  53,  58,  67,  66,  72,  82, 101, // 1872-1879
+125, 153, 172, 184, 190, 192, 197, 201, // 1880-1887
+202, 196, 186, 164, 146, 129, 118, 111, // 1888-1895
+106,  98,  90,  87,  86,  96, 108, 117, // 1896-1903
+122, 123, 115, 122, 132, 149, 166, 175, // 1904-1911
+168, 158, 143, 133, 136, 140, 145, 143, // 1912-1919
+134, 118, 112, 106, 111, 118, 125, 121, // 1920-1927
+120, 114, 115, 122, 130, 138, 144, 141, // 1928-1935
+138, 139, 137, 143, 147, 146, 141, 136, // 1936-1943
+127, 125, 124, 120, 112,  95,  77,  61, // 1944-1951
+ 56,  57,  68,  77,  82,  84,  87,  94, // 1952-1959
+108, 131, 152, 171, 181, 187, 186, 188, // 1960-1967
+189, 190, 187, 180, 165, 149, 134, 119, // 1968-1975
+110, 104,  99,  96,  97,  94,  92,  95, // 1976-1983
+ 94,  96, 112, 121, 140, 156, 166, 167, // 1984-1991
+170, 160, 158, 158, 156, 154, 151, 138, // 1992-1999
+127, 119, 108, 106, 106, 106, 105, 109, // 2000-2007
+108, 117, 125, 132, 140, 146, 144, 146, // 2008-2015
+145, 144, 147, 147, 143, 139, 132, 122, // 2016-2023
+118, 113, 108, 105,  97,  84,  74,  67, // 2024-2031
+ 65,  70,  78,  86,  91,  97, 101, 110, // 2032-2039
+123, 140, 155, 170, 177, 181, 182, 180, // 2040-2047
+179, 178, 175, 167, 158, 143, 129, 117, // 2048-2055
+110, 105, 106, 104, 100,  95,  89,  89, // 2056-2063
+ 99, 112, 129, 146, 155, 159, 160, 158, // 2064-2071
+158, 162, 163, 163, 157, 145, 132, 121, // 2072-2079
+112, 108, 107, 106, 105, 105, 104, 108, // 2080-2087
+117, 126, 137, 144, 148, 148, 147, 145, // 2088-2095
+147, 146, 146, 144, 138, 130, 123, 115, // 2096-2103
+109, 106, 101,  98,  92,  85,  80,  77, // 2104-2111
+ 77,  81,  87,  91,  96, 100, 105, 113, // 2112-2119
+124, 137, 147, 158, 164, 169, 171, 173, // 2120-2127
+173, 173, 168, 163, 154, 144, 135, 128, // 2128-2135
+123, 119, 114, 108, 101,  95,  97, 103, // 2136-2143
+116, 130, 143, 150, 154, 154, 154, 156, // 2144-2151
+158, 160, 160, 154, 144, 133, 120, 110, // 2152-2159
+105, 102, 101, 103, 104, 107, 112, 118, // 2160-2167
+125, 134, 140, 146, 149, 149, 148, 147, // 2168-2175
+144, 142, 139, 133, 126, 119, 110, 103, // 2176-2183
+100,  96,  95,  93,  91,  88,  86,  85, // 2184-2191
+ 88,  93, 100, 106, 112, 116, 120, 127, // 2192-2199
+135, 143, 153, 159, 163, 165, 165, 164, // 2200-2207
+163, 162, 158, 153, 146, 137, 131, 126, // 2208-2215
+122, 118, 114, 104, 103, 103, 108, 121, // 2216-2223
+135, 143, 149, 150, 146, 147, 148, 153, // 2224-2231
+158, 160, 152, 144, 129, 117, 109, 108, // 2232-2239
+107, 112, 112, 113, 112, 112, 114, 123, // 2240-2247
+131, 140, 146, 147, 143, 140, 135, 133, // 2248-2255
+134, 133, 130, 124, 115, 104,  98,  94, // 2256-2263
+ 96,  99, 101,  98,  95,  89,  89,  92, // 2264-2271
+102, 111, 122, 125, 129, 128, 131, 136, // 2272-2279
+146, 154, 163, 165, 164, 158, 153, 147, // 2280-2287
+145, 144, 143, 141, 135, 128, 119, 112, // 2288-2295
+107, 109, 112, 120, 127, 134, 137, 139, // 2296-2303
+140, 143, 146, 153, 156, 159, 155, 149, // 2304-2311
+140, 131, 124, 120, 118, 117, 115, 114, // 2312-2319
+111, 111, 113, 117, 122, 129, 133, 135, // 2320-2327
+135, 134, 133, 133, 132, 131, 128, 123, // 2328-2335
+118, 111, 107, 105, 105, 105, 107, 107, // 2336-2343
+106, 103, 101, 100, 103, 109, 117, 124, // 2344-2351
+129, 131, 131, 131, 133, 137, 144, 149, // 2352-2359
+153, 153, 150, 145, 139, 136, 134, 135, // 2360-2367
+135, 135, 132, 130, 123, 121, 121, 124, // 2368-2375
+130, 137, 141, 144, 143, 139, 137, 136, // 2376-2383
+137, 140, 142, 141, 138, 132, 125, 120, // 2384-2391
+119, 118, 121, 123, 124, 124, 123, 122, // 2392-2399
+123, 124, 126, 127, 127, 127, 127, 126, // 2400-2407
+127, 127, 127, 125, 123, 120, 117, 116, // 2408-2415
+116, 118, 119, 118, 116, 112, 107, 105, // 2416-2423
+105, 108, 113, 119, 123, 126, 127, 128, // 2424-2431
+129, 133, 137, 143, 146, 147, 145, 142, // 2432-2439
+138, 134, 132, 132, 132, 132, 132, 131, // 2440-2447
+129, 128, 128, 129, 133, 136, 139, 140, // 2448-2455
+140, 139, 137, 135, 134, 133, 132, 131, // 2456-2463
+130, 128, 126, 123, 121, 120, 120, 121, // 2464-2471
+123, 125, 126, 127, 127, 126, 126, 126, // 2472-2479
+126, 126, 127, 128, 128, 128, 127, 125, // 2480-2487
+122, 120, 118, 118, 119, 120, 120, 118, // 2488-2495
+115, 112, 109, 108, 110, 115, 120, 125, // 2496-2503
+128, 130, 131, 131, 133, 135, 139, 141, // 2504-2511
+143, 142, 140, 136, 133, 129, 128, 128, // 2512-2519
+129, 131, 132, 132, 132, 132, 132, 133, // 2520-2527
+135, 136, 137, 137, 136, 134, 132, 129, // 2528-2535
+128, 127, 127, 126, 126, 125, 124, 124, // 2536-2543
+124, 124, 125, 126, 126, 127, 127, 126, // 2544-2551
+126, 125, 125, 125, 126, 127, 127, 127, // 2552-2559
+127, 125, 123, 122, 121, 121, 121, 121, // 2560-2567
+122, 121, 119, 116, 114, 114, 116, 119, // 2568-2575
+123, 126, 129, 130, 131, 131, 131, 132, // 2576-2583
+134, 135, 137, 137, 136, 135, 132, 130, // 2584-2591
+128, 128, 128, 130, 132, 133, 133, 133, // 2592-2599
+133, 133, 133, 134, 134, 134, 134, 133, // 2600-2607
+131, 130, 128, 127, 126, 125, 124, 125, // 2608-2615
+125, 126, 126, 126, 126, 126, 126, 126, // 2616-2623
+127, 128, 128, 127, 126, 125, 124, 125, // 2624-2631
+125, 126, 126, 125, 124, 122, 121, 120, // 2632-2639
+120, 120, 121, 120, 119, 118, 118, 119, // 2640-2647
+121, 123, 126, 128, 130, 131, 132, 133, // 2648-2655
+133, 135, 135, 135, 135, 134, 133, 131, // 2656-2663
+130, 129, 129, 129, 129, 130, 131, 132, // 2664-2671
+132, 132, 132, 132, 132, 132, 132, 132, // 2672-2679
+132};// 2680-2680
+
+#define KABOOM_N 7273
+const uint8_t kaboom[KABOOM_N] = {
+ 73,  84, 121, 172, 165, 140, 130, 156, // 0-7
+161, 122, 120, 103, 138, 115, 117, 114, // 8-15
+136, 120, 137, 124, 102, 117, 145, 158, // 16-23
+138, 127, 128, 129, 119,  97, 125, 127, // 24-31
+115, 113, 117, 119, 130, 127, 133, 139, // 32-39
+125, 132, 154, 132, 126, 116, 133, 152, // 40-47
+123, 103, 150, 151, 141, 140, 108, 119, // 48-55
+114, 106, 105, 118, 111, 120, 133, 140, // 56-63
+148, 146, 144, 133, 127, 115, 107, 128, // 64-71
+116, 124, 114, 119, 120, 121, 116, 125, // 72-79
+112, 119, 151, 141, 177, 160, 151, 140, // 80-87
+153, 134, 123, 105,  94,  79,  86, 106, // 88-95
+139, 148, 165, 142, 123, 115, 119, 116, // 96-103
+125, 119, 128, 142, 129, 137, 114, 130, // 104-111
+122, 131, 126, 138, 126, 131, 118, 131, // 112-119
+125, 123, 128, 125, 122, 121, 120, 132, // 120-127
+130, 133, 127, 134, 148, 142, 130, 141, // 128-135
+142, 145, 129, 102,  90,  83,  94, 113, // 136-143
+134, 148, 150, 140, 127, 113, 113, 127, // 144-151
+147, 142, 140, 122, 116, 114, 117, 123, // 152-159
+126, 132, 144, 171, 196, 177, 104,  83, // 160-167
+ 68,  69,  93, 126, 129, 137, 131, 130, // 168-175
+142, 147, 139, 136, 119, 119, 118, 129, // 176-183
+131, 119, 107, 105, 128, 151, 164, 155, // 184-191
+144, 145, 150, 137, 129, 113,  98, 110, // 192-199
+117, 123, 105,  85,  87,  89, 128, 159, // 200-207
+169, 159, 141, 101,  83, 101, 153, 155, // 208-215
+140, 119, 117, 155, 183, 193, 196, 186, // 216-223
+ 95,  17,   8,  87, 193, 227, 180,  93, // 224-231
+ 34,  13,  98, 162, 204, 191, 108,  74, // 232-239
+108, 168, 186, 147, 101, 124, 160, 172, // 240-247
+120,  73,  76, 107, 134, 161, 136, 106, // 248-255
+109, 143, 165, 124,  96, 102, 147, 176, // 256-263
+165, 109,  55,  50, 121, 196, 198, 127, // 264-271
+ 57,  86, 159, 191, 157, 106, 101, 145, // 272-279
+167, 133,  82,  72, 116, 157, 152, 122, // 280-287
+104,  99, 134, 149, 146, 121, 102, 118, // 288-295
+160, 159, 115,  77, 113, 163, 184, 134, // 296-303
+ 75,  80, 151, 177, 125,  78, 106, 179, // 304-311
+166,  91,  94, 138, 155, 120,  94, 120, // 312-319
+161, 162,  96,  79, 149, 212, 115,  21, // 320-327
+ 64, 199, 244, 136,  29,  68, 176, 209, // 328-335
+123,  55,  90, 171, 166, 115,  71, 130, // 336-343
+186, 143,  62,  99, 202, 156,  81,  70, // 344-351
+146, 202, 145,  74,  99, 168, 144, 100, // 352-359
+ 82, 138, 178, 141,  79, 102, 151, 160, // 360-367
+122, 109, 123, 150, 132,  87, 112, 184, // 368-375
+132,  79, 154, 135, 139, 123,  95,  63, // 376-383
+112, 213, 199, 123,  29,  80, 169, 201, // 384-391
+131,  71, 125, 199, 141,  35,  96, 196, // 392-399
+172,  79,  88, 177, 169,  82,  57, 123, // 400-407
+201, 148,  91, 115, 146, 130,  94, 114, // 408-415
+163, 156, 107,  89, 130, 157, 148, 114, // 416-423
+123,  99, 136, 167, 148,  95,  78, 144, // 424-431
+172, 144, 102,  91, 115, 144, 133, 120, // 432-439
+144, 147, 120,  63, 155, 163,  81, 130, // 440-447
+172, 134,  89, 123, 151, 139, 103, 149, // 448-455
+130, 147, 111,  83, 143, 168, 117, 105, // 456-463
+130, 121, 101, 117, 159, 160, 116, 100, // 464-471
+127, 154, 101, 134, 145, 100, 151, 121, // 472-479
+119, 118, 142, 134, 116, 120, 132, 153, // 480-487
+116, 105, 132, 155, 103, 104, 157, 143, // 488-495
+ 97, 118, 158, 135, 100, 113, 169, 146, // 496-503
+ 90, 111, 146, 151, 115, 102, 127, 135, // 504-511
+132, 125, 109, 128, 155, 127, 122, 102, // 512-519
+150, 137, 114, 109, 144, 148,  95, 117, // 520-527
+144, 150, 113, 105, 149, 139, 109, 116, // 528-535
+155, 109, 109, 160, 140, 113,  92, 140, // 536-543
+165, 108, 122, 117, 114, 157, 127,  98, // 544-551
+106, 170, 160,  81, 123, 145, 140, 124, // 552-559
+115, 111, 156, 121, 101, 133, 135, 134, // 560-567
+117, 129, 137, 123, 118, 142, 124, 128, // 568-575
+126, 138, 110, 136, 127, 128, 133, 135, // 576-583
+ 96, 119, 149, 120, 128, 118, 162, 139, // 584-591
+ 75,  88, 177, 182,  77,  88, 161, 133, // 592-599
+129, 138, 113, 120, 143, 126,  87, 166, // 600-607
+194,  68,  81, 177, 102, 103, 172, 129, // 608-615
+121, 123, 131, 109,  99, 166, 151, 102, // 616-623
+118, 151, 139,  97, 118, 126, 127, 124, // 624-631
+143, 130, 141, 122, 111, 124, 122, 147, // 632-639
+158, 126,  66, 121, 150, 144, 111, 110, // 640-647
+160, 135, 110, 153, 131, 108,  89, 134, // 648-655
+136, 140, 118, 145, 123, 142, 108, 101, // 656-663
+132, 173, 146, 100, 100, 129, 163,  97, // 664-671
+113, 142, 156,  91, 122, 142, 117, 113, // 672-679
+161, 138,  90, 104, 174, 143,  99, 128, // 680-687
+168, 129,  76, 109, 155, 144, 132,  73, // 688-695
+116, 186, 140, 119, 101, 150, 117, 109, // 696-703
+124, 154, 137,  91, 116, 148, 134, 128, // 704-711
+149, 108, 135, 111, 135, 113, 131, 149, // 712-719
+125, 109, 118, 131, 170,  90,  99, 123, // 720-727
+189, 133,  67, 118, 149, 140, 127, 160, // 728-735
+113, 115,  95, 140, 142,  98, 144, 193, // 736-743
+ 68,  99, 150, 168,  97, 111, 153, 140, // 744-751
+104,  98, 138, 135, 120, 135, 125, 144, // 752-759
+113, 149, 154, 100, 108, 130, 131, 118, // 760-767
+108, 136, 152, 120, 110, 124, 172, 131, // 768-775
+107, 116, 126, 111, 163, 141,  61, 126, // 776-783
+154, 127, 172, 100,  92, 153, 158,  89, // 784-791
+126, 132, 143, 140, 141,  97, 101, 182, // 792-799
+105,  68, 151, 187, 110,  32, 122, 218, // 800-807
+161,  81, 110, 163, 126, 126,  96, 129, // 808-815
+131, 147, 118, 102, 160, 144, 101, 108, // 816-823
+164, 137, 109, 104, 136, 125, 132, 108, // 824-831
+145, 140, 110, 142, 111, 119, 153, 163, // 832-839
+ 89,  93, 156, 167,  95,  99, 147, 123, // 840-847
+ 91, 157, 142, 147, 111,  85, 166, 130, // 848-855
+111, 143, 136, 133, 119,  84, 145, 143, // 856-863
+124,  95, 142, 175,  91, 126, 116, 155, // 864-871
+131, 116, 139, 126, 122, 114, 111,  99, // 872-879
+194, 137,  84, 108, 165, 157,  87,  99, // 880-887
+159, 142,  89, 126, 158, 138, 115, 110, // 888-895
+144, 133, 152, 100, 133, 133,  88, 116, // 896-903
+105, 146, 179, 114,  97, 145, 128, 130, // 904-911
+121, 132, 126, 147, 146,  98,  99, 112, // 912-919
+155, 148, 116, 112, 104, 178, 124,  99, // 920-927
+142, 135, 130, 105, 112, 165, 103, 143, // 928-935
+133, 106, 134, 131, 124, 139, 112, 149, // 936-943
+ 97, 106, 148, 143, 118, 157, 104, 137, // 944-951
+166,  81,  97, 156, 129,  81, 164, 136, // 952-959
+133, 111,  99, 176, 131,  99, 144, 139, // 960-967
+104, 133, 118, 104, 169, 123, 139, 107, // 968-975
+103, 143, 132, 123, 135, 126, 128, 151, // 976-983
+143, 108,  97, 131, 132, 114,  73, 133, // 984-991
+205, 143,  83, 141, 135, 126, 153,  83, // 992-999
+130, 160,  98,  91, 148, 156, 147,  90, // 1000-1007
+126, 146, 124,  90, 150, 150, 121,  98, // 1008-1015
+155, 123, 142, 106,  89, 130, 161, 159, // 1016-1023
+ 95,  95, 168, 153,  86, 126, 120, 137, // 1024-1031
+153, 106, 106, 145, 155,  90, 154,  98, // 1032-1039
+127, 173,  93, 111, 120, 126, 168, 129, // 1040-1047
+105, 139, 105, 167, 117,  97, 138, 151, // 1048-1055
+124, 109, 110, 162, 125, 131, 108, 120, // 1056-1063
+149, 112, 109, 107, 167, 157,  99, 109, // 1064-1071
+132, 165, 101, 151,  99, 111, 155, 145, // 1072-1079
+114, 103, 116, 160, 145, 102, 102, 145, // 1080-1087
+155, 119,  91, 107, 160, 157, 100, 103, // 1088-1095
+125, 177, 161, 121,  71, 106, 179, 112, // 1096-1103
+109, 125, 119, 141, 141, 128, 120, 141, // 1104-1111
+ 87, 166, 132, 110, 128, 116, 127, 137, // 1112-1119
+134, 110, 148, 123, 131,  95, 142, 147, // 1120-1127
+115, 102, 133, 163, 125, 109, 104, 149, // 1128-1135
+145, 114,  96, 130, 185, 141,  98,  97, // 1136-1143
+155, 125,  97,  98, 134, 169, 138,  99, // 1144-1151
+141, 150, 141,  91, 103, 162, 140, 107, // 1152-1159
+109, 113, 149, 145, 114, 125, 153, 118, // 1160-1167
+121, 114, 143, 119, 136, 108, 107, 128, // 1168-1175
+153, 143, 108, 132, 141, 135, 123, 127, // 1176-1183
+122, 148, 102, 106, 111, 140, 136, 137, // 1184-1191
+123, 127, 114, 147, 130, 127, 142, 111, // 1192-1199
+107, 158, 110, 117, 139, 139, 140, 134, // 1200-1207
+125, 121,  77, 114, 160, 151, 104, 112, // 1208-1215
+132, 165, 133, 102, 126, 137, 143, 106, // 1216-1223
+106, 146, 152, 109,  94, 124, 160, 126, // 1224-1231
+150, 127, 113, 126, 121, 102, 136, 132, // 1232-1239
+144, 126, 122, 108, 135, 122, 157, 116, // 1240-1247
+114, 139, 140, 127,  94, 131, 148, 159, // 1248-1255
+121,  73, 127, 157, 153,  92,  84, 154, // 1256-1263
+170, 122,  92,  95, 162, 166, 129, 113, // 1264-1271
+107, 137, 121, 130, 117, 138, 137, 117, // 1272-1279
+131, 110, 132, 138, 161, 109, 108, 118, // 1280-1287
+116, 144, 127, 119, 139, 135, 147, 117, // 1288-1295
+ 94, 106, 142, 165, 119, 118, 116, 146, // 1296-1303
+128, 125, 143, 133, 125, 116, 115, 109, // 1304-1311
+ 99, 142, 164, 137, 117, 112, 114, 149, // 1312-1319
+135, 136, 114, 129, 132, 117, 100, 135, // 1320-1327
+134, 142, 135, 133, 124, 126, 133, 148, // 1328-1335
+110,  96,  92, 129, 166, 142, 111,  85, // 1336-1343
+158, 169, 141, 109,  96, 127, 136, 142, // 1344-1351
+111, 113, 137, 168, 122, 112, 110, 145, // 1352-1359
+118, 120, 104, 130, 134, 133, 134, 115, // 1360-1367
+142, 140, 132, 121, 113, 119, 157, 139, // 1368-1375
+106,  83, 125, 181, 162, 100,  87, 103, // 1376-1383
+151, 148, 120, 108, 113, 127, 154, 140, // 1384-1391
+136, 128, 131, 110, 132, 133, 109, 117, // 1392-1399
+109, 146, 136, 142, 133, 133, 127, 101, // 1400-1407
+ 89, 123, 157, 170, 124,  82, 114, 142, // 1408-1415
+156, 130, 110, 114, 141, 151, 140, 120, // 1416-1423
+130,  99,  91, 111, 143, 174, 140,  99, // 1424-1431
+ 71, 126, 184, 180, 117,  88, 100, 135, // 1432-1439
+171, 130,  90,  89, 130, 189, 173, 107, // 1440-1447
+ 72,  83, 137, 159, 146, 104, 103, 136, // 1448-1455
+157, 153, 144, 120,  99, 100, 130, 154, // 1456-1463
+137, 116,  97, 116, 137, 144, 125, 111, // 1464-1471
+134, 141, 142, 130, 140, 119, 112, 106, // 1472-1479
+122, 133, 144, 122, 120, 112, 132, 140, // 1480-1487
+143, 138, 125, 122, 113, 117, 130, 141, // 1488-1495
+149, 125,  98,  90, 122, 142, 156, 150, // 1496-1503
+121, 122, 111, 138, 131, 143, 118, 114, // 1504-1511
+130, 124, 120, 104, 112, 147, 168, 150, // 1512-1519
+119,  92, 103, 119, 162, 157, 144,  90, // 1520-1527
+ 78, 102, 142, 188, 182, 136,  85,  66, // 1528-1535
+100, 151, 156, 141, 119, 109, 118, 129, // 1536-1543
+154, 162, 129,  98,  83, 119, 140, 161, // 1544-1551
+152, 120,  98, 106, 115, 127, 151, 159, // 1552-1559
+140, 118,  86, 100, 134, 160, 148, 132, // 1560-1567
+105, 116, 130, 144, 136, 116, 108, 114, // 1568-1575
+124, 128, 133, 136, 144, 137, 139, 126, // 1576-1583
+115,  96, 117, 141, 146, 145, 117, 109, // 1584-1591
+107, 120, 133, 143, 150, 140, 124, 111, // 1592-1599
+117, 113, 117, 128, 149, 164, 154, 115, // 1600-1607
+ 90,  87,  98, 135, 156, 154, 136, 120, // 1608-1615
+114, 120, 134, 141, 137, 125, 121, 119, // 1616-1623
+129, 126, 136, 128, 124, 116, 104, 108, // 1624-1631
+124, 137, 152, 159, 140, 123, 106, 115, // 1632-1639
+134, 142, 130, 121, 112, 119, 124, 123, // 1640-1647
+128, 132, 126, 132, 128, 131, 132, 129, // 1648-1655
+128, 129, 126, 121, 125, 130, 127, 125, // 1656-1663
+124, 128, 134, 127, 128, 125, 129, 123, // 1664-1671
+122, 122, 129, 131, 127, 123, 127, 129, // 1672-1679
+131, 130, 128, 126, 125, 131, 128, 127, // 1680-1687
+125, 125, 126, 125, 125, 126, 129, 130, // 1688-1695
+129, 129, 125, 126, 123, 127, 129, 131, // 1696-1703
+131, 131, 124, 122, 122, 129, 127, 131, // 1704-1711
+127, 124, 128, 130, 128, 124, 126, 126, // 1712-1719
+127, 128, 127, 127, 129, 127, 129, 126, // 1720-1727
+127, 128, 125, 125, 123, 127, 130, 128, // 1728-1735
+128, 128, 127, 127, 127, 127, 128, 129, // 1736-1743
+127, 125, 128, 125, 126, 126, 129, 127, // 1744-1751
+127, 127, 127, 127, 127, 129, 128, 125, // 1752-1759
+128, 127, 127, 127, 128, 125, 126, 127, // 1760-1767
+128, 128, 128, 129, 128, 124, 126, 125, // 1768-1775
+128, 130, 126, 126, 125, 126, 129, 129, // 1776-1783
+128, 127, 127, 123, 128, 125, 133, 131, // 1784-1791
+131, 123, 127, 109, 105, 101, 115, 111, // 1792-1799
+110, 116, 131, 117, 126, 139, 134, 140, // 1800-1807
+156, 122, 125, 162, 155, 150, 147, 127, // 1808-1815
+133, 126, 115, 115, 117, 125, 122, 131, // 1816-1823
+120, 123, 125, 152, 137, 143, 125, 111, // 1824-1831
+101,  80,  66,  96, 123, 119, 122, 127, // 1832-1839
+148, 143, 146, 147, 145, 133, 148, 133, // 1840-1847
+143, 144, 139, 134, 134, 123,  92, 120, // 1848-1855
+141, 146, 109,  81, 126, 136, 112, 124, // 1856-1863
+126, 142, 125, 130, 126, 128, 136, 137, // 1864-1871
+124, 132, 120, 138, 132, 121, 111, 129, // 1872-1879
+132, 125, 122, 135, 126, 131, 131, 128, // 1880-1887
+132, 129, 114, 115, 116, 117, 120, 113, // 1888-1895
+118, 121, 129, 124, 132, 130, 147, 144, // 1896-1903
+143, 140, 149, 130, 138, 127, 128, 132, // 1904-1911
+138, 141, 150, 141, 128, 114,  84,  79, // 1912-1919
+ 81,  98, 114, 155, 146, 145, 133, 122, // 1920-1927
+112, 133, 119, 137, 142, 118, 152, 143, // 1928-1935
+134, 149, 154, 119, 117,  71,  58,  76, // 1936-1943
+ 88, 121, 132, 155, 160, 161, 145, 145, // 1944-1951
+142, 138, 126, 132, 135, 140, 153, 160, // 1952-1959
+151, 159, 136, 126,  91,  72,  85,  85, // 1960-1967
+110, 135, 153, 150, 130, 118, 109, 106, // 1968-1975
+106, 115, 139, 134, 140, 156, 144, 122, // 1976-1983
+133, 122, 100, 122, 135, 140, 150, 128, // 1984-1991
+123, 129, 135, 145, 146, 114, 131, 116, // 1992-1999
+145, 149, 110, 120, 108,  63, 138, 104, // 2000-2007
+135, 122,  95, 122, 102, 114, 140, 141, // 2008-2015
+151, 146, 141, 127, 148, 154, 134, 146, // 2016-2023
+153, 142, 130, 117, 119, 113, 108,  95, // 2024-2031
+108, 114, 137, 141, 156, 124, 107,  89, // 2032-2039
+ 86, 123, 167, 174, 172, 172, 148, 102, // 2040-2047
+ 86, 100, 120, 145, 146, 130,  91,  88, // 2048-2055
+107, 127, 148, 162, 137, 117,  79, 111, // 2056-2063
+143, 154, 136, 151, 136, 136, 118, 134, // 2064-2071
+110, 129, 123, 116,  84,  90, 100, 129, // 2072-2079
+140, 158, 142, 142, 138, 137, 139, 101, // 2080-2087
+109, 112, 121, 144, 129, 146, 145, 152, // 2088-2095
+138, 125, 136, 113, 125, 120, 124, 128, // 2096-2103
+141, 149, 150, 137, 133, 128, 122, 111, // 2104-2111
+ 97,  95,  80,  97, 112, 133, 148, 180, // 2112-2119
+192, 177, 139,  48,  18,  17,  92, 176, // 2120-2127
+229, 236, 196, 141,  88,  79,  87, 113, // 2128-2135
+139, 150, 152, 125,  99,  74,  64,  87, // 2136-2143
+139, 181, 204, 184, 149, 113,  80,  94, // 2144-2151
+130, 154, 145, 120,  88, 106, 135, 153, // 2152-2159
+167, 166, 128,  79,  62,  96, 122, 116, // 2160-2167
+118, 144, 185, 182, 138, 105, 102, 116, // 2168-2175
+144, 155, 163, 133,  92,  58,  79, 124, // 2176-2183
+159, 147, 110, 107, 137, 169, 159, 145, // 2184-2191
+128, 111, 118, 118, 141, 163, 137,  86, // 2192-2199
+ 67,  83, 134, 150, 154, 134, 130, 127, // 2200-2207
+152, 136, 119, 106, 127, 154, 131,  90, // 2208-2215
+100, 100, 132, 147, 155, 145, 138, 120, // 2216-2223
+110, 134, 158, 145, 146, 132, 125, 131, // 2224-2231
+126, 108,  89, 100, 128, 124, 101, 105, // 2232-2239
+143, 188, 128,  46,  33, 131, 224, 242, // 2240-2247
+151,  72,  61, 121, 168, 158, 107,  75, // 2248-2255
+ 98, 134, 150, 131, 115, 124, 150, 179, // 2256-2263
+177,  94,  42,  49, 133, 188, 170, 101, // 2264-2271
+ 62, 126, 189, 199, 142,  89,  56, 133, // 2272-2279
+197, 175,  95,  43,  64, 131, 188, 179, // 2280-2287
+116,  59,  66, 145, 190, 186, 141, 109, // 2288-2295
+124, 152, 144, 100,  86, 124, 168, 177, // 2296-2303
+125,  98,  93, 168, 117,  82,  54, 130, // 2304-2311
+184, 202, 102, 119,  93,  89, 129, 144, // 2312-2319
+146, 102, 105, 118, 170, 158, 132,  96, // 2320-2327
+124, 144, 162, 135, 131, 121, 127, 116, // 2328-2335
+121, 115, 135, 135, 139, 121, 122, 106, // 2336-2343
+125, 142, 178, 118,  52,  72, 114, 165, // 2344-2351
+152, 111,  97, 147, 184, 159,  99,  86, // 2352-2359
+122, 164, 170, 128,  98, 116, 138, 136, // 2360-2367
+127, 121, 140, 133, 112, 102, 118, 135, // 2368-2375
+137, 124, 125, 119, 134, 123, 112, 128, // 2376-2383
+130, 129, 132, 149, 146, 116,  97, 109, // 2384-2391
+142, 157, 133, 112, 120, 138, 135, 121, // 2392-2399
+121, 135, 139, 142, 125, 101, 111, 103, // 2400-2407
+111, 131, 136, 140, 130, 131, 132, 131, // 2408-2415
+110, 114, 129, 154, 148, 118, 100, 125, // 2416-2423
+159, 159, 118,  91, 105, 149, 169, 137, // 2424-2431
+ 96, 110, 164, 154, 111,  90,  95, 149, // 2432-2439
+158, 114,  74,  94, 156, 194, 142,  88, // 2440-2447
+ 65, 121, 185, 155, 100,  82, 123, 152, // 2448-2455
+138, 116, 132, 168, 185, 143,  87,  69, // 2456-2463
+131, 165, 141, 107, 101, 122, 143, 120, // 2464-2471
+108, 128, 160, 133, 110, 113, 123, 118, // 2472-2479
+123, 136, 143, 135,  97, 104, 141, 164, // 2480-2487
+143, 101, 106, 151, 157, 123,  97, 118, // 2488-2495
+143, 146, 116, 115, 120, 135, 136, 112, // 2496-2503
+107, 135, 152, 131, 115, 113, 125, 144, // 2504-2511
+147, 120, 111, 114, 139, 142, 132, 118, // 2512-2519
+135, 148, 140,  85,  73, 126, 174, 163, // 2520-2527
+ 90,  84, 114, 169, 163, 114,  80, 120, // 2528-2535
+163, 174, 128, 107, 124, 157, 147, 122, // 2536-2543
+ 99, 116, 158, 101,  71,  97, 161, 177, // 2544-2551
+132,  83,  85, 148, 187, 154, 107, 100, // 2552-2559
+130, 156, 128,  94, 109, 147, 162, 115, // 2560-2567
+ 74, 113, 170, 184, 131,  84, 106, 145, // 2568-2575
+150, 121,  91, 109, 142, 146, 130, 103, // 2576-2583
+101, 130, 150, 132, 123, 126, 139, 142, // 2584-2591
+133, 123, 121, 128, 145, 130, 114, 129, // 2592-2599
+134, 118, 104, 117, 131, 150, 136, 119, // 2600-2607
+122, 137, 126, 123, 101,  95, 100, 122, // 2608-2615
+151, 160, 157, 148, 142, 120, 112, 121, // 2616-2623
+126, 128, 123, 113, 123, 135, 137, 120, // 2624-2631
+120, 125, 133, 120, 126, 129, 144, 137, // 2632-2639
+112, 118, 126, 128, 137, 118, 127, 131, // 2640-2647
+132, 118, 119, 126, 140, 154, 129, 102, // 2648-2655
+105, 129, 148, 135, 118, 115, 124, 149, // 2656-2663
+150, 115, 124, 131, 113, 106, 106, 133, // 2664-2671
+154, 132,  97, 131, 137, 148, 124, 100, // 2672-2679
+108, 136, 161, 156, 134, 112, 118, 129, // 2680-2687
+121, 122, 133, 139, 124, 102,  89, 117, // 2688-2695
+158, 167, 143, 112, 115, 130, 149, 127, // 2696-2703
+ 99, 100, 129, 147, 146, 129, 128, 121, // 2704-2711
+124, 130, 109, 104, 120, 145, 150, 119, // 2712-2719
+ 88, 104, 157, 186, 166, 116,  82, 115, // 2720-2727
+149, 152, 120,  87, 101, 143, 162, 141, // 2728-2735
+102, 102, 141, 155, 143, 113,  85, 128, // 2736-2743
+153, 129, 103, 111, 127, 156, 153, 121, // 2744-2751
+108, 105, 125, 136, 139, 138, 140, 127, // 2752-2759
+126, 121, 125, 130, 136, 120, 114, 127, // 2760-2767
+143, 129, 118, 110, 125, 150, 127, 111, // 2768-2775
+113, 138, 143, 131, 115, 127, 135, 151, // 2776-2783
+132, 103, 107, 143, 154, 134, 109,  99, // 2784-2791
+112, 122, 145, 132,  93,  87, 137, 172, // 2792-2799
+169, 126, 110, 132, 162, 138, 101,  95, // 2800-2807
+115, 151, 142, 111, 106, 134, 146, 137, // 2808-2815
+118, 116, 126, 134, 135, 131, 123, 119, // 2816-2823
+129, 130, 136, 121, 106, 109, 132, 151, // 2824-2831
+147, 113,  96, 113, 141, 153, 134, 106, // 2832-2839
+ 98, 129, 158, 158, 139, 129, 124, 133, // 2840-2847
+123, 112,  99, 119, 131, 136, 128, 111, // 2848-2855
+134, 141, 135, 120, 120, 122, 132, 137, // 2856-2863
+130, 116, 126, 139, 149, 156, 136,  77, // 2864-2871
+113, 134, 129, 116, 101, 122, 156, 152, // 2872-2879
+ 97,  72, 102, 166, 170, 129, 100, 117, // 2880-2887
+148, 155, 133, 119, 127, 149, 141, 128, // 2888-2895
+106, 107, 124, 136, 128, 122, 123, 126, // 2896-2903
+129, 128, 126, 129, 134, 122, 124, 142, // 2904-2911
+143, 138, 128,  91,  90, 119, 135, 139, // 2912-2919
+124, 110, 132, 132, 122, 127, 141, 147, // 2920-2927
+145, 122, 123, 139, 144, 133, 114, 103, // 2928-2935
+120, 133, 140, 124, 106, 117, 135, 136, // 2936-2943
+126, 125, 122, 123, 127, 133, 146, 135, // 2944-2951
+120, 124, 137, 118,  94, 109, 143, 160, // 2952-2959
+123,  95, 102, 142, 164, 144, 106, 107, // 2960-2967
+132, 156, 155, 123,  99, 115, 130, 140, // 2968-2975
+128, 120, 125, 132, 128, 120, 126, 132, // 2976-2983
+138, 125, 116, 115, 133, 121, 108, 113, // 2984-2991
+144, 162, 153, 121, 104, 115, 134, 135, // 2992-2999
+126, 120, 134, 140, 132, 123, 119, 113, // 3000-3007
+132, 135, 123, 115, 106, 124, 146, 153, // 3008-3015
+130, 106, 114, 145, 146, 119, 101, 120, // 3016-3023
+142, 147, 127, 115, 118, 136, 132, 120, // 3024-3031
+116, 138, 144, 138, 113, 108, 130, 149, // 3032-3039
+136, 113, 110, 122, 136, 130, 132, 122, // 3040-3047
+124, 130, 131, 122, 123, 124, 129, 128, // 3048-3055
+128, 123, 122, 135, 132, 128, 120, 125, // 3056-3063
+138, 143, 128, 122, 120, 131, 129, 126, // 3064-3071
+121, 126, 121, 135, 131, 135, 135, 130, // 3072-3079
+117, 101, 103, 122, 142, 132, 116, 105, // 3080-3087
+122, 154, 166, 144, 125, 114, 122, 130, // 3088-3095
+132, 119, 112, 117, 130, 144, 145, 127, // 3096-3103
+115, 110, 125, 140, 139, 116, 110, 119, // 3104-3111
+145, 154, 123, 107, 111, 137, 140, 128, // 3112-3119
+109, 113, 130, 147, 150, 137, 116, 104, // 3120-3127
+115, 135, 141, 128,  95,  80, 118, 159, // 3128-3135
+169, 148, 131, 131, 137, 125, 117, 112, // 3136-3143
+120, 131, 133, 121, 118, 116, 127, 138, // 3144-3151
+136, 137, 135, 132, 112, 112, 119, 132, // 3152-3159
+128, 120, 121, 128, 140, 142, 126, 115, // 3160-3167
+126, 138, 138, 126, 108, 110, 132, 147, // 3168-3175
+151, 130, 111, 107, 128, 138, 145, 122, // 3176-3183
+106, 115, 143, 144, 133, 106, 101, 117, // 3184-3191
+143, 150, 138, 102,  93, 121, 164, 167, // 3192-3199
+140,  98, 102, 132, 163, 149, 107,  90, // 3200-3207
+115, 144, 145, 132, 117, 123, 135, 131, // 3208-3215
+125, 127, 132, 125, 115, 121, 133, 133, // 3216-3223
+111,  95,  95, 135, 169, 163, 126, 108, // 3224-3231
+108, 130, 156, 151, 124, 114, 110, 133, // 3232-3239
+149, 141, 112, 107, 119, 146, 146, 127, // 3240-3247
+106, 131, 158, 142,  76,  61, 104, 163, // 3248-3255
+159, 112,  76, 102, 165, 192, 167, 120, // 3256-3263
+100, 119, 152, 161, 130,  87,  84, 122, // 3264-3271
+158, 157, 120, 103, 115, 152, 160, 128, // 3272-3279
+ 99,  98, 104, 137, 143, 122, 104, 103, // 3280-3287
+118, 148, 151, 146, 127, 124, 141, 151, // 3288-3295
+133, 116, 108, 111, 125, 134, 138, 131, // 3296-3303
+128, 123, 129, 133, 125, 107, 118, 131, // 3304-3311
+142, 137, 126, 106, 112, 121, 143, 141, // 3312-3319
+132, 121, 120, 116, 127, 131, 150, 153, // 3320-3327
+135, 111,  97, 107, 143, 148, 135, 115, // 3328-3335
+113, 129, 146, 133, 121, 109, 118, 133, // 3336-3343
+135, 127, 122, 121, 126, 132, 136, 136, // 3344-3351
+127, 116, 111, 123, 140, 141, 127, 121, // 3352-3359
+122, 142, 138, 120,  99, 119, 150, 156, // 3360-3367
+126, 110, 106, 129, 147, 138, 119, 102, // 3368-3375
+103, 134, 146, 142, 119, 108, 120, 140, // 3376-3383
+146, 146, 130, 132, 132, 133, 126, 103, // 3384-3391
+ 76,  89, 127, 165, 154, 124, 106, 131, // 3392-3399
+165, 165, 139, 119, 109, 116, 132, 137, // 3400-3407
+127,  86,  81, 116, 157, 170, 142,  97, // 3408-3415
+ 95, 118, 155, 154, 128, 108, 111, 131, // 3416-3423
+151, 136, 126, 119, 127, 136, 133, 121, // 3424-3431
+117, 121, 132, 136, 126, 120, 115, 127, // 3432-3439
+136, 138, 132, 119, 112, 116, 125, 140, // 3440-3447
+145, 134, 111, 111, 124, 141, 144, 133, // 3448-3455
+114, 108, 124, 142, 139, 128, 120, 118, // 3456-3463
+123, 133, 136, 124, 112, 120, 134, 139, // 3464-3471
+130, 114, 123, 138, 138, 129, 119, 123, // 3472-3479
+135, 126, 126, 133, 135, 119,  99, 107, // 3480-3487
+129, 151, 160, 141, 126, 111,  92, 114, // 3488-3495
+138, 149, 142, 115,  99, 124, 145, 152, // 3496-3503
+130,  93,  98, 144, 171, 168, 129,  93, // 3504-3511
+ 97, 124, 140, 148, 144, 113,  87,  87, // 3512-3519
+120, 162, 178, 138,  90,  79, 119, 152, // 3520-3527
+159, 134, 117, 115, 138, 145, 137, 118, // 3528-3535
+123, 131, 135, 132, 120, 108, 116, 132, // 3536-3543
+138, 132, 119, 117, 121, 124, 124, 130, // 3544-3551
+136, 135, 127, 126, 125, 126, 118, 123, // 3552-3559
+132, 144, 135, 123, 112, 122, 137, 141, // 3560-3567
+133, 123, 116, 124, 130, 136, 129, 116, // 3568-3575
+121, 141, 136, 121, 108, 111, 124, 132, // 3576-3583
+134, 138, 139, 133, 120, 110, 119, 138, // 3584-3591
+143, 139, 129, 124, 122, 120, 119, 127, // 3592-3599
+133, 132, 117, 118, 127, 142, 139, 130, // 3600-3607
+115, 115, 119, 127, 127, 135, 136, 132, // 3608-3615
+124, 118, 122, 133, 137, 136, 124, 114, // 3616-3623
+114, 125, 139, 136, 129, 124, 126, 132, // 3624-3631
+132, 125, 119, 122, 132, 131, 125, 121, // 3632-3639
+114, 123, 141, 142, 136, 117, 108, 123, // 3640-3647
+145, 140, 122, 103, 111, 136, 150, 144, // 3648-3655
+128, 112, 113, 122, 135, 143, 134, 113, // 3656-3663
+105, 123, 143, 149, 130, 116, 114, 123, // 3664-3671
+134, 135, 127, 122, 110, 108, 130, 148, // 3672-3679
+147, 131, 114, 114, 133, 143, 139, 126, // 3680-3687
+113, 112, 124, 137, 140, 127, 118, 120, // 3688-3695
+139, 135, 121, 111, 120, 136, 144, 126, // 3696-3703
+115, 110, 119, 137, 142, 130, 109, 104, // 3704-3711
+128, 164, 167, 133,  93,  88, 119, 150, // 3712-3719
+152, 129, 109, 117, 131, 146, 145, 132, // 3720-3727
+111, 108, 113, 132, 151, 150, 124, 118, // 3728-3735
+114, 110, 115, 111, 113, 132, 143, 139, // 3736-3743
+132, 130, 138, 138, 135, 131, 128, 125, // 3744-3751
+127, 114, 123, 125, 128, 126, 130, 120, // 3752-3759
+121, 121, 131, 134, 136, 122, 129, 137, // 3760-3767
+138, 123, 101,  91, 120, 144, 152, 138, // 3768-3775
+119, 116, 129, 142, 147, 138, 122, 117, // 3776-3783
+119, 129, 126, 121, 114, 128, 135, 134, // 3784-3791
+118, 116, 122, 140, 135, 124, 112, 122, // 3792-3799
+135, 153, 147, 137, 110,  92,  93, 123, // 3800-3807
+157, 176, 156, 115,  80,  96, 122, 140, // 3808-3815
+138, 122, 111, 125, 148, 159, 149, 130, // 3816-3823
+117, 115, 132, 150, 127,  99,  89,  91, // 3824-3831
+125, 160, 157, 127, 102, 104, 131, 166, // 3832-3839
+168, 136,  95,  89, 108, 140, 153, 139, // 3840-3847
+116, 115, 130, 144, 140, 128, 125, 124, // 3848-3855
+128, 128, 123, 122, 134, 129, 119, 108, // 3856-3863
+110, 129, 150, 128, 106,  96, 121, 158, // 3864-3871
+172, 142, 117, 102, 125, 144, 146, 127, // 3872-3879
+108, 104, 132, 142, 142, 127, 113, 110, // 3880-3887
+133, 143, 150, 137, 111,  94, 106, 131, // 3888-3895
+149, 141, 117, 104, 109, 134, 154, 145, // 3896-3903
+124, 111, 117, 138, 152, 138, 118, 109, // 3904-3911
+120, 137, 139, 134, 119, 108, 114, 137, // 3912-3919
+148, 143, 116,  98, 111, 142, 153, 141, // 3920-3927
+114, 106, 118, 131, 137, 137, 126, 123, // 3928-3935
+122, 124, 128, 134, 128, 121, 125, 136, // 3936-3943
+135, 129, 121, 120, 127, 135, 133, 129, // 3944-3951
+129, 126, 116, 115, 124, 131, 139, 136, // 3952-3959
+126, 119, 114, 117, 129, 139, 139, 129, // 3960-3967
+119, 118, 128, 135, 134, 128, 120, 121, // 3968-3975
+127, 131, 131, 127, 126, 131, 129, 125, // 3976-3983
+118, 123, 130, 138, 133, 131, 125, 121, // 3984-3991
+124, 135, 137, 139, 125, 112, 109, 116, // 3992-3999
+115, 114, 115, 130, 141, 150, 144, 133, // 4000-4007
+125, 124, 130, 129, 128, 122, 123, 131, // 4008-4015
+138, 129, 116, 113, 124, 136, 140, 125, // 4016-4023
+113, 111, 129, 146, 156, 142, 116,  89, // 4024-4031
+ 96, 126, 156, 154, 119,  75,  72, 115, // 4032-4039
+168, 192, 171, 130, 106, 110, 125, 142, // 4040-4047
+143, 129, 119, 115, 112, 119, 130, 126, // 4048-4055
+124, 123, 122, 128, 133, 126, 117, 113, // 4056-4063
+123, 135, 150, 149, 130, 104, 106, 121, // 4064-4071
+145, 155, 143, 116, 111, 113, 124, 144, // 4072-4079
+148, 127, 109, 105, 120, 143, 146, 125, // 4080-4087
+112, 113, 128, 137, 135, 129, 126, 128, // 4088-4095
+136, 133, 119, 108, 109, 126, 143, 140, // 4096-4103
+123, 119, 128, 145, 145, 133, 111, 110, // 4104-4111
+120, 140, 141, 130, 112, 106, 115, 138, // 4112-4119
+149, 144, 122, 103, 102, 131, 154, 154, // 4120-4127
+130, 113, 110, 130, 151, 158, 144, 112, // 4128-4135
+ 79,  82, 116, 148, 146, 122, 108, 123, // 4136-4143
+147, 154, 134, 113, 109, 123, 136, 141, // 4144-4151
+134, 125, 125, 131, 141, 140, 136, 118, // 4152-4159
+108, 108, 126, 138, 139, 125, 121, 116, // 4160-4167
+125, 124, 123, 113, 120, 116, 127, 138, // 4168-4175
+150, 138, 130, 122, 131, 136, 141, 127, // 4176-4183
+115, 114, 123, 126, 130, 130, 126, 124, // 4184-4191
+132, 138, 136, 129, 119, 112, 115, 125, // 4192-4199
+132, 131, 127, 120, 112, 115, 128, 143, // 4200-4207
+146, 140, 118, 110, 117, 140, 152, 150, // 4208-4215
+130, 115, 110, 122, 129, 135, 129, 131, // 4216-4223
+121, 113, 107, 122, 136, 145, 128, 108, // 4224-4231
+102, 124, 144, 153, 140, 130, 120, 127, // 4232-4239
+135, 139, 129, 121, 120, 126, 131, 127, // 4240-4247
+115, 111, 114, 124, 131, 139, 136, 125, // 4248-4255
+118, 121, 136, 150, 150, 128, 106,  98, // 4256-4263
+112, 132, 142, 135, 121, 120, 132, 141, // 4264-4271
+141, 130, 121, 116, 119, 132, 147, 150, // 4272-4279
+132, 102,  95, 112, 131, 131, 117, 113, // 4280-4287
+119, 122, 123, 134, 157, 172, 163, 127, // 4288-4295
+101, 106, 126, 139, 137, 125, 112, 109, // 4296-4303
+123, 133, 137, 133, 121, 111, 111, 121, // 4304-4311
+127, 128, 131, 127, 125, 130, 139, 139, // 4312-4319
+133, 130, 127, 130, 133, 130, 121, 121, // 4320-4327
+129, 135, 136, 135, 126, 124, 126, 125, // 4328-4335
+112, 107, 113, 126, 125, 116, 109, 119, // 4336-4343
+145, 166, 160, 137, 114,  99, 104, 130, // 4344-4351
+153, 151, 130, 110, 109, 129, 152, 150, // 4352-4359
+127, 106, 105, 115, 131, 144, 136, 113, // 4360-4367
+ 99, 108, 130, 155, 161, 143, 125, 126, // 4368-4375
+136, 133, 117,  93,  85, 100, 133, 147, // 4376-4383
+135, 119, 115, 131, 152, 163, 146, 124, // 4384-4391
+117, 128, 136, 138, 132, 122, 110, 112, // 4392-4399
+122, 135, 136, 123, 112, 137, 180, 176, // 4400-4407
+ 96,  32,  31, 105, 185, 207, 162, 104, // 4408-4415
+ 86, 103, 137, 164, 165, 135, 101,  92, // 4416-4423
+116, 147, 168, 151, 124, 112, 127, 135, // 4424-4431
+132, 114, 103, 103, 123, 137, 139, 134, // 4432-4439
+132, 122, 115, 119, 132, 143, 146, 126, // 4440-4447
+ 97,  82,  96, 128, 156, 159, 136, 107, // 4448-4455
+103, 132, 173, 192, 171, 114,  67,  72, // 4456-4463
+121, 171, 174, 135,  90,  87, 120, 151, // 4464-4471
+150, 127, 100,  95, 106, 122, 132, 134, // 4472-4479
+129, 121, 120, 127, 143, 151, 147, 133, // 4480-4487
+127, 126, 130, 125, 120, 118, 130, 140, // 4488-4495
+146, 143, 140, 133, 123, 106,  97,  92, // 4496-4503
+100, 116, 134, 143, 141, 127, 123, 131, // 4504-4511
+145, 147, 137, 121, 112, 115, 123, 133, // 4512-4519
+133, 127, 116, 109, 115, 137, 154, 159, // 4520-4527
+142, 121, 112, 122, 137, 143, 136, 119, // 4528-4535
+104, 101, 109, 125, 139, 145, 134, 120, // 4536-4543
+109, 111, 121, 137, 145, 138, 125, 117, // 4544-4551
+119, 136, 147, 145, 126, 115, 114, 128, // 4552-4559
+140, 143, 127, 112, 109, 119, 130, 138, // 4560-4567
+135, 127, 117, 118, 119, 124, 129, 136, // 4568-4575
+132, 133, 130, 134, 132, 138, 126, 116, // 4576-4583
+105, 116, 121, 134, 140, 142, 127, 116, // 4584-4591
+110, 114, 129, 142, 141, 129, 121, 121, // 4592-4599
+123, 136, 145, 132, 116, 110, 117, 126, // 4600-4607
+139, 142, 141, 135, 136, 130, 143, 152, // 4608-4615
+145,  84,  49,  55, 111, 163, 188, 156, // 4616-4623
+121,  99, 111, 126, 151, 154, 140, 119, // 4624-4631
+119, 124, 131, 132, 127, 118, 120, 129, // 4632-4639
+137, 135, 130, 114, 102, 117, 146, 162, // 4640-4647
+149, 119,  91,  98, 127, 154, 148, 126, // 4648-4655
+107, 112, 123, 129, 114, 104, 113, 139, // 4656-4663
+158, 161, 141, 123, 115, 130, 140, 141, // 4664-4671
+127, 112, 106, 115, 125, 133, 128, 129, // 4672-4679
+127, 128, 126, 126, 127, 128, 133, 130, // 4680-4687
+126, 122, 123, 123, 124, 127, 130, 136, // 4688-4695
+138, 131, 119, 111, 118, 124, 133, 138, // 4696-4703
+140, 137, 131, 115, 111, 116, 133, 143, // 4704-4711
+140, 127, 115, 115, 125, 139, 146, 138, // 4712-4719
+124, 110, 112, 120, 126, 124, 120, 119, // 4720-4727
+126, 128, 128, 128, 129, 136, 140, 145, // 4728-4735
+142, 138, 128, 116, 108, 107, 115, 124, // 4736-4743
+135, 143, 143, 133, 119, 113, 119, 135, // 4744-4751
+141, 131, 117, 119, 128, 137, 127, 113, // 4752-4759
+102, 114, 130, 140, 130, 123, 122, 136, // 4760-4767
+147, 152, 133, 116, 107, 121, 137, 149, // 4768-4775
+140, 126, 114, 125, 140, 155, 152, 130, // 4776-4783
+ 87,  64,  68, 102, 146, 168, 151, 117, // 4784-4791
+ 98, 113, 147, 177, 177, 145, 109,  91, // 4792-4799
+104, 132, 155, 151, 121,  94,  94, 120, // 4800-4807
+153, 166, 145, 107,  88,  98, 128, 154, // 4808-4815
+158, 130, 105,  99, 126, 153, 164, 138, // 4816-4823
+107,  94, 114, 137, 138, 121, 103, 104, // 4824-4831
+128, 149, 157, 143, 125, 109, 108, 127, // 4832-4839
+148, 156, 143, 122, 105, 111, 128, 143, // 4840-4847
+139, 127, 113, 107, 111, 123, 133, 136, // 4848-4855
+135, 128, 123, 123, 127, 133, 130, 125, // 4856-4863
+116, 117, 128, 142, 142, 135, 124, 118, // 4864-4871
+123, 132, 134, 133, 126, 122, 120, 122, // 4872-4879
+125, 129, 130, 130, 125, 122, 123, 126, // 4880-4887
+132, 134, 133, 132, 132, 131, 127, 121, // 4888-4895
+120, 120, 124, 123, 119, 112, 117, 125, // 4896-4903
+136, 141, 142, 134, 125, 124, 128, 134, // 4904-4911
+137, 133, 123, 122, 128, 134, 132, 125, // 4912-4919
+119, 122, 125, 124, 112, 112, 131, 151, // 4920-4927
+148, 129, 104, 100, 117, 138, 138, 125, // 4928-4935
+117, 121, 132, 139, 134, 123, 119, 131, // 4936-4943
+144, 152, 148, 129, 114, 113, 125, 133, // 4944-4951
+133, 121, 104, 104, 120, 138, 141, 132, // 4952-4959
+116, 109, 120, 141, 147, 140, 125, 114, // 4960-4967
+113, 121, 135, 137, 134, 123, 114, 112, // 4968-4975
+128, 142, 150, 142, 131, 118, 120, 128, // 4976-4983
+134, 135, 132, 121, 112, 113, 130, 152, // 4984-4991
+160, 140,  97,  67,  70, 100, 137, 154, // 4992-4999
+150, 132, 120, 119, 134, 155, 169, 164, // 5000-5007
+138, 116, 103, 109, 121, 136, 136, 138, // 5008-5015
+131, 128, 123, 126, 119, 106,  89,  98, // 5016-5023
+117, 151, 159, 144, 108,  96, 101, 129, // 5024-5031
+155, 163, 140, 114, 101, 115, 145, 174, // 5032-5039
+165, 131, 104, 104, 121, 144, 152, 155, // 5040-5047
+153, 156, 120,  58,  22,  37,  99, 171, // 5048-5055
+203, 162, 106,  76,  95, 144, 200, 205, // 5056-5063
+162, 102,  76,  80, 129, 168, 174, 137, // 5064-5071
+108,  88,  99, 129, 159, 152, 132, 109, // 5072-5079
+ 99, 109, 139, 147, 136, 119, 108, 102, // 5080-5087
+113, 125, 136, 140, 149, 142, 130, 122, // 5088-5095
+124, 124, 131, 131, 122, 109, 112, 123, // 5096-5103
+142, 159, 155, 125, 103, 106, 126, 151, // 5104-5111
+155, 140, 118, 114, 114, 103,  93, 101, // 5112-5119
+121, 147, 157, 144, 126, 127, 131, 133, // 5120-5127
+122, 112, 110, 127, 145, 153, 140, 128, // 5128-5135
+118, 122, 132, 139, 134, 120, 109, 106, // 5136-5143
+110, 122, 132, 136, 138, 135, 127, 120, // 5144-5151
+115, 118, 124, 134, 138, 140, 137, 136, // 5152-5159
+132, 127, 123, 121, 121, 125, 128, 127, // 5160-5167
+123, 120, 122, 124, 129, 135, 135, 131, // 5168-5175
+123, 113, 110, 118, 130, 132, 126, 124, // 5176-5183
+129, 145, 159, 157, 137, 119, 113, 121, // 5184-5191
+133, 141, 133, 116, 105, 100, 105, 115, // 5192-5199
+123, 129, 129, 131, 130, 128, 131, 137, // 5200-5207
+140, 142, 129, 113, 103, 117, 139, 157, // 5208-5215
+153, 138, 122, 123, 131, 135, 129, 127, // 5216-5223
+124, 126, 118, 106,  95, 104, 121, 134, // 5224-5231
+133, 126, 119, 128, 137, 142, 137, 127, // 5232-5239
+120, 120, 129, 144, 150, 147, 132, 120, // 5240-5247
+114, 123, 134, 137, 128, 117, 109, 110, // 5248-5255
+121, 127, 130, 127, 128, 126, 130, 128, // 5256-5263
+129, 128, 132, 128, 123, 114, 113, 117, // 5264-5271
+131, 142, 145, 138, 127, 119, 118, 124, // 5272-5279
+137, 141, 138, 126, 118, 117, 126, 138, // 5280-5287
+140, 137, 128, 123, 122, 126, 123, 116, // 5288-5295
+109, 107, 114, 126, 138, 137, 129, 118, // 5296-5303
+110, 105, 115, 137, 163, 174, 159, 119, // 5304-5311
+ 88,  91, 127, 165, 176, 155, 119,  95, // 5312-5319
+ 99, 115, 140, 154, 157, 134, 106,  80, // 5320-5327
+ 80,  97, 131, 151, 150, 128, 109,  94, // 5328-5335
+107, 132, 159, 158, 149, 128, 123, 130, // 5336-5343
+146, 142, 137, 132, 130, 119, 117, 127, // 5344-5351
+160, 187, 184, 110,  32,  14,  57, 147, // 5352-5359
+211, 214, 149,  84,  52,  75, 130, 188, // 5360-5367
+200, 168, 115,  79,  79, 123, 171, 185, // 5368-5375
+157, 115,  79,  78, 109, 148, 161, 151, // 5376-5383
+120,  99, 100, 129, 151, 154, 133, 111, // 5384-5391
+ 97, 112, 135, 146, 143, 129, 114, 108, // 5392-5399
+118, 133, 139, 138, 129, 117, 116, 125, // 5400-5407
+138, 142, 141, 130, 121, 117, 125, 131, // 5408-5415
+136, 131, 121, 112, 119, 128, 137, 135, // 5416-5423
+128, 118, 114, 120, 127, 133, 138, 135, // 5424-5431
+125, 120, 118, 126, 132, 138, 132, 126, // 5432-5439
+120, 123, 126, 136, 138, 137, 127, 119, // 5440-5447
+116, 123, 132, 138, 133, 122, 111, 107, // 5448-5455
+116, 132, 141, 142, 132, 125, 122, 132, // 5456-5463
+137, 134, 119, 111, 110, 124, 137, 143, // 5464-5471
+134, 125, 118, 122, 128, 135, 134, 128, // 5472-5479
+118, 114, 118, 130, 141, 142, 130, 121, // 5480-5487
+113, 115, 125, 139, 144, 149, 140, 128, // 5488-5495
+113, 109, 107, 113, 121, 134, 137, 134, // 5496-5503
+120, 107, 106, 128, 148, 158, 148, 131, // 5504-5511
+114, 111, 119, 128, 140, 141, 130, 112, // 5512-5519
+111, 120, 139, 145, 140, 135, 150, 166, // 5520-5527
+153,  91,  37,  25,  82, 169, 228, 210, // 5528-5535
+142,  71,  47,  80, 143, 187, 187, 148, // 5536-5543
+100,  78,  98, 138, 172, 169, 144, 103, // 5544-5551
+ 85,  93, 127, 153, 167, 149, 125, 104, // 5552-5559
+108, 118, 133, 135, 137, 124, 118, 102, // 5560-5567
+ 98, 104, 135, 154, 161, 141, 120, 102, // 5568-5575
+111, 127, 147, 150, 149, 126, 113, 107, // 5576-5583
+121, 133, 144, 136, 123, 111, 111, 115, // 5584-5591
+123, 134, 140, 135, 124, 122, 138, 169, // 5592-5599
+180, 149,  73,  43,  50, 124, 184, 213, // 5600-5607
+167, 111,  64,  79, 116, 171, 184, 166, // 5608-5615
+114,  83,  74, 112, 151, 176, 155, 127, // 5616-5623
+ 94,  91, 109, 139, 152, 152, 137, 123, // 5624-5631
+112, 115, 120, 128, 134, 136, 135, 127, // 5632-5639
+122, 114, 115, 125, 138, 142, 141, 128, // 5640-5647
+117, 107, 113, 123, 136, 144, 139, 124, // 5648-5655
+112, 112, 125, 136, 142, 133, 122, 115, // 5656-5663
+120, 127, 135, 137, 134, 127, 124, 123, // 5664-5671
+126, 132, 135, 132, 126, 120, 116, 120, // 5672-5679
+126, 134, 133, 131, 124, 120, 122, 124, // 5680-5687
+127, 127, 126, 122, 123, 126, 133, 135, // 5688-5695
+134, 128, 123, 121, 126, 130, 135, 133, // 5696-5703
+132, 125, 125, 126, 134, 140, 142, 127, // 5704-5711
+111,  95, 100, 118, 145, 155, 150, 126, // 5712-5719
+109, 102, 114, 131, 144, 143, 132, 119, // 5720-5727
+113, 118, 128, 135, 137, 129, 125, 124, // 5728-5735
+130, 136, 138, 132, 127, 120, 120, 121, // 5736-5743
+126, 127, 128, 126, 126, 126, 130, 132, // 5744-5751
+133, 129, 125, 121, 122, 124, 125, 128, // 5752-5759
+126, 125, 122, 124, 126, 129, 132, 130, // 5760-5767
+126, 126, 126, 130, 134, 132, 131, 128, // 5768-5775
+129, 127, 129, 127, 123, 119, 117, 120, // 5776-5783
+127, 136, 142, 139, 127, 113, 110, 115, // 5784-5791
+131, 139, 141, 132, 123, 121, 123, 130, // 5792-5799
+131, 132, 128, 126, 121, 118, 117, 120, // 5800-5807
+128, 137, 138, 133, 122, 118, 122, 134, // 5808-5815
+143, 143, 134, 124, 118, 123, 126, 131, // 5816-5823
+125, 122, 118, 122, 126, 132, 132, 129, // 5824-5831
+127, 125, 124, 126, 128, 129, 127, 125, // 5832-5839
+121, 121, 123, 125, 131, 132, 133, 130, // 5840-5847
+128, 127, 131, 133, 135, 131, 126, 120, // 5848-5855
+118, 121, 130, 137, 143, 134, 119, 102, // 5856-5863
+101, 115, 135, 150, 147, 132, 114, 109, // 5864-5871
+115, 133, 144, 145, 133, 120, 112, 116, // 5872-5879
+127, 139, 140, 134, 122, 116, 116, 124, // 5880-5887
+132, 136, 135, 128, 123, 123, 126, 133, // 5888-5895
+133, 132, 127, 125, 123, 123, 118, 120, // 5896-5903
+126, 135, 139, 132, 119, 109, 111, 124, // 5904-5911
+135, 140, 136, 127, 124, 125, 130, 132, // 5912-5919
+134, 131, 126, 123, 123, 125, 128, 129, // 5920-5927
+125, 121, 121, 126, 131, 134, 131, 125, // 5928-5935
+120, 120, 125, 130, 133, 132, 128, 124, // 5936-5943
+123, 125, 130, 134, 135, 133, 129, 123, // 5944-5951
+124, 128, 135, 135, 131, 126, 125, 131, // 5952-5959
+131, 122,  99,  91, 101, 128, 152, 157, // 5960-5967
+142, 121, 111, 113, 126, 137, 142, 139, // 5968-5975
+130, 121, 115, 117, 128, 136, 138, 131, // 5976-5983
+122, 119, 122, 128, 133, 140, 148, 154, // 5984-5991
+147, 124,  92,  76,  84, 116, 148, 161, // 5992-5999
+149, 123, 101, 104, 122, 150, 162, 154, // 6000-6007
+130, 107, 100, 113, 132, 147, 146, 133, // 6008-6015
+115, 106, 110, 126, 142, 150, 139, 128, // 6016-6023
+117, 126, 139, 150, 133, 102,  76,  78, // 6024-6031
+114, 158, 181, 169, 131,  93,  85, 106, // 6032-6039
+141, 165, 163, 137, 108,  91, 104, 128, // 6040-6047
+152, 156, 141, 115, 100, 100, 118, 136, // 6048-6055
+148, 142, 130, 116, 117, 124, 138, 142, // 6056-6063
+136, 123, 114, 113, 123, 134, 140, 134, // 6064-6071
+128, 121, 121, 127, 134, 139, 137, 130, // 6072-6079
+118, 110, 109, 116, 129, 139, 142, 134, // 6080-6087
+122, 113, 113, 121, 133, 140, 139, 132, // 6088-6095
+120, 116, 118, 129, 136, 139, 136, 130, // 6096-6103
+128, 132, 134, 135, 126, 115, 106, 106, // 6104-6111
+115, 129, 139, 142, 133, 122, 116, 121, // 6112-6119
+129, 140, 137, 131, 120, 119, 124, 133, // 6120-6127
+137, 135, 128, 123, 122, 123, 126, 129, // 6128-6135
+126, 127, 124, 123, 122, 122, 124, 128, // 6136-6143
+133, 134, 135, 132, 132, 130, 130, 127, // 6144-6151
+127, 123, 125, 125, 128, 127, 126, 129, // 6152-6159
+134, 136, 131, 113,  96,  91, 109, 136, // 6160-6167
+159, 161, 144, 116, 102, 103, 124, 144, // 6168-6175
+153, 146, 129, 112, 108, 117, 132, 144, // 6176-6183
+142, 133, 118, 110, 114, 124, 135, 139, // 6184-6191
+133, 125, 117, 118, 122, 130, 132, 133, // 6192-6199
+129, 126, 124, 128, 131, 137, 138, 139, // 6200-6207
+132, 127, 121, 121, 118, 119, 116, 114, // 6208-6215
+117, 122, 131, 136, 137, 133, 127, 123, // 6216-6223
+123, 125, 131, 134, 133, 130, 123, 122, // 6224-6231
+123, 128, 131, 132, 127, 125, 123, 124, // 6232-6239
+127, 128, 127, 127, 126, 127, 126, 124, // 6240-6247
+124, 126, 131, 134, 133, 130, 130, 142, // 6248-6255
+152, 155, 134,  94,  65,  63, 102, 151, // 6256-6263
+185, 176, 140,  98,  86, 104, 140, 167, // 6264-6271
+167, 142, 110,  90,  93, 113, 139, 154, // 6272-6279
+153, 132, 114, 101, 108, 126, 144, 149, // 6280-6287
+139, 118, 108, 110, 125, 141, 147, 141, // 6288-6295
+130, 118, 118, 123, 136, 145, 150, 143, // 6296-6303
+124, 103,  88,  95, 115, 142, 152, 145, // 6304-6311
+123, 107, 104, 121, 139, 152, 146, 134, // 6312-6319
+115, 112, 112, 128, 135, 145, 137, 133, // 6320-6327
+120, 123, 128, 142, 143, 136, 111,  97, // 6328-6335
+ 92, 113, 133, 153, 145, 133, 111, 110, // 6336-6343
+114, 133, 141, 145, 137, 128, 118, 116, // 6344-6351
+120, 130, 140, 143, 136, 122, 110, 111, // 6352-6359
+124, 135, 142, 132, 120, 112, 120, 128, // 6360-6367
+135, 127, 127, 131, 155, 164, 165, 114, // 6368-6375
+ 72,  42,  72, 124, 185, 195, 174, 116, // 6376-6383
+ 82,  75, 113, 149, 178, 165, 139,  99, // 6384-6391
+ 87,  94, 122, 149, 163, 152, 127, 103, // 6392-6399
+ 96, 107, 132, 151, 151, 137, 115, 104, // 6400-6407
+108, 125, 140, 147, 140, 127, 116, 116, // 6408-6415
+123, 136, 140, 141, 131, 121, 116, 120, // 6416-6423
+127, 140, 143, 140, 126, 110,  97,  95, // 6424-6431
+103, 125, 144, 156, 149, 133, 110, 105, // 6432-6439
+111, 133, 148, 153, 140, 123, 109, 111, // 6440-6447
+122, 141, 150, 151, 142, 131, 119, 112, // 6448-6455
+105, 107, 110, 122, 132, 141, 138, 132, // 6456-6463
+120, 116, 115, 126, 135, 143, 140, 134, // 6464-6471
+123, 120, 122, 128, 135, 135, 131, 121, // 6472-6479
+116, 114, 122, 128, 134, 131, 127, 122, // 6480-6487
+124, 128, 136, 138, 139, 131, 126, 120, // 6488-6495
+121, 123, 128, 129, 128, 126, 123, 122, // 6496-6503
+123, 123, 127, 127, 129, 129, 130, 129, // 6504-6511
+127, 126, 124, 124, 126, 127, 129, 129, // 6512-6519
+130, 131, 129, 130, 129, 130, 129, 131, // 6520-6527
+128, 126, 118, 116, 116, 125, 134, 140, // 6528-6535
+136, 126, 112, 110, 117, 133, 146, 147, // 6536-6543
+138, 122, 110, 110, 118, 133, 142, 141, // 6544-6551
+133, 121, 115, 115, 125, 133, 140, 138, // 6552-6559
+134, 130, 131, 136, 139, 132, 117, 102, // 6560-6567
+ 93, 101, 119, 139, 151, 149, 133, 119, // 6568-6575
+110, 115, 127, 138, 145, 141, 132, 120, // 6576-6583
+115, 116, 125, 133, 140, 136, 129, 117, // 6584-6591
+115, 116, 127, 134, 136, 132, 129, 131, // 6592-6599
+140, 146, 145, 124,  98,  80,  84, 110, // 6600-6607
+145, 170, 171, 148, 115,  93,  93, 112, // 6608-6615
+140, 158, 158, 142, 119, 103, 104, 118, // 6616-6623
+138, 150, 148, 133, 114, 104, 107, 122, // 6624-6631
+138, 146, 141, 129, 115, 111, 114, 127, // 6632-6639
+135, 141, 135, 126, 118, 116, 122, 131, // 6640-6647
+138, 138, 133, 124, 117, 118, 124, 132, // 6648-6655
+137, 135, 131, 125, 125, 127, 130, 131, // 6656-6663
+129, 123, 116, 113, 113, 118, 126, 135, // 6664-6671
+141, 140, 135, 125, 119, 116, 122, 129, // 6672-6679
+134, 137, 131, 125, 120, 119, 125, 132, // 6680-6687
+137, 139, 134, 133, 129, 131, 131, 130, // 6688-6695
+122, 116, 107, 107, 111, 121, 132, 139, // 6696-6703
+140, 136, 127, 123, 121, 126, 130, 136, // 6704-6711
+137, 133, 125, 121, 119, 122, 128, 131, // 6712-6719
+132, 127, 123, 121, 124, 128, 134, 135, // 6720-6727
+134, 130, 127, 125, 127, 127, 129, 127, // 6728-6735
+125, 122, 119, 120, 122, 126, 127, 130, // 6736-6743
+127, 127, 127, 127, 130, 132, 132, 131, // 6744-6751
+128, 127, 127, 127, 125, 125, 125, 124, // 6752-6759
+127, 127, 130, 128, 129, 126, 128, 126, // 6760-6767
+128, 127, 126, 125, 126, 126, 129, 128, // 6768-6775
+130, 127, 124, 121, 122, 126, 130, 134, // 6776-6783
+135, 129, 126, 122, 124, 127, 133, 133, // 6784-6791
+132, 126, 125, 124, 128, 130, 130, 129, // 6792-6799
+125, 123, 122, 122, 123, 122, 121, 121, // 6800-6807
+121, 127, 130, 134, 133, 132, 130, 130, // 6808-6815
+136, 141, 142, 136, 120, 107,  98, 105, // 6816-6823
+119, 137, 148, 146, 135, 121, 113, 112, // 6824-6831
+121, 132, 139, 142, 136, 127, 117, 114, // 6832-6839
+118, 129, 138, 141, 135, 123, 115, 115, // 6840-6847
+123, 134, 137, 134, 127, 121, 121, 125, // 6848-6855
+129, 130, 133, 136, 146, 152, 148, 124, // 6856-6863
+ 96,  76,  80, 105, 137, 161, 163, 147, // 6864-6871
+122, 107, 107, 121, 139, 149, 148, 135, // 6872-6879
+118, 108, 107, 119, 134, 146, 144, 135, // 6880-6887
+119, 108, 110, 120, 134, 143, 140, 133, // 6888-6895
+121, 118, 119, 126, 134, 138, 134, 128, // 6896-6903
+122, 120, 121, 125, 127, 130, 129, 127, // 6904-6911
+126, 126, 127, 128, 130, 132, 134, 134, // 6912-6919
+130, 123, 114, 108, 110, 120, 136, 145, // 6920-6927
+146, 136, 122, 114, 115, 123, 135, 140, // 6928-6935
+138, 128, 118, 114, 118, 125, 136, 138, // 6936-6943
+138, 132, 128, 130, 136, 142, 139, 126, // 6944-6951
+107,  92,  91, 104, 129, 148, 159, 149, // 6952-6959
+131, 113, 106, 114, 130, 144, 149, 142, // 6960-6967
+128, 115, 110, 114, 124, 135, 140, 137, // 6968-6975
+129, 118, 111, 113, 122, 135, 142, 141, // 6976-6983
+129, 118, 116, 127, 147, 161, 157, 129, // 6984-6991
+ 92,  69,  70, 105, 145, 179, 178, 155, // 6992-6999
+116,  94,  90, 112, 139, 158, 157, 140, // 7000-7007
+116, 102, 100, 116, 133, 150, 148, 139, // 7008-7015
+120, 108, 106, 119, 133, 145, 144, 134, // 7016-7023
+120, 111, 113, 122, 135, 142, 141, 133, // 7024-7031
+124, 117, 116, 122, 130, 135, 136, 132, // 7032-7039
+125, 119, 119, 123, 130, 134, 134, 130, // 7040-7047
+127, 127, 132, 133, 131, 119, 110, 106, // 7048-7055
+114, 127, 142, 147, 141, 127, 114, 109, // 7056-7063
+116, 129, 139, 144, 138, 128, 117, 115, // 7064-7071
+119, 132, 141, 148, 144, 135, 121, 113, // 7072-7079
+109, 115, 121, 129, 130, 130, 122, 119, // 7080-7087
+117, 122, 127, 136, 139, 136, 131, 126, // 7088-7095
+122, 123, 125, 130, 133, 130, 127, 120, // 7096-7103
+118, 118, 125, 130, 136, 136, 132, 126, // 7104-7111
+124, 125, 130, 134, 135, 132, 126, 121, // 7112-7119
+119, 121, 126, 129, 129, 127, 123, 121, // 7120-7127
+122, 125, 128, 131, 131, 128, 127, 125, // 7128-7135
+125, 127, 128, 130, 128, 127, 125, 125, // 7136-7143
+126, 127, 130, 130, 129, 128, 127, 127, // 7144-7151
+127, 130, 129, 131, 128, 128, 124, 125, // 7152-7159
+125, 129, 131, 131, 128, 121, 114, 112, // 7160-7167
+116, 125, 136, 142, 143, 138, 128, 122, // 7168-7175
+119, 121, 127, 130, 132, 129, 125, 122, // 7176-7183
+119, 121, 125, 131, 133, 133, 130, 126, // 7184-7191
+128, 131, 139, 144, 142, 133, 116, 100, // 7192-7199
+ 94,  98, 114, 131, 147, 151, 145, 134, // 7200-7207
+122, 115, 116, 122, 133, 139, 139, 133, // 7208-7215
+124, 118, 116, 119, 128, 133, 137, 133, // 7216-7223
+126, 119, 118, 121, 130, 135, 138, 131, // 7224-7231
+124, 117, 119, 127, 138, 144, 142, 129, // 7232-7239
+115, 105, 108, 118, 132, 141, 141, 133, // 7240-7247
+124, 118, 118, 123, 131, 135, 134, 129, // 7248-7255
+124, 121, 121, 125, 128, 133, 133, 130, // 7256-7263
+127, 123, 122, 124, 128, 131, 131, 130, // 7264-7271
+126};// 7272-7272
+
+
+#define KAPOW_N 5352
+const uint8_t kapow[KAPOW_N] = {
+121, 114, 143, 165, 106,  24, 151, 233, // 0-7
+142,  59,  98, 214, 163,  61,  69, 155, // 8-15
+194, 107,  61, 134, 189, 134,  38, 126, // 16-23
+203, 186,  78,  83,  88, 195, 160, 117, // 24-31
+ 89,  78, 169, 223,  51,  69, 208, 153, // 32-39
+ 31, 111, 165, 183, 128,  57, 139, 177, // 40-47
+123,  88,  99, 150, 164, 122, 132, 135, // 48-55
+135,  89,  98, 167, 180, 113, 102,  59, // 56-63
+139, 137, 165, 185, 119,  21, 116, 174, // 64-71
+193,  82, 108, 164, 167,  64,  87, 158, // 72-79
+202,  87,  37, 127, 198, 144, 109, 110, // 80-87
+162, 167,  95, 107, 147, 133, 104, 114, // 88-95
+125, 134, 108, 136, 151, 130, 106, 104, // 96-103
+138, 160, 141, 147, 111, 115, 134, 131, // 104-111
+ 96, 108, 135, 151, 121,  99, 145, 171, // 112-119
+126,  81, 119, 183, 140, 100, 112, 147, // 120-127
+146, 114,  95, 149, 162, 119, 113, 135, // 128-135
+144, 112, 109, 147, 126, 126, 116, 109, // 136-143
+136, 137, 136, 144, 117, 126, 121, 118, // 144-151
+129, 127, 131, 150, 125, 109, 118, 129, // 152-159
+128, 110, 105, 134, 119,  88, 110, 162, // 160-167
+162, 133, 138, 151, 148, 126,  97, 108, // 168-175
+144, 113,  95, 125, 138, 107, 125, 130, // 176-183
+155, 138, 129, 129, 143, 141, 130, 119, // 184-191
+123, 151, 136, 112, 110, 131, 153, 134, // 192-199
+115, 147, 148, 125, 113, 121, 133, 149, // 200-207
+124,  98, 132, 136, 128, 121, 135, 141, // 208-215
+126, 115, 112, 124, 128, 102, 127, 124, // 216-223
+121, 104, 132, 132, 115, 113, 126, 139, // 224-231
+139, 128, 123, 142, 135, 129, 138, 151, // 232-239
+134, 138, 130, 114, 110, 147, 135, 135, // 240-247
+ 90,  92, 118, 115,  63,  76, 129, 161, // 248-255
+117, 127, 138, 159, 174, 180, 148, 177, // 256-263
+160, 164, 150, 157, 145, 143, 116, 178, // 264-271
+ 97,   4,  34,  92,  64,  13,  34, 117, // 272-279
+210, 208, 154, 143, 190, 182, 167, 131, // 280-287
+143, 183, 181, 147, 107, 134, 170, 188, // 288-295
+138,  13,  69, 105,  88,  57,  80,  82, // 296-303
+177, 197, 154, 133, 158, 153, 167, 143, // 304-311
+127, 143, 161, 138, 115, 106, 131, 188, // 312-319
+180, 145,  61,  38,  90,  72,  51,  45, // 320-327
+ 78, 130, 192, 171, 146, 145, 162, 153, // 328-335
+160, 138, 145, 160, 159, 121, 121, 127, // 336-343
+162, 198, 184, 107,  25,  59,  77,  58, // 344-351
+ 55,  41,  75, 188, 216, 186, 153, 132, // 352-359
+145, 175, 151, 130, 142, 149, 147, 139, // 360-367
+127, 139, 184, 188, 157,  28,  12,  41, // 368-375
+ 79,  82,  67,  26, 149, 238, 230, 170, // 376-383
+117,  98, 173, 187, 149, 118, 117, 129, // 384-391
+170, 169, 158, 170, 166, 110,   7,  19, // 392-399
+ 26,  71, 107,  87,  73, 193, 211, 212, // 400-407
+168,  97, 102, 174, 171, 159, 115,  99, // 408-415
+142, 179, 179, 185, 172, 154,  23,  28, // 416-423
+ 26,  34,  72,  79,  49, 162, 233, 229, // 424-431
+204, 127,  86, 141, 170, 155, 139, 109, // 432-439
+124, 165, 180, 185, 170, 148,  59,   7, // 440-447
+ 44,  13,  67,  75,  68, 154, 220, 227, // 448-455
+211, 136,  75, 114, 147, 161, 149, 125, // 456-463
+121, 157, 182, 194, 182, 178,  88,   4, // 464-471
+ 23,  23,  85, 100,  85, 127, 195, 209, // 472-479
+193, 158, 116, 121, 148, 170, 153, 155, // 480-487
+163, 172, 142, 151, 125, 134,  71,   5, // 488-495
+ 20,  43, 103, 110, 130, 130, 187, 200, // 496-503
+209, 136, 108,  96, 126, 169, 170, 160, // 504-511
+150, 153, 140, 143, 143, 150,  91,  55, // 512-519
+ 14,  11,  36,  95, 133, 135, 130, 116, // 520-527
+103, 147, 220, 141, 130, 185, 235, 221, // 528-535
+193, 169, 189, 204, 237, 222, 119,  14, // 536-543
+ 16,  53, 120, 163, 131,  84,  82,  80, // 544-551
+121, 167, 168, 172, 158, 151, 152, 149, // 552-559
+134, 138, 122,  75,  44,  68,  67, 118, // 560-567
+179, 137, 160, 166, 167, 166, 150, 157, // 568-575
+138, 138, 125, 126, 167, 183, 181,  58, // 576-583
+  4,  73, 126, 154, 165, 181, 139, 109, // 584-591
+116, 103,  88,  83,  97, 123, 133, 134, // 592-599
+125, 128, 129, 143, 151, 151, 132, 129, // 600-607
+132, 132, 127, 129, 128, 123, 112, 112, // 608-615
+113, 119, 122, 128, 128, 132, 133, 135, // 616-623
+134, 135, 133, 134, 132, 132, 133, 136, // 624-631
+135, 137, 134, 136, 133, 132, 133, 129, // 632-639
+117, 114, 112, 112, 114, 122, 127, 130, // 640-647
+133, 133, 130, 128, 128, 129, 131, 132, // 648-655
+131, 131, 131, 130, 130, 130, 130, 130, // 656-663
+129, 127, 126, 124, 122, 122, 122, 122, // 664-671
+122, 122, 123, 125, 127, 128, 128, 128, // 672-679
+129, 128, 128, 128, 128, 128, 128, 128, // 680-687
+127, 126, 126, 126, 127, 127, 127, 128, // 688-695
+128, 127, 128, 128, 128, 128, 128, 127, // 696-703
+127, 127, 127, 127, 128, 127, 127, 127, // 704-711
+128, 127, 128, 127, 127, 127, 127, 127, // 712-719
+128, 128, 129, 128, 129, 129, 130, 130, // 720-727
+130, 130, 130, 130, 130, 129, 129, 128, // 728-735
+127, 127, 126, 125, 125, 125, 125, 124, // 736-743
+125, 125, 126, 126, 126, 126, 128, 128, // 744-751
+129, 129, 129, 129, 130, 129, 129, 129, // 752-759
+129, 128, 128, 128, 128, 127, 128, 128, // 760-767
+129, 128, 129, 128, 127, 126, 127, 127, // 768-775
+127, 128, 128, 128, 128, 127, 127, 126, // 776-783
+126, 126, 126, 126, 127, 127, 126, 125, // 784-791
+125, 127, 128, 128, 127, 128, 129, 130, // 792-799
+129, 129, 129, 129, 129, 128, 127, 127, // 800-807
+127, 127, 127, 127, 127, 128, 128, 127, // 808-815
+127, 127, 126, 127, 127, 128, 128, 129, // 816-823
+129, 129, 128, 128, 128, 128, 128, 128, // 824-831
+128, 128, 128, 128, 128, 128, 128, 128, // 832-839
+127, 128, 128, 128, 127, 127, 127, 127, // 840-847
+127, 127, 127, 127, 127, 128, 127, 127, // 848-855
+127, 127, 127, 127, 127, 127, 127, 127, // 856-863
+128, 128, 128, 127, 127, 128, 128, 128, // 864-871
+128, 128, 128, 129, 129, 128, 127, 126, // 872-879
+123, 124, 126, 126, 127, 127, 128, 128, // 880-887
+128, 128, 128, 129, 129, 129, 129, 129, // 888-895
+129, 129, 129, 129, 129, 128, 128, 128, // 896-903
+128, 128, 128, 128, 128, 127, 127, 127, // 904-911
+127, 127, 127, 126, 126, 126, 126, 125, // 912-919
+127, 126, 126, 128, 129, 128, 129, 129, // 920-927
+130, 128, 126, 125, 125, 126, 129, 129, // 928-935
+130, 128, 127, 127, 128, 128, 124, 127, // 936-943
+129, 131, 135, 134, 132, 129, 125, 124, // 944-951
+125, 126, 131, 131, 129, 127, 125, 124, // 952-959
+125, 127, 129, 128, 129, 126, 127, 127, // 960-967
+128, 127, 127, 128, 126, 122, 122, 121, // 968-975
+123, 126, 129, 131, 132, 130, 128, 126, // 976-983
+125, 115, 113, 122, 128, 130, 133, 124, // 984-991
+124, 127, 126, 125, 137, 152, 146, 126, // 992-999
+119, 117, 128, 134, 134, 137, 139, 128, // 1000-1007
+127, 128, 123, 126, 131, 131, 132, 132, // 1008-1015
+125, 113, 118, 135, 135, 131, 125, 113, // 1016-1023
+100, 106, 104,  89, 128, 176, 187, 152, // 1024-1031
+107, 131, 144, 150, 132, 136, 151, 143, // 1032-1039
+127, 130, 126, 130, 104,  86, 100, 125, // 1040-1047
+125, 124, 126, 130, 123, 126, 123, 124, // 1048-1055
+118, 120, 122, 127, 127, 130, 129, 132, // 1056-1063
+127, 131, 127, 130, 124, 126, 120, 129, // 1064-1071
+126, 130, 126, 128, 133, 134, 133, 133, // 1072-1079
+130, 131, 127, 131, 130, 132, 124, 121, // 1080-1087
+117, 113,  97,  86,  79,  96,  95, 107, // 1088-1095
+ 95, 123, 196, 177, 208, 176, 174, 129, // 1096-1103
+166, 170, 196, 163, 131, 121, 135, 153, // 1104-1111
+152, 143, 130, 115, 104, 104, 103, 101, // 1112-1119
+ 99,  99, 110, 129, 134, 119, 106,  79, // 1120-1127
+ 67,  94, 116, 141, 141, 143, 108,  93, // 1128-1135
+ 86, 121, 110,  34,  99, 203, 204, 210, // 1136-1143
+162, 136, 125, 117, 126, 100,  68,  74, // 1144-1151
+ 89,  92, 119,  87, 131, 202, 251, 214, // 1152-1159
+158, 136, 154, 191, 178, 162, 146, 127, // 1160-1167
+124, 129, 124, 117, 111, 106, 112, 112, // 1168-1175
+118, 115, 117, 116, 117, 115, 117, 113, // 1176-1183
+123, 131, 141, 143, 141, 102,  81,  76, // 1184-1191
+ 96, 108, 117, 106,  99,  84,  79,  82, // 1192-1199
+101,  99, 119, 114, 122, 105, 135, 210, // 1200-1207
+221, 184, 226, 191,  57, 113, 183, 189, // 1208-1215
+112, 105, 192, 168, 148, 176, 162, 116, // 1216-1223
+ 65, 116, 128, 152, 101,  76,  71, 114, // 1224-1231
+153, 204, 166, 123,  97, 150, 131,  85, // 1232-1239
+170, 150, 137, 135, 121, 105,  97,  90, // 1240-1247
+ 81,  83,  92,  93,  92, 103, 109, 137, // 1248-1255
+146, 134, 110,  74,  73,  89,  94,  96, // 1256-1263
+158, 225,  93, 109,  81, 207, 198, 154, // 1264-1271
+174, 163, 204, 169, 106, 113, 135, 137, // 1272-1279
+153,  79,  84,  92,  97, 115, 143, 106, // 1280-1287
+ 99, 109, 159, 209, 161, 149, 149, 167, // 1288-1295
+ 80,  80,  77, 175, 180, 124, 148, 200, // 1296-1303
+153, 104, 112, 151, 160, 112, 129,  50, // 1304-1311
+ 67,  67,  89,  80,  99,  82, 175, 111, // 1312-1319
+121, 170, 142, 207, 180,  70,  79,  90, // 1320-1327
+ 97, 101,  96, 196, 227, 106,  88,  93, // 1328-1335
+102,  99, 196, 232, 145,  80,  97,  99, // 1336-1343
+156, 104, 113, 103, 163, 136, 114, 102, // 1344-1351
+151, 207, 106, 105, 109, 105, 128, 205, // 1352-1359
+193, 114,  74, 167, 151,  77, 164,  99, // 1360-1367
+124, 175, 179, 143,  61, 107,  87,  87, // 1368-1375
+139, 223,  96,  68, 129, 217, 142,  88, // 1376-1383
+ 83,  85,  92, 158, 148, 101,  92, 104, // 1384-1391
+117, 108,  87, 170, 208, 186, 172, 169, // 1392-1399
+142, 102,  61,  79, 176, 168, 140, 109, // 1400-1407
+135, 148, 151, 114,  58,  71, 116, 167, // 1408-1415
+204, 133,  60,  65, 120, 133, 112, 144, // 1416-1423
+170,  75,  97, 106, 101, 160, 178, 208, // 1424-1431
+180, 143, 167, 120, 115, 144, 167, 139, // 1432-1439
+112,  96, 114, 127, 133, 138, 124, 119, // 1440-1447
+107, 100,  76,  60,  73,  72,  94, 188, // 1448-1455
+204, 165,  72,  72, 168, 213, 181, 153, // 1456-1463
+116, 102,  86,  88,  94, 155, 203, 194, // 1464-1471
+145, 129,  90,  66,  90,  89, 119, 112, // 1472-1479
+104, 120, 101, 113, 218, 229, 148, 141, // 1480-1487
+139, 140, 136, 187, 147, 106,  89, 128, // 1488-1495
+175, 150, 105,  78,  98, 122, 135,  74, // 1496-1503
+ 73, 131, 159, 171, 162, 142, 139, 170, // 1504-1511
+175, 132,  98,  68,  74,  89,  76,  77, // 1512-1519
+ 84,  96, 121, 150, 181, 193, 192, 147, // 1520-1527
+129,  87,  70, 104, 153, 175, 184, 167, // 1528-1535
+128, 105,  91,  94, 109, 103, 128, 151, // 1536-1543
+163, 158, 137, 133, 124, 113, 113, 112, // 1544-1551
+117, 123, 130, 123, 131, 139, 139, 129, // 1552-1559
+120, 125, 115, 131, 135, 117, 109, 124, // 1560-1567
+112, 111, 135, 125, 120, 128, 141, 126, // 1568-1575
+125, 130, 127, 138, 133, 125, 141, 140, // 1576-1583
+118, 137, 127, 118, 138, 128, 125, 134, // 1584-1591
+136, 139, 137, 138, 130, 128, 126, 130, // 1592-1599
+120, 122, 127, 134, 134, 123, 114, 130, // 1600-1607
+130, 120, 125, 122, 130, 136, 131, 126, // 1608-1615
+128, 124, 120, 134, 128, 117, 127, 125, // 1616-1623
+127, 121, 116, 120, 143, 120, 127, 139, // 1624-1631
+126, 130, 135, 124, 126, 133, 122, 121, // 1632-1639
+126, 129, 124, 130, 136, 127, 116, 115, // 1640-1647
+125, 134, 118, 123, 144, 141, 140, 122, // 1648-1655
+123, 129, 135, 111, 127, 135, 122, 133, // 1656-1663
+132, 124, 116, 130, 112, 130, 136, 131, // 1664-1671
+129, 131, 133, 131, 125, 121, 130, 122, // 1672-1679
+131, 133, 130, 136, 111, 110, 123, 125, // 1680-1687
+134, 138, 130, 132, 146, 124, 116, 120, // 1688-1695
+144, 124, 122, 121, 129, 139, 119, 115, // 1696-1703
+120, 142, 112, 125, 137, 131, 127, 128, // 1704-1711
+135, 141, 126, 112, 135, 139, 120, 116, // 1712-1719
+121, 137, 133, 125, 118, 131, 122, 126, // 1720-1727
+132, 127, 129, 141, 140, 114, 125, 136, // 1728-1735
+122, 120, 128, 131, 138, 128, 113, 111, // 1736-1743
+124, 121, 130, 139, 136, 143, 141, 111, // 1744-1751
+120, 140, 123, 118, 132, 130, 126, 128, // 1752-1759
+124, 116, 121, 123, 124, 137, 139, 125, // 1760-1767
+125, 142, 134, 120, 129, 127, 121, 122, // 1768-1775
+124, 126, 133, 142, 110, 113, 147, 123, // 1776-1783
+108, 142, 134, 132, 130, 122, 133, 138, // 1784-1791
+126, 120, 131, 125, 129, 125, 124, 119, // 1792-1799
+120, 123, 121, 136, 150, 134, 127, 134, // 1800-1807
+133, 114, 116, 132, 129, 121, 131, 141, // 1808-1815
+134, 123, 106, 111, 125, 131, 136, 138, // 1816-1823
+136, 139, 131, 120, 119, 124, 126, 133, // 1824-1831
+125, 124, 126, 113, 111, 123, 142, 146, // 1832-1839
+139, 133, 133, 119, 114, 120, 128, 133, // 1840-1847
+137, 134, 136, 138, 109,  93, 115, 124, // 1848-1855
+129, 146, 153, 142, 129, 122, 115, 120, // 1856-1863
+116, 129, 135, 136, 139, 135, 113, 107, // 1864-1871
+125, 126, 116, 134, 151, 139, 128, 128, // 1872-1879
+126, 122, 124, 125, 128, 126, 132, 134, // 1880-1887
+104, 113, 134, 129, 138, 139, 129, 130, // 1888-1895
+136, 124, 114, 126, 130, 134, 139, 125, // 1896-1903
+114, 116, 114, 119, 140, 139, 140, 137, // 1904-1911
+129, 123, 124, 122, 119, 123, 138, 144, // 1912-1919
+128, 119, 120, 122, 119, 115, 132, 146, // 1920-1927
+132, 129, 136, 132, 128, 129, 115, 117, // 1928-1935
+137, 131, 122, 135, 135, 102, 118, 134, // 1936-1943
+120, 135, 153, 135, 117, 131, 123, 117, // 1944-1951
+122, 127, 139, 139, 130, 131, 121,  95, // 1952-1959
+114, 139, 122, 135, 159, 142, 118, 125, // 1960-1967
+114, 119, 134, 129, 129, 131, 131, 123, // 1968-1975
+111, 112, 126, 129, 143, 142, 139, 136, // 1976-1983
+121, 115, 118, 123, 127, 131, 137, 148, // 1984-1991
+132, 101, 104, 112, 117, 140, 152, 148, // 1992-1999
+147, 129, 107, 115, 127, 115, 126, 148, // 2000-2007
+141, 133, 129, 105,  96, 121, 128, 136, // 2008-2015
+151, 150, 131, 130, 123, 110, 117, 127, // 2016-2023
+127, 132, 133, 124, 128, 124, 117, 130, // 2024-2031
+138, 133, 128, 125, 133, 131, 122, 125, // 2032-2039
+136, 131, 114, 118, 141, 132, 104, 122, // 2040-2047
+138, 127, 128, 135, 137, 131, 119, 120, // 2048-2055
+138, 129, 115, 128, 144, 130, 125, 129, // 2056-2063
+122, 105, 117, 127, 132, 149, 148, 130, // 2064-2071
+128, 129, 113, 120, 112, 114, 143, 137, // 2072-2079
+125, 136, 129, 114, 123, 132, 123, 129, // 2080-2087
+141, 143, 131, 118, 123, 129, 124, 135, // 2088-2095
+136,  94, 104, 136, 135, 129, 136, 132, // 2096-2103
+140, 137, 112, 110, 135, 130, 122, 138, // 2104-2111
+137, 134, 133, 127, 109, 121, 128, 102, // 2112-2119
+122, 152, 133, 125, 139, 143, 129, 116, // 2120-2127
+120, 125, 118, 119, 119, 133, 136, 135, // 2128-2135
+133, 137, 132, 119, 118, 126, 132, 129, // 2136-2143
+141, 138, 123, 133, 112,  98, 112, 129, // 2144-2151
+136, 147, 149, 131, 122, 116, 104, 106, // 2152-2159
+131, 144, 149, 145, 132, 122, 128, 121, // 2160-2167
+121, 140, 158, 111,  81, 123, 132, 113, // 2168-2175
+123, 148, 149, 145, 131, 111, 112, 117, // 2176-2183
+104, 121, 157, 154, 131, 135, 140, 118, // 2184-2191
+109, 119, 128, 141, 146, 109, 109, 129, // 2192-2199
+122, 109, 125, 146, 151, 143, 119, 111, // 2200-2207
+121, 116, 112, 134, 156, 141, 126, 130, // 2208-2215
+133, 123, 122, 121, 123, 127, 149, 132, // 2216-2223
+106, 103, 124, 137, 128, 133, 137, 140, // 2224-2231
+118, 123, 114, 120, 127, 139, 141, 147, // 2232-2239
+133, 123, 122, 117, 123, 119, 128, 142, // 2240-2247
+128, 102, 127, 142, 126, 119, 133, 142, // 2248-2255
+139, 120, 108, 124, 143, 127, 110, 128, // 2256-2263
+138, 129, 130, 124, 127, 128, 134, 129, // 2264-2271
+131, 141, 143, 124, 135, 118,  59, 109, // 2272-2279
+145, 134, 133, 161, 158, 137, 107,  77, // 2280-2287
+100, 137, 129, 134, 168, 161, 124, 123, // 2288-2295
+122, 111, 110, 136, 155, 109, 110, 138, // 2296-2303
+123, 102, 119, 142, 146, 148, 130, 122, // 2304-2311
+119, 106,  98, 127, 146, 141, 150, 143, // 2312-2319
+130, 113, 116, 123, 126, 133, 142, 150, // 2320-2327
+134,  92,  98, 121, 117, 124, 144, 155, // 2328-2335
+153, 134, 105, 103, 112, 113, 124, 148, // 2336-2343
+158, 138, 121, 125, 134, 120, 118, 144, // 2344-2351
+139, 146, 141,  81,  87, 117, 116, 122, // 2352-2359
+159, 170, 150, 126, 108,  99,  99, 109, // 2360-2367
+127, 154, 168, 147, 129, 125, 122, 115, // 2368-2375
+110, 123, 157, 161,  88,  89, 129, 134, // 2376-2383
+119, 135, 142, 144, 144, 118,  99, 110, // 2384-2391
+121, 124, 141, 149, 149, 133, 119, 116, // 2392-2399
+122, 127, 136, 140, 148, 129,  79, 112, // 2400-2407
+130, 114, 117, 155, 157, 142, 132, 115, // 2408-2415
+ 99, 105, 111, 123, 151, 155, 144, 138, // 2416-2423
+129, 122, 117, 118, 128, 138, 141, 151, // 2424-2431
+122,  77, 111, 128, 112, 124, 153, 159, // 2432-2439
+153, 128,  98,  95, 106, 110, 135, 166, // 2440-2447
+163, 141, 120, 119, 123, 107, 127, 149, // 2448-2455
+139, 157, 126,  70,  92, 129, 117, 130, // 2456-2463
+164, 160, 149, 127,  95,  84, 115, 121, // 2464-2471
+132, 155, 159, 141, 124, 120, 127, 112, // 2472-2479
+113, 138, 149, 142, 147, 101,  88, 114, // 2480-2487
+120, 116, 137, 164, 158, 141, 117,  98, // 2488-2495
+ 95, 108, 117, 145, 162, 155, 132, 125, // 2496-2503
+114, 122, 119, 129, 151, 148, 149, 115, // 2504-2511
+ 73,  91, 120, 121, 134, 161, 167, 152, // 2512-2519
+128,  93,  80, 103, 124, 139, 156, 161, // 2520-2527
+146, 126, 118, 112, 120, 131, 135, 145, // 2528-2535
+160, 123,  69,  96, 122, 128, 131, 150, // 2536-2543
+156, 155, 132,  97,  96, 103, 108, 134, // 2544-2551
+148, 156, 157, 140, 113, 115, 123, 122, // 2552-2559
+130, 147, 141, 145, 110,  80, 107, 125, // 2560-2567
+127, 131, 149, 152, 152, 124,  98,  94, // 2568-2575
+109, 119, 136, 154, 153, 142, 133, 127, // 2576-2583
+119, 122, 112, 128, 148, 169, 138,  61, // 2584-2591
+ 91, 128, 119, 110, 147, 167, 169, 142, // 2592-2599
+ 96,  81, 108, 109, 122, 156, 172, 151, // 2600-2607
+125, 112, 117, 130, 118, 128, 148, 161, // 2608-2615
+156,  77,  61, 116, 132, 124, 135, 160, // 2616-2623
+162, 148, 114,  94,  97, 113, 119, 134, // 2624-2631
+158, 159, 140, 120, 110, 126, 137, 122, // 2632-2639
+127, 150, 162, 128,  66,  82, 121, 134, // 2640-2647
+129, 144, 160, 163, 133,  98, 100, 106, // 2648-2655
+ 99, 121, 157, 161, 153, 137, 114, 113, // 2656-2663
+124, 135, 134, 131, 134, 161, 131,  64, // 2664-2671
+ 84, 123, 131, 135, 151, 157, 158, 133, // 2672-2679
+ 93,  93, 104, 106, 128, 155, 169, 161, // 2680-2687
+133, 108, 109, 117, 127, 139, 133, 143, // 2688-2695
+147, 139,  95,  70, 114, 138, 136, 132, // 2696-2703
+148, 151, 144, 115,  97,  96, 116, 130, // 2704-2711
+144, 152, 160, 133, 108, 114, 133, 133, // 2712-2719
+118, 131, 148, 161, 144,  76,  56, 117, // 2720-2727
+142, 130, 134, 160, 166, 145, 109,  80, // 2728-2735
+ 92, 121, 130, 142, 159, 156, 135, 115, // 2736-2743
+111, 127, 133, 126, 138, 166, 166, 113, // 2744-2751
+ 33,  70, 123, 138, 153, 170, 165, 155, // 2752-2759
+121,  79,  79,  99, 127, 144, 161, 161, // 2760-2767
+147, 120,  99, 111, 139, 145, 142, 142, // 2768-2775
+170, 139,  31,  53, 127, 145, 149, 166, // 2776-2783
+158, 152, 130,  81,  79, 115, 123, 121, // 2784-2791
+157, 167, 144, 126, 117, 112, 127, 135, // 2792-2799
+132, 138, 146, 134, 160,  98,  36,  92, // 2800-2807
+146, 145, 151, 162, 150, 142, 112,  84, // 2808-2815
+ 95, 112, 114, 142, 170, 158, 140, 129, // 2816-2823
+108, 107, 121, 128, 149, 158, 142, 132, // 2824-2831
+146,  66,  51, 108, 134, 152, 176, 169, // 2832-2839
+145, 127,  92,  68,  85, 125, 154, 175, // 2840-2847
+166, 148, 127,  95, 100, 115, 138, 150, // 2848-2855
+145, 153, 154, 127,  36,  66, 137, 150, // 2856-2863
+143, 153, 155, 148, 127,  86,  85, 105, // 2864-2871
+136, 145, 156, 154, 146, 116, 100, 110, // 2872-2879
+131, 145, 141, 136, 144, 145, 142,  93, // 2880-2887
+ 45, 100, 136, 149, 143, 157, 155, 148, // 2888-2895
+113,  78,  88, 121, 137, 150, 153, 153, // 2896-2903
+133, 110, 101, 120, 142, 153, 147, 148, // 2904-2911
+143, 154,  66,  10,  91, 149, 172, 172, // 2912-2919
+175, 145, 133,  89,  62,  84, 134, 152, // 2920-2927
+158, 161, 143, 122, 105, 103, 136, 153, // 2928-2935
+142, 141, 134, 153, 143,  36,  47, 131, // 2936-2943
+156, 154, 165, 155, 143, 128,  87,  76, // 2944-2951
+ 98, 129, 147, 161, 158, 140, 118, 104, // 2952-2959
+109, 137, 147, 139, 137, 142, 142, 158, // 2960-2967
+ 80,  32,  98, 157, 145, 140, 158, 144, // 2968-2975
+140, 115,  96, 103, 116, 120, 144, 154, // 2976-2983
+140, 135, 134, 122, 121, 124, 125, 137, // 2984-2991
+136, 141, 158, 164,  79,  19,  86, 157, // 2992-2999
+163, 146, 152, 149, 148, 103,  74,  90, // 3000-3007
+138, 149, 144, 138, 147, 143, 116,  92, // 3008-3015
+122, 152, 153, 133, 134, 143, 160,  99, // 3016-3023
+ 17,  84, 141, 168, 167, 147, 134, 145, // 3024-3031
+114,  82,  87, 126, 142, 146, 147, 146, // 3032-3039
+133, 117, 115, 124, 140, 143, 136, 135, // 3040-3047
+128, 162, 143,  31,  54, 123, 152, 166, // 3048-3055
+168, 152, 142, 121,  67,  71, 123, 152, // 3056-3063
+149, 160, 152, 123, 104,  95, 128, 169, // 3064-3071
+151, 125, 118, 124, 136, 172, 107,  29, // 3072-3079
+ 93, 146, 160, 163, 149, 123, 133, 114, // 3080-3087
+ 75,  98, 142, 154, 150, 148, 131, 125, // 3088-3095
+108, 102, 131, 160, 148, 130, 129, 126, // 3096-3103
+148, 158,  66,  35, 126, 152, 152, 156, // 3104-3111
+143, 133, 140,  96,  68, 119, 153, 146, // 3112-3119
+142, 140, 135, 121, 101, 111, 148, 159, // 3120-3127
+147, 135, 120, 114, 153, 176,  50,  14, // 3128-3135
+107, 160, 180, 177, 143, 129, 130,  86, // 3136-3143
+ 56, 105, 159, 165, 162, 147, 123, 107, // 3144-3151
+103, 107, 152, 167, 144, 124, 131, 126, // 3152-3159
+141, 139,  46,  54, 133, 164, 167, 162, // 3160-3167
+133, 119, 124,  96,  78, 114, 151, 153, // 3168-3175
+158, 141, 121, 109, 111, 123, 153, 146, // 3176-3183
+145, 137, 120, 111, 169, 142,  18,  64, // 3184-3191
+132, 159, 186, 176, 121, 119, 115,  65, // 3192-3199
+ 95, 140, 140, 157, 164, 135, 126, 108, // 3200-3207
+ 86, 128, 164, 154, 146, 129, 114, 118, // 3208-3215
+164, 130,  44,  79, 129, 151, 167, 158, // 3216-3223
+125, 132, 123,  82,  86, 136, 148, 152, // 3224-3231
+150, 134, 129, 117,  97, 112, 152, 156, // 3232-3239
+143, 122, 128, 129, 160, 176,  56,  12, // 3240-3247
+109, 159, 157, 176, 146, 117, 140, 107, // 3248-3255
+ 68,  95, 150, 157, 156, 144, 123, 124, // 3256-3263
+108,  97, 134, 172, 165, 140, 111, 103, // 3264-3271
+140, 182,  97,  10,  75, 151, 184, 187, // 3272-3279
+149,  98, 120, 121,  98,  96, 119, 153, // 3280-3287
+172, 152, 115, 118, 120, 114, 122, 140, // 3288-3295
+153, 146, 138, 119, 123, 150, 158,  73, // 3296-3303
+ 33,  83, 142, 186, 188, 152, 116, 114, // 3304-3311
+ 96,  96,  97, 122, 159, 173, 145, 128, // 3312-3319
+117, 108, 114, 126, 140, 160, 156, 122, // 3320-3327
+105, 134, 146, 169,  79,  33,  73, 141, // 3328-3335
+198, 194, 156, 102, 106, 104,  89,  83, // 3336-3343
+124, 162, 182, 164, 121, 105, 109, 105, // 3344-3351
+123, 147, 165, 162, 125, 102, 130, 161, // 3352-3359
+149,  35,  31, 107, 176, 208, 181, 115, // 3360-3367
+ 99, 119, 102,  95,  90, 135, 179, 180, // 3368-3375
+135, 113, 110, 114, 117, 126, 144, 160, // 3376-3383
+157, 124, 120, 136, 155, 121,  18,  54, // 3384-3391
+129, 188, 204, 165, 102,  99, 108,  99, // 3392-3399
+106, 115, 140, 179, 160, 124, 112, 120, // 3400-3407
+113, 117, 119, 148, 160, 151, 108, 117, // 3408-3415
+140, 186, 134,  44,  89,  83, 180, 190, // 3416-3423
+171, 100,  92, 114, 110, 101, 101, 119, // 3424-3431
+166, 175, 136, 111, 112, 116, 123, 125, // 3432-3439
+137, 155, 155, 128, 111, 123, 161, 165, // 3440-3447
+ 69,  20,  77, 150, 204, 204, 148,  98, // 3448-3455
+103,  99,  97, 114, 122, 152, 179, 155, // 3456-3463
+116, 116, 115, 118, 131, 130, 133, 156, // 3464-3471
+145, 118, 124, 135, 141, 153,  74,  33, // 3472-3479
+ 94, 151, 186, 192, 149,  99, 103, 100, // 3480-3487
+ 94, 111, 128, 155, 172, 153, 121, 113, // 3488-3495
+113, 112, 119, 129, 143, 166, 153, 115, // 3496-3503
+102, 132, 160, 158,  60,  24,  88, 156, // 3504-3511
+202, 194, 139, 100, 106,  96,  96, 106, // 3512-3519
+130, 165, 178, 145, 114, 110, 116, 115, // 3520-3527
+119, 131, 154, 168, 144, 113, 113, 131, // 3528-3535
+159, 138,  37,  44, 112, 171, 207, 185, // 3536-3543
+118,  93, 104,  94, 109, 117, 130, 163, // 3544-3551
+171, 139, 119, 116, 111, 116, 129, 135, // 3552-3559
+153, 157, 129, 114, 126, 145, 163,  97, // 3560-3567
+ 27,  68, 130, 183, 202, 165, 109, 103, // 3568-3575
+100,  95, 112, 117, 137, 168, 162, 129, // 3576-3583
+122, 117, 115, 127, 121, 127, 151, 155, // 3584-3591
+133, 126, 133, 137, 168,  95,  17,  57, // 3592-3599
+125, 186, 216, 176, 108,  98,  93,  91, // 3600-3607
+111, 121, 140, 174, 169, 128, 113, 112, // 3608-3615
+112, 121, 129, 137, 155, 152, 127, 113, // 3616-3623
+127, 143, 165, 134,  31,  44, 108, 163, // 3624-3631
+201, 190, 127,  99, 106,  90, 105, 122, // 3632-3639
+122, 153, 176, 147, 119, 114, 109, 120, // 3640-3647
+136, 127, 131, 150, 151, 130, 124, 128, // 3648-3655
+138, 158,  89,  36,  77, 125, 177, 204, // 3656-3663
+169, 111, 103,  93,  94, 122, 121, 126, // 3664-3671
+161, 161, 139, 131, 115, 105, 122, 123, // 3672-3679
+130, 153, 154, 136, 123, 120, 130, 154, // 3680-3687
+155,  58,  37,  85, 138, 199, 204, 153, // 3688-3695
+107,  96,  81, 100, 122, 123, 149, 171, // 3696-3703
+153, 130, 118, 104, 117, 131, 130, 136, // 3704-3711
+142, 141, 133, 126, 131, 141, 161, 139, // 3712-3719
+ 38,  38,  92, 148, 207, 206, 141, 101, // 3720-3727
+ 96,  78, 101, 130, 125, 150, 176, 149, // 3728-3735
+126, 117, 101, 117, 135, 129, 139, 149, // 3736-3743
+139, 136, 125, 117, 132, 169, 124,  50, // 3744-3751
+ 62,  89, 150, 204, 190, 135, 111,  93, // 3752-3759
+ 85, 115, 124, 116, 145, 167, 148, 138, // 3760-3767
+123, 103, 119, 131, 121, 133, 143, 133, // 3768-3775
+137, 142, 130, 139, 155, 137,  49,  37, // 3776-3783
+ 84, 140, 206, 208, 156, 108,  92,  77, // 3784-3791
+ 99, 125, 126, 140, 169, 159, 139, 119, // 3792-3799
+101, 112, 136, 132, 128, 135, 139, 137, // 3800-3807
+138, 123, 129, 147, 161, 117,  46,  52, // 3808-3815
+ 87, 158, 208, 194, 142, 103,  85,  87, // 3816-3823
+114, 126, 124, 141, 161, 154, 139, 120, // 3824-3831
+107, 117, 130, 127, 131, 135, 138, 142, // 3832-3839
+136, 119, 134, 150, 153, 107,  48,  57, // 3840-3847
+ 94, 166, 204, 190, 144, 105,  84,  85, // 3848-3855
+108, 124, 128, 143, 160, 153, 141, 121, // 3856-3863
+110, 113, 123, 129, 133, 137, 139, 131, // 3864-3871
+133, 138, 139, 142, 150, 114,  47,  58, // 3872-3879
+ 88, 148, 203, 199, 155, 117,  87,  76, // 3880-3887
+104, 124, 125, 139, 156, 152, 148, 131, // 3888-3895
+107, 110, 123, 128, 131, 139, 133, 135, // 3896-3903
+137, 127, 129, 141, 147, 149, 101,  44, // 3904-3911
+ 60, 103, 166, 204, 193, 142, 105,  83, // 3912-3919
+ 82, 110, 128, 126, 141, 158, 152, 144, // 3920-3927
+127, 106, 112, 126, 128, 131, 131, 132, // 3928-3935
+144, 144, 128, 126, 131, 141, 155, 104, // 3936-3943
+ 47,  61,  98, 163, 207, 196, 146, 105, // 3944-3951
+ 77,  76, 109, 131, 133, 142, 153, 149, // 3952-3959
+145, 129, 109, 110, 123, 129, 135, 136, // 3960-3967
+129, 130, 141, 134, 131, 137, 139, 151, // 3968-3975
+125,  61,  53,  85, 134, 193, 201, 165, // 3976-3983
+124,  92,  75,  94, 121, 130, 136, 151, // 3984-3991
+149, 147, 138, 118, 110, 117, 128, 133, // 3992-3999
+136, 129, 125, 134, 138, 132, 132, 137, // 4000-4007
+141, 156, 122,  52,  54,  82, 136, 198, // 4008-4015
+205, 167, 126,  88,  66,  93, 120, 133, // 4016-4023
+142, 150, 149, 151, 140, 117, 108, 112, // 4024-4031
+125, 136, 137, 130, 129, 132, 135, 140, // 4032-4039
+132, 133, 138, 147, 121,  61,  64,  83, // 4040-4047
+137, 194, 201, 166, 125,  88,  68,  96, // 4048-4055
+122, 133, 144, 150, 145, 146, 137, 116, // 4056-4063
+113, 117, 124, 133, 135, 131, 133, 132, // 4064-4071
+134, 133, 134, 128, 134, 143, 140,  89, // 4072-4079
+ 62,  79, 106, 168, 196, 182, 143, 108, // 4080-4087
+ 78,  82, 112, 127, 136, 147, 147, 144, // 4088-4095
+144, 128, 115, 119, 118, 123, 134, 133, // 4096-4103
+127, 133, 138, 132, 137, 132, 132, 142, // 4104-4111
+149, 104,  58,  70,  85, 149, 197, 195, // 4112-4119
+163, 125,  83,  70,  97, 120, 137, 145, // 4120-4127
+146, 144, 147, 138, 121, 116, 115, 122, // 4128-4135
+131, 135, 130, 129, 129, 132, 139, 140, // 4136-4143
+133, 130, 134, 141, 113,  70,  75,  89, // 4144-4151
+138, 186, 191, 166, 130,  93,  75,  93, // 4152-4159
+115, 132, 142, 148, 145, 147, 143, 125, // 4160-4167
+114, 111, 115, 126, 138, 138, 134, 131, // 4168-4175
+128, 129, 135, 133, 129, 132, 142, 140, // 4176-4183
+ 94,  73,  80, 100, 157, 187, 182, 154, // 4184-4191
+121,  85,  81, 100, 118, 136, 147, 145, // 4192-4199
+144, 147, 134, 122, 117, 110, 117, 129, // 4200-4207
+138, 137, 137, 129, 129, 134, 133, 133, // 4208-4215
+132, 136, 146, 115,  71,  77,  85, 130, // 4216-4223
+181, 191, 170, 139,  99,  75,  92, 112, // 4224-4231
+131, 142, 140, 138, 145, 146, 134, 125, // 4232-4239
+112, 111, 122, 133, 136, 135, 126, 126, // 4240-4247
+137, 140, 140, 131, 124, 127, 138, 116, // 4248-4255
+ 84,  89,  91, 128, 173, 183, 167, 140, // 4256-4263
+101,  79,  96, 111, 131, 143, 138, 136, // 4264-4271
+142, 141, 133, 130, 117, 114, 125, 127, // 4272-4279
+130, 133, 131, 130, 134, 132, 132, 130, // 4280-4287
+130, 132, 133, 140, 118,  82,  81,  94, // 4288-4295
+127, 170, 184, 166, 140, 109,  86,  94, // 4296-4303
+111, 124, 134, 140, 138, 143, 149, 137, // 4304-4311
+126, 117, 111, 117, 130, 134, 135, 133, // 4312-4319
+128, 132, 136, 134, 133, 130, 133, 140, // 4320-4327
+135,  95,  70,  75,  97, 154, 191, 190, // 4328-4335
+163, 126,  85,  74,  96, 118, 139, 145, // 4336-4343
+136, 134, 140, 143, 139, 132, 116, 111, // 4344-4351
+118, 126, 133, 134, 131, 127, 134, 138, // 4352-4359
+136, 135, 127, 125, 133, 134, 113,  88, // 4360-4367
+ 86,  93, 129, 168, 180, 170, 142, 108, // 4368-4375
+ 86,  94, 107, 125, 141, 137, 132, 137, // 4376-4383
+142, 141, 138, 125, 113, 117, 120, 125, // 4384-4391
+133, 134, 131, 133, 131, 132, 136, 130, // 4392-4399
+128, 128, 130, 134, 130,  98,  85,  93, // 4400-4407
+109, 149, 176, 176, 155, 127,  96,  87, // 4408-4415
+101, 116, 133, 138, 135, 135, 139, 143, // 4416-4423
+141, 134, 121, 113, 114, 119, 127, 133, // 4424-4431
+135, 135, 135, 136, 132, 130, 129, 126, // 4432-4439
+129, 135, 138, 111,  85,  86,  93, 131, // 4440-4447
+170, 182, 170, 145, 110,  84,  92, 104, // 4448-4455
+123, 141, 140, 135, 135, 138, 137, 139, // 4456-4463
+131, 117, 115, 117, 122, 132, 137, 134, // 4464-4471
+131, 131, 128, 131, 135, 132, 131, 135, // 4472-4479
+136, 135, 115,  82,  78,  88, 120, 166, // 4480-4487
+188, 180, 155, 120,  84,  81,  96, 117, // 4488-4495
+140, 147, 140, 133, 135, 135, 137, 136, // 4496-4503
+124, 116, 115, 119, 128, 136, 137, 132, // 4504-4511
+130, 127, 130, 135, 132, 130, 128, 129, // 4512-4519
+132, 137, 116,  91,  88,  91, 120, 160, // 4520-4527
+179, 176, 156, 123,  89,  85,  95, 111, // 4528-4535
+136, 144, 141, 139, 136, 134, 136, 135, // 4536-4543
+123, 118, 116, 117, 126, 135, 135, 133, // 4544-4551
+133, 131, 130, 132, 132, 127, 128, 125, // 4552-4559
+125, 135, 138, 122, 103,  95,  92, 112, // 4560-4567
+147, 166, 172, 160, 132, 102,  92,  96, // 4568-4575
+108, 128, 139, 137, 136, 135, 134, 139, // 4576-4583
+139, 130, 122, 117, 114, 119, 129, 132, // 4584-4591
+135, 135, 131, 131, 132, 131, 132, 134, // 4592-4599
+128, 129, 136, 136, 120,  97,  86,  81, // 4600-4607
+104, 145, 173, 185, 174, 144, 106,  86, // 4608-4615
+ 85,  97, 120, 137, 141, 140, 140, 137, // 4616-4623
+138, 140, 132, 123, 117, 112, 115, 124, // 4624-4631
+134, 136, 138, 134, 127, 128, 131, 133, // 4632-4639
+135, 133, 127, 125, 130, 132, 122, 106, // 4640-4647
+ 97,  91, 104, 136, 160, 174, 171, 150, // 4648-4655
+119,  97,  89,  94, 111, 130, 138, 140, // 4656-4663
+141, 139, 138, 139, 135, 127, 119, 113, // 4664-4671
+112, 119, 130, 136, 141, 139, 132, 129, // 4672-4679
+126, 125, 128, 133, 132, 129, 128, 128, // 4680-4687
+133, 131, 114,  99,  93,  95, 118, 148, // 4688-4695
+168, 172, 162, 136, 108,  95,  93, 102, // 4696-4703
+120, 134, 137, 137, 138, 136, 138, 140, // 4704-4711
+136, 127, 119, 112, 111, 120, 130, 136, // 4712-4719
+141, 137, 131, 129, 126, 129, 132, 132, // 4720-4727
+131, 126, 124, 128, 135, 133, 119, 105, // 4728-4735
+ 91,  92, 111, 140, 163, 174, 167, 142, // 4736-4743
+115,  96,  91, 101, 119, 133, 139, 138, // 4744-4751
+133, 131, 135, 137, 139, 135, 126, 117, // 4752-4759
+114, 117, 123, 133, 137, 136, 133, 128, // 4760-4767
+126, 127, 129, 130, 135, 134, 129, 132, // 4768-4775
+135, 134, 123, 108,  92,  86,  98, 122, // 4776-4783
+151, 171, 175, 161, 136, 112,  94,  94, // 4784-4791
+105, 120, 133, 138, 136, 132, 131, 133, // 4792-4799
+136, 138, 134, 128, 120, 116, 117, 123, // 4800-4807
+131, 136, 137, 134, 129, 125, 125, 127, // 4808-4815
+131, 133, 134, 132, 129, 130, 135, 133, // 4816-4823
+123, 109,  95,  88,  98, 120, 146, 166, // 4824-4831
+173, 162, 141, 119, 101,  97, 105, 118, // 4832-4839
+128, 134, 134, 131, 131, 132, 136, 140, // 4840-4847
+136, 128, 120, 113, 113, 121, 131, 139, // 4848-4855
+142, 138, 130, 124, 121, 122, 127, 132, // 4856-4863
+134, 134, 132, 128, 128, 130, 134, 138, // 4864-4871
+127, 112,  98,  88,  95, 115, 143, 162, // 4872-4879
+172, 165, 144, 123, 105,  98, 103, 116, // 4880-4887
+127, 133, 136, 131, 127, 128, 132, 137, // 4888-4895
+140, 136, 128, 120, 114, 115, 122, 131, // 4896-4903
+137, 140, 136, 129, 124, 122, 123, 128, // 4904-4911
+132, 133, 133, 131, 129, 129, 130, 134, // 4912-4919
+128, 119, 107,  97,  97, 108, 129, 148, // 4920-4927
+161, 164, 152, 136, 118, 106, 103, 109, // 4928-4935
+120, 128, 133, 132, 129, 127, 128, 134, // 4936-4943
+138, 141, 137, 128, 118, 110, 112, 119, // 4944-4951
+129, 140, 144, 142, 134, 126, 120, 119, // 4952-4959
+122, 127, 132, 134, 135, 132, 129, 129, // 4960-4967
+131, 133, 129, 120, 108,  98,  97, 105, // 4968-4975
+124, 143, 158, 164, 157, 143, 126, 112, // 4976-4983
+105, 108, 115, 123, 129, 131, 129, 129, // 4984-4991
+129, 133, 138, 141, 140, 133, 122, 112, // 4992-4999
+106, 108, 117, 130, 142, 148, 146, 138, // 5000-5007
+128, 120, 117, 119, 125, 131, 134, 135, // 5008-5015
+133, 130, 129, 130, 133, 130, 125, 115, // 5016-5023
+104,  99, 102, 114, 131, 148, 158, 158, // 5024-5031
+150, 137, 123, 112, 109, 112, 117, 125, // 5032-5039
+129, 130, 129, 127, 129, 132, 138, 141, // 5040-5047
+142, 137, 127, 115, 105, 102, 108, 121, // 5048-5055
+136, 148, 152, 148, 137, 125, 117, 114, // 5056-5063
+117, 124, 131, 136, 136, 135, 131, 128, // 5064-5071
+128, 131, 131, 127, 119, 108, 101, 101, // 5072-5079
+109, 123, 139, 153, 158, 155, 144, 130, // 5080-5087
+117, 111, 110, 115, 122, 127, 129, 128, // 5088-5095
+126, 126, 128, 133, 139, 143, 143, 137, // 5096-5103
+127, 116, 107, 104, 109, 118, 131, 142, // 5104-5111
+147, 145, 139, 130, 122, 119, 120, 124, // 5112-5119
+128, 132, 133, 132, 131, 129, 129, 131, // 5120-5127
+134, 133, 128, 120, 109, 101, 101, 108, // 5128-5135
+122, 137, 151, 156, 154, 145, 131, 121, // 5136-5143
+114, 113, 117, 123, 126, 127, 126, 124, // 5144-5151
+123, 126, 132, 138, 143, 144, 139, 130, // 5152-5159
+121, 112, 108, 110, 116, 125, 133, 140, // 5160-5167
+141, 139, 134, 128, 124, 123, 124, 127, // 5168-5175
+129, 130, 130, 129, 128, 128, 129, 131, // 5176-5183
+134, 136, 132, 125, 116, 106, 101, 105, // 5184-5191
+114, 127, 141, 151, 153, 149, 140, 129, // 5192-5199
+121, 117, 117, 120, 125, 127, 126, 125, // 5200-5207
+122, 121, 124, 130, 136, 141, 143, 139, // 5208-5215
+133, 124, 116, 111, 112, 117, 124, 132, // 5216-5223
+136, 137, 135, 131, 127, 125, 125, 126, // 5224-5231
+129, 131, 131, 130, 128, 126, 125, 126, // 5232-5239
+128, 130, 134, 136, 133, 128, 120, 111, // 5240-5247
+106, 107, 112, 121, 133, 143, 147, 147, // 5248-5255
+142, 133, 127, 122, 121, 122, 125, 126, // 5256-5263
+125, 124, 122, 120, 122, 125, 131, 137, // 5264-5271
+141, 141, 138, 131, 124, 118, 114, 115, // 5272-5279
+119, 126, 131, 134, 135, 132, 129, 127, // 5280-5287
+125, 126, 128, 130, 131, 130, 128, 126, // 5288-5295
+124, 124, 126, 128, 130, 132, 133, 134, // 5296-5303
+131, 128, 122, 117, 113, 112, 115, 120, // 5304-5311
+127, 134, 139, 141, 140, 136, 132, 129, // 5312-5319
+126, 125, 125, 124, 124, 122, 121, 121, // 5320-5327
+122, 125, 129, 133, 136, 137, 136, 133, // 5328-5335
+128, 124, 121, 120, 121, 124, 126, 129, // 5336-5343
+130, 130, 129, 128, 128, 128, 129, 130};// 5344-5351
+
+#endif
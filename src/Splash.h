@@ -0,0 +1,1043 @@
+// File: Splash.h
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: Full color images of res/images/C run length encoded for ST7735_DrawRLE16(), generated by res/images/RleCompile.py
+// Usage: Included by AstroParty.c, edit the images in res/images/C and run the script instead of editing this
+
+#ifndef SPLASH_H
+#define SPLASH_H
+#include <stdint.h>
+
+//128x160, 12060 bytes instead of 40960
+const uint8_t Astro_Start_Menu_RLE[] = {
+  0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF,
+  0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A,
+  0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00,
+  0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF,
+  0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A,
+  0x00, 0xFF, 0x5A, 0x00, 0x91, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x01, 0x5A, 0x20, 0x52, 0x00, 0xC0, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x02, 0x52,
+  0x00, 0x5A, 0x00, 0x52, 0x00, 0x93, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x80, 0x51, 0xE0,
+  0x89, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x52, 0x20, 0x52, 0x00, 0xBF, 0x5A, 0x00, 0x82, 0x52,
+  0x00, 0x01, 0x52, 0x20, 0x5A, 0x60, 0x81, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x82,
+  0x52, 0x00, 0x93, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x81, 0x59, 0xE0, 0x00, 0x52,
+  0x00, 0xBF, 0x5A, 0x00, 0x01, 0x5A, 0x40, 0x5A, 0x60, 0x82, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x01,
+  0x6B, 0x00, 0x62, 0xA0, 0x8D, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0xA0, 0x52, 0x00, 0x9B, 0x5A,
+  0x00, 0x01, 0x9C, 0x4C, 0xEF, 0x5C, 0x81, 0xFF, 0xFF, 0x01, 0xEF, 0x5C, 0x94, 0x2B, 0xB8, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x60, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x84,
+  0x5A, 0x00, 0x00, 0x5A, 0x20, 0x8E, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x9B, 0x5A, 0x00, 0x01, 0xC5,
+  0xF4, 0xCE, 0x36, 0x81, 0x6A, 0xC4, 0x01, 0xD6, 0x56, 0xA4, 0xAE, 0xA8, 0x5A, 0x00, 0x00, 0x5A,
+  0x40, 0x81, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xA8, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x8A, 0x5A, 0x00, 0x15, 0xBD, 0xB3, 0xD6, 0x77, 0x5A, 0x00, 0xAD, 0x10, 0xCE, 0x36, 0x5A, 0x00,
+  0xCE, 0x36, 0xAD, 0x10, 0x62, 0x41, 0x94, 0x4B, 0xBD, 0xB3, 0xC5, 0xF5, 0xE6, 0xFA, 0x8B, 0xE9,
+  0xAD, 0x0F, 0xF7, 0x9D, 0xFF, 0xFF, 0xE7, 0x1A, 0x83, 0xC9, 0x5A, 0x60, 0xBD, 0x93, 0xFF, 0xBE,
+  0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0x94, 0x2B, 0x82, 0x5A, 0x00, 0x08, 0x73, 0x05, 0xDE, 0xD9,
+  0xFF, 0xFF, 0xF7, 0x9D, 0xAD, 0x0F, 0xBD, 0xB3, 0xFF, 0xFF, 0xDE, 0xD9, 0x72, 0xE4, 0x81, 0x5A,
+  0x00, 0x03, 0xAD, 0x10, 0xFF, 0xDF, 0xEF, 0x3B, 0x83, 0x88, 0x81, 0x5A, 0x00, 0x0C, 0xDE, 0x98,
+  0x94, 0x2B, 0xAD, 0x10, 0xDE, 0xB9, 0xEF, 0x7C, 0xFF, 0xFF, 0xDE, 0xB8, 0xC6, 0x15, 0xFF, 0xFF,
+  0xDE, 0xF9, 0x6A, 0xE4, 0x83, 0x88, 0xDE, 0xD9, 0x81, 0xFF, 0xFF, 0x01, 0xE7, 0x1A, 0x83, 0xC9,
+  0x82, 0x5A, 0x00, 0x0E, 0x94, 0x2B, 0xEF, 0x5C, 0xFF, 0xFF, 0xF7, 0x7D, 0x9C, 0x6D, 0x94, 0x2B,
+  0xEF, 0x5C, 0xFF, 0xFF, 0xF7, 0x7D, 0x9C, 0x6D, 0x72, 0xE5, 0xDE, 0xB8, 0xFF, 0xFF, 0xFF, 0xBE,
+  0xBD, 0x93, 0x81, 0x5A, 0x00, 0x01, 0xAD, 0x10, 0xCE, 0x36, 0x83, 0x5A, 0x00, 0x02, 0x83, 0x88,
+  0xE7, 0x1A, 0x94, 0x2B, 0x95, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x81, 0x5A, 0x40, 0x8A, 0x5A, 0x00,
+  0x10, 0xBD, 0xB3, 0xD6, 0x77, 0x5A, 0x00, 0xAD, 0x10, 0xCE, 0x36, 0x5A, 0x00, 0xCE, 0x36, 0xAD,
+  0x10, 0x5A, 0x00, 0xBD, 0x72, 0xFF, 0xDE, 0xFF, 0xFF, 0xCE, 0x36, 0x6A, 0xA3, 0xDE, 0xD9, 0xB5,
+  0x72, 0x6A, 0xA3, 0x81, 0xCE, 0x15, 0x06, 0x9C, 0x8D, 0xEF, 0x5C, 0xAC, 0xEF, 0x5A, 0x00, 0x83,
+  0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x82, 0x5A, 0x00, 0x08, 0xBD, 0xB3, 0xE6, 0xFA, 0x7B, 0x47, 0xB5,
+  0x72, 0xE7, 0x1B, 0x7B, 0x46, 0x9C, 0x4C, 0xE7, 0x1A, 0x83, 0x88, 0x82, 0x5A, 0x00, 0x02, 0x83,
+  0xA8, 0xE7, 0x1A, 0x94, 0x2B, 0x81, 0x5A, 0x00, 0x0C, 0xDE, 0x98, 0x94, 0x2B, 0xAD, 0x10, 0xE7,
+  0x1A, 0x83, 0x88, 0x9C, 0x8D, 0xE6, 0xFA, 0x83, 0x88, 0x9C, 0x4C, 0xE7, 0x1A, 0x83, 0x88, 0xC5,
+  0xF4, 0xE6, 0xFA, 0x81, 0x7B, 0x47, 0x81, 0xD6, 0x98, 0x82, 0x5A, 0x00, 0x12, 0xBD, 0xB3, 0xDE,
+  0xB8, 0x6A, 0xC4, 0xC5, 0xD4, 0xD6, 0x57, 0xC5, 0xF3, 0xDE, 0xB8, 0x6A, 0xC4, 0xC5, 0xD4, 0xD6,
+  0x57, 0xAD, 0x10, 0xE6, 0xFA, 0x7B, 0x47, 0x94, 0x2B, 0xE7, 0x1A, 0x8C, 0x0A, 0x5A, 0x00, 0xAD,
+  0x10, 0xCE, 0x36, 0x83, 0x5A, 0x00, 0x02, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x95, 0x5A, 0x00,
+  0x82, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x85, 0x52, 0x00, 0x0E, 0xBD, 0xB3, 0xD6, 0x77, 0x5A, 0x00,
+  0xAD, 0x10, 0xCE, 0x36, 0x5A, 0x00, 0xCE, 0x36, 0xAD, 0x10, 0x7B, 0x46, 0xE6, 0xFA, 0xA4, 0xCE,
+  0xA4, 0xAE, 0xE7, 0x1B, 0xAC, 0xEF, 0xEF, 0x5C, 0x82, 0xFF, 0xFF, 0x07, 0xD6, 0x77, 0xAD, 0x10,
+  0xE6, 0xFA, 0x6A, 0xA3, 0x52, 0x00, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x82, 0x5A, 0x00, 0x08,
+  0xD6, 0x77, 0xBD, 0xB3, 0x5A, 0x00, 0x94, 0x2B, 0xE7, 0x1A, 0x83, 0x88, 0x94, 0x2B, 0xE7, 0x1A,
+  0x83, 0x88, 0x82, 0x5A, 0x00, 0x11, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x5A, 0x00, 0x62, 0x41,
+  0xDE, 0xB8, 0x94, 0x2B, 0xAD, 0x10, 0xFF, 0xDF, 0xFF, 0xFF, 0xF7, 0x9D, 0xBD, 0x92, 0x5A, 0x00,
+  0x94, 0x2B, 0xE7, 0x1A, 0x83, 0x88, 0xD6, 0x77, 0xCE, 0x15, 0x86, 0x5A, 0x00, 0x0A, 0x94, 0x2B,
+  0xEF, 0x5C, 0xFF, 0xFF, 0xEF, 0x5C, 0x9C, 0x4C, 0x94, 0x4B, 0xEF, 0x5C, 0xFF, 0xFF, 0xEF, 0x5C,
+  0x9C, 0x4C, 0xBD, 0xB3, 0x82, 0xFF, 0xFF, 0x04, 0xF7, 0xBE, 0x94, 0x2B, 0x5A, 0x00, 0xAD, 0x10,
+  0xCE, 0x36, 0x83, 0x5A, 0x00, 0x02, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x9D, 0x5A, 0x00, 0x01,
+  0x52, 0x00, 0x62, 0x80, 0x82, 0x52, 0x00, 0x1A, 0x62, 0xA0, 0xBD, 0xB3, 0xD6, 0x98, 0x7B, 0x67,
+  0xDE, 0xB9, 0xD6, 0x77, 0x5A, 0x00, 0xCE, 0x36, 0xAD, 0x10, 0x83, 0x67, 0xE7, 0x1A, 0xA4, 0xCE,
+  0xA4, 0xAE, 0xE6, 0xFA, 0x83, 0x88, 0xDE, 0x98, 0xB5, 0x51, 0x6A, 0xA3, 0xD6, 0x77, 0xC5, 0xF4,
+  0x83, 0xC9, 0xEF, 0x3B, 0xB5, 0x51, 0x62, 0x61, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x82, 0x5A,
+  0x00, 0x08, 0xBD, 0xB3, 0xE6, 0xFA, 0x7B, 0x47, 0xB5, 0x72, 0xE7, 0x1B, 0x7B, 0x46, 0x94, 0x2B,
+  0xE7, 0x1A, 0x83, 0x88, 0x82, 0x5A, 0x00, 0x14, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0x5A, 0x00,
+  0xA4, 0xCE, 0xEF, 0x7C, 0x94, 0x2B, 0xAD, 0x10, 0xE7, 0x1A, 0x73, 0x05, 0xC5, 0xD4, 0xDE, 0xB8,
+  0x5A, 0x00, 0x94, 0x2B, 0xE6, 0xFA, 0x83, 0x88, 0xAD, 0x10, 0xF7, 0xBE, 0xE6, 0xFA, 0xB5, 0x72,
+  0x73, 0x05, 0x85, 0x5A, 0x00, 0x02, 0x7B, 0x46, 0xCE, 0x56, 0xD6, 0x77, 0x81, 0x5A, 0x00, 0x0E,
+  0x7B, 0x46, 0xCE, 0x56, 0xD6, 0x77, 0xA4, 0xCE, 0xDE, 0xB9, 0x7B, 0x47, 0xA4, 0xAE, 0xE7, 0x1A,
+  0x83, 0xC9, 0x6A, 0xA3, 0xDE, 0xB8, 0xD6, 0x77, 0x5A, 0x00, 0xAD, 0x0F, 0xF7, 0x9D, 0x81, 0xFF,
+  0xFF, 0x01, 0xF7, 0xBE, 0x94, 0x2B, 0x9D, 0x5A, 0x00, 0x00, 0x51, 0xE0, 0x83, 0x52, 0x00, 0x01,
+  0x51, 0xE0, 0xAC, 0xEF, 0x81, 0xFF, 0xDE, 0x12, 0xD6, 0x98, 0xCE, 0x36, 0x5A, 0x00, 0xCE, 0x36,
+  0xAD, 0x10, 0x5A, 0x00, 0xD6, 0x57, 0xFF, 0xFF, 0xFF, 0xDE, 0xBD, 0x93, 0x5A, 0x00, 0x9C, 0x4C,
+  0xEF, 0x7C, 0xFF, 0xFF, 0xE6, 0xFA, 0x83, 0x88, 0x5A, 0x00, 0x94, 0x2B, 0xEF, 0x3B, 0x81, 0xFF,
+  0xFF, 0x01, 0xF7, 0xBE, 0x94, 0x2B, 0x81, 0x5A, 0x00, 0x09, 0x52, 0x00, 0x73, 0x25, 0xDE, 0xD9,
+  0xFF, 0xFF, 0xF7, 0x9D, 0xAD, 0x0F, 0xAD, 0x10, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0x1A, 0x81, 0x5A,
+  0x00, 0x13, 0x94, 0x2B, 0xF7, 0xBE, 0xFF, 0xFF, 0xEF, 0x5C, 0xCE, 0x15, 0xEF, 0x5C, 0xE7, 0x1A,
+  0x94, 0x2B, 0x83, 0x88, 0xE7, 0x1B, 0xFF, 0xFF, 0xF7, 0x9D, 0xA4, 0xAE, 0xAD, 0x10, 0xFF, 0xDF,
+  0xFF, 0xFF, 0xE6, 0xFA, 0x52, 0x00, 0x94, 0x2B, 0xD6, 0x77, 0x81, 0xF7, 0x9D, 0x00, 0x9C, 0x4C,
+  0x82, 0x5A, 0x00, 0x19, 0x8C, 0x0A, 0xEF, 0x5C, 0xFF, 0xFF, 0xF7, 0xBE, 0xAC, 0xEF, 0x8C, 0x0A,
+  0xEF, 0x5C, 0xFF, 0xFF, 0xF7, 0xBE, 0xAC, 0xEF, 0x62, 0x41, 0xCE, 0x36, 0xFF, 0xFF, 0xF7, 0xBE,
+  0xB5, 0x72, 0x83, 0x67, 0xE7, 0x1A, 0xE6, 0xFA, 0xCE, 0x36, 0x83, 0xC9, 0xEF, 0x5C, 0xB5, 0x51,
+  0x62, 0x41, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0xAB, 0x5A, 0x00, 0x02, 0xB5, 0x72, 0xCE, 0x36,
+  0x62, 0x41, 0x87, 0x5A, 0x00, 0x06, 0x7B, 0x46, 0xE7, 0x1A, 0xB5, 0x51, 0x62, 0x41, 0x83, 0x88,
+  0xE7, 0x1A, 0x94, 0x2B, 0x81, 0x5A, 0x00, 0x02, 0x51, 0xE0, 0x52, 0x20, 0x52, 0x00, 0x83, 0x5A,
+  0x00, 0x02, 0x94, 0x2B, 0xE7, 0x1A, 0x83, 0x88, 0x82, 0x5A, 0x00, 0x02, 0x83, 0x88, 0xE7, 0x1A,
+  0x94, 0x2B, 0x89, 0x5A, 0x00, 0x02, 0x94, 0x2B, 0xE7, 0x1A, 0x83, 0x88, 0x82, 0x5A, 0x00, 0x02,
+  0x62, 0x41, 0xDE, 0xB8, 0xBD, 0xB3, 0x95, 0x5A, 0x00, 0x06, 0x94, 0x2B, 0xE7, 0x1A, 0x83, 0x88,
+  0x5A, 0x00, 0x83, 0x88, 0xE7, 0x1A, 0x94, 0x2B, 0xA9, 0x5A, 0x00, 0x01, 0xE7, 0x1A, 0xBD, 0xB3,
+  0x8A, 0x5A, 0x00, 0x06, 0x8C, 0x0A, 0xEF, 0x5C, 0xAC, 0xEF, 0x5A, 0x00, 0x83, 0x88, 0xE7, 0x1A,
+  0x94, 0x2B, 0x82, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x02, 0x94, 0x2B, 0xE6, 0xFA,
+  0x83, 0x67, 0x82, 0x5A, 0x00, 0x02, 0x83, 0x88, 0xE6, 0xFA, 0x94, 0x0B, 0x89, 0x5A, 0x00, 0x08,
+  0x94, 0x2B, 0xE6, 0xFA, 0x83, 0x67, 0xB5, 0x51, 0xEF, 0x3B, 0x8B, 0xE9, 0x7B, 0x47, 0xE6, 0xFA,
+  0xBD, 0x93, 0x95, 0x5A, 0x00, 0x06, 0x8C, 0x0A, 0xEF, 0x7C, 0xB5, 0x51, 0x62, 0x41, 0x83, 0x88,
+  0xE7, 0x1A, 0x94, 0x2B, 0x93, 0x5A, 0x00, 0x02, 0x51, 0xE0, 0x5A, 0x80, 0x52, 0x00, 0x92, 0x5A,
+  0x00, 0x83, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x05, 0x52, 0x00, 0x5A, 0x80, 0x52, 0x00, 0x5A, 0x00,
+  0xCE, 0x36, 0xFF, 0xDE, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0x94, 0x2B, 0x83, 0x5A, 0x00, 0x03,
+  0x52, 0x00, 0x52, 0x20, 0x5A, 0x60, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x01, 0x73, 0x05, 0xD6, 0x77,
+  0x81, 0xFF, 0xFF, 0x01, 0xDE, 0xB8, 0x73, 0x05, 0x90, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x82, 0x5A,
+  0x00, 0x01, 0xBD, 0x93, 0xFF, 0xBE, 0x81, 0xFF, 0xFF, 0x01, 0xF7, 0xBE, 0x94, 0x2B, 0x81, 0x5A,
+  0x00, 0x82, 0x52, 0x00, 0x8D, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x92, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x01, 0x52, 0x40, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x84, 0x52,
+  0x00, 0x97, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x62, 0xA0, 0x52, 0x00, 0x92, 0x5A, 0x00, 0x02, 0x52,
+  0x00, 0x52, 0x20, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x20, 0x52, 0x00, 0x8D,
+  0x5A, 0x00, 0x82, 0x52, 0x00, 0x8F, 0x5A, 0x00, 0x03, 0x52, 0x20, 0x5A, 0x60, 0x52, 0x00, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x40, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8A,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x83, 0x52,
+  0x00, 0x92, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x40, 0x52, 0x00, 0x8B, 0x5A, 0x00, 0x01, 0x5A,
+  0x40, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x01, 0x5A, 0x20, 0x62,
+  0xC0, 0x94, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x20, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0x91, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x8B, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x97, 0x5A, 0x00,
+  0x82, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x84,
+  0x5A, 0x00, 0x01, 0x52, 0x40, 0x5A, 0x60, 0x84, 0x5A, 0x00, 0x00, 0x5A, 0x40, 0x94, 0x5A, 0x00,
+  0x81, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x60, 0x52, 0x00, 0x8A, 0x5A, 0x00,
+  0x81, 0x5A, 0x40, 0x00, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x62, 0xA0, 0x97, 0x5A,
+  0x00, 0x00, 0x52, 0x00, 0x86, 0x5A, 0x00, 0x00, 0x52, 0x00, 0xB4, 0x5A, 0x00, 0x82, 0x52, 0x00,
+  0x8A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x97, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x02, 0x5A, 0x00, 0x51,
+  0xE0, 0x5A, 0x20, 0x81, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x02, 0x5A, 0x20, 0x5A,
+  0x80, 0x51, 0xE0, 0xCA, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x97, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x82,
+  0x5A, 0x00, 0x05, 0x6B, 0x00, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x5A, 0x40, 0x5A, 0x20, 0x8C,
+  0x5A, 0x00, 0x82, 0x52, 0x00, 0x9C, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x82, 0x52,
+  0x00, 0x98, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xA0, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x85, 0x5A, 0x00,
+  0x00, 0x52, 0x00, 0x81, 0x52, 0x20, 0xAC, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x62, 0x80, 0x52, 0x00,
+  0x83, 0x5A, 0x00, 0x02, 0x5A, 0x20, 0x5A, 0x80, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x00, 0x52, 0x00,
+  0x87, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x62, 0xA0, 0x52, 0x00, 0xA0, 0x5A, 0x00, 0x01, 0x52,
+  0x00, 0x5A, 0x60, 0x86, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xB7, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x88,
+  0x5A, 0x00, 0x02, 0x52, 0x00, 0x62, 0xA0, 0x51, 0xE0, 0xB3, 0x5A, 0x00, 0x83, 0x52, 0x00, 0xB6,
+  0x5A, 0x00, 0x04, 0x52, 0x00, 0x5A, 0x60, 0x52, 0x00, 0x5A, 0x60, 0x52, 0x00, 0x88, 0x5A, 0x00,
+  0x82, 0x52, 0x00, 0xB4, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x80, 0x5A, 0x20, 0x9E, 0x5A, 0x00,
+  0x84, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x88,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x00, 0x52,
+  0x00, 0x8B, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x9A, 0x5A, 0x00,
+  0x03, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x60, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x81, 0x52, 0x00, 0xAF,
+  0x5A, 0x00, 0x85, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x8D, 0x5A, 0x00, 0x01, 0x5A,
+  0x80, 0x52, 0x20, 0x9B, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x62,
+  0xC0, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x00, 0x52, 0x00, 0xA0, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x52, 0x40, 0x5A, 0x60, 0x81, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x03, 0x52,
+  0x00, 0x52, 0x40, 0x5A, 0x40, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x92, 0x5A, 0x00,
+  0x00, 0x52, 0x00, 0x93, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01,
+  0x62, 0x80, 0x52, 0x00, 0xA1, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x82, 0x52, 0x00,
+  0x9D, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x01, 0x5A, 0x80, 0x52, 0x00, 0x91, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x5A, 0x40, 0x52, 0x00, 0x8D, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xB1, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x9E, 0x5A, 0x00, 0x02, 0x5A, 0x60, 0x52, 0x20, 0x52, 0x00, 0x81, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x20, 0x52, 0x00, 0xA2, 0x5A,
+  0x00, 0x83, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x40, 0x52, 0x00, 0xE9, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x5A, 0x60, 0x5A, 0x20, 0x8F, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x51, 0xE0,
+  0x52, 0x00, 0xAA, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x87, 0x52, 0x00, 0x00, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x00, 0x51, 0xE0, 0x8B, 0x5A, 0x00, 0x00, 0x59, 0xE0, 0x84, 0x52, 0x00,
+  0x01, 0x5A, 0x00, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x5A, 0x00, 0x87, 0x52,
+  0x00, 0x00, 0x59, 0xE0, 0x83, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x00, 0x5A, 0x00, 0x85, 0x52, 0x00,
+  0x05, 0x5A, 0x00, 0x52, 0x00, 0x5A, 0x00, 0x51, 0xE0, 0x59, 0xE0, 0x52, 0x00, 0x81, 0x5A, 0x00,
+  0x8E, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x40, 0x5A, 0x40, 0x83, 0x52, 0x00,
+  0x00, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x59, 0xE0, 0x87, 0x52,
+  0x00, 0x01, 0x5A, 0x40, 0x59, 0xE0, 0x86, 0x5A, 0x00, 0x03, 0x62, 0x60, 0x5A, 0x00, 0x52, 0x00,
+  0x5A, 0x00, 0x8D, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x00, 0x89, 0x52, 0x00,
+  0x83, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x00, 0x87, 0x52, 0x00, 0x06, 0x59, 0xE0, 0x51, 0xE0,
+  0x59, 0xE0, 0x51, 0xE0, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x20, 0x86, 0x52, 0x00, 0x00, 0x5A, 0x00,
+  0x82, 0x52, 0x00, 0x01, 0x5A, 0x60, 0x5A, 0x40, 0x85, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x8C, 0x52,
+  0x00, 0x00, 0x51, 0xE0, 0x85, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x31, 0x66,
+  0x82, 0x29, 0x67, 0x05, 0x31, 0xA9, 0x31, 0xEA, 0x31, 0x68, 0x32, 0x4C, 0x31, 0xCA, 0x3A, 0x6A,
+  0x82, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x62, 0xA0, 0x5A, 0x00, 0x52, 0x00, 0x81,
+  0x5A, 0x00, 0x01, 0x52, 0x00, 0x41, 0xA4, 0x82, 0x29, 0x67, 0x07, 0x29, 0x48, 0x32, 0x2B, 0x31,
+  0x48, 0x3A, 0x2C, 0x32, 0x4C, 0x29, 0xA9, 0x31, 0xA9, 0x51, 0xE1, 0x82, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0x00, 0x31, 0x86, 0x87, 0x29, 0x67, 0x02, 0x31, 0x67, 0x3A, 0x4C, 0x51, 0xE0, 0x81, 0x52,
+  0x00, 0x08, 0x5A, 0x00, 0x52, 0x00, 0x31, 0xA7, 0x32, 0x4C, 0x31, 0xEB, 0x3A, 0x6D, 0x29, 0x48,
+  0x31, 0xCA, 0x29, 0x68, 0x82, 0x29, 0x67, 0x07, 0x31, 0x67, 0x52, 0x00, 0x42, 0x48, 0x29, 0x48,
+  0x31, 0xE9, 0x32, 0x8D, 0x31, 0xA9, 0x32, 0x2C, 0x81, 0x29, 0x67, 0x01, 0x29, 0x47, 0x41, 0xA4,
+  0x81, 0x52, 0x00, 0x05, 0x42, 0x25, 0x29, 0x89, 0x29, 0x67, 0x39, 0xE8, 0x31, 0xC7, 0x29, 0x48,
+  0x81, 0x29, 0x67, 0x00, 0x31, 0x66, 0x81, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x08, 0x52, 0x00, 0x49,
+  0xC2, 0x32, 0x0B, 0x29, 0xA9, 0x32, 0x6D, 0x31, 0xCA, 0x31, 0x47, 0x32, 0x0B, 0x29, 0x47, 0x81,
+  0x29, 0x67, 0x02, 0x29, 0x48, 0x49, 0xC2, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x02,
+  0x29, 0x48, 0x00, 0xAF, 0x00, 0x90, 0x81, 0x00, 0xB0, 0x09, 0x01, 0x54, 0x01, 0xB6, 0x00, 0xD1,
+  0x0A, 0xBC, 0x09, 0x96, 0x0A, 0x17, 0x19, 0x0A, 0x52, 0x00, 0x51, 0xE0, 0x52, 0x00, 0x87, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x02, 0x29, 0x29, 0x00, 0xB1, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x06, 0x0A,
+  0x59, 0x00, 0x90, 0x12, 0x9A, 0x0A, 0x9A, 0x01, 0x74, 0x09, 0x74, 0x49, 0xC2, 0x81, 0x5A, 0x00,
+  0x04, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x60, 0x10, 0xED, 0x00, 0xB0, 0x82, 0x00, 0x90, 0x82, 0x00,
+  0xB1, 0x05, 0x00, 0x90, 0x00, 0xB0, 0x12, 0xBB, 0x29, 0x67, 0x51, 0xE0, 0x59, 0xE0, 0x81, 0x5A,
+  0x00, 0x06, 0x11, 0x2F, 0x0A, 0x9B, 0x01, 0xF7, 0x12, 0xDC, 0x00, 0x90, 0x09, 0xB5, 0x00, 0xD2,
+  0x81, 0x00, 0xB1, 0x81, 0x00, 0xB0, 0x0F, 0x52, 0x00, 0x2A, 0x91, 0x00, 0x90, 0x01, 0x54, 0x0A,
+  0xDC, 0x01, 0x54, 0x0A, 0x9A, 0x00, 0x90, 0x00, 0xB1, 0x00, 0xB0, 0x29, 0x29, 0x52, 0x00, 0x51,
+  0xE0, 0x32, 0x4C, 0x01, 0x13, 0x00, 0xB0, 0x84, 0x00, 0x90, 0x02, 0x08, 0xCE, 0x5A, 0x00, 0x52,
+  0x00, 0x8C, 0x5A, 0x00, 0x08, 0x52, 0x00, 0x41, 0x84, 0x00, 0xF2, 0x09, 0xF7, 0x09, 0xB6, 0x0A,
+  0x9A, 0x00, 0xD1, 0x09, 0x75, 0x09, 0x95, 0x82, 0x00, 0x90, 0x01, 0x10, 0xED, 0x52, 0x00, 0x85,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x18, 0xEC, 0x81, 0x00, 0x90, 0x09, 0x00, 0xB0, 0x00, 0x91,
+  0x09, 0xF7, 0x00, 0xB1, 0x0A, 0x7A, 0x0A, 0x9A, 0x01, 0xD6, 0x09, 0x54, 0x00, 0x90, 0x29, 0x47,
+  0x81, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x02, 0x29, 0x29, 0x00, 0xB1, 0x00, 0xB0,
+  0x81, 0x00, 0x90, 0x03, 0x0A, 0x59, 0x00, 0xB0, 0x12, 0x9A, 0x0A, 0x9A, 0x81, 0x09, 0x74, 0x01,
+  0x08, 0xAF, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x10, 0xED, 0x83, 0x00, 0xB0,
+  0x82, 0x00, 0xB1, 0x05, 0x00, 0x90, 0x00, 0xB1, 0x0A, 0xBB, 0x00, 0x90, 0x31, 0x66, 0x52, 0x00,
+  0x81, 0x5A, 0x00, 0x06, 0x11, 0x2F, 0x0A, 0xBA, 0x01, 0xF7, 0x12, 0xDC, 0x00, 0x90, 0x09, 0xB5,
+  0x00, 0xD2, 0x81, 0x00, 0xB1, 0x81, 0x00, 0xB0, 0x10, 0x52, 0x00, 0x2A, 0x91, 0x00, 0x90, 0x01,
+  0x54, 0x0A, 0xFC, 0x09, 0x74, 0x0A, 0x9A, 0x00, 0x90, 0x00, 0xB1, 0x00, 0xB0, 0x29, 0x29, 0x52,
+  0x00, 0x41, 0xA4, 0x09, 0x94, 0x01, 0x13, 0x00, 0xB0, 0x00, 0x90, 0x83, 0x00, 0xB0, 0x01, 0x00,
+  0x90, 0x18, 0xEC, 0x8D, 0x5A, 0x00, 0x08, 0x49, 0xC3, 0x08, 0xAF, 0x00, 0x90, 0x0A, 0x39, 0x09,
+  0x34, 0x0A, 0xDC, 0x00, 0xD2, 0x01, 0x53, 0x09, 0xD7, 0x82, 0x00, 0xB0, 0x00, 0x00, 0xAF, 0x86,
+  0x5A, 0x00, 0x0F, 0x52, 0x00, 0x41, 0xA4, 0x00, 0xB0, 0x00, 0xB1, 0x00, 0x91, 0x00, 0x90, 0x01,
+  0x33, 0x09, 0xB6, 0x00, 0xD2, 0x0A, 0xBA, 0x0A, 0x18, 0x09, 0xD6, 0x01, 0x13, 0x00, 0x90, 0x19,
+  0x0A, 0x49, 0xE1, 0x81, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x51, 0xE0, 0x83, 0x5A, 0x00, 0x0D,
+  0x52, 0x00, 0x51, 0xE0, 0x19, 0x0B, 0x00, 0xB1, 0x00, 0x91, 0x00, 0xB0, 0x0A, 0x38, 0x09, 0xF7,
+  0x00, 0xD1, 0x0A, 0xBA, 0x0A, 0x38, 0x09, 0x95, 0x01, 0x33, 0x00, 0xB0, 0x83, 0x51, 0xE0, 0x01,
+  0x41, 0xC2, 0x08, 0xCE, 0x81, 0x00, 0x90, 0x81, 0x00, 0xB0, 0x82, 0x00, 0xB1, 0x0E, 0x00, 0xB0,
+  0x00, 0xB1, 0x0A, 0xBB, 0x00, 0x90, 0x00, 0xB0, 0x39, 0xA4, 0x51, 0xE0, 0x52, 0x00, 0x11, 0x2F,
+  0x0A, 0xBB, 0x01, 0xF7, 0x12, 0xFC, 0x00, 0x90, 0x09, 0xB5, 0x00, 0xF2, 0x81, 0x00, 0xB1, 0x81,
+  0x00, 0x90, 0x07, 0x41, 0xC2, 0x2A, 0x2F, 0x01, 0x33, 0x09, 0x13, 0x0A, 0xBB, 0x09, 0xB6, 0x0A,
+  0x38, 0x00, 0xD1, 0x81, 0x00, 0x90, 0x06, 0x19, 0x0B, 0x51, 0xE0, 0x41, 0xA4, 0x01, 0x54, 0x01,
+  0x75, 0x00, 0xB0, 0x00, 0x90, 0x83, 0x00, 0xB1, 0x02, 0x00, 0xB0, 0x10, 0xED, 0x52, 0x00, 0x89,
+  0x5A, 0x00, 0x82, 0x52, 0x00, 0x00, 0x08, 0xCE, 0x81, 0x00, 0x90, 0x07, 0x00, 0xD2, 0x0A, 0x38,
+  0x09, 0xD6, 0x0A, 0xDB, 0x00, 0xD1, 0x09, 0xB6, 0x00, 0xF2, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x02,
+  0x08, 0xCE, 0x59, 0xE0, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x02, 0x51, 0xE1, 0x21, 0x49, 0x00, 0x90,
+  0x81, 0x00, 0xB1, 0x06, 0x00, 0x91, 0x12, 0xBB, 0x00, 0xB1, 0x09, 0xB6, 0x0A, 0xBB, 0x01, 0x13,
+  0x01, 0xB6, 0x82, 0x00, 0x90, 0x02, 0x21, 0x29, 0x52, 0x00, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00,
+  0x5A, 0x40, 0x83, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x41, 0xC3, 0x00, 0x90, 0x81, 0x00, 0xB1, 0x06,
+  0x00, 0x90, 0x0A, 0x39, 0x00, 0xB1, 0x01, 0x54, 0x0A, 0xFC, 0x01, 0x54, 0x0A, 0x18, 0x81, 0x00,
+  0x90, 0x01, 0x39, 0xA4, 0x52, 0x00, 0x81, 0x51, 0xE0, 0x00, 0x21, 0x2A, 0x82, 0x00, 0x90, 0x81,
+  0x00, 0xB0, 0x82, 0x00, 0xB1, 0x02, 0x00, 0xB0, 0x00, 0xB1, 0x0A, 0xBB, 0x81, 0x00, 0x90, 0x09,
+  0x00, 0xAF, 0x39, 0x85, 0x59, 0xE0, 0x11, 0x2F, 0x0A, 0xBB, 0x01, 0xF7, 0x0A, 0xDC, 0x00, 0x90,
+  0x09, 0xB5, 0x00, 0xF2, 0x81, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x10, 0x21, 0x49, 0x21, 0x2A, 0x0A,
+  0xBB, 0x00, 0xB1, 0x0A, 0x18, 0x0A, 0x9A, 0x00, 0xF2, 0x01, 0x75, 0x00, 0x90, 0x00, 0xB0, 0x00,
+  0x90, 0x49, 0xC2, 0x29, 0x48, 0x00, 0x90, 0x0A, 0x58, 0x00, 0xD1, 0x00, 0x91, 0x83, 0x00, 0xB1,
+  0x02, 0x00, 0xB0, 0x10, 0xED, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x51, 0xE0, 0x41,
+  0xA4, 0x08, 0xAF, 0x81, 0x00, 0x90, 0x0C, 0x00, 0xB1, 0x09, 0xF6, 0x09, 0xD6, 0x12, 0xDC, 0x01,
+  0x54, 0x01, 0x53, 0x09, 0x95, 0x00, 0xB1, 0x00, 0x90, 0x00, 0xB0, 0x00, 0xAF, 0x41, 0xA3, 0x52,
+  0x00, 0x81, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x51, 0xE0, 0x41, 0xC3, 0x83, 0x00, 0x90, 0x08, 0x01,
+  0x74, 0x09, 0x95, 0x01, 0x13, 0x0A, 0x79, 0x01, 0xB6, 0x09, 0xF7, 0x00, 0xF2, 0x00, 0xB1, 0x00,
+  0x91, 0x81, 0x00, 0x90, 0x00, 0x21, 0x48, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x00, 0x5A, 0x20, 0x83,
+  0x5A, 0x00, 0x01, 0x52, 0x00, 0x41, 0xC3, 0x83, 0x00, 0x90, 0x05, 0x0A, 0x39, 0x00, 0xB1, 0x01,
+  0x54, 0x0A, 0xDC, 0x01, 0x53, 0x0A, 0x18, 0x81, 0x00, 0x90, 0x01, 0x21, 0x0A, 0x51, 0xE0, 0x81,
+  0x52, 0x00, 0x00, 0x21, 0x29, 0x88, 0x00, 0x90, 0x0D, 0x00, 0xB1, 0x0A, 0xBB, 0x00, 0x90, 0x00,
+  0xB1, 0x00, 0x90, 0x08, 0xCE, 0x41, 0xA4, 0x11, 0x2E, 0x0A, 0x9B, 0x09, 0xF7, 0x12, 0xDC, 0x00,
+  0x90, 0x09, 0x95, 0x00, 0xD2, 0x83, 0x00, 0x90, 0x81, 0x08, 0xCE, 0x05, 0x0A, 0xBB, 0x00, 0xB1,
+  0x0A, 0x18, 0x0A, 0x9B, 0x00, 0xF2, 0x01, 0x75, 0x82, 0x00, 0x90, 0x04, 0x19, 0x0B, 0x00, 0x90,
+  0x00, 0xB0, 0x0A, 0x39, 0x00, 0xD1, 0x85, 0x00, 0x90, 0x03, 0x08, 0xCE, 0x41, 0xC3, 0x51, 0xE0,
+  0x59, 0xE0, 0x88, 0x52, 0x00, 0x01, 0x41, 0xA4, 0x08, 0xCE, 0x82, 0x00, 0xB1, 0x07, 0x00, 0x90,
+  0x01, 0x54, 0x09, 0xB6, 0x0A, 0x9A, 0x0A, 0x38, 0x00, 0xB0, 0x0A, 0x59, 0x00, 0xF1, 0x82, 0x00,
+  0x90, 0x02, 0x21, 0x29, 0x51, 0xE1, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x51, 0xE0, 0x10, 0xCD,
+  0x83, 0x00, 0x90, 0x07, 0x01, 0xD7, 0x00, 0xD1, 0x01, 0x34, 0x0A, 0xDC, 0x00, 0xF2, 0x0A, 0x5A,
+  0x00, 0x91, 0x00, 0xB1, 0x81, 0x00, 0xB0, 0x01, 0x00, 0x90, 0x10, 0xCD, 0x81, 0x5A, 0x40, 0x81,
+  0x52, 0x00, 0x83, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x41, 0xA3, 0x83, 0x00, 0x90, 0x0C, 0x0A, 0x38,
+  0x00, 0x91, 0x01, 0x54, 0x0A, 0xDC, 0x01, 0x34, 0x0A, 0x18, 0x00, 0x71, 0x00, 0x90, 0x08, 0xAF,
+  0x31, 0x66, 0x52, 0x00, 0x59, 0xE0, 0x21, 0x29, 0x88, 0x00, 0x90, 0x03, 0x00, 0xB0, 0x0A, 0xBB,
+  0x00, 0xB0, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x07, 0x08, 0xAF, 0x00, 0xD2, 0x0A, 0x9A, 0x01, 0xF7,
+  0x0A, 0xDC, 0x00, 0x90, 0x09, 0x95, 0x00, 0xB1, 0x85, 0x00, 0x90, 0x05, 0x0A, 0x9B, 0x00, 0x91,
+  0x09, 0xF7, 0x0A, 0x9A, 0x00, 0xD2, 0x01, 0x74, 0x83, 0x00, 0x90, 0x03, 0x00, 0xB0, 0x00, 0x91,
+  0x0A, 0x38, 0x00, 0xB0, 0x86, 0x00, 0x90, 0x01, 0x00, 0xCF, 0x08, 0xAE, 0x88, 0x08, 0xCE, 0x02,
+  0x08, 0xEF, 0x09, 0xF5, 0x00, 0x90, 0x82, 0x00, 0xB1, 0x07, 0x00, 0x90, 0x00, 0xB1, 0x01, 0xB6,
+  0x00, 0xF2, 0x0A, 0x9B, 0x09, 0xB6, 0x00, 0xD2, 0x0A, 0x39, 0x82, 0x00, 0x90, 0x02, 0x00, 0x8F,
+  0x39, 0x86, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x0C, 0x51, 0xE0, 0xBD, 0xD6, 0xDF, 0x1D, 0xBE, 0x3B,
+  0xB5, 0xDB, 0xB6, 0x3C, 0xB6, 0x5D, 0xB6, 0x3D, 0xB6, 0x5D, 0xB6, 0x7D, 0xB6, 0x5D, 0xBE, 0x5C,
+  0x11, 0x11, 0x83, 0x00, 0x90, 0x02, 0x00, 0xB0, 0x19, 0x2B, 0x51, 0xE0, 0x81, 0x52, 0x00, 0x83,
+  0x5A, 0x00, 0x03, 0x52, 0x00, 0x6A, 0xE6, 0xDF, 0x1D, 0xBE, 0x3C, 0x81, 0xB6, 0x3C, 0x0E, 0xB6,
+  0x7D, 0xB6, 0x5C, 0xB6, 0x5D, 0xB6, 0x7D, 0xB6, 0x5D, 0xC6, 0xBD, 0x52, 0xF4, 0x00, 0x90, 0x00,
+  0xB0, 0x29, 0x48, 0x5A, 0x00, 0x52, 0x00, 0xA5, 0x11, 0xBE, 0x3B, 0xB5, 0xDB, 0x86, 0xB6, 0x3C,
+  0x02, 0xBE, 0x5C, 0xD7, 0x3E, 0x19, 0x51, 0x83, 0x00, 0x90, 0x00, 0xA5, 0x79, 0x82, 0xB6, 0x7D,
+  0x01, 0xB6, 0x3C, 0xB6, 0x5D, 0x81, 0xB6, 0x5C, 0x81, 0xB6, 0x3C, 0x04, 0xB5, 0xDB, 0x7C, 0x38,
+  0x00, 0x90, 0xD7, 0x3E, 0xBE, 0x3D, 0x81, 0xB6, 0x7D, 0x09, 0xB6, 0x3C, 0xB6, 0x5D, 0xB6, 0x3C,
+  0xBE, 0x1B, 0xDE, 0xFD, 0x19, 0x52, 0x00, 0x90, 0x11, 0x11, 0xAD, 0xFB, 0xB6, 0x3D, 0x84, 0xB6,
+  0x3C, 0x04, 0xBE, 0x1B, 0xDE, 0xFD, 0x4A, 0xB4, 0x00, 0xB0, 0x00, 0x90, 0x81, 0x00, 0xB0, 0x85,
+  0x00, 0x91, 0x01, 0x00, 0xD1, 0x09, 0xD7, 0x82, 0x00, 0xB1, 0x04, 0x00, 0x91, 0x00, 0xB0, 0x5B,
+  0x55, 0xC6, 0xBD, 0xB6, 0x5C, 0x81, 0xB6, 0x7D, 0x07, 0xB6, 0x3C, 0xB6, 0x7D, 0xB5, 0xFC, 0xB5,
+  0xFB, 0xDF, 0x1D, 0xCE, 0x9B, 0x8C, 0x2F, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x05, 0x59, 0xE0, 0x6A,
+  0xA4, 0xD6, 0x78, 0x7C, 0x17, 0x09, 0x12, 0x0A, 0x5A, 0x83, 0x0A, 0xDC, 0x0B, 0x13, 0x1C, 0xB6,
+  0x5E, 0x9D, 0x19, 0x11, 0x31, 0x00, 0xB0, 0x00, 0x90, 0x00, 0xB1, 0x00, 0x90, 0x00, 0xB0, 0x29,
+  0x48, 0x51, 0xE1, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x04, 0x52, 0x00, 0x6A, 0xA4, 0xE7, 0x1A, 0x42,
+  0x94, 0x0A, 0x38, 0x85, 0x0A, 0xDC, 0x04, 0x64, 0x9C, 0x8C, 0x98, 0x08, 0xB1, 0x00, 0x90, 0x19,
+  0x2A, 0x81, 0x51, 0xE0, 0x03, 0xBD, 0x92, 0x73, 0xD6, 0x00, 0xB1, 0x0A, 0x9A, 0x85, 0x0A, 0xDC,
+  0x07, 0x0A, 0xFC, 0x9E, 0x1D, 0xB5, 0xDB, 0x21, 0x92, 0x00, 0x91, 0x00, 0xB1, 0x00, 0x90, 0xA5,
+  0x7A, 0x87, 0x0A, 0xDC, 0x05, 0x0A, 0x59, 0x00, 0xB0, 0x8C, 0xB9, 0x00, 0x90, 0xE7, 0x5F, 0x12,
+  0xFC, 0x84, 0x0A, 0xDC, 0x06, 0x42, 0x74, 0xD6, 0xBC, 0x19, 0x31, 0x00, 0x90, 0x63, 0x76, 0xB6,
+  0x7D, 0x13, 0x1B, 0x83, 0x0A, 0xDC, 0x05, 0x0A, 0x79, 0x29, 0xF4, 0xEF, 0x7E, 0x3A, 0x33, 0x00,
+  0xB0, 0x00, 0x91, 0x87, 0x00, 0xB1, 0x02, 0x00, 0xB0, 0x01, 0x94, 0x01, 0x54, 0x81, 0x00, 0xB1,
+  0x03, 0x00, 0xB0, 0x4A, 0xB4, 0xE7, 0x5E, 0x5C, 0x5D, 0x83, 0x0A, 0xDC, 0x05, 0x0A, 0xDB, 0x09,
+  0x54, 0x3A, 0x53, 0xF7, 0xBE, 0x94, 0x4C, 0x6A, 0xC4, 0x81, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x07,
+  0x51, 0xE0, 0x6A, 0xA4, 0xE7, 0x1B, 0x84, 0x58, 0x00, 0xF2, 0x12, 0x7A, 0x0A, 0xFC, 0x0A, 0xDC,
+  0x81, 0x0A, 0xFC, 0x05, 0x23, 0x3C, 0xC6, 0xBE, 0x94, 0xD8, 0x00, 0x71, 0x00, 0x90, 0x00, 0x91,
+  0x82, 0x00, 0x90, 0x01, 0x29, 0x48, 0x51, 0xE0, 0x82, 0x52, 0x00, 0x00, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0x04, 0xB5, 0x51, 0x94, 0xB8, 0x00, 0xD1, 0x0A, 0xDC, 0x12, 0xDC, 0x83, 0x0A, 0xFC, 0x0C,
+  0x3B, 0xDC, 0xC6, 0xBD, 0x11, 0x31, 0x00, 0x90, 0x00, 0x91, 0x49, 0xE1, 0x52, 0x00, 0x83, 0xCA,
+  0xD6, 0x9A, 0x63, 0x75, 0x09, 0x53, 0x0A, 0x9B, 0x12, 0xDC, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC,
+  0x04, 0x0A, 0xFB, 0x0A, 0xDC, 0xB6, 0x5E, 0xAD, 0x9A, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x00, 0xA5,
+  0x7A, 0x81, 0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x06, 0x09, 0x74, 0x6B, 0xD6, 0x8C, 0xB9, 0x00, 0xB0,
+  0xE7, 0x5F, 0x1B, 0x1C, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x08, 0x0A, 0xDC, 0x0A, 0x17, 0x42, 0x74,
+  0x7C, 0x57, 0x00, 0xB0, 0x00, 0x90, 0x63, 0x76, 0x43, 0xFC, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x81,
+  0x0A, 0xDC, 0x02, 0x01, 0x54, 0x74, 0x17, 0xCE, 0x7C, 0x81, 0x00, 0x90, 0x00, 0x00, 0x91, 0x87,
+  0x00, 0xB1, 0x07, 0x00, 0x90, 0x01, 0x13, 0x09, 0xB6, 0x00, 0xB1, 0x00, 0x90, 0x53, 0x15, 0xD6,
+  0xDD, 0x64, 0xBD, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x04, 0x0A, 0xDB, 0x09, 0xB6, 0x3A, 0x53,
+  0xCE, 0x7B, 0xA4, 0xAF, 0x85, 0x5A, 0x00, 0x06, 0x52, 0x00, 0x59, 0xE0, 0x62, 0xA4, 0xDE, 0xDA,
+  0x8C, 0xB8, 0x00, 0xD2, 0x0A, 0x9B, 0x82, 0x0A, 0xFC, 0x04, 0x0A, 0xDC, 0x2B, 0x5C, 0xAE, 0x3C,
+  0x00, 0x70, 0x00, 0x90, 0x81, 0x00, 0xB0, 0x02, 0x00, 0xB1, 0x00, 0xB0, 0x08, 0xCE, 0x85, 0x52,
+  0x00, 0x05, 0x5A, 0x00, 0x62, 0x83, 0xBD, 0xF6, 0x00, 0x71, 0x01, 0xF7, 0x0A, 0xDC, 0x83, 0x0A,
+  0xFC, 0x0C, 0x0A, 0xDC, 0x9D, 0xDD, 0x11, 0x32, 0x00, 0x90, 0x00, 0xB0, 0x49, 0xE1, 0x52, 0x00,
+  0x51, 0xE0, 0x73, 0x26, 0xF7, 0xBE, 0x63, 0x76, 0x00, 0xF2, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x83,
+  0x0A, 0xFC, 0x05, 0x23, 0x3C, 0xA6, 0x1E, 0xC6, 0x1B, 0x08, 0xF1, 0x00, 0x91, 0xA5, 0x7A, 0x81,
+  0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x06, 0x09, 0x94, 0xE7, 0x3E, 0x19, 0x51, 0x7C, 0x38, 0xE7, 0x5E,
+  0x13, 0x1C, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x07, 0x09, 0x33, 0xD6, 0xDD, 0x84, 0x57, 0x00, 0x90,
+  0x3A, 0x13, 0xDF, 0x1D, 0x43, 0xFC, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x05, 0x0A, 0xDC, 0x0A, 0x58,
+  0x00, 0xB1, 0xAD, 0xBB, 0x21, 0x92, 0x00, 0x90, 0x89, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x05, 0x0A,
+  0x38, 0x00, 0xD2, 0x00, 0x91, 0xB5, 0xBA, 0x5C, 0x7C, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x04, 0x01,
+  0x53, 0x19, 0x52, 0xE7, 0x3E, 0x94, 0x6D, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x0D,
+  0x5A, 0x00, 0x7B, 0x26, 0xE7, 0x3D, 0x5B, 0x36, 0x00, 0xF2, 0x0A, 0xBB, 0x0A, 0xFC, 0x0A, 0xDC,
+  0x0A, 0xFB, 0x0A, 0xDC, 0xAE, 0x1D, 0xB5, 0xFB, 0x08, 0xF1, 0x00, 0xB0, 0x81, 0x00, 0xB1, 0x81,
+  0x00, 0x90, 0x00, 0x21, 0x49, 0x84, 0x51, 0xE1, 0x05, 0x51, 0xE0, 0x52, 0x00, 0xBD, 0xF5, 0xB5,
+  0xDB, 0x09, 0xB6, 0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x0C, 0x9D, 0xDC, 0xCE, 0x9C, 0x00, 0xB0, 0x00,
+  0x90, 0x10, 0xED, 0x51, 0xE0, 0x5A, 0x80, 0x5A, 0x40, 0x7B, 0x88, 0xDE, 0xFC, 0x42, 0x74, 0x09,
+  0x74, 0x0A, 0xDB, 0x84, 0x0A, 0xFC, 0x06, 0x0A, 0xDC, 0x23, 0x5C, 0xE7, 0x7E, 0x94, 0xF9, 0x08,
+  0xF1, 0xA5, 0x9A, 0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x07, 0x0A, 0xDC, 0x09, 0x94, 0xE7, 0x3E, 0x00,
+  0x90, 0x9D, 0x19, 0x33, 0x9C, 0x0A, 0xFC, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x08, 0x09, 0xD6, 0x11,
+  0x11, 0xBE, 0x1B, 0x11, 0x32, 0x00, 0x90, 0x4A, 0xB4, 0xAE, 0x3D, 0x1B, 0x1C, 0x0A, 0xDC, 0x82,
+  0x0A, 0xFC, 0x02, 0x09, 0xF7, 0x84, 0x78, 0xC6, 0x3B, 0x81, 0x00, 0x90, 0x89, 0x00, 0xB1, 0x81,
+  0x00, 0x90, 0x05, 0x00, 0xD2, 0x0A, 0x17, 0x3A, 0x34, 0xE7, 0x3D, 0x33, 0xDC, 0x12, 0xDC, 0x81,
+  0x0A, 0xFC, 0x06, 0x0A, 0xDC, 0x09, 0xF7, 0x19, 0x52, 0xC6, 0x5B, 0xAD, 0x31, 0x5A, 0x41, 0x52,
+  0x00, 0x87, 0x5A, 0x00, 0x07, 0x52, 0x00, 0x51, 0xE0, 0x73, 0x47, 0xE7, 0x1B, 0x52, 0xF4, 0x01,
+  0x53, 0x0A, 0x9A, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x0A, 0x1B, 0x1C, 0xC6, 0xBE, 0x9D, 0x39, 0x11,
+  0x11, 0x00, 0x90, 0x00, 0xB1, 0x00, 0xB0, 0x00, 0x90, 0x01, 0x54, 0x09, 0x75, 0x00, 0x90, 0x81,
+  0x00, 0x91, 0x07, 0x00, 0x90, 0x10, 0xCE, 0x5A, 0x00, 0x5A, 0x62, 0xDF, 0x3E, 0x21, 0x72, 0x02,
+  0x38, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x0C, 0x12, 0xFC, 0xDF, 0x5E, 0x00, 0xB0, 0x00, 0x90, 0x00,
+  0xAF, 0x51, 0xE0, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x94, 0x2B, 0xEF, 0x7D, 0x32, 0x12, 0x01,
+  0x54, 0x81, 0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x04, 0x1B, 0x3C, 0xB6, 0x7E, 0xBE, 0x9E, 0xAE, 0x3D,
+  0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x06, 0x0A, 0xDC, 0x0A, 0x18, 0x32, 0x13, 0xEF, 0x5E, 0x00, 0x90,
+  0x95, 0x19, 0x12, 0xDC, 0x81, 0x0A, 0xFC, 0x04, 0x0A, 0xDC, 0x0A, 0xBC, 0x01, 0x34, 0xC6, 0x3B,
+  0x8C, 0x98, 0x81, 0x00, 0x90, 0x01, 0xCE, 0xDD, 0x75, 0x1D, 0x83, 0x0A, 0xDC, 0x07, 0x0A, 0xBB,
+  0x11, 0x51, 0xB5, 0xDB, 0x21, 0xB2, 0x08, 0xF1, 0x3A, 0x54, 0x3A, 0x73, 0x3A, 0x54, 0x8A, 0x3A,
+  0x74, 0x03, 0x64, 0x9C, 0xEF, 0x9E, 0x43, 0xFC, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x04, 0x09, 0xD7,
+  0x19, 0x52, 0xDE, 0xFC, 0xC5, 0xD5, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x04, 0x84,
+  0x0F, 0xEF, 0x9E, 0x42, 0x73, 0x01, 0x54, 0x0A, 0xDB, 0x82, 0x0A, 0xFC, 0x09, 0x23, 0x3C, 0xCE,
+  0xFE, 0x4A, 0xD4, 0x00, 0x91, 0x00, 0xB1, 0x00, 0x90, 0x00, 0xB1, 0x09, 0xB5, 0x09, 0x33, 0x00,
+  0x90, 0x81, 0x00, 0xB0, 0x07, 0x00, 0x90, 0x08, 0xCE, 0x41, 0xC2, 0x5A, 0x41, 0xCE, 0x35, 0x7C,
+  0x36, 0x09, 0xB6, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x0F, 0x12, 0xFC, 0xE7, 0x5E, 0x3A, 0x33, 0x00,
+  0xB0, 0x00, 0xAF, 0x31, 0xA5, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x59, 0xE0, 0xA4, 0xCF, 0xD6,
+  0xBC, 0x32, 0x13, 0x09, 0xF7, 0x0A, 0xDB, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x01,
+  0x0A, 0xFC, 0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x05, 0x0A, 0x18, 0xAD, 0x9A, 0xAD, 0x9B, 0x21, 0x92,
+  0xB5, 0xFA, 0x12, 0xDB, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xDC, 0x0A, 0x9A, 0x32, 0x13, 0xCE, 0xBC,
+  0x81, 0x00, 0x90, 0x02, 0x4A, 0xB4, 0xAE, 0x1C, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x08, 0x12, 0xDC,
+  0x09, 0xF7, 0x5B, 0x55, 0xC6, 0x3C, 0x29, 0xB2, 0x73, 0xD6, 0xC6, 0xBE, 0xAE, 0x3E, 0xAE, 0x3D,
+  0x8A, 0xAE, 0x3E, 0x02, 0xAE, 0x3D, 0x85, 0x7D, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x05, 0x0A, 0x38,
+  0x19, 0x72, 0x9D, 0x39, 0xC5, 0xF4, 0x62, 0x41, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x11, 0x52, 0x00,
+  0x51, 0xE0, 0x21, 0x2A, 0x42, 0x73, 0xD6, 0xDC, 0x5B, 0x55, 0x09, 0x34, 0x0A, 0xDB, 0x0A, 0xDC,
+  0x0A, 0xFC, 0x0A, 0xDC, 0x85, 0x3C, 0xC6, 0x5B, 0x09, 0x11, 0x00, 0xB0, 0x00, 0x90, 0x00, 0xD2,
+  0x0A, 0x38, 0x81, 0x00, 0x90, 0x81, 0x00, 0xB0, 0x07, 0x00, 0x90, 0x00, 0xB0, 0x31, 0x67, 0x52,
+  0x00, 0x62, 0xA4, 0xD6, 0xBC, 0x32, 0x13, 0x0A, 0xDB, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x07,
+  0x12, 0xFC, 0x4C, 0x1C, 0x9D, 0x19, 0x00, 0xB0, 0x00, 0x90, 0x10, 0xED, 0x52, 0x00, 0x5A, 0x00,
+  0x81, 0x52, 0x00, 0x05, 0x51, 0xE0, 0x73, 0xD6, 0xDE, 0xFD, 0x19, 0x31, 0x01, 0x75, 0x0A, 0xDC,
+  0x83, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x06,
+  0x0A, 0xDC, 0x09, 0xF8, 0xA5, 0x79, 0x11, 0x11, 0x6B, 0xB6, 0x95, 0x9C, 0x12, 0xDB, 0x81, 0x0A,
+  0xFC, 0x03, 0x0A, 0xDC, 0x0A, 0x7B, 0x9D, 0x19, 0x6B, 0xD6, 0x81, 0x00, 0x90, 0x02, 0xDE, 0xDD,
+  0x54, 0x5C, 0x12, 0xDC, 0x82, 0x0A, 0xFC, 0x07, 0x0A, 0xDB, 0x11, 0x11, 0xC6, 0x5B, 0x5B, 0x15,
+  0x21, 0xB3, 0xD7, 0x3E, 0x23, 0x5C, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x00, 0x0A, 0xDC, 0x87, 0x0A,
+  0xFC, 0x09, 0x0A, 0xDC, 0x12, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0x17, 0x00, 0x90, 0xBD, 0xFB,
+  0xC5, 0xF4, 0x5A, 0x21, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x09, 0x52, 0x00, 0x51, 0xE0, 0x41, 0xA4,
+  0x08, 0xCF, 0x00, 0x90, 0x73, 0xF7, 0xDE, 0xFD, 0x19, 0x71, 0x09, 0x54, 0x0A, 0xDC, 0x81, 0x0A,
+  0xFC, 0x06, 0x23, 0x7C, 0xBE, 0x9E, 0x9D, 0x19, 0x00, 0xB0, 0x00, 0x90, 0x09, 0xF7, 0x00, 0xF2,
+  0x83, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x07, 0x08, 0xAE, 0x41, 0xC3, 0x5A, 0x01, 0xBD, 0x93, 0x4A,
+  0xB4, 0x09, 0x95, 0x12, 0xDC, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x02, 0x12, 0xFC, 0x12, 0xFB, 0x95,
+  0x19, 0x81, 0x00, 0xB0, 0x02, 0x10, 0xCD, 0x52, 0x00, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x05, 0x51,
+  0xE1, 0x11, 0x10, 0x84, 0x58, 0xC6, 0x5B, 0x19, 0xD4, 0x0A, 0xDC, 0x8D, 0x0A, 0xFC, 0x06, 0x0A,
+  0x7A, 0x00, 0xF2, 0xAD, 0x79, 0x11, 0x11, 0x6B, 0xB6, 0x64, 0xBC, 0x12, 0xDC, 0x81, 0x0A, 0xFC,
+  0x08, 0x0A, 0x9B, 0x01, 0x12, 0x9D, 0x19, 0x32, 0x13, 0x00, 0x90, 0x00, 0xB0, 0xD6, 0xFC, 0x23,
+  0x7C, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x05, 0x09, 0xB6, 0x19, 0x32, 0xAD, 0x9A, 0x11, 0x31, 0xAD,
+  0x7A, 0xC6, 0xDE, 0x81, 0x0A, 0xDC, 0x8E, 0x0A, 0xFC, 0x05, 0x0A, 0xDC, 0x0A, 0x59, 0x08, 0xF2,
+  0xAD, 0x7A, 0xD6, 0x57, 0x6A, 0xA4, 0x81, 0x52, 0x00, 0x8B, 0x5A, 0x00, 0x01, 0x51, 0xE0, 0x31,
+  0x47, 0x81, 0x00, 0x90, 0x04, 0x00, 0xB0, 0x6B, 0x96, 0xD6, 0xDD, 0x11, 0x53, 0x0A, 0xDC, 0x81,
+  0x0A, 0xFC, 0x06, 0x0A, 0xDC, 0x1B, 0x1C, 0xC6, 0xBE, 0xB5, 0xDB, 0x09, 0x32, 0x0A, 0x17, 0x00,
+  0x90, 0x82, 0x00, 0xB0, 0x83, 0x00, 0x90, 0x06, 0x31, 0x66, 0x52, 0x00, 0x94, 0x4C, 0xE7, 0x3D,
+  0x11, 0x53, 0x0A, 0x9B, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xDC, 0x12, 0xDC, 0xD6, 0xFE,
+  0x6B, 0xB7, 0x81, 0x00, 0x90, 0x08, 0x31, 0x66, 0x52, 0x00, 0x59, 0xE0, 0x5A, 0x00, 0x18, 0xEB,
+  0x00, 0x90, 0x19, 0x51, 0xDF, 0x1D, 0x2A, 0x76, 0x87, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x84, 0x0A,
+  0xFC, 0x06, 0x0A, 0x59, 0x5B, 0x35, 0xCE, 0x7C, 0x11, 0x11, 0x84, 0x78, 0x6C, 0xDC, 0x0A, 0xDC,
+  0x81, 0x0A, 0xFC, 0x11, 0x0A, 0x9A, 0x21, 0x92, 0xD6, 0xDD, 0x29, 0xD3, 0x00, 0x90, 0x73, 0xD7,
+  0xCE, 0xFE, 0x23, 0x3C, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xBB, 0x09, 0x74, 0xE7, 0x5E,
+  0x7C, 0x58, 0x21, 0x72, 0xB6, 0x3C, 0x13, 0x1C, 0x81, 0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x00, 0x0A,
+  0xDC, 0x85, 0x0A, 0xFC, 0x08, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0x79, 0x09, 0x12, 0x8C,
+  0xD8, 0xDE, 0xD9, 0x62, 0x62, 0x52, 0x00, 0x8C, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x49, 0xE2, 0x81,
+  0x31, 0xF3, 0x00, 0x32, 0x12, 0x81, 0x31, 0xF3, 0x02, 0xCE, 0x9C, 0x11, 0xB5, 0x0A, 0xDC, 0x81,
+  0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x03, 0x2B, 0x9D, 0xD7, 0x1E, 0x6C, 0xDC, 0x32, 0x34, 0x82, 0x32,
+  0x13, 0x81, 0x31, 0xF3, 0x00, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x00, 0x08, 0xAF, 0x81, 0x52, 0x00,
+  0x03, 0xC6, 0x16, 0x31, 0xF3, 0x01, 0x54, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xDC, 0x0A,
+  0xFC, 0x5C, 0xBC, 0x73, 0xF7, 0x81, 0x00, 0x90, 0x09, 0x29, 0x48, 0x51, 0xE1, 0x59, 0xE0, 0x52,
+  0x00, 0x10, 0xEB, 0x08, 0xF0, 0x7C, 0x37, 0xCE, 0xFE, 0x2B, 0x7C, 0x0A, 0xDC, 0x81, 0x0A, 0xFC,
+  0x01, 0x0A, 0xDC, 0x12, 0x9B, 0x82, 0x0A, 0x7A, 0x01, 0x0A, 0x9A, 0x0A, 0xDC, 0x84, 0x0A, 0xFC,
+  0x06, 0x0A, 0x59, 0x5B, 0x56, 0x42, 0xB5, 0x00, 0xB0, 0xE7, 0x7E, 0x5C, 0x5C, 0x12, 0xDC, 0x81,
+  0x0A, 0xFC, 0x06, 0x0A, 0x9B, 0x29, 0xF4, 0x7C, 0x17, 0x31, 0xF2, 0x31, 0xF3, 0x8C, 0xB8, 0x2B,
+  0x5C, 0x82, 0x0A, 0xFC, 0x07, 0x0A, 0xDC, 0x01, 0xD6, 0x29, 0x91, 0xE7, 0x1D, 0x08, 0xD1, 0x9D,
+  0x59, 0xB6, 0x7E, 0x12, 0xDB, 0x82, 0x0A, 0xFC, 0x01, 0x0A, 0xDC, 0x12, 0x7A, 0x83, 0x0A, 0x7A,
+  0x85, 0x0A, 0xFC, 0x07, 0x12, 0xDC, 0x0A, 0x9A, 0x09, 0x13, 0x6B, 0xB6, 0xE7, 0x1B, 0x62, 0x62,
+  0x51, 0xE0, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x08, 0x52, 0x00, 0x5A, 0x41, 0xB5,
+  0x93, 0xF7, 0xDE, 0x7C, 0x17, 0x74, 0x38, 0x7D, 0x1D, 0x74, 0xFC, 0x12, 0xFC, 0x83, 0x0A, 0xFC,
+  0x03, 0x0A, 0xDC, 0x0A, 0xFC, 0x2B, 0x7D, 0x7D, 0x1D, 0x81, 0x75, 0x1D, 0x81, 0x7D, 0x1D, 0x05,
+  0x75, 0x1D, 0xBE, 0x7D, 0x8C, 0x98, 0x08, 0xB1, 0x00, 0x90, 0x00, 0xB0, 0x81, 0x29, 0x29, 0x04,
+  0x5B, 0x12, 0xBE, 0x1B, 0x00, 0xF1, 0x0A, 0xBB, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x02, 0x64, 0xBC,
+  0xBE, 0x1B, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x00, 0x19, 0x2B, 0x81, 0x29, 0x29, 0x05, 0x08, 0xAE,
+  0xA5, 0x39, 0xC6, 0xDD, 0x23, 0x3B, 0x0A, 0xFC, 0x12, 0xDC, 0x81, 0x0A, 0xFC, 0x01, 0x0A, 0xDC,
+  0x09, 0x75, 0x82, 0x00, 0x90, 0x02, 0x00, 0xF2, 0x0A, 0xFC, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x06,
+  0x09, 0x95, 0x5B, 0x55, 0x42, 0x95, 0x00, 0xB0, 0x95, 0xBE, 0x0A, 0xDC, 0x0A, 0xFB, 0x82, 0x0A,
+  0xFC, 0x01, 0x1B, 0x1C, 0x7D, 0x1C, 0x81, 0x7D, 0x1D, 0x01, 0x7C, 0xFD, 0x1B, 0x1C, 0x82, 0x0A,
+  0xDC, 0x07, 0x12, 0xDB, 0x01, 0x13, 0x9D, 0x19, 0x63, 0x76, 0x3A, 0x13, 0xD6, 0xBC, 0x33, 0xBC,
+  0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x02, 0x0A, 0xDC, 0x0A, 0x39, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x01,
+  0x00, 0xB0, 0x00, 0xD2, 0x85, 0x0A, 0xFC, 0x05, 0x12, 0x9A, 0x00, 0xF2, 0x73, 0xF7, 0xDE, 0xDA,
+  0x73, 0x26, 0x59, 0xE0, 0x81, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x60, 0x52, 0x00, 0x89, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x05, 0x62, 0x83, 0xC6, 0x15, 0xB5, 0xDB, 0x09, 0x12, 0x0A, 0x17, 0x12,
+  0xDC, 0x87, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x05, 0x33, 0x9C, 0xD6, 0xFD, 0x08,
+  0xF1, 0x00, 0x90, 0x00, 0xB1, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x03, 0xDF, 0x1D, 0x74, 0x17, 0x0A,
+  0x9A, 0x12, 0xDC, 0x82, 0x0A, 0xFC, 0x02, 0x23, 0x7C, 0xAE, 0x3D, 0x08, 0xD0, 0x81, 0x00, 0x90,
+  0x06, 0x00, 0xB1, 0x00, 0xB0, 0x00, 0x91, 0x84, 0x57, 0xD7, 0x1E, 0x3B, 0xBC, 0x0A, 0xDC, 0x84,
+  0x0A, 0xFC, 0x00, 0x6C, 0x7B, 0x82, 0xAD, 0xBA, 0x01, 0x9D, 0x5A, 0x0A, 0xDC, 0x84, 0x0A, 0xFC,
+  0x05, 0x2A, 0x14, 0xCE, 0x7C, 0x42, 0x95, 0x00, 0x90, 0x95, 0xBE, 0x0A, 0xDC, 0x83, 0x0A, 0xFC,
+  0x00, 0x12, 0xFC, 0x83, 0x0A, 0xFC, 0x00, 0x12, 0xFC, 0x81, 0x0A, 0xFC, 0x08, 0x0A, 0xDC, 0x12,
+  0xDB, 0x4A, 0xF5, 0xD6, 0xFD, 0x00, 0x90, 0x5B, 0x35, 0x8D, 0x9D, 0x1B, 0x1C, 0x12, 0xDC, 0x81,
+  0x0A, 0xDC, 0x02, 0x0A, 0x79, 0x00, 0xF2, 0x95, 0x19, 0x82, 0xAD, 0xBA, 0x00, 0x9D, 0x7A, 0x83,
+  0x0A, 0xFC, 0x05, 0x0A, 0xDC, 0x0A, 0x9B, 0x01, 0x13, 0x7C, 0x37, 0xE7, 0x1C, 0x73, 0x26, 0x81,
+  0x52, 0x00, 0x81, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x20, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x82,
+  0x52, 0x00, 0x05, 0x62, 0x83, 0xD6, 0xB8, 0x9D, 0x19, 0x11, 0x32, 0x0A, 0x79, 0x0A, 0xDC, 0x84,
+  0x0A, 0xFC, 0x00, 0x0A, 0xDB, 0x82, 0x0A, 0x9B, 0x00, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x81, 0x0A,
+  0xDC, 0x03, 0xC6, 0xDE, 0xAD, 0xBA, 0x00, 0x90, 0x00, 0xB1, 0x82, 0x00, 0x90, 0x04, 0x4A, 0xD5,
+  0xB5, 0xBA, 0x09, 0x12, 0x0A, 0x9A, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x04, 0x8D, 0x7D, 0x21, 0x91,
+  0x00, 0xB0, 0x00, 0x90, 0x00, 0xB1, 0x81, 0x00, 0x90, 0x03, 0xB5, 0xDB, 0x21, 0xF4, 0x0A, 0xBB,
+  0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x05, 0x95, 0xBE, 0x21, 0x91, 0x21, 0xB3, 0x21, 0x92, 0xAD, 0xBB,
+  0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x05, 0x3A, 0x75, 0xAD, 0x9A, 0x11, 0x32, 0xC6, 0x5B, 0x7D, 0x5D,
+  0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x00, 0x0A, 0x9B, 0x82, 0x0A, 0x9A, 0x01, 0x0A, 0xBB, 0x0A, 0xDC,
+  0x82, 0x0A, 0xFC, 0x06, 0x0A, 0xDB, 0x01, 0x12, 0x84, 0x58, 0x6B, 0xD6, 0x11, 0x31, 0xCE, 0xBC,
+  0x54, 0x7C, 0x82, 0x0A, 0xDC, 0x09, 0x0A, 0xDB, 0x09, 0x12, 0x7C, 0x17, 0xDE, 0xDD, 0x32, 0x13,
+  0x21, 0xB2, 0x4A, 0x94, 0xD7, 0x1E, 0x0A, 0xDC, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x04, 0x0A, 0xBB,
+  0x09, 0x33, 0x4A, 0xB4, 0xDE, 0xFB, 0x83, 0x88, 0x82, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x02, 0x52,
+  0x00, 0x5A, 0x00, 0x52, 0x00, 0x8B, 0x5A, 0x00, 0x06, 0x52, 0x00, 0x51, 0xE0, 0x4A, 0x00, 0xE7,
+  0x1B, 0x94, 0xB8, 0x00, 0xD1, 0x12, 0x9A, 0x82, 0x0A, 0xFC, 0x02, 0x12, 0xDC, 0x0A, 0xDC, 0x0A,
+  0x39, 0x81, 0x00, 0x90, 0x08, 0x00, 0xD2, 0x12, 0xBB, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A,
+  0xFC, 0x1B, 0x3C, 0xC6, 0x5C, 0x08, 0xF1, 0x81, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x04, 0x29, 0xF3,
+  0xE7, 0x5D, 0x29, 0xD2, 0x12, 0x59, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xFB, 0x7D, 0x3D,
+  0xE7, 0x5D, 0x08, 0xF1, 0x83, 0x00, 0x90, 0x03, 0xB5, 0xDB, 0x19, 0x51, 0x09, 0x75, 0x12, 0xDC,
+  0x83, 0x0A, 0xFC, 0x06, 0x0A, 0xDC, 0x95, 0xBE, 0x00, 0x8F, 0x00, 0x91, 0x00, 0x90, 0xA5, 0x7A,
+  0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x06, 0x12, 0xDC, 0x12, 0x9B, 0x3A, 0x75, 0x9D, 0x19, 0x08, 0xF1,
+  0xDF, 0x5E, 0x12, 0xFC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xDC, 0x12, 0xBB, 0x00, 0xF2, 0x00, 0x91,
+  0x81, 0x00, 0xB0, 0x00, 0x01, 0x33, 0x81, 0x12, 0xDC, 0x81, 0x0A, 0xFC, 0x06, 0x0A, 0x9A, 0x11,
+  0x11, 0xEF, 0x5E, 0x52, 0xF5, 0x31, 0xF2, 0x95, 0xDD, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x04, 0x0A,
+  0xDC, 0x0A, 0x9A, 0x4A, 0x95, 0xEF, 0x7E, 0x19, 0x32, 0x81, 0x00, 0x90, 0x01, 0xCE, 0x7C, 0xCE,
+  0xFE, 0x81, 0x0A, 0xFC, 0x05, 0x0A, 0xDC, 0x0A, 0xDB, 0x01, 0x34, 0x3A, 0x53, 0xF7, 0xBE, 0x7B,
+  0x67, 0x81, 0x52, 0x00, 0x92, 0x5A, 0x00, 0x07, 0x52, 0x00, 0x51, 0xE0, 0x5A, 0x00, 0x73, 0x26,
+  0xD6, 0x98, 0x73, 0xD6, 0x09, 0x11, 0x0A, 0x7A, 0x81, 0x0A, 0xFC, 0x08, 0x0A, 0xDC, 0x12, 0xDC,
+  0x5B, 0x77, 0x63, 0x96, 0x63, 0x76, 0x5B, 0x16, 0x08, 0xF3, 0x0A, 0x7A, 0x12, 0xDC, 0x81, 0x0A,
+  0xFC, 0x03, 0x13, 0x1C, 0xA5, 0xFD, 0x6B, 0x96, 0x00, 0xB0, 0x81, 0x00, 0x90, 0x05, 0x00, 0xB1,
+  0x00, 0xB0, 0x52, 0xF5, 0x7C, 0x37, 0x11, 0x73, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xFB,
+  0x0A, 0xFC, 0xDF, 0x1E, 0x08, 0xF1, 0x83, 0x00, 0x90, 0x03, 0x6B, 0xB6, 0xBE, 0x1B, 0x01, 0x94,
+  0x0A, 0xDC, 0x84, 0x0A, 0xFC, 0x05, 0x95, 0xBD, 0x5B, 0x35, 0x00, 0xD0, 0x00, 0x91, 0xA5, 0x7A,
+  0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x05, 0x00, 0xD2, 0x74, 0x17, 0x9D, 0x19, 0x08, 0xF1, 0xE7, 0x5E,
+  0x12, 0xFC, 0x81, 0x0A, 0xFC, 0x02, 0x0A, 0x9B, 0x01, 0x13, 0x52, 0xF5, 0x81, 0x63, 0x76, 0x01,
+  0x63, 0x96, 0x4B, 0x57, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x05, 0x09, 0x53, 0x63, 0x75, 0x8C,
+  0x78, 0x00, 0xB0, 0xEF, 0x9E, 0x64, 0xBD, 0x82, 0x0A, 0xFC, 0x0F, 0x0A, 0x58, 0x09, 0x12, 0x94,
+  0xB8, 0x85, 0x5D, 0x00, 0xD2, 0x00, 0xB0, 0x29, 0xD3, 0xCE, 0xBD, 0x23, 0x3C, 0x0A, 0xDC, 0x0A,
+  0xFC, 0x0A, 0xDB, 0x01, 0x75, 0x42, 0x94, 0xDE, 0xDB, 0xA4, 0xAE, 0x81, 0x52, 0x00, 0x94, 0x5A,
+  0x00, 0x81, 0x52, 0x00, 0x09, 0x51, 0xE0, 0x72, 0xE5, 0xE7, 0x3C, 0x8C, 0x98, 0x01, 0x12, 0x0A,
+  0x7A, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0xC6, 0x7D, 0x81, 0x5B, 0x36, 0x04, 0xD6, 0xBC, 0x63,
+  0x96, 0x01, 0x33, 0x0A, 0xDB, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x0A, 0x3B, 0xDC, 0xC6, 0x5B, 0x29,
+  0xD2, 0x11, 0x11, 0x9D, 0x19, 0x9D, 0x39, 0xA5, 0x39, 0xBE, 0x1B, 0xFF, 0xDE, 0x2B, 0x19, 0x0A,
+  0xDC, 0x81, 0x0A, 0xFC, 0x03, 0x0A, 0xDC, 0x12, 0xDB, 0xE7, 0x7E, 0xA5, 0x5A, 0x82, 0x9D, 0x39,
+  0x04, 0x4A, 0xB5, 0x00, 0x90, 0xBE, 0x1C, 0x00, 0xF2, 0x0A, 0xBB, 0x83, 0x0A, 0xFC, 0x06, 0x0A,
+  0xDC, 0x3B, 0xFC, 0xE7, 0x3E, 0x08, 0xF1, 0x00, 0x90, 0xA5, 0x7A, 0x0A, 0xDC, 0x82, 0x0A, 0xFC,
+  0x05, 0x0A, 0xDC, 0x00, 0xD2, 0xB5, 0xDA, 0x3A, 0x34, 0x73, 0xF7, 0xEF, 0x9E, 0x82, 0x0A, 0xFC,
+  0x02, 0x0A, 0x38, 0x63, 0x76, 0xD6, 0x9C, 0x81, 0x5B, 0x35, 0x01, 0xD6, 0xDC, 0xBE, 0x9E, 0x81,
+  0x12, 0xDC, 0x07, 0x0A, 0xFC, 0x0A, 0x59, 0x09, 0x32, 0xDF, 0x1D, 0x32, 0x13, 0x63, 0x96, 0xE7,
+  0x5E, 0x13, 0x1C, 0x82, 0x0A, 0xFC, 0x11, 0x01, 0x54, 0x84, 0x57, 0xCE, 0x9C, 0x32, 0x55, 0x09,
+  0xF7, 0x29, 0xF3, 0xC6, 0x5C, 0x7D, 0x3C, 0x12, 0xFC, 0x12, 0xDC, 0x0A, 0xDC, 0x01, 0x54, 0x3A,
+  0x73, 0xDE, 0xFD, 0x94, 0x2C, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0x0D, 0x7B, 0x68, 0xE7, 0x1B, 0x5B, 0x55, 0x09, 0x33, 0x0A, 0xDB, 0x12, 0xDC, 0x0A, 0xDC,
+  0xCE, 0xDD, 0x8C, 0x98, 0x00, 0xB0, 0x4A, 0x94, 0xDE, 0xFC, 0x52, 0xF4, 0x09, 0x33, 0x82, 0x0A,
+  0xDC, 0x0A, 0x13, 0x1C, 0xAE, 0x3E, 0x4A, 0xB4, 0x19, 0x52, 0xF7, 0x9E, 0x73, 0xD7, 0x43, 0xFB,
+  0x44, 0x1D, 0x44, 0x1C, 0x13, 0x1C, 0x0A, 0xDC, 0x82, 0x0A, 0xFC, 0x01, 0x0A, 0xDC, 0x44, 0x1C,
+  0x82, 0x4C, 0x1C, 0x05, 0x5C, 0x9C, 0x7C, 0x38, 0x00, 0xB0, 0xDE, 0xFD, 0x73, 0xF6, 0x0A, 0x9A,
+  0x84, 0x0A, 0xFC, 0x05, 0x0A, 0xDB, 0xE7, 0x5E, 0x21, 0x52, 0x08, 0xF1, 0xA5, 0x9A, 0x0A, 0xDC,
+  0x81, 0x0A, 0xFC, 0x81, 0x0A, 0xDC, 0x05, 0x00, 0xD2, 0x9D, 0x39, 0x00, 0x90, 0xAD, 0x9A, 0x54,
+  0x5C, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x02, 0x0A, 0x38, 0x9D, 0x19, 0x63, 0x76, 0x81, 0x10, 0xF1,
+  0x1D, 0xBE, 0x3B, 0x33, 0xBC, 0x12, 0xFB, 0x0A, 0xFC, 0x0A, 0xDC, 0x09, 0xD6, 0x94, 0xD9, 0xDE,
+  0xFD, 0x08, 0xD1, 0x9D, 0x59, 0x43, 0xFC, 0x12, 0xFB, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x01,
+  0x54, 0xBE, 0x1B, 0x3A, 0x33, 0x11, 0x11, 0x1A, 0xFB, 0xBE, 0x3C, 0xA6, 0x1E, 0x1B, 0x1C, 0x0A,
+  0xDC, 0x0A, 0xDB, 0x09, 0xB6, 0x21, 0x72, 0xCE, 0x9B, 0xA4, 0xAE, 0x5A, 0x20, 0x81, 0x52, 0x00,
+  0x97, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x17, 0x6A, 0xC4, 0xEF, 0x9D, 0x52, 0xF5, 0x00, 0xB1, 0x0A,
+  0xBB, 0x12, 0xDC, 0x3B, 0xBC, 0xEF, 0x9E, 0x4A, 0xB4, 0x00, 0xB0, 0x4A, 0xB4, 0xE7, 0x7E, 0x19,
+  0x51, 0x0A, 0x9B, 0x0A, 0xFC, 0x0A, 0xDC, 0x12, 0xDC, 0x85, 0x7D, 0xDF, 0x1D, 0x00, 0x70, 0x7C,
+  0x16, 0x5B, 0x15, 0x01, 0x13, 0x02, 0xFC, 0x81, 0x0A, 0xDC, 0x00, 0x12, 0xDC, 0x81, 0x0A, 0xFC,
+  0x00, 0x12, 0xFC, 0x81, 0x0A, 0xDC, 0x00, 0x12, 0xFC, 0x81, 0x0A, 0xDC, 0x06, 0x2B, 0x7B, 0xEF,
+  0x9E, 0x42, 0x74, 0x3A, 0x13, 0x9D, 0x19, 0x0A, 0x7A, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x01, 0x0A,
+  0xDB, 0xDF, 0x7F, 0x81, 0xE7, 0x7E, 0x00, 0xCE, 0xDE, 0x81, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x05,
+  0x09, 0xD7, 0x11, 0x31, 0xA5, 0x59, 0x00, 0x90, 0xAD, 0x9A, 0x1B, 0x3C, 0x81, 0x0A, 0xFC, 0x81,
+  0x0A, 0xDC, 0x01, 0x95, 0xBD, 0xE7, 0x7E, 0x81, 0xDF, 0x7E, 0x0C, 0xDF, 0x5E, 0x12, 0xFB, 0x12,
+  0xDC, 0x0A, 0xDC, 0x0A, 0x59, 0x08, 0xD1, 0xB5, 0xDB, 0x11, 0x11, 0x73, 0xF7, 0xE7, 0x7F, 0x12,
+  0xDB, 0x0A, 0xDC, 0x12, 0xFC, 0x82, 0x0A, 0xFC, 0x05, 0xB6, 0x7E, 0xE7, 0x5E, 0xE7, 0x7F, 0xE7,
+  0x7E, 0xAE, 0x1D, 0x0A, 0xDB, 0x81, 0x0A, 0xDC, 0x04, 0x01, 0x96, 0x11, 0x31, 0xF7, 0xBE, 0xB5,
+  0xB1, 0x5A, 0x40, 0x82, 0x52, 0x00, 0x99, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x17, 0x9C, 0x4C, 0xDE,
+  0xFB, 0x3A, 0x53, 0x09, 0x75, 0x0A, 0xBB, 0x0A, 0xFC, 0x44, 0x1C, 0xE7, 0x5E, 0x5B, 0x15, 0x00,
+  0xB1, 0x94, 0xF8, 0x52, 0xF5, 0x09, 0x54, 0x0A, 0x9A, 0x12, 0xDC, 0x0A, 0xDC, 0x12, 0xFC, 0xAE,
+  0x1C, 0x3A, 0x33, 0x5B, 0x55, 0xDF, 0x1D, 0x11, 0x52, 0x0A, 0x7A, 0x0A, 0xDC, 0x88, 0x0A, 0xFC,
+  0x08, 0x0A, 0xDC, 0x12, 0xDC, 0x8D, 0x7D, 0x73, 0xD7, 0x3A, 0x53, 0xB5, 0xDA, 0x08, 0xD1, 0x0A,
+  0x9A, 0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x02, 0x12, 0xFC, 0x0A, 0xDC, 0x12, 0xFC, 0x81, 0x1B, 0x1C,
+  0x00, 0x12, 0xFC, 0x83, 0x0A, 0xFC, 0x0A, 0x09, 0xF6, 0xD6, 0x9C, 0xA5, 0x36, 0x19, 0x52, 0xB6,
+  0x3B, 0x1B, 0x3C, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x12, 0xFC, 0x12, 0xFD, 0x81, 0x1B, 0x1C,
+  0x81, 0x13, 0x1C, 0x00, 0x0A, 0xFB, 0x81, 0x0A, 0xFC, 0x05, 0x09, 0xF7, 0x63, 0x76, 0xBE, 0x1B,
+  0x09, 0x11, 0x94, 0xF9, 0x6C, 0xBC, 0x84, 0x0A, 0xFC, 0x00, 0x0A, 0xDC, 0x81, 0x12, 0xFC, 0x81,
+  0x1B, 0x1C, 0x08, 0x12, 0xFC, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0x39, 0x21, 0x92, 0xB5, 0xBA, 0xBD,
+  0xD4, 0x5A, 0x21, 0x52, 0x00, 0x9C, 0x5A, 0x00, 0x1A, 0x52, 0x00, 0x51, 0xE0, 0x52, 0x00, 0x8C,
+  0x0B, 0xEF, 0x7E, 0x4A, 0xB4, 0x01, 0x54, 0x01, 0x96, 0x09, 0xB5, 0x53, 0x57, 0xC6, 0x5C, 0x00,
+  0x90, 0x4A, 0xB4, 0xEF, 0x7E, 0x5B, 0x35, 0x01, 0x33, 0x01, 0xB5, 0x01, 0xB6, 0x01, 0x96, 0x63,
+  0x96, 0xDE, 0xFD, 0x00, 0x91, 0xB5, 0xBA, 0x73, 0xD7, 0x00, 0xF2, 0x09, 0xB5, 0x09, 0xB6, 0x87,
+  0x01, 0xB6, 0x08, 0x01, 0x96, 0x01, 0xB6, 0x42, 0xB6, 0xD6, 0xBC, 0x21, 0x71, 0xA5, 0x5A, 0x21,
+  0x91, 0x01, 0x75, 0x01, 0xB5, 0x81, 0x09, 0xB6, 0x81, 0x01, 0xB6, 0x00, 0x01, 0xB5, 0x86, 0x01,
+  0xB6, 0x07, 0x01, 0x33, 0xD6, 0xDD, 0x5A, 0x87, 0x5B, 0x55, 0x94, 0xD9, 0x11, 0xD5, 0x01, 0xB6,
+  0x09, 0xB6, 0x81, 0x01, 0xB6, 0x00, 0x09, 0xB5, 0x82, 0x01, 0xB6, 0x00, 0x01, 0xB5, 0x82, 0x01,
+  0xB6, 0x06, 0x21, 0xB3, 0xB5, 0xDB, 0x3A, 0x33, 0x10, 0xF1, 0xBD, 0xFA, 0x2A, 0x76, 0x01, 0xB6,
+  0x84, 0x09, 0xB6, 0x00, 0x01, 0xB5, 0x84, 0x01, 0xB6, 0x04, 0x09, 0x95, 0x08, 0xF1, 0xBE, 0x1B,
+  0xBD, 0x93, 0x51, 0xE0, 0x81, 0x52, 0x00, 0x9E, 0x5A, 0x00, 0x04, 0x52, 0x00, 0x5A, 0x20, 0x94,
+  0x4D, 0xCE, 0x7B, 0x32, 0x13, 0x82, 0x00, 0xB0, 0x05, 0xC6, 0x5B, 0x6B, 0xB6, 0x00, 0xB0, 0x52,
+  0xD4, 0xD6, 0xBC, 0x4A, 0xF5, 0x82, 0x00, 0xB0, 0x04, 0x19, 0x32, 0xEF, 0x7E, 0x52, 0xF5, 0x43,
+  0x79, 0xBE, 0x1B, 0x84, 0x00, 0xB0, 0x00, 0x00, 0xB1, 0x87, 0x00, 0xB0, 0x03, 0xB5, 0xDB, 0x00,
+  0xB0, 0x5B, 0x56, 0x21, 0x91, 0x81, 0x00, 0xB0, 0x00, 0x00, 0x90, 0x83, 0x00, 0xB0, 0x00, 0x00,
+  0xB1, 0x85, 0x00, 0xB0, 0x04, 0x00, 0x91, 0xD6, 0xDD, 0x62, 0xE9, 0x64, 0x3B, 0x4A, 0xB5, 0x8C,
+  0x00, 0xB0, 0x06, 0x42, 0x74, 0xBD, 0xFB, 0x21, 0x72, 0x9D, 0x19, 0x84, 0x78, 0x00, 0xB0, 0x00,
+  0xB1, 0x8A, 0x00, 0xB0, 0x04, 0x08, 0xF1, 0x9D, 0x19, 0xC5, 0xF4, 0x62, 0xA3, 0x52, 0x00, 0xA0,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x14, 0x51, 0xE0, 0x9C, 0x8E, 0xE7, 0x5C, 0xE7, 0x1E, 0xE7, 0x3E,
+  0xE7, 0x1E, 0xE7, 0x5D, 0xE7, 0x5E, 0x52, 0xF5, 0x00, 0x91, 0x53, 0x15, 0xE7, 0x3D, 0xE7, 0x1D,
+  0xE7, 0x3E, 0xE7, 0x1E, 0xE7, 0x1D, 0xEF, 0x5D, 0x73, 0xF7, 0x0A, 0x38, 0xDF, 0x3E, 0xDF, 0x3D,
+  0x81, 0xE7, 0x3E, 0x82, 0xE7, 0x1E, 0x81, 0xE7, 0x3E, 0x00, 0xDF, 0x1E, 0x83, 0xE7, 0x3E, 0x04,
+  0xE7, 0x3D, 0xE7, 0x3E, 0x00, 0xD0, 0x5B, 0x36, 0xDF, 0x3C, 0x81, 0xE7, 0x3D, 0x01, 0xE7, 0x3C,
+  0xE7, 0x3D, 0x84, 0xE7, 0x3E, 0x08, 0xDF, 0x3E, 0xE7, 0x3D, 0xE7, 0x5D, 0xE7, 0x3C, 0xE7, 0x3D,
+  0xE7, 0x3C, 0xEF, 0x5C, 0x5A, 0xEA, 0x5C, 0x7C, 0x8D, 0xE7, 0x3E, 0x05, 0xDF, 0x3E, 0x8C, 0xB8,
+  0x08, 0xF1, 0xD6, 0xDC, 0xE7, 0x3D, 0xDF, 0x3E, 0x84, 0xE7, 0x3E, 0x01, 0xDF, 0x3E, 0xE7, 0x1E,
+  0x82, 0xE7, 0x3E, 0x81, 0xE7, 0x3D, 0x04, 0xE7, 0x3C, 0xE6, 0xFA, 0x51, 0xE0, 0x52, 0x00, 0x51,
+  0xE0, 0xA0, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x02, 0x52, 0x20, 0x52, 0x23, 0x11, 0x10, 0x81, 0x09,
+  0x11, 0x04, 0x08, 0xF1, 0x09, 0x11, 0x00, 0xD1, 0x00, 0x90, 0x00, 0xD1, 0x81, 0x08, 0xF1, 0x82,
+  0x09, 0x11, 0x05, 0x08, 0xF1, 0x11, 0xF6, 0x01, 0x34, 0x1A, 0x99, 0x09, 0x11, 0x08, 0xF1, 0x82,
+  0x09, 0x11, 0x03, 0x08, 0xF1, 0x1A, 0x58, 0x12, 0x37, 0x10, 0xF2, 0x81, 0x09, 0x11, 0x83, 0x08,
+  0xF1, 0x02, 0x0A, 0x58, 0x00, 0xD1, 0x4A, 0x04, 0x82, 0x5A, 0x41, 0x09, 0x5A, 0x22, 0x11, 0x10,
+  0x08, 0xF1, 0x09, 0x32, 0x1A, 0x79, 0x1A, 0x58, 0x1A, 0xFB, 0x11, 0x32, 0x42, 0xCD, 0x5A, 0x21,
+  0x82, 0x5A, 0x41, 0x03, 0x10, 0xEE, 0x09, 0x95, 0x11, 0x94, 0x08, 0xF1, 0x87, 0x09, 0x11, 0x81,
+  0x08, 0xF1, 0x05, 0x09, 0x11, 0x08, 0xF1, 0x11, 0x74, 0x12, 0x17, 0x00, 0xB0, 0x08, 0xF1, 0x81,
+  0x09, 0x11, 0x01, 0x08, 0xF1, 0x09, 0x11, 0x81, 0x08, 0xF1, 0x01, 0x11, 0x73, 0x11, 0xB5, 0x81,
+  0x08, 0xF1, 0x82, 0x09, 0x11, 0x02, 0x29, 0x6B, 0x5A, 0x42, 0x5A, 0x21, 0x82, 0x52, 0x00, 0x96,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x03, 0x52,
+  0x00, 0x51, 0xE0, 0x63, 0x30, 0x6B, 0xD7, 0x82, 0x6B, 0xD6, 0x00, 0x73, 0xD7, 0x83, 0x6B, 0xD7,
+  0x00, 0x6B, 0xD6, 0x82, 0x6B, 0xD7, 0x05, 0x6B, 0xD6, 0x74, 0x7A, 0x74, 0x38, 0x5B, 0xFA, 0x00,
+  0x90, 0x5B, 0x56, 0x82, 0x6B, 0xD7, 0x06, 0x6B, 0xB7, 0x74, 0x9A, 0x74, 0x7A, 0x00, 0xB0, 0x19,
+  0x52, 0x6B, 0xD7, 0x6B, 0xD6, 0x81, 0x6B, 0xD7, 0x0F, 0x6B, 0xB7, 0x5C, 0x1A, 0x00, 0xB0, 0x21,
+  0x29, 0x51, 0xE1, 0x51, 0xE0, 0x52, 0x00, 0x51, 0xE0, 0x73, 0xD6, 0x6B, 0xD6, 0x73, 0xD7, 0x74,
+  0x9B, 0x74, 0x9A, 0x74, 0xDC, 0x73, 0xF7, 0x63, 0x4C, 0x81, 0x52, 0x00, 0x05, 0x59, 0xE0, 0x31,
+  0x66, 0x00, 0xAF, 0x2A, 0x55, 0x6C, 0x38, 0x6B, 0xD6, 0x88, 0x6B, 0xD7, 0x04, 0x6B, 0xD6, 0x6B,
+  0xB7, 0x11, 0x11, 0x21, 0xB3, 0x74, 0x9A, 0x81, 0x6B, 0xD7, 0x08, 0x6B, 0xD6, 0x6B, 0xB7, 0x6B,
+  0xD6, 0x6B, 0xB7, 0x21, 0xB3, 0x00, 0x90, 0x11, 0x72, 0x6C, 0x39, 0x6B, 0xD7, 0x81, 0x6B, 0xD6,
+  0x82, 0x6B, 0xD7, 0x02, 0x52, 0x44, 0x59, 0xE0, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x92, 0x5A, 0x00, 0x02, 0x5A, 0x20, 0x52, 0x20, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x01, 0x5A, 0x40,
+  0x52, 0x00, 0x83, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x04, 0x83, 0xC9, 0xF7, 0x9D, 0xD6, 0x9D, 0x73,
+  0xD7, 0x7C, 0xFC, 0x84, 0x75, 0x3D, 0x03, 0x75, 0x1D, 0x7D, 0x1D, 0x75, 0x1D, 0x7D, 0x1D, 0x81,
+  0x75, 0x1D, 0x06, 0x7D, 0x1C, 0xBE, 0x1B, 0x00, 0x90, 0xCE, 0x9D, 0xE7, 0x3E, 0x73, 0xD6, 0x7C,
+  0x9A, 0x81, 0x75, 0x1D, 0x0B, 0xBE, 0x9E, 0x7C, 0x57, 0x42, 0x74, 0xA5, 0x59, 0x74, 0xDB, 0x75,
+  0x3C, 0x7D, 0x1D, 0x7D, 0x1C, 0xBE, 0x1B, 0x00, 0x90, 0x00, 0xB0, 0x49, 0xC2, 0x81, 0x52, 0x00,
+  0x03, 0x51, 0xE0, 0xC6, 0xDE, 0x75, 0x1D, 0x7D, 0x3C, 0x82, 0x75, 0x1D, 0x01, 0x85, 0x7D, 0xA4,
+  0x8D, 0x81, 0x52, 0x00, 0x05, 0x59, 0xE0, 0x10, 0xCE, 0x00, 0x90, 0x63, 0x55, 0x9D, 0xDD, 0x75,
+  0x1D, 0x81, 0x75, 0x3D, 0x85, 0x75, 0x1D, 0x17, 0x7D, 0x3C, 0x94, 0xF9, 0xFF, 0xDF, 0x21, 0x72,
+  0x3A, 0x74, 0xC6, 0xBE, 0x7D, 0x1D, 0x75, 0x1D, 0x74, 0x9A, 0x73, 0xF6, 0xF7, 0xDF, 0xCE, 0x5C,
+  0x21, 0xD2, 0x11, 0x31, 0x9D, 0x39, 0x9D, 0xFD, 0x75, 0x1D, 0x7D, 0x1D, 0x74, 0x7A, 0x73, 0xD6,
+  0xEF, 0x7E, 0xD6, 0x77, 0x62, 0x62, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x60,
+  0x91, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x00, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x01, 0x52, 0x20, 0x52,
+  0x00, 0x83, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x05, 0x51, 0xE0, 0x83, 0xA9, 0xE7, 0x5D, 0x3A, 0x53,
+  0x01, 0x13, 0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x83, 0x0A, 0xDC, 0x14, 0x0A, 0xFB, 0xDF, 0x3E, 0x84,
+  0xD8, 0x19, 0x72, 0xC6, 0x7C, 0x8C, 0xB8, 0x00, 0xF2, 0x02, 0xBA, 0x12, 0xDC, 0x1B, 0x3C, 0xDF,
+  0x5E, 0xDF, 0x3D, 0xE7, 0x5D, 0x3A, 0xB6, 0x12, 0xFC, 0x0A, 0xFC, 0x0A, 0xDC, 0xBE, 0x1C, 0x00,
+  0xB0, 0x00, 0x91, 0x49, 0xC2, 0x81, 0x52, 0x00, 0x01, 0x51, 0xE0, 0x9D, 0xFE, 0x83, 0x0A, 0xDC,
+  0x02, 0x0A, 0xFC, 0x2B, 0x7C, 0x9C, 0x8D, 0x81, 0x52, 0x00, 0x05, 0x51, 0xE0, 0x08, 0xCE, 0x00,
+  0xB0, 0x5B, 0x56, 0x4C, 0x3D, 0x0A, 0xDC, 0x87, 0x0A, 0xFC, 0x15, 0x01, 0x54, 0x4A, 0xD5, 0x94,
+  0xD8, 0x00, 0xB1, 0xC6, 0x5C, 0x95, 0xBD, 0x0A, 0xFC, 0x0A, 0xDC, 0x01, 0xB6, 0x84, 0x98, 0xDE,
+  0xFD, 0x19, 0x72, 0x08, 0xD1, 0xBE, 0x1B, 0xCE, 0xDE, 0x1B, 0x1C, 0x0A, 0xDC, 0x0A, 0x39, 0x09,
+  0x11, 0xBE, 0x3B, 0xC6, 0x36, 0x5A, 0x42, 0x86, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x20, 0x52,
+  0x00, 0x90, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x03, 0x51, 0xE0, 0x52, 0x00, 0x73,
+  0x40, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x04, 0x5A, 0x00, 0x8B, 0xEA, 0xEF, 0x5D,
+  0x29, 0xD2, 0x01, 0x75, 0x86, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x14, 0x0A, 0xFC, 0x4C, 0x1D, 0xA5,
+  0x7A, 0x00, 0x90, 0x31, 0xF3, 0xEF, 0x9E, 0x5B, 0x15, 0x00, 0xB2, 0x0A, 0xFB, 0x12, 0xDC, 0x2B,
+  0x9C, 0xEF, 0x9E, 0xFF, 0xDF, 0x42, 0xD5, 0x0A, 0xDC, 0x0A, 0xFC, 0x12, 0xFC, 0xBE, 0x1C, 0x00,
+  0xB0, 0x00, 0x91, 0x49, 0xC2, 0x81, 0x52, 0x00, 0x01, 0x51, 0xE0, 0x9D, 0xFE, 0x82, 0x0A, 0xFC,
+  0x81, 0x0A, 0xDC, 0x01, 0x2B, 0x7C, 0x9C, 0x8D, 0x81, 0x52, 0x00, 0x04, 0x5A, 0x60, 0x10, 0xED,
+  0x00, 0xB0, 0x63, 0x56, 0x4C, 0x3D, 0x81, 0x0A, 0xDC, 0x85, 0x0A, 0xFC, 0x16, 0x0A, 0xDB, 0x09,
+  0x33, 0xE7, 0x5E, 0x84, 0x38, 0x00, 0xB0, 0xAD, 0xDC, 0x13, 0x1C, 0x0A, 0xDC, 0x12, 0xBB, 0x00,
+  0xB1, 0x9D, 0x19, 0x10, 0xF1, 0x00, 0xB0, 0x9C, 0xF9, 0xCE, 0xFE, 0x1B, 0x1C, 0x12, 0xDB, 0x0A,
+  0xDB, 0x00, 0xB1, 0x73, 0xF7, 0xF7, 0xBE, 0x6A, 0xA4, 0x52, 0x00, 0x86, 0x5A, 0x00, 0x82, 0x52,
+  0x00, 0x95, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x00, 0x52, 0x00, 0x86, 0x5A, 0x00, 0x81,
+  0x52, 0x00, 0x03, 0xAC, 0xEF, 0xD6, 0xDC, 0x32, 0x33, 0x01, 0x95, 0x81, 0x0A, 0xDC, 0x01, 0x0A,
+  0xFC, 0x12, 0xDC, 0x82, 0x53, 0x15, 0x1B, 0x4A, 0xD5, 0x01, 0x55, 0x0A, 0xBB, 0x2B, 0x9C, 0xC6,
+  0x9E, 0x29, 0xB2, 0x00, 0x90, 0x3A, 0x54, 0xD6, 0x9C, 0x63, 0x76, 0x01, 0x34, 0x0A, 0x9A, 0x0A,
+  0xFC, 0x33, 0x9D, 0xD7, 0x3E, 0xDF, 0x5E, 0x0A, 0xDC, 0x12, 0xFC, 0x0A, 0xDC, 0xB6, 0x7D, 0x9C,
+  0xF8, 0x00, 0x90, 0x08, 0xED, 0x5A, 0x00, 0x52, 0x00, 0x49, 0xC0, 0xBD, 0xFB, 0x2A, 0xF9, 0x82,
+  0x0A, 0xFC, 0x02, 0x12, 0xFB, 0x6B, 0xB6, 0x9C, 0x8D, 0x81, 0x52, 0x00, 0x04, 0x31, 0x66, 0x00,
+  0x90, 0x3A, 0x34, 0xD7, 0x3E, 0x33, 0xBD, 0x81, 0x0A, 0xDC, 0x01, 0x0A, 0x5A, 0x0A, 0x18, 0x83,
+  0x0A, 0x38, 0x15, 0x01, 0x33, 0x42, 0x94, 0xB5, 0xDB, 0x00, 0xB0, 0xD6, 0xBC, 0x85, 0x7D, 0x0A,
+  0xFC, 0x0A, 0x39, 0x00, 0xD1, 0x9D, 0x39, 0xC6, 0x1B, 0x08, 0xB1, 0x8C, 0x98, 0xC6, 0xBE, 0x23,
+  0x7C, 0x0A, 0xDC, 0x0A, 0x59, 0x09, 0x12, 0x84, 0x58, 0xD6, 0xB9, 0x62, 0x63, 0x52, 0x00, 0xAB,
+  0x5A, 0x00, 0x82, 0x52, 0x00, 0x19, 0xAC, 0xF0, 0xCE, 0x9C, 0x29, 0xD2, 0x09, 0xB6, 0x0A, 0xDC,
+  0x0A, 0xFC, 0x1B, 0x3C, 0xD6, 0xFD, 0x8C, 0x98, 0x94, 0xD8, 0xE7, 0x5E, 0x3A, 0x33, 0x01, 0x95,
+  0x0A, 0xDC, 0x5C, 0x7D, 0x84, 0x77, 0x11, 0x31, 0x00, 0x90, 0x5B, 0x35, 0xEF, 0x7E, 0x4A, 0xB4,
+  0x01, 0x54, 0x12, 0xDC, 0x0A, 0xDC, 0x5C, 0x7D, 0x85, 0x5D, 0x82, 0x0A, 0xDC, 0x09, 0x43, 0xFC,
+  0x9D, 0x19, 0x00, 0x90, 0x08, 0xED, 0x5A, 0x00, 0x52, 0x00, 0x51, 0xE0, 0xCE, 0x36, 0x74, 0xDD,
+  0x12, 0xFC, 0x81, 0x0A, 0xFC, 0x0C, 0x2B, 0x9C, 0xF7, 0x9C, 0x83, 0x67, 0x52, 0x00, 0x51, 0xE0,
+  0x31, 0x66, 0x00, 0x90, 0x3A, 0x34, 0x9D, 0xFD, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0x7A, 0x4B, 0x16,
+  0x84, 0x73, 0xD7, 0x14, 0x6B, 0xD6, 0xDE, 0xDD, 0x63, 0x96, 0x3A, 0x13, 0xE7, 0x5D, 0x23, 0x5C,
+  0x0A, 0xDC, 0x09, 0x53, 0x6B, 0xB6, 0xC6, 0xBE, 0x32, 0x75, 0x7C, 0x37, 0xCE, 0xFD, 0x3B, 0xDC,
+  0x0A, 0xDC, 0x0A, 0xBB, 0x00, 0xF2, 0x5B, 0x55, 0xE7, 0x1B, 0x83, 0x88, 0x51, 0xE0, 0xAE, 0x5A,
+  0x00, 0x11, 0x52, 0x00, 0x5A, 0x20, 0xA4, 0xEF, 0xC6, 0x7B, 0x19, 0x31, 0x09, 0xB6, 0x0A, 0xDC,
+  0x1B, 0x3C, 0xD7, 0x1D, 0x52, 0xF4, 0x08, 0xD1, 0x5B, 0x35, 0xCE, 0xBC, 0x32, 0x13, 0x0A, 0xBB,
+  0x23, 0x5C, 0xD7, 0x3E, 0x29, 0xD3, 0x81, 0x00, 0xB0, 0x04, 0x73, 0x4A, 0xD6, 0xFC, 0x53, 0x15,
+  0x09, 0x54, 0x0A, 0xDB, 0x81, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x04, 0x43, 0xFC, 0x9D, 0x19, 0x00,
+  0xB0, 0x08, 0xCD, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x0D, 0x94, 0x4C, 0x74, 0xFC, 0x0A, 0xDC, 0x0A,
+  0xFC, 0x0A, 0xDC, 0x2B, 0x9C, 0xE7, 0x3B, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x29, 0x67, 0x00,
+  0x90, 0x42, 0x54, 0x9D, 0xFE, 0x81, 0x0A, 0xFC, 0x03, 0x09, 0xF7, 0x9C, 0xF9, 0x42, 0x93, 0x42,
+  0x94, 0x81, 0x4A, 0x94, 0x82, 0x42, 0x94, 0x11, 0x00, 0x91, 0x74, 0x37, 0x64, 0xBC, 0x13, 0x1C,
+  0x0A, 0xDC, 0x11, 0x94, 0xDF, 0x1D, 0x32, 0xF8, 0x7C, 0xDB, 0xE7, 0x5E, 0x3B, 0xDC, 0x0A, 0xDC,
+  0x0A, 0x9A, 0x09, 0x33, 0x7C, 0x37, 0xE7, 0x1C, 0x73, 0x26, 0x52, 0x00, 0xAF, 0x5A, 0x00, 0x81,
+  0x52, 0x00, 0x20, 0x5A, 0x21, 0xBD, 0xB4, 0xDF, 0x3E, 0x08, 0xF1, 0x09, 0xF7, 0x0A, 0xDC, 0x4C,
+  0x1D, 0xEF, 0x7E, 0x3A, 0x33, 0x00, 0xB0, 0x84, 0x78, 0x4A, 0x94, 0x01, 0x53, 0x02, 0xFC, 0xCE,
+  0xFE, 0xC6, 0x5C, 0x00, 0x90, 0x00, 0xB0, 0x08, 0xAF, 0x94, 0x4D, 0xEF, 0x7E, 0x12, 0xDA, 0x12,
+  0xDC, 0x0A, 0xFC, 0x12, 0xFC, 0x0A, 0xFC, 0x12, 0xFC, 0x0A, 0xDC, 0x44, 0x1C, 0xEF, 0x9E, 0x19,
+  0x71, 0x00, 0x90, 0x29, 0x29, 0x81, 0x5A, 0x00, 0x02, 0x94, 0x2C, 0x74, 0xFC, 0x0A, 0xDC, 0x81,
+  0x0A, 0xFC, 0x08, 0x2B, 0x9C, 0xE7, 0x1B, 0x52, 0x00, 0x5A, 0x00, 0x41, 0xA3, 0x00, 0xAF, 0x00,
+  0x91, 0xCE, 0x7C, 0x9D, 0xFD, 0x81, 0x0A, 0xFC, 0x02, 0x09, 0xD7, 0x9C, 0xF9, 0x00, 0x8F, 0x83,
+  0x00, 0x90, 0x0B, 0x00, 0x70, 0x00, 0xB0, 0x3A, 0x54, 0xEF, 0x7E, 0x2B, 0x7C, 0x0A, 0xFC, 0x0A,
+  0xDC, 0x1B, 0x1B, 0xE7, 0x7E, 0xDF, 0x5E, 0xEF, 0xBE, 0x1B, 0x3B, 0x81, 0x0A, 0xFC, 0x03, 0x01,
+  0x12, 0x29, 0xD2, 0xF7, 0x9E, 0x7B, 0xA8, 0x81, 0x52, 0x00, 0x99, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x93, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x16, 0x5A, 0x42, 0xC5, 0xF6, 0xAD, 0x79, 0x19, 0x72, 0x0A,
+  0x58, 0x12, 0xDC, 0x7D, 0x1D, 0xCE, 0xBC, 0x00, 0x90, 0x63, 0x55, 0xDE, 0xFD, 0x3A, 0x33, 0x01,
+  0x54, 0x1B, 0x1B, 0xBE, 0x5C, 0x29, 0x92, 0x00, 0x90, 0x00, 0xB0, 0xA4, 0xD0, 0x7C, 0x79, 0x12,
+  0xDC, 0x0A, 0xDC, 0x2A, 0x97, 0x81, 0x3A, 0x74, 0x06, 0x22, 0x57, 0x0A, 0xBB, 0x12, 0xFC, 0x6C,
+  0xFD, 0x21, 0x91, 0x00, 0x90, 0x21, 0x2A, 0x81, 0x52, 0x00, 0x02, 0x94, 0x2C, 0x8C, 0xB8, 0x12,
+  0xFC, 0x81, 0x0A, 0xFC, 0x01, 0x4B, 0x37, 0xE7, 0x3B, 0x81, 0x52, 0x00, 0x00, 0x41, 0xA4, 0x81,
+  0x00, 0x90, 0x01, 0xAD, 0xDC, 0x1B, 0x1C, 0x81, 0x0A, 0xFC, 0x02, 0x54, 0x5C, 0xBE, 0x7D, 0xB6,
+  0x3D, 0x81, 0xAE, 0x3D, 0x13, 0xAD, 0xBB, 0xBD, 0xFB, 0xC6, 0x5B, 0x29, 0xB2, 0x6B, 0xB6, 0x8D,
+  0x9D, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0xFC, 0x0A, 0xDC, 0x1B, 0x3C, 0x23, 0x3C, 0x1B, 0x3C, 0x0A,
+  0xDC, 0x12, 0xBB, 0x01, 0x53, 0x4A, 0xD5, 0xE7, 0x3C, 0x83, 0x89, 0x52, 0x00, 0x9B, 0x5A, 0x00,
+  0x01, 0x5A, 0x40, 0x52, 0x00, 0x93, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x40, 0x81, 0x52, 0x00,
+  0x12, 0x4A, 0x00, 0xCE, 0x57, 0xA5, 0x7A, 0x08, 0xD1, 0x0A, 0x18, 0x0A, 0xDC, 0xAE, 0x1C, 0x4A,
+  0xD5, 0x00, 0x90, 0x73, 0xF6, 0xD6, 0xBC, 0x3A, 0x54, 0x0A, 0x7A, 0x95, 0xDD, 0x9D, 0x39, 0x00,
+  0x90, 0x00, 0xB0, 0xD6, 0xBD, 0x53, 0xFB, 0x81, 0x0A, 0xDC, 0x15, 0x9D, 0xDD, 0xB5, 0xDB, 0xAD,
+  0x9A, 0x73, 0xF8, 0x0A, 0x39, 0x0A, 0xDC, 0x64, 0xBD, 0x21, 0x91, 0x00, 0x90, 0x19, 0x2E, 0x39,
+  0xC7, 0x39, 0x66, 0x5A, 0xED, 0xD6, 0xBD, 0x0A, 0xDB, 0x0A, 0xFC, 0x0A, 0xDC, 0xB6, 0x5C, 0x94,
+  0xB7, 0x31, 0x66, 0x39, 0x86, 0x29, 0xCC, 0x81, 0x00, 0x90, 0x01, 0xA5, 0xDB, 0x0A, 0xDC, 0x82,
+  0x0A, 0xFC, 0x83, 0x0A, 0xDC, 0x07, 0x11, 0x73, 0x73, 0xD6, 0x5B, 0x36, 0x00, 0xD0, 0xDF, 0x3E,
+  0x5C, 0x9C, 0x0A, 0xDC, 0x0A, 0x38, 0x81, 0x0A, 0x18, 0x83, 0x0A, 0xDC, 0x03, 0x09, 0x95, 0x3A,
+  0x34, 0xD6, 0xDB, 0xAC, 0xF0, 0x82, 0x52, 0x00, 0x9A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x85, 0x5A,
+  0x00, 0x82, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x40, 0x82, 0x52, 0x00, 0x1E,
+  0x6A, 0xC4, 0xCE, 0x16, 0x94, 0xB8, 0x09, 0x11, 0x0A, 0x59, 0x5C, 0x9D, 0xEF, 0x7E, 0x4A, 0xB4,
+  0x00, 0xB0, 0x7C, 0x58, 0xAD, 0x7A, 0x09, 0x74, 0x33, 0x5B, 0xCE, 0xBC, 0x3A, 0x13, 0x00, 0x8F,
+  0x9D, 0x19, 0x01, 0x33, 0x0A, 0xDC, 0x0A, 0xFC, 0x9D, 0xDE, 0x42, 0x74, 0x21, 0x72, 0xC6, 0x1C,
+  0x33, 0x5B, 0x12, 0xDC, 0x64, 0xBD, 0x9D, 0x39, 0x11, 0x32, 0x01, 0x74, 0x01, 0x54, 0x81, 0x00,
+  0x90, 0x01, 0x8C, 0xD9, 0x0A, 0xDB, 0x81, 0x0A, 0xFC, 0x00, 0xA5, 0xBB, 0x82, 0x00, 0x90, 0x04,
+  0x12, 0x59, 0x00, 0x90, 0x7C, 0x57, 0xB5, 0xFB, 0x09, 0x95, 0x81, 0x09, 0xB5, 0x81, 0x09, 0x95,
+  0x15, 0x0A, 0xFC, 0x0A, 0xDC, 0x0A, 0x17, 0x29, 0xD3, 0xE7, 0x3D, 0x29, 0xB2, 0x73, 0xD6, 0xB6,
+  0x7E, 0x0A, 0xDC, 0x09, 0xD6, 0x84, 0x78, 0x8C, 0xB9, 0x8C, 0xB8, 0x12, 0xFB, 0x0A, 0xDC, 0x0A,
+  0xDB, 0x09, 0x75, 0x3A, 0x34, 0xD6, 0xBC, 0x9C, 0x6D, 0x51, 0xE0, 0x59, 0xE0, 0x81, 0x52, 0x00,
+  0x96, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x8E, 0x5A, 0x00, 0x1E,
+  0x52, 0x00, 0x5A, 0x42, 0xEF, 0x7C, 0xB5, 0xDB, 0x00, 0xB1, 0x0A, 0x59, 0x4B, 0xFC, 0xE7, 0x5E,
+  0x3A, 0x74, 0x32, 0x13, 0xF7, 0x9E, 0x29, 0xB2, 0x12, 0x9A, 0x75, 0x1D, 0x5B, 0x35, 0x00, 0x90,
+  0xEF, 0x5E, 0x63, 0x96, 0x12, 0xFB, 0x0A, 0xFC, 0x9D, 0xDD, 0xCE, 0x7C, 0x00, 0xB0, 0x94, 0xB7,
+  0x4C, 0x3D, 0x0A, 0xDC, 0x13, 0x1C, 0xDF, 0x3E, 0x29, 0xB2, 0x01, 0x75, 0x09, 0x54, 0x81, 0x00,
+  0x90, 0x01, 0x8C, 0xD9, 0x12, 0xDB, 0x81, 0x0A, 0xFC, 0x00, 0xA5, 0xBB, 0x82, 0x00, 0x90, 0x04,
+  0x0A, 0x59, 0x00, 0xAF, 0xDE, 0xDD, 0xF7, 0xBE, 0xDE, 0xFD, 0x83, 0xDF, 0x1D, 0x12, 0x12, 0xDB,
+  0x0A, 0xDC, 0x09, 0x75, 0xB5, 0xFB, 0xD6, 0xBD, 0x00, 0x91, 0xBE, 0x3B, 0x23, 0x3C, 0x0A, 0x17,
+  0xBE, 0x3B, 0xBE, 0x1B, 0x21, 0x51, 0xB6, 0x1B, 0x1B, 0x3C, 0x0A, 0xDC, 0x01, 0xB5, 0x11, 0x31,
+  0xE7, 0x1D, 0x9C, 0x4D, 0x82, 0x52, 0x00, 0x97, 0x5A, 0x00, 0x02, 0x5A, 0x80, 0x5A, 0x40, 0x52,
+  0x00, 0x81, 0x5A, 0x00, 0x02, 0x5A, 0x20, 0x5A, 0x00, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x01, 0x51,
+  0xE0, 0x62, 0xA0, 0x81, 0x5A, 0x20, 0x81, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x81,
+  0x52, 0x00, 0x23, 0x72, 0xE5, 0xDE, 0xD9, 0x6B, 0xD6, 0x09, 0x32, 0x12, 0xBB, 0x85, 0x5C, 0xDE,
+  0xFD, 0x32, 0x12, 0x7C, 0x57, 0x32, 0x13, 0x0A, 0x9A, 0x54, 0x7C, 0xD6, 0xDD, 0x11, 0x12, 0x73,
+  0xD6, 0x84, 0x78, 0x01, 0x13, 0x0A, 0xDB, 0x23, 0x3C, 0xAE, 0x1C, 0x19, 0x72, 0x94, 0xB8, 0x4C,
+  0x3D, 0x0A, 0xDC, 0x12, 0xDC, 0xD7, 0x3E, 0x21, 0xB3, 0x52, 0xF5, 0xC6, 0x7C, 0xBE, 0x3C, 0xB6,
+  0x3C, 0xCE, 0xDD, 0x0A, 0xFB, 0x0A, 0xFC, 0x0A, 0xDC, 0xA6, 0x1D, 0x81, 0xBE, 0x3C, 0x03, 0xB5,
+  0xFB, 0xA5, 0x9B, 0x00, 0x90, 0x3A, 0x34, 0x83, 0x42, 0x94, 0x14, 0x94, 0xB8, 0x7D, 0x3D, 0x0A,
+  0xDC, 0x0A, 0x38, 0x11, 0x52, 0xAD, 0xBA, 0x21, 0x52, 0x84, 0x78, 0xD7, 0x1E, 0x0A, 0xFB, 0x09,
+  0xF7, 0xD6, 0xFD, 0x4A, 0xD4, 0x6B, 0x96, 0xCE, 0xFD, 0x1B, 0x3C, 0x01, 0xD6, 0x19, 0x52, 0xD6,
+  0xDC, 0xB5, 0x72, 0x5A, 0x41, 0x82, 0x52, 0x00, 0x97, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x81, 0x5A,
+  0x00, 0x00, 0x6B, 0x00, 0x81, 0x52, 0x00, 0x87, 0x5A, 0x00, 0x01, 0x62, 0x80, 0x6A, 0xC0, 0x81,
+  0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x60, 0x81, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x16, 0x52, 0x00,
+  0x6A, 0xE4, 0xE7, 0x1B, 0x73, 0xD7, 0x00, 0xD1, 0x0A, 0x9A, 0x85, 0x5D, 0xB6, 0x7E, 0xB6, 0x5E,
+  0x2B, 0x7C, 0x0A, 0xFC, 0x0A, 0xDC, 0xA5, 0xDC, 0x53, 0x35, 0x42, 0x74, 0xD6, 0xDD, 0x08, 0xD0,
+  0x0A, 0x59, 0x0A, 0xDC, 0x85, 0x7D, 0xB6, 0x7D, 0xB6, 0x5E, 0x3B, 0xDC, 0x81, 0x0A, 0xDC, 0x04,
+  0xD7, 0x3E, 0x5B, 0x15, 0x5B, 0x35, 0x53, 0x36, 0x0A, 0xBB, 0x82, 0x0A, 0xDC, 0x81, 0x0A, 0xFC,
+  0x82, 0x0A, 0xDC, 0x04, 0x01, 0x12, 0xBE, 0x1B, 0x21, 0x72, 0xDF, 0x3D, 0xBE, 0x9E, 0x83, 0xB6,
+  0x7E, 0x0A, 0x4C, 0x3C, 0x0A, 0xDC, 0x09, 0xB6, 0x9D, 0x19, 0xA5, 0x59, 0x08, 0xF1, 0xB5, 0xFA,
+  0x3B, 0xFC, 0x0A, 0xDC, 0x12, 0xFB, 0x9D, 0xDD, 0x81, 0xB6, 0x7E, 0x06, 0x33, 0x9C, 0x0A, 0x39,
+  0x21, 0x92, 0xB5, 0xFA, 0xBD, 0xB3, 0x5A, 0x00, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x01, 0x52, 0x00,
+  0x52, 0x20, 0x81, 0x52, 0x00, 0x01, 0x5A, 0xA0, 0x52, 0x00, 0x93, 0x5A, 0x00, 0x00, 0x59, 0xE0,
+  0x81, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x06, 0x52, 0x00, 0x5A, 0x60, 0x8B, 0xEA,
+  0xDE, 0xDA, 0x5B, 0x35, 0x09, 0x54, 0x0A, 0x9A, 0x82, 0x12, 0xDC, 0x09, 0x0A, 0xFC, 0x0A, 0xDC,
+  0x64, 0xBC, 0xEF, 0x9E, 0x08, 0xB0, 0x84, 0x78, 0x6B, 0x95, 0x09, 0x53, 0x0A, 0xDC, 0x0A, 0xFC,
+  0x82, 0x0A, 0xDC, 0x06, 0x0A, 0xFC, 0x12, 0xFC, 0x7D, 0x3D, 0xBE, 0x3B, 0x5B, 0x35, 0x9D, 0x19,
+  0x12, 0x17, 0x82, 0x0A, 0xDC, 0x00, 0x0A, 0xFC, 0x82, 0x0A, 0xDC, 0x06, 0x0A, 0x59, 0x53, 0x56,
+  0xBE, 0x1B, 0x6B, 0xD7, 0x9D, 0xFD, 0x1B, 0x3C, 0x0A, 0xDC, 0x83, 0x0A, 0xFC, 0x09, 0x0A, 0xBB,
+  0x21, 0xD3, 0xC6, 0x5B, 0x31, 0xF3, 0x21, 0xB2, 0xBE, 0x7E, 0x2B, 0x7C, 0x0A, 0xDC, 0x0A, 0xFC,
+  0x0A, 0xDC, 0x81, 0x0A, 0xFC, 0x04, 0x0A, 0x18, 0x08, 0xD0, 0xAD, 0x9A, 0xCE, 0x36, 0x51, 0xE0,
+  0x81, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x60, 0x82, 0x52, 0x00, 0x01, 0x62,
+  0xA0, 0x59, 0xE0, 0x95, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x8B, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x04,
+  0x73, 0x26, 0xF7, 0xBF, 0x63, 0x75, 0x00, 0xF2, 0x01, 0x12, 0x83, 0x01, 0x13, 0x05, 0x09, 0x53,
+  0xE7, 0x3D, 0x84, 0x57, 0x41, 0xEB, 0xE7, 0x3C, 0x09, 0x31, 0x87, 0x01, 0x13, 0x04, 0xA5, 0x59,
+  0x29, 0x6D, 0xBD, 0xD6, 0x11, 0x32, 0x01, 0x12, 0x85, 0x01, 0x13, 0x04, 0x00, 0xB2, 0xBE, 0x3B,
+  0x52, 0x69, 0x6B, 0xD7, 0x21, 0xD3, 0x85, 0x01, 0x13, 0x07, 0x01, 0x12, 0x52, 0xF5, 0xA4, 0xEF,
+  0x31, 0xF0, 0xCE, 0x9C, 0x63, 0x97, 0x01, 0x13, 0x01, 0x12, 0x83, 0x01, 0x13, 0x03, 0x08, 0xF1,
+  0xBD, 0xFB, 0xBD, 0x93, 0x62, 0x62, 0x82, 0x52, 0x00, 0x92, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x01,
+  0x5A, 0x00, 0x5A, 0x40, 0xA6, 0x5A, 0x00, 0x04, 0x52, 0x00, 0x5A, 0x00, 0x83, 0xA9, 0xDE, 0xDB,
+  0xC6, 0x3A, 0x84, 0xC6, 0x3B, 0x06, 0xC6, 0x3A, 0xF7, 0x7D, 0xB5, 0x73, 0x49, 0xC2, 0xEF, 0x5C,
+  0xC6, 0x3B, 0xC6, 0x3A, 0x86, 0xC6, 0x3B, 0x04, 0xCE, 0x37, 0x41, 0xC2, 0xB5, 0x92, 0xC6, 0x5A,
+  0xC6, 0x3B, 0x82, 0xC6, 0x3A, 0x82, 0xC6, 0x3B, 0x04, 0xC6, 0x3A, 0xE7, 0x5C, 0x49, 0xE1, 0x94,
+  0x4F, 0xC6, 0x5B, 0x85, 0xC6, 0x3B, 0x05, 0xC6, 0x3A, 0xCE, 0x9B, 0x8C, 0x0B, 0x62, 0x86, 0xEF,
+  0x9D, 0xD6, 0xBB, 0x81, 0xC6, 0x3A, 0x83, 0xC6, 0x3B, 0x04, 0xC6, 0x3A, 0xEF, 0x3C, 0x62, 0x83,
+  0x5A, 0x00, 0x52, 0x00, 0x98, 0x5A, 0x00, 0x00, 0x52, 0x00, 0xA7, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x81, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x04, 0x5A, 0x00, 0x51,
+  0xE0, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x86, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x87, 0x5A, 0x00,
+  0x02, 0x52, 0x00, 0x51, 0xE0, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x85, 0x52, 0x00, 0x83, 0x5A, 0x00,
+  0x83, 0x52, 0x00, 0xFA, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x5A, 0x60, 0x8C, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0xEE, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x62, 0x80, 0x8C, 0x5A, 0x00, 0x01, 0x5A, 0x20, 0x5A,
+  0x40, 0xA3, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x80, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x00, 0x51,
+  0xE0, 0x81, 0x52, 0x00, 0xA7, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x62, 0xA0, 0x5A, 0x20, 0x98, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x51, 0xE0, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x52, 0x20,
+  0xA3, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x51, 0xE0, 0x87, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01,
+  0x62, 0xA0, 0x52, 0x00, 0xA7, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x00, 0x52, 0x00, 0x8A, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x52, 0x20, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x01, 0x5A, 0x80, 0x52, 0x00,
+  0x84, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x9F, 0x5A, 0x00, 0x01, 0x51, 0xE0, 0x52, 0x00, 0x85, 0x5A,
+  0x00, 0x83, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x51, 0xE0, 0x52, 0x00, 0xAE, 0x5A,
+  0x00, 0x02, 0x52, 0x00, 0x62, 0x80, 0x52, 0x00, 0x9E, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8F, 0x5A,
+  0x00, 0x03, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x40, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x03, 0x52, 0x00,
+  0x52, 0x40, 0x52, 0x20, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x60, 0x52,
+  0x00, 0xAE, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x97, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x84, 0x5A, 0x00,
+  0x02, 0x5A, 0x20, 0x5A, 0x40, 0x52, 0x00, 0x8F, 0x5A, 0x00, 0x00, 0x52, 0x00, 0x81, 0x52, 0x20,
+  0x00, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x8A, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01,
+  0x5A, 0x40, 0x52, 0x00, 0xC9, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x60, 0x5A, 0x20, 0x83, 0x5A,
+  0x00, 0x81, 0x5A, 0x20, 0x00, 0x52, 0x00, 0xF5, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x97, 0x5A, 0x00,
+  0x83, 0x52, 0x00, 0xB3, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x81,
+  0x5A, 0x00, 0x83, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x81, 0x52,
+  0x00, 0x88, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x01, 0x5A, 0x20,
+  0x52, 0x00, 0x95, 0x5A, 0x00, 0x83, 0x52, 0x00, 0xB3, 0x5A, 0x00, 0x04, 0x52, 0x00, 0x52, 0x20,
+  0x5A, 0x40, 0x51, 0xE0, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x00, 0x51, 0xE0, 0x81, 0x52, 0x20, 0x00,
+  0x52, 0x00, 0x81, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x20, 0x83, 0x5A, 0x00, 0x82,
+  0x52, 0x00, 0x88, 0x5A, 0x00, 0x03, 0x51, 0xE0, 0x52, 0x00, 0x5A, 0x20, 0x52, 0x00, 0x8B, 0x5A,
+  0x00, 0x01, 0x5A, 0x60, 0x52, 0x00, 0x95, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x80, 0x52,
+  0x00, 0xB2, 0x5A, 0x00, 0x84, 0x52, 0x00, 0x82, 0x5A, 0x00, 0x01, 0x52, 0x00, 0x52, 0x20, 0x81,
+  0x52, 0x00, 0x82, 0x5A, 0x00, 0x01, 0x51, 0xE0, 0x52, 0x00, 0x83, 0x5A, 0x00, 0x02, 0x5A, 0x20,
+  0x5A, 0x40, 0x52, 0x00, 0x88, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x20, 0x52, 0x00,
+  0x8B, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x94, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x20, 0x52,
+  0x00, 0x82, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x6A, 0xE0, 0x51, 0xE0, 0x9A, 0x5A, 0x00, 0x02, 0x52,
+  0x00, 0x51, 0xE0, 0x52, 0x00, 0x9B, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x51, 0xE0, 0x85, 0x5A,
+  0x00, 0x00, 0x5A, 0x20, 0xCD, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x85, 0x5A, 0x00, 0x02, 0x52, 0x00,
+  0x52, 0x40, 0x5A, 0x60, 0x9B, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x62, 0xC0, 0x52, 0x00, 0xCB, 0x5A,
+  0x00, 0x83, 0x52, 0x00, 0x84, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x40, 0x52, 0x20, 0x85, 0x5A,
+  0x00, 0x82, 0x52, 0x00, 0x89, 0x5A, 0x00, 0x00, 0x59, 0xE0, 0x85, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x88, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xCB, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x60, 0x52,
+  0x00, 0x84, 0x5A, 0x00, 0x82, 0x52, 0x00, 0x91, 0x5A, 0x00, 0x03, 0x59, 0xE0, 0x52, 0x00, 0x62,
+  0xA0, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x5A, 0x00, 0x5A, 0x60, 0x52, 0x00, 0xD7,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x40, 0x52, 0x00, 0x99, 0x5A, 0x00, 0x81, 0x52, 0x00,
+  0x01, 0x62, 0x80, 0x52, 0x00, 0x81, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x01, 0x5A, 0x60, 0x52, 0x00,
+  0x9B, 0x5A, 0x00, 0x00, 0x52, 0x00, 0xFC, 0x5A, 0x00, 0x82, 0x52, 0x00, 0xFC, 0x5A, 0x00, 0x02,
+  0x5A, 0x20, 0x5A, 0x80, 0x52, 0x00, 0xC5, 0x5A, 0x00, 0x02, 0x52, 0x00, 0x5A, 0x40, 0x51, 0xE0,
+  0xBD, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x52, 0x20, 0x5A, 0x00, 0x52, 0x00, 0xBA, 0x5A, 0x00, 0x02,
+  0x52, 0x00, 0x5A, 0x40, 0x51, 0xE0, 0xBD, 0x5A, 0x00, 0x03, 0x52, 0x00, 0x5A, 0x40, 0x5A, 0x00,
+  0x52, 0x00, 0xC3, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x51, 0xE0, 0x97, 0x5A, 0x00, 0x00, 0x59,
+  0xE0, 0xB2, 0x5A, 0x00, 0x01, 0x5A, 0x60, 0x5A, 0x40, 0xAE, 0x5A, 0x00, 0x83, 0x52, 0x00, 0x95,
+  0x5A, 0x00, 0x00, 0x73, 0x60, 0xB2, 0x5A, 0x00, 0x81, 0x52, 0x00, 0x00, 0x5A, 0x40, 0xAE, 0x5A,
+  0x00, 0x01, 0x52, 0x00, 0x5A, 0x40, 0x81, 0x52, 0x00, 0x96, 0x5A, 0x00, 0x00, 0x52, 0x00, 0xB1,
+  0x5A, 0x00, 0x81, 0x52, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A,
+  0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00,
+  0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF,
+  0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A,
+  0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00,
+  0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0xFF, 0x5A, 0x00, 0x00, 0x5A, 0x00,
+};
+
+//21x150, 924 bytes instead of 6300
+const uint8_t Win_P1_RLE[] = {
+  0xAB, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x87, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x84, 0xFF,
+  0xFB, 0x83, 0x01, 0x3B, 0x87, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x84, 0xFF, 0xFB, 0x83, 0x01, 0x3B,
+  0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83,
+  0x00, 0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF,
+  0xFB, 0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B,
+  0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x90, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x9E, 0xFF, 0xFB, 0x84,
+  0x01, 0x3B, 0x8F, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAB, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0xA7, 0x00, 0x00, 0xAB,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8F, 0x03, 0x7B, 0x00, 0x01, 0x3B,
+  0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF,
+  0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B,
+  0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A,
+  0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0xAB, 0xFF, 0xFB, 0xFF,
+  0x00, 0x00, 0xA7, 0x00, 0x00, 0xAB, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x88, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x88,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x88, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x89, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x89, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01,
+  0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB,
+  0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0xAB, 0xFF, 0xFB,
+};
+
+//21x150, 924 bytes instead of 6300
+const uint8_t Win_P1_180_RLE[] = {
+  0xAB, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B,
+  0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84,
+  0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B,
+  0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x84, 0x01, 0x3B, 0x89, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B,
+  0x89, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF,
+  0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x88, 0xFF,
+  0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x88, 0xFF, 0xFB, 0x83, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x88, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0xAB, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0xA7, 0x00, 0x00, 0xAB, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x8A, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0xAD, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x90, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x00, 0x01, 0x3B, 0x8F,
+  0x03, 0x7B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAD, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90,
+  0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B,
+  0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x90, 0xFF, 0xFB, 0x83,
+  0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF,
+  0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAB, 0xFF, 0xFB, 0xFF, 0x00, 0x00,
+  0xA7, 0x00, 0x00, 0xAB, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83,
+  0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01,
+  0x3B, 0x83, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x8F, 0xFF, 0xFB, 0x84, 0x01, 0x3B, 0x9E, 0xFF, 0xFB,
+  0x83, 0x00, 0x00, 0x90, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B, 0x81,
+  0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x00,
+  0x00, 0x81, 0xFF, 0xFB, 0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB,
+  0x8C, 0x01, 0x3B, 0x81, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x81, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x84,
+  0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x87, 0xFF, 0xFB, 0x83, 0x01, 0x3B, 0x84, 0xFF, 0xFB, 0x83, 0x01,
+  0x3B, 0x87, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB,
+  0x90, 0x01, 0x3B, 0x83, 0xFF, 0xFB, 0x90, 0x01, 0x3B, 0xAB, 0xFF, 0xFB,
+};
+
+//20x150, 1125 bytes instead of 6000
+const uint8_t Win_P2_RLE[] = {
+  0xA9, 0xFF, 0xFB, 0x8F, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83,
+  0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA,
+  0x40, 0x86, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x84, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40,
+  0x86, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x84, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x86,
+  0xFF, 0xFB, 0x8B, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x86, 0xFF, 0xFB, 0x8B, 0xF9, 0x20, 0x00, 0xFA,
+  0x40, 0x86, 0xFF, 0xFB, 0x8B, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x86, 0xFF, 0xFB, 0x8B, 0xF9, 0x20,
+  0x00, 0xFA, 0x40, 0xAB, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20,
+  0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x88, 0xF9, 0x20,
+  0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x89, 0xF9, 0x20, 0xA9, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x8B, 0x00, 0x00, 0xA9, 0xFF, 0xFB, 0x8E,
+  0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF,
+  0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20,
+  0x8F, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83,
+  0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB,
+  0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F,
+  0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9,
+  0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB,
+  0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x8F, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x8F,
+  0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA,
+  0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20,
+  0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x81, 0xFA, 0x40, 0x86, 0xF9, 0x20, 0x83,
+  0xFA, 0x40, 0xAB, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x88, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x88, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x88, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40,
+  0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x82,
+  0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x84, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20,
+  0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0xA9, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xA9, 0xFF, 0xFB,
+  0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x87, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x87, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x87, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00,
+  0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x84, 0xFA,
+  0x40, 0x84, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x89, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x89, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9,
+  0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB,
+  0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F,
+  0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20,
+  0x8F, 0xFF, 0xFB, 0x82, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00,
+  0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9,
+  0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x8F, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20,
+  0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8E, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83,
+  0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x00, 0xF9, 0x20, 0x82, 0xFA, 0x40, 0x81, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0xA9, 0xFF, 0xFB,
+};
+
+//20x150, 1125 bytes instead of 6000
+const uint8_t Win_P2_180_RLE[] = {
+  0xA9, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x82, 0xFA, 0x40, 0x00, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F,
+  0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20,
+  0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82,
+  0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20,
+  0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00,
+  0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20,
+  0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x89, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x89, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x83, 0xF9, 0x20, 0x00, 0xFA,
+  0x40, 0x84, 0xF9, 0x20, 0x84, 0xFA, 0x40, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20,
+  0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xAB,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x87, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x87, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x87, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0xA9, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x9F, 0x00, 0x00, 0xA9, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40,
+  0x82, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82,
+  0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x84, 0xF9, 0x20, 0x00, 0xFA, 0x40, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x88, 0xF9, 0x20,
+  0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x88, 0xF9, 0x20, 0x81,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x88, 0xF9, 0x20, 0x81, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20,
+  0xAB, 0xFF, 0xFB, 0x83, 0xFA, 0x40, 0x86, 0xF9, 0x20, 0x81, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9,
+  0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40,
+  0x82, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x00,
+  0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20,
+  0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00,
+  0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0xAB, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40,
+  0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F,
+  0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x8F, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x8F,
+  0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA,
+  0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB,
+  0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0xA9, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x8B, 0x00, 0x00, 0xA9,
+  0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x83, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83,
+  0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x88, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x83, 0xFF,
+  0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x83, 0xF9, 0x20,
+  0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9,
+  0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB,
+  0x89, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x83, 0xF9, 0x20, 0x81, 0xFF, 0xFB, 0x89, 0xF9, 0x20, 0xAB,
+  0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8B, 0xF9, 0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8B, 0xF9,
+  0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8B, 0xF9, 0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40,
+  0x8B, 0xF9, 0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x84, 0xFF, 0xFB, 0x83,
+  0xF9, 0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x82, 0xF9, 0x20, 0x84, 0xFF, 0xFB, 0x83, 0xF9,
+  0x20, 0x86, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40,
+  0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x00, 0xFA, 0x40, 0x8E, 0xF9, 0x20, 0x83, 0xFF, 0xFB, 0x8F,
+  0xFA, 0x40, 0xA9, 0xFF, 0xFB,
+};
+
+#endif
@@ -0,0 +1,490 @@
+// File: Sprites.h
+// Name: Brian Cheung and Sam Wang
+// Date: 5/4/18
+// Desc: Sprites of Images.h compiled into opaque runs, generated by res/images/SpriteCompile.py
+// Usage: Included by AstroParty.c after Images.h, edit Images.h and run the script instead of editing this
+
+#ifndef SPRITES_H
+#define SPRITES_H
+#include "GameObjects.h"
+
+const uint8_t Kill_1_Runs[] = {
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+};
+
+const Sprite Kill_1_S = {Kill_1, Kill_1_Runs, Kill_1, 75, 30};
+
+const uint8_t Kill_3_Runs[] = {
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+};
+
+const Sprite Kill_3_S = {Kill_3, Kill_3_Runs, Kill_3, 75, 30};
+
+const uint8_t Kill_5_Runs[] = {
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+  0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01,
+  0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00,
+  0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B, 0x01, 0x00, 0x4B,
+};
+
+const Sprite Kill_5_S = {Kill_5, Kill_5_Runs, Kill_5, 75, 30};
+
+const uint8_t Level_Corner_Runs[] = {
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+};
+
+const Sprite Level_Corner_S = {Level_Corner, Level_Corner_Runs, Level_Corner, 87, 30};
+
+const uint8_t Level_Hall_Runs[] = {
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+};
+
+const Sprite Level_Hall_S = {Level_Hall, Level_Hall_Runs, Level_Hall, 87, 30};
+
+const uint8_t Level_Cache_Runs[] = {
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+  0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01,
+  0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00,
+  0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57, 0x01, 0x00, 0x57,
+};
+
+const Sprite Level_Cache_S = {Level_Cache, Level_Cache_Runs, Level_Cache, 87, 30};
+
+const uint8_t Start_Runs[] = {
+  0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01,
+  0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00,
+  0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32,
+  0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32, 0x01, 0x00, 0x32,
+};
+
+const Sprite Start_S = {Start, Start_Runs, Start, 50, 20};
+
+const uint8_t Bullet_Explosion_Runs[] = {
+  0x02, 0x04, 0x01, 0x04, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02,
+  0x01, 0x03, 0x01, 0x02, 0x00, 0x01, 0x09, 0x00, 0x02, 0x00, 0x02, 0x05, 0x02, 0x01, 0x09, 0x00,
+  0x03, 0x02, 0x01, 0x03, 0x01, 0x02, 0x00, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00,
+  0x02, 0x04, 0x01, 0x04, 0x00,
+};
+const uint8_t Bullet_Explosion_Pixels[] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+const Sprite Bullet_Explosion_S = {Bullet_Explosion, Bullet_Explosion_Runs, Bullet_Explosion_Pixels, 9, 9};
+
+const uint8_t P1_Ship0_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02, 0x00, 0x08,
+  0x01, 0x00, 0x01, 0x01, 0x08, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02,
+  0x01, 0x03, 0x05, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship0_Pixels[] = {
+  0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship1_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x02, 0x02, 0x05, 0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x01, 0x05,
+  0x03, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01,
+  0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship1_Pixels[] = {
+  0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship2_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x02, 0x03, 0x04, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x00, 0x06,
+  0x03, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x03, 0x05, 0x01, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00,
+};
+const uint8_t P1_Ship2_Pixels[] = {
+  0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0xFF,
+};
+
+const uint8_t P1_Ship3_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x01, 0x07,
+  0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x03, 0x05, 0x01,
+  0x00, 0x02, 0x04, 0x04, 0x01, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+};
+const uint8_t P1_Ship3_Pixels[] = {
+  0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF,
+};
+
+const uint8_t P1_Ship4_Runs[] = {
+  0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00,
+  0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x04, 0x01, 0x04, 0x00,
+};
+const uint8_t P1_Ship4_Pixels[] = {
+  0xF0, 0xF0, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0x07, 0xFF,
+};
+
+const uint8_t P1_Ship5_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x07,
+  0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x05, 0x03,
+  0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x02, 0x02, 0x05, 0x00,
+};
+const uint8_t P1_Ship5_Pixels[] = {
+  0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0x07,
+};
+
+const uint8_t P1_Ship6_Runs[] = {
+  0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02,
+  0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00,
+  0x05, 0x04, 0x00, 0x02, 0x00, 0x03, 0x06, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship6_Pixels[] = {
+  0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0xFF, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship7_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x04, 0x02, 0x03, 0x00, 0x02, 0x03, 0x04, 0x02, 0x00, 0x02, 0x02, 0x05,
+  0x02, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01,
+  0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship7_Pixels[] = {
+  0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0,
+  0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship8_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x03, 0x06, 0x01, 0x01, 0x08, 0x02, 0x00,
+  0x08, 0x01, 0x00, 0x01, 0x01, 0x08, 0x01, 0x03, 0x06, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x09,
+  0x00,
+};
+const uint8_t P1_Ship8_Pixels[] = {
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0,
+  0xF0, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0,
+  0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship9_Runs[] = {
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00,
+  0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02,
+  0x03, 0x04, 0x02, 0x00, 0x02, 0x04, 0x02, 0x03, 0x00,
+};
+const uint8_t P1_Ship9_Pixels[] = {
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07,
+};
+
+const uint8_t P1_Ship10_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x00, 0x03, 0x06, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x02, 0x00, 0x07,
+  0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01,
+  0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00,
+};
+const uint8_t P1_Ship10_Pixels[] = {
+  0xFF, 0x07, 0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07,
+  0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0,
+};
+
+const uint8_t P1_Ship11_Runs[] = {
+  0x02, 0x02, 0x02, 0x05, 0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x01, 0x05, 0x03, 0x00, 0x02,
+  0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01,
+  0x06, 0x02, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship11_Pixels[] = {
+  0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07,
+  0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0,
+};
+
+const uint8_t P1_Ship12_Runs[] = {
+  0x02, 0x04, 0x01, 0x04, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02,
+  0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01,
+  0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00,
+};
+const uint8_t P1_Ship12_Pixels[] = {
+  0xFF, 0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0xF0, 0xF0,
+};
+
+const uint8_t P1_Ship13_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x00, 0x02, 0x03, 0x05,
+  0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00,
+};
+const uint8_t P1_Ship13_Pixels[] = {
+  0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0xF0,
+  0xF0, 0x07, 0xF0, 0xF0, 0x07, 0xF0, 0xF0, 0x07,
+};
+
+const uint8_t P1_Ship14_Runs[] = {
+  0x02, 0x05, 0x03, 0x01, 0x00, 0x02, 0x03, 0x05, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02,
+  0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02, 0x02,
+  0x04, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship14_Pixels[] = {
+  0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+  0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+};
+
+const uint8_t P1_Ship15_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x02,
+  0x06, 0x01, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x03, 0x02,
+  0x04, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P1_Ship15_Pixels[] = {
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xF0,
+  0xF0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xF0, 0xF0, 0x07,
+  0x07, 0x07, 0xF0, 0xF0, 0x07, 0x07, 0x07, 0x07,
+};
+
+//P1_x rotation frames already in the P1 color
+const Sprite P1_Ships[16] = {
+  {P1_0, P1_Ship0_Runs, P1_Ship0_Pixels, 9, 9},
+  {P1_1, P1_Ship1_Runs, P1_Ship1_Pixels, 9, 9},
+  {P1_2, P1_Ship2_Runs, P1_Ship2_Pixels, 9, 9},
+  {P1_3, P1_Ship3_Runs, P1_Ship3_Pixels, 9, 9},
+  {P1_4, P1_Ship4_Runs, P1_Ship4_Pixels, 9, 9},
+  {P1_5, P1_Ship5_Runs, P1_Ship5_Pixels, 9, 9},
+  {P1_6, P1_Ship6_Runs, P1_Ship6_Pixels, 9, 9},
+  {P1_7, P1_Ship7_Runs, P1_Ship7_Pixels, 9, 9},
+  {P1_8, P1_Ship8_Runs, P1_Ship8_Pixels, 9, 9},
+  {P1_9, P1_Ship9_Runs, P1_Ship9_Pixels, 9, 9},
+  {P1_10, P1_Ship10_Runs, P1_Ship10_Pixels, 9, 9},
+  {P1_11, P1_Ship11_Runs, P1_Ship11_Pixels, 9, 9},
+  {P1_12, P1_Ship12_Runs, P1_Ship12_Pixels, 9, 9},
+  {P1_13, P1_Ship13_Runs, P1_Ship13_Pixels, 9, 9},
+  {P1_14, P1_Ship14_Runs, P1_Ship14_Pixels, 9, 9},
+  {P1_15, P1_Ship15_Runs, P1_Ship15_Pixels, 9, 9}
+};
+
+const uint8_t P2_Ship0_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02, 0x00, 0x08,
+  0x01, 0x00, 0x01, 0x01, 0x08, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02,
+  0x01, 0x03, 0x05, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship0_Pixels[] = {
+  0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xFF, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship1_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x02, 0x02, 0x05, 0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x01, 0x05,
+  0x03, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01,
+  0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship1_Pixels[] = {
+  0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship2_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x02, 0x03, 0x04, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x00, 0x06,
+  0x03, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x03, 0x05, 0x01, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00,
+};
+const uint8_t P2_Ship2_Pixels[] = {
+  0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF,
+};
+
+const uint8_t P2_Ship3_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x01, 0x07,
+  0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x03, 0x05, 0x01,
+  0x00, 0x02, 0x04, 0x04, 0x01, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00,
+};
+const uint8_t P2_Ship3_Pixels[] = {
+  0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF,
+};
+
+const uint8_t P2_Ship4_Runs[] = {
+  0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00,
+  0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x04, 0x01, 0x04, 0x00,
+};
+const uint8_t P2_Ship4_Pixels[] = {
+  0xF0, 0xF0, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xFF,
+};
+
+const uint8_t P2_Ship5_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x07,
+  0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x05, 0x03,
+  0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x02, 0x02, 0x05, 0x00,
+};
+const uint8_t P2_Ship5_Pixels[] = {
+  0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4,
+};
+
+const uint8_t P2_Ship6_Runs[] = {
+  0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02,
+  0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00,
+  0x05, 0x04, 0x00, 0x02, 0x00, 0x03, 0x06, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship6_Pixels[] = {
+  0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship7_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x04, 0x02, 0x03, 0x00, 0x02, 0x03, 0x04, 0x02, 0x00, 0x02, 0x02, 0x05,
+  0x02, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01,
+  0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship7_Pixels[] = {
+  0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0,
+  0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship8_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x03, 0x06, 0x01, 0x01, 0x08, 0x02, 0x00,
+  0x08, 0x01, 0x00, 0x01, 0x01, 0x08, 0x01, 0x03, 0x06, 0x02, 0x05, 0x03, 0x01, 0x00, 0x01, 0x09,
+  0x00,
+};
+const uint8_t P2_Ship8_Pixels[] = {
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0,
+  0xF0, 0xFF, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0,
+  0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship9_Runs[] = {
+  0x01, 0x09, 0x00, 0x01, 0x09, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00,
+  0x02, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x06, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02,
+  0x03, 0x04, 0x02, 0x00, 0x02, 0x04, 0x02, 0x03, 0x00,
+};
+const uint8_t P2_Ship9_Pixels[] = {
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4,
+};
+
+const uint8_t P2_Ship10_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x00, 0x03, 0x06, 0x00, 0x02, 0x00, 0x05, 0x04, 0x00, 0x02, 0x00, 0x07,
+  0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x02, 0x06, 0x01,
+  0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00,
+};
+const uint8_t P2_Ship10_Pixels[] = {
+  0xFF, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0,
+};
+
+const uint8_t P2_Ship11_Runs[] = {
+  0x02, 0x02, 0x02, 0x05, 0x00, 0x02, 0x01, 0x04, 0x04, 0x00, 0x02, 0x01, 0x05, 0x03, 0x00, 0x02,
+  0x01, 0x06, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01,
+  0x06, 0x02, 0x00, 0x02, 0x01, 0x03, 0x05, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship11_Pixels[] = {
+  0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4,
+  0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0,
+};
+
+const uint8_t P2_Ship12_Runs[] = {
+  0x02, 0x04, 0x01, 0x04, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02,
+  0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01,
+  0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x00,
+};
+const uint8_t P2_Ship12_Pixels[] = {
+  0xFF, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xF0, 0xF0,
+};
+
+const uint8_t P2_Ship13_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x02, 0x04, 0x04, 0x01, 0x00, 0x02, 0x03, 0x05,
+  0x01, 0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01,
+  0x00, 0x02, 0x02, 0x06, 0x01, 0x00, 0x02, 0x05, 0x03, 0x01, 0x00,
+};
+const uint8_t P2_Ship13_Pixels[] = {
+  0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0,
+  0xF0, 0xE4, 0xF0, 0xF0, 0xE4, 0xF0, 0xF0, 0xE4,
+};
+
+const uint8_t P2_Ship14_Runs[] = {
+  0x02, 0x05, 0x03, 0x01, 0x00, 0x02, 0x03, 0x05, 0x01, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x02,
+  0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x02, 0x02,
+  0x04, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship14_Pixels[] = {
+  0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+  0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+};
+
+const uint8_t P2_Ship15_Runs[] = {
+  0x01, 0x09, 0x00, 0x02, 0x01, 0x07, 0x01, 0x00, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x02,
+  0x06, 0x01, 0x00, 0x02, 0x02, 0x05, 0x02, 0x00, 0x02, 0x02, 0x04, 0x03, 0x00, 0x02, 0x03, 0x02,
+  0x04, 0x00, 0x01, 0x09, 0x00,
+};
+const uint8_t P2_Ship15_Pixels[] = {
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xF0,
+  0xF0, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xF0, 0xF0, 0xE4,
+  0xE4, 0xE4, 0xF0, 0xF0, 0xE4, 0xE4, 0xE4, 0xE4,
+};
+
+//P1_x rotation frames already in the P2 color
+const Sprite P2_Ships[16] = {
+  {P1_0, P2_Ship0_Runs, P2_Ship0_Pixels, 9, 9},
+  {P1_1, P2_Ship1_Runs, P2_Ship1_Pixels, 9, 9},
+  {P1_2, P2_Ship2_Runs, P2_Ship2_Pixels, 9, 9},
+  {P1_3, P2_Ship3_Runs, P2_Ship3_Pixels, 9, 9},
+  {P1_4, P2_Ship4_Runs, P2_Ship4_Pixels, 9, 9},
+  {P1_5, P2_Ship5_Runs, P2_Ship5_Pixels, 9, 9},
+  {P1_6, P2_Ship6_Runs, P2_Ship6_Pixels, 9, 9},
+  {P1_7, P2_Ship7_Runs, P2_Ship7_Pixels, 9, 9},
+  {P1_8, P2_Ship8_Runs, P2_Ship8_Pixels, 9, 9},
+  {P1_9, P2_Ship9_Runs, P2_Ship9_Pixels, 9, 9},
+  {P1_10, P2_Ship10_Runs, P2_Ship10_Pixels, 9, 9},
+  {P1_11, P2_Ship11_Runs, P2_Ship11_Pixels, 9, 9},
+  {P1_12, P2_Ship12_Runs, P2_Ship12_Pixels, 9, 9},
+  {P1_13, P2_Ship13_Runs, P2_Ship13_Pixels, 9, 9},
+  {P1_14, P2_Ship14_Runs, P2_Ship14_Pixels, 9, 9},
+  {P1_15, P2_Ship15_Runs, P2_Ship15_Pixels, 9, 9}
+};
+
+#endif
@@ -1,37 +1,37 @@
-// Timer0.h
-// Runs on LM4F120/TM4C123
-// Use Timer0 in 32-bit periodic mode to request interrupts at a periodic rate
-// Daniel Valvano
-// March 20, 2014
-
-/* This example accompanies the book
-   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
-   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2013
-  Program 7.5, example 7.6
-
- Copyright 2013 by Jonathan W. Valvano, valvano@mail.utexas.edu
-    You may use, edit, run or distribute this file
-    as long as the above copyright notice remains
- THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
- OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
- MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
- VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
- OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
- For more information about my classes, my research, and my books, see
- http://users.ece.utexas.edu/~valvano/
- */
-#ifndef __TIMER0INTS_H__ // do not include more than once
-#define __TIMER0INTS_H__
-#include <stdint.h>
-
-
-// ***************** Timer0_Init ****************
-// Activate Timer0 interrupts to run user task periodically
-// Inputs:  task is a pointer to a user function
-//          period in units (1/clockfreq)
-// Outputs: none
-void Timer0_Init(/*void(*task)(void),*/ uint32_t period);
-
-void Timer0A_SoundSet(const uint8_t *pt, uint32_t size);
-
-#endif // __TIMER2INTS_H__
+// Timer0.h
+// Runs on LM4F120/TM4C123
+// Use Timer0 in 32-bit periodic mode to request interrupts at a periodic rate
+// Daniel Valvano
+// March 20, 2014
+
+/* This example accompanies the book
+   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
+   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2013
+  Program 7.5, example 7.6
+
+ Copyright 2013 by Jonathan W. Valvano, valvano@mail.utexas.edu
+    You may use, edit, run or distribute this file
+    as long as the above copyright notice remains
+ THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+ */
+#ifndef __TIMER0INTS_H__ // do not include more than once
+#define __TIMER0INTS_H__
+#include <stdint.h>
+
+
+// ***************** Timer0_Init ****************
+// Activate Timer0 interrupts to run user task periodically
+// Inputs:  task is a pointer to a user function
+//          period in units (1/clockfreq)
+// Outputs: none
+void Timer0_Init(/*void(*task)(void),*/ uint32_t period);
+
+void Timer0A_SoundSet(const uint8_t *pt, uint32_t size);
+
+#endif // __TIMER2INTS_H__
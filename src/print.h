@@ -1,8 +1,8 @@
-#ifndef PRINT_H
-#define PRINT_H
-
-void LCD_OutDec(uint32_t data);
-
-void LCD_OutFix(uint32_t data);
-
-#endif
+#ifndef PRINT_H
+#define PRINT_H
+
+void LCD_OutDec(uint32_t data);
+
+void LCD_OutFix(uint32_t data);
+
+#endif
@@ -1,9 +1,9 @@
-#ifndef RANDOM_H
-#define RANDOM_H
-
-void Random_Init(uint32_t seed);
-
-uint32_t Random(void);
-uint32_t Random32(void);
-
-#endif
+#ifndef RANDOM_H
+#define RANDOM_H
+
+void Random_Init(uint32_t seed);
+
+uint32_t Random(void);
+uint32_t Random32(void);
+
+#endif
@@ -0,0 +1,104 @@
+# File: MirrorDecode.py
+# Name: Brian Cheung and Sam Wang
+# Date: 5/4/18
+# Desc: Rebuilds the frames that src/Mirror.c streams over UART0 and writes them out as images
+# Usage: python MirrorDecode.py <capture file or serial port> <output folder>
+#        a serial port needs pyserial and is opened at 921600 baud, stop with ctrl-c
+#        one PPM image is written per frame, ffmpeg -framerate 30 -i <folder>/%05d.ppm mirror.mp4 makes a video
+
+import os
+import sys
+
+WIDTH, HEIGHT = 128, 160	# screen size in ST7735.h
+BLOCK = 8					# TILE_SIZE in GameObjects.h
+BLOCK_COLS = WIDTH//BLOCK
+BLOCKS_N = BLOCK_COLS*(HEIGHT//BLOCK)
+RUN = 0x80
+BAUD = 921600
+
+
+# same as ST7735_Convert(), then the 5-6-5 BGR color spread out to 8 bits a channel
+def rgb(color):
+	color = (color << 1) & 0xFF
+	bgr = ((color & 0xC0) << 8) | ((color & 0xC0) << 6) | ((color & 0x80) << 4)
+	bgr |= ((color & 0x38) << 5) | ((color & 0x38) << 2)
+	bgr |= ((color & 0x07) << 2) | ((color & 0x06) >> 1)
+	r, g, b = bgr & 0x1F, (bgr >> 5) & 0x3F, bgr >> 11
+	return bytes((r*255//31, g*255//63, b*255//31))
+
+
+COLORS = [rgb(c) for c in range(256)]
+
+
+def source(name):
+	if os.path.isfile(name):
+		for b in open(name, "rb").read():
+			yield b
+		return
+	import serial
+	port = serial.Serial(name, BAUD)
+	while True:
+		for b in port.read(max(1, port.in_waiting)):
+			yield b
+
+
+# frame number and the blocks of each packet, resyncs on 0xA5 0x5A after anything it cannot parse
+def packets(stream):
+	last = None
+	while True:
+		try:
+			b = next(stream)
+			if last != 0xA5 or b != 0x5A:
+				last = b
+				continue
+			last = None
+			frame = next(stream)
+			blocks = []
+			while True:
+				hi, lo = next(stream), next(stream)
+				if hi == 0xFF and lo == 0xFF:
+					break
+				block = (hi << 8) | lo
+				if block >= BLOCKS_N:
+					raise ValueError("block %d" % block)
+				pixels = []
+				while len(pixels) < BLOCK*BLOCK:
+					t = next(stream)
+					if t & RUN:
+						pixels += [next(stream)] * ((t & (RUN-1)) + 1)
+					else:
+						pixels += [next(stream) for k in range(t + 1)]
+				if len(pixels) != BLOCK*BLOCK:
+					raise ValueError("block %d has %d pixels" % (block, len(pixels)))
+				blocks.append((block, pixels))
+			yield frame, blocks
+		except ValueError as e:
+			print("skipped a bad packet:", e)
+		except StopIteration:
+			return
+
+
+def main():
+	if len(sys.argv) != 3:
+		print("usage: python MirrorDecode.py <capture file or serial port> <output folder>")
+		return
+	out = sys.argv[2]
+	os.makedirs(out, exist_ok=True)
+	screen = [0]*(WIDTH*HEIGHT)		# 8-bit colors, top row first
+	n, expected = 0, None
+	for frame, blocks in packets(source(sys.argv[1])):
+		if expected is not None and frame != expected:
+			print("lost %d packets before frame %d" % ((frame - expected) & 0xFF, n))
+		expected = (frame + 1) & 0xFF
+		for block, pixels in blocks:
+			x0, y0 = (block % BLOCK_COLS)*BLOCK, (block // BLOCK_COLS)*BLOCK
+			for r in range(BLOCK):
+				screen[(y0+r)*WIDTH + x0:(y0+r)*WIDTH + x0 + BLOCK] = pixels[r*BLOCK:(r+1)*BLOCK]
+		with open(os.path.join(out, "%05d.ppm" % n), "wb") as f:
+			f.write(b"P6 %d %d 255\n" % (WIDTH, HEIGHT))
+			f.write(b"".join(COLORS[c] for c in screen))
+		n += 1
+	print("%d frames" % n)
+
+
+main()